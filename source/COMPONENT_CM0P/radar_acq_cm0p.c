@@ -0,0 +1,346 @@
+/*****************************************************************************
+ * File name: radar_acq_cm0p.c
+ *
+ * Description: This file implements the acquisition image of the CM0+ for
+ * RADAR_ACQ_CM0P builds. The CM0+ owns the SPI interface and the sensor,
+ * copies every frame from the sensor FIFO into the shared-memory ring and
+ * notifies the CM4, which only runs the processing. The directory has to be
+ * built as the CM0+ project of a two-core application, see ACQ_CM0P in the
+ * Makefile; the CM4 application excludes it.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stdbool.h>
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+
+#include "resource_map.h"
+#include "xensiv_bgt60trxx_mtb.h"
+
+#include "radar_acq_ipc.h"
+#include "radar_shm_ring.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define XENSIV_BGT60TRXX_SPI_FREQUENCY      (25000000UL)
+
+/* the CM0+ has two priority bits */
+#define GPIO_INTERRUPT_PRIORITY             (1)
+
+/* command channel polling period */
+#define CMD_POLL_PERIOD_MS                  (1U)
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static int32_t radar_open(const radar_acq_ipc_request_s *request);
+static int32_t radar_start(const radar_acq_ipc_request_s *request);
+static int32_t radar_stop(void);
+#if defined(CYHAL_API_VERSION) && (CYHAL_API_VERSION >= 2)
+static void xensiv_bgt60trxx_interrupt_handler(void* args, cyhal_gpio_event_t event);
+#else
+static void xensiv_bgt60trxx_interrupt_handler(void* args, cyhal_gpio_irq_event_t event);
+#endif
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static cyhal_spi_t spi_obj;
+static xensiv_bgt60trxx_mtb_t bgt60_obj;
+static bool radar_opened = false;
+
+/* ring of the running acquisition, NULL while stopped */
+static radar_shm_ring_s * volatile ring = NULL;
+static uint32_t samples_per_frame;
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* This is the main function of the CM0+.
+*    1. Initializes the device and enables the CM4
+*    2. In an infinite loop, serves the requests of the CM4
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int
+*
+*******************************************************************************/
+int main(void)
+{
+    IPC_STRUCT_Type *channel = Cy_IPC_Drv_GetIpcBaseAddress(RADAR_ACQ_IPC_CMD_CHANNEL);
+    radar_acq_ipc_request_s *request;
+
+    /* Initialize the device and board peripherals */
+    if (cybsp_init() != CY_RSLT_SUCCESS)
+    {
+        CY_ASSERT(0);
+    }
+
+    /* Enable global interrupts */
+    __enable_irq();
+
+    /* Enable CM4. CY_CORTEX_M4_APPL_ADDR must be updated if CM4 memory layout is changed. */
+    Cy_SysEnableCM4(CY_CORTEX_M4_APPL_ADDR);
+
+    for(;;)
+    {
+        if (Cy_IPC_Drv_ReadMsgPtr(channel, (void**)&request) == CY_IPC_DRV_SUCCESS)
+        {
+            int32_t status = -1;
+
+            if (request->cmd == RADAR_ACQ_IPC_CMD_START)
+            {
+                status = radar_start(request);
+            }
+            else if (request->cmd == RADAR_ACQ_IPC_CMD_STOP)
+            {
+                status = radar_stop();
+            }
+
+            /* the CM4 may reuse the request once the status is written */
+            __DMB();
+            request->status = status;
+
+            (void)Cy_IPC_Drv_LockRelease(channel, CY_IPC_NO_NOTIFICATION);
+        }
+
+        Cy_SysLib_Delay(CMD_POLL_PERIOD_MS);
+    }
+}
+
+/*******************************************************************************
+* Function Name: radar_open
+********************************************************************************
+* Summary:
+* This function initializes the SPI interface and the sensor with the
+* register list of the first start request.
+*
+* Parameters:
+*  request: start request
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t radar_open(const radar_acq_ipc_request_s *request)
+{
+    if (cyhal_spi_init(&spi_obj,
+                       PIN_XENSIV_BGT60TRXX_SPI_MOSI,
+                       PIN_XENSIV_BGT60TRXX_SPI_MISO,
+                       PIN_XENSIV_BGT60TRXX_SPI_SCLK,
+                       NC,
+                       NULL,
+                       8,
+                       CYHAL_SPI_MODE_00_MSB,
+                       false) != CY_RSLT_SUCCESS)
+    {
+        return -2;
+    }
+
+    /* Reduce drive strength to improve EMI */
+    Cy_GPIO_SetSlewRate(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CY_GPIO_SLEW_FAST);
+    Cy_GPIO_SetDriveSel(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CY_GPIO_DRIVE_1_8);
+    Cy_GPIO_SetSlewRate(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CY_GPIO_SLEW_FAST);
+    Cy_GPIO_SetDriveSel(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CY_GPIO_DRIVE_1_8);
+
+    if (cyhal_spi_set_frequency(&spi_obj, XENSIV_BGT60TRXX_SPI_FREQUENCY) != CY_RSLT_SUCCESS)
+    {
+        return -2;
+    }
+
+    /* Enable LDO */
+    if (cyhal_gpio_init(PIN_XENSIV_BGT60TRXX_LDO_EN,
+                        CYHAL_GPIO_DIR_OUTPUT,
+                        CYHAL_GPIO_DRIVE_STRONG,
+                        true) != CY_RSLT_SUCCESS)
+    {
+        return -2;
+    }
+
+    /* Wait LDO stable */
+    (void)cyhal_system_delay_ms(5);
+
+    if (xensiv_bgt60trxx_mtb_init(&bgt60_obj,
+                                  &spi_obj,
+                                  PIN_XENSIV_BGT60TRXX_SPI_CSN,
+                                  PIN_XENSIV_BGT60TRXX_RSTN,
+                                  request->regs,
+                                  request->num_regs) != CY_RSLT_SUCCESS)
+    {
+        return -2;
+    }
+
+    if (xensiv_bgt60trxx_mtb_interrupt_init(&bgt60_obj,
+                                            request->num_samples_per_frame*2,
+                                            PIN_XENSIV_BGT60TRXX_IRQ,
+                                            GPIO_INTERRUPT_PRIORITY,
+                                            xensiv_bgt60trxx_interrupt_handler,
+                                            NULL) != CY_RSLT_SUCCESS)
+    {
+        return -2;
+    }
+
+    radar_opened = true;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: radar_start
+********************************************************************************
+* Summary:
+* This function programs the register list of the request, attaches the ring
+* and starts the frame generation.
+*
+* Parameters:
+*  request: start request
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t radar_start(const radar_acq_ipc_request_s *request)
+{
+    if ((request->ring == NULL) || (request->regs == NULL) ||
+        ((request->num_samples_per_frame * 2U) > request->ring->slot_size))
+    {
+        return -1;
+    }
+
+    if (!radar_opened)
+    {
+        if (radar_open(request) != 0)
+        {
+            return -2;
+        }
+    }
+    else if ((xensiv_bgt60trxx_config(&bgt60_obj.dev, request->regs, request->num_regs) != XENSIV_BGT60TRXX_STATUS_OK) ||
+             (xensiv_bgt60trxx_set_fifo_limit(&bgt60_obj.dev, request->num_samples_per_frame*2) != XENSIV_BGT60TRXX_STATUS_OK) ||
+             (xensiv_bgt60trxx_soft_reset(&bgt60_obj.dev, XENSIV_BGT60TRXX_RESET_FIFO) != XENSIV_BGT60TRXX_STATUS_OK))
+    {
+        return -2;
+    }
+
+    samples_per_frame = request->num_samples_per_frame;
+    ring = request->ring;
+
+    if (xensiv_bgt60trxx_start_frame(&bgt60_obj.dev, true) != XENSIV_BGT60TRXX_STATUS_OK)
+    {
+        ring = NULL;
+        return -2;
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: radar_stop
+********************************************************************************
+* Summary:
+* This function stops the frame generation and detaches the ring, the CM4 may
+* re-provision the ring afterwards.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t radar_stop(void)
+{
+    uint32_t state;
+
+    if (!radar_opened)
+    {
+        return 0;
+    }
+
+    if (xensiv_bgt60trxx_start_frame(&bgt60_obj.dev, false) != XENSIV_BGT60TRXX_STATUS_OK)
+    {
+        return -2;
+    }
+
+    /* a FIFO interrupt in progress completes before the ring is detached */
+    state = Cy_SysLib_EnterCriticalSection();
+    ring = NULL;
+    Cy_SysLib_ExitCriticalSection(state);
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: xensiv_bgt60trxx_interrupt_handler
+********************************************************************************
+* Summary:
+* This is the interrupt handler to react on sensor indicating the availability
+* of new data
+*    1. Reads the frame from the sensor FIFO into the next free ring slot
+*    2. Publishes the slot and notifies the CM4
+*    If the CM4 fell behind and the ring is full, the frame is discarded.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+#if defined(CYHAL_API_VERSION) && (CYHAL_API_VERSION >= 2)
+static void xensiv_bgt60trxx_interrupt_handler(void *args, cyhal_gpio_event_t event)
+#else
+static void xensiv_bgt60trxx_interrupt_handler(void *args, cyhal_gpio_irq_event_t event)
+#endif
+{
+    radar_shm_ring_s *r = ring;
+    uint8_t *slot;
+
+    CY_UNUSED_PARAMETER(args);
+    CY_UNUSED_PARAMETER(event);
+
+    if (r == NULL)
+    {
+        return;
+    }
+
+    slot = radar_shm_ring_claim(r);
+    if (slot == NULL)
+    {
+        radar_shm_ring_drop(r);
+        (void)xensiv_bgt60trxx_soft_reset(&bgt60_obj.dev, XENSIV_BGT60TRXX_RESET_FIFO);
+        return;
+    }
+
+    if (xensiv_bgt60trxx_get_fifo_data(&bgt60_obj.dev,
+                                       (uint16_t*)slot,
+                                       samples_per_frame) == XENSIV_BGT60TRXX_STATUS_OK)
+    {
+        radar_shm_ring_publish(r, samples_per_frame * 2U);
+
+        Cy_IPC_Drv_AcquireNotify(Cy_IPC_Drv_GetIpcBaseAddress(RADAR_ACQ_IPC_NOTIFY_CHANNEL),
+                                 1UL << RADAR_ACQ_IPC_NOTIFY_INTR);
+    }
+}
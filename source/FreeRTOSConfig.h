@@ -84,7 +84,7 @@
 /* Memory allocation related definitions. */
 #define configSUPPORT_STATIC_ALLOCATION         1
 #define configSUPPORT_DYNAMIC_ALLOCATION        1
-#define configTOTAL_HEAP_SIZE                   (128 * 1024)
+#define configTOTAL_HEAP_SIZE                   (64 * 1024) /* RDM buffer is provisioned from the radar frame arena */
 #define configAPPLICATION_ALLOCATED_HEAP        0
 
 /* Hook function related definitions. */
@@ -24,6 +24,7 @@
  * ===========================================================================
  */
 
+#include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 #include "cy_retarget_io.h"
@@ -36,11 +37,27 @@
 #include "xensiv_radar_gestures.h"
 #include "resource_map.h"
 #include "cyhal_gpio.h"
+#include "radar_profiles.h"
+#include "radar_frame_arena.h"
+#include "radar_range_doppler.h"
+#include "radar_clutter_map.h"
+#include "radar_aoa.h"
+#include "radar_pipeline.h"
+#include "radar_run_state.h"
+#include "radar_stream.h"
+#include "radar_telemetry.h"
+#include "radar_uart_tx.h"
+#include "radar_recorder.h"
+#include "radar_inference.h"
+#include "radar_decision.h"
+#include "radar_bench.h"
+#include "radar_boot.h"
+#include "radar_config_store.h"
 
 /*******************************************************************************
  * Macros
  ********************************************************************************/
-#define NUMBER_OF_COMMANDS (5)
+#define NUMBER_OF_COMMANDS (19)
 
 /* Strings length */
 #define MAX_INPUT_LENGTH              (100)
@@ -99,6 +116,34 @@ static BaseType_t display_solution_config(char *pcWriteBuffer, size_t xWriteBuff
         const char *pcCommandString);
 static BaseType_t set_verbose(char *pcWriteBuffer,
         size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t set_profile(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t set_doppler_mode(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t set_range_gate(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t set_clutter_mode(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t display_aoa(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t display_pipeline(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t set_run_state(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t set_stream(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t set_telemetry_mode(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t set_recorder(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t set_backend(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t set_decision(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t run_bench(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
+static BaseType_t show_boot(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString);
 static inline bool check_bool_validation(const char *value, const char *enable,
         const char *disable);
 static inline bool string_to_bool(const char *string, const char *enable,
@@ -140,12 +185,117 @@ static CLI_Command_Definition_t command_list[NUMBER_OF_COMMANDS] =
         .pcHelpString = "gestures_detect <Gestures|ALL> \r\n eg: gestures_detect PUSH SWIPE_UP - enable PUSH & SWIPE UP\r\n",
         .pxCommandInterpreter = set_gestures_detect_list,
         .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "profile",
+        .pcHelpString = "profile [name] - list radar profiles with SPI, RAM and CPU per frame or select one\r\n eg: profile presence\r\n",
+        .pxCommandInterpreter = set_profile,
+        .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "doppler",
+        .pcHelpString = "doppler [sliding|recompute] - range-Doppler cycle statistics or select update strategy\r\n",
+        .pxCommandInterpreter = set_doppler_mode,
+        .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "gate",
+        .pcHelpString = "gate [min_cm max_cm] - range gate and preprocessing cycle statistics or set range gate\r\n eg: gate 10 60\r\n",
+        .pxCommandInterpreter = set_range_gate,
+        .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "clutter",
+        .pcHelpString = "clutter [off|learn|track|freeze] - clutter map state or select its mode\r\n eg: clutter learn\r\n",
+        .pxCommandInterpreter = set_clutter_mode,
+        .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "aoa",
+        .pcHelpString = "aoa - angle-of-arrival trajectory and cycle budget of the preprocessing stages\r\n",
+        .pxCommandInterpreter = display_aoa,
+        .cExpectedNumberOfParameters = 0
+    },
+    {
+        .pcCommand = "pipeline",
+        .pcHelpString = "pipeline - timing and backlog of the processing pipeline stages\r\n",
+        .pxCommandInterpreter = display_pipeline,
+        .cExpectedNumberOfParameters = 0
+    },
+    {
+        .pcCommand = "state",
+        .pcHelpString = "state [active|standby|suspended] - run state and time to first inference or select the state entered on ESC\r\n eg: state standby\r\n",
+        .pxCommandInterpreter = set_run_state,
+        .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "stream",
+        .pcHelpString = "stream [enable|disable] - raw frame stream statistics or enable/disable the stream on the UART\r\n",
+        .pxCommandInterpreter = set_stream,
+        .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "telemetry",
+        .pcHelpString = "telemetry [text|binary] - telemetry statistics or select text or binary framed output of the results\r\n",
+        .pxCommandInterpreter = set_telemetry_mode,
+        .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "recorder",
+        .pcHelpString = "recorder [off|manual|detection|low|all|trigger|dump] - flight recorder state, select its triggers, freeze or dump the window\r\n eg: recorder dump\r\n",
+        .pxCommandInterpreter = set_recorder,
+        .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "backend",
+        .pcHelpString = "backend [name] - list inference backends with RAM and CPU per frame or select one\r\n eg: backend motion\r\n",
+        .pxCommandInterpreter = set_backend,
+        .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "decision",
+        .pcHelpString = "decision [frame|vote votes window score|integral sum window] - decide gestures on a frame or vote over the last frames\r\n eg: decision vote 2 4 0.35\r\n",
+        .pxCommandInterpreter = set_decision,
+        .cExpectedNumberOfParameters = -1 /* variable no. of parameters */
+    },
+    {
+        .pcCommand = "bench",
+        .pcHelpString = "bench - cycles of the processing stages over canned frames, no radar needed\r\n",
+        .pxCommandInterpreter = run_bench,
+        .cExpectedNumberOfParameters = 0
+    },
+    {
+        .pcCommand = "boot",
+        .pcHelpString = "boot - startup phases, time to the first frame and the first result after reset\r\n",
+        .pxCommandInterpreter = show_boot,
+        .cExpectedNumberOfParameters = 0
     }
 };
 
 bool gesture_detect_list[NUMBER_OF_GESTURE_CLASSES]  = {false, true, true, true, false, false, true, true};
 extern ce_state_s ce_app_state;
-extern volatile bool is_settings_mode;
+extern radar_run_state_s run_state;
+extern int32_t radar_set_run_state(radar_run_state_e state);
+extern radar_stream_s stream;
+extern radar_telemetry_s telemetry;
+extern radar_uart_tx_s uart_tx;
+extern radar_recorder_s recorder;
+extern int32_t radar_apply_profile(const radar_profile_s *profile);
+extern int32_t radar_apply_inference_backend(const radar_inference_backend_s *backend);
+extern radar_decision_s decision;
+extern int32_t radar_apply_decision_vote(const radar_decision_vote_s *vote);
+extern int32_t radar_run_bench(radar_bench_s *bench);
+extern radar_boot_s boot;
+extern radar_config_store_s config_store;
+extern int32_t radar_save_config(void);
+extern radar_range_doppler_s range_doppler;
+extern radar_range_fft_s range_fft;
+extern uint32_t range_gate_min_cm;
+extern uint32_t range_gate_max_cm;
+extern int32_t radar_apply_range_gate(uint32_t min_cm, uint32_t max_cm);
+extern radar_clutter_map_s clutter_map;
+extern radar_aoa_s aoa;
+extern radar_pipeline_s pipeline;
 
 /*******************************************************************************
  * Function Name: console_task
@@ -155,10 +305,11 @@ extern volatile bool is_settings_mode;
  *    1. Register commands
  *    2. In loop there are two modes: primary mode all gestures are enabled and setting mode a particular gesture or group of gestures can be enabled.
  *       - Waits for a sign
- *       - When ENTER is hit go to the settings mode
+ *       - When ENTER is hit go to the settings mode, the radar is stopped
  *       - Use 'help' command to know what commands are available
  *       - Type commands with values to change parameters
- *       - Press ESC to exit settings mode and go again to gesture mode
+ *       - Press ESC to exit settings mode and go again to gesture mode, or
+ *         to the run state selected with the 'state' command
  *
  * Parameters:
  *  void
@@ -195,7 +346,11 @@ __NO_RETURN void console_task(void *pvParameters)
             /* Enter setting mode */
             if (c == ENTER_KEY)
             {
-                is_settings_mode = true;
+                run_state.resume_state = run_state.state;
+                if (radar_set_run_state(RADAR_RUN_STATE_SETTINGS) != 0)
+                {
+                    printf("[MSG] ERROR: radar stop failed\n");
+                }
                 cInputIndex = 0;
                 memset(pcInputString, 0x00, MAX_INPUT_LENGTH);
                 setting_mode = true;
@@ -211,14 +366,22 @@ __NO_RETURN void console_task(void *pvParameters)
             /* Exit setting mode */
             if (c == ESC_KEY)
             {
-                is_settings_mode = false;
                 cInputIndex = 0;
                 memset(pcInputString, 0x00, MAX_INPUT_LENGTH);
                 setting_mode = false;
                 printf("\r\nQuit from settings menu\r\n\n");
                 cyhal_gpio_write(LED_RGB_RED, false); /* turn off red LED */
-                cyhal_gpio_write(LED_RGB_GREEN, true); /* turn on green LED */
+                cyhal_gpio_write(LED_RGB_GREEN, run_state.resume_state == RADAR_RUN_STATE_ACTIVE); /* green LED on when active */
                 cyhal_gpio_write(LED_RGB_BLUE, false); /* turn off blue LED */
+                /* the settings of the session are saved in one write while the radar is stopped */
+                if (radar_save_config() != 0)
+                {
+                    printf("[MSG] ERROR: saving the settings failed\n");
+                }
+                if (radar_set_run_state(run_state.resume_state) != 0)
+                {
+                    printf("[MSG] ERROR: radar restart failed\n");
+                }
             }
             else if (c == ENTER_KEY) /* confirm entered text */
             {
@@ -326,10 +489,12 @@ static BaseType_t set_verbose(char *pcWriteBuffer,
 }
 
 /*******************************************************************************
- * Function Name: set_gestures_detect_list
+ * Function Name: set_profile
  ********************************************************************************
  * Summary:
- *   Setting mode for gesture detection algorithm
+ *   Lists the radar configuration profiles with their SPI bytes per frame,
+ *   arena bytes and the acquisition cycles measured while they were active,
+ *   or selects the one given as parameter
  *
  * Parameters:
  *   pcWriteBuffer: buffer into which the output from executing the command can be written
@@ -340,157 +505,1205 @@ static BaseType_t set_verbose(char *pcWriteBuffer,
  * Return:
  *   pdFALSE indicating that the function ends it's processing
  *******************************************************************************/
-static BaseType_t set_gestures_detect_list(char *pcWriteBuffer, size_t xWriteBufferLen,
-        const char *pcCommandString)
+static BaseType_t set_profile(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
 {
     const char *pcParameter;
-    char gesture_array[MAX_GESTURE_STRING_LENGTH] = {0};
     BaseType_t lParameterStringLength;
-    uint8_t param_count;
-    xensiv_radar_gestures_class_e gesture_idx;
-    bool update_list[NUMBER_OF_GESTURE_CLASSES]  = {false, false, false, false, false, false, false, false};
-    uint8_t i=0;
-    bool first_print = true;
+    const radar_profile_s *profile;
+    const radar_dsp_stats_s *stats;
 
     configASSERT(pcWriteBuffer);
 
-    for ( param_count=1; param_count<=xWriteBufferLen; param_count++ )
-    {
-        /* Obtain the parameter string. */
-        pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, /* The command string itself. */
-                param_count,
-                &lParameterStringLength); /* Store the parameter string length. */
-
-        configASSERT(pcParameter);
+    /* Obtain the parameter string. */
+    pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, /* The command string itself. */
+            1, /* Return the first parameter. */
+            &lParameterStringLength); /* Store the parameter string length. */
 
-        memset(gesture_array, 0, MAX_GESTURE_STRING_LENGTH);
-        for ( i=0; i<lParameterStringLength; i++)
+    if (pcParameter == NULL)
+    {
+        for (uint32_t i = 0; i < radar_profile_count(); ++i)
         {
-            gesture_array[i] = *pcParameter;
-            pcParameter++;
+            profile = radar_profile_get(i);
+            stats = radar_profile_get_stats(profile);
+            printf("%s %s %" PRIu32 "x%" PRIu32 "x%" PRIu32 " %s%s\n", CONFIG_PROFILE,
+                    profile->name,
+                    profile->num_samples_per_chirp,
+                    profile->num_chirps_per_frame,
+                    profile->num_rx_antennas,
+                    profile->description,
+                    (profile == radar_profile_get_active()) ? " (active)" : "");
+            printf("[INFO][PROFILE] %s spi %" PRIu32 " bytes ram %" PRIu32 " bytes acquisition frames %" PRIu32
+                   " cycles mean %" PRIu32 " max %" PRIu32 "\n",
+                    profile->name,
+                    radar_profile_spi_bytes_per_frame(profile),
+                    (uint32_t)radar_frame_arena_profile_size(profile),
+                    stats->frames, radar_dsp_stats_mean(stats), stats->cycles_max);
         }
+        sprintf(pcWriteBuffer, "\n");
+        return pdFALSE;
+    }
 
-        if (check_supported_gesture_validation(&gesture_array[0]))
+    profile = radar_profile_find(pcParameter);
+    if (profile == NULL)
+    {
+        sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+    }
+    else if (radar_apply_profile(profile) != 0)
+    {
+        snprintf(pcWriteBuffer, xWriteBufferLen, "%sprofile %s\n", MSG_TYPE_ERROR, profile->name);
+    }
+    else
+    {
+        if (!radar_inference_backend_ready(radar_inference_backend_get_active()))
         {
-            if( first_print )
-            {
-                printf(CONFIG_GESTURES_DETECT);
-                first_print = false;
-            }
-
-            gesture_idx = string_to_gesture(&gesture_array[0]);
-            switch ( gesture_idx )
-            {
-                case XENSIV_RADAR_GESTURE_PUSH:
-                    update_list[XENSIV_RADAR_GESTURE_PUSH] = 1;
-                    break;
-                case XENSIV_RADAR_GESTURE_SWIPE_LEFT:
-                    update_list[XENSIV_RADAR_GESTURE_SWIPE_LEFT] = 1;
-                    break;
-                case XENSIV_RADAR_GESTURE_SWIPE_RIGHT:
-                    update_list[XENSIV_RADAR_GESTURE_SWIPE_RIGHT] = 1;
-                    break;
-                case XENSIV_RADAR_GESTURE_SWIPE_UP:
-                    update_list[XENSIV_RADAR_GESTURE_SWIPE_UP] = 1;
-                    break;
-                case XENSIV_RADAR_GESTURE_SWIPE_DOWN:
-                    update_list[XENSIV_RADAR_GESTURE_SWIPE_DOWN] = 1;
-                    break;
-                case XENSIV_RADAR_GESTURE_ALL: default:
-                    update_list[XENSIV_RADAR_GESTURE_PUSH] = 1;
-                    update_list[XENSIV_RADAR_GESTURE_SWIPE_LEFT] = 1;
-                    update_list[XENSIV_RADAR_GESTURE_SWIPE_RIGHT] = 1;
-                    update_list[XENSIV_RADAR_GESTURE_SWIPE_UP] = 1;
-                    update_list[XENSIV_RADAR_GESTURE_SWIPE_DOWN] = 1;
-                    break;
-            }
+            printf("%s gestures detection paused in profile %s\n", MSG, profile->name);
         }
-        else
+        sprintf(pcWriteBuffer, "ok\n");
+    }
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: set_doppler_mode
+ ********************************************************************************
+ * Summary:
+ *   Prints cycles per frame of both range-Doppler update strategies or selects
+ *   the one given as parameter
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t set_doppler_mode(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    static const char *mode_names[RANGE_DOPPLER_MODE_NUM] = {"recompute", "sliding"};
+    const char *pcParameter;
+    BaseType_t lParameterStringLength;
+
+    configASSERT(pcWriteBuffer);
+
+    /* Obtain the parameter string. */
+    pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, /* The command string itself. */
+            1, /* Return the first parameter. */
+            &lParameterStringLength); /* Store the parameter string length. */
+
+    if (pcParameter == NULL)
+    {
+        for (uint32_t mode = 0; mode < RANGE_DOPPLER_MODE_NUM; ++mode)
         {
-            sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+            const radar_dsp_stats_s *stats = &range_doppler.stats[mode];
+
+            printf("[INFO][DOPPLER] %s%s frames %" PRIu32 " cycles mean %" PRIu32 " max %" PRIu32 "\n",
+                    mode_names[mode],
+                    (mode == range_doppler.mode) ? " (active)" : "",
+                    stats->frames, radar_dsp_stats_mean(stats), stats->cycles_max);
         }
+        sprintf(pcWriteBuffer, "\n");
+        return pdFALSE;
     }
 
-    /* update gesture detect list */
-    for ( i=0; i<NUMBER_OF_GESTURE_CLASSES; i++ )
+    for (uint32_t mode = 0; mode < RANGE_DOPPLER_MODE_NUM; ++mode)
     {
-        if ( update_list[i] )
+        if (strcmp(pcParameter, mode_names[mode]) == 0)
         {
-            switch ( i )
-            {
-                case XENSIV_RADAR_GESTURE_PUSH:
-                    printf(GESTURE_PUSH_STRING);
-                    break;
-                case XENSIV_RADAR_GESTURE_SWIPE_LEFT:
-                    printf(GESTURE_SWIPE_LEFT_STRING);
-                    break;
-                case XENSIV_RADAR_GESTURE_SWIPE_RIGHT:
-                    printf(GESTURE_SWIPE_RIGHT_STRING);
-                    break;
-                case XENSIV_RADAR_GESTURE_SWIPE_UP:
-                    printf(GESTURE_SWIPE_UP_STRING);
-                    break;
-                case XENSIV_RADAR_GESTURE_SWIPE_DOWN:
-                    printf(GESTURE_SWIPE_DOWN_STRING);
-                    break;
-                default:
-                    break;
-            }
-            printf(" ");
+            radar_range_doppler_set_mode(&range_doppler, (radar_range_doppler_mode_e)mode);
+            sprintf(pcWriteBuffer, "ok\n");
+            return pdFALSE;
         }
-        sprintf(pcWriteBuffer, "\n");
-        gesture_detect_list[i] = update_list[i];
     }
 
+    sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+
     return pdFALSE;
 }
 
 /*******************************************************************************
- * Function Name: display_gestures_list
+ * Function Name: print_range_gate
  ********************************************************************************
  * Summary:
- *   Query for supported gestures information
+ *   Prints the range gate in centimeters and range bins
+ *
+ * Parameters:
+ *   none
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void print_range_gate(void)
+{
+    float resolution_cm = radar_profile_range_resolution(radar_profile_get_active()) * 100.0f;
+
+    printf("%s %" PRIu32 " %" PRIu32 " cm bins %" PRIu32 "..%" PRIu32 " of %" PRIu32 " (%.2f cm per bin)\n",
+            CONFIG_RANGE_GATE, range_gate_min_cm, range_gate_max_cm,
+            range_fft.first_bin, range_fft.first_bin + range_fft.num_gated_bins - 1U,
+            range_fft.num_range_bins, resolution_cm);
+}
+
+/*******************************************************************************
+ * Function Name: set_range_gate
+ ********************************************************************************
+ * Summary:
+ *   Prints the range gate with the cycles per frame of the range FFT and the
+ *   range-Doppler stage, or sets the range gate given as parameters
  *
  * Parameters:
  *   pcWriteBuffer: buffer into which the output from executing the command can be written
  *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
- *   pcCommandString: entire string as input by the user (from which parameters can be extracted)
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
  *
  * Return:
  *   pdFALSE indicating that the function ends it's processing
  *******************************************************************************/
-static BaseType_t display_gestures_list(char *pcWriteBuffer, size_t xWriteBufferLen,
-        const char *pcCommandString)
+static BaseType_t set_range_gate(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
 {
-    printf(CONFIG);
-    printf("\n");
-    printf(CONFIG_GESTURES_LIST);
-    printf(GESTURE_PUSH_STRING);
-    printf(" ");
-    printf(GESTURE_SWIPE_LEFT_STRING);
-    printf(" ");
-    printf(GESTURE_SWIPE_RIGHT_STRING);
-    printf(" ");
-    printf(GESTURE_SWIPE_UP_STRING);
-    printf(" ");
-    printf(GESTURE_SWIPE_DOWN_STRING);
-    printf("\n");
-    printf(CONFIG);
-    sprintf(pcWriteBuffer, "\n");
+    const char *pcMin;
+    const char *pcMax;
+    BaseType_t lParameterStringLength;
+    char *end;
+    unsigned long min_cm;
+    unsigned long max_cm;
+
+    configASSERT(pcWriteBuffer);
+
+    pcMin = FreeRTOS_CLIGetParameter(pcCommandString, 1, &lParameterStringLength);
+    pcMax = FreeRTOS_CLIGetParameter(pcCommandString, 2, &lParameterStringLength);
+
+    if (pcMin == NULL)
+    {
+        const radar_dsp_stats_s *fft_stats = &range_fft.stats;
+        const radar_dsp_stats_s *doppler_stats = &range_doppler.stats[range_doppler.mode];
+
+        print_range_gate();
+        printf("[INFO][GATE] range_fft frames %" PRIu32 " cycles mean %" PRIu32 " max %" PRIu32 "\n",
+                fft_stats->frames, radar_dsp_stats_mean(fft_stats), fft_stats->cycles_max);
+        printf("[INFO][GATE] doppler frames %" PRIu32 " cycles mean %" PRIu32 " max %" PRIu32 "\n",
+                doppler_stats->frames, radar_dsp_stats_mean(doppler_stats), doppler_stats->cycles_max);
+        sprintf(pcWriteBuffer, "\n");
+        return pdFALSE;
+    }
+
+    if (pcMax == NULL)
+    {
+        sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+        return pdFALSE;
+    }
+
+    /* parameters are separated by spaces, strtoul stops at the first one */
+    min_cm = strtoul(pcMin, &end, 10);
+    if ((end == pcMin) || ((*end != ' ') && (*end != '\0')))
+    {
+        sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+        return pdFALSE;
+    }
+
+    max_cm = strtoul(pcMax, &end, 10);
+    if ((end == pcMax) || ((*end != ' ') && (*end != '\0')) ||
+        (radar_apply_range_gate((uint32_t)min_cm, (uint32_t)max_cm) != 0))
+    {
+        sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+        return pdFALSE;
+    }
+
+    sprintf(pcWriteBuffer, "ok\n");
 
     return pdFALSE;
 }
 
 /*******************************************************************************
- * Function Name: display_board_Info
+ * Function Name: set_clutter_mode
  ********************************************************************************
  * Summary:
- *   Query for board information
+ *   Prints mode and cycles per frame of the clutter map or selects the mode
+ *   given as parameter
  *
  * Parameters:
  *   pcWriteBuffer: buffer into which the output from executing the command can be written
  *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
- *   pcCommandString: entire string as input by the user (from which parameters can be extracted)
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t set_clutter_mode(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    static const char *mode_names[RADAR_CLUTTER_MAP_MODE_NUM] = {"off", "learn", "track", "freeze"};
+    const char *pcParameter;
+    BaseType_t lParameterStringLength;
+
+    configASSERT(pcWriteBuffer);
+
+    /* Obtain the parameter string. */
+    pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, /* The command string itself. */
+            1, /* Return the first parameter. */
+            &lParameterStringLength); /* Store the parameter string length. */
+
+    if (pcParameter == NULL)
+    {
+        const radar_dsp_stats_s *stats = &clutter_map.stats;
+
+        printf("%s %s\n", CONFIG_CLUTTER, mode_names[clutter_map.mode]);
+        printf("[INFO][CLUTTER] frames %" PRIu32 " cycles mean %" PRIu32 " max %" PRIu32 "\n",
+                stats->frames, radar_dsp_stats_mean(stats), stats->cycles_max);
+        sprintf(pcWriteBuffer, "\n");
+        return pdFALSE;
+    }
+
+    for (uint32_t mode = 0; mode < RADAR_CLUTTER_MAP_MODE_NUM; ++mode)
+    {
+        if (strcmp(pcParameter, mode_names[mode]) == 0)
+        {
+            radar_clutter_map_set_mode(&clutter_map, (radar_clutter_map_mode_e)mode);
+            sprintf(pcWriteBuffer, "ok\n");
+            return pdFALSE;
+        }
+    }
+
+    sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: print_stage_budget
+ ********************************************************************************
+ * Summary:
+ *   Prints cycles per frame of a preprocessing stage and their share of the
+ *   frame period
+ *
+ * Parameters:
+ *   name: stage name
+ *   mean: mean cycles per frame
+ *   max: worst case cycles per frame
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void print_stage_budget(const char *name, uint32_t mean, uint32_t max)
+{
+    float budget = (float)radar_dsp_cycles_per_second() * (float)XENSIV_BGT60TRXX_CONF_FRAME_REPETITION_TIME_S;
+
+    printf("[INFO][BUDGET] %s cycles mean %" PRIu32 " max %" PRIu32 " (%.2f%% of frame)\n",
+            name, mean, max, (100.0f * (float)max) / budget);
+}
+
+/*******************************************************************************
+ * Function Name: display_aoa
+ ********************************************************************************
+ * Summary:
+ *   Prints the angle-of-arrival trajectory, latest frame first, and the
+ *   cycles per frame of all preprocessing stages against the frame period
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t display_aoa(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    const radar_dsp_stats_s *doppler_stats = &range_doppler.stats[range_doppler.mode];
+    uint32_t total_mean = 0;
+    uint32_t total_max = 0;
+
+    configASSERT(pcWriteBuffer);
+
+    for (uint32_t age = 0; age < RADAR_AOA_TRAJECTORY_LEN; ++age)
+    {
+        const radar_aoa_point_s *point = radar_aoa_get_point(&aoa, age);
+
+        if (point->valid)
+        {
+            printf("[INFO][AOA] -%" PRIu32 " azimuth %d elevation %d range_bin %u magnitude %.1f\n",
+                    age, point->azimuth_deg, point->elevation_deg, point->range_bin, point->magnitude);
+        }
+    }
+
+    print_stage_budget("clutter", radar_dsp_stats_mean(&clutter_map.stats), clutter_map.stats.cycles_max);
+    print_stage_budget("range_fft", radar_dsp_stats_mean(&range_fft.stats), range_fft.stats.cycles_max);
+    print_stage_budget("doppler", radar_dsp_stats_mean(doppler_stats), doppler_stats->cycles_max);
+    print_stage_budget("aoa", radar_dsp_stats_mean(&aoa.stats), aoa.stats.cycles_max);
+
+    total_mean = radar_dsp_stats_mean(&clutter_map.stats) + radar_dsp_stats_mean(&range_fft.stats) +
+                 radar_dsp_stats_mean(doppler_stats) + radar_dsp_stats_mean(&aoa.stats);
+    total_max = clutter_map.stats.cycles_max + range_fft.stats.cycles_max +
+                doppler_stats->cycles_max + aoa.stats.cycles_max;
+    print_stage_budget("total", total_mean, total_max);
+
+    sprintf(pcWriteBuffer, "\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: display_pipeline
+ ********************************************************************************
+ * Summary:
+ *   Prints frames, cycles per frame, backlog and dropped frames of every
+ *   pipeline stage, the latency of the whole pipeline, the deadline misses
+ *   and the active shed level
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t display_pipeline(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    const char shed_levels[RADAR_PIPELINE_SHED_NUM][10] = {"none", "optional", "decimate", "coalesce"};
+
+    configASSERT(pcWriteBuffer);
+
+    for (uint32_t i = 0; i < pipeline.num_stages; ++i)
+    {
+        const radar_pipeline_stage_s *stage = &pipeline.stages[i];
+
+        printf("[INFO][PIPELINE] %s frames %" PRIu32 " cycles mean %" PRIu32 " max %" PRIu32
+               " backlog %" PRIu32 " max %" PRIu32 " dropped %" PRIu32 " skipped %" PRIu32
+               " overruns %" PRIu32 "\n",
+                stage->name, stage->stats.frames, radar_dsp_stats_mean(&stage->stats),
+                stage->stats.cycles_max, (uint32_t)uxQueueMessagesWaiting(stage->queue),
+                stage->backlog_max, stage->dropped, stage->skipped, stage->overruns);
+    }
+
+    printf("[INFO][PIPELINE] in_flight %" PRIu32 " of %" PRIu32 " acquire_stalls %" PRIu32
+           " latency mean %" PRIu32 " max %" PRIu32 "\n",
+            pipeline.in_flight, (uint32_t)RADAR_PIPELINE_NUM_SLOTS, pipeline.acquire_stalls,
+            radar_dsp_stats_mean(&pipeline.latency), pipeline.latency.cycles_max);
+
+    printf("[INFO][PIPELINE] deadline %" PRIu32 " misses %" PRIu32 " shed %s decimated %" PRIu32
+           " coalesced %" PRIu32 " level_changes %" PRIu32 "\n",
+            pipeline.deadline_cycles, pipeline.deadline_misses, shed_levels[pipeline.shed_level],
+            pipeline.decimated, pipeline.coalesced, pipeline.level_changes);
+
+    sprintf(pcWriteBuffer, "\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: set_run_state
+ ********************************************************************************
+ * Summary:
+ *   Prints the run state, the state entered when the settings mode is left
+ *   and the time from the last resume to its first inference, or selects the
+ *   state entered on ESC given as parameter
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t set_run_state(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    static const char *state_names[RADAR_RUN_STATE_NUM] = {"active", "settings", "standby", "suspended"};
+    const float cycles_per_ms = (float)radar_dsp_cycles_per_second() / 1000.0f;
+    const char *pcParameter;
+    BaseType_t lParameterStringLength;
+
+    configASSERT(pcWriteBuffer);
+
+    /* Obtain the parameter string. */
+    pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, /* The command string itself. */
+            1, /* Return the first parameter. */
+            &lParameterStringLength); /* Store the parameter string length. */
+
+    if (pcParameter == NULL)
+    {
+        printf("%s %s resume %s\n", CONFIG_RUN_STATE, state_names[run_state.state],
+                state_names[run_state.resume_state]);
+        printf("[INFO][STATE] transitions %" PRIu32 " first inference %.2f ms max %.2f ms\n",
+                run_state.transitions, (float)run_state.first_inference_cycles / cycles_per_ms,
+                (float)run_state.first_inference_cycles_max / cycles_per_ms);
+        sprintf(pcWriteBuffer, "\n");
+        return pdFALSE;
+    }
+
+    for (uint32_t state = 0; state < RADAR_RUN_STATE_NUM; ++state)
+    {
+        /* the settings state is only entered with ENTER */
+        if ((state != RADAR_RUN_STATE_SETTINGS) && (strcmp(pcParameter, state_names[state]) == 0))
+        {
+            run_state.resume_state = (radar_run_state_e)state;
+            sprintf(pcWriteBuffer, "ok\n");
+            return pdFALSE;
+        }
+    }
+
+    sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: set_stream
+ ********************************************************************************
+ * Summary:
+ *   Prints the frames taken and skipped by the raw frame stream, its
+ *   compression ratio and encode cycles per frame, or enables or disables
+ *   the stream
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t set_stream(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    const char *pcParameter;
+    BaseType_t lParameterStringLength;
+
+    configASSERT(pcWriteBuffer);
+
+    /* Obtain the parameter string. */
+    pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, /* The command string itself. */
+            1, /* Return the first parameter. */
+            &lParameterStringLength); /* Store the parameter string length. */
+
+    if (pcParameter == NULL)
+    {
+        printf("%s %s\n", CONFIG_STREAM, stream.enabled ? ENABLE_STRING : DISABLE_STRING);
+        printf("[INFO][STREAM] offered %" PRIu32 " encoded %" PRIu32 " skipped busy %" PRIu32
+               " budget %" PRIu32 " ratio %.2f\n",
+                stream.offered, stream.encoded, stream.skipped_busy, stream.skipped_budget,
+                radar_stream_ratio(&stream));
+        printf("[INFO][STREAM] cycles mean %" PRIu32 " max %" PRIu32 " budget %" PRIu32 "\n",
+                radar_dsp_stats_mean(&stream.stats), stream.stats.cycles_max, stream.budget_cycles);
+        sprintf(pcWriteBuffer, "\n");
+        return pdFALSE;
+    }
+
+    if (!check_bool_validation(pcParameter, ENABLE_STRING, DISABLE_STRING))
+    {
+        sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+        return pdFALSE;
+    }
+
+    radar_stream_enable(&stream, string_to_bool(pcParameter, ENABLE_STRING, DISABLE_STRING));
+    sprintf(pcWriteBuffer, "ok\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: set_telemetry_mode
+ ********************************************************************************
+ * Summary:
+ *   Prints the telemetry mode, messages sent per type, dropped messages,
+ *   the framing overhead, the cycles per message and the counters of the
+ *   UART transmit ring, or selects the mode. The binary mode takes effect
+ *   when the settings mode is left, the console stays text.
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t set_telemetry_mode(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    static const char *mode_names[] = {"text", "binary"};
+    const char *pcParameter;
+    BaseType_t lParameterStringLength;
+
+    configASSERT(pcWriteBuffer);
+
+    /* Obtain the parameter string. */
+    pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, /* The command string itself. */
+            1, /* Return the first parameter. */
+            &lParameterStringLength); /* Store the parameter string length. */
+
+    if (pcParameter == NULL)
+    {
+        const radar_dsp_stats_s *stats = &telemetry.stats;
+
+        printf("%s %s\n", CONFIG_TELEMETRY, mode_names[telemetry.mode]);
+        printf("[INFO][TELEMETRY] gesture %" PRIu32 " metrics %" PRIu32 " trace %" PRIu32 " frame %" PRIu32
+               " dropped %" PRIu32 "\n",
+                telemetry.messages[RADAR_TELEMETRY_MSG_GESTURE], telemetry.messages[RADAR_TELEMETRY_MSG_METRICS],
+                telemetry.messages[RADAR_TELEMETRY_MSG_TRACE], telemetry.messages[RADAR_TELEMETRY_MSG_FRAME],
+                telemetry.dropped);
+        printf("[INFO][TELEMETRY] overhead %.2f%% cycles per message mean %" PRIu32 " max %" PRIu32 "\n",
+                (telemetry.payload_bytes > 0U) ?
+                    (100.0f * (float)(telemetry.wire_bytes - telemetry.payload_bytes) / (float)telemetry.payload_bytes) : 0.0f,
+                radar_dsp_stats_mean(stats), stats->cycles_max);
+        printf("[INFO][UART] written %" PRIu32 " dropped %" PRIu32 " bytes in %" PRIu32 " writes, waits %" PRIu32
+               " transfers %" PRIu32 " errors %" PRIu32 " level max %" PRIu32 " of %u\n",
+                uart_tx.written, uart_tx.dropped, uart_tx.dropped_writes, uart_tx.waits,
+                uart_tx.transfers, uart_tx.start_errors, uart_tx.level_max, RADAR_UART_TX_RING_SIZE);
+        sprintf(pcWriteBuffer, "\n");
+        return pdFALSE;
+    }
+
+    for (uint32_t mode = 0; mode < (sizeof(mode_names) / sizeof(mode_names[0])); ++mode)
+    {
+        if (strcmp(pcParameter, mode_names[mode]) == 0)
+        {
+            telemetry.mode = (radar_telemetry_mode_e)mode;
+            sprintf(pcWriteBuffer, "ok\n");
+            return pdFALSE;
+        }
+    }
+
+    sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: set_recorder
+ ********************************************************************************
+ * Summary:
+ *   Prints the flight recorder state, the frames of its window and the copy
+ *   cycles per frame, selects the triggers, freezes the window or dumps it
+ *   as records of the raw frame stream
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t set_recorder(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    static const char *state_names[] = {"off", "recording", "triggered", "frozen"};
+    static const char *trigger_names[] = {"none", "detection", "low", "", "command"};
+    static const char *mode_names[] = {"off", "manual", "detection", "low", "all"};
+    static const uint32_t mode_triggers[] = {
+        RADAR_RECORDER_TRIGGER_NONE,
+        RADAR_RECORDER_TRIGGER_COMMAND,
+        RADAR_RECORDER_TRIGGER_DETECTION | RADAR_RECORDER_TRIGGER_COMMAND,
+        RADAR_RECORDER_TRIGGER_LOW_CONFIDENCE | RADAR_RECORDER_TRIGGER_COMMAND,
+        RADAR_RECORDER_TRIGGER_ALL
+    };
+    const char *pcParameter;
+    BaseType_t lParameterStringLength;
+    int32_t frames;
+
+    configASSERT(pcWriteBuffer);
+
+    /* Obtain the parameter string. */
+    pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, /* The command string itself. */
+            1, /* Return the first parameter. */
+            &lParameterStringLength); /* Store the parameter string length. */
+
+    if (pcParameter == NULL)
+    {
+        const char *mode = "";
+
+        for (uint32_t i = 0; i < (sizeof(mode_names) / sizeof(mode_names[0])); ++i)
+        {
+            if (recorder.triggers == mode_triggers[i])
+            {
+                mode = mode_names[i];
+            }
+        }
+
+        printf("%s %s\n", CONFIG_RECORDER, mode);
+        printf("[INFO][RECORDER] %s, frames %" PRIu32 " of %" PRIu32 " slots, %" PRIu32 " after a trigger, store %u bytes\n",
+                state_names[recorder.state],
+                (recorder.stored < recorder.num_slots) ? recorder.stored : recorder.num_slots,
+                recorder.num_slots, recorder.post_frames,
+                (unsigned int)RADAR_RECORDER_STORE_SIZE(RADAR_PROFILE_MAX_SAMPLES_PER_FRAME));
+        if ((recorder.state == RADAR_RECORDER_STATE_TRIGGERED) || (recorder.state == RADAR_RECORDER_STATE_FROZEN))
+        {
+            printf("[INFO][RECORDER] triggered by %s after frame %u\n",
+                    trigger_names[recorder.trigger], (unsigned int)recorder.trigger_seq);
+        }
+        printf("[INFO][RECORDER] freezes %" PRIu32 " dumped %" PRIu32 " frames in %" PRIu32
+               " bytes, copy cycles mean %" PRIu32 " max %" PRIu32 "\n",
+                recorder.freezes, recorder.dumped, (uint32_t)recorder.dumped_bytes,
+                radar_dsp_stats_mean(&recorder.stats), recorder.stats.cycles_max);
+        sprintf(pcWriteBuffer, "\n");
+        return pdFALSE;
+    }
+
+    if (strcmp(pcParameter, "trigger") == 0)
+    {
+        radar_recorder_trigger(&recorder, RADAR_RECORDER_TRIGGER_COMMAND);
+        sprintf(pcWriteBuffer, (recorder.state == RADAR_RECORDER_STATE_FROZEN) ? "ok\n" : "Invalid value.\r\n\n");
+        return pdFALSE;
+    }
+
+    if (strcmp(pcParameter, "dump") == 0)
+    {
+        /* the UART is free in the settings mode, the records go out at its full rate */
+        frames = radar_recorder_dump(&recorder);
+        if (frames < 0)
+        {
+            snprintf(pcWriteBuffer, xWriteBufferLen, "%srecorder no frozen window\n", MSG_TYPE_ERROR);
+        }
+        else
+        {
+            printf("\n[INFO][RECORDER] dumped %" PRId32 " frames\n", frames);
+            sprintf(pcWriteBuffer, "ok\n");
+        }
+        return pdFALSE;
+    }
+
+    for (uint32_t i = 0; i < (sizeof(mode_names) / sizeof(mode_names[0])); ++i)
+    {
+        if (strcmp(pcParameter, mode_names[i]) == 0)
+        {
+            radar_recorder_arm(&recorder, mode_triggers[i]);
+            sprintf(pcWriteBuffer, "ok\n");
+            return pdFALSE;
+        }
+    }
+
+    sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: set_backend
+ ********************************************************************************
+ * Summary:
+ *   Lists the inference backends with their RAM in the active profile and the
+ *   cycles per frame measured while they were active, or selects the one
+ *   given as parameter
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t set_backend(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    const char *pcParameter;
+    BaseType_t lParameterStringLength;
+    const radar_profile_s *profile = radar_profile_get_active();
+    const radar_inference_backend_s *backend;
+    const radar_dsp_stats_s *stats;
+
+    configASSERT(pcWriteBuffer);
+
+    /* Obtain the parameter string. */
+    pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, /* The command string itself. */
+            1, /* Return the first parameter. */
+            &lParameterStringLength); /* Store the parameter string length. */
+
+    if (pcParameter == NULL)
+    {
+        for (uint32_t i = 0; i < radar_inference_backend_count(); ++i)
+        {
+            backend = radar_inference_backend_get(i);
+            stats = radar_inference_backend_get_stats(backend);
+            printf("%s %s %s%s%s\n", CONFIG_BACKEND,
+                    backend->name,
+                    backend->description,
+                    (backend == radar_inference_backend_get_active()) ? " (active)" : "",
+                    radar_inference_backend_ready(backend) ? "" : " (not supported by profile)");
+            printf("[INFO][BACKEND] %s ram %" PRIu32 " bytes inference frames %" PRIu32
+                   " cycles mean %" PRIu32 " max %" PRIu32 "\n",
+                    backend->name,
+                    (uint32_t)radar_inference_backend_ram(backend,
+                                                          profile->num_samples_per_chirp,
+                                                          profile->num_chirps_per_frame,
+                                                          profile->num_rx_antennas),
+                    stats->frames, radar_dsp_stats_mean(stats), stats->cycles_max);
+        }
+        sprintf(pcWriteBuffer, "\n");
+        return pdFALSE;
+    }
+
+    backend = radar_inference_backend_find(pcParameter);
+    if (backend == NULL)
+    {
+        sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+    }
+    else if (radar_apply_inference_backend(backend) != 0)
+    {
+        snprintf(pcWriteBuffer, xWriteBufferLen, "%sbackend %s\n", MSG_TYPE_ERROR, backend->name);
+    }
+    else
+    {
+        if (!radar_inference_backend_ready(backend))
+        {
+            printf("%s gestures detection paused in profile %s\n", MSG, profile->name);
+        }
+        sprintf(pcWriteBuffer, "ok\n");
+    }
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: print_decision
+ ********************************************************************************
+ * Summary:
+ *   Prints the frames gestures are decided on
+ *
+ * Parameters:
+ *   none
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void print_decision(void)
+{
+    const radar_decision_vote_s *vote = &decision.vote;
+
+    if (vote->mode == RADAR_DECISION_MODE_VOTE)
+    {
+        printf("%s vote %" PRIu32 " of %" PRIu32 " frames above %.2f\n",
+                CONFIG_DECISION, vote->votes, vote->window, vote->score);
+    }
+    else if (vote->mode == RADAR_DECISION_MODE_INTEGRAL)
+    {
+        printf("%s integral %.2f over %" PRIu32 " frames\n", CONFIG_DECISION, vote->integral, vote->window);
+    }
+    else
+    {
+        printf("%s frame\n", CONFIG_DECISION);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: parse_number
+ ********************************************************************************
+ * Summary:
+ *   Converts a parameter to a number, parameters are separated by spaces
+ *
+ * Parameters:
+ *   pcParameter: parameter, may be NULL
+ *   value: receives the number
+ *
+ * Return:
+ *   true if the parameter is a number
+ *******************************************************************************/
+static bool parse_number(const char *pcParameter, float *value)
+{
+    char *end;
+
+    if (pcParameter == NULL)
+    {
+        return false;
+    }
+
+    *value = strtof(pcParameter, &end);
+
+    return (end != pcParameter) && ((*end == ' ') || (*end == '\0'));
+}
+
+/*******************************************************************************
+ * Function Name: set_decision
+ ********************************************************************************
+ * Summary:
+ *   Prints the frames gestures are decided on, or decides on single frames,
+ *   on votes or on the score integral over the last frames
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t set_decision(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    static const char *mode_names[RADAR_DECISION_MODE_NUM] = { "frame", "vote", "integral" };
+    const char *pcParameter;
+    BaseType_t lParameterStringLength;
+    size_t mode_length;
+    radar_decision_vote_s vote = decision.vote;
+    uint32_t mode = RADAR_DECISION_MODE_NUM;
+    float first = 0.0f;
+    float window = 0.0f;
+    float score = 0.0f;
+    bool valid;
+
+    configASSERT(pcWriteBuffer);
+
+    pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, 1, &lParameterStringLength);
+
+    if (pcParameter == NULL)
+    {
+        print_decision();
+        sprintf(pcWriteBuffer, "\n");
+        return pdFALSE;
+    }
+
+    /* the parameter is followed by the numbers of the mode */
+    mode_length = (size_t)lParameterStringLength;
+    for (uint32_t i = 0; i < RADAR_DECISION_MODE_NUM; ++i)
+    {
+        if ((strlen(mode_names[i]) == mode_length) && (strncmp(pcParameter, mode_names[i], mode_length) == 0))
+        {
+            mode = i;
+        }
+    }
+
+    switch (mode)
+    {
+        case RADAR_DECISION_MODE_FRAME:
+            valid = true;
+            break;
+        case RADAR_DECISION_MODE_VOTE:
+            valid = parse_number(FreeRTOS_CLIGetParameter(pcCommandString, 2, &lParameterStringLength), &first) &&
+                    parse_number(FreeRTOS_CLIGetParameter(pcCommandString, 3, &lParameterStringLength), &window) &&
+                    parse_number(FreeRTOS_CLIGetParameter(pcCommandString, 4, &lParameterStringLength), &score) &&
+                    (first >= 1.0f) && (window >= 1.0f);
+            vote.votes = (uint32_t)first;
+            vote.window = (uint32_t)window;
+            vote.score = score;
+            break;
+        case RADAR_DECISION_MODE_INTEGRAL:
+            valid = parse_number(FreeRTOS_CLIGetParameter(pcCommandString, 2, &lParameterStringLength), &first) &&
+                    parse_number(FreeRTOS_CLIGetParameter(pcCommandString, 3, &lParameterStringLength), &window) &&
+                    (window >= 1.0f);
+            vote.integral = first;
+            vote.window = (uint32_t)window;
+            /* the votes are not used, they only have to fit the window */
+            vote.votes = (vote.votes > vote.window) ? vote.window : vote.votes;
+            break;
+        default:
+            valid = false;
+            break;
+    }
+    vote.mode = (radar_decision_mode_e)mode;
+
+    if (!valid || (radar_apply_decision_vote(&vote) != 0))
+    {
+        sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+        return pdFALSE;
+    }
+
+    sprintf(pcWriteBuffer, "ok\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: run_bench
+ ********************************************************************************
+ * Summary:
+ *   Runs the processing stages over the canned frames and prints minimum,
+ *   median and maximum cycles and the median cycles per sample of every
+ *   stage
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t run_bench(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    /* too large for the stack of the console task */
+    static radar_bench_s bench;
+    radar_bench_summary_s summary;
+    int32_t result;
+
+    configASSERT(pcWriteBuffer);
+
+    result = radar_run_bench(&bench);
+    if (result == -1)
+    {
+        snprintf(pcWriteBuffer, xWriteBufferLen, "%sbench needs a profile of %ux%ux%u samples\n",
+                 MSG_TYPE_ERROR, RADAR_BENCH_NUM_SAMPLES_PER_CHIRP, RADAR_BENCH_NUM_CHIRPS_PER_FRAME,
+                 RADAR_BENCH_NUM_RX_ANTENNAS);
+        return pdFALSE;
+    }
+    if (result != 0)
+    {
+        snprintf(pcWriteBuffer, xWriteBufferLen, "%sbench needs the radar stopped\n", MSG_TYPE_ERROR);
+        return pdFALSE;
+    }
+
+    printf("[INFO][BENCH] %u frames x %u passes, backend %s, %" PRIu32 " MHz\n",
+            RADAR_BENCH_FRAMES, RADAR_BENCH_PASSES, radar_inference_backend_get_active()->name,
+            radar_dsp_cycles_per_second() / 1000000U);
+    for (uint32_t i = 0; i < bench.num_stages; ++i)
+    {
+        radar_bench_summarize(&bench.stages[i], &summary);
+        printf("[INFO][BENCH] %s cycles min %" PRIu32 " median %" PRIu32 " max %" PRIu32 " per sample %.2f\n",
+                bench.stages[i].name, summary.min, summary.median, summary.max, summary.per_sample);
+    }
+    sprintf(pcWriteBuffer, "\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: show_boot
+ ********************************************************************************
+ * Summary:
+ *   Prints start and duration of the startup phases and the time from the
+ *   start of the timeline to the first frame and the first result
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t show_boot(char *pcWriteBuffer,
+        size_t xWriteBufferLen, const char *pcCommandString)
+{
+    const float cycles_per_ms = (float)radar_dsp_cycles_per_second() / 1000.0f;
+
+    configASSERT(pcWriteBuffer);
+
+    for (uint32_t i = 0; i < boot.num_phases; ++i)
+    {
+        const radar_boot_phase_s *phase = &boot.phases[i];
+
+        if (phase->end == 0U)
+        {
+            printf("[INFO][BOOT] %s at %.2f ms, running\n", phase->name, (float)phase->start / cycles_per_ms);
+        }
+        else
+        {
+            printf("[INFO][BOOT] %s at %.2f ms took %.2f ms\n", phase->name,
+                    (float)phase->start / cycles_per_ms, (float)(phase->end - phase->start) / cycles_per_ms);
+        }
+    }
+
+    if (boot.first_frame_done)
+    {
+        printf("[INFO][BOOT] first frame %.2f ms\n", (float)boot.first_frame / cycles_per_ms);
+    }
+    else
+    {
+        printf("[INFO][BOOT] first frame pending\n");
+    }
+
+    if (boot.first_result_done)
+    {
+        printf("[INFO][BOOT] first result %.2f ms\n", (float)boot.first_result / cycles_per_ms);
+    }
+    else
+    {
+        printf("[INFO][BOOT] first result pending\n");
+    }
+    sprintf(pcWriteBuffer, "\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: set_gestures_detect_list
+ ********************************************************************************
+ * Summary:
+ *   Setting mode for gesture detection algorithm
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t set_gestures_detect_list(char *pcWriteBuffer, size_t xWriteBufferLen,
+        const char *pcCommandString)
+{
+    const char *pcParameter;
+    char gesture_array[MAX_GESTURE_STRING_LENGTH] = {0};
+    BaseType_t lParameterStringLength;
+    uint8_t param_count;
+    xensiv_radar_gestures_class_e gesture_idx;
+    bool update_list[NUMBER_OF_GESTURE_CLASSES]  = {false, false, false, false, false, false, false, false};
+    uint8_t i=0;
+    bool first_print = true;
+
+    configASSERT(pcWriteBuffer);
+
+    for ( param_count=1; param_count<=xWriteBufferLen; param_count++ )
+    {
+        /* Obtain the parameter string. */
+        pcParameter = FreeRTOS_CLIGetParameter(pcCommandString, /* The command string itself. */
+                param_count,
+                &lParameterStringLength); /* Store the parameter string length. */
+
+        configASSERT(pcParameter);
+
+        memset(gesture_array, 0, MAX_GESTURE_STRING_LENGTH);
+        for ( i=0; i<lParameterStringLength; i++)
+        {
+            gesture_array[i] = *pcParameter;
+            pcParameter++;
+        }
+
+        if (check_supported_gesture_validation(&gesture_array[0]))
+        {
+            if( first_print )
+            {
+                printf(CONFIG_GESTURES_DETECT);
+                first_print = false;
+            }
+
+            gesture_idx = string_to_gesture(&gesture_array[0]);
+            switch ( gesture_idx )
+            {
+                case XENSIV_RADAR_GESTURE_PUSH:
+                    update_list[XENSIV_RADAR_GESTURE_PUSH] = 1;
+                    break;
+                case XENSIV_RADAR_GESTURE_SWIPE_LEFT:
+                    update_list[XENSIV_RADAR_GESTURE_SWIPE_LEFT] = 1;
+                    break;
+                case XENSIV_RADAR_GESTURE_SWIPE_RIGHT:
+                    update_list[XENSIV_RADAR_GESTURE_SWIPE_RIGHT] = 1;
+                    break;
+                case XENSIV_RADAR_GESTURE_SWIPE_UP:
+                    update_list[XENSIV_RADAR_GESTURE_SWIPE_UP] = 1;
+                    break;
+                case XENSIV_RADAR_GESTURE_SWIPE_DOWN:
+                    update_list[XENSIV_RADAR_GESTURE_SWIPE_DOWN] = 1;
+                    break;
+                case XENSIV_RADAR_GESTURE_ALL: default:
+                    update_list[XENSIV_RADAR_GESTURE_PUSH] = 1;
+                    update_list[XENSIV_RADAR_GESTURE_SWIPE_LEFT] = 1;
+                    update_list[XENSIV_RADAR_GESTURE_SWIPE_RIGHT] = 1;
+                    update_list[XENSIV_RADAR_GESTURE_SWIPE_UP] = 1;
+                    update_list[XENSIV_RADAR_GESTURE_SWIPE_DOWN] = 1;
+                    break;
+            }
+        }
+        else
+        {
+            sprintf(pcWriteBuffer, "Invalid value.\r\n\n");
+        }
+    }
+
+    /* update gesture detect list */
+    for ( i=0; i<NUMBER_OF_GESTURE_CLASSES; i++ )
+    {
+        if ( update_list[i] )
+        {
+            switch ( i )
+            {
+                case XENSIV_RADAR_GESTURE_PUSH:
+                    printf(GESTURE_PUSH_STRING);
+                    break;
+                case XENSIV_RADAR_GESTURE_SWIPE_LEFT:
+                    printf(GESTURE_SWIPE_LEFT_STRING);
+                    break;
+                case XENSIV_RADAR_GESTURE_SWIPE_RIGHT:
+                    printf(GESTURE_SWIPE_RIGHT_STRING);
+                    break;
+                case XENSIV_RADAR_GESTURE_SWIPE_UP:
+                    printf(GESTURE_SWIPE_UP_STRING);
+                    break;
+                case XENSIV_RADAR_GESTURE_SWIPE_DOWN:
+                    printf(GESTURE_SWIPE_DOWN_STRING);
+                    break;
+                default:
+                    break;
+            }
+            printf(" ");
+        }
+        sprintf(pcWriteBuffer, "\n");
+        gesture_detect_list[i] = update_list[i];
+    }
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: display_gestures_list
+ ********************************************************************************
+ * Summary:
+ *   Query for supported gestures information
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
+ *
+ * Return:
+ *   pdFALSE indicating that the function ends it's processing
+ *******************************************************************************/
+static BaseType_t display_gestures_list(char *pcWriteBuffer, size_t xWriteBufferLen,
+        const char *pcCommandString)
+{
+    printf(CONFIG);
+    printf("\n");
+    printf(CONFIG_GESTURES_LIST);
+    printf(GESTURE_PUSH_STRING);
+    printf(" ");
+    printf(GESTURE_SWIPE_LEFT_STRING);
+    printf(" ");
+    printf(GESTURE_SWIPE_RIGHT_STRING);
+    printf(" ");
+    printf(GESTURE_SWIPE_UP_STRING);
+    printf(" ");
+    printf(GESTURE_SWIPE_DOWN_STRING);
+    printf("\n");
+    printf(CONFIG);
+    sprintf(pcWriteBuffer, "\n");
+
+    return pdFALSE;
+}
+
+/*******************************************************************************
+ * Function Name: display_board_Info
+ ********************************************************************************
+ * Summary:
+ *   Query for board information
+ *
+ * Parameters:
+ *   pcWriteBuffer: buffer into which the output from executing the command can be written
+ *   xWriteBufferLen:length, in bytes of the pcWriteBuffer buffer
+ *   pcCommandString: entire string as input by
+ the user (from which parameters can be extracted)
  *
  * Return:
  *   pdFALSE indicating that the function ends it's processing
@@ -573,6 +1786,12 @@ static BaseType_t display_solution_config(char *pcWriteBuffer, size_t xWriteBuff
         printf(GESTURE_SWIPE_DOWN_STRING);
     }
     printf("\n");
+    printf("%s %s\n", CONFIG_PROFILE, radar_profile_get_active()->name);
+    printf("%s %s\n", CONFIG_BACKEND, radar_inference_backend_get_active()->name);
+    print_decision();
+    print_range_gate();
+    printf("%s sequence %" PRIu32 " slot %" PRIu32 " saves %" PRIu32 " failed %" PRIu32 "\n", CONFIG_STORE,
+            config_store.sequence, config_store.slot, config_store.saves, config_store.failures);
     printf(CONFIG);
     sprintf(pcWriteBuffer, "\n");
 
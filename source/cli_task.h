@@ -51,6 +51,16 @@ __NO_RETURN void console_task(void *pvParameters);
 #define CONFIG                         ("[CONFIG]")
 #define CONFIG_GESTURES_LIST           ("[CONFIG] gestures_list ")
 #define CONFIG_GESTURES_DETECT         ("[CONFIG] gestures_detect ")
+#define CONFIG_PROFILE                 ("[CONFIG] profile")
+#define CONFIG_RANGE_GATE              ("[CONFIG] gate")
+#define CONFIG_CLUTTER                 ("[CONFIG] clutter")
+#define CONFIG_RUN_STATE               ("[CONFIG] state")
+#define CONFIG_STREAM                  ("[CONFIG] stream")
+#define CONFIG_TELEMETRY               ("[CONFIG] telemetry")
+#define CONFIG_RECORDER                ("[CONFIG] recorder")
+#define CONFIG_BACKEND                 ("[CONFIG] backend")
+#define CONFIG_DECISION                ("[CONFIG] decision")
+#define CONFIG_STORE                   ("[CONFIG] store")
 
 
 #define MSG                            ("[MSG]")
@@ -24,6 +24,7 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "cy_pdl.h"
 #include "cyhal.h"
@@ -34,16 +35,36 @@
 #include "task.h"
 #include "queue.h"
 #include "timers.h"
+#include "semphr.h"
 
 #include "cli_task.h"
 #include "resource_map.h"
 #include "xensiv_bgt60trxx_mtb.h"
+#include "xensiv_bgt60trxx_platform.h"
 #include "xensiv_radar_gestures.h"
 
 #include "xensiv_radar_data_management.h"
 
-#define XENSIV_BGT60TRXX_CONF_IMPL
-#include "radar_settings.h"
+#include "radar_profiles.h"
+#include "radar_frame_arena.h"
+#include "radar_range_fft.h"
+#include "radar_range_doppler.h"
+#include "radar_clutter_map.h"
+#include "radar_aoa.h"
+#include "radar_decision.h"
+#include "radar_inference.h"
+#include "radar_bench.h"
+#include "radar_pipeline.h"
+#include "radar_shm_ring.h"
+#include "radar_acq_ipc.h"
+#include "radar_run_state.h"
+#include "radar_boot.h"
+#include "radar_config_store.h"
+#include "radar_sample12.h"
+#include "radar_stream.h"
+#include "radar_telemetry.h"
+#include "radar_uart_tx.h"
+#include "radar_recorder.h"
 
 
 /*******************************************************************************
@@ -52,40 +73,106 @@
 
 #define XENSIV_BGT60TRXX_SPI_FREQUENCY      (25000000UL)
 
-#define NUM_SAMPLES_PER_FRAME               (XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP *\
-                                             XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME *\
-                                             XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS)
-
-#define NUM_CHIRPS_PER_FRAME                XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME
-#define NUM_SAMPLES_PER_CHIRP               XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP
-
 /* RTOS tasks */
 #define MAIN_TASK_NAME                      "main_task"
 #define MAIN_TASK_STACK_SIZE                (configMINIMAL_STACK_SIZE * 10)
 #define MAIN_TASK_PRIORITY                  (configMAX_PRIORITIES - 1)
-#define PROCESSING_TASK_NAME                "processing_task"
-#define PROCESSING_TASK_STACK_SIZE          (configMINIMAL_STACK_SIZE * 10)
-#define PROCESSING_TASK_PRIORITY            (configMAX_PRIORITIES - 2)
+
+/* Pipeline stages, later stages run at lower priority so the earlier ones
+ * can take the next frame while a frame is still being output */
+#define PREPROCESS_STAGE_STACK_SIZE         (configMINIMAL_STACK_SIZE * 4)
+#define PREPROCESS_STAGE_PRIORITY           (configMAX_PRIORITIES - 2)
+#define FEATURES_STAGE_STACK_SIZE           (configMINIMAL_STACK_SIZE * 4)
+#define FEATURES_STAGE_PRIORITY             (configMAX_PRIORITIES - 3)
+#define INFERENCE_STAGE_STACK_SIZE          (configMINIMAL_STACK_SIZE * 10)
+#define INFERENCE_STAGE_PRIORITY            (configMAX_PRIORITIES - 4)
+#define DECISION_STAGE_STACK_SIZE           (configMINIMAL_STACK_SIZE * 4)
+#define DECISION_STAGE_PRIORITY             (configMAX_PRIORITIES - 5)
+#define OUTPUT_STAGE_STACK_SIZE             (configMINIMAL_STACK_SIZE * 8)
+#define OUTPUT_STAGE_PRIORITY               (configMAX_PRIORITIES - 6)
+
+/* time budget of the inference backend per frame */
+#define INFERENCE_STAGE_BUDGET_MS           (20U)
+
+/* Raw frame stream, encodes only while no stage has work */
+#define STREAM_TASK_STACK_SIZE              (configMINIMAL_STACK_SIZE * 4)
+#define STREAM_TASK_PRIORITY                (tskIDLE_PRIORITY)
+#define STREAM_CPU_BUDGET_PCT               (10U)
+
+/* gestures scored above this but not detected trigger the flight recorder */
+#define RECORDER_LOW_CONFIDENCE_SCORE       (0.4f)
+
+/* period of the metrics messages of the binary telemetry */
+#define TELEMETRY_METRICS_PERIOD_MS         (1000U)
+
 #define CLI_TASK_NAME                       "cli_task"
 #define CLI_TASK_STACK_SIZE                 (configMINIMAL_STACK_SIZE * 20)
 #define CLI_TASK_PRIORITY                   (tskIDLE_PRIORITY)
 
 /* Interrupt priorities */
 #define GPIO_INTERRUPT_PRIORITY             (6)
+#define UART_TX_INTERRUPT_PRIORITY          (7)
+
+/* Console output of tasks up to this priority waits for space in the UART
+ * transmit ring, higher priority tasks drop what does not fit */
+#define CONSOLE_TX_WAIT_PRIORITY            (tskIDLE_PRIORITY)
+#define CONSOLE_TX_WAIT_MS                  (1000U)
+
+/* time the CM0+ has to configure, start or stop the sensor */
+#define ACQ_REQUEST_TIMEOUT_MS              (500U)
+
+/* time the LDO of the sensor takes to settle after it is enabled */
+#define LDO_SETTLE_US                       (5000U)
+
+/* flash rows of the configuration store in the emulated EEPROM region,
+ * every save programs the next row */
+#define CONFIG_STORE_SLOTS                  (8U)
 
-#define GESTURE_HOLD_TIME                   (10) /* count value used to hold gesture before evaluating new one */
+/* layout of the configuration record, to be incremented with every change of config_record_s */
+#define CONFIG_RECORD_VERSION               (1U)
+#define CONFIG_NAME_MAX                     (16U)
+
+#define GESTURE_HOLD_TIME                   (RADAR_DECISION_HOLD_FRAMES) /* count value used to hold gesture before evaluating new one */
 
 
 /*******************************************************************************
 * Function Prototypes
 ********************************************************************************/
 static void main_task(void *pvParameters);
-static void processing_task(void *pvParameters);
 static void timer_callback(TimerHandle_t xTimer);
 
 static int32_t init_leds(void);
 static int32_t radar_init(void);
+static int32_t provision_frame_buffers(const radar_profile_s *profile);
+static int32_t add_pipeline_stages(void);
+static void stream_write(const uint8_t *data, uint32_t len);
+static void telemetry_write(const uint8_t *data, uint32_t len);
+static int32_t init_uart_tx(void);
+static int32_t uart_tx_start(void *ctx, const uint8_t *data, uint32_t len);
+static void uart_tx_event_handler(void *callback_arg, cyhal_uart_event_t event);
+static TickType_t console_tx_wait(void);
+static void send_telemetry(const radar_pipeline_frame_s *frame);
+static void output_gesture(const radar_inference_result_s *results, bool verbose);
+static void compute_features(float32_t *data);
+static int32_t start_frames(bool start);
+static void flush_frames(void);
+static void bench_stage(uint32_t stage, const uint8_t *canned, uint8_t **raw, float32_t *frame,
+                        radar_decision_s *bench_decision, radar_inference_result_s *result);
+static void load_config(void);
+static int32_t config_flash_read(void *ctx, uint32_t offset, void *data, uint32_t len);
+static int32_t config_flash_write(void *ctx, uint32_t slot, const void *data, uint32_t len);
+#ifdef RADAR_ACQ_CM0P
+static int32_t request_acquisition(radar_acq_ipc_cmd_e cmd, const radar_profile_s *profile);
+#else
+static int32_t radar_power_on(void);
+static void wait_ldo_settled(void);
+static int32_t configure_radar(const radar_profile_s *profile);
+static int32_t read_fifo_packed(uint8_t *data, uint32_t num_samples);
+static uint32_t fifo_read_cycles(const uint8_t *record);
+static int32_t bench_read_radar_data(uint16_t* data, uint32_t *num_samples, uint32_t samples_ub);
+static int32_t power_up_radar(void);
 static void xensiv_bgt60trxx_interrupt_handler(void* args, cyhal_gpio_event_t event);
+#endif
 
 /*******************************************************************************
  * Local Declarations
@@ -100,22 +187,125 @@ typedef struct {
     uint32_t bookmark_timestamp;
 }ce_state_s;
 
+/*
+ * @typedef typedef struct  frame_context_s
+ * Per frame slot data handed from the inference to the decision and output stages
+ */
+typedef struct {
+    radar_inference_result_s results;
+    bool run_gestures;
+    radar_decision_e decision;      /*<< of app_logic(), output by the output stage */
+}frame_context_s;
+
+/*
+ * @typedef typedef struct  config_record_s
+ * Settings of the console kept in the configuration store
+ */
+typedef struct {
+    char profile[CONFIG_NAME_MAX];
+    char backend[CONFIG_NAME_MAX];
+    uint8_t detect_list[NUMBER_OF_GESTURE_CLASSES];
+    uint8_t verbose;
+    uint8_t reserved[3];
+    uint32_t gate_min_cm;
+    uint32_t gate_max_cm;
+    radar_decision_vote_s vote;
+}config_record_s;
+
 /*******************************************************************************
 * Global Variables
 ********************************************************************************/
+#ifndef RADAR_ACQ_CM0P
 static cyhal_spi_t spi_obj;
 static xensiv_bgt60trxx_mtb_t bgt60_obj;
 
+/* cycle counter when the LDO of the sensor was enabled at boot */
+static uint32_t ldo_enabled_at;
+#endif
+
 static TaskHandle_t main_task_handler;
-static TaskHandle_t processing_task_handler;
 static TimerHandle_t timer_handler;
+static SemaphoreHandle_t frame_buffers_mutex;
+static int32_t rdm_subscription_id;
 radar_data_manager_s mgr;
 
-float32_t gesture_frame[NUM_SAMPLES_PER_CHIRP * NUM_CHIRPS_PER_FRAME * XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS];
+#ifdef RADAR_ACQ_CM0P
+/* raw frames published by the CM0+, the slots are provisioned from the frame arena */
+CY_SECTION_SHAREDMEM radar_shm_ring_s acq_ring;
+CY_SECTION_SHAREDMEM static radar_acq_ipc_request_s acq_request;
+CY_SECTION_SHAREDMEM static uint32_t acq_regs[XENSIV_BGT60TRXX_CONF_NUM_REGS];
+#endif
+
+/* frame processing pipeline, frame slots are provisioned from the frame arena */
+radar_pipeline_s pipeline;
+static frame_context_s frame_contexts[RADAR_PIPELINE_NUM_SLOTS];
+
+/* lossless stream of raw frames on the debug UART */
+radar_stream_s stream;
+
+/* flight recorder of the raw frames around a trigger, dumped like the stream */
+radar_recorder_s recorder = {
+    .triggers = RADAR_RECORDER_TRIGGER_ALL,
+    .sink = stream_write
+};
+
+/* binary telemetry of the results, replaces the text output when selected */
+radar_telemetry_s telemetry;
+
+/* transmit ring of the debug UART, drained by asynchronous transfers */
+radar_uart_tx_s uart_tx;
+
+/* range FFT preprocessing stage shared by all detectors */
+radar_range_fft_s range_fft;
+
+/* streaming range-Doppler stage, maps are delivered to its subscribers */
+radar_range_doppler_s range_doppler;
+
+/* direction of the strongest target, one trajectory point per frame */
+radar_aoa_s aoa;
+
+/* static background removed from the frame before inference, learned at startup */
+radar_clutter_map_s clutter_map = { .requested_mode = RADAR_CLUTTER_MAP_MODE_LEARN };
+
+/* range gate in centimeters, converted to range bins for the active profile */
+uint32_t range_gate_min_cm = RADAR_PROFILE_RANGE_GATE_MIN_CM_DEFAULT;
+uint32_t range_gate_max_cm = RADAR_PROFILE_RANGE_GATE_MAX_CM_DEFAULT;
 
 ce_state_s ce_app_state;
 extern bool gesture_detect_list[NUMBER_OF_GESTURE_CLASSES];
-volatile bool is_settings_mode = false;
+
+/* detect list, threshold, vote and hold of the reported gestures */
+radar_decision_s decision = {
+    .detect_list = gesture_detect_list,
+    .hold_frames = GESTURE_HOLD_TIME,
+    .vote = RADAR_DECISION_VOTE_DEFAULT
+};
+
+/* timeline of the startup phases, reported by the boot command */
+radar_boot_s boot;
+
+/* rows of the configuration store, erased flash reads as zero, no record */
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t config_flash[CONFIG_STORE_SLOTS * CY_FLASH_SIZEOF_ROW] = { 0U };
+
+static const radar_config_store_backend_s config_flash_backend = {
+    .ctx = NULL,
+    .num_slots = CONFIG_STORE_SLOTS,
+    .slot_size = CY_FLASH_SIZEOF_ROW,
+    .read = config_flash_read,
+    .write = config_flash_write
+};
+
+/* console settings survive a reset, saved when the settings mode is left */
+radar_config_store_s config_store;
+static config_record_s saved_config;
+
+/* frames are only acquired and processed in the active state */
+radar_run_state_s run_state = {
+    .state = RADAR_RUN_STATE_ACTIVE,
+    .resume_state = RADAR_RUN_STATE_ACTIVE,
+    .sensor_powered = true
+};
 
 /*******************************************************************************
 * Function Name: read_radar_data
@@ -123,6 +313,8 @@ volatile bool is_settings_mode = false;
 * Summary:
 * Function that reads the data from radar hardware buffer.
 * This function is supplied to software buffer manager.
+* The frame is stored in the packed 12-bit format of the FIFO, followed by
+* the cycles of the FIFO read, see RADAR_FRAME_ARENA_RDM_RECORD_SIZE.
 *
 * Parameters:
 *  * data: pointer to radar data
@@ -133,81 +325,117 @@ volatile bool is_settings_mode = false;
 *  int32_t: 0 if success
 *
 *******************************************************************************/
+#ifndef RADAR_ACQ_CM0P
 int32_t read_radar_data(uint16_t* data, uint32_t *num_samples, uint32_t samples_ub)
 {
-    if (xensiv_bgt60trxx_get_fifo_data(&bgt60_obj.dev,
-            data,
-            NUM_SAMPLES_PER_FRAME) == XENSIV_BGT60TRXX_STATUS_OK)
+    const uint32_t samples_per_frame = radar_profile_get_active()->num_samples_per_frame;
+    const uint32_t frame_bytes = RADAR_SAMPLE12_BYTES(samples_per_frame);
+    const uint32_t record_bytes = RADAR_FRAME_ARENA_RDM_RECORD_SIZE(samples_per_frame);
+    const uint32_t start = radar_dsp_cycles();
+    uint32_t cycles;
+
+    /* no room left in the RDM buffer, the frame is discarded in the FIFO */
+    if (samples_ub < record_bytes)
     {
-        *num_samples = NUM_SAMPLES_PER_FRAME *2; /* in bytes */
+        xensiv_bgt60trxx_soft_reset(&bgt60_obj.dev,XENSIV_BGT60TRXX_RESET_FIFO );
+        return -2;
+    }
 
-        if (samples_ub < NUM_SAMPLES_PER_FRAME *2)
-        {
-            xensiv_bgt60trxx_soft_reset(&bgt60_obj.dev,XENSIV_BGT60TRXX_RESET_FIFO );
-        }
+    /* the RDM keeps the frame in the packed 12-bit format of the FIFO */
+    if (read_fifo_packed((uint8_t*)data, samples_per_frame) != 0)
+    {
+        return -2;
     }
 
+    /* the cycles travel with the frame, whatever is discarded before it */
+    cycles = radar_dsp_cycles() - start;
+    memcpy((uint8_t*)data + frame_bytes, &cycles, sizeof(cycles));
+
+    *num_samples = record_bytes; /* in bytes */
+
     return 0;
 }
+#endif
 
 /*******************************************************************************
 * Function Name: app_logic
 ********************************************************************************
 * Summary:
-* This function interprets the gesture results and prints the detected class of gesture.
+* This function interprets the gesture results and shows the detection on
+* the LEDs. The detection is printed by the output stage.
 *
 * Parameters:
-*  void
+*  results: inference results of the frame
 *
 * Return:
-*  none
+*  radar_decision_e: RADAR_DECISION_EVENT if a gesture is detected
 *
 *******************************************************************************/
-void app_logic(inference_results_t * results)
+radar_decision_e app_logic(const radar_inference_result_s *results)
 {
-    if (is_settings_mode)
+    radar_decision_e result;
+
+    if (run_state.state != RADAR_RUN_STATE_ACTIVE)
     {
-        return;
+        return RADAR_DECISION_NONE;
     }
 
-    const char classes[][20]  = {"BACKGROUND","PUSH","SWIPE_LEFT","SWIPE_RIGHT","UNKNOWN_1","UNKNOWN_2","SWIPE_UP","SWIPE_DOWN"};
-    static int gesture_hold = 0;
-
-    if ( gesture_detect_list[results->idx] == true ) /* check if gesture is on the detect_list */
+    result = radar_decision_run(&decision, results->idx, results->score, gesture_detection_threshold);
+    switch (result)
     {
-        if (gesture_hold > 0)
-        {
-            gesture_hold += 1;
-        }
-
-        if ((results->score > gesture_detection_threshold) && (gesture_hold == 0))
-        {
+        case RADAR_DECISION_EVENT:
             cyhal_gpio_write(LED_RGB_RED, true); /* turn on red LED */
             cyhal_gpio_write(LED_RGB_GREEN, false); /* turn off green LED */
 
-            if (!ce_app_state.verbose) /* print gesture detection in non-verbose mode */
-            {
-                printf("[INFO]\"class\": \"%s\", \"score\": %f\r\n", classes[results->idx], results->score);
-            }
-            else  /* print gesture detection in verbose mode */
-            {
-                ce_app_state.bookmark_timestamp = xTaskGetTickCount() * portTICK_PERIOD_MS;
-                printf("[INFO][GESTURE] %s %f %" PRIu32 "\n",  classes[results->idx], results->score, ce_app_state.bookmark_timestamp);
-            }
-            gesture_hold += 1;
-        }
+            /* keep the frames of the detection */
+            radar_recorder_trigger(&recorder, RADAR_RECORDER_TRIGGER_DETECTION);
+            break;
 
-        if (gesture_hold > GESTURE_HOLD_TIME)
-        {
-            gesture_hold = 0;
+        case RADAR_DECISION_RELEASE: /* hold expired or gesture not on the detect_list */
             cyhal_gpio_write(LED_RGB_RED, false); /* turn off red LED */
             cyhal_gpio_write(LED_RGB_GREEN, true); /* turn on green LED */
-        }
+            break;
+
+        default:
+            break;
     }
-    else
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: output_gesture
+********************************************************************************
+* Summary:
+* This function prints the detected class of gesture or sends it as a
+* telemetry event.
+*
+* Parameters:
+*  results: inference results of the frame
+*  verbose: print the detection in verbose format
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void output_gesture(const radar_inference_result_s *results, bool verbose)
+{
+    const char classes[][20]  = {"BACKGROUND","PUSH","SWIPE_LEFT","SWIPE_RIGHT","UNKNOWN_1","UNKNOWN_2","SWIPE_UP","SWIPE_DOWN"};
+
+    if (radar_telemetry_binary(&telemetry)) /* send gesture event */
+    {
+        ce_app_state.bookmark_timestamp = xTaskGetTickCount() * portTICK_PERIOD_MS;
+        (void)radar_telemetry_send_gesture(&telemetry, (uint8_t)results->idx, results->score,
+                                           ce_app_state.bookmark_timestamp);
+    }
+    else if (!verbose) /* print gesture detection in non-verbose mode */
+    {
+        printf("[INFO]\"class\": \"%s\", \"score\": %f\r\n", classes[results->idx], results->score);
+    }
+    else  /* print gesture detection in verbose mode */
     {
-        cyhal_gpio_write(LED_RGB_RED, false); /* turn off red LED */
-        cyhal_gpio_write(LED_RGB_GREEN, true); /* turn on green LED */
+        ce_app_state.bookmark_timestamp = xTaskGetTickCount() * portTICK_PERIOD_MS;
+        printf("[INFO][GESTURE] %s %f %" PRIu32 "\n",  classes[results->idx], results->score, ce_app_state.bookmark_timestamp);
     }
 }
 
@@ -219,23 +447,26 @@ void app_logic(inference_results_t * results)
 * This function de-interleaves multiple antennas data from single radar HW FIFO
 *
 * Parameters:
-*  void
+*  buffer_ptr: raw frame from the radar data manager
+*  frame: de-interleaved frame [antenna][chirp][sample]
 *
 * Return:
 *  none
 *
 *******************************************************************************/
-void deinterleave_antennas(uint16_t * buffer_ptr)
+void deinterleave_antennas(uint16_t * buffer_ptr, float32_t *frame)
 {
+    const radar_profile_s *profile = radar_profile_get_active();
+    const uint32_t samples_per_antenna = profile->num_samples_per_chirp * profile->num_chirps_per_frame;
     uint8_t antenna = 0;
     int32_t index = 0;
     static const float norm_factor = 1.0f;
 
-    for (int i = 0; i < (NUM_SAMPLES_PER_CHIRP * NUM_CHIRPS_PER_FRAME * XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS); ++i)
+    for (int i = 0; i < profile->num_samples_per_frame; ++i)
     {
-        gesture_frame[index + antenna * NUM_SAMPLES_PER_CHIRP * NUM_CHIRPS_PER_FRAME] = buffer_ptr[i] * norm_factor;
+        frame[index + antenna * samples_per_antenna] = buffer_ptr[i] * norm_factor;
         antenna++;
-        if (antenna == XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS)
+        if (antenna == profile->num_rx_antennas)
         {
             antenna = 0;
             index++;
@@ -261,6 +492,7 @@ void deinterleave_antennas(uint16_t * buffer_ptr)
 int main(void)
 {
     cy_rslt_t result;
+    int32_t phase;
 
     /* Initialize the device and board peripherals */
     result = cybsp_init() ;
@@ -272,9 +504,37 @@ int main(void)
     /* Enable global interrupts */
     __enable_irq();
 
+    /* Cycle counter used to profile the preprocessing stages */
+    radar_dsp_cycles_init();
+
+    /* the boot timeline starts with the cycle counter */
+    radar_boot_init(&boot);
+
+    phase = radar_boot_begin(&boot, "retarget-io");
+
     /* Initialize retarget-io to use the debug UART port */
     cy_retarget_io_init(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX, CY_RETARGET_IO_BAUDRATE);
 
+    if (init_uart_tx() != 0)
+    {
+        CY_ASSERT(0);
+    }
+
+    radar_boot_end(&boot, phase);
+
+#ifndef RADAR_ACQ_CM0P
+    /* the LDO of the sensor settles while the buffers and tasks are set up,
+     * radar_init waits only for the rest of the settling time */
+    phase = radar_boot_begin(&boot, "radar power on");
+    if (radar_power_on() != 0)
+    {
+        CY_ASSERT(0);
+    }
+    radar_boot_end(&boot, phase);
+#endif
+
+    phase = radar_boot_begin(&boot, "leds");
+
 #ifdef TARGET_APP_CYSBSYSKIT_DEV_01
 
     /* Initialize the User LED */
@@ -282,10 +542,50 @@ int main(void)
 
 #endif
 
+    if (init_leds () != 0)
+    {
+        CY_ASSERT(0);
+    }
+
+    radar_boot_end(&boot, phase);
+
+    frame_buffers_mutex = xSemaphoreCreateMutex();
+    if (frame_buffers_mutex == NULL)
+    {
+        CY_ASSERT(0);
+    }
+
+    radar_inference_backend_set_active(radar_inference_backend_find(RADAR_INFERENCE_BACKEND_DEFAULT));
+
+    /* the saved settings replace the defaults before the buffers are provisioned */
+    phase = radar_boot_begin(&boot, "config load");
+    load_config();
+    radar_boot_end(&boot, phase);
+
+    /* radar data manager, pipeline slots, stage buffers and backends,
+     * the gestures library included */
+    phase = radar_boot_begin(&boot, "frame buffers");
+
+    if (radar_pipeline_init(&pipeline) != 0)
+    {
+        CY_ASSERT(0);
+    }
+
+    for (uint32_t i = 0; i < RADAR_PIPELINE_NUM_SLOTS; ++i)
+    {
+        pipeline.slots[i].user = &frame_contexts[i];
+    }
+
+#ifndef RADAR_ACQ_CM0P
     mgr.in_read_radar_data = read_radar_data;
-    radar_data_manager_init(&mgr, NUM_SAMPLES_PER_FRAME *6, NUM_SAMPLES_PER_FRAME *2);
-    radar_data_manager_set_malloc_free(pvPortMalloc,
-            vPortFree);
+#endif
+
+    if (provision_frame_buffers(radar_profile_get_active()) != 0)
+    {
+        CY_ASSERT(0);
+    }
+
+    radar_boot_end(&boot, phase);
 
     /* \x1b[2J\x1b[;H - ANSI ESC sequence for clear screen */
     printf("\x1b[2J\x1b[;H");
@@ -313,16 +613,19 @@ int main(void)
 * Summary:
 * This is the main task.
 *    1. Creates a timer to toggle user LED
-*    2. Create the processing RTOS task
-*    3. Initializes the hardware interface to the sensor and LEDs
-*    4. Initializes the radar device
-*    5. Initializes gesture library
-*    6. In an infinite loop
+*    2. Creates the console task and starts the processing pipeline
+*    3. Waits for the LDO of the sensor to settle
+*    4. Initializes the radar device and starts the frames
+*    5. In an infinite loop, acquires the frames for the pipeline
 *       - Waits for interrupt from radar device indicating availability of data
+*       - Takes a free frame slot of the pipeline
+*       - Discards older buffered frames if the pipeline coalesces frames
 *       - Read from software buffer the raw radar frame
-*       - De-interleaves the radar data frame
+*       - Unpacks and de-interleaves the radar data frame into the slot
+*       - Adds the acquisition cycles to the statistics of the profile
+*       - Offers the raw frame to the stream and the flight recorder
 *       - Acknowledges the radar data manager the consumption of read data
-*       - Sends notification to processing task 
+*       - Submits the slot to the first pipeline stage
 * Parameters:
 *  void
 *
@@ -336,6 +639,14 @@ static __NO_RETURN void main_task(void *pvParameters)
     uint32_t sz;
 
     uint16_t *data_buff = NULL;
+    radar_pipeline_frame_s *frame;
+    uint32_t waiting;
+    uint32_t cycles;
+    uint8_t *stream_frame;
+    uint8_t *recorder_frame;
+    int32_t phase;
+
+    phase = radar_boot_begin(&boot, "tasks");
 
     timer_handler = xTimerCreate("timer", pdMS_TO_TICKS(1000), pdTRUE, NULL, timer_callback);
     if (timer_handler == NULL)
@@ -348,164 +659,735 @@ static __NO_RETURN void main_task(void *pvParameters)
         CY_ASSERT(0);
     }
 
-    if (xTaskCreate(processing_task, PROCESSING_TASK_NAME, PROCESSING_TASK_STACK_SIZE, NULL, PROCESSING_TASK_PRIORITY, &processing_task_handler) != pdPASS)
+    if (xTaskCreate(console_task, CLI_TASK_NAME, CLI_TASK_STACK_SIZE, NULL, CLI_TASK_PRIORITY, NULL) != pdPASS)
     {
         CY_ASSERT(0);
     }
 
-    if (radar_init() != 0)
+    if (radar_telemetry_init(&telemetry, telemetry_write) != 0)
     {
         CY_ASSERT(0);
     }
 
-    if (init_leds () != 0)
+    if ((add_pipeline_stages() != 0) || (radar_pipeline_start(&pipeline) != 0))
+    {
+        CY_ASSERT(0);
+    }
+
+    if (radar_stream_init(&stream, stream_write, STREAM_TASK_PRIORITY, STREAM_TASK_STACK_SIZE) != 0)
     {
         CY_ASSERT(0);
     }
+    radar_stream_set_budget(&stream, (uint32_t)(((float)radar_dsp_cycles_per_second() *
+                                                 (float)XENSIV_BGT60TRXX_CONF_FRAME_REPETITION_TIME_S *
+                                                 (float)STREAM_CPU_BUDGET_PCT) / 100.0f));
 
-    mgr.subscribe(main_task_handler);
+    radar_boot_end(&boot, phase);
+
+#ifndef RADAR_ACQ_CM0P
+    phase = radar_boot_begin(&boot, "ldo settle");
+    wait_ldo_settled();
+    radar_boot_end(&boot, phase);
+#endif
+
+    phase = radar_boot_begin(&boot, "radar init");
+    if (radar_init() != 0)
+    {
+        CY_ASSERT(0);
+    }
+    radar_boot_end(&boot, phase);
+
+    phase = radar_boot_begin(&boot, "start frames");
+
+#ifndef RADAR_ACQ_CM0P
+    rdm_subscription_id = mgr.subscribe(main_task_handler);
+#endif
 
     /* Initialize the initial state of ce_app_state */
     ce_app_state.gesture_result.idx = 0;
     ce_app_state.gesture_result.score = 0;
     ce_app_state.bookmark_timestamp = 0;
-    ce_app_state.verbose = false;
 
-    if (xensiv_bgt60trxx_start_frame(&bgt60_obj.dev, true) != XENSIV_BGT60TRXX_STATUS_OK)
+    /* the time to the first inference after boot is reported like a resume */
+    run_state.resumed_at = radar_dsp_cycles();
+    run_state.first_inference_pending = true;
+
+    if (start_frames(true) != 0)
     {
         CY_ASSERT(0);
     }
 
-    gestures_init();
+    radar_boot_end(&boot, phase);
 
     for(;;)
     {
-        /* Wait for the GPIO interrupt to indicate that another slice is available */
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+#ifdef RADAR_ACQ_CM0P
+        /* notifications of the CM0+ coalesce, the ring holds the frame count */
+        waiting = radar_shm_ring_count(&acq_ring);
+#else
+        /* notifications of the radar interrupt coalesce, the radar data manager
+         * holds the frame count and consumes a frame with its acknowledge */
+        waiting = mgr.get_buffered();
+#endif
+        if (waiting == 0U)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        /* the radar data manager keeps buffering while all slots are in use */
+        frame = radar_pipeline_acquire(&pipeline, portMAX_DELAY);
+
+        xSemaphoreTake(frame_buffers_mutex, portMAX_DELAY);
+
+        /* under heavy overload only the newest buffered frame is processed,
+         * frames buffered while waiting for the slot are discarded as well */
+        if (radar_pipeline_coalescing(&pipeline))
+        {
+            uint32_t discarded = 0;
+#ifdef RADAR_ACQ_CM0P
+            for (waiting = radar_shm_ring_count(&acq_ring); waiting > 1U; --waiting)
+            {
+                radar_shm_ring_release(&acq_ring);
+                discarded++;
+            }
+#else
+            discarded = mgr.discard(1U);
+#endif
+            radar_pipeline_add_coalesced(&pipeline, discarded);
+        }
+
+        /* a notification may be left over from before a profile change,
+         * frames read after the radar was stopped are flushed */
+#ifdef RADAR_ACQ_CM0P
+        data_buff = (uint16_t*)radar_shm_ring_peek(&acq_ring, &sz, NULL);
+        if ((data_buff != NULL) && (run_state.state != RADAR_RUN_STATE_ACTIVE))
+        {
+            radar_shm_ring_release(&acq_ring);
+            data_buff = NULL;
+        }
+        if (data_buff == NULL)
+#else
+        if (run_state.state != RADAR_RUN_STATE_ACTIVE)
+        {
+            flush_frames();
+        }
+        if (mgr.read_from_buffer(rdm_subscription_id, &data_buff, &sz) != 0)
+#endif
+        {
+            xSemaphoreGive(frame_buffers_mutex);
+            radar_pipeline_release(&pipeline, frame);
+            continue;
+        }
+
+        radar_boot_first_frame(&boot);
+
+        cycles = radar_dsp_cycles();
+#ifdef RADAR_ACQ_CM0P
+        deinterleave_antennas(data_buff, frame->data);
+#else
+        radar_sample12_deinterleave((const uint8_t*)data_buff, frame->data,
+                                    radar_profile_get_active()->num_samples_per_frame,
+                                    radar_profile_get_active()->num_rx_antennas);
+#endif
+        cycles = radar_dsp_cycles() - cycles;
 
-        mgr.read_from_buffer(1, &data_buff, &sz);
+        /* the stream takes a copy while the encoder is idle and within budget */
+        stream_frame = radar_stream_claim(&stream);
+        if (stream_frame != NULL)
+        {
+#ifdef RADAR_ACQ_CM0P
+            radar_sample12_pack(data_buff, stream_frame, radar_profile_get_active()->num_samples_per_frame);
+#else
+            memcpy(stream_frame, data_buff, RADAR_SAMPLE12_BYTES(radar_profile_get_active()->num_samples_per_frame));
+#endif
+            radar_stream_commit(&stream, radar_profile_get_active());
+        }
 
-        deinterleave_antennas(data_buff);
+        /* the recorder takes every frame until its window is frozen */
+        recorder_frame = radar_recorder_claim(&recorder);
+        if (recorder_frame != NULL)
+        {
+            const uint32_t start = radar_dsp_cycles();
+#ifdef RADAR_ACQ_CM0P
+            radar_sample12_pack(data_buff, recorder_frame, radar_profile_get_active()->num_samples_per_frame);
+#else
+            memcpy(recorder_frame, data_buff, RADAR_SAMPLE12_BYTES(radar_profile_get_active()->num_samples_per_frame));
+#endif
+            radar_recorder_commit(&recorder);
+            radar_dsp_stats_add(&recorder.stats, radar_dsp_cycles() - start);
+        }
 
-        mgr.ack_data_read(1);
+#ifdef RADAR_ACQ_CM0P
+        radar_shm_ring_release(&acq_ring);
+#else
+        cycles += fifo_read_cycles((const uint8_t*)data_buff);
+        mgr.ack_data_read(rdm_subscription_id);
+#endif
+        radar_dsp_stats_add(radar_profile_get_stats(radar_profile_get_active()), cycles);
 
-        /* Tell processing task to take over */
-        xTaskNotifyGive(processing_task_handler);
+        xSemaphoreGive(frame_buffers_mutex);
 
+        radar_pipeline_submit(&pipeline, frame);
     }
 }
 
 /*******************************************************************************
-* Function Name: processing_task
+* Function Name: preprocess_stage
 ********************************************************************************
 * Summary:
-* This is the data processing task.
-*    1. It creates a console task to handle parameter configuration for the library
-*    2. In a loop
-*       - wait for the frame data available for process
-*       - Runs the Gesture algorithm and provides the result 
-*       - Interprets the results using app_logic() call
+* Pipeline stage removing the static clutter from the frame
 *
 * Parameters:
-*  void
+*  frame: frame descriptor
+*  ctx: unused
 *
 * Return:
-*  None
+*  0, the frame is always passed on
 *
 *******************************************************************************/
-static __NO_RETURN void processing_task(void *pvParameters)
+static int32_t preprocess_stage(radar_pipeline_frame_s *frame, void *ctx)
 {
-    (void)pvParameters;
-    inference_results_t results;
-
-    if (xTaskCreate(console_task, CLI_TASK_NAME, CLI_TASK_STACK_SIZE, NULL, CLI_TASK_PRIORITY, NULL) != pdPASS)
-    {
-        CY_ASSERT(0);
-    }
-
-    for(;;)
-    {
-        /* Wait for frame data available to process */
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-        /*pass on the de-interleaved data on to Algorithmic kernel*/
-        gestures_run(gesture_frame, &results);
+    (void)ctx;
 
-        /*interpret results*/
-        app_logic(&results);
+    radar_clutter_map_run(&clutter_map, frame->data);
 
-    }
+    return 0;
 }
 
-
 /*******************************************************************************
-* Function Name: radar_init
+* Function Name: compute_features
 ********************************************************************************
 * Summary:
-* This function configures the SPI interface, initializes radar and interrupt
-* service routine to indicate the availability of radar data. 
-* 
+* Runs the range transform, range-Doppler and angle-of-arrival stages on a
+* de-interleaved frame
+*
 * Parameters:
-*  void
+*  data: de-interleaved frame after the clutter map
 *
 * Return:
-*  Success or error 
+*  none
 *
 *******************************************************************************/
-static int32_t radar_init(void)
+static void compute_features(float32_t *data)
 {
-    if (cyhal_spi_init(&spi_obj,
-                       PIN_XENSIV_BGT60TRXX_SPI_MOSI,
-                       PIN_XENSIV_BGT60TRXX_SPI_MISO,
-                       PIN_XENSIV_BGT60TRXX_SPI_SCLK,
-                       NC,
-                       NULL,
-                       8,
-                       CYHAL_SPI_MODE_00_MSB,
-                       false) != CY_RSLT_SUCCESS)
-    {
-        printf("[MSG] ERROR: cyhal_spi_init failed\n");
-        return -1;
-    }
+    radar_range_fft_run(&range_fft, data);
+    radar_range_doppler_run(&range_doppler, &range_fft);
+    radar_aoa_run(&aoa, &range_fft);
+}
 
-    /* Reduce drive strength to improve EMI */
-    Cy_GPIO_SetSlewRate(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CY_GPIO_SLEW_FAST);
-    Cy_GPIO_SetDriveSel(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CY_GPIO_DRIVE_1_8);
-    Cy_GPIO_SetSlewRate(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CY_GPIO_SLEW_FAST);
-    Cy_GPIO_SetDriveSel(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CY_GPIO_DRIVE_1_8);
+/*******************************************************************************
+* Function Name: features_stage
+********************************************************************************
+* Summary:
+* Pipeline stage running the features for custom detectors while the active
+* backend does not use them. A backend that uses the features gets them
+* computed by the inference stage from the frame it classifies, the features
+* stage would already overwrite them with the next frame.
+*
+* Parameters:
+*  frame: frame descriptor
+*  ctx: unused
+*
+* Return:
+*  0, the frame is always passed on
+*
+*******************************************************************************/
+static int32_t features_stage(radar_pipeline_frame_s *frame, void *ctx)
+{
+    (void)ctx;
 
-    /* Set the data rate to 25 Mbps */
-    if (cyhal_spi_set_frequency(&spi_obj, XENSIV_BGT60TRXX_SPI_FREQUENCY) != CY_RSLT_SUCCESS)
+    if (!radar_inference_backend_get_active()->uses_features)
     {
-        printf("[MSG] ERROR: cyhal_spi_set_frequency failed\n");
-        return -1;
+        compute_features(frame->data);
     }
 
-    /* Enable LDO */
-    if (cyhal_gpio_init(PIN_XENSIV_BGT60TRXX_LDO_EN,
-                        CYHAL_GPIO_DIR_OUTPUT,
-                        CYHAL_GPIO_DRIVE_STRONG,
-                        true) != CY_RSLT_SUCCESS)
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: inference_stage
+********************************************************************************
+* Summary:
+* Pipeline stage passing the de-interleaved frame to the active inference
+* backend, together with the features of the same frame if the backend uses
+* them
+*
+* Parameters:
+*  frame: frame descriptor
+*  ctx: unused
+*
+* Return:
+*  0, the frame is always passed on
+*
+*******************************************************************************/
+static int32_t inference_stage(radar_pipeline_frame_s *frame, void *ctx)
+{
+    frame_context_s *context = (frame_context_s*)frame->user;
+    const radar_inference_backend_s *backend = radar_inference_backend_get_active();
+    const radar_inference_input_s input = {
+        .frame = frame->data,
+        .range_fft = backend->uses_features ? &range_fft : NULL,
+        .range_doppler = backend->uses_features ? &range_doppler : NULL,
+        .aoa = backend->uses_features ? &aoa : NULL
+    };
+    (void)ctx;
+
+    /* backends not supporting the frame geometry of the profile are not ready */
+    context->run_gestures = radar_inference_backend_ready(backend);
+
+    if (context->run_gestures)
     {
-        printf("[MSG] ERROR: LDO_EN cyhal_gpio_init failed\n");
-        return -1;
-    }
+        if (backend->uses_features)
+        {
+            compute_features(frame->data);
+        }
 
-    /* Wait LDO stable */
-    (void)cyhal_system_delay_ms(5);
+        /*pass on the de-interleaved data on to Algorithmic kernel*/
+        radar_inference_backend_run(backend, &input, &context->results);
 
-    if (xensiv_bgt60trxx_mtb_init(&bgt60_obj, 
-                                  &spi_obj, 
+        /* taken when the backend returned, frames without a ready backend do not count */
+        if (run_state.first_inference_pending)
+        {
+            radar_boot_first_result(&boot);
+            run_state.first_inference_cycles = radar_dsp_cycles() - run_state.resumed_at;
+            if (run_state.first_inference_cycles > run_state.first_inference_cycles_max)
+            {
+                run_state.first_inference_cycles_max = run_state.first_inference_cycles;
+            }
+            run_state.first_inference_pending = false;
+        }
+
+        /* keep the hand out of the background while a gesture is performed */
+        if ((context->results.idx != 0) && (context->results.score > gesture_detection_threshold))
+        {
+            radar_clutter_map_hold(&clutter_map, GESTURE_HOLD_TIME);
+        }
+        else if ((context->results.idx != 0) && (context->results.score > RECORDER_LOW_CONFIDENCE_SCORE))
+        {
+            /* a gesture that may have been missed */
+            radar_recorder_trigger(&recorder, RADAR_RECORDER_TRIGGER_LOW_CONFIDENCE);
+        }
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: decision_stage
+********************************************************************************
+* Summary:
+* Pipeline stage interpreting the gesture results
+*
+* Parameters:
+*  frame: frame descriptor
+*  ctx: unused
+*
+* Return:
+*  0, the frame is always passed on
+*
+*******************************************************************************/
+static int32_t decision_stage(radar_pipeline_frame_s *frame, void *ctx)
+{
+    frame_context_s *context = (frame_context_s*)frame->user;
+    (void)ctx;
+
+    /*interpret results*/
+    context->decision = context->run_gestures ? app_logic(&context->results) : RADAR_DECISION_NONE;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: output_stage
+********************************************************************************
+* Summary:
+* Pipeline stage printing the detection and sending the telemetry, at the
+* lowest priority so the console output never holds up the decision of the
+* next frame
+*
+* Parameters:
+*  frame: frame descriptor
+*  ctx: unused
+*
+* Return:
+*  0
+*
+*******************************************************************************/
+static int32_t output_stage(radar_pipeline_frame_s *frame, void *ctx)
+{
+    const frame_context_s *context = (const frame_context_s*)frame->user;
+    (void)ctx;
+
+    if (context->decision == RADAR_DECISION_EVENT)
+    {
+        /*verbose output is optional work*/
+        output_gesture(&context->results, ce_app_state.verbose && !radar_pipeline_shed_optional(frame));
+    }
+
+    if (radar_telemetry_binary(&telemetry) && (run_state.state == RADAR_RUN_STATE_ACTIVE))
+    {
+        send_telemetry(frame);
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: send_telemetry
+********************************************************************************
+* Summary:
+* Sends a trace message when the shed level changed and, in verbose mode,
+* the pipeline metrics once per TELEMETRY_METRICS_PERIOD_MS. The metrics are
+* optional work.
+*
+* Parameters:
+*  frame: frame leaving the output stage
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void send_telemetry(const radar_pipeline_frame_s *frame)
+{
+    static radar_pipeline_shed_e shed_level = RADAR_PIPELINE_SHED_NONE;
+    static TickType_t metrics_sent_at;
+    const TickType_t now = xTaskGetTickCount();
+    radar_telemetry_metrics_s metrics;
+
+    if (frame->shed_level != shed_level)
+    {
+        shed_level = frame->shed_level;
+        (void)radar_telemetry_send_trace(&telemetry, RADAR_TELEMETRY_TRACE_SHED_LEVEL,
+                                         (uint32_t)shed_level, frame->submitted_at);
+    }
+
+    if (!ce_app_state.verbose || radar_pipeline_shed_optional(frame) ||
+        ((now - metrics_sent_at) < pdMS_TO_TICKS(TELEMETRY_METRICS_PERIOD_MS)))
+    {
+        return;
+    }
+    metrics_sent_at = now;
+
+    metrics.timestamp_ms = now * portTICK_PERIOD_MS;
+    metrics.frames = pipeline.latency.frames;
+    metrics.deadline_misses = pipeline.deadline_misses;
+    metrics.latency_mean = radar_dsp_stats_mean(&pipeline.latency);
+    metrics.latency_max = pipeline.latency.cycles_max;
+    metrics.dropped = pipeline.decimated + pipeline.coalesced;
+    for (uint32_t i = 0; i < pipeline.num_stages; ++i)
+    {
+        metrics.dropped += pipeline.stages[i].dropped;
+    }
+    metrics.shed_level = (uint8_t)shed_level;
+
+    (void)radar_telemetry_send_metrics(&telemetry, &metrics);
+}
+
+/*******************************************************************************
+* Function Name: add_pipeline_stages
+********************************************************************************
+* Summary:
+* This function adds the processing stages of the application to the pipeline
+*    1. preprocess: removes the static clutter
+*    2. features: range FFT, range-Doppler map and angle of arrival, unless
+*       the active backend uses them
+*    3. inference: runs the active inference backend, with the features of
+*       the frame if the backend uses them
+*    4. decision: interprets the results using app_logic()
+*    5. output: prints the detection and sends the telemetry
+* The features stage is the first to be skipped under overload. A frame has
+* to leave the pipeline before its slot is needed again, i.e. within
+* RADAR_PIPELINE_NUM_SLOTS frame periods.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t add_pipeline_stages(void)
+{
+    const float frame_cycles = (float)radar_dsp_cycles_per_second() * (float)XENSIV_BGT60TRXX_CONF_FRAME_REPETITION_TIME_S;
+    const uint32_t inference_budget = (uint32_t)(((uint64_t)radar_dsp_cycles_per_second() * INFERENCE_STAGE_BUDGET_MS) / 1000U);
+    int32_t features;
+    int32_t inference;
+
+    if ((radar_pipeline_add_stage(&pipeline, "preprocess", preprocess_stage, NULL,
+                                  PREPROCESS_STAGE_PRIORITY, PREPROCESS_STAGE_STACK_SIZE) < 0) ||
+        ((features = radar_pipeline_add_stage(&pipeline, "features", features_stage, NULL,
+                                              FEATURES_STAGE_PRIORITY, FEATURES_STAGE_STACK_SIZE)) < 0) ||
+        ((inference = radar_pipeline_add_stage(&pipeline, "inference", inference_stage, NULL,
+                                               INFERENCE_STAGE_PRIORITY, INFERENCE_STAGE_STACK_SIZE)) < 0) ||
+        (radar_pipeline_add_stage(&pipeline, "decision", decision_stage, NULL,
+                                  DECISION_STAGE_PRIORITY, DECISION_STAGE_STACK_SIZE) < 0) ||
+        (radar_pipeline_add_stage(&pipeline, "output", output_stage, NULL,
+                                  OUTPUT_STAGE_PRIORITY, OUTPUT_STAGE_STACK_SIZE) < 0))
+    {
+        return -1;
+    }
+
+    (void)radar_pipeline_configure_stage(&pipeline, (uint32_t)features, true, 0);
+    (void)radar_pipeline_configure_stage(&pipeline, (uint32_t)inference, false, inference_budget);
+    radar_pipeline_set_deadline(&pipeline, (uint32_t)(frame_cycles * (float)RADAR_PIPELINE_NUM_SLOTS));
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: stream_write
+********************************************************************************
+* Summary:
+* Sink of the raw frame stream, writes a record to the debug UART, in chunks
+* between the other messages in the binary telemetry mode
+*
+* Parameters:
+*  data: record
+*  len: bytes of the record
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void stream_write(const uint8_t *data, uint32_t len)
+{
+    if (radar_telemetry_binary(&telemetry))
+    {
+        (void)radar_telemetry_send_frame(&telemetry, data, len);
+    }
+    else
+    {
+        (void)radar_uart_tx_write(&uart_tx, data, len, RADAR_UART_TX_TRUNCATE, console_tx_wait());
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: telemetry_write
+********************************************************************************
+* Summary:
+* Sink of the binary telemetry, writes an encoded message to the debug UART
+*
+* Parameters:
+*  data: encoded message
+*  len: bytes of the message
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void telemetry_write(const uint8_t *data, uint32_t len)
+{
+    /* a message that does not fit is dropped whole, the receiver sees a gap in the sequence */
+    (void)radar_uart_tx_write(&uart_tx, data, len, RADAR_UART_TX_ATOMIC, console_tx_wait());
+}
+
+
+/*******************************************************************************
+* Function Name: init_uart_tx
+********************************************************************************
+* Summary:
+* This function sets up the transmit ring of the debug UART. Transfers use
+* DMA if a channel is available and the TX FIFO interrupt otherwise, every
+* completion starts the transfer of the next bytes of the ring.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t init_uart_tx(void)
+{
+    if (radar_uart_tx_init(&uart_tx, uart_tx_start, NULL) != 0)
+    {
+        return -1;
+    }
+
+    /* without a free DMA channel the HAL keeps interrupt driven transfers */
+    (void)cyhal_uart_set_async_mode(&cy_retarget_io_uart_obj, CYHAL_ASYNC_DMA, UART_TX_INTERRUPT_PRIORITY);
+
+    cyhal_uart_register_callback(&cy_retarget_io_uart_obj, uart_tx_event_handler, NULL);
+    cyhal_uart_enable_event(&cy_retarget_io_uart_obj, CYHAL_UART_IRQ_TX_DONE, UART_TX_INTERRUPT_PRIORITY, true);
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: uart_tx_start
+********************************************************************************
+* Summary:
+* Starts the asynchronous transfer of contiguous bytes of the transmit ring
+*
+* Parameters:
+*  ctx: unused
+*  data: bytes in the ring
+*  len: number of bytes
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t uart_tx_start(void *ctx, const uint8_t *data, uint32_t len)
+{
+    (void)ctx;
+
+    return (cyhal_uart_write_async(&cy_retarget_io_uart_obj, (void*)data, len) == CY_RSLT_SUCCESS) ? 0 : -2;
+}
+
+
+/*******************************************************************************
+* Function Name: uart_tx_event_handler
+********************************************************************************
+* Summary:
+* UART interrupt callback, reports completed transfers to the transmit ring
+*
+* Parameters:
+*  callback_arg: unused
+*  event: UART events
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void uart_tx_event_handler(void *callback_arg, cyhal_uart_event_t event)
+{
+    (void)callback_arg;
+
+    if ((event & CYHAL_UART_IRQ_TX_DONE) != 0U)
+    {
+        radar_uart_tx_done(&uart_tx);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: console_tx_wait
+********************************************************************************
+* Summary:
+* Ticks the calling task may wait for space in the transmit ring. Only the
+* console and the raw frame stream wait, the acquisition and the pipeline
+* stages never block on the UART.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  ticks to wait
+*
+*******************************************************************************/
+static TickType_t console_tx_wait(void)
+{
+    return (uxTaskPriorityGet(NULL) <= CONSOLE_TX_WAIT_PRIORITY) ? pdMS_TO_TICKS(CONSOLE_TX_WAIT_MS) : 0U;
+}
+
+
+#ifdef RADAR_CONSOLE_TX_RING
+int __real__write(int fd, const char *ptr, int len);
+
+/*******************************************************************************
+* Function Name: __wrap__write
+********************************************************************************
+* Summary:
+* Replaces the write of retarget-io for stdout and stderr once the scheduler
+* runs, so printf copies into the transmit ring instead of waiting on every
+* character. Line feeds are converted like retarget-io does. Bound by the
+* linker option --wrap=_write set in the Makefile.
+*
+* Parameters:
+*  fd: file descriptor
+*  ptr: characters
+*  len: number of characters
+*
+* Return:
+*  number of characters written
+*
+*******************************************************************************/
+int __wrap__write(int fd, const char *ptr, int len)
+{
+    uint8_t buffer[64];
+    uint32_t n = 0;
+    TickType_t wait;
+
+    if (((fd != 1) && (fd != 2)) || (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) ||
+        xPortIsInsideInterrupt())
+    {
+        return __real__write(fd, ptr, len);
+    }
+
+    wait = console_tx_wait();
+
+    for (int i = 0; i < len; ++i)
+    {
+#ifdef CY_RETARGET_IO_CONVERT_LF_TO_CRLF
+        if (ptr[i] == '\n')
+        {
+            buffer[n++] = '\r';
+        }
+#endif
+        buffer[n++] = (uint8_t)ptr[i];
+
+        if ((n >= (sizeof(buffer) - 1U)) || (i == (len - 1)))
+        {
+            (void)radar_uart_tx_write(&uart_tx, buffer, n, RADAR_UART_TX_TRUNCATE, wait);
+            n = 0;
+        }
+    }
+
+    return len;
+}
+#endif /* RADAR_CONSOLE_TX_RING */
+
+
+/*******************************************************************************
+* Function Name: radar_init
+********************************************************************************
+* Summary:
+* This function initializes the radar powered on by radar_power_on and the
+* interrupt service routine to indicate the availability of radar data.
+* The LDO must have settled, see wait_ldo_settled.
+* With the acquisition on the CM0+ it only sets up the frame notification,
+* the CM0+ configures the radar with the first start request.
+* 
+* Parameters:
+*  void
+*
+* Return:
+*  Success or error 
+*
+*******************************************************************************/
+static int32_t radar_init(void)
+{
+#ifdef RADAR_ACQ_CM0P
+    if (radar_acq_ipc_init(main_task_handler, GPIO_INTERRUPT_PRIORITY) != 0)
+    {
+        printf("[MSG] ERROR: radar_acq_ipc_init failed\n");
+        return -1;
+    }
+
+    return 0;
+#else
+    const radar_profile_s *profile = radar_profile_get_active();
+    uint32_t regs[XENSIV_BGT60TRXX_CONF_NUM_REGS];
+    uint32_t num_regs = radar_profile_generate_registers(profile, regs);
+
+    if (xensiv_bgt60trxx_mtb_init(&bgt60_obj, 
+                                  &spi_obj, 
                                   PIN_XENSIV_BGT60TRXX_SPI_CSN, 
                                   PIN_XENSIV_BGT60TRXX_RSTN, 
-                                  register_list,
-                                  XENSIV_BGT60TRXX_CONF_NUM_REGS) != CY_RSLT_SUCCESS)
+                                  regs,
+                                  num_regs) != CY_RSLT_SUCCESS)
     {
         printf("[MSG] ERROR: xensiv_bgt60trxx_mtb_init failed\n");
         return -1;
     }
 
     if (xensiv_bgt60trxx_mtb_interrupt_init(&bgt60_obj,
-                                            NUM_SAMPLES_PER_FRAME*2,
+                                            profile->num_samples_per_frame*2,
                                             PIN_XENSIV_BGT60TRXX_IRQ,
                                             GPIO_INTERRUPT_PRIORITY,
                                             xensiv_bgt60trxx_interrupt_handler,
@@ -516,8 +1398,1172 @@ static int32_t radar_init(void)
     }
 
     return 0;
+#endif
 }
 
+#ifndef RADAR_ACQ_CM0P
+/*******************************************************************************
+* Function Name: radar_power_on
+********************************************************************************
+* Summary:
+* This function configures the SPI interface and enables the LDO of the
+* sensor. It runs first at boot, so the LDO settles while the buffers and
+* tasks of the application are set up.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t radar_power_on(void)
+{
+    if (cyhal_spi_init(&spi_obj,
+                       PIN_XENSIV_BGT60TRXX_SPI_MOSI,
+                       PIN_XENSIV_BGT60TRXX_SPI_MISO,
+                       PIN_XENSIV_BGT60TRXX_SPI_SCLK,
+                       NC,
+                       NULL,
+                       8,
+                       CYHAL_SPI_MODE_00_MSB,
+                       false) != CY_RSLT_SUCCESS)
+    {
+        printf("[MSG] ERROR: cyhal_spi_init failed\n");
+        return -1;
+    }
+
+    /* Reduce drive strength to improve EMI */
+    Cy_GPIO_SetSlewRate(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CY_GPIO_SLEW_FAST);
+    Cy_GPIO_SetDriveSel(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_MOSI), CY_GPIO_DRIVE_1_8);
+    Cy_GPIO_SetSlewRate(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CY_GPIO_SLEW_FAST);
+    Cy_GPIO_SetDriveSel(CYHAL_GET_PORTADDR(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CYHAL_GET_PIN(PIN_XENSIV_BGT60TRXX_SPI_SCLK), CY_GPIO_DRIVE_1_8);
+
+    /* Set the data rate to 25 Mbps */
+    if (cyhal_spi_set_frequency(&spi_obj, XENSIV_BGT60TRXX_SPI_FREQUENCY) != CY_RSLT_SUCCESS)
+    {
+        printf("[MSG] ERROR: cyhal_spi_set_frequency failed\n");
+        return -1;
+    }
+
+    /* Enable LDO */
+    if (cyhal_gpio_init(PIN_XENSIV_BGT60TRXX_LDO_EN,
+                        CYHAL_GPIO_DIR_OUTPUT,
+                        CYHAL_GPIO_DRIVE_STRONG,
+                        true) != CY_RSLT_SUCCESS)
+    {
+        printf("[MSG] ERROR: LDO_EN cyhal_gpio_init failed\n");
+        return -1;
+    }
+
+    ldo_enabled_at = radar_dsp_cycles();
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: wait_ldo_settled
+********************************************************************************
+* Summary:
+* This function waits for the rest of the settling time of the LDO enabled
+* by radar_power_on.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void wait_ldo_settled(void)
+{
+    const uint32_t cycles_per_us = radar_dsp_cycles_per_second() / 1000000U;
+    const uint32_t elapsed_us = (radar_dsp_cycles() - ldo_enabled_at) / cycles_per_us;
+
+    if (elapsed_us < LDO_SETTLE_US)
+    {
+        cyhal_system_delay_us((uint16_t)(LDO_SETTLE_US - elapsed_us));
+    }
+}
+#endif
+
+
+/*******************************************************************************
+* Function Name: provision_frame_buffers
+********************************************************************************
+* Summary:
+* This function provisions the radar data manager buffer, the de-interleaved
+* frames of the pipeline slots, the preprocessing buffers and the flight
+* recorder store for a profile from the frame arena. The radar data manager
+* must be de-initialized and the pipeline drained before. With the
+* acquisition on the CM0+ the ring between the cores takes the place of the
+* radar data manager buffer, the CM0+ must be stopped before. A window frozen
+* by the flight recorder is lost.
+*
+* Parameters:
+*  profile: radar profile the buffers are sized for
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t provision_frame_buffers(const radar_profile_s *profile)
+{
+    uint32_t first_bin;
+    uint32_t num_bins;
+
+    radar_frame_arena_reset();
+
+#ifdef RADAR_ACQ_CM0P
+    if (radar_shm_ring_init(&acq_ring,
+                            RADAR_ACQ_IPC_RING_SLOTS,
+                            profile->num_samples_per_frame * 2,
+                            radar_frame_arena_alloc) != 0)
+    {
+        return -1;
+    }
+#else
+    /* RDM clears the allocator functions on de-init, supply them every time */
+    radar_data_manager_set_malloc_free(radar_frame_arena_alloc,
+            radar_frame_arena_free);
+
+    if (radar_data_manager_init(&mgr,
+                                RADAR_FRAME_ARENA_RDM_RECORD_SIZE(profile->num_samples_per_frame) *
+                                RADAR_PROFILE_RDM_FRAMES,
+                                RADAR_FRAME_ARENA_RDM_RECORD_SIZE(profile->num_samples_per_frame)) != RDM_SUCCESS)
+    {
+        return -1;
+    }
+#endif
+
+    for (uint32_t i = 0; i < RADAR_PIPELINE_NUM_SLOTS; ++i)
+    {
+        pipeline.slots[i].data = radar_frame_arena_alloc(profile->num_samples_per_frame * sizeof(float32_t));
+        if (pipeline.slots[i].data == NULL)
+        {
+            return -1;
+        }
+    }
+
+    if (radar_clutter_map_init(&clutter_map,
+                               profile->num_samples_per_chirp,
+                               profile->num_chirps_per_frame,
+                               profile->num_rx_antennas,
+                               radar_frame_arena_alloc) != 0)
+    {
+        return -1;
+    }
+
+    if (radar_range_fft_init(&range_fft,
+                             profile->num_samples_per_chirp,
+                             profile->num_chirps_per_frame,
+                             profile->num_rx_antennas,
+                             radar_frame_arena_alloc) != 0)
+    {
+        return -1;
+    }
+
+    if (radar_range_doppler_init(&range_doppler,
+                                 profile->num_chirps_per_frame,
+                                 range_fft.num_range_bins,
+                                 radar_frame_arena_alloc) != 0)
+    {
+        return -1;
+    }
+
+    if (radar_aoa_init(&aoa,
+                       profile->num_chirps_per_frame,
+                       range_fft.num_range_bins,
+                       radar_frame_arena_alloc) != 0)
+    {
+        return -1;
+    }
+
+    if (radar_recorder_init(&recorder,
+                            profile->num_samples_per_chirp,
+                            profile->num_chirps_per_frame,
+                            profile->num_rx_antennas,
+                            radar_frame_arena_alloc) != 0)
+    {
+        return -1;
+    }
+
+    /* every backend is kept ready, switching between them needs no buffers */
+    if (radar_inference_init(profile->num_samples_per_chirp,
+                             profile->num_chirps_per_frame,
+                             profile->num_rx_antennas,
+                             radar_frame_arena_alloc) != 0)
+    {
+        return -1;
+    }
+
+    /* a gate outside the range of the profile leaves the gate open */
+    if (radar_profile_range_gate_bins(profile, range_gate_min_cm, range_gate_max_cm,
+                                      &first_bin, &num_bins) == 0)
+    {
+        (void)radar_range_fft_set_gate(&range_fft, first_bin, num_bins);
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: radar_apply_range_gate
+********************************************************************************
+* Summary:
+* This function restricts the range FFT and the stages after it to the range
+* bins between min_cm and max_cm of the active profile. The gate takes effect
+* with the next frame and is kept when the profile is changed.
+*
+* Parameters:
+*  min_cm: near end of the gate in centimeters
+*  max_cm: far end of the gate in centimeters
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+int32_t radar_apply_range_gate(uint32_t min_cm, uint32_t max_cm)
+{
+    uint32_t first_bin;
+    uint32_t num_bins;
+
+    if (radar_profile_range_gate_bins(radar_profile_get_active(), min_cm, max_cm,
+                                      &first_bin, &num_bins) != 0)
+    {
+        return -1;
+    }
+
+    if (radar_range_fft_set_gate(&range_fft, first_bin, num_bins) != 0)
+    {
+        return -1;
+    }
+
+    range_gate_min_cm = min_cm;
+    range_gate_max_cm = max_cm;
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: radar_apply_profile
+********************************************************************************
+* Summary:
+* This function switches the radar to another configuration profile at runtime.
+*    1. Stops the radar frame generation
+*    2. Waits until the acquisition releases the frame buffers and the
+*       pipeline has processed the frames in flight
+*    3. Re-provisions the RDM buffer and the pipeline frame slots from the arena
+*    4. Programs the generated register list of the profile into the device
+*    5. Restarts the frame generation
+* With the acquisition on the CM0+ steps 1, 4 and 5 are requests to the CM0+
+* and the ring between the cores is re-provisioned in place of the RDM buffer.
+* Outside the active state the radar is already stopped and is not restarted,
+* a powered down sensor is configured when it is powered up again.
+*
+* Parameters:
+*  profile: radar profile from the profile table
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+int32_t radar_apply_profile(const radar_profile_s *profile)
+{
+    const bool active = (run_state.state == RADAR_RUN_STATE_ACTIVE);
+    int32_t result = 0;
+
+    if (profile == NULL)
+    {
+        return -1;
+    }
+
+    if (profile == radar_profile_get_active())
+    {
+        return 0;
+    }
+
+    if (active && (start_frames(false) != 0))
+    {
+        return -2;
+    }
+
+    xSemaphoreTake(frame_buffers_mutex, portMAX_DELAY);
+    radar_pipeline_drain(&pipeline);
+
+#ifdef RADAR_ACQ_CM0P
+    /* the CM0+ detached the ring, it can be re-provisioned */
+    radar_profile_set_active(profile);
+#else
+    /* keep the data ISR out while the RDM is torn down */
+    taskENTER_CRITICAL();
+    mgr.unsubscribe(rdm_subscription_id);
+    (void)radar_data_manager_deinit();
+    radar_profile_set_active(profile);
+    taskEXIT_CRITICAL();
+#endif
+
+    if (provision_frame_buffers(profile) != 0)
+    {
+        CY_ASSERT(0);
+    }
+
+#ifndef RADAR_ACQ_CM0P
+    rdm_subscription_id = mgr.subscribe(main_task_handler);
+
+    if (run_state.sensor_powered && (configure_radar(profile) != 0))
+    {
+        printf("[MSG] ERROR: radar profile %s configuration failed\n", profile->name);
+        result = -2;
+    }
+#endif
+
+    xSemaphoreGive(frame_buffers_mutex);
+
+    /* with the acquisition on the CM0+ the start request configures the sensor */
+    if (active && (start_frames(true) != 0))
+    {
+        printf("[MSG] ERROR: radar profile %s configuration failed\n", profile->name);
+        result = -2;
+    }
+
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: radar_apply_inference_backend
+********************************************************************************
+* Summary:
+* This function switches the inference to another backend at runtime. The
+* frames in flight are processed first, the backend then starts from its
+* reset state with the next frame. The features stage is made mandatory for
+* backends that use the features.
+*
+* Parameters:
+*  backend: inference backend from the backend table
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+int32_t radar_apply_inference_backend(const radar_inference_backend_s *backend)
+{
+    if (backend == NULL)
+    {
+        return -1;
+    }
+
+    if (backend == radar_inference_backend_get_active())
+    {
+        return 0;
+    }
+
+    xSemaphoreTake(frame_buffers_mutex, portMAX_DELAY);
+    radar_pipeline_drain(&pipeline);
+
+    radar_inference_backend_reset(backend);
+    radar_inference_backend_set_active(backend);
+
+    /* scores of the previous backend do not vote */
+    radar_decision_reset(&decision);
+
+    xSemaphoreGive(frame_buffers_mutex);
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: radar_apply_decision_vote
+********************************************************************************
+* Summary:
+* This function selects the frames gestures are decided on at runtime. The
+* frames in flight are decided on with the previous configuration, the vote
+* then starts without frames.
+*
+* Parameters:
+*  vote: vote configuration
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+int32_t radar_apply_decision_vote(const radar_decision_vote_s *vote)
+{
+    int32_t result;
+
+    xSemaphoreTake(frame_buffers_mutex, portMAX_DELAY);
+    radar_pipeline_drain(&pipeline);
+
+    result = radar_decision_set_vote(&decision, vote);
+
+    xSemaphoreGive(frame_buffers_mutex);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: capture_config
+********************************************************************************
+* Summary:
+* This function takes the console settings into a configuration record.
+*
+* Parameters:
+*  record: configuration record
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void capture_config(config_record_s *record)
+{
+    /* the record is compared as a whole, padding included */
+    (void)memset(record, 0, sizeof(*record));
+
+    (void)strncpy(record->profile, radar_profile_get_active()->name, CONFIG_NAME_MAX - 1U);
+    (void)strncpy(record->backend, radar_inference_backend_get_active()->name, CONFIG_NAME_MAX - 1U);
+    for (uint32_t i = 0; i < NUMBER_OF_GESTURE_CLASSES; ++i)
+    {
+        record->detect_list[i] = gesture_detect_list[i] ? 1U : 0U;
+    }
+    record->verbose = ce_app_state.verbose ? 1U : 0U;
+    record->gate_min_cm = range_gate_min_cm;
+    record->gate_max_cm = range_gate_max_cm;
+    record->vote = decision.vote;
+}
+
+/*******************************************************************************
+* Function Name: load_config
+********************************************************************************
+* Summary:
+* This function loads the console settings saved before the last reset and
+* applies them before the frame buffers are provisioned. Without a valid
+* record of the current layout the defaults stay. A profile or backend no
+* longer in the tables is skipped.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void load_config(void)
+{
+    config_record_s record;
+    const radar_profile_s *profile;
+    const radar_inference_backend_s *backend;
+
+    if ((radar_config_store_init(&config_store, &config_flash_backend) == 0) &&
+        (radar_config_store_load(&config_store, CONFIG_RECORD_VERSION, &record, sizeof(record)) == 0))
+    {
+        record.profile[CONFIG_NAME_MAX - 1U] = '\0';
+        record.backend[CONFIG_NAME_MAX - 1U] = '\0';
+
+        profile = radar_profile_find(record.profile);
+        if (profile != NULL)
+        {
+            radar_profile_set_active(profile);
+        }
+
+        profile = radar_profile_get_active();
+        backend = radar_inference_backend_find(record.backend);
+        if ((backend != NULL) &&
+            backend->compatible(profile->num_samples_per_chirp, profile->num_chirps_per_frame,
+                                profile->num_rx_antennas))
+        {
+            radar_inference_backend_set_active(backend);
+        }
+
+        for (uint32_t i = 0; i < NUMBER_OF_GESTURE_CLASSES; ++i)
+        {
+            gesture_detect_list[i] = (record.detect_list[i] != 0U);
+        }
+        ce_app_state.verbose = (record.verbose != 0U);
+
+        if (record.gate_min_cm < record.gate_max_cm)
+        {
+            range_gate_min_cm = record.gate_min_cm;
+            range_gate_max_cm = record.gate_max_cm;
+        }
+
+        (void)radar_decision_set_vote(&decision, &record.vote);
+    }
+
+    /* only settings differing from the ones in effect are saved */
+    capture_config(&saved_config);
+}
+
+/*******************************************************************************
+* Function Name: radar_save_config
+********************************************************************************
+* Summary:
+* This function saves the console settings if they changed since they were
+* loaded or last saved. It is called when the settings mode is left, so all
+* changes of a session take one write, and the radar is still stopped while
+* the flash row is programmed.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+int32_t radar_save_config(void)
+{
+    config_record_s record;
+
+    capture_config(&record);
+    if (memcmp(&record, &saved_config, sizeof(record)) == 0)
+    {
+        return 0;
+    }
+
+    if (radar_config_store_save(&config_store, CONFIG_RECORD_VERSION, &record, sizeof(record)) != 0)
+    {
+        return -2;
+    }
+    saved_config = record;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: config_flash_read
+********************************************************************************
+* Summary:
+* Read function of the configuration store, the flash is memory mapped.
+*
+* Parameters:
+*  ctx: unused
+*  offset: offset into the rows of the store
+*  data: destination
+*  len: number of bytes
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t config_flash_read(void *ctx, uint32_t offset, void *data, uint32_t len)
+{
+    (void)ctx;
+
+    if ((offset + len) > sizeof(config_flash))
+    {
+        return -1;
+    }
+
+    (void)memcpy(data, &config_flash[offset], len);
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: config_flash_write
+********************************************************************************
+* Summary:
+* Write function of the configuration store, programs one flash row. The
+* CPU is blocked until the row is erased and programmed.
+*
+* Parameters:
+*  ctx: unused
+*  slot: row of the store
+*  data: record
+*  len: number of bytes, up to a row
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t config_flash_write(void *ctx, uint32_t slot, const void *data, uint32_t len)
+{
+    /* the flash driver takes a word aligned row */
+    static uint32_t row[CY_FLASH_SIZEOF_ROW / sizeof(uint32_t)];
+
+    (void)ctx;
+
+    if ((slot >= CONFIG_STORE_SLOTS) || (len > CY_FLASH_SIZEOF_ROW))
+    {
+        return -1;
+    }
+
+    (void)memset(row, 0, sizeof(row));
+    (void)memcpy(row, data, len);
+
+    return (Cy_Flash_WriteRow((uint32_t)(uintptr_t)&config_flash[slot * CY_FLASH_SIZEOF_ROW], row) == CY_FLASH_DRV_SUCCESS) ? 0 : -2;
+}
+
+
+#ifndef RADAR_ACQ_CM0P
+/* canned frame the read function of the benchmark passes to the RDM */
+static const uint8_t *bench_canned_frame;
+
+/*******************************************************************************
+* Function Name: bench_read_radar_data
+********************************************************************************
+* Summary:
+* Read function of the RDM while the benchmark runs. It stores the canned
+* frame like read_radar_data() stores a frame of the FIFO, without the SPI
+* transfer and with zero read cycles.
+*
+* Parameters:
+*  data: pointer to the RDM buffer
+*  num_samples: receives the bytes of the frame record
+*  samples_ub: bytes left in the RDM buffer
+*
+* Return:
+*  int32_t: 0 if success
+*
+*******************************************************************************/
+static int32_t bench_read_radar_data(uint16_t* data, uint32_t *num_samples, uint32_t samples_ub)
+{
+    const uint32_t samples_per_frame = radar_profile_get_active()->num_samples_per_frame;
+    const uint32_t frame_bytes = RADAR_SAMPLE12_BYTES(samples_per_frame);
+    const uint32_t cycles = 0;
+
+    if (samples_ub < RADAR_FRAME_ARENA_RDM_RECORD_SIZE(samples_per_frame))
+    {
+        return -2;
+    }
+
+    memcpy(data, bench_canned_frame, frame_bytes);
+    memcpy((uint8_t*)data + frame_bytes, &cycles, sizeof(cycles));
+    *num_samples = RADAR_FRAME_ARENA_RDM_RECORD_SIZE(samples_per_frame);
+
+    return 0;
+}
+#endif
+
+/*******************************************************************************
+* Function Name: bench_stage
+********************************************************************************
+* Summary:
+* This function runs one stage of the benchmark on a canned frame. The
+* stages follow the processing of a frame:
+*    0. rdm: run() of the radar data manager with a read function copying
+*       the frame into its buffer, without the SPI transfer, and the read of
+*       the frame from the buffer. With the acquisition on the CM0+, copy:
+*       the 16-bit samples the CM0+ delivers into the acquisition buffer.
+*    1. deinterleave: the acquisition buffer into the frame of a slot, and
+*       the acknowledge that consumes the frame in the radar data manager
+*    2. clutter: the clutter map, without background update
+*    3-5. range_fft, doppler, aoa: the features
+*    6. inference: the active backend
+*    7. decision: the decision of app_logic() on a copy of its state
+*
+* Parameters:
+*  stage: stage index
+*  canned: canned frame in flash
+*  raw: acquisition buffer, set to the frame in the RDM buffer by stage 0
+*  frame: de-interleaved frame
+*  bench_decision: decision the results are decided on
+*  result: inference result
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void bench_stage(uint32_t stage, const uint8_t *canned, uint8_t **raw, float32_t *frame,
+                        radar_decision_s *bench_decision, radar_inference_result_s *result)
+{
+    const radar_profile_s *profile = radar_profile_get_active();
+#ifndef RADAR_ACQ_CM0P
+    uint16_t *data_buff;
+    uint32_t sz;
+#endif
+    const radar_inference_input_s input = {
+        .frame = frame,
+        .range_fft = &range_fft,
+        .range_doppler = &range_doppler,
+        .aoa = &aoa
+    };
+
+    switch (stage)
+    {
+        case 0:
+#ifdef RADAR_ACQ_CM0P
+            /* the CM0+ delivers 16-bit samples */
+            radar_sample12_unpack(canned, (uint16_t*)*raw, profile->num_samples_per_frame);
+#else
+            /* the main task is notified, it finds the frame consumed by stage 1 */
+            bench_canned_frame = canned;
+            mgr.run(false);
+            if (mgr.read_from_buffer(rdm_subscription_id, &data_buff, &sz) == 0)
+            {
+                *raw = (uint8_t*)data_buff;
+            }
+#endif
+            break;
+        case 1:
+#ifdef RADAR_ACQ_CM0P
+            deinterleave_antennas((uint16_t*)*raw, frame);
+#else
+            radar_sample12_deinterleave(*raw, frame, profile->num_samples_per_frame, profile->num_rx_antennas);
+            mgr.ack_data_read(rdm_subscription_id);
+#endif
+            break;
+        case 2:
+            radar_clutter_map_run(&clutter_map, frame);
+            break;
+        case 3:
+            radar_range_fft_run(&range_fft, frame);
+            break;
+        case 4:
+            radar_range_doppler_run(&range_doppler, &range_fft);
+            break;
+        case 5:
+            radar_aoa_run(&aoa, &range_fft);
+            break;
+        case 6:
+            radar_inference_backend_run(radar_inference_backend_get_active(), &input, result);
+            break;
+        case 7:
+            (void)radar_decision_run(bench_decision, result->idx, result->score, gesture_detection_threshold);
+            break;
+        default:
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: radar_run_bench
+********************************************************************************
+* Summary:
+* This function times the processing stages over the canned frames of
+* radar_bench.h, several passes each, with the DWT cycle counter. Every
+* stage runs with interrupts masked, so the cycles are not stretched by
+* interrupts or other tasks. The benchmark needs the frame geometry of the
+* canned frames and the radar stopped, it runs on the frame of the first
+* pipeline slot and the stage states:
+*    - the clutter map background is not updated
+*    - the statistics of the stages and the trajectory are restored
+*    - the active backend is reset
+*    - the decision runs on a copy
+*    - the radar data manager reads the canned frames and is flushed
+* With the acquisition on the CM0+ the copy stage unpacks the samples the
+* CM0+ delivers instead of the radar data manager stage.
+*
+* Parameters:
+*  bench: receives the cycles of the stages
+*
+* Return:
+*  Success, -1 for another frame geometry, -2 while the radar is running
+*
+*******************************************************************************/
+int32_t radar_run_bench(radar_bench_s *bench)
+{
+    static const char *stage_names[] = {
+#ifdef RADAR_ACQ_CM0P
+        "copy",
+#else
+        "rdm",
+#endif
+        "deinterleave", "clutter", "range_fft", "doppler", "aoa", "inference", "decision"
+    };
+    const radar_profile_s *profile = radar_profile_get_active();
+    const radar_inference_backend_s *backend = radar_inference_backend_get_active();
+    const uint32_t num_stages = radar_inference_backend_ready(backend) ? 8U : 6U;
+    radar_bench_stage_s *stages[8];
+    radar_bench_stage_s *total;
+    radar_decision_s bench_decision = decision;
+    radar_inference_result_s result = { 0 };
+    /* the second slot is the acquisition buffer, it holds a float frame */
+    uint8_t *raw = (uint8_t*)pipeline.slots[1].data;
+    radar_dsp_stats_s clutter_stats = clutter_map.stats;
+    radar_dsp_stats_s fft_stats = range_fft.stats;
+    radar_dsp_stats_s doppler_stats[RANGE_DOPPLER_MODE_NUM];
+    radar_dsp_stats_s aoa_stats = aoa.stats;
+    radar_dsp_stats_s backend_stats = *radar_inference_backend_get_stats(backend);
+    radar_aoa_point_s trajectory[RADAR_AOA_TRAJECTORY_LEN];
+    const uint32_t trajectory_pos = aoa.trajectory_pos;
+    const uint32_t hold_frames = clutter_map.hold_frames;
+
+    if ((profile->num_samples_per_chirp != RADAR_BENCH_NUM_SAMPLES_PER_CHIRP) ||
+        (profile->num_chirps_per_frame != RADAR_BENCH_NUM_CHIRPS_PER_FRAME) ||
+        (profile->num_rx_antennas != RADAR_BENCH_NUM_RX_ANTENNAS))
+    {
+        return -1;
+    }
+
+    if (run_state.state == RADAR_RUN_STATE_ACTIVE)
+    {
+        return -2;
+    }
+
+    radar_bench_init(bench);
+    for (uint32_t stage = 0; stage < num_stages; ++stage)
+    {
+        stages[stage] = radar_bench_add_stage(bench, stage_names[stage], profile->num_samples_per_frame);
+    }
+    total = radar_bench_add_stage(bench, "frame", profile->num_samples_per_frame);
+
+    xSemaphoreTake(frame_buffers_mutex, portMAX_DELAY);
+    radar_pipeline_drain(&pipeline);
+
+    memcpy(doppler_stats, range_doppler.stats, sizeof(doppler_stats));
+    memcpy(trajectory, aoa.trajectory, sizeof(trajectory));
+    radar_clutter_map_hold(&clutter_map, RADAR_BENCH_RUNS_MAX + 1U);
+#ifndef RADAR_ACQ_CM0P
+    mgr.in_read_radar_data = bench_read_radar_data;
+#endif
+
+    for (uint32_t pass = 0; pass < RADAR_BENCH_PASSES; ++pass)
+    {
+        for (uint32_t i = 0; i < RADAR_BENCH_FRAMES; ++i)
+        {
+            uint32_t frame_cycles = 0;
+
+            for (uint32_t stage = 0; stage < num_stages; ++stage)
+            {
+                uint32_t cycles;
+
+                taskENTER_CRITICAL();
+                cycles = radar_dsp_cycles();
+                bench_stage(stage, radar_bench_frames[i], &raw, pipeline.slots[0].data, &bench_decision, &result);
+                cycles = radar_dsp_cycles() - cycles;
+                taskEXIT_CRITICAL();
+
+                radar_bench_add_run(stages[stage], cycles);
+                frame_cycles += cycles;
+            }
+            radar_bench_add_run(total, frame_cycles);
+        }
+    }
+
+    clutter_map.hold_frames = hold_frames;
+    clutter_map.stats = clutter_stats;
+    range_fft.stats = fft_stats;
+    memcpy(range_doppler.stats, doppler_stats, sizeof(doppler_stats));
+    aoa.stats = aoa_stats;
+    memcpy(aoa.trajectory, trajectory, sizeof(trajectory));
+    aoa.trajectory_pos = trajectory_pos;
+    radar_inference_backend_reset(backend);
+    *radar_inference_backend_get_stats(backend) = backend_stats;
+#ifndef RADAR_ACQ_CM0P
+    mgr.in_read_radar_data = read_radar_data;
+    flush_frames();
+#endif
+
+    xSemaphoreGive(frame_buffers_mutex);
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: radar_set_run_state
+********************************************************************************
+* Summary:
+* This function moves the application to another run state.
+* Leaving the active state
+*    1. Stops the radar frame generation
+*    2. Waits until the pipeline has processed the frames in flight and parks
+*       the stage tasks
+*    3. Flushes the frames still buffered by the acquisition
+* The suspended state powers the sensor down as well. Entering the active
+* state powers up and configures the sensor if needed, flushes the frames
+* buffered since the stop, resumes the stage tasks and restarts the frame
+* generation. The time from here to the first inference is recorded.
+*
+* Parameters:
+*  state: run state to enter
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+int32_t radar_set_run_state(radar_run_state_e state)
+{
+    if (state >= RADAR_RUN_STATE_NUM)
+    {
+        return -1;
+    }
+
+    if (state == run_state.state)
+    {
+        return 0;
+    }
+
+    if (run_state.state == RADAR_RUN_STATE_ACTIVE)
+    {
+        if (start_frames(false) != 0)
+        {
+            return -2;
+        }
+
+        xSemaphoreTake(frame_buffers_mutex, portMAX_DELAY);
+        radar_pipeline_suspend(&pipeline);
+        run_state.state = state;
+        flush_frames();
+        xSemaphoreGive(frame_buffers_mutex);
+    }
+
+#ifndef RADAR_ACQ_CM0P
+    /* the CM0+ owns the sensor, there the suspended state is a standby */
+    if ((state == RADAR_RUN_STATE_SUSPENDED) && run_state.sensor_powered)
+    {
+        cyhal_gpio_write(PIN_XENSIV_BGT60TRXX_LDO_EN, false);
+        run_state.sensor_powered = false;
+    }
+#endif
+
+    if (state == RADAR_RUN_STATE_ACTIVE)
+    {
+        run_state.resumed_at = radar_dsp_cycles();
+
+#ifndef RADAR_ACQ_CM0P
+        if (!run_state.sensor_powered && (power_up_radar() != 0))
+        {
+            printf("[MSG] ERROR: radar power up failed\n");
+            return -2;
+        }
+#endif
+
+        xSemaphoreTake(frame_buffers_mutex, portMAX_DELAY);
+        flush_frames();
+        run_state.first_inference_pending = true;
+        run_state.state = state;
+        xSemaphoreGive(frame_buffers_mutex);
+
+        radar_pipeline_resume(&pipeline);
+
+        if (start_frames(true) != 0)
+        {
+            run_state.transitions++;
+            return -2;
+        }
+    }
+
+    run_state.state = state;
+    run_state.transitions++;
+
+    if (radar_telemetry_binary(&telemetry) && (state != RADAR_RUN_STATE_SETTINGS))
+    {
+        (void)radar_telemetry_send_trace(&telemetry, RADAR_TELEMETRY_TRACE_RUN_STATE,
+                                         (uint32_t)state, radar_dsp_cycles());
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: start_frames
+********************************************************************************
+* Summary:
+* This function starts or stops the radar frame generation, with the
+* acquisition on the CM0+ by a request carrying the active profile.
+*
+* Parameters:
+*  start: true to start, false to stop the frames
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t start_frames(bool start)
+{
+#ifdef RADAR_ACQ_CM0P
+    return request_acquisition(start ? RADAR_ACQ_IPC_CMD_START : RADAR_ACQ_IPC_CMD_STOP,
+                               radar_profile_get_active());
+#else
+    return (xensiv_bgt60trxx_start_frame(&bgt60_obj.dev, start) == XENSIV_BGT60TRXX_STATUS_OK) ? 0 : -2;
+#endif
+}
+
+
+/*******************************************************************************
+* Function Name: flush_frames
+********************************************************************************
+* Summary:
+* This function discards the frames buffered by the acquisition and the
+* notifications pending for them. The frame buffers mutex must be held.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  none
+*
+*******************************************************************************/
+static void flush_frames(void)
+{
+#ifdef RADAR_ACQ_CM0P
+    while (radar_shm_ring_count(&acq_ring) > 0U)
+    {
+        radar_shm_ring_release(&acq_ring);
+    }
+#else
+    /* the read state is reset as well, a frame read but not acknowledged
+     * before the flush does not block the next one */
+    (void)mgr.discard(0U);
+#endif
+
+    (void)ulTaskNotifyValueClear(main_task_handler, UINT32_MAX);
+}
+
+
+#ifndef RADAR_ACQ_CM0P
+/*******************************************************************************
+* Function Name: fifo_read_cycles
+********************************************************************************
+* Summary:
+* This function returns the cycles of the FIFO read stored behind the packed
+* samples of a frame record of the RDM buffer by read_radar_data().
+*
+* Parameters:
+*  record: frame record read from the RDM buffer
+*
+* Return:
+*  FIFO read cycles of the frame
+*
+*******************************************************************************/
+static uint32_t fifo_read_cycles(const uint8_t *record)
+{
+    uint32_t cycles;
+
+    /* the samples end on any byte, the cycles are not aligned */
+    memcpy(&cycles, record + RADAR_SAMPLE12_BYTES(radar_profile_get_active()->num_samples_per_frame),
+           sizeof(cycles));
+
+    return cycles;
+}
+#endif
+
+
+#ifdef RADAR_ACQ_CM0P
+/*******************************************************************************
+* Function Name: request_acquisition
+********************************************************************************
+* Summary:
+* This function sends a start or stop request to the CM0+ and waits for its
+* completion. A start request carries the register list of the profile and
+* attaches the ring. The request and the register list are shared with the
+* CM0+ and are not changed while a request that timed out is still pending.
+*
+* Parameters:
+*  cmd: request
+*  profile: radar profile the registers are generated for
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t request_acquisition(radar_acq_ipc_cmd_e cmd, const radar_profile_s *profile)
+{
+    /* the CM0+ may still be reading the last request */
+    if (radar_acq_ipc_wait(&acq_request, pdMS_TO_TICKS(ACQ_REQUEST_TIMEOUT_MS)) != 0)
+    {
+        return -2;
+    }
+
+    acq_request.cmd = cmd;
+    acq_request.regs = acq_regs;
+    acq_request.num_regs = radar_profile_generate_registers(profile, acq_regs);
+    acq_request.num_samples_per_frame = profile->num_samples_per_frame;
+    acq_request.ring = &acq_ring;
+
+    return radar_acq_ipc_request(&acq_request, pdMS_TO_TICKS(ACQ_REQUEST_TIMEOUT_MS));
+}
+#else
+/*******************************************************************************
+* Function Name: configure_radar
+********************************************************************************
+* Summary:
+* This function programs the generated register list of a profile into the
+* device, sets the FIFO limit to one frame and resets the FIFO.
+*
+* Parameters:
+*  profile: radar profile the registers are generated for
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t configure_radar(const radar_profile_s *profile)
+{
+    uint32_t regs[XENSIV_BGT60TRXX_CONF_NUM_REGS];
+    uint32_t num_regs = radar_profile_generate_registers(profile, regs);
+
+    if ((xensiv_bgt60trxx_config(&bgt60_obj.dev, regs, num_regs) != XENSIV_BGT60TRXX_STATUS_OK) ||
+        (xensiv_bgt60trxx_set_fifo_limit(&bgt60_obj.dev, profile->num_samples_per_frame*2) != XENSIV_BGT60TRXX_STATUS_OK) ||
+        (xensiv_bgt60trxx_soft_reset(&bgt60_obj.dev, XENSIV_BGT60TRXX_RESET_FIFO) != XENSIV_BGT60TRXX_STATUS_OK))
+    {
+        return -2;
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: power_up_radar
+********************************************************************************
+* Summary:
+* This function powers up the sensor after the suspended state. The device
+* lost its registers, it is reset and configured with the active profile.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t power_up_radar(void)
+{
+    cyhal_gpio_write(PIN_XENSIV_BGT60TRXX_LDO_EN, true);
+
+    /* Wait LDO stable */
+    cyhal_system_delay_us(LDO_SETTLE_US);
+
+    if ((xensiv_bgt60trxx_init(&bgt60_obj.dev, &bgt60_obj.iface, true) != XENSIV_BGT60TRXX_STATUS_OK) ||
+        (configure_radar(radar_profile_get_active()) != 0))
+    {
+        return -2;
+    }
+
+    run_state.sensor_powered = true;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: read_fifo_packed
+********************************************************************************
+* Summary:
+* This function reads samples from the sensor FIFO in one SPI burst without
+* unpacking them. After the burst command addressing the FIFO register the
+* sensor shifts out two 12-bit samples in three bytes.
+*
+* Parameters:
+*  data: RADAR_SAMPLE12_BYTES(num_samples) bytes
+*  num_samples: number of samples
+*
+* Return:
+*  Success or error
+*
+*******************************************************************************/
+static int32_t read_fifo_packed(uint8_t *data, uint32_t num_samples)
+{
+    const uint32_t burst = XENSIV_BGT60TRXX_SPI_BURST_MODE_CMD |
+                           (XENSIV_BGT60TRXX_REG_FIFO_TR13C << XENSIV_BGT60TRXX_SPI_BURST_MODE_SADR_POS);
+    uint8_t cmd[4] = {(uint8_t)(burst >> 24), (uint8_t)(burst >> 16), (uint8_t)(burst >> 8), (uint8_t)burst};
+    int32_t status;
+
+    xensiv_bgt60trxx_platform_spi_cs_set(&bgt60_obj.iface, false);
+
+    status = xensiv_bgt60trxx_platform_spi_transfer(&bgt60_obj.iface, cmd, NULL, sizeof(cmd));
+    if (status == XENSIV_BGT60TRXX_STATUS_OK)
+    {
+        status = xensiv_bgt60trxx_platform_spi_transfer(&bgt60_obj.iface, NULL, data, RADAR_SAMPLE12_BYTES(num_samples));
+    }
+
+    xensiv_bgt60trxx_platform_spi_cs_set(&bgt60_obj.iface, true);
+
+    return (status == XENSIV_BGT60TRXX_STATUS_OK) ? 0 : -2;
+}
 
 /*******************************************************************************
 * Function Name: xensiv_bgt60trxx_interrupt_handler
@@ -545,6 +2591,7 @@ static void xensiv_bgt60trxx_interrupt_handler(void *args, cyhal_gpio_irq_event_
 
     mgr.run(true);
 }
+#endif /* RADAR_ACQ_CM0P */
 
 
 /*******************************************************************************
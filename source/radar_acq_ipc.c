@@ -0,0 +1,129 @@
+/*****************************************************************************
+ * File name: radar_acq_ipc.c
+ *
+ * Description: This file implements the CM4 side of the acquisition on the
+ * CM0+: requests on the command channel and the frame notification interrupt.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include "radar_acq_ipc.h"
+
+#if defined(RADAR_ACQ_CM0P) && defined(COMPONENT_CM4)
+
+static TaskHandle_t notify_task;
+
+/*******************************************************************************
+ * Function Name: notify_interrupt_handler
+ ********************************************************************************
+ * Summary:
+ *   IPC interrupt of the notify channel, wakes up the consumer task
+ *
+ * Parameters:
+ *   none
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void notify_interrupt_handler(void)
+{
+    IPC_INTR_STRUCT_Type *intr = Cy_IPC_Drv_GetIntrBaseAddr(RADAR_ACQ_IPC_NOTIFY_INTR);
+    uint32_t status = Cy_IPC_Drv_GetInterruptStatusMasked(intr);
+    BaseType_t woken = pdFALSE;
+
+    Cy_IPC_Drv_ClearInterrupt(intr, CY_IPC_NO_NOTIFICATION, Cy_IPC_Drv_ExtractAcquireMask(status));
+
+    vTaskNotifyGiveFromISR(notify_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/*
+ * Route the frame notifications of the CM0+ to a task
+ */
+int32_t radar_acq_ipc_init(TaskHandle_t consumer, uint32_t priority)
+{
+    const cy_stc_sysint_t intr_cfg = {
+        .intrSrc = (IRQn_Type)((uint32_t)cpuss_interrupts_ipc_0_IRQn + RADAR_ACQ_IPC_NOTIFY_INTR),
+        .intrPriority = priority
+    };
+
+    notify_task = consumer;
+
+    if (Cy_SysInt_Init(&intr_cfg, notify_interrupt_handler) != CY_SYSINT_SUCCESS)
+    {
+        return -2;
+    }
+
+    Cy_IPC_Drv_SetInterruptMask(Cy_IPC_Drv_GetIntrBaseAddr(RADAR_ACQ_IPC_NOTIFY_INTR),
+                                CY_IPC_NO_NOTIFICATION, 1UL << RADAR_ACQ_IPC_NOTIFY_CHANNEL);
+    NVIC_EnableIRQ(intr_cfg.intrSrc);
+
+    return 0;
+}
+
+/*
+ * Send a request to the CM0+ and wait for its completion
+ */
+int32_t radar_acq_ipc_request(radar_acq_ipc_request_s *request, TickType_t timeout)
+{
+    IPC_STRUCT_Type *channel = Cy_IPC_Drv_GetIpcBaseAddress(RADAR_ACQ_IPC_CMD_CHANNEL);
+    TickType_t start = xTaskGetTickCount();
+
+    request->status = RADAR_ACQ_IPC_STATUS_PENDING;
+
+    /* the CM0+ polls the channel, the lock is released once it took the request */
+    while (Cy_IPC_Drv_SendMsgPtr(channel, CY_IPC_NO_NOTIFICATION, request) != CY_IPC_DRV_SUCCESS)
+    {
+        if ((xTaskGetTickCount() - start) > timeout)
+        {
+            /* never sent, the CM0+ does not know the request */
+            request->status = -2;
+            return -2;
+        }
+        vTaskDelay(1);
+    }
+
+    if (radar_acq_ipc_wait(request, timeout) != 0)
+    {
+        return -2;
+    }
+
+    return (request->status == 0) ? 0 : -2;
+}
+
+/*
+ * Wait until the CM0+ has completed a request
+ */
+int32_t radar_acq_ipc_wait(const radar_acq_ipc_request_s *request, TickType_t timeout)
+{
+    TickType_t start = xTaskGetTickCount();
+
+    while (request->status == RADAR_ACQ_IPC_STATUS_PENDING)
+    {
+        if ((xTaskGetTickCount() - start) > timeout)
+        {
+            return -2;
+        }
+        vTaskDelay(1);
+    }
+
+    return 0;
+}
+
+#endif /* RADAR_ACQ_CM0P && COMPONENT_CM4 */
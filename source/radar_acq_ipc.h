@@ -0,0 +1,132 @@
+/******************************************************************************
+** File name: radar_acq_ipc.h
+**
+** Description: This file contains the definitions shared by the CM0+
+**   acquisition image and the CM4 application when the radar is read out on
+**   the CM0+ (RADAR_ACQ_CM0P). The CM4 sends start and stop requests on the
+**   command channel. The CM0+ reads every frame from the sensor FIFO into the
+**   shared-memory ring and signals it on the notify channel.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_ACQ_IPC_H_
+#define RADAR_ACQ_IPC_H_
+
+#include <stdint.h>
+
+#include "cy_pdl.h"
+
+#include "radar_shm_ring.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/* IPC channel carrying the requests from the CM4 to the CM0+ */
+#define RADAR_ACQ_IPC_CMD_CHANNEL           (CY_IPC_CHAN_USER)
+
+/* IPC channel the CM0+ notifies a published frame on */
+#define RADAR_ACQ_IPC_NOTIFY_CHANNEL        (CY_IPC_CHAN_USER + 1U)
+
+/* IPC interrupt structure routed to the CM4 */
+#define RADAR_ACQ_IPC_NOTIFY_INTR           (CY_IPC_INTR_USER)
+
+/* Frames the ring buffers between the cores, a power of two */
+#define RADAR_ACQ_IPC_RING_SLOTS            (4U)
+
+/* Status of a request the CM0+ has not completed yet */
+#define RADAR_ACQ_IPC_STATUS_PENDING        (1)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_acq_ipc_cmd_e
+ * Acquisition requests
+ */
+typedef enum
+{
+    RADAR_ACQ_IPC_CMD_START = 1,    /*<< configure the sensor, attach the ring and start the frames */
+    RADAR_ACQ_IPC_CMD_STOP = 2,     /*<< stop the frames and detach the ring */
+} radar_acq_ipc_cmd_e;
+
+/*
+ * @typedef typedef struct  radar_acq_ipc_request_s
+ * Request passed by pointer on the command channel. The request, the register
+ * list and the ring must stay valid until the status is no longer pending.
+ */
+typedef struct {
+    radar_acq_ipc_cmd_e cmd;
+    volatile int32_t status;        /*<< RADAR_ACQ_IPC_STATUS_PENDING, then 0 or a negative error */
+
+    const uint32_t *regs;           /*<< register list of the profile, START only */
+    uint32_t num_regs;
+    uint32_t num_samples_per_frame;
+    radar_shm_ring_s *ring;         /*<< receives the raw 16-bit frames, START only */
+} radar_acq_ipc_request_s;
+
+#ifdef RADAR_ACQ_CM0P
+#ifdef COMPONENT_CM4
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+ * Functions (CM4)
+ *******************************************************************************/
+
+/** @brief Route the frame notifications of the CM0+ to a task
+ *
+ * Notifications of frames published in quick succession may coalesce, the
+ * task has to consume every frame waiting in the ring.
+ *
+ * @param[in] consumer task notified for published frames
+ * @param[in] priority interrupt priority of the notification
+ *
+ * @return zero (0) on success, -2 if the interrupt cannot be set up
+ */
+int32_t radar_acq_ipc_init(TaskHandle_t consumer, uint32_t priority);
+
+/** @brief Send a request to the CM0+ and wait for its completion
+ *
+ * After a timeout the CM0+ may still read the request, the caller must not
+ * change it before \ref radar_acq_ipc_wait succeeds.
+ *
+ * @param[in,out] request request in memory the CM0+ can access
+ * @param[in] timeout ticks to wait for the completion
+ *
+ * @return zero (0) on success, -2 if the request failed or timed out
+ */
+int32_t radar_acq_ipc_request(radar_acq_ipc_request_s *request, TickType_t timeout);
+
+/** @brief Wait until the CM0+ has completed a request
+ *
+ * @param[in] request request sent before
+ * @param[in] timeout ticks to wait for the completion
+ *
+ * @return zero (0) once the request is no longer pending, -2 on timeout
+ */
+int32_t radar_acq_ipc_wait(const radar_acq_ipc_request_s *request, TickType_t timeout);
+
+#endif /* COMPONENT_CM4 */
+#endif /* RADAR_ACQ_CM0P */
+
+#endif /* RADAR_ACQ_IPC_H_ */
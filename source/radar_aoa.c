@@ -0,0 +1,230 @@
+/*****************************************************************************
+ * File name: radar_aoa.c
+ *
+ * Description: This file implements the angle-of-arrival stage. Peak search,
+ * conjugation and the phase difference accumulation over the chirps use the
+ * CMSIS-DSP complex vector functions, RADAR_DSP_REFERENCE selects plain
+ * loops for host builds.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "radar_aoa.h"
+
+/*******************************************************************************
+ * Function Name: strongest_bin
+ ********************************************************************************
+ * Summary:
+ *   Finds the range bin with the largest magnitude in a complex spectrum
+ *
+ * Parameters:
+ *   aoa: stage state
+ *   spectrum: complex spectrum
+ *   num_bins: number of bins
+ *   power: squared magnitude of the strongest bin
+ *
+ * Return:
+ *   index of the strongest bin
+ *******************************************************************************/
+static uint32_t strongest_bin(radar_aoa_s *aoa, const float32_t *spectrum, uint32_t num_bins,
+        float32_t *power)
+{
+    uint32_t idx = 0;
+
+#ifdef RADAR_DSP_REFERENCE
+    (void)aoa;
+    *power = -1.0f;
+    for (uint32_t k = 0; k < num_bins; ++k)
+    {
+        float32_t p = (spectrum[2U * k] * spectrum[2U * k]) + (spectrum[(2U * k) + 1U] * spectrum[(2U * k) + 1U]);
+        if (p > *power)
+        {
+            *power = p;
+            idx = k;
+        }
+    }
+#else
+    arm_cmplx_mag_squared_f32(spectrum, aoa->magnitude, num_bins);
+    arm_max_f32(aoa->magnitude, num_bins, power, &idx);
+#endif
+
+    return idx;
+}
+
+/*******************************************************************************
+ * Function Name: correlate
+ ********************************************************************************
+ * Summary:
+ *   Sum over the chirps of x * conj(reference), the phase of the result is
+ *   the phase difference between the antennas
+ *
+ * Parameters:
+ *   aoa: stage state, conj_ref holds the conjugated reference antenna
+ *   x: [chirp] complex values of one antenna
+ *   num_chirps: number of chirps
+ *   re: real part of the sum
+ *   im: imaginary part of the sum
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void correlate(const radar_aoa_s *aoa, const float32_t *x, uint32_t num_chirps,
+        float32_t *re, float32_t *im)
+{
+#ifdef RADAR_DSP_REFERENCE
+    *re = 0.0f;
+    *im = 0.0f;
+    for (uint32_t m = 0; m < num_chirps; ++m)
+    {
+        const float32_t *a = &x[2U * m];
+        const float32_t *b = &aoa->conj_ref[2U * m];
+        *re += (a[0] * b[0]) - (a[1] * b[1]);
+        *im += (a[0] * b[1]) + (a[1] * b[0]);
+    }
+#else
+    arm_cmplx_dot_prod_f32(x, aoa->conj_ref, num_chirps, re, im);
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: phase_to_degrees
+ ********************************************************************************
+ * Summary:
+ *   Converts the phase difference of antennas spaced by half a wavelength to
+ *   the angle of arrival, sin(angle) = phase / pi
+ *
+ * Parameters:
+ *   re: real part of the correlation
+ *   im: imaginary part of the correlation
+ *
+ * Return:
+ *   angle in degrees
+ *******************************************************************************/
+static int8_t phase_to_degrees(float32_t re, float32_t im)
+{
+    float32_t s = atan2f(im, re) / RADAR_DSP_PI;
+
+    s = (s > 1.0f) ? 1.0f : ((s < -1.0f) ? -1.0f : s);
+
+    return (int8_t)lrintf(asinf(s) * (180.0f / RADAR_DSP_PI));
+}
+
+/*
+ * Initialize angle-of-arrival stage
+ */
+int32_t radar_aoa_init(radar_aoa_s *aoa,
+                       uint32_t num_chirps,
+                       uint32_t max_range_bins,
+                       void* (*alloc_func)(size_t size))
+{
+    if ((NULL == aoa) || (NULL == alloc_func) || (0U == num_chirps) || (0U == max_range_bins))
+    {
+        return -1;
+    }
+
+    memset(aoa, 0, sizeof(radar_aoa_s));
+
+    aoa->num_chirps = num_chirps;
+    aoa->max_range_bins = max_range_bins;
+
+    aoa->selected = (float32_t*)alloc_func(2U * num_chirps * RADAR_AOA_NUM_RX_ANTENNAS * sizeof(float32_t));
+    aoa->conj_ref = (float32_t*)alloc_func(2U * num_chirps * sizeof(float32_t));
+    aoa->magnitude = (float32_t*)alloc_func(max_range_bins * sizeof(float32_t));
+
+    if ((NULL == aoa->selected) || (NULL == aoa->conj_ref) || (NULL == aoa->magnitude))
+    {
+        return -2;
+    }
+
+    return 0;
+}
+
+/*
+ * Estimate direction of the strongest target of one frame
+ */
+void radar_aoa_run(radar_aoa_s *aoa, const radar_range_fft_s *fft)
+{
+    const uint32_t chirps = (fft->num_chirps_per_frame < aoa->num_chirps) ? fft->num_chirps_per_frame : aoa->num_chirps;
+    const uint32_t num_bins = (fft->num_gated_bins < aoa->max_range_bins) ? fft->num_gated_bins : aoa->max_range_bins;
+    radar_aoa_point_s *point = &aoa->trajectory[aoa->trajectory_pos];
+    float32_t best_power = 0.0f;
+    uint32_t best_bin = 0;
+    float32_t magnitude_sum = 0.0f;
+    float32_t re;
+    float32_t im;
+    uint32_t cycles;
+
+    aoa->trajectory_pos = (aoa->trajectory_pos + 1U) % RADAR_AOA_TRAJECTORY_LEN;
+    memset(point, 0, sizeof(radar_aoa_point_s));
+
+    if (fft->num_rx_antennas < RADAR_AOA_NUM_RX_ANTENNAS)
+    {
+        return;
+    }
+
+    cycles = radar_dsp_cycles();
+
+    for (uint32_t chirp = 0; chirp < chirps; ++chirp)
+    {
+        float32_t power;
+        uint32_t bin = strongest_bin(aoa, radar_range_fft_get_chirp(fft, RADAR_AOA_REFERENCE_RX, chirp),
+                                     num_bins, &power);
+
+        magnitude_sum += sqrtf(power);
+        if (power > best_power)
+        {
+            best_power = power;
+            best_bin = bin;
+        }
+
+        for (uint32_t antenna = 0; antenna < RADAR_AOA_NUM_RX_ANTENNAS; ++antenna)
+        {
+            const float32_t *spectrum = radar_range_fft_get_chirp(fft, antenna, chirp);
+            float32_t *dst = &aoa->selected[((antenna * chirps) + chirp) * 2U];
+
+            dst[0] = spectrum[2U * bin];
+            dst[1] = spectrum[(2U * bin) + 1U];
+        }
+    }
+
+#ifdef RADAR_DSP_REFERENCE
+    for (uint32_t m = 0; m < chirps; ++m)
+    {
+        aoa->conj_ref[2U * m] = aoa->selected[((RADAR_AOA_REFERENCE_RX * chirps) + m) * 2U];
+        aoa->conj_ref[(2U * m) + 1U] = -aoa->selected[(((RADAR_AOA_REFERENCE_RX * chirps) + m) * 2U) + 1U];
+    }
+#else
+    arm_cmplx_conj_f32(&aoa->selected[RADAR_AOA_REFERENCE_RX * chirps * 2U], aoa->conj_ref, chirps);
+#endif
+
+    correlate(aoa, &aoa->selected[RADAR_AOA_AZIMUTH_RX * chirps * 2U], chirps, &re, &im);
+    point->azimuth_deg = phase_to_degrees(re, im);
+
+    correlate(aoa, &aoa->selected[RADAR_AOA_ELEVATION_RX * chirps * 2U], chirps, &re, &im);
+    point->elevation_deg = phase_to_degrees(re, im);
+
+    point->range_bin = (uint8_t)(fft->first_bin + best_bin);
+    point->magnitude = magnitude_sum / (float32_t)chirps;
+    point->valid = (point->magnitude >= RADAR_AOA_MIN_MAGNITUDE) ? 1U : 0U;
+
+    radar_dsp_stats_add(&aoa->stats, radar_dsp_cycles() - cycles);
+}
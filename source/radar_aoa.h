@@ -0,0 +1,148 @@
+/******************************************************************************
+** File name: radar_aoa.h
+**
+** Description: This file contains the interface of the angle-of-arrival
+**   stage. For every chirp the strongest gated range bin is selected and the
+**   phase differences between the receive antennas are accumulated over the
+**   frame. Azimuth and elevation of each frame are appended to a short
+**   trajectory for directional gestures and gating.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_AOA_H_
+#define RADAR_AOA_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "radar_dsp.h"
+#include "radar_range_fft.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_AOA_TRAJECTORY_LEN
+ * Frames kept in the trajectory, about one second at 33 frames per second
+ */
+#define RADAR_AOA_TRAJECTORY_LEN            (32U)
+
+/*
+ * Antenna pairs of the L-shaped array of the BGT60TR13C with half wavelength
+ * spacing. RX3 is shared, RX1 is beside it and RX2 above it.
+ */
+#define RADAR_AOA_AZIMUTH_RX                (0U)
+#define RADAR_AOA_ELEVATION_RX              (1U)
+#define RADAR_AOA_REFERENCE_RX              (2U)
+#define RADAR_AOA_NUM_RX_ANTENNAS           (3U)
+
+/*
+ * @def RADAR_AOA_MIN_MAGNITUDE
+ * Mean magnitude of the selected bins below which a frame holds no target
+ */
+#define RADAR_AOA_MIN_MAGNITUDE             (200.0f)
+
+/*
+ * @def RADAR_AOA_MEM_SIZE
+ * Bytes the stage allocates: selected bin of every chirp and antenna, the
+ * conjugated reference antenna and the magnitudes of one chirp
+ */
+#define RADAR_AOA_MEM_SIZE(chirps, range_bins) \
+    (((2U * (chirps) * (RADAR_AOA_NUM_RX_ANTENNAS + 1U)) + (range_bins)) * sizeof(float32_t))
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_aoa_point_s
+ * Target direction of one frame
+ */
+typedef struct {
+    int8_t azimuth_deg;         /*<< positive if the phase of RX1 leads RX3 */
+    int8_t elevation_deg;       /*<< positive if the phase of RX2 leads RX3 */
+    uint8_t range_bin;          /*<< range bin of the strongest chirp */
+    uint8_t valid;              /*<< 1 if the frame holds a target above RADAR_AOA_MIN_MAGNITUDE */
+    float32_t magnitude;        /*<< mean magnitude of the selected bins */
+} radar_aoa_point_s;
+
+/*
+ * @typedef typedef struct  radar_aoa_s
+ * Angle-of-arrival stage state
+ */
+typedef struct {
+    uint32_t num_chirps;
+    uint32_t max_range_bins;
+
+    float32_t *selected;        /*<< [antenna][chirp] complex value of the strongest bin */
+    float32_t *conj_ref;        /*<< [chirp] conjugated reference antenna */
+    float32_t *magnitude;       /*<< squared magnitudes of the gated bins of one chirp */
+
+    radar_aoa_point_s trajectory[RADAR_AOA_TRAJECTORY_LEN]; /*<< oldest at trajectory_pos */
+    uint32_t trajectory_pos;
+
+    radar_dsp_stats_s stats;    /*<< cycles per frame */
+} radar_aoa_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize angle-of-arrival stage
+ *
+ * @param[out] aoa stage state
+ * @param[in] num_chirps chirps per frame
+ * @param[in] max_range_bins range bins per chirp with an open range gate
+ * @param[in] alloc_func allocator returning memory aligned to at least 8 bytes
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid, -2 if allocation fails
+ */
+int32_t radar_aoa_init(radar_aoa_s *aoa,
+                       uint32_t num_chirps,
+                       uint32_t max_range_bins,
+                       void* (*alloc_func)(size_t size));
+
+/** @brief Estimate direction of the strongest target of one frame
+ *
+ * Frames with less than three antennas append an invalid point.
+ *
+ * @param[in,out] aoa stage state
+ * @param[in] fft range FFT stage holding the spectra of the frame
+ */
+void radar_aoa_run(radar_aoa_s *aoa, const radar_range_fft_s *fft);
+
+/** @brief Get trajectory point
+ *
+ * @param[in] aoa stage state
+ * @param[in] age frames before the latest one, 0 is the latest frame,
+ *            less than \ref RADAR_AOA_TRAJECTORY_LEN
+ *
+ * @return trajectory point
+ */
+static inline const radar_aoa_point_s* radar_aoa_get_point(const radar_aoa_s *aoa, uint32_t age)
+{
+    uint32_t idx = (aoa->trajectory_pos + (2U * RADAR_AOA_TRAJECTORY_LEN) - 1U - age) % RADAR_AOA_TRAJECTORY_LEN;
+
+    return &aoa->trajectory[idx];
+}
+
+#endif /* RADAR_AOA_H_ */
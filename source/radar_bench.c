@@ -0,0 +1,100 @@
+/*****************************************************************************
+ * File name: radar_bench.c
+ *
+ * Description: This file implements the bookkeeping of the stage benchmark:
+ * the cycles of the runs of every stage and their summary.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <string.h>
+
+#include "radar_bench.h"
+
+/*
+ * Initialize the benchmark without stages
+ */
+void radar_bench_init(radar_bench_s *bench)
+{
+    bench->num_stages = 0;
+}
+
+/*
+ * Add a stage
+ */
+radar_bench_stage_s* radar_bench_add_stage(radar_bench_s *bench, const char *name, uint32_t samples)
+{
+    radar_bench_stage_s *stage;
+
+    if (bench->num_stages >= RADAR_BENCH_STAGES_MAX)
+    {
+        return NULL;
+    }
+
+    stage = &bench->stages[bench->num_stages++];
+    stage->name = name;
+    stage->samples = samples;
+    stage->runs = 0;
+
+    return stage;
+}
+
+/*
+ * Keep the cycles of a run
+ */
+void radar_bench_add_run(radar_bench_stage_s *stage, uint32_t cycles)
+{
+    if (stage->runs < RADAR_BENCH_RUNS_MAX)
+    {
+        stage->cycles[stage->runs++] = cycles;
+    }
+}
+
+/*
+ * Summarize the runs of a stage
+ */
+void radar_bench_summarize(const radar_bench_stage_s *stage, radar_bench_summary_s *summary)
+{
+    uint32_t sorted[RADAR_BENCH_RUNS_MAX];
+
+    (void)memset(summary, 0, sizeof(*summary));
+
+    if (stage->runs == 0U)
+    {
+        return;
+    }
+
+    /* insertion sort, the runs are few */
+    for (uint32_t i = 0; i < stage->runs; ++i)
+    {
+        uint32_t j = i;
+
+        while ((j > 0U) && (sorted[j - 1U] > stage->cycles[i]))
+        {
+            sorted[j] = sorted[j - 1U];
+            j--;
+        }
+        sorted[j] = stage->cycles[i];
+    }
+
+    summary->min = sorted[0];
+    summary->median = sorted[stage->runs / 2U];
+    summary->max = sorted[stage->runs - 1U];
+    summary->per_sample = (stage->samples > 0U) ? ((float32_t)summary->median / (float32_t)stage->samples) : 0.0f;
+}
@@ -0,0 +1,172 @@
+/******************************************************************************
+** File name: radar_bench.h
+**
+** Description: This file contains the interface of the stage benchmark.
+**   The benchmark runs the processing stages over canned frames kept in
+**   flash instead of frames of the sensor, so the cycles of every stage can
+**   be compared between builds and boards without a radar attached. The
+**   cycles of every run are kept, a stage reports minimum, median and
+**   maximum cycles and cycles per sample. The canned frames are generated
+**   by tools/radar_bench_frames.c into radar_bench_frames.c.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_BENCH_H_
+#define RADAR_BENCH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "radar_dsp.h"
+#include "radar_sample12.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_BENCH_FRAMES
+ * Canned frames in flash
+ */
+#define RADAR_BENCH_FRAMES                  (4U)
+
+/*
+ * @def RADAR_BENCH_NUM_SAMPLES_PER_CHIRP
+ * Samples per chirp of the canned frames
+ */
+#define RADAR_BENCH_NUM_SAMPLES_PER_CHIRP   (64U)
+
+/*
+ * @def RADAR_BENCH_NUM_CHIRPS_PER_FRAME
+ * Chirps per frame of the canned frames
+ */
+#define RADAR_BENCH_NUM_CHIRPS_PER_FRAME    (32U)
+
+/*
+ * @def RADAR_BENCH_NUM_RX_ANTENNAS
+ * Antennas of the canned frames
+ */
+#define RADAR_BENCH_NUM_RX_ANTENNAS         (3U)
+
+/*
+ * @def RADAR_BENCH_FRAME_BYTES
+ * Bytes of a canned frame in the packed 12-bit format of the FIFO
+ */
+#define RADAR_BENCH_FRAME_BYTES \
+    RADAR_SAMPLE12_BYTES(RADAR_BENCH_NUM_SAMPLES_PER_CHIRP * RADAR_BENCH_NUM_CHIRPS_PER_FRAME *\
+                         RADAR_BENCH_NUM_RX_ANTENNAS)
+
+/*
+ * @def RADAR_BENCH_PASSES
+ * Passes over the canned frames
+ */
+#define RADAR_BENCH_PASSES                  (8U)
+
+/*
+ * @def RADAR_BENCH_RUNS_MAX
+ * Runs of a stage kept for the median
+ */
+#define RADAR_BENCH_RUNS_MAX                (RADAR_BENCH_FRAMES * RADAR_BENCH_PASSES)
+
+/*
+ * @def RADAR_BENCH_STAGES_MAX
+ * Stages of a benchmark
+ */
+#define RADAR_BENCH_STAGES_MAX              (12U)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_bench_stage_s
+ * Cycles of the runs of a stage
+ */
+typedef struct {
+    const char *name;
+    uint32_t samples;                   /*<< samples of a frame, for the cycles per sample */
+    uint32_t runs;
+    uint32_t cycles[RADAR_BENCH_RUNS_MAX];
+} radar_bench_stage_s;
+
+/*
+ * @typedef typedef struct  radar_bench_s
+ * Benchmark of the stages
+ */
+typedef struct {
+    uint32_t num_stages;
+    radar_bench_stage_s stages[RADAR_BENCH_STAGES_MAX];
+} radar_bench_s;
+
+/*
+ * @typedef typedef struct  radar_bench_summary_s
+ * Summary of the runs of a stage
+ */
+typedef struct {
+    uint32_t min;
+    uint32_t median;
+    uint32_t max;
+    float32_t per_sample;               /*<< median cycles per sample */
+} radar_bench_summary_s;
+
+/*******************************************************************************
+ * Variables
+ *******************************************************************************/
+
+/* Frames generated by tools/radar_bench_frames.c */
+extern const uint8_t radar_bench_frames[RADAR_BENCH_FRAMES][RADAR_BENCH_FRAME_BYTES];
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the benchmark without stages
+ *
+ * @param[out] bench benchmark
+ */
+void radar_bench_init(radar_bench_s *bench);
+
+/** @brief Add a stage
+ *
+ * @param[in,out] bench benchmark
+ * @param[in] name stage name, kept by reference
+ * @param[in] samples samples of a frame
+ *
+ * @return stage or NULL if the benchmark has RADAR_BENCH_STAGES_MAX stages
+ */
+radar_bench_stage_s* radar_bench_add_stage(radar_bench_s *bench, const char *name, uint32_t samples);
+
+/** @brief Keep the cycles of a run
+ *
+ * Runs beyond RADAR_BENCH_RUNS_MAX are not kept.
+ *
+ * @param[in,out] stage stage
+ * @param[in] cycles cycles of the run
+ */
+void radar_bench_add_run(radar_bench_stage_s *stage, uint32_t cycles);
+
+/** @brief Summarize the runs of a stage
+ *
+ * @param[in] stage stage
+ * @param[out] summary minimum, median and maximum cycles, all 0 without runs
+ */
+void radar_bench_summarize(const radar_bench_stage_s *stage, radar_bench_summary_s *summary);
+
+#endif /* RADAR_BENCH_H_ */
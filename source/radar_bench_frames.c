@@ -0,0 +1,2345 @@
+/*****************************************************************************
+ * File name: radar_bench_frames.c
+ *
+ * Description: This file contains the canned frames of the stage benchmark
+ * of radar_bench.h. It is generated by tools/radar_bench_frames.c, do not
+ * edit.
+ *
+ * Frames 41 to 44 of push, seed 1.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include "radar_bench.h"
+
+const uint8_t radar_bench_frames[RADAR_BENCH_FRAMES][RADAR_BENCH_FRAME_BYTES] =
+{
+    {
+        0x57, 0x65, 0x7f, 0x57, 0xc6, 0x3d, 0x65, 0xa6, 0x15, 0x74, 0x87, 0x40, 0x74, 0x58, 0x97, 0x83,
+        0x48, 0x74, 0x92, 0x99, 0x39, 0x93, 0x68, 0xf1, 0x92, 0xb8, 0xea, 0x89, 0x08, 0xb3, 0x8a, 0xe7,
+        0xc0, 0x78, 0xb7, 0xcd, 0x71, 0x67, 0x26, 0x72, 0x66, 0x37, 0x67, 0xb6, 0x43, 0x6a, 0x96, 0x99,
+        0x6a, 0x17, 0x66, 0x71, 0x47, 0x57, 0x8a, 0x48, 0x82, 0x87, 0xc9, 0x64, 0x9a, 0x49, 0x5e, 0xa4,
+        0xaa, 0x31, 0xa3, 0x8a, 0x9d, 0xa7, 0x3a, 0xaf, 0xa1, 0x5a, 0x19, 0xa1, 0xe9, 0x1a, 0x97, 0xe9,
+        0x37, 0x81, 0xa8, 0x1e, 0x82, 0x37, 0xd9, 0x7a, 0x87, 0xe6, 0x78, 0x37, 0x80, 0x78, 0x38, 0x19,
+        0x84, 0x88, 0x05, 0x8e, 0x38, 0xcf, 0x8d, 0x4a, 0x53, 0x9f, 0x8a, 0x32, 0xac, 0xea, 0xd0, 0xac,
+        0xfa, 0xe8, 0xb2, 0x2a, 0xdf, 0xa6, 0x0a, 0x7e, 0xa8, 0xe9, 0xb9, 0x97, 0xf9, 0xbc, 0x89, 0x88,
+        0xbe, 0x8b, 0xb7, 0x74, 0x7b, 0x77, 0x75, 0x75, 0x37, 0x4f, 0x75, 0x97, 0x99, 0x74, 0xe7, 0x8b,
+        0x88, 0x18, 0x7b, 0x87, 0x39, 0x05, 0x92, 0xe8, 0xf1, 0x9f, 0xf9, 0xeb, 0x9e, 0xba, 0x2b, 0x9f,
+        0x5a, 0x38, 0x9e, 0x59, 0xe1, 0x9d, 0xf8, 0x8f, 0x8e, 0xf8, 0xb4, 0x79, 0x37, 0x92, 0x79, 0x56,
+        0xae, 0x69, 0x26, 0xd2, 0x62, 0x16, 0x1b, 0x61, 0x36, 0x12, 0x65, 0xa6, 0x18, 0x6a, 0x96, 0x8f,
+        0x69, 0x27, 0xf0, 0x79, 0xd7, 0xd9, 0x87, 0x78, 0x6b, 0x86, 0x18, 0xcd, 0x91, 0x08, 0xce, 0x86,
+        0x48, 0x6d, 0x87, 0x27, 0xfb, 0x7c, 0xc8, 0x09, 0x6a, 0x36, 0xce, 0x6c, 0x65, 0x9b, 0x5d, 0xd5,
+        0x9b, 0x4f, 0x45, 0x0c, 0x51, 0x05, 0x4e, 0x4f, 0x75, 0x34, 0x5d, 0xf5, 0xe0, 0x5d, 0xd6, 0x9a,
+        0x6b, 0xb6, 0x7c, 0x7c, 0x17, 0xb0, 0x7b, 0x18, 0x64, 0x81, 0x28, 0x58, 0x88, 0x58, 0x94, 0x88,
+        0xa7, 0x89, 0x7d, 0x97, 0x9a, 0x6e, 0x76, 0xf0, 0x6f, 0x55, 0xf7, 0x5d, 0x36, 0x12, 0x58, 0x85,
+        0x8b, 0x58, 0x55, 0x3c, 0x58, 0x55, 0x47, 0x61, 0x65, 0xf0, 0x5f, 0x57, 0x4d, 0x70, 0x47, 0x3c,
+        0x54, 0x95, 0x5d, 0x55, 0xc5, 0x7a, 0x5a, 0x85, 0x68, 0x64, 0x96, 0x42, 0x64, 0x87, 0xa7, 0x74,
+        0x07, 0x81, 0x8a, 0x98, 0xb2, 0x8a, 0xf9, 0x09, 0x93, 0x88, 0xfc, 0x94, 0x09, 0x50, 0x95, 0x58,
+        0xbe, 0x88, 0xe8, 0xc8, 0x80, 0x58, 0x26, 0x82, 0x56, 0xc6, 0x71, 0xa6, 0xe2, 0x69, 0xb6, 0x9f,
+        0x6a, 0x06, 0xc6, 0x68, 0xa6, 0xc9, 0x7a, 0x67, 0x89, 0x78, 0x58, 0x63, 0x89, 0xe8, 0x5d, 0x9a,
+        0xa9, 0x88, 0x98, 0x9a, 0x92, 0xa5, 0x9a, 0x9c, 0xaa, 0x8a, 0xa0, 0xa9, 0xfa, 0x0e, 0xa6, 0xca,
+        0x2a, 0x91, 0x89, 0x29, 0x92, 0x88, 0x8d, 0x86, 0x68, 0x9f, 0x7a, 0x37, 0xb3, 0x7a, 0xf7, 0x96,
+        0x7d, 0x07, 0x8f, 0x7e, 0xf7, 0xe4, 0x7e, 0x69, 0x4c, 0x8e, 0x79, 0x2a, 0xa1, 0x3a, 0x0b, 0xa0,
+        0x7a, 0xc6, 0xae, 0x0a, 0xa1, 0xad, 0xea, 0xe9, 0xae, 0xfa, 0xa0, 0xa6, 0x5a, 0xa0, 0x9a, 0x39,
+        0xca, 0x9c, 0x58, 0x47, 0x88, 0xf8, 0x4b, 0x78, 0xe7, 0xa4, 0x7a, 0x57, 0x3c, 0x6f, 0xa7, 0x3b,
+        0x7a, 0x27, 0x9f, 0x79, 0xa7, 0xf8, 0x81, 0xd7, 0xe4, 0x92, 0x79, 0x07, 0x90, 0x49, 0xd7, 0x99,
+        0x39, 0xd2, 0xa3, 0x2a, 0x24, 0xa1, 0xf9, 0x68, 0x9c, 0x29, 0x81, 0x8a, 0x08, 0xa6, 0x8a, 0xb7,
+        0x98, 0x78, 0x07, 0xc3, 0x68, 0x86, 0x8e, 0x68, 0x85, 0xda, 0x62, 0x85, 0xef, 0x5e, 0x05, 0xca,
+        0x5c, 0xc6, 0xde, 0x69, 0x56, 0xd0, 0x78, 0x97, 0x74, 0x76, 0xb8, 0x5a, 0x88, 0x28, 0x42, 0x88,
+        0xf8, 0x8c, 0x88, 0xc8, 0xbf, 0x87, 0xd8, 0xbe, 0x7a, 0xf7, 0xd5, 0x7d, 0x06, 0x98, 0x6d, 0xc6,
+        0x9e, 0x58, 0x15, 0x9c, 0x5a, 0x75, 0x38, 0x4e, 0x85, 0x27, 0x53, 0x25, 0x3c, 0x53, 0x35, 0x95,
+        0x5b, 0x55, 0x72, 0x6b, 0xc6, 0xac, 0x6b, 0x37, 0xc5, 0x76, 0x97, 0xa9, 0x88, 0xb8, 0x86, 0x88,
+        0x58, 0x2c, 0x87, 0x48, 0x2f, 0x7f, 0x27, 0xf5, 0x7f, 0xc7, 0x01, 0x6e, 0x07, 0x1e, 0x63, 0xb6,
+        0x42, 0x64, 0x05, 0x4d, 0x5a, 0x65, 0x63, 0x58, 0x35, 0x65, 0x57, 0x26, 0x49, 0x60, 0x86, 0x4b,
+        0x5b, 0x65, 0xda, 0x5d, 0x55, 0x54, 0x58, 0xb5, 0x4e, 0x58, 0xc5, 0x93, 0x59, 0x96, 0xa5, 0x63,
+        0xd6, 0x85, 0x7c, 0x17, 0xbb, 0x7b, 0x48, 0x86, 0x8a, 0xf8, 0x6c, 0x95, 0xa9, 0x5f, 0x96, 0x29,
+        0x70, 0x92, 0xf9, 0x6e, 0x90, 0xc9, 0x1f, 0x92, 0x07, 0xb8, 0x81, 0xd7, 0xdb, 0x73, 0x17, 0x3f,
+        0x73, 0xe6, 0xc2, 0x68, 0xe6, 0xca, 0x70, 0x86, 0xf7, 0x6f, 0x47, 0x6b, 0x7a, 0x97, 0x6b, 0x8a,
+        0xc8, 0x80, 0x88, 0x29, 0xeb, 0x9a, 0xd9, 0xeb, 0xa9, 0x9a, 0x87, 0xa8, 0x6a, 0x9c, 0xaf, 0x2a,
+        0xae, 0xa1, 0x2a, 0x17, 0xa1, 0xa9, 0x8b, 0x96, 0x79, 0xa6, 0x85, 0x88, 0x6c, 0x86, 0xc7, 0xbc,
+        0x80, 0x27, 0xba, 0x76, 0xc7, 0x6e, 0x76, 0xf8, 0x5b, 0x80, 0x38, 0x3a, 0x90, 0x98, 0xfe, 0x8f,
+        0x99, 0xf9, 0xa1, 0x89, 0xdc, 0xaa, 0xaa, 0xa3, 0xaa, 0xfb, 0x12, 0xac, 0x1b, 0x04, 0xa8, 0xaa,
+        0xa8, 0xaa, 0x99, 0x52, 0x99, 0xb9, 0x60, 0x86, 0x58, 0x7e, 0x87, 0xe7, 0x81, 0x74, 0xa7, 0x8a,
+        0x74, 0x57, 0x4a, 0x74, 0x67, 0x10, 0x74, 0xe7, 0x0f, 0x81, 0x67, 0xf9, 0x7f, 0xc9, 0x00, 0x8a,
+        0xf8, 0xe8, 0x9d, 0xb9, 0xb8, 0x9b, 0xc9, 0xb2, 0x9f, 0xf9, 0xc1, 0x97, 0x69, 0x70, 0x97, 0x28,
+        0xa6, 0x89, 0x38, 0xcd, 0x77, 0x47, 0x76, 0x77, 0xf6, 0x4b, 0x69, 0xc6, 0x68, 0x5a, 0x85, 0x9f,
+        0x5a, 0x06, 0x1c, 0x5c, 0xf6, 0x10, 0x66, 0xd6, 0x60, 0x65, 0xe7, 0x6a, 0x78, 0xd7, 0x4d, 0x80,
+        0xa7, 0xfb, 0x80, 0x38, 0xe4, 0x89, 0x68, 0xd2, 0x86, 0x88, 0x86, 0x88, 0x57, 0xa2, 0x7e, 0x87,
+        0xa5, 0x67, 0xf6, 0xa6, 0x6a, 0xc5, 0xc9, 0x58, 0x65, 0xca, 0x51, 0xd5, 0x38, 0x53, 0x84, 0xe4,
+        0x50, 0xe4, 0xce, 0x5b, 0x55, 0xa9, 0x5a, 0x86, 0xc2, 0x66, 0x36, 0x9e, 0x7e, 0xc7, 0xda, 0x7d,
+        0x48, 0x29, 0x85, 0xf8, 0x1f, 0x88, 0xc8, 0x80, 0x88, 0x48, 0x06, 0x7d, 0xe8, 0x1e, 0x74, 0xc7,
+        0x5f, 0x75, 0x06, 0x01, 0x66, 0x36, 0x21, 0x59, 0x95, 0x8d, 0x59, 0x45, 0xba, 0x58, 0xb5, 0xc2,
+        0x69, 0xf6, 0xbf, 0x6c, 0x85, 0xbd, 0x60, 0x15, 0xbf, 0x55, 0xc5, 0x73, 0x56, 0xe5, 0xe7, 0x59,
+        0x15, 0xca, 0x6b, 0xe6, 0xb4, 0x6b, 0xa7, 0x9f, 0x7b, 0xd7, 0x77, 0x8d, 0xa8, 0xd2, 0x8d, 0x59,
+        0x84, 0x94, 0x39, 0x7d, 0x9b, 0xe9, 0xc7, 0x9c, 0x28, 0xbc, 0x91, 0xd8, 0xd3, 0x82, 0xa8, 0x37,
+        0x83, 0xf7, 0x48, 0x72, 0xe7, 0x67, 0x70, 0x36, 0xfa, 0x6f, 0xe6, 0xca, 0x71, 0x56, 0xd7, 0x7a,
+        0xd7, 0x8c, 0x78, 0xf8, 0xeb, 0x8a, 0x78, 0xe7, 0x9f, 0x79, 0xd4, 0x9d, 0x5a, 0x94, 0xac, 0xfa,
+        0x99, 0xaa, 0x2a, 0x9c, 0xaa, 0x0a, 0x87, 0xa5, 0xda, 0x9e, 0x95, 0xf9, 0x73, 0x97, 0x58, 0x6b,
+        0x8b, 0xe8, 0x7e, 0x78, 0xf7, 0x9b, 0x7a, 0x57, 0xde, 0x79, 0x07, 0xd0, 0x81, 0xb8, 0x1a, 0x81,
+        0x28, 0xee, 0x90, 0xd8, 0xd0, 0x9e, 0x79, 0xd6, 0x9d, 0x8a, 0xda, 0xa7, 0xda, 0xbb, 0xaf, 0x9b,
+        0x0d, 0xb0, 0x9a, 0x35, 0xa7, 0xda, 0x3b, 0x97, 0x19, 0x8d, 0x98, 0xe8, 0x58, 0x82, 0x68, 0x63,
+        0x79, 0x37, 0xa2, 0x7a, 0x26, 0xbe, 0x6f, 0xe6, 0xbe, 0x73, 0xc7, 0x25, 0x72, 0x67, 0xea, 0x7a,
+        0x27, 0xde, 0x8f, 0xa8, 0xd8, 0x8d, 0x19, 0x54, 0x99, 0x39, 0x53, 0x9b, 0x69, 0xab, 0x9b, 0x09,
+        0x7e, 0x95, 0x39, 0x94, 0x87, 0xf8, 0x8c, 0x88, 0xa7, 0x34, 0x79, 0x47, 0x59, 0x61, 0xa6, 0x1b,
+        0x62, 0x05, 0xe8, 0x5a, 0xf5, 0xf2, 0x5b, 0x35, 0xa7, 0x5a, 0x96, 0x58, 0x67, 0xe6, 0x3d, 0x71,
+        0x47, 0x00, 0x70, 0x38, 0x5e, 0x7f, 0xe8, 0x42, 0x88, 0x98, 0x91, 0x89, 0x08, 0x5e, 0x88, 0xe8,
+        0x50, 0x79, 0x37, 0xb1, 0x7b, 0x36, 0xca, 0x68, 0xc6, 0xce, 0x5b, 0x85, 0xdc, 0x5d, 0xe4, 0xe3,
+        0x51, 0x34, 0xd7, 0x51, 0x45, 0x0f, 0x51, 0x85, 0xb8, 0x56, 0x15, 0xa0, 0x6d, 0x46, 0xc8, 0x6c,
+        0xa7, 0x78, 0x7a, 0xa7, 0x68, 0x87, 0xa8, 0x65, 0x86, 0xf8, 0x9b, 0x86, 0xc8, 0xaf, 0x84, 0xf8,
+        0x53, 0x84, 0xd7, 0x13, 0x77, 0x57, 0x34, 0x65, 0x96, 0x55, 0x65, 0xf5, 0xdc, 0x5b, 0xb5, 0xf7,
+        0x79, 0xe7, 0xc4, 0x7c, 0x56, 0x9f, 0x6e, 0xa6, 0xa8, 0x5c, 0xa5, 0xe9, 0x5e, 0xb5, 0xb5, 0x56,
+        0xf5, 0xaa, 0x5f, 0xe6, 0x06, 0x60, 0x16, 0x98, 0x6b, 0x66, 0x74, 0x7e, 0xc7, 0xd7, 0x7e, 0x09,
+        0x08, 0x8b, 0x08, 0xeb, 0x9d, 0x09, 0xd5, 0x9c, 0xf9, 0x70, 0x9b, 0xd9, 0x72, 0x92, 0x89, 0x39,
+        0x93, 0x68, 0x46, 0x82, 0xd8, 0x6d, 0x79, 0x37, 0xa0, 0x79, 0xf6, 0xc5, 0x71, 0x86, 0xe0, 0x70,
+        0xf6, 0xf9, 0x6f, 0x97, 0xf2, 0x7b, 0x37, 0xeb, 0x8f, 0x68, 0xd5, 0x8d, 0x59, 0xeb, 0xa2, 0x39,
+        0xdf, 0xa9, 0x7a, 0x7e, 0xa8, 0x6b, 0x0f, 0xad, 0xfb, 0x21, 0xa5, 0x2a, 0x6c, 0xa6, 0xa9, 0x74,
+        0x9c, 0x49, 0x86, 0x84, 0x28, 0x5f, 0x86, 0x47, 0xfe, 0x7b, 0xe8, 0x00, 0x79, 0xa7, 0xac, 0x7a,
+        0x07, 0xff, 0x81, 0xb7, 0xe4, 0x8d, 0x88, 0xca, 0x8d, 0x1a, 0x15, 0x9b, 0x19, 0xf1, 0xab, 0x8a,
+        0xc1, 0xab, 0xea, 0xa3, 0xad, 0x9a, 0x95, 0xa5, 0x3a, 0x68, 0xa6, 0xd9, 0x63, 0x93, 0x89, 0x77,
+        0x86, 0x68, 0x88, 0x87, 0xc7, 0x0b, 0x75, 0xf7, 0x1b, 0x6e, 0x76, 0xd7, 0x6e, 0x07, 0x0f, 0x6c,
+        0x97, 0x10, 0x7e, 0x77, 0xc5, 0x7b, 0xd8, 0x6b, 0x8a, 0x98, 0x64, 0x95, 0x99, 0x2f, 0x93, 0x29,
+        0xc0, 0x98, 0xa9, 0xc7, 0x94, 0xd9, 0x50, 0x94, 0x98, 0x43, 0x8a, 0x28, 0x65, 0x70, 0xc7, 0x16,
+        0x72, 0x16, 0x5d, 0x62, 0xf6, 0x7b, 0x58, 0x25, 0x8b, 0x58, 0x75, 0x98, 0x5c, 0x75, 0x89, 0x60,
+        0x85, 0xf2, 0x5f, 0xa7, 0x68, 0x70, 0x07, 0x3e, 0x80, 0x37, 0xfd, 0x7f, 0x48, 0x70, 0x89, 0xb8,
+        0x59, 0x84, 0x18, 0x59, 0x85, 0xb7, 0xd5, 0x79, 0x57, 0xd6, 0x6b, 0x96, 0xe8, 0x6e, 0x45, 0x81,
+        0x5c, 0x55, 0x84, 0x50, 0x85, 0x1e, 0x51, 0xe5, 0x13, 0x4c, 0xb5, 0x09, 0x5d, 0x75, 0xcc, 0x5c,
+        0x76, 0x73, 0x69, 0xa6, 0x5a, 0x7c, 0x97, 0xae, 0x7b, 0x58, 0x82, 0x84, 0x38, 0x83, 0x8d, 0x98,
+        0xd2, 0x8c, 0xc8, 0x12, 0x86, 0xf8, 0x2c, 0x76, 0xa7, 0x6c, 0x77, 0x36, 0xa3, 0x68, 0x76, 0xc1,
+        0x86, 0xf8, 0x88, 0x88, 0x47, 0xa7, 0x7f, 0x27, 0xb2, 0x6b, 0x66, 0xd8, 0x6d, 0x46, 0x20, 0x5e,
+        0x66, 0x25, 0x5c, 0xd5, 0xe5, 0x5d, 0xd5, 0xda, 0x60, 0x55, 0xc1, 0x6e, 0x46, 0xd7, 0x6d, 0x98,
+        0x1a, 0x7b, 0xe7, 0xfc, 0x95, 0x29, 0x44, 0x94, 0x29, 0x8d, 0x9c, 0x49, 0x93, 0x9d, 0xb9, 0xdb,
+        0x9d, 0xe9, 0x4a, 0x92, 0x59, 0x63, 0x88, 0xd8, 0x97, 0x89, 0xb7, 0x5c, 0x7b, 0xc7, 0x77, 0x70,
+        0xc6, 0xfc, 0x70, 0x07, 0x53, 0x71, 0xa7, 0x59, 0x7f, 0x97, 0xdd, 0x7d, 0x28, 0xf0, 0x91, 0xf8,
+        0xe0, 0x9f, 0x39, 0xcd, 0x9d, 0x1b, 0x06, 0xac, 0x1b, 0x03, 0xad, 0xea, 0xe4, 0xae, 0x6a, 0x6b,
+        0xab, 0xba, 0x77, 0x94, 0xd9, 0x6b, 0x96, 0xf8, 0xb5, 0x88, 0x38, 0xbe, 0x7b, 0xf7, 0xdc, 0x7d,
+        0xa7, 0x8b, 0x7b, 0x47, 0x78, 0x7e, 0x97, 0xe5, 0x7e, 0xb9, 0x0a, 0x8a, 0x38, 0xde, 0x9f, 0x49,
+        0xf1, 0x9e, 0xea, 0x6a, 0xa8, 0xca, 0x58, 0xab, 0x8a, 0xc5, 0xac, 0x5a, 0x47, 0xa1, 0x0a, 0x56,
+        0x97, 0x89, 0x95, 0x98, 0xe7, 0xe3, 0x83, 0xc8, 0x00, 0x73, 0x77, 0x3c, 0x73, 0xc6, 0xbc, 0x68,
+        0xc6, 0xca, 0x70, 0xe6, 0xf8, 0x6f, 0x77, 0x5d, 0x79, 0xa7, 0x56, 0x87, 0x98, 0x4a, 0x84, 0xc9,
+        0x54, 0x91, 0x89, 0x57, 0x98, 0xc9, 0x73, 0x97, 0xd9, 0x11, 0x96, 0x59, 0x27, 0x81, 0xc8, 0x28,
+        0x82, 0x97, 0x4e, 0x72, 0xd7, 0x6a, 0x60, 0x26, 0x15, 0x60, 0xf5, 0x6d, 0x5b, 0x05, 0x70, 0x54,
+        0x75, 0x40, 0x54, 0x46, 0x50, 0x5f, 0x76, 0x33, 0x6f, 0xf6, 0xfa, 0x6f, 0x07, 0xd9, 0x7f, 0xe7,
+        0xbe, 0x85, 0x28, 0x56, 0x85, 0xa8, 0x80, 0x83, 0x68, 0x72, 0x7c, 0x87, 0xeb, 0x7e, 0x86, 0x82,
+        0x6c, 0xd6, 0x90, 0x5a, 0xe5, 0xc8, 0x5c, 0xe5, 0x20, 0x4e, 0x45, 0x24, 0x54, 0x15, 0x42, 0x53,
+        0xc5, 0x6d, 0x59, 0xc5, 0x5f, 0x6b, 0x56, 0x99, 0x69, 0xa7, 0xcd, 0x78, 0x47, 0xbd, 0x8b, 0xb8,
+        0xa3, 0x89, 0xf8, 0x93, 0x8e, 0x88, 0xa5, 0x85, 0xe8, 0x5f, 0x86, 0x87, 0xb7, 0x79, 0x87, 0xdf,
+        0x8b, 0x78, 0xc1, 0x8c, 0x08, 0x73, 0x8a, 0xf8, 0x79, 0x7b, 0x37, 0xd7, 0x7d, 0xc7, 0x05, 0x6c,
+        0xf7, 0x10, 0x63, 0x76, 0x52, 0x65, 0x95, 0xa4, 0x5d, 0x95, 0x9a, 0x62, 0x86, 0x25, 0x62, 0xc7,
+        0x16, 0x6b, 0x76, 0xfa, 0x86, 0x38, 0x56, 0x85, 0x09, 0x0b, 0x93, 0x78, 0xfa, 0x9f, 0x59, 0xe6,
+        0x9e, 0x49, 0xfa, 0x9c, 0xda, 0x0d, 0x98, 0xc9, 0x99, 0x99, 0x68, 0x4f, 0x8b, 0x68, 0x78, 0x79,
+        0xd7, 0xa4, 0x7a, 0x57, 0x4c, 0x72, 0xb7, 0x63, 0x75, 0x77, 0x46, 0x74, 0x67, 0xe8, 0x82, 0x67,
+        0xe7, 0x8e, 0x98, 0xbf, 0x8c, 0xda, 0x5e, 0xa1, 0x0a, 0x4c, 0xac, 0xfa, 0xc9, 0xac, 0x2a, 0xf8,
+        0xb3, 0x6a, 0xfa, 0xa4, 0x2a, 0x5b, 0xa5, 0xd9, 0xc1, 0x99, 0x09, 0xcb, 0x87, 0xc8, 0x9e, 0x89,
+        0x87, 0xb3, 0x7e, 0x87, 0xad, 0x76, 0xb7, 0x78, 0x78, 0x08, 0x1e, 0x7b, 0xc7, 0xf9, 0x8e, 0x98,
+        0xe0, 0x8e, 0x09, 0x9c, 0x9b, 0x69, 0x75, 0xa7, 0xea, 0x72, 0xa7, 0xba, 0xae, 0xa6, 0x8a, 0xac,
+        0xa5, 0xaa, 0x6a, 0xa6, 0xe8, 0xf7, 0x94, 0xd9, 0x0a, 0x81, 0x08, 0x1e, 0x82, 0x77, 0x19, 0x6f,
+        0x17, 0x2c, 0x6b, 0xf6, 0xb9, 0x6b, 0x96, 0x90, 0x6c, 0xc6, 0x8b, 0x76, 0x37, 0x38, 0x73, 0xe8,
+        0x6c, 0x82, 0x38, 0x62, 0x91, 0xb9, 0x06, 0x90, 0x19, 0x45, 0x99, 0x19, 0x54, 0x8e, 0x58, 0xe1,
+        0x8e, 0x48, 0x5d, 0x83, 0xe8, 0x7e, 0x6f, 0x97, 0x16, 0x70, 0xf5, 0xee, 0x64, 0x16, 0x04, 0x52,
+        0xc5, 0x34, 0x53, 0x35, 0x9b, 0x54, 0x55, 0x8c, 0x5f, 0x45, 0xee, 0x5e, 0x76, 0xdd, 0x6f, 0x16,
+        0xb8, 0x7b, 0x87, 0xb4, 0x7b, 0x58, 0x86, 0x83, 0x08, 0x6f, 0x86, 0x98, 0x8a, 0x88, 0x37, 0x8f,
+        0x7d, 0x17, 0x99, 0x6b, 0xb6, 0xde, 0x6d, 0xe5, 0xcb, 0x59, 0xe5, 0xdb, 0x55, 0x25, 0x5b, 0x55,
+        0x64, 0xdb, 0x51, 0x14, 0xd4, 0x5b, 0xb5, 0xa2, 0x5a, 0x56, 0xb4, 0x66, 0xc6, 0xa9, 0x7f, 0xc7,
+        0xda, 0x7d, 0xc8, 0x6f, 0x8b, 0x38, 0x76, 0x8e, 0x38, 0xc9, 0x8d, 0x58, 0xaa, 0x88, 0xe8, 0xcf,
+        0x86, 0x78, 0x61, 0x86, 0x18, 0xc1, 0x8f, 0x48, 0xb0, 0x88, 0xb8, 0xa4, 0x89, 0xd8, 0x10, 0x7d,
+        0xa8, 0x11, 0x71, 0xc7, 0x3e, 0x73, 0xf6, 0x13, 0x65, 0x46, 0x15, 0x5f, 0x36, 0x03, 0x5f, 0xb6,
+        0x4d, 0x60, 0x76, 0x42, 0x75, 0xf7, 0x4d, 0x74, 0xa8, 0x19, 0x84, 0x38, 0x05, 0x97, 0x69, 0x63,
+        0x95, 0xda, 0x12, 0x9d, 0xba, 0x15, 0xa4, 0x0a, 0x3e, 0xa3, 0xc9, 0x54, 0x9b, 0x79, 0x74, 0x89,
+        0x68, 0x9e, 0x89, 0xd7, 0xe0, 0x7c, 0x68, 0x05, 0x75, 0x67, 0x4e, 0x75, 0x17, 0x4d, 0x79, 0x17,
+        0x56, 0x7e, 0xa7, 0xd3, 0x7d, 0x29, 0x5a, 0x90, 0x99, 0x4b, 0xa2, 0x7a, 0x15, 0xa1, 0x2a, 0xe5,
+        0xb1, 0xaa, 0xd5, 0xac, 0x8a, 0xd6, 0xad, 0x8a, 0xb9, 0xa7, 0xfa, 0xbc, 0x98, 0x09, 0xab, 0x9a,
+        0x58, 0x69, 0x8b, 0x28, 0x6e, 0x79, 0xe7, 0xb9, 0x7b, 0x67, 0xa3, 0x75, 0x37, 0x93, 0x7f, 0xc7,
+        0xff, 0x7f, 0x98, 0x8e, 0x8a, 0xe8, 0x6a, 0x9b, 0x39, 0xa3, 0x9a, 0x5a, 0x70, 0xa1, 0xda, 0x59,
+        0xab, 0x9a, 0xc8, 0xab, 0xc9, 0xd5, 0xa2, 0x39, 0xe8, 0x92, 0x69, 0x33, 0x93, 0x07, 0xeb, 0x7d,
+        0x58, 0x15, 0x71, 0xd7, 0x1c, 0x72, 0x06, 0x3e, 0x68, 0xe6, 0x50, 0x68, 0xc6, 0x6c, 0x67, 0x67,
+        0x5d, 0x71, 0x97, 0x55, 0x83, 0x78, 0x12, 0x80, 0xe8, 0xd1, 0x90, 0xf8, 0xcd, 0x91, 0x89, 0x04,
+        0x90, 0x99, 0x24, 0x8f, 0x99, 0x36, 0x80, 0x78, 0x23, 0x81, 0xb6, 0xf0, 0x73, 0xd7, 0x01, 0x5b,
+        0x25, 0xc4, 0x5c, 0x55, 0x7f, 0x53, 0xe5, 0x7c, 0x54, 0x35, 0x4b, 0x54, 0x35, 0xce, 0x5e, 0x75,
+        0xb2, 0x6b, 0x96, 0xac, 0x6a, 0xd7, 0xe3, 0x78, 0x57, 0xc6, 0x87, 0x08, 0x78, 0x87, 0x58, 0x2a,
+        0x86, 0x88, 0x2f, 0x7c, 0x27, 0xe1, 0x7e, 0x06, 0xd8, 0x6a, 0xe6, 0xec, 0x60, 0x16, 0x1b, 0x61,
+        0x54, 0xef, 0x53, 0xf4, 0xfe, 0x52, 0xa5, 0x1f, 0x52, 0x35, 0xbb, 0x57, 0x45, 0xb9, 0x6d, 0xe6,
+        0xca, 0x6c, 0x07, 0xa3, 0x7e, 0x07, 0xa2, 0x8b, 0x38, 0x9b, 0x89, 0x89, 0x1f, 0x8f, 0x99, 0x35,
+        0x78, 0xe7, 0x88, 0x78, 0x78, 0x73, 0x89, 0x38, 0x53, 0x8d, 0x08, 0xe0, 0x8e, 0x08, 0xdd, 0x89,
+        0xe8, 0xe2, 0x81, 0xd8, 0x47, 0x84, 0x76, 0xf3, 0x74, 0x06, 0xfe, 0x65, 0xb6, 0x73, 0x67, 0x76,
+        0x1b, 0x5d, 0xa6, 0x19, 0x69, 0xb6, 0x94, 0x68, 0xf7, 0x15, 0x74, 0x07, 0x0b, 0x88, 0x88, 0x67,
+        0x86, 0xa9, 0x99, 0x95, 0x19, 0x8f, 0xa5, 0xba, 0x49, 0xa4, 0x5a, 0x00, 0xa6, 0x3a, 0x1c, 0x99,
+        0xd9, 0x98, 0x99, 0xc8, 0xda, 0x8c, 0x28, 0xff, 0x7e, 0xe7, 0xf5, 0x7e, 0xd7, 0x48, 0x79, 0xd7,
+        0x5c, 0x75, 0x17, 0x3f, 0x74, 0x48, 0x5e, 0x81, 0x38, 0x49, 0x92, 0x59, 0x10, 0x90, 0xaa, 0x3a,
+        0xa5, 0xea, 0x1e, 0xab, 0xba, 0xba, 0xab, 0xab, 0x3c, 0xaf, 0xab, 0x3d, 0xa7, 0x6a, 0x94, 0xa9,
+        0x79, 0x79, 0x9b, 0x99, 0x81, 0x85, 0x78, 0x78, 0x88, 0x17, 0xd3, 0x78, 0xf7, 0xce, 0x78, 0x97,
+        0x99, 0x79, 0x37, 0xa6, 0x7c, 0x57, 0x83, 0x8a, 0x38, 0x92, 0x88, 0xf9, 0x96, 0x93, 0xf9, 0x80,
+        0xa7, 0x7a, 0x6c, 0xa6, 0xaa, 0x35, 0xa7, 0x7a, 0x3a, 0xa0, 0x5a, 0x0a, 0xa0, 0xa9, 0x06, 0x8e,
+        0x59, 0x22, 0x7f, 0xb8, 0x07, 0x80, 0x66, 0xa0, 0x70, 0x06, 0xbd, 0x64, 0xa6, 0x36, 0x63, 0xb6,
+        0x87, 0x64, 0xe6, 0x88, 0x72, 0x37, 0x05, 0x6f, 0xb7, 0xe5, 0x81, 0x77, 0xda, 0x89, 0xe8, 0x80,
+        0x88, 0x79, 0x52, 0x91, 0x79, 0x58, 0x8c, 0x48, 0xd5, 0x8d, 0x07, 0xff, 0x84, 0xd8, 0x12, 0x6a,
+        0xf6, 0xd0, 0x6c, 0xc6, 0x0e, 0x5d, 0xc6, 0x16, 0x52, 0x25, 0x44, 0x54, 0x05, 0x1e, 0x54, 0x95,
+        0x0b, 0x5a, 0xb5, 0xa1, 0x5a, 0x36, 0xe6, 0x67, 0xd6, 0xc0, 0x7c, 0xe7, 0xc9, 0x7c, 0x68, 0x27,
+        0x84, 0xf8, 0x16, 0x85, 0xe8, 0x6d, 0x86, 0xf7, 0xde, 0x7a, 0x97, 0xe4, 0x71, 0x17, 0x27, 0x72,
+        0x65, 0xa7, 0x5f, 0xc5, 0xc4, 0x54, 0xa5, 0x53, 0x55, 0x05, 0x37, 0x50, 0x05, 0x3b, 0x5e, 0x95,
+        0xcc, 0x5c, 0xf6, 0x96, 0x6c, 0xc6, 0x86, 0x7e, 0x47, 0xbc, 0x7c, 0x18, 0xee, 0x8a, 0xe8, 0xea,
+        0x68, 0x86, 0x7d, 0x68, 0x27, 0xa1, 0x7b, 0x67, 0x75, 0x88, 0x08, 0x7b, 0x88, 0x49, 0x32, 0x8d,
+        0xe9, 0x1e, 0x8f, 0x99, 0x10, 0x91, 0x37, 0xf8, 0x84, 0x78, 0x00, 0x73, 0xa7, 0x5c, 0x75, 0xc6,
+        0x87, 0x65, 0x16, 0x91, 0x66, 0x46, 0x66, 0x66, 0x76, 0x53, 0x68, 0xf6, 0x4c, 0x78, 0x67, 0x5e,
+        0x76, 0xb8, 0xa8, 0x85, 0x98, 0x9b, 0x9d, 0xc9, 0xc3, 0x9b, 0x9a, 0x28, 0xa7, 0x0a, 0x31, 0xa4,
+        0xda, 0x48, 0xa4, 0x89, 0xe0, 0x9c, 0x3a, 0x07, 0x8e, 0x68, 0xf7, 0x8e, 0xf7, 0xdf, 0x83, 0xb7,
+        0xfb, 0x74, 0xb7, 0x46, 0x74, 0xa7, 0xbf, 0x77, 0x67, 0xbd, 0x82, 0x68, 0x13, 0x81, 0x59, 0x31,
+        0x95, 0xd9, 0x1a, 0xa1, 0x39, 0xfb, 0xa0, 0x3b, 0x2d, 0xad, 0x7b, 0x16, 0xaf, 0xfb, 0x1a, 0xb1,
+        0x8a, 0x6a, 0xab, 0x1a, 0x70, 0x96, 0x59, 0x8c, 0x98, 0x98, 0x8f, 0x85, 0x88, 0x90, 0x7b, 0x27,
+        0xd8, 0x7d, 0x77, 0x2e, 0x75, 0xa7, 0x26, 0x7b, 0x77, 0xae, 0x7a, 0xe8, 0x90, 0x82, 0x98, 0x72,
+        0x9a, 0x89, 0x91, 0x98, 0xa9, 0xe6, 0xa1, 0xc9, 0xdf, 0xa5, 0xda, 0x57, 0xa5, 0x59, 0xde, 0x9b,
+        0x79, 0xf9, 0x90, 0x89, 0x1c, 0x91, 0x87, 0x83, 0x7e, 0xe7, 0xa6, 0x6a, 0xa6, 0xa7, 0x6a, 0xa6,
+        0x45, 0x61, 0x96, 0x5c, 0x65, 0x56, 0x39, 0x63, 0xe6, 0xd4, 0x70, 0x96, 0xcc, 0x7a, 0xf7, 0x8d,
+        0x78, 0xd8, 0xd8, 0x88, 0xb8, 0xca, 0x8e, 0xe8, 0xee, 0x8e, 0xa8, 0xb9, 0x8f, 0xc8, 0xc1, 0x7b,
+        0xb7, 0xd5, 0x7d, 0x67, 0x11, 0x6d, 0xb7, 0x19, 0x5b, 0xa5, 0xe0, 0x5d, 0xc5, 0x0f, 0x54, 0x85,
+        0x0f, 0x4f, 0xe5, 0x06, 0x50, 0x35, 0xd6, 0x57, 0x45, 0xb4, 0x6b, 0xe6, 0xbd, 0x6b, 0xb7, 0x7f,
+        0x79, 0xa7, 0x5d, 0x85, 0x38, 0x4d, 0x85, 0x78, 0x6e, 0x83, 0x28, 0x73, 0x80, 0x98, 0x25, 0x82,
+        0x56, 0xbb, 0x71, 0x46, 0xd1, 0x60, 0xe6, 0x14, 0x61, 0xf5, 0x61, 0x53, 0x25, 0x76, 0x57, 0x25,
+        0x65, 0x55, 0xd5, 0x9b, 0x5d, 0x65, 0x9b, 0x6d, 0x66, 0xa0, 0x6a, 0xd8, 0x19, 0x7c, 0xf8, 0x11,
+        0x5a, 0x75, 0xa9, 0x5a, 0x46, 0x98, 0x6b, 0x26, 0x76, 0x7b, 0x07, 0xa9, 0x7a, 0xd8, 0xe1, 0x88,
+        0x78, 0xc7, 0x94, 0x29, 0x54, 0x95, 0x78, 0xd0, 0x91, 0x08, 0xce, 0x84, 0x58, 0x62, 0x86, 0x97,
+        0x64, 0x73, 0x87, 0x7e, 0x6c, 0xc6, 0xe2, 0x6e, 0x26, 0x1b, 0x66, 0x26, 0x22, 0x6c, 0x16, 0xb1,
+        0x6a, 0xa7, 0x9d, 0x75, 0xd7, 0x97, 0x8e, 0xb8, 0xca, 0x8c, 0xd9, 0xa4, 0x9e, 0x69, 0xa5, 0xa6,
+        0x9a, 0x53, 0xa5, 0x5a, 0x8f, 0xa6, 0x9a, 0xa3, 0x9e, 0x89, 0xee, 0x9e, 0xf8, 0xda, 0x93, 0xf9,
+        0x01, 0x7e, 0x27, 0xea, 0x7e, 0xd7, 0xbc, 0x78, 0x77, 0xc7, 0x78, 0xf7, 0x80, 0x78, 0x38, 0x32,
+        0x85, 0xe8, 0x21, 0x90, 0xd8, 0xf4, 0x8f, 0xda, 0x7d, 0xa2, 0x2a, 0x5e, 0xae, 0x6a, 0xf4, 0xae,
+        0x8a, 0xfa, 0xb2, 0xba, 0xeb, 0xa5, 0x9a, 0x78, 0xa7, 0x29, 0x9f, 0x96, 0x49, 0xa6, 0x87, 0xb8,
+        0x9e, 0x89, 0xe7, 0x5c, 0x79, 0xf7, 0x60, 0x74, 0x37, 0x49, 0x74, 0xd7, 0x9f, 0x75, 0x27, 0x8e,
+        0x89, 0x28, 0x80, 0x87, 0xf9, 0x13, 0x94, 0x19, 0x02, 0xa1, 0x29, 0xfb, 0x9f, 0x9a, 0x39, 0x9f,
+        0xea, 0x3b, 0x9e, 0x99, 0xeb, 0x9e, 0x88, 0x8b, 0x8f, 0x88, 0xbc, 0x79, 0x07, 0x94, 0x79, 0x36,
+        0xad, 0x68, 0x96, 0xcf, 0x61, 0x46, 0x0a, 0x60, 0x86, 0x04, 0x64, 0x86, 0x09, 0x69, 0x96, 0x7d,
+        0x67, 0xc7, 0xe4, 0x79, 0x97, 0xd3, 0x87, 0x08, 0x57, 0x86, 0x08, 0xe1, 0x91, 0x58, 0xd4, 0x87,
+        0xc8, 0x82, 0x87, 0xd8, 0x15, 0x7e, 0x58, 0x25, 0x6b, 0xe6, 0xe5, 0x6e, 0x25, 0xaa, 0x5e, 0xe5,
+        0xb5, 0x4f, 0x25, 0x0c, 0x51, 0x45, 0x36, 0x4d, 0xe5, 0x23, 0x5b, 0x55, 0xbb, 0x5b, 0x66, 0x70,
+        0x68, 0xc6, 0x49, 0x7a, 0x67, 0x98, 0x79, 0x98, 0x5f, 0x81, 0x28, 0x47, 0x89, 0xf8, 0xae, 0x8a,
+        0x47, 0xb6, 0x80, 0xf7, 0xc9, 0x72, 0x17, 0x2d, 0x73, 0x06, 0x26, 0x60, 0x26, 0x41, 0x59, 0xf5,
+        0xa9, 0x59, 0xc5, 0x25, 0x56, 0xc5, 0x33, 0x5d, 0xa5, 0xbb, 0x5b, 0xe7, 0x00, 0x6b, 0x66, 0xfc,
+        0x54, 0x05, 0x48, 0x54, 0x45, 0xb5, 0x5d, 0x25, 0x97, 0x6a, 0xa6, 0xa0, 0x69, 0xf8, 0x16, 0x7a,
+        0x67, 0xed, 0x8f, 0xb8, 0xfe, 0x8f, 0x99, 0x24, 0x95, 0x69, 0x18, 0x91, 0x89, 0x31, 0x93, 0x28,
+        0x6e, 0x84, 0x68, 0x7a, 0x7a, 0xc7, 0xc7, 0x7b, 0xe6, 0x81, 0x6d, 0x66, 0x8f, 0x68, 0x86, 0x79,
+        0x67, 0xb6, 0xdc, 0x69, 0xb6, 0xdc, 0x7e, 0x77, 0xc1, 0x7c, 0x48, 0xb6, 0x8e, 0x98, 0xab, 0x9e,
+        0x99, 0xcb, 0x9c, 0xba, 0xaf, 0xa7, 0xfa, 0xbc, 0xa9, 0x5a, 0x9a, 0xa9, 0x99, 0xdb, 0xa4, 0x4a,
+        0x03, 0x8d, 0xb8, 0xeb, 0x8e, 0xc8, 0x52, 0x82, 0x98, 0x6c, 0x78, 0x57, 0x8d, 0x78, 0x97, 0x92,
+        0x7c, 0xa7, 0x8e, 0x81, 0x17, 0xfe, 0x80, 0x19, 0x7f, 0x91, 0x19, 0x58, 0xa3, 0xba, 0x37, 0xa3,
+        0x2a, 0xd8, 0xb0, 0x1a, 0xc3, 0xae, 0x3a, 0xef, 0xaf, 0x3a, 0x93, 0xa5, 0x6a, 0x94, 0x98, 0x09,
+        0xad, 0x9a, 0xd8, 0x24, 0x86, 0xc8, 0x29, 0x77, 0xb7, 0x8b, 0x78, 0xc7, 0x36, 0x6e, 0xc7, 0x2a,
+        0x7a, 0x87, 0x9b, 0x79, 0xe8, 0x02, 0x83, 0x77, 0xef, 0x93, 0x89, 0x1d, 0x91, 0xd9, 0xf0, 0x9a,
+        0x69, 0xe5, 0xa4, 0x0a, 0x32, 0xa2, 0xa9, 0x6f, 0x9c, 0x69, 0x85, 0x8a, 0x38, 0x9d, 0x8a, 0x77,
+        0x98, 0x77, 0xf7, 0xc0, 0x67, 0xc6, 0x83, 0x68, 0x15, 0xd0, 0x61, 0xf5, 0xe0, 0x5d, 0x85, 0xba,
+        0x5c, 0x26, 0xd2, 0x68, 0x76, 0xc7, 0x78, 0x07, 0x65, 0x76, 0x58, 0x5b, 0x88, 0x28, 0x41, 0x89,
+        0x68, 0x95, 0x89, 0x98, 0xcf, 0x88, 0xc8, 0xd5, 0x7c, 0x37, 0xf3, 0x7e, 0xa6, 0xad, 0x6f, 0x36,
+        0xba, 0x59, 0x15, 0xae, 0x5b, 0x65, 0x32, 0x4e, 0x55, 0x28, 0x51, 0x75, 0x22, 0x51, 0xd5, 0x6a,
+        0x58, 0x95, 0x46, 0x69, 0x36, 0x81, 0x68, 0x67, 0xab, 0x74, 0xc7, 0x8d, 0x88, 0x28, 0x80, 0x87,
+        0xe8, 0x40, 0x88, 0x78, 0x4f, 0x81, 0xe8, 0x24, 0x81, 0xd7, 0x38, 0x71, 0xb7, 0x61, 0x66, 0x36,
+        0x70, 0x66, 0xa5, 0x55, 0x5b, 0x35, 0x76, 0x56, 0x75, 0x56, 0x55, 0xe6, 0x13, 0x5d, 0x26, 0x0f,
+        0x56, 0x75, 0x83, 0x58, 0x85, 0x44, 0x57, 0x45, 0x37, 0x5c, 0x55, 0xc6, 0x5c, 0x47, 0x07, 0x69,
+        0xe6, 0xdd, 0x82, 0xd8, 0x26, 0x82, 0x28, 0xd8, 0x8f, 0xc8, 0xba, 0x97, 0x39, 0x7d, 0x97, 0x79,
+        0x4a, 0x90, 0xb9, 0x45, 0x8b, 0x88, 0xd5, 0x8c, 0xf7, 0x60, 0x7b, 0xa7, 0x7b, 0x6e, 0xd6, 0xec,
+        0x6e, 0xb6, 0x9e, 0x66, 0xc6, 0xae, 0x71, 0xe7, 0x0b, 0x70, 0x97, 0xb2, 0x7e, 0x77, 0xa9, 0x90,
+        0x18, 0xd3, 0x8d, 0xaa, 0x30, 0x9f, 0x0a, 0x31, 0xab, 0x5a, 0xae, 0xaa, 0x8a, 0x95, 0xae, 0x2a,
+        0xa6, 0x9e, 0x39, 0xed, 0x9f, 0x09, 0x4b, 0x92, 0xc9, 0x6a, 0x81, 0xa8, 0x31, 0x82, 0xd7, 0x92,
+        0x7d, 0x87, 0x9d, 0x76, 0xf7, 0x6d, 0x77, 0x58, 0x78, 0x81, 0xd8, 0x5b, 0x93, 0x59, 0x2c, 0x92,
+        0xda, 0x33, 0xa4, 0x6a, 0x0f, 0xac, 0x6a, 0xc3, 0xad, 0x0b, 0x0c, 0xac, 0x8b, 0x0a, 0xa7, 0x3a,
+        0x97, 0xa9, 0x89, 0x33, 0x97, 0x79, 0x3c, 0x83, 0xd8, 0x57, 0x85, 0xa7, 0x69, 0x73, 0x27, 0x70,
+        0x73, 0xb7, 0x3e, 0x73, 0xa7, 0x1d, 0x74, 0xe7, 0x0f, 0x82, 0xe8, 0x0a, 0x80, 0xe9, 0x0e, 0x8c,
+        0x89, 0x01, 0x9e, 0x79, 0xcf, 0x9d, 0x49, 0xbe, 0xa0, 0xf9, 0xd0, 0x97, 0x89, 0x78, 0x97, 0x88,
+        0xaa, 0x88, 0xe8, 0xce, 0x76, 0xd7, 0x74, 0x77, 0x76, 0x3f, 0x69, 0x76, 0x54, 0x59, 0x55, 0x95,
+        0x59, 0x66, 0x12, 0x5c, 0x36, 0x03, 0x66, 0x56, 0x53, 0x65, 0x47, 0x5f, 0x78, 0x97, 0x45, 0x80,
+        0xf7, 0xfe, 0x80, 0x28, 0xea, 0x89, 0xd8, 0xdd, 0x87, 0xe8, 0x97, 0x89, 0x87, 0xbb, 0x7f, 0xd7,
+        0xbf, 0x69, 0xc6, 0xbc, 0x6b, 0xf5, 0xd6, 0x59, 0x85, 0xd5, 0x51, 0xc5, 0x38, 0x53, 0x24, 0xcf,
+        0x4f, 0xb4, 0xbc, 0x59, 0x25, 0x86, 0x58, 0x96, 0x95, 0x64, 0x06, 0x79, 0x7c, 0x87, 0xc1, 0x7b,
+        0x88, 0x25, 0x85, 0x58, 0x18, 0x8a, 0x68, 0x96, 0x89, 0xb8, 0x31, 0x80, 0xa8, 0x46, 0x78, 0x07,
+        0x8a, 0x78, 0x96, 0x2a, 0x69, 0x06, 0x4e, 0x5a, 0xd5, 0xa3, 0x5a, 0x55, 0xaa, 0x57, 0x65, 0xba,
+        0x61, 0xe6, 0x48, 0x64, 0xa5, 0x77, 0x5a, 0xc5, 0x67, 0x55, 0x05, 0x61, 0x56, 0x16, 0x23, 0x5c,
+        0x56, 0x04, 0x72, 0x77, 0x1c, 0x71, 0xe8, 0x06, 0x82, 0x87, 0xea, 0x92, 0xb9, 0x27, 0x92, 0x99,
+        0x9d, 0x95, 0x69, 0x98, 0x98, 0xd9, 0x9d, 0x99, 0xe8, 0x6d, 0x8c, 0x78, 0x81, 0x7c, 0x77, 0xd6,
+        0x7d, 0x77, 0x04, 0x6d, 0x77, 0x1b, 0x6e, 0x56, 0xdd, 0x6d, 0xd6, 0xe3, 0x72, 0xe6, 0xee, 0x7f,
+        0x87, 0xcb, 0x7c, 0xd9, 0x41, 0x8f, 0x99, 0x39, 0xa3, 0xfa, 0x1e, 0xa2, 0x3a, 0xb7, 0xaf, 0xba,
+        0xbd, 0xa9, 0xba, 0x98, 0xa9, 0x5a, 0x51, 0xa2, 0xea, 0x72, 0x91, 0x89, 0x35, 0x93, 0x48, 0x2d,
+        0x87, 0xe8, 0x41, 0x77, 0x17, 0x7b, 0x77, 0x97, 0xdc, 0x79, 0x17, 0xcd, 0x83, 0x58, 0x33, 0x83,
+        0x59, 0x28, 0x93, 0xc9, 0x02, 0xa1, 0x3a, 0x0d, 0xa1, 0x0a, 0xfa, 0xaa, 0x2a, 0xe6, 0xaf, 0xbb,
+        0x12, 0xb1, 0x0a, 0x23, 0xa6, 0xea, 0x2b, 0x94, 0xa9, 0x65, 0x96, 0xc8, 0x2c, 0x80, 0x38, 0x3d,
+        0x77, 0x57, 0x82, 0x77, 0xb6, 0xb2, 0x6f, 0x16, 0xb3, 0x74, 0x27, 0x2a, 0x73, 0x08, 0x02, 0x7b,
+        0x57, 0xf5, 0x90, 0xf8, 0xee, 0x8f, 0x29, 0x6b, 0x9a, 0xc9, 0x6c, 0x9c, 0x79, 0xaf, 0x9b, 0x89,
+        0x7d, 0x95, 0xd9, 0x9b, 0x87, 0xd8, 0x88, 0x88, 0x07, 0x26, 0x78, 0xc7, 0x4e, 0x60, 0xd6, 0x15,
+        0x61, 0x35, 0xde, 0x5a, 0x55, 0xe3, 0x5a, 0x75, 0x9c, 0x59, 0xe6, 0x50, 0x67, 0x36, 0x31, 0x70,
+        0xd6, 0xfe, 0x70, 0x18, 0x5d, 0x7f, 0xe8, 0x42, 0x89, 0x78, 0x9e, 0x89, 0xe8, 0x68, 0x89, 0xd8,
+        0x66, 0x7a, 0x67, 0xc3, 0x7c, 0x66, 0xda, 0x6a, 0x26, 0xe4, 0x5b, 0xf5, 0xec, 0x5e, 0x44, 0xda,
+        0x51, 0x24, 0xd6, 0x4f, 0x84, 0xf9, 0x50, 0x45, 0x91, 0x53, 0xf5, 0x81, 0x6b, 0x86, 0xa6, 0x6a,
+        0x67, 0x5e, 0x78, 0xe7, 0x4f, 0x87, 0xb8, 0x63, 0x86, 0x88, 0xad, 0x87, 0x78, 0xb8, 0x87, 0x28,
+        0x80, 0x87, 0x87, 0x40, 0x7a, 0x17, 0x65, 0x67, 0xa6, 0x82, 0x68, 0xd5, 0xef, 0x5c, 0xc6, 0x0f,
+        0x72, 0x17, 0x4a, 0x74, 0x66, 0x28, 0x66, 0xf6, 0x2e, 0x57, 0xd5, 0x98, 0x59, 0x85, 0xa9, 0x55,
+        0xa5, 0x98, 0x63, 0x76, 0x39, 0x63, 0xb7, 0x03, 0x71, 0x96, 0xde, 0x86, 0x28, 0x55, 0x85, 0x19,
+        0x55, 0x90, 0x89, 0x44, 0x9e, 0x99, 0xf1, 0x9e, 0xf9, 0x41, 0x99, 0x59, 0x54, 0x8d, 0x48, 0xe1,
+        0x8e, 0x57, 0xe1, 0x7c, 0x88, 0x02, 0x74, 0x47, 0x4e, 0x74, 0x76, 0xa6, 0x6f, 0xb6, 0xb9, 0x72,
+        0xd7, 0x0c, 0x71, 0x48, 0x36, 0x7f, 0x18, 0x34, 0x94, 0xb9, 0x2b, 0x92, 0x6a, 0x36, 0xa6, 0xba,
+        0x30, 0xab, 0x7a, 0xa9, 0xaa, 0x6b, 0x07, 0xad, 0x5b, 0x1a, 0xa1, 0xda, 0x33, 0xa3, 0x59, 0x2a,
+        0x98, 0x59, 0x40, 0x80, 0x58, 0x20, 0x81, 0xd7, 0xda, 0x79, 0x57, 0xd7, 0x79, 0xc7, 0xa5, 0x7a,
+        0x48, 0x2c, 0x84, 0x78, 0x04, 0x90, 0xa9, 0x08, 0x90, 0x6a, 0x4b, 0x9e, 0x5a, 0x23, 0xae, 0x7a,
+        0xe9, 0xae, 0x0a, 0xaf, 0xae, 0x0a, 0x9f, 0xa4, 0x4a, 0x57, 0xa5, 0xe9, 0x41, 0x91, 0x19, 0x54,
+        0x84, 0x08, 0x5b, 0x85, 0xa6, 0xed, 0x73, 0xc6, 0xfc, 0x6d, 0x96, 0xd1, 0x6d, 0x07, 0x17, 0x6d,
+        0x57, 0x14, 0x80, 0x07, 0xd9, 0x7d, 0x88, 0x8a, 0x8c, 0x78, 0x83, 0x97, 0x49, 0x4f, 0x95, 0x29,
+        0xc9, 0x99, 0xb9, 0xdb, 0x95, 0x19, 0x54, 0x94, 0xb8, 0x3a, 0x89, 0xc8, 0x65, 0x6f, 0x97, 0x09,
+        0x70, 0x76, 0x4b, 0x62, 0x86, 0x67, 0x57, 0xb5, 0x7f, 0x57, 0xc5, 0x8d, 0x5b, 0xf5, 0x81, 0x5f,
+        0xe5, 0xf2, 0x5f, 0x47, 0x5e, 0x6f, 0xc7, 0x3e, 0x7f, 0xf8, 0x02, 0x7f, 0xa8, 0x7c, 0x89, 0xc8,
+        0x65, 0x85, 0x38, 0x65, 0x86, 0x77, 0xe3, 0x7a, 0xa7, 0xeb, 0x6c, 0xa6, 0xf6, 0x6f, 0x95, 0x86,
+        0x5d, 0x15, 0x8c, 0x50, 0xa5, 0x15, 0x51, 0xc5, 0x09, 0x4b, 0xa4, 0xfb, 0x5b, 0x95, 0xae, 0x5a,
+        0xe6, 0x4c, 0x67, 0x96, 0x3e, 0x7b, 0x37, 0x94, 0x79, 0x68, 0x7b, 0x83, 0xb8, 0x81, 0x8e, 0xb8,
+        0xe1, 0x8e, 0x18, 0x35, 0x89, 0x28, 0x51, 0x79, 0x77, 0x9d, 0x7a, 0x36, 0xc6, 0x6a, 0xb6, 0xee,
+        0x81, 0xd8, 0x39, 0x83, 0xa7, 0x2d, 0x76, 0xf7, 0x2c, 0x63, 0x16, 0x4f, 0x65, 0x25, 0xd3, 0x58,
+        0xb5, 0xcd, 0x5c, 0x65, 0xd0, 0x5c, 0x86, 0x19, 0x63, 0xc5, 0xfa, 0x75, 0x57, 0x49, 0x74, 0x68,
+        0x8a, 0x83, 0x68, 0x6a, 0x9a, 0xb9, 0x9d, 0x99, 0x79, 0xa0, 0x9e, 0x39, 0xa6, 0x9a, 0xf9, 0xb4,
+        0x9b, 0x68, 0xf0, 0x8d, 0x29, 0x0c, 0x82, 0x68, 0x32, 0x82, 0xf7, 0x03, 0x76, 0xa7, 0x30, 0x6e,
+        0xe6, 0xdd, 0x6e, 0x47, 0x6e, 0x73, 0x07, 0x78, 0x84, 0x28, 0x1e, 0x81, 0xe9, 0x44, 0x97, 0x79,
+        0x3b, 0xa3, 0x3a, 0x1b, 0xa2, 0x0b, 0x26, 0xae, 0x7b, 0x2a, 0xad, 0x7a, 0xe0, 0xad, 0xea, 0x31,
+        0xa8, 0x4a, 0x40, 0x90, 0x09, 0x1a, 0x92, 0x28, 0x74, 0x83, 0xc8, 0x7f, 0x79, 0x77, 0xb4, 0x7a,
+        0xe7, 0x8f, 0x7b, 0x37, 0x73, 0x81, 0x08, 0x08, 0x80, 0xe9, 0x3e, 0x8e, 0x19, 0x1e, 0xa3, 0x1a,
+        0x2b, 0xa2, 0xca, 0x8a, 0xab, 0x2a, 0x74, 0xac, 0x3a, 0xcb, 0xac, 0xba, 0x37, 0xa0, 0x0a, 0x3f,
+        0x95, 0x09, 0x63, 0x96, 0xa7, 0xb2, 0x81, 0x07, 0xcc, 0x71, 0x77, 0x1a, 0x71, 0xf6, 0xb6, 0x67,
+        0xb6, 0xc2, 0x72, 0x06, 0xff, 0x6f, 0xe7, 0x7a, 0x7b, 0x07, 0x72, 0x89, 0x68, 0x6c, 0x86, 0xa9,
+        0x71, 0x93, 0x29, 0x70, 0x99, 0xd9, 0x8b, 0x98, 0xb9, 0x14, 0x96, 0x89, 0x29, 0x80, 0xf8, 0x17,
+        0x81, 0xc7, 0x41, 0x72, 0x37, 0x64, 0x5f, 0x06, 0x04, 0x5f, 0xf5, 0x63, 0x5a, 0x35, 0x68, 0x54,
+        0x35, 0x3f, 0x53, 0xd6, 0x4f, 0x5e, 0xc6, 0x2f, 0x6f, 0xd6, 0xfc, 0x6f, 0x67, 0xe1, 0x7f, 0xd7,
+        0xc4, 0x85, 0x98, 0x63, 0x86, 0x08, 0x92, 0x84, 0x78, 0x87, 0x7d, 0x27, 0xfd, 0x7f, 0xc6, 0x91,
+        0x6d, 0xa6, 0x9a, 0x5b, 0x85, 0xd0, 0x5d, 0x75, 0x1c, 0x4e, 0x25, 0x1f, 0x52, 0xb5, 0x29, 0x52,
+        0x65, 0x51, 0x58, 0x65, 0x3e, 0x6a, 0x26, 0x7d, 0x68, 0x07, 0xb7, 0x76, 0xa7, 0xaa, 0x8b, 0x28,
+        0xa3, 0x89, 0xb8, 0xa5, 0x8f, 0x48, 0xbb, 0x88, 0xb8, 0x82, 0x88, 0x97, 0xdf, 0x7c, 0x98, 0x0b,
+        0x8a, 0xe8, 0xc3, 0x8b, 0xb8, 0x1e, 0x86, 0x28, 0x26, 0x73, 0x27, 0x58, 0x75, 0xf6, 0x89, 0x64,
+        0xd6, 0x88, 0x5e, 0x55, 0xfe, 0x5f, 0xa5, 0x9e, 0x5c, 0xd5, 0x8e, 0x66, 0x86, 0x63, 0x66, 0x07,
+        0x84, 0x72, 0x67, 0x65, 0x8d, 0xf8, 0xc4, 0x8c, 0x69, 0x5f, 0x99, 0x29, 0x56, 0xa1, 0x0a, 0x05,
+        0xa0, 0x69, 0xce, 0x9a, 0x39, 0xe4, 0x92, 0xb9, 0x3c, 0x93, 0xe7, 0xea, 0x85, 0x18, 0x0c, 0x74,
+        0xd7, 0x4b, 0x74, 0xd7, 0x32, 0x6f, 0xf7, 0x40, 0x77, 0xc7, 0x5e, 0x76, 0x28, 0x38, 0x86, 0xd8,
+        0x32, 0x94, 0x89, 0x26, 0x92, 0x7a, 0xaa, 0xa5, 0xda, 0xa1, 0xaf, 0x5a, 0xf1, 0xaf, 0x0a, 0xe7,
+        0xb2, 0xba, 0xea, 0xa0, 0xaa, 0x23, 0xa2, 0x79, 0x76, 0x93, 0xe9, 0x80, 0x83, 0x28, 0x4e, 0x85,
+        0x37, 0x88, 0x7c, 0x27, 0x7c, 0x77, 0x57, 0x74, 0x77, 0xd8, 0x42, 0x7e, 0x28, 0x20, 0x92, 0x89,
+        0x19, 0x91, 0xc9, 0xdb, 0x9f, 0x59, 0xb7, 0xaa, 0x1a, 0x9d, 0xaa, 0x6a, 0xb3, 0xa7, 0x7a, 0xb5,
+        0xa4, 0x2a, 0x54, 0xa5, 0x68, 0xc5, 0x91, 0xc8, 0xe2, 0x7e, 0x47, 0xf4, 0x7f, 0x26, 0xe9, 0x6c,
+        0xa7, 0x07, 0x6b, 0x46, 0xab, 0x6a, 0x86, 0x9a, 0x6d, 0x76, 0x96, 0x78, 0x17, 0x4f, 0x76, 0x08,
+        0x91, 0x84, 0x68, 0x89, 0x93, 0xe9, 0x20, 0x92, 0x09, 0x5b, 0x9a, 0x39, 0x5c, 0x8e, 0x38, 0xe6,
+        0x8e, 0x68, 0x50, 0x82, 0xe8, 0x6d, 0x6e, 0x77, 0x00, 0x70, 0x05, 0xd9, 0x62, 0xf5, 0xee, 0x51,
+        0xd5, 0x29, 0x52, 0x65, 0x94, 0x54, 0x25, 0x80, 0x5f, 0x15, 0xeb, 0x5e, 0xe6, 0xe2, 0x6f, 0xe6,
+        0xba, 0x7c, 0x57, 0xba, 0x7b, 0xf8, 0x91, 0x83, 0xa8, 0x7f, 0x87, 0x58, 0x98, 0x89, 0x07, 0x99,
+        0x7d, 0xf7, 0xa5, 0x6c, 0xa6, 0xe4, 0x6e, 0x85, 0xcd, 0x59, 0xf5, 0xdf, 0x54, 0x75, 0x5d, 0x55,
+        0x54, 0xcf, 0x50, 0x54, 0xc4, 0x5a, 0x75, 0x85, 0x58, 0xe6, 0xa4, 0x64, 0xe6, 0x93, 0x7e, 0xb7,
+        0xc8, 0x7c, 0x18, 0x6e, 0x8a, 0xf8, 0x70, 0x8f, 0x78, 0xe4, 0x8e, 0x48, 0xcc, 0x8b, 0x08, 0xee,
+        0x8b, 0x08, 0xb6, 0x8b, 0x58, 0xbb, 0x8f, 0x28, 0xb0, 0x82, 0xa8, 0x47, 0x84, 0x87, 0x86, 0x75,
+        0x17, 0x8f, 0x69, 0x46, 0xba, 0x6b, 0x75, 0xba, 0x5f, 0x75, 0xb7, 0x5e, 0xc5, 0xf5, 0x5e, 0xf6,
+        0x94, 0x63, 0xc6, 0x7e, 0x7d, 0x37, 0xba, 0x7b, 0xb8, 0x96, 0x8c, 0x38, 0x83, 0x9c, 0xe9, 0xb7,
+        0x9b, 0x7a, 0x29, 0x9f, 0x4a, 0x3c, 0xa0, 0xfa, 0x16, 0xa1, 0x78, 0xf2, 0x95, 0xb9, 0x17, 0x83,
+        0x08, 0x2d, 0x83, 0x27, 0x8d, 0x77, 0x07, 0xae, 0x73, 0xd7, 0x2a, 0x72, 0x87, 0x6f, 0x7b, 0x07,
+        0x76, 0x83, 0xe8, 0x1b, 0x81, 0x99, 0xb8, 0x96, 0xd9, 0xa4, 0xa7, 0xca, 0x66, 0xa6, 0x7b, 0x03,
+        0xb4, 0x0b, 0x00, 0xac, 0x0a, 0xcd, 0xad, 0x1a, 0x7c, 0xa4, 0x9a, 0x84, 0x93, 0x49, 0x5c, 0x95,
+        0xa8, 0x20, 0x86, 0x88, 0x26, 0x77, 0x57, 0x88, 0x79, 0x07, 0xa5, 0x74, 0xc7, 0x96, 0x82, 0x48,
+        0x1f, 0x82, 0x48, 0xce, 0x8e, 0xa8, 0xac, 0x9f, 0x19, 0xdf, 0x9e, 0x1a, 0x98, 0xa4, 0x7a, 0x80,
+        0xac, 0x3a, 0xc9, 0xac, 0x39, 0xb7, 0xa0, 0xa9, 0xca, 0x8f, 0x38, 0xfe, 0x90, 0x37, 0xc3, 0x7a,
+        0x27, 0xd8, 0x6f, 0x86, 0xf8, 0x6f, 0x36, 0x34, 0x68, 0x46, 0x42, 0x69, 0xa6, 0x78, 0x67, 0xf7,
+        0x7a, 0x73, 0x77, 0x72, 0x85, 0x78, 0x3b, 0x83, 0x58, 0xf7, 0x92, 0xf8, 0xf6, 0x92, 0x59, 0x19,
+        0x91, 0xe9, 0x26, 0x8f, 0x49, 0x32, 0x7f, 0xc8, 0x0e, 0x80, 0x76, 0xd1, 0x72, 0x96, 0xef, 0x59,
+        0x75, 0xa9, 0x5b, 0x25, 0x74, 0x52, 0xe5, 0x6c, 0x53, 0xc5, 0x41, 0x54, 0x15, 0xd3, 0x5e, 0xd5,
+        0xac, 0x6b, 0xc6, 0xae, 0x6a, 0xf7, 0xf3, 0x79, 0x37, 0xd1, 0x87, 0x78, 0x83, 0x87, 0xe8, 0x39,
+        0x87, 0x68, 0x34, 0x7d, 0x07, 0xe4, 0x7e, 0xf6, 0xdd, 0x6b, 0x96, 0xef, 0x60, 0x06, 0x23, 0x61,
+        0x34, 0xe9, 0x53, 0x54, 0xf5, 0x52, 0x35, 0x12, 0x51, 0x95, 0xa6, 0x55, 0xf5, 0xa4, 0x6c, 0xd6,
+        0xb4, 0x6a, 0xe7, 0x96, 0x7c, 0xd7, 0x92, 0x8b, 0x28, 0x8e, 0x89, 0x19, 0x2e, 0x90, 0x49, 0x40,
+        0x82, 0x48, 0x14, 0x81, 0x88, 0xbf, 0x8e, 0x58, 0xa9, 0x8c, 0x78, 0xde, 0x8d, 0xc8, 0x80, 0x84,
+        0x98, 0x87, 0x79, 0x77, 0xb5, 0x7c, 0x26, 0x6e, 0x6b, 0x46, 0x78, 0x60, 0x96, 0x18, 0x61, 0xa6,
+        0x16, 0x5c, 0xd6, 0x06, 0x6e, 0x46, 0xd4, 0x6d, 0x57, 0x8f, 0x7b, 0x37, 0x72, 0x90, 0x88, 0xe9,
+        0x8e, 0x69, 0xeb, 0x9a, 0xb9, 0xeb, 0xa7, 0x4a, 0x6a, 0xa6, 0x39, 0xd1, 0xa3, 0x19, 0xf0, 0x93,
+        0x49, 0x3e, 0x94, 0x08, 0x68, 0x84, 0xc8, 0x93, 0x79, 0x07, 0x90, 0x79, 0x57, 0x32, 0x77, 0xa7,
+        0x3b, 0x77, 0x57, 0x57, 0x75, 0x88, 0xaa, 0x85, 0xc8, 0xa0, 0x98, 0xb9, 0x6e, 0x97, 0x2a, 0x84,
+        0xab, 0x4a, 0x7c, 0xae, 0x5a, 0xe5, 0xae, 0x5b, 0x2c, 0xae, 0xdb, 0x32, 0xa3, 0xba, 0x5a, 0xa5,
+        0x89, 0x24, 0x96, 0x79, 0x29, 0x80, 0xa8, 0x2c, 0x83, 0x07, 0xa6, 0x75, 0xd7, 0x9e, 0x78, 0xf7,
+        0x93, 0x78, 0xe7, 0xd7, 0x7e, 0xe7, 0xb0, 0x8e, 0x18, 0xd7, 0x8d, 0x59, 0xe3, 0x98, 0x49, 0xca,
+        0xaa, 0x4a, 0x97, 0xa9, 0x3a, 0x3c, 0xa7, 0xda, 0x3d, 0x9e, 0x39, 0xf0, 0x9f, 0x08, 0xd0, 0x8b,
+        0x38, 0xf0, 0x7c, 0x27, 0xcf, 0x7c, 0xf6, 0x6e, 0x6d, 0x16, 0x8a, 0x63, 0x66, 0x28, 0x62, 0x86,
+        0x99, 0x65, 0x96, 0x97, 0x74, 0x37, 0x20, 0x72, 0x28, 0x0d, 0x84, 0x18, 0x00, 0x8c, 0x38, 0xa6,
+        0x8a, 0x89, 0x5e, 0x92, 0xb9, 0x64, 0x8c, 0x48, 0xdc, 0x8c, 0xd7, 0xea, 0x83, 0xc7, 0xfd, 0x69,
+        0x86, 0xb3, 0x6b, 0x65, 0xf4, 0x5c, 0x15, 0xfc, 0x51, 0x95, 0x31, 0x52, 0xa5, 0x17, 0x53, 0xd5,
+        0x04, 0x5a, 0xd5, 0xab, 0x5a, 0xd6, 0xf4, 0x68, 0x56, 0xc5, 0x7d, 0x77, 0xd3, 0x7d, 0x48, 0x33,
+        0x85, 0xd8, 0x1b, 0x86, 0xd8, 0x73, 0x87, 0xd7, 0xe4, 0x7b, 0x37, 0xee, 0x70, 0xe7, 0x32, 0x72,
+        0xd5, 0xa9, 0x60, 0x35, 0xbc, 0x54, 0x55, 0x45, 0x55, 0x15, 0x25, 0x4e, 0x95, 0x30, 0x5d, 0xb5,
+        0xbd, 0x5b, 0xa6, 0x7b, 0x6b, 0x96, 0x71, 0x7d, 0x97, 0xa7, 0x7a, 0xe8, 0xe8, 0x8a, 0xe8, 0xef,
+        0x72, 0x97, 0x1b, 0x72, 0x38, 0x34, 0x84, 0x88, 0x0e, 0x8d, 0x18, 0xd7, 0x8d, 0x49, 0x1e, 0x8d,
+        0xc9, 0x17, 0x89, 0x68, 0xb4, 0x8b, 0x47, 0x69, 0x7b, 0x77, 0x76, 0x6b, 0x76, 0xce, 0x6c, 0xf6,
+        0x2c, 0x5f, 0x76, 0x31, 0x66, 0x06, 0x61, 0x65, 0xf6, 0x9c, 0x6d, 0x06, 0x91, 0x7f, 0xc7, 0xdf,
+        0x7d, 0xf9, 0x2b, 0x8d, 0xb9, 0x20, 0xa3, 0x3a, 0x1f, 0xa2, 0x1a, 0x3a, 0xa8, 0x8a, 0x48, 0xa1,
+        0x8a, 0x18, 0xa1, 0xb9, 0x75, 0x96, 0x49, 0xa8, 0x87, 0x18, 0x79, 0x87, 0xa7, 0x88, 0x7e, 0x37,
+        0xa0, 0x72, 0xd7, 0x20, 0x72, 0x37, 0xde, 0x79, 0xa7, 0xd9, 0x87, 0xe8, 0x64, 0x86, 0x69, 0x99,
+        0x9c, 0x49, 0x82, 0xa6, 0x6a, 0x5a, 0xa5, 0xdb, 0x52, 0xaf, 0xeb, 0x45, 0xaf, 0x3b, 0x06, 0xb0,
+        0x6a, 0x28, 0xa6, 0xea, 0x34, 0x90, 0xb9, 0x33, 0x93, 0x58, 0x44, 0x80, 0x98, 0x47, 0x78, 0x97,
+        0xa1, 0x7a, 0x47, 0x35, 0x76, 0x37, 0x1e, 0x7e, 0x67, 0xd9, 0x7d, 0xc8, 0xd5, 0x87, 0x48, 0xb7,
+        0x9e, 0x79, 0xdb, 0x9d, 0x7a, 0x12, 0xa4, 0xba, 0x0c, 0xa6, 0x1a, 0x58, 0xa6, 0x49, 0xc2, 0x99,
+        0xd9, 0xdf, 0x8d, 0x68, 0xe4, 0x8e, 0x27, 0x44, 0x7a, 0xe7, 0x6e, 0x68, 0x36, 0x72, 0x67, 0xd6,
+        0x3a, 0x60, 0xb6, 0x4b, 0x66, 0x46, 0x49, 0x64, 0x06, 0xfc, 0x73, 0x06, 0xef, 0x7d, 0xa7, 0xb1,
+        0x7b, 0x89, 0x01, 0x8b, 0x58, 0xf0, 0x90, 0x69, 0x03, 0x8f, 0xe8, 0xbd, 0x8f, 0xe8, 0xc3, 0x7a,
+        0x67, 0xbd, 0x7b, 0xf6, 0xf0, 0x6c, 0x16, 0xfb, 0x5a, 0x55, 0xc4, 0x5c, 0x25, 0x01, 0x53, 0xa4,
+        0xf9, 0x4f, 0xb4, 0xfb, 0x50, 0x15, 0xdf, 0x57, 0xe5, 0xbc, 0x6c, 0xf6, 0xc8, 0x6c, 0x87, 0x90,
+        0x7b, 0x17, 0x6d, 0x85, 0xf8, 0x5f, 0x86, 0x08, 0x79, 0x83, 0xe8, 0x76, 0x81, 0x68, 0x2e, 0x82,
+        0x86, 0xbf, 0x71, 0x46, 0xd8, 0x60, 0xb6, 0x1b, 0x61, 0xb5, 0x53, 0x52, 0xb5, 0x6f, 0x56, 0x15,
+        0x57, 0x55, 0x05, 0x89, 0x5c, 0x85, 0x8b, 0x6b, 0xe6, 0x91, 0x69, 0x98, 0x0e, 0x7c, 0x78, 0x08,
+        0x62, 0x86, 0x1e, 0x61, 0xe7, 0x39, 0x75, 0x57, 0x0e, 0x83, 0xf8, 0x3c, 0x84, 0x29, 0x31, 0x8d,
+        0x59, 0x17, 0x93, 0x99, 0x50, 0x94, 0xe8, 0x66, 0x8b, 0x08, 0x71, 0x7b, 0x27, 0xd6, 0x7d, 0xc6,
+        0xd5, 0x6a, 0xd6, 0xe8, 0x67, 0x56, 0x80, 0x68, 0x86, 0x15, 0x65, 0x86, 0x14, 0x70, 0xa6, 0xed,
+        0x6f, 0x48, 0x23, 0x7d, 0x08, 0x14, 0x97, 0x49, 0x53, 0x95, 0x2a, 0x01, 0xa4, 0x19, 0xfe, 0xa8,
+        0x2a, 0x6f, 0xa6, 0xda, 0x5c, 0xa3, 0xba, 0x75, 0x97, 0xa9, 0x89, 0x98, 0x98, 0x62, 0x8c, 0x48,
+        0x84, 0x78, 0x67, 0x8d, 0x78, 0x97, 0x9a, 0x76, 0x47, 0x9e, 0x7a, 0xf7, 0x9a, 0x7a, 0x08, 0x8d,
+        0x8b, 0x58, 0x76, 0x97, 0x69, 0x64, 0x96, 0x5a, 0xd5, 0xa7, 0xba, 0xbd, 0xb1, 0x8b, 0x1a, 0xb1,
+        0xea, 0xe0, 0xb1, 0xea, 0xde, 0xa1, 0x2a, 0x36, 0xa3, 0xb9, 0x47, 0x90, 0x89, 0x4c, 0x82, 0x38,
+        0x4d, 0x84, 0x57, 0x35, 0x76, 0xe7, 0x30, 0x74, 0xc7, 0x4e, 0x74, 0xb7, 0xd5, 0x77, 0xc7, 0xb9,
+        0x8d, 0xc8, 0xc6, 0x8c, 0x19, 0x5e, 0x98, 0xd9, 0x4a, 0xa4, 0x1a, 0x2a, 0xa2, 0xda, 0x3e, 0xa1,
+        0x0a, 0x50, 0x9c, 0x79, 0xc6, 0x9c, 0xc8, 0x5b, 0x8b, 0xe8, 0x7f, 0x74, 0xf7, 0x58, 0x75, 0x16,
+        0x7d, 0x65, 0xc6, 0xa0, 0x60, 0x25, 0xfb, 0x5f, 0x46, 0x1a, 0x65, 0x56, 0x18, 0x6b, 0xe6, 0x9f,
+        0x6a, 0x58, 0x19, 0x7c, 0x08, 0x00, 0x89, 0x98, 0x8b, 0x88, 0x98, 0xed, 0x92, 0x48, 0xf1, 0x87,
+        0xa8, 0x81, 0x88, 0x58, 0x05, 0x7c, 0xb8, 0x0b, 0x69, 0xf6, 0xc9, 0x6c, 0x65, 0x94, 0x5d, 0x35,
+        0x91, 0x4e, 0x34, 0xf4, 0x4f, 0xa5, 0x32, 0x4d, 0x45, 0x1e, 0x5c, 0x45, 0xbd, 0x5c, 0x56, 0x89,
+        0x69, 0xc6, 0x62, 0x7b, 0x27, 0xa7, 0x7a, 0xf8, 0x70, 0x81, 0xb8, 0x5e, 0x8a, 0xb8, 0xb3, 0x8b,
+        0x27, 0xc0, 0x81, 0x17, 0xd5, 0x72, 0x37, 0x28, 0x73, 0x66, 0x1e, 0x5f, 0x96, 0x39, 0x59, 0x55,
+        0x99, 0x59, 0x45, 0x1b, 0x56, 0x05, 0x22, 0x5d, 0x05, 0xa8, 0x5a, 0xd6, 0xf4, 0x6a, 0xb6, 0xe9,
+        0x56, 0x25, 0x6a, 0x56, 0x06, 0x36, 0x65, 0x16, 0x13, 0x75, 0x27, 0x47, 0x74, 0xa8, 0xa8, 0x84,
+        0x08, 0x83, 0x94, 0x69, 0x52, 0x94, 0xa9, 0x0e, 0x94, 0xa9, 0x0e, 0x8a, 0xf8, 0xd1, 0x8d, 0x17,
+        0xdc, 0x7b, 0x07, 0xe9, 0x71, 0x97, 0x30, 0x73, 0x06, 0x23, 0x67, 0x96, 0x34, 0x68, 0x46, 0x75,
+        0x67, 0x37, 0x2c, 0x6e, 0x27, 0x25, 0x86, 0xc8, 0x4b, 0x84, 0x09, 0x3f, 0x97, 0x79, 0x3b, 0xa4,
+        0x8a, 0x24, 0xa2, 0xca, 0xbd, 0xa9, 0x4a, 0xd9, 0xa6, 0x5a, 0x67, 0xa6, 0x79, 0x74, 0x9d, 0x39,
+        0x90, 0x86, 0x08, 0x70, 0x87, 0x27, 0xf6, 0x7c, 0xe8, 0x07, 0x76, 0x17, 0x6a, 0x76, 0x87, 0xba,
+        0x7e, 0xd7, 0xac, 0x86, 0x98, 0x57, 0x85, 0x19, 0xe4, 0x97, 0xf9, 0xc4, 0xa9, 0xfa, 0x99, 0xa9,
+        0x3b, 0x09, 0xb3, 0x5a, 0xee, 0xac, 0xaa, 0xe8, 0xae, 0x7a, 0x4b, 0xa1, 0x2a, 0x50, 0x92, 0x19,
+        0x4f, 0x94, 0xe7, 0xcb, 0x81, 0x97, 0xd4, 0x74, 0x67, 0x5d, 0x75, 0x97, 0x3d, 0x6e, 0xe7, 0x2f,
+        0x7e, 0x17, 0xce, 0x7c, 0x98, 0x55, 0x87, 0xc8, 0x3f, 0x98, 0x49, 0x68, 0x96, 0xaa, 0x19, 0x9d,
+        0xca, 0x19, 0xa4, 0x3a, 0x3e, 0xa3, 0x49, 0x4a, 0x9a, 0xd9, 0x6b, 0x86, 0x38, 0x6b, 0x86, 0xb7,
+        0x51, 0x73, 0xb7, 0x7d, 0x65, 0x46, 0x50, 0x64, 0x95, 0xc2, 0x60, 0x55, 0xca, 0x5e, 0x95, 0xcd,
+        0x5d, 0x26, 0xfe, 0x6a, 0xb6, 0xee, 0x7b, 0x37, 0x99, 0x79, 0x58, 0x7f, 0x8b, 0x28, 0x73, 0x8a,
+        0xa8, 0xa2, 0x8a, 0xb8, 0xc6, 0x88, 0xb8, 0xcd, 0x7a, 0xd7, 0xdb, 0x7d, 0x36, 0x87, 0x6d, 0x16,
+        0x93, 0x57, 0x45, 0x90, 0x59, 0x25, 0x1f, 0x4d, 0x55, 0x15, 0x51, 0x55, 0x24, 0x51, 0xc5, 0x76,
+        0x59, 0x85, 0x5c, 0x6a, 0x66, 0x96, 0x69, 0xb7, 0xbe, 0x76, 0x67, 0xa2, 0x89, 0xa8, 0x92, 0x89,
+        0x08, 0x4e, 0x89, 0x08, 0x52, 0x81, 0xf8, 0x29, 0x82, 0x87, 0x33, 0x71, 0x67, 0x52, 0x65, 0xe6,
+        0x6d, 0x66, 0x65, 0x52, 0x5a, 0xc5, 0x6d, 0x56, 0x25, 0x46, 0x54, 0xd6, 0x02, 0x5c, 0x76, 0x05,
+        0x52, 0xa5, 0x3a, 0x54, 0x05, 0x74, 0x59, 0x85, 0x57, 0x64, 0xa6, 0x42, 0x64, 0x57, 0xb6, 0x74,
+        0xc7, 0x8c, 0x8c, 0x88, 0xbf, 0x8b, 0xc9, 0x25, 0x95, 0x29, 0x13, 0x96, 0x29, 0x69, 0x96, 0xb8,
+        0xd7, 0x8a, 0x88, 0xea, 0x81, 0xc8, 0x36, 0x83, 0x76, 0xce, 0x71, 0xe6, 0xe1, 0x68, 0xf6, 0x97,
+        0x69, 0x36, 0x9d, 0x66, 0xa6, 0xa5, 0x77, 0x47, 0x58, 0x75, 0x28, 0x39, 0x86, 0xb8, 0x2b, 0x98,
+        0xc9, 0x63, 0x96, 0x2a, 0x90, 0xa5, 0x6a, 0x94, 0xac, 0xca, 0xc4, 0xab, 0xea, 0x55, 0xab, 0x5a,
+        0x74, 0x97, 0x09, 0x77, 0x98, 0x08, 0xcc, 0x8a, 0x88, 0xe8, 0x7c, 0x57, 0xce, 0x7c, 0x87, 0x77,
+        0x7a, 0xf7, 0x6c, 0x79, 0x97, 0x91, 0x79, 0x48, 0xd8, 0x87, 0x48, 0xb4, 0x9a, 0x99, 0xa0, 0x99,
+        0xda, 0x8b, 0xaa, 0xda, 0x6d, 0xaf, 0x0a, 0xff, 0xaf, 0xdb, 0x04, 0xab, 0xca, 0xf9, 0xa3, 0x3a,
+        0x53, 0xa5, 0x28, 0xcb, 0x91, 0x58, 0xdc, 0x7d, 0xf8, 0x05, 0x80, 0x07, 0x39, 0x70, 0x37, 0x37,
+        0x74, 0x37, 0x3f, 0x74, 0x17, 0x50, 0x77, 0xf7, 0x3e, 0x87, 0xa8, 0x5e, 0x85, 0xa9, 0x68, 0x91,
+        0x39, 0x5a, 0xa1, 0xba, 0x0b, 0xa0, 0x79, 0xc5, 0xa1, 0x69, 0xdf, 0x95, 0x89, 0x57, 0x95, 0x48,
+        0x68, 0x84, 0xd8, 0x92, 0x72, 0x77, 0x32, 0x72, 0xc6, 0x09, 0x66, 0x26, 0x20, 0x58, 0xd5, 0x7f,
+        0x58, 0x36, 0x1c, 0x5d, 0xa6, 0x16, 0x69, 0xd6, 0x86, 0x68, 0x17, 0x9b, 0x7b, 0xf7, 0x78, 0x83,
+        0xa8, 0x2b, 0x82, 0xe8, 0xfd, 0x8b, 0x38, 0xf4, 0x87, 0xa8, 0x8f, 0x88, 0xd7, 0x9a, 0x7e, 0x67,
+        0xa4, 0x67, 0x66, 0x94, 0x69, 0xa5, 0xab, 0x57, 0x25, 0xb0, 0x50, 0x25, 0x22, 0x51, 0xa4, 0xcf,
+        0x4f, 0x54, 0xb8, 0x5a, 0x25, 0x92, 0x59, 0x16, 0xb1, 0x65, 0x16, 0x94, 0x7e, 0x37, 0xd7, 0x7d,
+        0x08, 0x35, 0x87, 0x08, 0x2c, 0x8a, 0xa8, 0xa8, 0x8a, 0x88, 0x31, 0x80, 0xc8, 0x45, 0x77, 0x67,
+        0x86, 0x78, 0x16, 0x20, 0x68, 0x46, 0x43, 0x5a, 0x05, 0x94, 0x59, 0x65, 0x9c, 0x56, 0x75, 0xaf,
+        0x58, 0xb5, 0xa8, 0x5a, 0x35, 0x34, 0x56, 0x55, 0x29, 0x58, 0x05, 0x89, 0x58, 0x66, 0xa8, 0x64,
+        0x66, 0x88, 0x7d, 0x27, 0xcb, 0x7c, 0x78, 0xa3, 0x8c, 0x38, 0x83, 0x97, 0x69, 0x79, 0x97, 0xe9,
+        0x7e, 0x94, 0xd9, 0x8b, 0x92, 0x09, 0x33, 0x93, 0x47, 0xcf, 0x82, 0x27, 0xe8, 0x73, 0x17, 0x3e,
+        0x73, 0xc6, 0xa5, 0x67, 0xf6, 0xbc, 0x6e, 0x76, 0xd3, 0x6d, 0x37, 0x3c, 0x77, 0xe7, 0x3d, 0x87,
+        0xe8, 0x55, 0x85, 0x89, 0xd0, 0x98, 0xb9, 0xce, 0xa9, 0x9a, 0x85, 0xa7, 0xea, 0xca, 0xb1, 0x4a,
+        0xd2, 0xa5, 0x6a, 0x5a, 0xa6, 0x29, 0xdb, 0x9b, 0x89, 0xfd, 0x89, 0xa8, 0xa7, 0x8a, 0xd7, 0xcb,
+        0x81, 0x77, 0xd8, 0x75, 0x07, 0x50, 0x75, 0x38, 0x06, 0x7a, 0xa7, 0xec, 0x89, 0xb8, 0x92, 0x89,
+        0x09, 0xa1, 0x9b, 0xb9, 0x70, 0xa7, 0xca, 0x76, 0xa7, 0x3b, 0x28, 0xad, 0x1b, 0x17, 0xae, 0x2b,
+        0x04, 0xaf, 0xe9, 0xda, 0xa2, 0x09, 0xde, 0x8e, 0x09, 0x02, 0x90, 0x57, 0xd0, 0x7a, 0xa7, 0xe1,
+        0x74, 0x27, 0x4d, 0x74, 0xd6, 0xb8, 0x6f, 0x46, 0xb3, 0x77, 0x67, 0x5e, 0x75, 0xe8, 0x52, 0x80,
+        0xc8, 0x47, 0x96, 0x09, 0x43, 0x94, 0x09, 0xa4, 0x9e, 0x39, 0xa4, 0x9d, 0x39, 0xc1, 0x9c, 0x89,
+        0x5b, 0x93, 0xf9, 0x81, 0x83, 0x78, 0x47, 0x84, 0x06, 0xe5, 0x74, 0x47, 0x05, 0x5d, 0x75, 0xdd,
+        0x5e, 0x05, 0xc6, 0x59, 0x35, 0xd3, 0x5b, 0xa5, 0xb2, 0x5a, 0xe6, 0x80, 0x6a, 0x26, 0x68, 0x74,
+        0xa7, 0x35, 0x73, 0x78, 0x8f, 0x83, 0x38, 0x71, 0x8a, 0x88, 0xb5, 0x8a, 0x98, 0x60, 0x8a, 0x08,
+        0x5e, 0x78, 0x47, 0xa8, 0x7a, 0xa6, 0xae, 0x67, 0xd6, 0xb8, 0x59, 0xb5, 0xc1, 0x5b, 0x94, 0xbe,
+        0x4f, 0xa4, 0xbb, 0x4f, 0xa4, 0xf2, 0x4f, 0x85, 0xa7, 0x54, 0xf5, 0x88, 0x6d, 0x96, 0xc9, 0x6b,
+        0xd7, 0x83, 0x7a, 0x97, 0x6e, 0x88, 0x98, 0x7a, 0x87, 0xe8, 0xb1, 0x88, 0x68, 0xc6, 0x87, 0x58,
+        0x7b, 0x87, 0x77, 0x35, 0x79, 0xe7, 0x5c, 0x66, 0xc6, 0x72, 0x67, 0xb5, 0xdc, 0x5c, 0x15, 0xfe,
+        0x66, 0x26, 0x84, 0x68, 0x95, 0x91, 0x5c, 0x95, 0x8a, 0x54, 0x55, 0x50, 0x55, 0x85, 0xe5, 0x58,
+        0x85, 0xca, 0x6c, 0xe6, 0xc0, 0x6b, 0xf7, 0xb8, 0x7d, 0x17, 0x92, 0x8f, 0xb8, 0xf2, 0x8e, 0xe9,
+        0xa7, 0x95, 0x99, 0x99, 0x9d, 0x19, 0xde, 0x9d, 0xe8, 0xcd, 0x92, 0x58, 0xe9, 0x82, 0x98, 0x42,
+        0x84, 0x87, 0x45, 0x72, 0xb7, 0x68, 0x6e, 0x36, 0xec, 0x6e, 0x86, 0xab, 0x6f, 0x26, 0xb5, 0x78,
+        0x97, 0x5f, 0x76, 0x18, 0xc6, 0x87, 0xd8, 0xbf, 0x9e, 0x19, 0xc1, 0x9b, 0xba, 0x9d, 0xad, 0x9a,
+        0x93, 0xac, 0xba, 0xbe, 0xab, 0xfa, 0xc2, 0xa9, 0xaa, 0xdd, 0x9a, 0x69, 0xc0, 0x9c, 0x18, 0xa6,
+        0x8f, 0x48, 0xc0, 0x7a, 0x07, 0xb7, 0x7b, 0xc7, 0xb8, 0x77, 0x67, 0xaf, 0x7c, 0x57, 0xc6, 0x7c,
+        0x78, 0x8d, 0x8a, 0x28, 0x61, 0x98, 0x59, 0x7b, 0x97, 0x8a, 0xb3, 0xa4, 0xca, 0x8b, 0xb0, 0x4b,
+        0x1c, 0xb1, 0x4a, 0x91, 0xad, 0x1a, 0x8d, 0x9e, 0xea, 0x07, 0xa1, 0x38, 0xd5, 0x8a, 0x88, 0xe8,
+        0x7d, 0xc7, 0xfc, 0x7f, 0x06, 0xba, 0x70, 0x46, 0xc0, 0x6e, 0x56, 0xd3, 0x6d, 0x57, 0x51, 0x70,
+        0x97, 0x4b, 0x85, 0x98, 0x38, 0x83, 0x18, 0xe1, 0x91, 0xf8, 0xe0, 0x9a, 0x49, 0x89, 0x98, 0xa9,
+        0xd0, 0x9a, 0x09, 0xe3, 0x92, 0x99, 0x32, 0x92, 0xb7, 0xf1, 0x85, 0xa8, 0x1a, 0x6b, 0x16, 0xbb,
+        0x6c, 0x36, 0x15, 0x5e, 0xc6, 0x2a, 0x56, 0x75, 0x69, 0x56, 0x25, 0xa5, 0x5d, 0x05, 0x8e, 0x63,
+        0x66, 0x1c, 0x62, 0x77, 0x9b, 0x73, 0x77, 0x7f, 0x83, 0x28, 0x31, 0x82, 0xb8, 0x95, 0x8b, 0xd8,
+        0x75, 0x84, 0x68, 0x5f, 0x86, 0x17, 0xc0, 0x78, 0x87, 0xc8, 0x69, 0xd6, 0xce, 0x6c, 0x95, 0x5b,
+        0x5a, 0x05, 0x64, 0x4f, 0x24, 0xfa, 0x50, 0x75, 0x02, 0x4b, 0x84, 0xf6, 0x5c, 0xa5, 0xc0, 0x5b,
+        0x86, 0x71, 0x69, 0x76, 0x58, 0x7d, 0x07, 0xae, 0x7b, 0x78, 0x96, 0x85, 0x88, 0x9b, 0x8f, 0x38,
+        0xf4, 0x8e, 0x88, 0x33, 0x89, 0x28, 0x4f, 0x78, 0xc7, 0x8f, 0x79, 0x26, 0xb1, 0x69, 0xc6, 0xde,
+        0x76, 0xa7, 0x97, 0x79, 0x36, 0x65, 0x6a, 0xf6, 0x6e, 0x59, 0x15, 0xb5, 0x5b, 0x15, 0x9b, 0x54,
+        0xc5, 0x89, 0x60, 0x16, 0x02, 0x5f, 0xa6, 0xac, 0x6c, 0x66, 0x8c, 0x81, 0x17, 0xfe, 0x80, 0x29,
+        0x2c, 0x8d, 0x29, 0x10, 0x9f, 0x59, 0xed, 0x9e, 0xe9, 0x81, 0x9d, 0x19, 0x91, 0x93, 0x99, 0x41,
+        0x94, 0x18, 0x46, 0x82, 0xc8, 0x69, 0x78, 0xb7, 0x95, 0x79, 0x26, 0xaf, 0x70, 0x36, 0xc7, 0x6f,
+        0x36, 0xdc, 0x6d, 0xf7, 0xcd, 0x78, 0xb7, 0xc9, 0x8d, 0x68, 0xb0, 0x8a, 0xe9, 0xd9, 0xa1, 0x29,
+        0xcc, 0xa9, 0x8a, 0x87, 0xa8, 0x9b, 0x3d, 0xb0, 0x4b, 0x41, 0xa9, 0x0a, 0xa1, 0xa9, 0xe9, 0xb4,
+        0xa0, 0x69, 0xc7, 0x87, 0x78, 0x91, 0x89, 0x98, 0x0d, 0x7d, 0x68, 0x13, 0x77, 0xd7, 0x92, 0x78,
+        0x57, 0xb7, 0x7d, 0xf7, 0x9e, 0x87, 0x28, 0x6b, 0x87, 0x09, 0xc1, 0x95, 0x89, 0x98, 0xa9, 0x2a,
+        0x90, 0xa9, 0x6a, 0xbe, 0xae, 0xca, 0xaa, 0xaa, 0xba, 0xb6, 0xab, 0xc9, 0xe1, 0x9b, 0x09, 0xed,
+        0x8d, 0xe8, 0xfe, 0x8f, 0xa7, 0x51, 0x7a, 0x97, 0x6c, 0x6e, 0x16, 0xe1, 0x6e, 0x46, 0xb6, 0x67,
+        0xd6, 0xbd, 0x75, 0x97, 0x3c, 0x73, 0x27, 0xd9, 0x81, 0x17, 0xce, 0x8e, 0xf8, 0xc4, 0x8c, 0xd9,
+        0xa9, 0x96, 0xe9, 0xb0, 0x9a, 0x69, 0x96, 0x99, 0xc8, 0xe4, 0x93, 0xf8, 0xfb, 0x7c, 0x57, 0xd4,
+        0x7d, 0x76, 0xf2, 0x6c, 0xa7, 0x09, 0x5b, 0x55, 0xc4, 0x5c, 0x55, 0x50, 0x58, 0xb5, 0x53, 0x55,
+        0xc5, 0x4d, 0x55, 0x46, 0x89, 0x62, 0x46, 0x66, 0x74, 0x77, 0x3c, 0x73, 0x88, 0x1d, 0x83, 0x67,
+        0xfa, 0x87, 0x58, 0x78, 0x87, 0xa8, 0x81, 0x83, 0xe8, 0x7e, 0x7a, 0xe7, 0xd9, 0x7d, 0x36, 0x62,
+        0x6a, 0xa6, 0x6c, 0x58, 0x95, 0xa3, 0x5a, 0x74, 0xf9, 0x4b, 0xf5, 0x02, 0x52, 0x95, 0x2b, 0x52,
+        0x85, 0x66, 0x59, 0x15, 0x52, 0x6c, 0x06, 0xa2, 0x6a, 0x17, 0xd7, 0x78, 0x97, 0xcc, 0x8c, 0xb8,
+        0xb8, 0x8b, 0xe8, 0xaa, 0x90, 0x28, 0xbf, 0x88, 0x78, 0x80, 0x88, 0x27, 0xcd, 0x7b, 0xe7, 0xf8,
+        0x85, 0x78, 0x6c, 0x87, 0x17, 0x71, 0x7b, 0x67, 0x79, 0x66, 0x76, 0x91, 0x68, 0xb5, 0xed, 0x5a,
+        0xc5, 0xe8, 0x5a, 0xf5, 0xb8, 0x5c, 0x15, 0xd9, 0x60, 0x75, 0xc0, 0x70, 0x16, 0xf4, 0x6f, 0x28,
+        0x3f, 0x7e, 0x08, 0x23, 0x97, 0xd9, 0x6b, 0x96, 0xa9, 0xaa, 0x9e, 0x29, 0xa7, 0x9e, 0xd9, 0xe9,
+        0x9e, 0xc9, 0x4d, 0x92, 0xd9, 0x6e, 0x88, 0x98, 0x93, 0x88, 0xf7, 0x47, 0x7a, 0xd7, 0x6c, 0x6e,
+        0xf6, 0xeb, 0x6e, 0xb7, 0x39, 0x70, 0x37, 0x40, 0x7d, 0xc7, 0xbb, 0x7b, 0x78, 0xda, 0x90, 0x08,
+        0xc4, 0x9e, 0x99, 0xbd, 0x9c, 0x4b, 0x0c, 0xac, 0x7b, 0x07, 0xb0, 0x3b, 0x05, 0xb0, 0x6a, 0x9e,
+        0xae, 0xca, 0xac, 0x98, 0x89, 0xa4, 0x9a, 0x98, 0xe6, 0x8b, 0x38, 0xef, 0x7c, 0xa7, 0xeb, 0x7e,
+        0x27, 0x65, 0x79, 0x77, 0x5d, 0x79, 0xf7, 0xa4, 0x7a, 0x78, 0xaf, 0x84, 0x98, 0x85, 0x9a, 0xa9,
+        0xa3, 0x99, 0x8a, 0x45, 0xa6, 0x0a, 0x24, 0xad, 0x4a, 0xd5, 0xad, 0x6a, 0x99, 0xa5, 0xea, 0x9d,
+        0x9e, 0xba, 0x02, 0xa0, 0xa8, 0x54, 0x8a, 0xe8, 0x70, 0x77, 0xf7, 0x7e, 0x78, 0xb6, 0xb5, 0x68,
+        0xd6, 0xca, 0x6b, 0x76, 0x9f, 0x6a, 0x46, 0xd3, 0x71, 0x16, 0xd2, 0x7e, 0x07, 0xb5, 0x7b, 0x78,
+        0xec, 0x8a, 0x48, 0xe3, 0x97, 0x69, 0x62, 0x96, 0x19, 0x5d, 0x9a, 0xe9, 0x6e, 0x8b, 0x48, 0xb7,
+        0x8b, 0xf8, 0x09, 0x7e, 0x78, 0x24, 0x68, 0xf6, 0xad, 0x6a, 0x55, 0xa3, 0x5f, 0x05, 0xb1, 0x50,
+        0x85, 0x10, 0x50, 0xc5, 0xa7, 0x55, 0x65, 0x94, 0x62, 0xa6, 0x24, 0x62, 0x67, 0x21, 0x73, 0xb6,
+        0xf7, 0x7f, 0x77, 0xee, 0x7f, 0x38, 0xac, 0x85, 0xa8, 0x97, 0x86, 0xb8, 0x8a, 0x88, 0x87, 0x73,
+        0x7b, 0x07, 0x7a, 0x69, 0x36, 0xae, 0x6b, 0x85, 0x9d, 0x56, 0xc5, 0xad, 0x52, 0x55, 0x38, 0x53,
+        0x74, 0xc6, 0x50, 0x54, 0xc4, 0x5b, 0xb5, 0x9c, 0x59, 0xf6, 0xc2, 0x67, 0x46, 0xb6, 0x81, 0x37,
+        0xf3, 0x7e, 0x58, 0x89, 0x8c, 0x88, 0x88, 0x8f, 0xe8, 0xed, 0x8f, 0x48, 0xc9, 0x8a, 0x58, 0xe5,
+        0x8c, 0x88, 0xdc, 0x8d, 0xa8, 0x56, 0x89, 0xc8, 0x59, 0x76, 0xf7, 0x9c, 0x79, 0xd6, 0xba, 0x68,
+        0x36, 0xbe, 0x5f, 0xe6, 0x1d, 0x61, 0x65, 0x89, 0x5c, 0x25, 0x81, 0x62, 0xa6, 0x23, 0x62, 0xa7,
+        0x33, 0x6d, 0xa7, 0x13, 0x89, 0x38, 0x7d, 0x87, 0xe9, 0x38, 0x96, 0x79, 0x2c, 0xa1, 0x5a, 0x0c,
+        0xa0, 0x8a, 0x09, 0x9d, 0xca, 0x1c, 0x98, 0x89, 0x98, 0x99, 0x78, 0x44, 0x8a, 0xd8, 0x72, 0x78,
+        0x57, 0x8d, 0x79, 0x17, 0x31, 0x71, 0x17, 0x45, 0x74, 0x27, 0x2e, 0x72, 0xb7, 0xd9, 0x80, 0x67,
+        0xcd, 0x8d, 0x88, 0xb5, 0x8b, 0x3a, 0x5b, 0xa0, 0x3a, 0x47, 0xae, 0x1a, 0xd3, 0xad, 0x2b, 0x16,
+        0xb5, 0x3b, 0x18, 0xa7, 0x6a, 0x8d, 0xa8, 0xa9, 0xf6, 0x9c, 0x4a, 0x02, 0x8a, 0x28, 0xc7, 0x8c,
+        0x97, 0xb7, 0x7f, 0x97, 0xb6, 0x75, 0x27, 0x5d, 0x76, 0x27, 0xdc, 0x77, 0xf7, 0xbe, 0x89, 0x38,
+        0x8d, 0x88, 0xb9, 0x55, 0x97, 0x09, 0x2e, 0xa5, 0xaa, 0x4c, 0xa5, 0x4a, 0xc6, 0xa7, 0x9a, 0xba,
+        0xaa, 0xaa, 0xb7, 0xab, 0x39, 0x5f, 0x9b, 0x99, 0x7f, 0x87, 0xf8, 0x8a, 0x89, 0x17, 0x56, 0x73,
+        0x17, 0x76, 0x6b, 0xc6, 0xbe, 0x6b, 0x46, 0x39, 0x67, 0xf6, 0x3a, 0x6d, 0x96, 0xba, 0x6b, 0x37,
+        0xdb, 0x79, 0x57, 0xd6, 0x8b, 0xd8, 0x93, 0x89, 0x59, 0x35, 0x97, 0x39, 0x34, 0x93, 0x19, 0x24,
+        0x92, 0x98, 0xf6, 0x8c, 0xb9, 0x08, 0x7a, 0x57, 0xc3, 0x7c, 0x06, 0x7c, 0x6d, 0x46, 0x98, 0x55,
+        0xa5, 0x6b, 0x57, 0x75, 0x5c, 0x51, 0x65, 0x53, 0x54, 0xd5, 0x55, 0x55, 0x46, 0x15, 0x62, 0x65,
+        0xe7, 0x70, 0x66, 0xf7, 0x6f, 0xb8, 0x30, 0x7c, 0xf8, 0x10, 0x89, 0x68, 0x9b, 0x89, 0xc8, 0x39,
+        0x86, 0xd8, 0x2f, 0x7a, 0x07, 0xc2, 0x7c, 0x46, 0xa4, 0x67, 0x96, 0xb5, 0x5c, 0xd5, 0xe8, 0x5e,
+        0x04, 0xca, 0x51, 0x14, 0xd2, 0x51, 0x95, 0x0f, 0x51, 0x65, 0xbc, 0x57, 0x65, 0xb4, 0x6f, 0x66,
+        0xda, 0x6d, 0x47, 0xc1, 0x7f, 0x67, 0xb8, 0x8c, 0xc8, 0xae, 0x8b, 0x09, 0x3a, 0x91, 0x29, 0x4d,
+        0x8b, 0x18, 0xab, 0x8a, 0xf8, 0xd5, 0x90, 0xa8, 0xca, 0x85, 0xe8, 0x82, 0x87, 0xd7, 0xc1, 0x78,
+        0xf7, 0xcd, 0x6c, 0x86, 0xea, 0x6e, 0xb5, 0xce, 0x60, 0xb5, 0xd1, 0x5d, 0x45, 0xde, 0x5e, 0x06,
+        0x60, 0x60, 0x66, 0x4b, 0x78, 0x97, 0x73, 0x77, 0x18, 0x53, 0x87, 0xf8, 0x39, 0x9a, 0x89, 0x8f,
+        0x99, 0x4a, 0x39, 0x9f, 0xfa, 0x3d, 0xa4, 0xba, 0x46, 0xa4, 0x99, 0x44, 0x9b, 0x49, 0x76, 0x88,
+        0x38, 0x8b, 0x89, 0x27, 0xcb, 0x7a, 0x97, 0xee, 0x73, 0xd7, 0x36, 0x73, 0x27, 0x38, 0x77, 0xa7,
+        0x3e, 0x7d, 0xb7, 0xb9, 0x7b, 0xe9, 0x51, 0x8f, 0xd9, 0x36, 0xa2, 0x6a, 0x0e, 0xa1, 0x3a, 0xf1,
+        0xb2, 0x2a, 0xe0, 0xaf, 0x1a, 0xf8, 0xaf, 0xba, 0xe4, 0xaa, 0x6a, 0xe6, 0x9a, 0xc9, 0xda, 0x9d,
+        0x48, 0x89, 0x8d, 0x08, 0x94, 0x7a, 0x27, 0xbb, 0x7b, 0xd7, 0x85, 0x73, 0xa7, 0x75, 0x7b, 0xf7,
+        0xc4, 0x7b, 0xf8, 0x3f, 0x85, 0xc8, 0x1b, 0x96, 0xf9, 0x5a, 0x96, 0x0a, 0x4b, 0x9f, 0x7a, 0x3c,
+        0xad, 0x3a, 0xd2, 0xac, 0xba, 0x20, 0xa6, 0xca, 0x25, 0x98, 0xa9, 0x96, 0x99, 0xc8, 0x52, 0x83,
+        0x78, 0x7f, 0x75, 0xa7, 0x5f, 0x75, 0xe6, 0x3c, 0x69, 0x16, 0x50, 0x64, 0x06, 0x22, 0x62, 0x96,
+        0xdc, 0x69, 0x66, 0xd5, 0x7a, 0xc7, 0x89, 0x78, 0x48, 0x77, 0x8a, 0xa8, 0x68, 0x90, 0x08, 0xea,
+        0x8e, 0xe9, 0x71, 0x93, 0x59, 0x76, 0x89, 0xc8, 0xaa, 0x8a, 0x57, 0x93, 0x7e, 0xd7, 0xab, 0x63,
+        0x86, 0x53, 0x65, 0x75, 0xb4, 0x57, 0x35, 0xb8, 0x50, 0x65, 0x19, 0x50, 0xc5, 0x35, 0x55, 0xa5,
+        0x1b, 0x5f, 0x05, 0xe7, 0x5e, 0x77, 0x39, 0x6d, 0x37, 0x15, 0x81, 0x28, 0x17, 0x81, 0x88, 0x4d,
+        0x88, 0x48, 0x43, 0x85, 0x98, 0x6f, 0x87, 0x37, 0xb2, 0x78, 0xa7, 0xc6, 0x6d, 0x56, 0xf2, 0x6f,
+        0x15, 0x72, 0x5c, 0x65, 0x85, 0x52, 0x65, 0x26, 0x52, 0xd5, 0x2c, 0x4e, 0x95, 0x2c, 0x5e, 0xf5,
+        0xd6, 0x5d, 0x36, 0xaa, 0x6e, 0x76, 0xa2, 0x80, 0x57, 0xda, 0x7e, 0x39, 0x06, 0x8c, 0xd9, 0x0e,
+        0x80, 0x17, 0xfb, 0x7f, 0xd8, 0xb8, 0x8d, 0xd8, 0xa0, 0x8e, 0x38, 0xef, 0x8f, 0x28, 0xb1, 0x87,
+        0xa8, 0xb7, 0x7c, 0xe7, 0xf7, 0x7f, 0x96, 0x97, 0x6e, 0x66, 0xa0, 0x61, 0x46, 0x31, 0x63, 0x55,
+        0xfd, 0x5b, 0xf5, 0xff, 0x6a, 0xf6, 0x9f, 0x6a, 0x57, 0x49, 0x76, 0xa7, 0x2d, 0x8c, 0xd8, 0xa5,
+        0x8a, 0x59, 0xcc, 0x98, 0x89, 0xc7, 0xa7, 0xba, 0x6e, 0xa7, 0x3a, 0x10, 0xa6, 0x9a, 0x2a, 0x98,
+        0x89, 0x93, 0x99, 0x38, 0xba, 0x8a, 0xa8, 0xea, 0x7c, 0xa7, 0xd2, 0x7d, 0x87, 0x2a, 0x78, 0x37,
+        0x3e, 0x73, 0xd7, 0x26, 0x72, 0x68, 0x49, 0x7f, 0xe8, 0x44, 0x92, 0x59, 0x01, 0x90, 0x3a, 0x3b,
+        0xa6, 0x5a, 0x21, 0xac, 0xea, 0xcb, 0xac, 0xdb, 0x5c, 0xb1, 0xab, 0x5a, 0xa9, 0xfa, 0xba, 0xab,
+        0xf9, 0x9f, 0x9e, 0xa9, 0xa5, 0x86, 0xc8, 0x96, 0x89, 0xb7, 0xd0, 0x79, 0x17, 0xce, 0x76, 0xa7,
+        0x72, 0x77, 0x47, 0x66, 0x78, 0xd7, 0x4e, 0x85, 0xf8, 0x4c, 0x84, 0xa9, 0x60, 0x90, 0x29, 0x45,
+        0xa5, 0xaa, 0x49, 0xa4, 0x7a, 0x4e, 0xa8, 0x9a, 0x47, 0xa4, 0x8a, 0x41, 0xa4, 0xb9, 0x62, 0x94,
+        0x69, 0x86, 0x85, 0x38, 0x71, 0x86, 0x86, 0xd0, 0x73, 0x26, 0xf6, 0x64, 0x46, 0x3a, 0x63, 0xe6,
+        0x3f, 0x60, 0xb6, 0x4a, 0x6a, 0xc6, 0x89, 0x68, 0x77, 0x69, 0x79, 0x67, 0x56, 0x84, 0x88, 0x20,
+        0x82, 0x99, 0x47, 0x8f, 0xc9, 0x37, 0x90, 0xb9, 0x17, 0x91, 0x48, 0x87, 0x8d, 0x48, 0x95, 0x75,
+        0x07, 0x6c, 0x77, 0x36, 0x91, 0x66, 0x06, 0x9a, 0x55, 0x95, 0x7e, 0x57, 0x64, 0xe7, 0x51, 0xe4,
+        0xe2, 0x51, 0x45, 0x16, 0x51, 0xc6, 0x23, 0x5b, 0xc5, 0xfb, 0x72, 0x77, 0x1d, 0x71, 0x87, 0xd1,
+        0x7e, 0xf7, 0xb4, 0x87, 0xf8, 0x7f, 0x88, 0x58, 0x73, 0x83, 0x18, 0x72, 0x7e, 0x98, 0x05, 0x7f,
+        0xd6, 0x7a, 0x6d, 0x96, 0x95, 0x5c, 0xc5, 0xd7, 0x5d, 0xd5, 0x2f, 0x50, 0x55, 0x41, 0x55, 0xf5,
+        0x4f, 0x54, 0x95, 0xab, 0x5e, 0x25, 0xa1, 0x6f, 0x06, 0xc1, 0x6c, 0x38, 0x40, 0x7f, 0x98, 0x37,
+        0x70, 0x76, 0xf7, 0x6f, 0xd8, 0x19, 0x83, 0x67, 0xf5, 0x8c, 0xe8, 0xd6, 0x8d, 0x29, 0x37, 0x8f,
+        0x09, 0x30, 0x8c, 0x28, 0xe9, 0x8d, 0xe7, 0x9b, 0x7e, 0xc7, 0xad, 0x6d, 0xa7, 0x01, 0x6f, 0xc6,
+        0x38, 0x60, 0x66, 0x43, 0x65, 0x06, 0x4b, 0x64, 0xb6, 0x65, 0x69, 0xd6, 0x5b, 0x7b, 0x57, 0x95,
+        0x79, 0x98, 0xed, 0x89, 0xb8, 0xd9, 0xa1, 0x99, 0xf9, 0x9f, 0xea, 0x48, 0xa8, 0xda, 0x4f, 0xa5,
+        0x3a, 0x4d, 0xa4, 0x99, 0xc9, 0x9a, 0xe9, 0xf4, 0x8c, 0x18, 0xd1, 0x8c, 0x97, 0xb5, 0x81, 0xb7,
+        0xdb, 0x72, 0xc7, 0x26, 0x73, 0x27, 0xaa, 0x76, 0xd7, 0xa9, 0x81, 0xe8, 0x07, 0x80, 0x89, 0x32,
+        0x95, 0x99, 0x14, 0xa1, 0x7a, 0x08, 0xa0, 0xcb, 0x3e, 0xae, 0xeb, 0x2e, 0xb1, 0xfb, 0x2f, 0xb2,
+        0xca, 0x93, 0xad, 0x1a, 0x94, 0x98, 0x29, 0xa8, 0x9a, 0x88, 0xa4, 0x86, 0xb8, 0xa6, 0x7b, 0x07,
+        0xd1, 0x7d, 0x27, 0x14, 0x74, 0x47, 0x07, 0x78, 0x27, 0x7e, 0x77, 0x88, 0x4b, 0x7f, 0x18, 0x32,
+        0x97, 0x39, 0x58, 0x95, 0x89, 0xd7, 0xa0, 0x49, 0xc4, 0xa7, 0x7a, 0x67, 0xa6, 0xaa, 0x24, 0x9f,
+        0x6a, 0x36, 0x96, 0x59, 0x75, 0x96, 0xd7, 0xd7, 0x83, 0xd8, 0x00, 0x6d, 0xd6, 0xe2, 0x6e, 0x86,
+        0x42, 0x61, 0xa6, 0x59, 0x61, 0x25, 0xfc, 0x5f, 0xd6, 0x60, 0x69, 0xb6, 0x53, 0x73, 0x47, 0x09,
+        0x70, 0xe8, 0x81, 0x82, 0xf8, 0x6a, 0x8d, 0xf8, 0xd9, 0x8c, 0xc8, 0xf6, 0x93, 0xe8, 0xf7, 0x84,
+        0x68, 0x57, 0x85, 0x57, 0xa4, 0x77, 0x47, 0xb4, 0x63, 0x86, 0x60, 0x66, 0x25, 0x44, 0x57, 0xf5,
+        0x3f, 0x4c, 0xf4, 0xd4, 0x4e, 0x15, 0x4d, 0x4f, 0x05, 0x31, 0x60, 0x76, 0x08, 0x60, 0x36, 0xdb,
+        0x6f, 0x26, 0xb8, 0x7f, 0xc7, 0xeb, 0x7f, 0x98, 0x8d, 0x84, 0x68, 0x86, 0x89, 0xc8, 0xad, 0x8a,
+        0xc7, 0x8d, 0x7e, 0x47, 0xa0, 0x6d, 0x86, 0xe3, 0x6e, 0xf5, 0xdd, 0x5b, 0xb5, 0xf9, 0x56, 0x85,
+        0x6b, 0x56, 0x85, 0x11, 0x55, 0xf5, 0x1c, 0x5e, 0xc5, 0xc3, 0x5c, 0xb7, 0x27, 0x6d, 0xb7, 0x22,
+        0x60, 0x35, 0xf8, 0x5f, 0xd7, 0x21, 0x73, 0x86, 0xf3, 0x82, 0xc8, 0x28, 0x83, 0x19, 0x2e, 0x8d,
+        0x89, 0x1a, 0x94, 0xb9, 0x66, 0x96, 0x88, 0x95, 0x8d, 0xd8, 0x9c, 0x7e, 0x98, 0x04, 0x80, 0x76,
+        0xfb, 0x6c, 0xa7, 0x0d, 0x67, 0xe6, 0x91, 0x69, 0x05, 0xfc, 0x63, 0xf5, 0xff, 0x6d, 0x86, 0xbd,
+        0x6b, 0xf7, 0xdd, 0x79, 0x07, 0xd2, 0x93, 0xe9, 0x1c, 0x91, 0x49, 0xe6, 0xa1, 0xe9, 0xe2, 0xa8,
+        0xea, 0x79, 0xa7, 0xca, 0x90, 0xa7, 0x2a, 0xaf, 0x9d, 0x09, 0xd7, 0x9d, 0x38, 0xae, 0x91, 0x38,
+        0xd7, 0x7a, 0xd7, 0xbf, 0x7c, 0x07, 0x96, 0x76, 0x87, 0xad, 0x77, 0x17, 0x6e, 0x76, 0xc8, 0x35,
+        0x85, 0x98, 0x1f, 0x91, 0x68, 0xfe, 0x8f, 0xea, 0x8f, 0xa3, 0x2a, 0x72, 0xb0, 0x5b, 0x09, 0xb0,
+        0x4b, 0x15, 0xb4, 0x6b, 0x05, 0xa7, 0x8a, 0x97, 0xa9, 0x79, 0xb7, 0x97, 0xe9, 0xc0, 0x88, 0x58,
+        0xaa, 0x8a, 0x77, 0x58, 0x79, 0xe7, 0x59, 0x73, 0x17, 0x2a, 0x73, 0x27, 0x72, 0x71, 0xf7, 0x5c,
+        0x85, 0xa8, 0x45, 0x84, 0x58, 0xe8, 0x91, 0x08, 0xd5, 0x9f, 0xe9, 0xe7, 0x9e, 0x9a, 0x4c, 0xa1,
+        0x4a, 0x56, 0xa2, 0x4a, 0x26, 0xa2, 0x38, 0xe5, 0x94, 0xa9, 0x0c, 0x7d, 0x97, 0xeb, 0x7e, 0x76,
+        0xdf, 0x6b, 0xd6, 0xff, 0x61, 0x06, 0x06, 0x60, 0x65, 0xcd, 0x60, 0xb5, 0xce, 0x63, 0x76, 0x13,
+        0x61, 0x27, 0x71, 0x71, 0xd7, 0x5d, 0x82, 0x38, 0x0d, 0x80, 0x68, 0xcf, 0x8f, 0xb8, 0xba, 0x8b,
+        0x68, 0xbc, 0x8c, 0x08, 0x99, 0x85, 0xb8, 0xa0, 0x75, 0x37, 0x7c, 0x77, 0xc6, 0x25, 0x66, 0x56,
+        0x2d, 0x52, 0x45, 0x3d, 0x54, 0x55, 0x04, 0x4b, 0xa4, 0xf2, 0x53, 0x05, 0x35, 0x53, 0x65, 0xc4,
+        0x5d, 0xd5, 0x9b, 0x6f, 0xf6, 0xef, 0x6f, 0x08, 0x0c, 0x7b, 0x17, 0xf1, 0x8b, 0x68, 0xbd, 0x8b,
+        0x78, 0x43, 0x88, 0x88, 0x4d, 0x7e, 0xc7, 0xf6, 0x7f, 0x56, 0xeb, 0x6c, 0xc7, 0x11, 0x61, 0x66,
+        0x26, 0x62, 0x45, 0x2b, 0x57, 0xe5, 0x45, 0x55, 0xb5, 0x41, 0x54, 0xe6, 0x23, 0x5e, 0x26, 0x1f
+    },
+    {
+        0x91, 0xf9, 0x21, 0x92, 0x39, 0x24, 0x95, 0xc9, 0x1a, 0x87, 0xf8, 0xa6, 0x8a, 0x67, 0xbf, 0x79,
+        0x17, 0xd3, 0x6a, 0x56, 0xd1, 0x6c, 0xd5, 0x8f, 0x5c, 0xe5, 0x93, 0x57, 0xb5, 0x84, 0x58, 0x65,
+        0xea, 0x59, 0x85, 0xd3, 0x71, 0x16, 0xf8, 0x6f, 0x97, 0xf6, 0x81, 0x47, 0xdd, 0x98, 0x69, 0x5e,
+        0x96, 0x2a, 0x66, 0xa2, 0x5a, 0x67, 0xad, 0x6a, 0xcc, 0xac, 0xda, 0x18, 0xa7, 0x6a, 0x43, 0x95,
+        0xd9, 0x67, 0x96, 0x78, 0x69, 0x85, 0xb8, 0x98, 0x76, 0x47, 0x71, 0x77, 0x56, 0xce, 0x72, 0x46,
+        0xe5, 0x6e, 0x76, 0xce, 0x6d, 0x78, 0x0f, 0x7b, 0xa7, 0xfb, 0x8f, 0xb8, 0xd8, 0x8d, 0x7a, 0x37,
+        0xa5, 0xea, 0x19, 0xaf, 0xca, 0xf0, 0xae, 0xfb, 0xc5, 0xb7, 0xbb, 0xbc, 0xb2, 0xeb, 0x4e, 0xb4,
+        0xaa, 0x3a, 0xa8, 0x8a, 0x45, 0x8e, 0xd9, 0x1b, 0x92, 0x68, 0x06, 0x7d, 0x68, 0x11, 0x73, 0x27,
+        0x4f, 0x74, 0x76, 0xc2, 0x6e, 0xb6, 0xae, 0x76, 0xe7, 0x59, 0x75, 0x98, 0x60, 0x7f, 0xb8, 0x3c,
+        0x99, 0xf9, 0x87, 0x98, 0x3a, 0x1c, 0xa4, 0xaa, 0x09, 0xac, 0xea, 0xbe, 0xab, 0xfa, 0x81, 0xa5,
+        0x8a, 0x98, 0x9c, 0x69, 0xd6, 0x9c, 0xc8, 0x1a, 0x89, 0x58, 0x4e, 0x6f, 0x87, 0x01, 0x70, 0x96,
+        0x14, 0x5f, 0x86, 0x3b, 0x5a, 0x35, 0x93, 0x58, 0xe5, 0xbd, 0x5f, 0x65, 0xac, 0x67, 0x96, 0x50,
+        0x64, 0x77, 0xe4, 0x78, 0xf7, 0xcc, 0x8a, 0x18, 0x8d, 0x88, 0x99, 0x39, 0x97, 0x09, 0x2b, 0x90,
+        0x49, 0x11, 0x91, 0x48, 0xbc, 0x88, 0xc8, 0xc3, 0x75, 0x77, 0x8b, 0x78, 0x76, 0x06, 0x65, 0xb6,
+        0x12, 0x4e, 0xc5, 0x12, 0x51, 0x34, 0xac, 0x46, 0x04, 0xa5, 0x4c, 0x64, 0xce, 0x4c, 0x95, 0x4e,
+        0x56, 0x65, 0x25, 0x6a, 0x06, 0x87, 0x68, 0xc7, 0xdd, 0x77, 0x97, 0xbd, 0x8d, 0xf8, 0xd3, 0x8d,
+        0x38, 0xb9, 0x8f, 0xf8, 0xbf, 0x8a, 0x88, 0xb4, 0x8b, 0x77, 0xbf, 0x7a, 0x97, 0xe2, 0x6c, 0x56,
+        0xd9, 0x6d, 0x25, 0x66, 0x5c, 0xd5, 0x93, 0x50, 0x65, 0x08, 0x50, 0x55, 0x49, 0x51, 0x55, 0x54,
+        0x8a, 0xc8, 0xa1, 0x89, 0xd9, 0x35, 0x96, 0x39, 0x1c, 0x91, 0xa9, 0x39, 0x93, 0x88, 0xb2, 0x87,
+        0xe8, 0xbb, 0x7a, 0x47, 0xd0, 0x7d, 0x16, 0x4d, 0x6a, 0x46, 0x65, 0x5c, 0x15, 0xd6, 0x5d, 0x95,
+        0x9f, 0x55, 0xe5, 0x9b, 0x64, 0xd6, 0x45, 0x63, 0xf6, 0xf8, 0x71, 0xe6, 0xde, 0x89, 0x48, 0x6c,
+        0x86, 0xd9, 0xce, 0x98, 0x29, 0xb9, 0xac, 0x1a, 0xb3, 0xaa, 0x7a, 0x8f, 0xae, 0x2a, 0xa9, 0xa3,
+        0xca, 0x43, 0xa4, 0xd9, 0x72, 0x96, 0x49, 0x9c, 0x84, 0x78, 0x54, 0x85, 0x57, 0x3c, 0x79, 0xc7,
+        0x5c, 0x6c, 0x46, 0xbb, 0x6c, 0x07, 0x66, 0x71, 0xd7, 0x5d, 0x80, 0x07, 0xe9, 0x7e, 0x29, 0x3a,
+        0x95, 0x69, 0x13, 0xa4, 0x8a, 0x20, 0xa2, 0xeb, 0x7f, 0xb2, 0xab, 0x6d, 0xb8, 0x1b, 0x91, 0xb9,
+        0x3b, 0x04, 0xb4, 0x1b, 0x09, 0x9f, 0x8a, 0x25, 0xa2, 0x18, 0xfb, 0x8c, 0xf9, 0x0b, 0x7c, 0x07,
+        0xf7, 0x7e, 0xa6, 0xc9, 0x70, 0xc6, 0xcc, 0x6d, 0xe6, 0xdd, 0x6e, 0x87, 0x75, 0x71, 0x97, 0x54,
+        0x89, 0x68, 0x80, 0x87, 0x69, 0x42, 0x96, 0x49, 0x28, 0xa6, 0x9a, 0x42, 0xa4, 0xca, 0xab, 0xa7,
+        0x4a, 0xb4, 0xa6, 0xda, 0x78, 0xa7, 0x09, 0x24, 0x98, 0x99, 0x48, 0x7f, 0xb8, 0x0c, 0x81, 0x16,
+        0xd3, 0x6c, 0x17, 0x00, 0x5d, 0x55, 0xda, 0x5d, 0x05, 0x5a, 0x5a, 0x85, 0x68, 0x5a, 0x15, 0x7c,
+        0x58, 0x36, 0xdb, 0x68, 0x06, 0xba, 0x7b, 0x27, 0x8f, 0x78, 0xd8, 0xb1, 0x8d, 0x98, 0x89, 0x90,
+        0x18, 0xfb, 0x8f, 0xe9, 0x4e, 0x90, 0xe9, 0x4d, 0x84, 0xc8, 0x72, 0x87, 0x37, 0x15, 0x76, 0x97,
+        0x2a, 0x5c, 0x75, 0xf1, 0x5e, 0xb5, 0x0a, 0x4d, 0x05, 0x0f, 0x48, 0xc4, 0xa8, 0x4a, 0x24, 0x95,
+        0x4b, 0x64, 0x79, 0x59, 0x85, 0x88, 0x58, 0xa6, 0xdc, 0x67, 0x36, 0xb0, 0x82, 0xd8, 0x1a, 0x81,
+        0x18, 0x90, 0x8c, 0x18, 0x84, 0x91, 0x39, 0x0c, 0x90, 0xc8, 0x9d, 0x87, 0xb8, 0xba, 0x7d, 0xd7,
+        0xe7, 0x7e, 0xa6, 0x5c, 0x6c, 0x86, 0x8c, 0x59, 0x25, 0x98, 0x59, 0xd5, 0x42, 0x51, 0x75, 0x5c,
+        0x7d, 0x77, 0xc7, 0x7c, 0xa8, 0xd7, 0x8f, 0x18, 0xad, 0x94, 0x79, 0x55, 0x95, 0x69, 0x5e, 0x92,
+        0x19, 0x68, 0x89, 0xd8, 0xc3, 0x8c, 0x67, 0x43, 0x79, 0xe7, 0x5c, 0x66, 0xd6, 0x95, 0x69, 0x65,
+        0xd0, 0x59, 0xc5, 0xda, 0x5f, 0x75, 0xf3, 0x5e, 0xe6, 0x2a, 0x65, 0x16, 0x13, 0x79, 0x27, 0x74,
+        0x76, 0xd8, 0xe7, 0x89, 0x08, 0xcd, 0xa4, 0x0a, 0x18, 0xa1, 0x6a, 0x94, 0xad, 0xca, 0x9c, 0xac,
+        0x6a, 0xc5, 0xac, 0xda, 0x62, 0xa4, 0x3a, 0x83, 0x94, 0xa9, 0x5c, 0x95, 0xb8, 0x03, 0x87, 0xa8,
+        0x38, 0x72, 0x27, 0x27, 0x72, 0xa7, 0x32, 0x6f, 0xb7, 0x38, 0x74, 0xc7, 0x38, 0x73, 0x68, 0x37,
+        0x85, 0x78, 0x17, 0x94, 0xa9, 0x23, 0x92, 0x8a, 0xd6, 0xa6, 0xda, 0xb8, 0xb5, 0xab, 0x56, 0xb5,
+        0x8b, 0x6c, 0xba, 0x0b, 0x62, 0xad, 0x2a, 0xf5, 0xaf, 0x8a, 0x05, 0x9d, 0x3a, 0x16, 0x8a, 0xf8,
+        0xe1, 0x8d, 0xe7, 0x4c, 0x79, 0xb7, 0x53, 0x6d, 0x56, 0xe3, 0x6e, 0xb6, 0xdc, 0x69, 0x46, 0xcb,
+        0x7a, 0x77, 0x89, 0x78, 0xb8, 0x41, 0x85, 0xf8, 0x18, 0x99, 0x39, 0x72, 0x97, 0x2a, 0x5a, 0xa0,
+        0xda, 0x4f, 0xab, 0x7a, 0xab, 0xaa, 0x69, 0xe3, 0xa3, 0xda, 0x00, 0x90, 0x29, 0x07, 0x91, 0x27,
+        0xd1, 0x7c, 0x58, 0x05, 0x68, 0x06, 0x8b, 0x68, 0x75, 0x74, 0x5d, 0x25, 0x93, 0x52, 0xf5, 0x19,
+        0x51, 0xe5, 0xfb, 0x5a, 0xa5, 0xe3, 0x6a, 0x36, 0x87, 0x68, 0x47, 0xc5, 0x7d, 0xd7, 0x9e, 0x88,
+        0x58, 0x70, 0x87, 0x19, 0x5d, 0x91, 0x49, 0x51, 0x8e, 0xc9, 0x05, 0x8f, 0xf8, 0x0c, 0x85, 0xf8,
+        0x23, 0x6d, 0x16, 0xfe, 0x70, 0x25, 0xd9, 0x5a, 0x45, 0xe3, 0x4d, 0xe5, 0x06, 0x4f, 0xd4, 0x49,
+        0x47, 0xd4, 0x41, 0x4d, 0x74, 0xc5, 0x4c, 0x55, 0xcf, 0x56, 0xb5, 0xa4, 0x72, 0xd7, 0x0d, 0x70,
+        0xc7, 0xec, 0x80, 0xc7, 0xd0, 0x8f, 0x98, 0xe3, 0x8e, 0xa9, 0x13, 0x8e, 0xd9, 0x29, 0x8c, 0x08,
+        0xd1, 0x8c, 0x57, 0x70, 0x7d, 0xa7, 0x97, 0x67, 0xb6, 0x88, 0x69, 0x25, 0xc1, 0x5a, 0x25, 0xe5,
+        0x6d, 0xe6, 0xcc, 0x6c, 0xd8, 0x19, 0x82, 0x47, 0xeb, 0x90, 0x08, 0xff, 0x8f, 0xc9, 0xa9, 0x95,
+        0x99, 0x99, 0x95, 0xd9, 0x82, 0x97, 0xa8, 0x41, 0x89, 0x98, 0x5b, 0x75, 0xd7, 0x8b, 0x78, 0xe6,
+        0x6b, 0x64, 0xb6, 0x84, 0x60, 0x86, 0x10, 0x61, 0x55, 0xad, 0x5e, 0xb5, 0xae, 0x6b, 0x06, 0x98,
+        0x69, 0x67, 0xe1, 0x78, 0xa7, 0xce, 0x96, 0x39, 0x35, 0x92, 0xca, 0x26, 0xa5, 0xda, 0x1e, 0xae,
+        0x2a, 0xd0, 0xad, 0x1a, 0xff, 0xad, 0x6b, 0x1c, 0xa4, 0x0a, 0x4a, 0xa4, 0x69, 0x0f, 0x97, 0xa9,
+        0x36, 0x7d, 0xb7, 0xf5, 0x7f, 0x57, 0x76, 0x74, 0x97, 0x8b, 0x6f, 0xa6, 0xfb, 0x6f, 0x97, 0x72,
+        0x79, 0xc7, 0x5f, 0x83, 0xf8, 0x25, 0x82, 0xb9, 0xe3, 0x97, 0x89, 0xb8, 0xab, 0xda, 0xaf, 0xab,
+        0x5b, 0x57, 0xb8, 0x0b, 0x40, 0xb4, 0xfb, 0x61, 0xb6, 0xba, 0xe2, 0xab, 0x5a, 0xec, 0x9b, 0xc9,
+        0xef, 0x9e, 0x78, 0x29, 0x88, 0x28, 0x40, 0x74, 0x37, 0x60, 0x76, 0x56, 0xbd, 0x67, 0xe6, 0xb8,
+        0x6f, 0x56, 0xf6, 0x6f, 0x37, 0x3d, 0x76, 0x47, 0x21, 0x89, 0x68, 0x6a, 0x86, 0xd9, 0x9d, 0x94,
+        0x39, 0x88, 0xa7, 0x0a, 0x5a, 0xa5, 0x7a, 0x30, 0xa8, 0x1a, 0x45, 0x9c, 0xf9, 0xcf, 0x9d, 0x08,
+        0xdf, 0x8c, 0xb9, 0x09, 0x77, 0x67, 0x8b, 0x78, 0x56, 0x15, 0x67, 0x86, 0x37, 0x54, 0x15, 0x3b,
+        0x53, 0xc5, 0x76, 0x53, 0x05, 0x71, 0x5b, 0xa5, 0x9d, 0x59, 0xa6, 0xb2, 0x6d, 0x06, 0x91, 0x7a,
+        0x97, 0x86, 0x78, 0xc8, 0xf3, 0x89, 0x88, 0xd5, 0x91, 0x59, 0x24, 0x91, 0xa8, 0xc1, 0x90, 0x28,
+        0xbc, 0x7d, 0x57, 0xfb, 0x7f, 0xc6, 0xe2, 0x6b, 0x46, 0xf4, 0x59, 0xb5, 0xcf, 0x5c, 0x94, 0x8c,
+        0x4c, 0xe4, 0x8b, 0x47, 0x84, 0x7f, 0x47, 0xb4, 0xf7, 0x4a, 0x04, 0xdc, 0x61, 0xd6, 0x02, 0x5f,
+        0x96, 0xf3, 0x71, 0x26, 0xcb, 0x86, 0x08, 0x3d, 0x84, 0x09, 0x12, 0x8d, 0x39, 0x12, 0x95, 0x09,
+        0x50, 0x94, 0x78, 0x61, 0x8c, 0xb8, 0x83, 0x78, 0xe7, 0x9d, 0x7a, 0x66, 0x97, 0x68, 0xc6, 0xc5,
+        0x5e, 0x85, 0xd8, 0x5d, 0x87, 0x1b, 0x73, 0x46, 0xeb, 0x85, 0x58, 0x42, 0x84, 0x69, 0x77, 0x91,
+        0x49, 0x5a, 0x9b, 0xb9, 0xca, 0x9d, 0x09, 0x18, 0x95, 0xb9, 0x1e, 0x86, 0xa8, 0x86, 0x88, 0xf7,
+        0x5b, 0x72, 0xd7, 0x74, 0x69, 0x26, 0xa8, 0x6a, 0xb5, 0xad, 0x5f, 0x85, 0xb6, 0x62, 0x16, 0x17,
+        0x61, 0x86, 0xf4, 0x6a, 0x86, 0xed, 0x85, 0xa8, 0x2e, 0x82, 0xa9, 0x55, 0x97, 0xf9, 0x43, 0xa8,
+        0x9a, 0x68, 0xa6, 0x5b, 0x30, 0xb0, 0x2b, 0x3e, 0xaf, 0x0a, 0xef, 0xae, 0xea, 0x0b, 0xa7, 0x1a,
+        0x31, 0x8d, 0x98, 0xf3, 0x8f, 0x38, 0x25, 0x80, 0x38, 0x48, 0x72, 0xc7, 0x38, 0x73, 0x77, 0x13,
+        0x74, 0x77, 0x07, 0x76, 0x77, 0x58, 0x75, 0x68, 0xdb, 0x87, 0x38, 0xb4, 0x9d, 0x09, 0xc1, 0x9c,
+        0x0a, 0xd5, 0xae, 0xba, 0xab, 0xb5, 0x7b, 0x59, 0xb5, 0x4b, 0x75, 0xb3, 0x2b, 0x75, 0xaa, 0x4a,
+        0xd5, 0xac, 0xe9, 0x3a, 0x98, 0xc9, 0x4d, 0x81, 0x38, 0x38, 0x83, 0xd7, 0x19, 0x6e, 0x37, 0x26,
+        0x6b, 0xc6, 0xca, 0x6c, 0xb6, 0x86, 0x6b, 0x16, 0x75, 0x79, 0x27, 0x6f, 0x76, 0xb8, 0x9a, 0x84,
+        0x38, 0x84, 0x9c, 0x49, 0x9d, 0x99, 0xca, 0x08, 0xa4, 0xba, 0x08, 0xa3, 0xda, 0x26, 0xa2, 0x49,
+        0xbc, 0x99, 0x99, 0xe2, 0x87, 0xc8, 0x93, 0x88, 0xe7, 0x02, 0x76, 0xe7, 0x31, 0x5c, 0x55, 0xd0,
+        0x5c, 0xc5, 0x6f, 0x53, 0xa5, 0x7c, 0x52, 0x65, 0x16, 0x51, 0x15, 0xc0, 0x5e, 0x75, 0xa5, 0x69,
+        0x86, 0x75, 0x67, 0xc8, 0x27, 0x7b, 0x97, 0xf8, 0x8b, 0x58, 0xb3, 0x8b, 0x29, 0x00, 0x92, 0x88,
+        0xec, 0x89, 0x08, 0xac, 0x8b, 0x37, 0xe7, 0x7b, 0x37, 0xf4, 0x6a, 0x06, 0xd6, 0x6d, 0x55, 0x3a,
+        0x58, 0x75, 0x44, 0x4a, 0x14, 0xb1, 0x4b, 0xd4, 0x90, 0x44, 0x24, 0x79, 0x53, 0x75, 0x2e, 0x52,
+        0xd5, 0xe0, 0x60, 0x35, 0xc8, 0x76, 0xc7, 0x4b, 0x74, 0xe8, 0x86, 0x83, 0xf8, 0x7a, 0x95, 0x39,
+        0x46, 0x93, 0xc8, 0xf7, 0x95, 0x49, 0x11, 0x88, 0xf8, 0x8f, 0x89, 0x77, 0xaf, 0x79, 0x87, 0xda,
+        0x52, 0x75, 0x22, 0x52, 0x36, 0x1f, 0x63, 0x15, 0xf6, 0x76, 0xb7, 0x53, 0x75, 0x08, 0xda, 0x86,
+        0xd8, 0xb0, 0x9a, 0xd9, 0xa4, 0x9a, 0xc9, 0x8b, 0x9c, 0x59, 0x84, 0x93, 0xc9, 0x5d, 0x96, 0x58,
+        0x58, 0x83, 0x48, 0x77, 0x76, 0xe7, 0x8e, 0x78, 0xc6, 0x1e, 0x67, 0x66, 0x38, 0x61, 0x26, 0x0f,
+        0x60, 0xd6, 0x5e, 0x61, 0x66, 0x55, 0x76, 0x47, 0x40, 0x73, 0xe8, 0x57, 0x88, 0x38, 0x43, 0x9c,
+        0x99, 0x9b, 0x9a, 0x2a, 0xef, 0xaa, 0xba, 0xee, 0xb3, 0xfb, 0x2d, 0xb2, 0xfa, 0xcd, 0xb2, 0xfa,
+        0xea, 0x9e, 0x29, 0xf4, 0x9f, 0x19, 0x16, 0x90, 0x19, 0x3c, 0x7c, 0x47, 0xea, 0x7d, 0xe7, 0x26,
+        0x77, 0x47, 0x34, 0x6f, 0x26, 0xf0, 0x6f, 0x17, 0xfa, 0x79, 0x97, 0xe2, 0x8d, 0x18, 0xbe, 0x8b,
+        0xb9, 0xf9, 0xa0, 0x69, 0xc5, 0xae, 0x3a, 0xd8, 0xae, 0x0b, 0x99, 0xb4, 0x0b, 0x7b, 0xb5, 0x3b,
+        0x6b, 0xb6, 0x5a, 0x2c, 0xa7, 0xba, 0x3d, 0x91, 0xc9, 0x42, 0x94, 0x57, 0xdb, 0x7b, 0x37, 0xf0,
+        0x70, 0x67, 0x1c, 0x71, 0xf6, 0x38, 0x67, 0xb6, 0x3e, 0x6c, 0x36, 0xae, 0x6b, 0x37, 0x95, 0x73,
+        0xd7, 0x7e, 0x8c, 0xa8, 0xa1, 0x89, 0xc9, 0x6c, 0x99, 0xc9, 0x64, 0xa2, 0x4a, 0x04, 0xa0, 0xaa,
+        0x32, 0xa0, 0xba, 0x4c, 0x96, 0x99, 0x74, 0x97, 0x28, 0x0b, 0x87, 0xd8, 0x3d, 0x6a, 0x76, 0xb6,
+        0x6b, 0xf5, 0xe3, 0x5c, 0x06, 0x01, 0x50, 0x55, 0x0f, 0x50, 0x35, 0x1d, 0x54, 0xb5, 0x0b, 0x59,
+        0xa5, 0x83, 0x58, 0x67, 0x17, 0x6b, 0x16, 0xeb, 0x7e, 0xa7, 0xe0, 0x7e, 0x48, 0xb7, 0x8d, 0x58,
+        0x98, 0x8e, 0x58, 0xea, 0x8f, 0x48, 0xb3, 0x87, 0x98, 0xc0, 0x7a, 0x97, 0xdd, 0x7d, 0xc6, 0x32,
+        0x68, 0x76, 0x47, 0x54, 0x15, 0x5e, 0x56, 0x04, 0x9d, 0x46, 0x24, 0xa5, 0x4b, 0xb4, 0xbe, 0x4b,
+        0xd4, 0xf7, 0x52, 0x24, 0xe2, 0x66, 0x56, 0x36, 0x63, 0xd7, 0xa4, 0x74, 0xf7, 0x90, 0x8e, 0x08,
+        0xc3, 0x8b, 0xd9, 0x17, 0x95, 0x99, 0x21, 0x93, 0x99, 0x2e, 0x93, 0x58, 0xad, 0x89, 0x78, 0xd5,
+        0x4c, 0x74, 0xcc, 0x4d, 0x15, 0x52, 0x56, 0xc5, 0x2b, 0x66, 0x66, 0x4e, 0x64, 0xf7, 0xf4, 0x78,
+        0x87, 0xc7, 0x91, 0xe9, 0x16, 0x91, 0x49, 0x8c, 0x9b, 0x89, 0x79, 0x9d, 0x49, 0xd9, 0x9d, 0xe9,
+        0x3a, 0x91, 0x69, 0x5b, 0x86, 0xd8, 0x91, 0x88, 0xf6, 0xf0, 0x74, 0xf7, 0x12, 0x66, 0x66, 0x76,
+        0x67, 0x86, 0x22, 0x5f, 0x76, 0x33, 0x6b, 0x56, 0xa0, 0x69, 0xa7, 0x5b, 0x78, 0xc7, 0x4c, 0x8c,
+        0xc8, 0x9e, 0x89, 0x9a, 0x39, 0x9f, 0x7a, 0x2c, 0xb0, 0x9a, 0xf6, 0xae, 0xdb, 0x30, 0xb7, 0xeb,
+        0x3c, 0xaa, 0xfa, 0xb9, 0xab, 0xaa, 0x17, 0xa0, 0x6a, 0x42, 0x8b, 0x48, 0xd3, 0x8c, 0xf7, 0xac,
+        0x80, 0x97, 0xc1, 0x6f, 0x26, 0xff, 0x70, 0x57, 0x6b, 0x71, 0xc7, 0x58, 0x7e, 0x27, 0xd4, 0x7d,
+        0x28, 0xf5, 0x8f, 0xf8, 0xc0, 0xa0, 0xb9, 0xfd, 0x9f, 0x9b, 0x38, 0xad, 0x1b, 0x0d, 0xb7, 0xfb,
+        0x89, 0xb8, 0x8a, 0xdd, 0xb1, 0xda, 0xe5, 0xa1, 0x8a, 0x3e, 0xa4, 0x28, 0xdc, 0x8c, 0x08, 0xf9,
+        0x7b, 0xc7, 0xde, 0x7d, 0xa6, 0x6e, 0x6b, 0xa6, 0x76, 0x66, 0x46, 0x59, 0x65, 0xa6, 0xbc, 0x67,
+        0x26, 0xb8, 0x7c, 0x87, 0x97, 0x79, 0x48, 0x79, 0x8a, 0x88, 0x68, 0x99, 0xc9, 0x6e, 0x96, 0xca,
+        0x32, 0x9f, 0xba, 0x35, 0x9f, 0x49, 0xf0, 0x9e, 0xf8, 0xfe, 0x96, 0x39, 0x22, 0x7a, 0xf7, 0xc8,
+        0x7c, 0xf6, 0xb6, 0x6a, 0x16, 0xdb, 0x56, 0x55, 0x79, 0x57, 0x24, 0xe6, 0x52, 0x64, 0xe8, 0x4e,
+        0x14, 0xdc, 0x4d, 0x76, 0x18, 0x5a, 0xe5, 0xf3, 0x6f, 0x56, 0xd8, 0x6d, 0xd8, 0x00, 0x81, 0x37,
+        0xd3, 0x8a, 0xb8, 0xab, 0x8a, 0xd9, 0x17, 0x8c, 0x79, 0x0d, 0x87, 0xf8, 0xaa, 0x8a, 0x77, 0x40,
+        0x79, 0x07, 0x51, 0x63, 0x56, 0x5a, 0x65, 0xb5, 0x2c, 0x50, 0x25, 0x42, 0x4c, 0x04, 0xcd, 0x4c,
+        0x84, 0x66, 0x49, 0xf4, 0x5a, 0x56, 0xe5, 0x48, 0x54, 0xf6, 0x92, 0x64, 0x36, 0x7d, 0x80, 0xa7,
+        0xe1, 0x7d, 0xb8, 0xb8, 0x8f, 0x08, 0xad, 0x96, 0x99, 0x52, 0x95, 0x19, 0x63, 0x94, 0x19, 0x82,
+        0x4d, 0xb4, 0xf1, 0x4f, 0x34, 0xd8, 0x50, 0x34, 0xc1, 0x58, 0x05, 0x81, 0x58, 0x16, 0xf3, 0x68,
+        0x56, 0xc6, 0x84, 0x48, 0x33, 0x83, 0x59, 0x1f, 0x93, 0xc9, 0x03, 0x9e, 0xa9, 0xec, 0x9e, 0x89,
+        0xe2, 0x9a, 0xc9, 0xea, 0x96, 0x29, 0x7a, 0x97, 0xc7, 0xe4, 0x85, 0x18, 0x0b, 0x72, 0xa7, 0x3d,
+        0x74, 0x26, 0x6a, 0x64, 0xb6, 0x86, 0x66, 0xa6, 0x5f, 0x65, 0xb6, 0x97, 0x6d, 0x36, 0x92, 0x7c,
+        0xe7, 0xa1, 0x7a, 0x39, 0x48, 0x8f, 0x79, 0x38, 0xa7, 0x4a, 0x4f, 0xa4, 0xab, 0x15, 0xb5, 0xab,
+        0x18, 0xb2, 0x5b, 0x24, 0xb2, 0x5b, 0x01, 0xad, 0x7b, 0x1e, 0x9b, 0x39, 0xd5, 0x9d, 0x68, 0x89,
+        0x8f, 0x38, 0xae, 0x76, 0x57, 0x7e, 0x77, 0x97, 0x4e, 0x71, 0x37, 0x51, 0x73, 0xe7, 0x3f, 0x73,
+        0xb7, 0xf5, 0x80, 0xf7, 0xcc, 0x90, 0x68, 0xf5, 0x8f, 0x2a, 0x6f, 0xa0, 0x8a, 0x42, 0xb3, 0x8b,
+        0x37, 0xb3, 0x2b, 0x29, 0xb5, 0x9b, 0x1d, 0xad, 0xea, 0xf8, 0xaf, 0xc9, 0xe5, 0x9b, 0xb9, 0xf7,
+        0x8b, 0x68, 0xdf, 0x8d, 0x37, 0x0a, 0x76, 0x57, 0x2a, 0x68, 0x66, 0x83, 0x68, 0x46, 0x47, 0x60,
+        0x96, 0x48, 0x6e, 0x26, 0xbe, 0x6b, 0xb7, 0x75, 0x79, 0xc7, 0x5f, 0x8b, 0x88, 0x82, 0x88, 0x49,
+        0xb9, 0x97, 0x09, 0xb3, 0xa0, 0xb9, 0xf6, 0x9f, 0x29, 0x9e, 0x9f, 0x39, 0xb9, 0x8a, 0xb8, 0xb2,
+        0x8b, 0xb7, 0xc1, 0x7a, 0x77, 0xe6, 0x62, 0xc6, 0x4e, 0x64, 0xa5, 0x37, 0x58, 0x05, 0x3f, 0x4a,
+        0x04, 0xa4, 0x4a, 0x65, 0x55, 0x4f, 0x55, 0x36, 0x5e, 0x95, 0xd8, 0x5d, 0x46, 0xff, 0x71, 0x46,
+        0xd5, 0x80, 0xb7, 0xfa, 0x7f, 0x98, 0xf5, 0x89, 0xc8, 0xdb, 0x8f, 0x79, 0x0c, 0x91, 0x08, 0x27,
+        0x87, 0x08, 0x2a, 0x74, 0x87, 0x66, 0x76, 0xd6, 0x18, 0x5f, 0x76, 0x34, 0x53, 0xa5, 0x58, 0x55,
+        0x94, 0x4f, 0x49, 0xa4, 0x60, 0x4c, 0xc4, 0xba, 0x4b, 0xe5, 0x9a, 0x54, 0x75, 0x86, 0x6f, 0x86,
+        0xce, 0x6c, 0x97, 0xe9, 0x81, 0x27, 0xd9, 0x91, 0x38, 0xed, 0x8f, 0x59, 0xa4, 0x97, 0x69, 0xb3,
+        0x55, 0x75, 0x7c, 0x57, 0x84, 0xd0, 0x50, 0xe4, 0xcd, 0x4f, 0x64, 0xfc, 0x4f, 0xe6, 0x10, 0x5a,
+        0x05, 0xe1, 0x74, 0x57, 0x39, 0x73, 0x88, 0x56, 0x86, 0x68, 0x2d, 0x98, 0xf9, 0x83, 0x98, 0x2a,
+        0x1b, 0x9c, 0xca, 0x13, 0xa1, 0x7a, 0x23, 0xa2, 0x98, 0xe6, 0x94, 0x79, 0x09, 0x81, 0xc8, 0x37,
+        0x83, 0x97, 0x17, 0x6f, 0x77, 0x3a, 0x69, 0x86, 0x98, 0x69, 0x46, 0x35, 0x67, 0xb6, 0x43, 0x6f,
+        0xd6, 0xd2, 0x6d, 0x88, 0x41, 0x7f, 0x38, 0x36, 0x98, 0x79, 0x5a, 0x95, 0xba, 0x96, 0xab, 0xea,
+        0x7f, 0xb2, 0x9b, 0x12, 0xb1, 0x9b, 0x89, 0xb5, 0x9b, 0x98, 0xaa, 0x5a, 0xbd, 0xab, 0xa9, 0x8d,
+        0x9f, 0x09, 0xb6, 0x83, 0x28, 0x55, 0x85, 0xd7, 0xb2, 0x77, 0x97, 0xbf, 0x70, 0x97, 0x1d, 0x71,
+        0xc7, 0x48, 0x76, 0x37, 0x27, 0x80, 0xb7, 0xfd, 0x80, 0x49, 0x76, 0x8f, 0xf9, 0x41, 0xa8, 0x0a,
+        0x73, 0xa7, 0x1a, 0xf9, 0xb1, 0x9a, 0xde, 0xb3, 0xeb, 0x49, 0xb4, 0x9a, 0xb4, 0xa8, 0x6a, 0xc3,
+        0x9b, 0xb9, 0xdc, 0x9d, 0xb7, 0xfc, 0x85, 0xa8, 0x1e, 0x71, 0x37, 0x21, 0x71, 0xf6, 0x42, 0x61,
+        0xb6, 0x5e, 0x65, 0xa6, 0x47, 0x64, 0x56, 0x87, 0x6b, 0xe6, 0x7c, 0x7a, 0xb7, 0x78, 0x77, 0x48,
+        0xe0, 0x88, 0xf8, 0xd0, 0x9a, 0x69, 0x88, 0x98, 0x09, 0xce, 0xa1, 0x39, 0xd1, 0x95, 0xa9, 0x5b,
+        0x96, 0x58, 0xc5, 0x8a, 0x78, 0xe5, 0x73, 0x07, 0x4f, 0x75, 0x05, 0xeb, 0x64, 0x96, 0x04, 0x4d,
+        0x44, 0xe9, 0x4e, 0xd4, 0xf7, 0x4a, 0xb4, 0xea, 0x51, 0xa5, 0x16, 0x50, 0xe5, 0xf7, 0x60, 0x65,
+        0xcc, 0x71, 0x16, 0xff, 0x6f, 0xf8, 0x67, 0x7f, 0x78, 0x3a, 0x8f, 0x18, 0xfb, 0x8f, 0x48, 0xad,
+        0x8e, 0x88, 0xa9, 0x83, 0x08, 0x51, 0x85, 0x47, 0x22, 0x70, 0x37, 0x41, 0x61, 0xa6, 0x48, 0x63,
+        0xa4, 0xc1, 0x51, 0x34, 0xda, 0x4a, 0x94, 0x9e, 0x4a, 0x04, 0xe9, 0x4a, 0x44, 0xe3, 0x5f, 0x85,
+        0xd2, 0x5d, 0x16, 0xe2, 0x70, 0x96, 0xce, 0x85, 0x38, 0x20, 0x82, 0xc9, 0x6c, 0x92, 0x69, 0x67,
+        0x62, 0x66, 0x5d, 0x65, 0xa5, 0x3a, 0x58, 0x05, 0x3d, 0x4d, 0x24, 0xe7, 0x4e, 0x85, 0x68, 0x50,
+        0xd5, 0x4f, 0x64, 0xe6, 0x42, 0x64, 0x67, 0x59, 0x76, 0x97, 0x29, 0x8d, 0x88, 0xbf, 0x8c, 0x39,
+        0xde, 0x98, 0x49, 0xc5, 0xa6, 0x4a, 0x66, 0xa6, 0xa9, 0xaa, 0xa0, 0x19, 0xc7, 0x92, 0x09, 0x2e,
+        0x93, 0x98, 0x06, 0x7e, 0xf8, 0x2f, 0x72, 0x97, 0x40, 0x73, 0x96, 0x49, 0x6a, 0x26, 0x61, 0x68,
+        0x56, 0x6f, 0x67, 0x17, 0x6c, 0x71, 0xd7, 0x5c, 0x88, 0x78, 0x59, 0x85, 0x89, 0xb5, 0x9e, 0x29,
+        0x9e, 0xab, 0x5a, 0x9a, 0xa9, 0x6b, 0xa3, 0xb6, 0x4b, 0xa4, 0xb3, 0xbb, 0x4e, 0xb4, 0xea, 0x84,
+        0xad, 0xfa, 0x9c, 0x93, 0x49, 0x5e, 0x95, 0xb8, 0x71, 0x84, 0x68, 0x86, 0x75, 0x77, 0x79, 0x77,
+        0x36, 0xfa, 0x72, 0xf6, 0xeb, 0x74, 0xa7, 0x4a, 0x74, 0xe8, 0x73, 0x80, 0x48, 0x42, 0x99, 0x19,
+        0x7b, 0x97, 0x9a, 0x59, 0xa6, 0xda, 0x2f, 0xb2, 0x6b, 0x1d, 0xb1, 0xeb, 0x23, 0xae, 0xbb, 0x29,
+        0xa9, 0xaa, 0xb5, 0xab, 0x79, 0x03, 0x96, 0x79, 0x24, 0x7f, 0x58, 0x09, 0x80, 0xe6, 0xc6, 0x6a,
+        0x16, 0xe8, 0x64, 0x16, 0x41, 0x63, 0xe5, 0xea, 0x62, 0x95, 0xed, 0x6a, 0xe6, 0x83, 0x68, 0x87,
+        0xd9, 0x78, 0xa7, 0xcd, 0x8d, 0x98, 0xb7, 0x8a, 0xe9, 0x7d, 0x9b, 0x59, 0x76, 0x99, 0xd9, 0x91,
+        0x99, 0x29, 0x87, 0x95, 0x79, 0x98, 0x83, 0x18, 0x53, 0x84, 0xd6, 0xea, 0x74, 0xb7, 0x0c, 0x57,
+        0xa5, 0x9a, 0x5a, 0x05, 0x16, 0x4d, 0xb5, 0x22, 0x4a, 0x84, 0xb5, 0x4a, 0xe5, 0x18, 0x53, 0x34,
+        0xf3, 0x60, 0x85, 0xf1, 0x5f, 0x97, 0x7c, 0x70, 0x97, 0x4c, 0x86, 0xe8, 0x68, 0x86, 0x58, 0xb7,
+        0x8e, 0x28, 0xa6, 0x8c, 0xb8, 0xd7, 0x8d, 0xb8, 0x27, 0x7f, 0x68, 0x34, 0x72, 0x67, 0x52, 0x74,
+        0xb5, 0x93, 0x5f, 0x25, 0xab, 0x4f, 0xf5, 0x08, 0x50, 0xc4, 0xae, 0x47, 0x84, 0xb7, 0x53, 0x55,
+        0x21, 0x51, 0xe5, 0xd3, 0x60, 0x95, 0xc0, 0x74, 0xf7, 0x1c, 0x72, 0x28, 0xb7, 0x86, 0xb8, 0xac,
+        0x72, 0x67, 0x55, 0x75, 0x06, 0x03, 0x64, 0xd6, 0x09, 0x51, 0xf5, 0x44, 0x54, 0x85, 0x2c, 0x4d,
+        0xa5, 0x1b, 0x59, 0x85, 0x97, 0x59, 0x86, 0x60, 0x67, 0x76, 0x34, 0x7e, 0x87, 0xcd, 0x7d, 0x29,
+        0x39, 0x8d, 0x69, 0x15, 0xa3, 0xfa, 0x31, 0xa3, 0x1a, 0x11, 0xa5, 0xaa, 0x1c, 0x9f, 0x1a, 0x03,
+        0xa0, 0x19, 0x05, 0x8f, 0x39, 0x2d, 0x81, 0x28, 0x27, 0x82, 0x56, 0xc5, 0x72, 0xf6, 0xef, 0x68,
+        0x06, 0x73, 0x67, 0x26, 0xd4, 0x6a, 0x06, 0xdd, 0x79, 0xd7, 0x73, 0x77, 0x48, 0xb1, 0x8d, 0xb8,
+        0xa2, 0x9e, 0xd9, 0xbf, 0x9b, 0xfb, 0x47, 0xaf, 0xeb, 0x3e, 0xb7, 0x6b, 0x75, 0xb7, 0x5b, 0x37,
+        0xb8, 0x7b, 0x46, 0xa3, 0x4a, 0x56, 0xa5, 0x79, 0x6c, 0x94, 0x79, 0x84, 0x80, 0x38, 0x2f, 0x82,
+        0x97, 0x30, 0x77, 0x27, 0x2e, 0x6e, 0xb6, 0xfa, 0x6f, 0x87, 0x9f, 0x73, 0x77, 0x7c, 0x88, 0x48,
+        0x7d, 0x87, 0xa9, 0x70, 0x97, 0xb9, 0x39, 0xa9, 0x4a, 0x84, 0xa8, 0x7b, 0x22, 0xad, 0x2b, 0x11,
+        0xb1, 0xbb, 0x33, 0xb2, 0xd9, 0xf3, 0xa4, 0xda, 0x07, 0x8f, 0xd9, 0x10, 0x91, 0x37, 0xa0, 0x78,
+        0x37, 0xc5, 0x6a, 0x56, 0xb5, 0x6b, 0x05, 0xbb, 0x60, 0xe5, 0xd4, 0x60, 0x35, 0xe0, 0x5e, 0x36,
+        0xd6, 0x69, 0x06, 0xcd, 0x7d, 0xe7, 0xa8, 0x7a, 0xd8, 0xc3, 0x8f, 0x08, 0xaf, 0x96, 0x49, 0x44,
+        0x95, 0x39, 0xd7, 0x9a, 0x39, 0xdb, 0x90, 0xa9, 0x1e, 0x91, 0xc7, 0xf4, 0x85, 0x08, 0x0d, 0x67,
+        0x16, 0x9a, 0x69, 0xd5, 0xb4, 0x57, 0xd5, 0xbe, 0x4b, 0x14, 0xc8, 0x4c, 0x84, 0x92, 0x4b, 0xf4,
+        0x7f, 0x51, 0xa5, 0x0b, 0x51, 0x36, 0x6c, 0x5f, 0xf6, 0x3c, 0x79, 0x17, 0x81, 0x78, 0x48, 0x47,
+        0x86, 0x68, 0x25, 0x8f, 0x08, 0xf0, 0x8f, 0x18, 0xce, 0x88, 0xd8, 0xd8, 0x82, 0x38, 0x46, 0x84,
+        0x16, 0x9b, 0x6f, 0xa6, 0xba, 0x5c, 0x05, 0xd4, 0x5d, 0xc4, 0xf2, 0x4c, 0xd5, 0x08, 0x4e, 0xb4,
+        0xdb, 0x4d, 0x85, 0x08, 0x54, 0x64, 0xff, 0x64, 0x76, 0x1b, 0x61, 0x67, 0xb9, 0x76, 0xc7, 0xae,
+        0x81, 0xc8, 0x3d, 0x84, 0x86, 0xef, 0x74, 0x37, 0x07, 0x5d, 0x46, 0x02, 0x5f, 0xf5, 0x61, 0x52,
+        0x15, 0x60, 0x54, 0x75, 0x52, 0x55, 0x15, 0x95, 0x5b, 0xa5, 0x77, 0x6e, 0x56, 0xce, 0x6c, 0xd8,
+        0x4c, 0x7e, 0x08, 0x24, 0x9a, 0xd9, 0x94, 0x99, 0xfa, 0x0a, 0xa4, 0x09, 0xfd, 0xa6, 0xea, 0x75,
+        0xa7, 0x19, 0xeb, 0x9d, 0x4a, 0x06, 0x91, 0x89, 0x2a, 0x93, 0x07, 0x9b, 0x80, 0xa7, 0xce, 0x6e,
+        0x76, 0xea, 0x6e, 0xd6, 0xb5, 0x68, 0xa6, 0xca, 0x6f, 0x86, 0xdb, 0x6d, 0x67, 0xc1, 0x7e, 0xc7,
+        0xb0, 0x8e, 0xa8, 0xc4, 0x8c, 0x1a, 0x93, 0xa3, 0x2a, 0x76, 0xb3, 0x6b, 0x21, 0xb2, 0x4b, 0x81,
+        0xbb, 0xab, 0x89, 0xaf, 0x1b, 0x13, 0xb1, 0x0a, 0x69, 0xa4, 0x0a, 0x85, 0x8f, 0xa9, 0x23, 0x92,
+        0x47, 0xc3, 0x81, 0x57, 0xd4, 0x6f, 0xc7, 0x1a, 0x71, 0xa7, 0x2a, 0x6d, 0x47, 0x16, 0x7a, 0x97,
+        0xa0, 0x79, 0xd8, 0x6b, 0x87, 0x88, 0x38, 0x9b, 0x89, 0x9d, 0x99, 0xfa, 0xb0, 0xa5, 0x2a, 0x90,
+        0xb3, 0x9b, 0x42, 0xb3, 0x8a, 0x8b, 0xad, 0x0a, 0x94, 0x9e, 0xd9, 0xfd, 0xa0, 0x68, 0x9b, 0x88,
+        0xb8, 0xc9, 0x76, 0xb7, 0x7e, 0x78, 0x26, 0x0b, 0x66, 0x96, 0x2b, 0x5c, 0x15, 0xb3, 0x5b, 0x46,
+        0x1d, 0x5d, 0xc6, 0x1f, 0x6d, 0xd6, 0xb1, 0x6a, 0xe7, 0xcb, 0x7f, 0x87, 0xb5, 0x8b, 0xc8, 0x8f,
+        0x89, 0x89, 0xb2, 0x97, 0x79, 0xb1, 0x97, 0x39, 0x73, 0x97, 0x28, 0xd3, 0x92, 0x18, 0xec, 0x78,
+        0x07, 0x9f, 0x79, 0xe6, 0x9a, 0x67, 0x06, 0xaf, 0x52, 0xf5, 0x60, 0x55, 0x54, 0x8a, 0x4c, 0x34,
+        0x84, 0x48, 0xa4, 0x87, 0x48, 0x95, 0x75, 0x51, 0x35, 0x4f, 0x68, 0x46, 0x77, 0x67, 0x87, 0x79,
+        0x78, 0xb7, 0x4e, 0x89, 0xb8, 0x83, 0x88, 0xa8, 0xfa, 0x8b, 0xc8, 0xf9, 0x8d, 0xd8, 0xf7, 0x8f,
+        0x37, 0xa3, 0x7f, 0xf7, 0xbc, 0x6c, 0x96, 0xdd, 0x6e, 0x35, 0xa8, 0x58, 0xa5, 0xcd, 0x51, 0x45,
+        0x1e, 0x51, 0xa4, 0xa5, 0x4f, 0x04, 0xb2, 0x56, 0xe5, 0x43, 0x54, 0x36, 0xab, 0x66, 0x26, 0x9d,
+        0x8d, 0xd8, 0xfd, 0x8f, 0x67, 0xe7, 0x83, 0xe7, 0xff, 0x6c, 0x06, 0xf8, 0x6f, 0x45, 0xfd, 0x5c,
+        0xa6, 0x09, 0x56, 0x25, 0x78, 0x57, 0xb5, 0x28, 0x55, 0x45, 0x18, 0x60, 0xa5, 0xfd, 0x60, 0x57,
+        0x4a, 0x6e, 0x47, 0x1d, 0x8c, 0xf8, 0xb5, 0x8b, 0x09, 0x8e, 0x9b, 0xb9, 0x7b, 0xa8, 0x6a, 0x71,
+        0xa6, 0xfa, 0x7a, 0xa5, 0x7a, 0x99, 0xa0, 0x2a, 0x0f, 0xa1, 0x38, 0x9d, 0x90, 0xf8, 0xcc, 0x7a,
+        0xe7, 0xb6, 0x7b, 0xf7, 0x01, 0x6e, 0x97, 0x29, 0x6c, 0x16, 0xb1, 0x6b, 0x17, 0x07, 0x74, 0x76,
+        0xff, 0x7f, 0x07, 0xc2, 0x7c, 0xa9, 0x9a, 0x93, 0x89, 0x7f, 0xa8, 0x4a, 0x70, 0xa6, 0xcb, 0x5d,
+        0xb8, 0x9b, 0x4e, 0xb5, 0xdb, 0x60, 0xb6, 0x5b, 0x44, 0xb1, 0x0b, 0x54, 0x9f, 0xaa, 0x29, 0xa2,
+        0x88, 0xa9, 0x90, 0x08, 0xc3, 0x78, 0x97, 0xa9, 0x7a, 0xd7, 0x21, 0x6d, 0xa7, 0x1f, 0x71, 0x87,
+        0x22, 0x71, 0xb7, 0x75, 0x79, 0x37, 0x51, 0x8b, 0x08, 0x98, 0x89, 0xc9, 0xe0, 0x97, 0x29, 0xbb,
+        0xad, 0xba, 0xc7, 0xac, 0xda, 0xb7, 0xaf, 0x8a, 0xb8, 0xa9, 0xfa, 0xa8, 0xaa, 0xa9, 0x9e, 0x98,
+        0x79, 0xc6, 0x87, 0x18, 0x89, 0x88, 0x66, 0xbc, 0x72, 0xe6, 0xe8, 0x5f, 0x85, 0xf5, 0x5f, 0x85,
+        0xc2, 0x59, 0x15, 0xcd, 0x60, 0x95, 0xe9, 0x5e, 0x76, 0xc1, 0x6e, 0xc6, 0xb2, 0x7c, 0xe7, 0x9e,
+        0x7a, 0x09, 0x21, 0x8c, 0xf9, 0x0e, 0x96, 0x69, 0x5e, 0x95, 0xb9, 0x4e, 0x99, 0x99, 0x59, 0x86,
+        0x78, 0x7c, 0x88, 0x37, 0xa7, 0x78, 0x07, 0xb7, 0x61, 0x06, 0x44, 0x64, 0x04, 0xfd, 0x54, 0x15,
+        0x04, 0x46, 0x44, 0x75, 0x47, 0x54, 0xd2, 0x47, 0x54, 0xb2, 0x58, 0x75, 0x77, 0x57, 0x96, 0x70,
+        0x68, 0x46, 0x42, 0x7d, 0x07, 0xb5, 0x7b, 0xa8, 0xba, 0x85, 0xe8, 0xa2, 0x93, 0x09, 0x39, 0x93,
+        0x38, 0x68, 0x8b, 0xb8, 0x77, 0x7c, 0xd7, 0xe3, 0x7e, 0x96, 0x9b, 0x68, 0xb6, 0xca, 0x5b, 0xb5,
+        0xcd, 0x5c, 0x84, 0xbf, 0x51, 0xd4, 0xdc, 0x4f, 0x94, 0xdd, 0x4e, 0x05, 0xc5, 0x58, 0x55, 0xbd,
+        0x93, 0xb9, 0x49, 0x94, 0x98, 0xbb, 0x90, 0x28, 0xbe, 0x7c, 0x07, 0xf1, 0x7f, 0x46, 0xe1, 0x6b,
+        0x36, 0xef, 0x5e, 0x86, 0x0b, 0x61, 0x05, 0x26, 0x56, 0x55, 0x20, 0x58, 0x95, 0x80, 0x58, 0x46,
+        0x66, 0x60, 0x76, 0x48, 0x7d, 0x57, 0xb8, 0x7b, 0x08, 0xc1, 0x8e, 0x68, 0xa6, 0xa2, 0x4a, 0x03,
+        0xa0, 0x7a, 0xa8, 0xa7, 0x0a, 0xad, 0xaa, 0xaa, 0xa8, 0xaa, 0xe9, 0x91, 0xa0, 0x39, 0xc1, 0x8a,
+        0x48, 0xb9, 0x8b, 0xa7, 0xbb, 0x7a, 0x57, 0xea, 0x6f, 0x56, 0xf7, 0x6f, 0x56, 0xb2, 0x6f, 0xf6,
+        0xbe, 0x72, 0xc7, 0x07, 0x70, 0xd8, 0x95, 0x83, 0xe8, 0x78, 0x99, 0xf9, 0x80, 0x98, 0x1a, 0xcb,
+        0xae, 0xea, 0xaf, 0xb4, 0x9b, 0x46, 0xb4, 0x6b, 0xc1, 0xb7, 0xdb, 0xbe, 0xad, 0x8b, 0x01, 0xb0,
+        0x49, 0xb5, 0xa0, 0x89, 0xc5, 0x86, 0x48, 0x8e, 0x89, 0x17, 0x97, 0x75, 0xb7, 0x9f, 0x70, 0x57,
+        0x19, 0x71, 0x36, 0xd6, 0x70, 0x16, 0xbf, 0x7b, 0xd7, 0xb3, 0x7a, 0xb8, 0xdc, 0x87, 0x88, 0xad,
+        0xa1, 0x49, 0xff, 0x9f, 0xca, 0x72, 0xaa, 0x4a, 0x63, 0xad, 0xfa, 0xdf, 0xae, 0x3a, 0x61, 0xa3,
+        0xca, 0x7d, 0x96, 0xe9, 0x7f, 0x97, 0xc7, 0xb2, 0x82, 0xb7, 0xeb, 0x69, 0xd6, 0xa2, 0x6a, 0xc5,
+        0xdc, 0x5c, 0x05, 0xff, 0x59, 0x55, 0x84, 0x58, 0x25, 0xdc, 0x61, 0x75, 0xda, 0x6c, 0x16, 0x95,
+        0x69, 0x88, 0x3a, 0x7e, 0x18, 0x1f, 0x8e, 0x18, 0xcf, 0x8c, 0xd9, 0x61, 0x99, 0x69, 0x56, 0x8f,
+        0xe9, 0x0b, 0x91, 0x28, 0x98, 0x86, 0x78, 0xa8, 0x71, 0xc7, 0x4c, 0x74, 0xd5, 0xc6, 0x61, 0xa5,
+        0xdc, 0x4b, 0x94, 0xdc, 0x4e, 0x14, 0x97, 0x44, 0xc4, 0x89, 0x4d, 0x04, 0xd1, 0x4c, 0xd5, 0x6d,
+        0x58, 0x55, 0x49, 0x6c, 0xe6, 0xb3, 0x6b, 0x58, 0x03, 0x7a, 0x47, 0xe0, 0x8f, 0x78, 0xf5, 0x8e,
+        0xf8, 0xc5, 0x91, 0x08, 0xcc, 0x8a, 0x68, 0xb2, 0x8b, 0x37, 0xad, 0x79, 0xa7, 0xd8, 0x6a, 0xc6,
+        0xc0, 0x6c, 0x15, 0x50, 0x5b, 0x85, 0x7a, 0x50, 0x14, 0xf0, 0x4f, 0x15, 0x3d, 0x50, 0x05, 0x45,
+        0x92, 0xc9, 0x35, 0x92, 0xe9, 0x3a, 0x96, 0xa9, 0x2b, 0x89, 0xf8, 0xc1, 0x8c, 0x37, 0xdb, 0x7a,
+        0xf7, 0xf2, 0x6b, 0xc6, 0xe9, 0x6e, 0x75, 0x94, 0x5e, 0x15, 0x9f, 0x56, 0x75, 0x78, 0x57, 0x85,
+        0xc9, 0x57, 0x25, 0xb6, 0x6e, 0x26, 0xc6, 0x6c, 0x97, 0xca, 0x7e, 0x57, 0xa6, 0x96, 0x79, 0x3f,
+        0x93, 0xba, 0x62, 0xa1, 0x8a, 0x5c, 0xae, 0xea, 0xe3, 0xae, 0x5a, 0x4d, 0xab, 0x0a, 0x6b, 0x9a,
+        0x49, 0xb5, 0x9b, 0x48, 0xac, 0x89, 0xf8, 0xe2, 0x79, 0x97, 0xa0, 0x79, 0xb6, 0xd3, 0x72, 0xb6,
+        0xe8, 0x6b, 0xf6, 0xac, 0x6b, 0x17, 0xc0, 0x76, 0x97, 0xad, 0x89, 0x78, 0x78, 0x87, 0x39, 0xe6,
+        0xa0, 0x89, 0xc4, 0xac, 0xda, 0xbb, 0xab, 0xbb, 0xc7, 0xb7, 0x7b, 0xb9, 0xb6, 0xeb, 0x85, 0xb8,
+        0x6a, 0x9f, 0xae, 0xba, 0xb1, 0x96, 0x69, 0x95, 0x99, 0x38, 0x65, 0x82, 0xc8, 0x6f, 0x75, 0x67,
+        0x80, 0x78, 0x06, 0xa5, 0x6d, 0xa6, 0x9a, 0x71, 0x17, 0x01, 0x70, 0x07, 0xde, 0x77, 0x77, 0xb9,
+        0x91, 0xc8, 0xfa, 0x8f, 0xa9, 0xbf, 0x9e, 0x59, 0xa3, 0xab, 0x0a, 0x9c, 0xa9, 0xea, 0xc3, 0xa8,
+        0x4a, 0xc5, 0xa3, 0xfa, 0x4d, 0xa4, 0x38, 0xc2, 0x92, 0xb8, 0xef, 0x78, 0xb7, 0x9b, 0x79, 0xf6,
+        0x78, 0x66, 0x26, 0xa0, 0x5a, 0x15, 0x98, 0x5a, 0x05, 0x61, 0x5a, 0xa5, 0x62, 0x5d, 0x65, 0xb5,
+        0x5b, 0x57, 0x34, 0x6d, 0x87, 0x16, 0x80, 0xd7, 0xf2, 0x7e, 0x98, 0xf0, 0x91, 0xc8, 0xdb, 0x92,
+        0x29, 0x22, 0x92, 0x49, 0x3a, 0x90, 0x29, 0x43, 0x81, 0x98, 0x45, 0x84, 0x16, 0xd1, 0x72, 0x16,
+        0xe2, 0x58, 0x15, 0xa9, 0x5a, 0xb4, 0xdb, 0x4a, 0x54, 0xde, 0x48, 0x34, 0x95, 0x48, 0xb4, 0xae,
+        0x4c, 0x24, 0x88, 0x5c, 0x75, 0xac, 0x5b, 0x17, 0x0b, 0x6a, 0x66, 0xe6, 0x85, 0xe8, 0x48, 0x84,
+        0x38, 0xb3, 0x8e, 0x18, 0xa8, 0x92, 0x19, 0x18, 0x91, 0xe8, 0x8f, 0x87, 0x28, 0xb0, 0x7b, 0xa7,
+        0xd7, 0x7d, 0x16, 0x39, 0x6a, 0x96, 0x6b, 0x57, 0x85, 0x7f, 0x58, 0x25, 0x2d, 0x50, 0x25, 0x41,
+        0x8b, 0x48, 0xac, 0x8a, 0xa9, 0x43, 0x97, 0x09, 0x2e, 0x92, 0xc9, 0x47, 0x94, 0xd8, 0xc6, 0x89,
+        0x48, 0xd2, 0x7b, 0x87, 0xe5, 0x7e, 0x46, 0x5a, 0x6a, 0x86, 0x6d, 0x5b, 0xa5, 0xdb, 0x5d, 0xb5,
+        0x93, 0x54, 0xc5, 0x89, 0x63, 0x16, 0x22, 0x61, 0xc6, 0xcd, 0x6f, 0x16, 0xaf, 0x87, 0x38, 0x43,
+        0x84, 0x79, 0xb7, 0x96, 0x59, 0xa4, 0xac, 0x2a, 0xaa, 0xaa, 0x6a, 0xab, 0xb0, 0x0a, 0xca, 0xa7,
+        0x0a, 0x74, 0xa7, 0x29, 0xb1, 0x99, 0xf9, 0xe1, 0x87, 0xe8, 0x91, 0x89, 0x17, 0x59, 0x7b, 0xe7,
+        0x7b, 0x6c, 0x26, 0xc0, 0x6c, 0x47, 0x38, 0x6f, 0x87, 0x36, 0x7b, 0x17, 0x9c, 0x79, 0xc8, 0xe4,
+        0x90, 0x48, 0xc5, 0x9f, 0xb9, 0xdf, 0x9d, 0xeb, 0x64, 0xb0, 0x8b, 0x40, 0xb9, 0x3b, 0x9c, 0xb9,
+        0xbb, 0x49, 0xb8, 0x7b, 0x42, 0xa5, 0xfa, 0x89, 0xa8, 0xb9, 0x60, 0x93, 0x39, 0x74, 0x81, 0x38,
+        0x44, 0x83, 0xe6, 0xe3, 0x72, 0xa6, 0xe9, 0x6b, 0x96, 0xc1, 0x6c, 0x47, 0x18, 0x6c, 0x17, 0x02,
+        0x81, 0x97, 0xfa, 0x7f, 0x98, 0xcc, 0x8e, 0xd8, 0xad, 0xa1, 0x59, 0xf4, 0x9f, 0x2a, 0xa5, 0xa6,
+        0x2a, 0xa2, 0xab, 0x8a, 0xb0, 0xaa, 0xb9, 0x9e, 0xa0, 0x49, 0xc2, 0x89, 0x18, 0x9e, 0x8a, 0x07,
+        0x58, 0x74, 0x77, 0x83, 0x61, 0x86, 0x25, 0x62, 0x35, 0x4f, 0x5a, 0x15, 0x63, 0x53, 0xd5, 0x24,
+        0x52, 0xe6, 0x38, 0x5e, 0xd6, 0x26, 0x70, 0x66, 0xe1, 0x6d, 0xb8, 0x29, 0x84, 0x48, 0x03, 0x8c,
+        0xd8, 0xb9, 0x8c, 0x19, 0x75, 0x93, 0x29, 0x70, 0x8d, 0x28, 0xef, 0x8e, 0xc7, 0xd6, 0x81, 0xa7,
+        0xe0, 0x67, 0xe6, 0xa8, 0x6b, 0x05, 0x89, 0x55, 0xb5, 0x95, 0x4a, 0xc4, 0xd5, 0x4c, 0x64, 0x40,
+        0x46, 0xe4, 0x2f, 0x4e, 0xe4, 0xdc, 0x4e, 0x36, 0x01, 0x5a, 0x25, 0xdb, 0x76, 0x97, 0x4e, 0x75,
+        0x08, 0x22, 0x84, 0x68, 0x0e, 0x91, 0x99, 0x04, 0x90, 0x79, 0x1e, 0x8e, 0xe9, 0x2a, 0x8a, 0xa8,
+        0xbb, 0x8b, 0x87, 0x45, 0x7b, 0x97, 0x74, 0x65, 0x06, 0x5e, 0x66, 0x65, 0x98, 0x57, 0xd5, 0xbd,
+        0x7e, 0x97, 0xd9, 0x7d, 0xc8, 0xed, 0x90, 0x78, 0xc1, 0x95, 0x69, 0x68, 0x96, 0xc9, 0x70, 0x92,
+        0xf9, 0x72, 0x8a, 0xd8, 0xd6, 0x8d, 0x37, 0x4d, 0x7a, 0x87, 0x64, 0x67, 0x26, 0x95, 0x69, 0x75,
+        0xc8, 0x58, 0xf5, 0xd4, 0x5d, 0xf5, 0xdd, 0x5d, 0x66, 0x07, 0x63, 0x25, 0xf7, 0x76, 0xe7, 0x48,
+        0x74, 0xd8, 0xcc, 0x87, 0x68, 0xb3, 0xa2, 0x8a, 0x05, 0xa0, 0x7a, 0xa4, 0xae, 0x2a, 0xa4, 0xae,
+        0xba, 0xdc, 0xad, 0xfa, 0x8c, 0xa7, 0x5a, 0xb2, 0x97, 0xf9, 0x8f, 0x99, 0x08, 0x32, 0x8a, 0x18,
+        0x66, 0x73, 0x47, 0x42, 0x74, 0x07, 0x26, 0x6e, 0xe7, 0x31, 0x71, 0xe7, 0x11, 0x71, 0x37, 0xf9,
+        0x81, 0x57, 0xd6, 0x8f, 0xb8, 0xdc, 0x8e, 0x4a, 0x9d, 0xa3, 0x6a, 0x72, 0xb4, 0x8b, 0x40, 0xb3,
+        0xdb, 0x8a, 0xbb, 0x5b, 0x7a, 0xb0, 0xeb, 0x36, 0xb3, 0x6a, 0x62, 0xa3, 0x1a, 0x6b, 0x90, 0x79,
+        0x3d, 0x93, 0xa7, 0x91, 0x7e, 0x07, 0x9f, 0x6e, 0x56, 0xf8, 0x6f, 0x76, 0xaf, 0x66, 0xc6, 0xa5,
+        0x74, 0x47, 0x33, 0x73, 0x17, 0xc4, 0x7e, 0x77, 0xa5, 0x92, 0xb9, 0x03, 0x90, 0x5a, 0x16, 0x9c,
+        0x9a, 0x13, 0xab, 0x6a, 0xa8, 0xaa, 0x2a, 0x26, 0xa7, 0xca, 0x42, 0x98, 0x19, 0x83, 0x98, 0x58,
+        0x5e, 0x84, 0xe8, 0x8c, 0x6e, 0xf7, 0x07, 0x70, 0x45, 0xb4, 0x61, 0x45, 0xd2, 0x51, 0x85, 0x0c,
+        0x51, 0x05, 0x91, 0x54, 0x25, 0x8c, 0x60, 0xd5, 0xf1, 0x5e, 0x67, 0x2a, 0x73, 0xc6, 0xff, 0x81,
+        0x27, 0xf4, 0x7f, 0xa9, 0x40, 0x8e, 0x49, 0x27, 0x92, 0x49, 0x39, 0x92, 0xf8, 0x9d, 0x8e, 0x28,
+        0xa2, 0x78, 0x67, 0xb0, 0x7b, 0x76, 0x85, 0x65, 0x16, 0x91, 0x54, 0xb5, 0x7c, 0x57, 0x34, 0x57,
+        0x49, 0x24, 0x55, 0x47, 0xd4, 0x72, 0x47, 0x35, 0x1a, 0x4c, 0x15, 0x03, 0x65, 0x96, 0x41, 0x64,
+        0x47, 0x3c, 0x75, 0xc7, 0x1e, 0x89, 0xf8, 0x7c, 0x88, 0x09, 0x30, 0x8f, 0x49, 0x33, 0x94, 0x59,
+        0x47, 0x94, 0x48, 0x3c, 0x8a, 0xb8, 0x66, 0x75, 0xc7, 0x69, 0x77, 0x36, 0x64, 0x65, 0x76, 0x92,
+        0x6f, 0x76, 0xdd, 0x6d, 0xe8, 0x37, 0x84, 0x88, 0x03, 0x91, 0xb9, 0x16, 0x91, 0xb9, 0xb8, 0x96,
+        0xd9, 0xa4, 0x96, 0xa9, 0x8a, 0x98, 0x58, 0x4b, 0x89, 0x88, 0x5b, 0x75, 0xd7, 0x8a, 0x78, 0x46,
+        0x62, 0x63, 0x96, 0x7a, 0x5f, 0xd6, 0x05, 0x60, 0x95, 0x9b, 0x5d, 0x25, 0x94, 0x69, 0xf6, 0x7c,
+        0x67, 0x97, 0xd4, 0x77, 0x57, 0xb5, 0x94, 0xf9, 0x22, 0x92, 0x1a, 0x1e, 0xa5, 0xca, 0x15, 0xaf,
+        0x2a, 0xdb, 0xad, 0xeb, 0x18, 0xaf, 0xab, 0x37, 0xa6, 0x9a, 0x76, 0xa7, 0x59, 0x3a, 0x9a, 0x89,
+        0x65, 0x7f, 0xf8, 0x13, 0x81, 0x37, 0x81, 0x75, 0xa7, 0x98, 0x6e, 0x66, 0xea, 0x6e, 0xe7, 0x49,
+        0x77, 0x37, 0x37, 0x80, 0x27, 0xeb, 0x7e, 0x99, 0xab, 0x93, 0xd9, 0x76, 0xa9, 0x3a, 0x84, 0xa8,
+        0x1b, 0x50, 0xb7, 0x3b, 0x32, 0xb6, 0xfb, 0x7e, 0xb8, 0x1b, 0x29, 0xae, 0xdb, 0x2e, 0xa0, 0x9a,
+        0x40, 0xa3, 0xf8, 0x7b, 0x8d, 0x38, 0x8f, 0x77, 0x37, 0x99, 0x79, 0xb6, 0xbd, 0x68, 0x96, 0xc5,
+        0x6c, 0x86, 0xc8, 0x6c, 0x56, 0xe1, 0x70, 0xc6, 0xcb, 0x82, 0xb7, 0xfc, 0x80, 0x19, 0x44, 0x8e,
+        0x79, 0x28, 0xa4, 0x4a, 0x22, 0xa1, 0xfa, 0x41, 0xa8, 0xba, 0x4d, 0xa1, 0xaa, 0x16, 0xa1, 0x79,
+        0x54, 0x93, 0xf9, 0x82, 0x7f, 0x58, 0x0e, 0x80, 0x96, 0x79, 0x6e, 0x36, 0xa9, 0x56, 0x35, 0x6d,
+        0x56, 0x35, 0x55, 0x51, 0x75, 0x58, 0x54, 0xc5, 0x3a, 0x53, 0x46, 0x25, 0x64, 0x36, 0x01, 0x71,
+        0x36, 0xf8, 0x6f, 0x88, 0x93, 0x82, 0xe8, 0x6b, 0x8f, 0xd9, 0x01, 0x8f, 0x79, 0x04, 0x93, 0xd8,
+        0xf9, 0x86, 0x18, 0x80, 0x87, 0xe7, 0x90, 0x75, 0xd7, 0x9c, 0x63, 0x86, 0x67, 0x66, 0xc4, 0xde,
+        0x52, 0x94, 0xec, 0x47, 0x44, 0x80, 0x48, 0x24, 0x93, 0x44, 0x24, 0x7f, 0x56, 0xf5, 0x5e, 0x55,
+        0x76, 0x31, 0x65, 0x26, 0x0e, 0x7c, 0x77, 0x99, 0x79, 0x98, 0xca, 0x87, 0xc8, 0xc0, 0x96, 0xe9,
+        0x62, 0x96, 0x18, 0xed, 0x94, 0xa9, 0x0b, 0x85, 0xc8, 0x65, 0x86, 0xc7, 0x69, 0x76, 0x17, 0x9d,
+        0x5f, 0xf5, 0xef, 0x5e, 0xd7, 0x43, 0x75, 0x57, 0x13, 0x87, 0x78, 0x66, 0x86, 0xe9, 0x96, 0x93,
+        0x69, 0x73, 0x9c, 0xb9, 0xde, 0x9d, 0xa9, 0x17, 0x95, 0xd9, 0x24, 0x85, 0xb8, 0x86, 0x88, 0x47,
+        0x48, 0x72, 0x37, 0x62, 0x67, 0xb6, 0x96, 0x69, 0x75, 0xa0, 0x5e, 0x35, 0xac, 0x61, 0x86, 0x09,
+        0x60, 0x76, 0xea, 0x69, 0x76, 0xd5, 0x85, 0x38, 0x22, 0x82, 0x29, 0x4c, 0x97, 0xc9, 0x45, 0xa9,
+        0x3a, 0x6b, 0xa6, 0xbb, 0x3d, 0xb0, 0xdb, 0x50, 0xb1, 0x3b, 0x10, 0xb0, 0x9a, 0x24, 0xa8, 0x8a,
+        0x50, 0x8f, 0x79, 0x15, 0x91, 0x08, 0x38, 0x81, 0xe8, 0x58, 0x72, 0xe7, 0x3c, 0x74, 0x16, 0xf9,
+        0x73, 0x46, 0xfa, 0x74, 0x17, 0x30, 0x73, 0x48, 0xa8, 0x83, 0xe8, 0x7a, 0x9a, 0x39, 0x8c, 0x99,
+        0x0a, 0xb2, 0xac, 0xaa, 0x8e, 0xb5, 0x6b, 0x53, 0xb5, 0x8b, 0x9d, 0xb5, 0x2b, 0x95, 0xae, 0x7b,
+        0x12, 0xb0, 0xa9, 0x80, 0x9d, 0x79, 0x90, 0x85, 0x78, 0x84, 0x88, 0x57, 0x3c, 0x71, 0x27, 0x4c,
+        0x6b, 0xb6, 0xc4, 0x6c, 0x26, 0x4d, 0x68, 0x56, 0x49, 0x73, 0x87, 0x14, 0x71, 0x08, 0x37, 0x7d,
+        0xf8, 0x25, 0x97, 0x69, 0x4b, 0x94, 0x69, 0xe8, 0xa2, 0x49, 0xe4, 0xa5, 0x2a, 0x3b, 0xa3, 0xfa,
+        0x04, 0x9d, 0xfa, 0x25, 0x8f, 0x19, 0x0c, 0x8f, 0xe7, 0x75, 0x7e, 0x57, 0xa3, 0x61, 0x56, 0x20,
+        0x62, 0x35, 0x85, 0x55, 0x65, 0x97, 0x4f, 0x24, 0xed, 0x4e, 0xc5, 0x57, 0x57, 0xb5, 0x3c, 0x60,
+        0xe5, 0xf2, 0x5f, 0xa7, 0xa3, 0x73, 0x57, 0x78, 0x86, 0x88, 0x5c, 0x85, 0xb8, 0xf8, 0x91, 0xe8,
+        0xde, 0x8e, 0x08, 0xec, 0x8f, 0xd8, 0x77, 0x83, 0xd8, 0x7c, 0x74, 0x17, 0x70, 0x76, 0xd5, 0xc2,
+        0x61, 0x05, 0xcf, 0x4e, 0x65, 0x07, 0x50, 0x14, 0x7a, 0x43, 0x74, 0x74, 0x4c, 0x94, 0xcd, 0x4b,
+        0xf5, 0x36, 0x55, 0x95, 0x1a, 0x6b, 0xe6, 0x92, 0x69, 0xa8, 0x01, 0x7a, 0xa7, 0xec, 0x92, 0x09,
+        0x09, 0x90, 0x49, 0x2b, 0x97, 0x59, 0x37, 0x92, 0x19, 0x1d, 0x91, 0xe8, 0x72, 0x85, 0x78, 0xa0,
+        0x53, 0x75, 0x32, 0x52, 0xf6, 0x46, 0x65, 0x76, 0x1a, 0x79, 0x87, 0x84, 0x78, 0x19, 0x0a, 0x89,
+        0xe8, 0xdf, 0x9b, 0xb9, 0xc1, 0x9c, 0x29, 0x93, 0x9c, 0xe9, 0x92, 0x93, 0xa9, 0x58, 0x95, 0x08,
+        0x41, 0x82, 0x28, 0x5c, 0x74, 0xe7, 0x76, 0x77, 0x36, 0x02, 0x65, 0xe6, 0x1c, 0x5f, 0x85, 0xf6,
+        0x5f, 0x86, 0x50, 0x60, 0x66, 0x4d, 0x76, 0x47, 0x3e, 0x73, 0x78, 0x5a, 0x87, 0xf8, 0x3e, 0x9d,
+        0x59, 0xa3, 0x9a, 0x5a, 0xfa, 0xab, 0x4a, 0xfb, 0xb4, 0xbb, 0x40, 0xb4, 0x4a, 0xe6, 0xb4, 0x2b,
+        0x07, 0x9f, 0x0a, 0x07, 0xa0, 0xa9, 0x28, 0x91, 0x39, 0x4d, 0x7c, 0x97, 0xec, 0x7e, 0x87, 0x17,
+        0x76, 0x57, 0x2c, 0x6d, 0x86, 0xda, 0x6d, 0x87, 0xd2, 0x77, 0x87, 0xb1, 0x8a, 0x18, 0x8e, 0x88,
+        0xb9, 0xd3, 0x9d, 0xf9, 0x9c, 0xac, 0xda, 0xc0, 0xac, 0x4b, 0x9b, 0xb4, 0x6b, 0x85, 0xb7, 0x0b,
+        0x88, 0xb8, 0x9a, 0x64, 0xab, 0x2a, 0x70, 0x95, 0x29, 0x80, 0x98, 0x78, 0x0c, 0x7e, 0x78, 0x27,
+        0x72, 0x17, 0x36, 0x73, 0x56, 0x2b, 0x67, 0x16, 0x2b, 0x69, 0x26, 0x79, 0x67, 0x97, 0x43, 0x6e,
+        0xd7, 0x31, 0x87, 0x88, 0x4e, 0x84, 0x59, 0x2f, 0x95, 0xf9, 0x1b, 0xa1, 0x59, 0xeb, 0x9f, 0x3a,
+        0x54, 0xa2, 0x4a, 0x5e, 0x9b, 0x59, 0xba, 0x9b, 0xb8, 0x77, 0x8e, 0x48, 0xa0, 0x70, 0xa7, 0x1d,
+        0x72, 0x06, 0x26, 0x60, 0x66, 0x47, 0x50, 0x95, 0x1d, 0x51, 0xb4, 0xe4, 0x51, 0xb4, 0xda, 0x53,
+        0x55, 0x1b, 0x51, 0xe6, 0x95, 0x63, 0x16, 0x76, 0x78, 0x77, 0x74, 0x76, 0xc8, 0x77, 0x89, 0x18,
+        0x4d, 0x8e, 0xb8, 0xef, 0x8e, 0xf9, 0x05, 0x8c, 0x59, 0x01, 0x83, 0x68, 0x60, 0x85, 0x76, 0xc4,
+        0x71, 0x86, 0xda, 0x5b, 0xc5, 0xdf, 0x5e, 0x54, 0xd5, 0x4a, 0x24, 0xe2, 0x49, 0x94, 0xa1, 0x4a,
+        0x14, 0x86, 0x4b, 0x74, 0x7a, 0x5b, 0xf5, 0x96, 0x59, 0xc7, 0x01, 0x6a, 0x46, 0xe5, 0x86, 0x88,
+        0x47, 0x84, 0x38, 0xf2, 0x93, 0x08, 0xf7, 0x97, 0x89, 0x61, 0x96, 0xc9, 0x3c, 0x92, 0x49, 0x69,
+        0x4c, 0x64, 0xc3, 0x4c, 0x75, 0x72, 0x58, 0x55, 0x44, 0x69, 0x76, 0x84, 0x68, 0x78, 0x32, 0x7c,
+        0x28, 0x06, 0x94, 0xf9, 0x49, 0x94, 0x89, 0xa6, 0x9d, 0x89, 0x95, 0x9c, 0xf9, 0xdb, 0x9e, 0x79,
+        0x2b, 0x90, 0x19, 0x45, 0x84, 0x88, 0x6f, 0x86, 0xf6, 0xcd, 0x72, 0xa6, 0xed, 0x64, 0xc6, 0x4f,
+        0x65, 0x76, 0x11, 0x5e, 0x36, 0x21, 0x6b, 0x16, 0x9b, 0x69, 0x67, 0x5d, 0x78, 0xf7, 0x55, 0x8e,
+        0x08, 0xa6, 0x8a, 0xba, 0x4a, 0xa0, 0x4a, 0x45, 0xb1, 0xfb, 0x03, 0xaf, 0xfb, 0x42, 0xb8, 0xfb,
+        0x52, 0xab, 0xfa, 0xc8, 0xac, 0xba, 0x26, 0xa1, 0x1a, 0x52, 0x8b, 0xb8, 0xdd, 0x8d, 0x77, 0xac,
+        0x80, 0x77, 0xbe, 0x6e, 0x36, 0xf1, 0x6f, 0x27, 0x59, 0x70, 0x27, 0x46, 0x7c, 0x37, 0xb7, 0x7b,
+        0x18, 0xd1, 0x8e, 0x58, 0xa7, 0x9f, 0xa9, 0xe2, 0x9e, 0x1b, 0x32, 0xac, 0xcb, 0x09, 0xb8, 0xcb,
+        0x96, 0xb9, 0x4b, 0x01, 0xb4, 0x5b, 0x06, 0xa4, 0xfa, 0x6d, 0xa7, 0x09, 0x0c, 0x8e, 0xe9, 0x2b,
+        0x7e, 0x18, 0x02, 0x80, 0x56, 0x75, 0x6c, 0xa6, 0x8c, 0x65, 0x16, 0x4a, 0x64, 0xd6, 0x89, 0x63,
+        0xd6, 0x83, 0x77, 0x97, 0x51, 0x74, 0xa8, 0x34, 0x85, 0xe8, 0x21, 0x96, 0xe9, 0x38, 0x93, 0xba,
+        0x2a, 0x9e, 0x6a, 0x29, 0xa1, 0xaa, 0x17, 0xa0, 0xd9, 0x4a, 0x9a, 0xc9, 0x69, 0x80, 0xe8, 0x20,
+        0x82, 0x77, 0x0a, 0x6f, 0x67, 0x38, 0x59, 0x85, 0xaf, 0x5a, 0xe4, 0xe3, 0x52, 0xe4, 0xe8, 0x4b,
+        0x04, 0xa1, 0x4a, 0x55, 0xb5, 0x54, 0xd5, 0x93, 0x67, 0xd6, 0x6a, 0x66, 0x27, 0x97, 0x7b, 0x07,
+        0x71, 0x88, 0x18, 0x76, 0x87, 0xc9, 0x25, 0x8d, 0x59, 0x15, 0x8d, 0x98, 0xf7, 0x8f, 0x77, 0xbf,
+        0x81, 0x47, 0xd2, 0x6b, 0xa6, 0xe7, 0x6e, 0xe5, 0x97, 0x56, 0xf5, 0xae, 0x4e, 0x24, 0xf7, 0x4f,
+        0x84, 0x39, 0x47, 0x84, 0x39, 0x4f, 0x74, 0xdc, 0x4e, 0x35, 0xfb, 0x59, 0xf5, 0xe4, 0x76, 0xc7,
+        0x40, 0x74, 0x18, 0x50, 0x87, 0xf8, 0x44, 0x95, 0xa9, 0x2f, 0x93, 0x79, 0xaa, 0x98, 0x49, 0xc3,
+        0x4b, 0x04, 0xce, 0x4c, 0xb4, 0xe5, 0x50, 0x44, 0xc8, 0x5b, 0x45, 0xac, 0x5a, 0x57, 0x38, 0x6c,
+        0x97, 0x0a, 0x88, 0x28, 0x76, 0x87, 0x79, 0x51, 0x97, 0x19, 0x37, 0x9f, 0xfa, 0x04, 0xa0, 0x59,
+        0xd8, 0x9a, 0x09, 0xe4, 0x93, 0x79, 0x64, 0x95, 0xc7, 0xbb, 0x82, 0x07, 0xe6, 0x6f, 0x87, 0x0f,
+        0x71, 0x26, 0x44, 0x62, 0x46, 0x60, 0x66, 0x16, 0x4e, 0x64, 0xb6, 0x9a, 0x6d, 0x56, 0x99, 0x7e,
+        0x77, 0xb5, 0x7b, 0x79, 0x62, 0x91, 0x49, 0x52, 0xa8, 0xea, 0x67, 0xa6, 0x7b, 0x33, 0xb7, 0x0b,
+        0x2c, 0xb3, 0x0b, 0x32, 0xb3, 0x1a, 0xfe, 0xae, 0x4b, 0x20, 0x9b, 0x19, 0xd9, 0x9d, 0x58, 0x84,
+        0x8e, 0x58, 0xa2, 0x75, 0xd7, 0x75, 0x77, 0x77, 0x45, 0x6f, 0xd7, 0x40, 0x72, 0xe7, 0x2e, 0x72,
+        0xa7, 0xe3, 0x7f, 0xc7, 0xb5, 0x8f, 0x88, 0xe5, 0x8e, 0x3a, 0x69, 0x9f, 0x7a, 0x36, 0xb3, 0x5b,
+        0x35, 0xb2, 0xfb, 0x3e, 0xb6, 0xbb, 0x35, 0xaf, 0xeb, 0x19, 0xb1, 0x2a, 0x07, 0x9e, 0x1a, 0x1b,
+        0x8d, 0x89, 0x07, 0x90, 0x07, 0x22, 0x78, 0x07, 0x43, 0x68, 0x76, 0x87, 0x68, 0xb6, 0x2d, 0x5f,
+        0x46, 0x37, 0x6b, 0x26, 0x93, 0x68, 0xa7, 0x31, 0x76, 0x07, 0x20, 0x87, 0xb8, 0x43, 0x84, 0x79,
+        0x93, 0x94, 0xc9, 0x8a, 0xa1, 0x19, 0xf9, 0x9f, 0x59, 0xc6, 0xa1, 0x99, 0xdc, 0x8e, 0xe9, 0x03,
+        0x90, 0x18, 0x0e, 0x7f, 0x68, 0x3d, 0x67, 0x96, 0x9b, 0x69, 0x55, 0x5c, 0x5a, 0xf5, 0x69, 0x49,
+        0x64, 0x9f, 0x49, 0xf5, 0x0e, 0x4c, 0x44, 0xfc, 0x58, 0x65, 0x7b, 0x57, 0xa6, 0x9c, 0x6a, 0x56,
+        0x6b, 0x7b, 0x97, 0xa2, 0x7a, 0x48, 0xdb, 0x87, 0x38, 0xb1, 0x91, 0x49, 0x28, 0x92, 0x78, 0x7c,
+        0x8b, 0xf8, 0x80, 0x7b, 0xc7, 0xe4, 0x7e, 0xd6, 0x95, 0x66, 0xd6, 0xb1, 0x59, 0x15, 0xb6, 0x5b,
+        0x04, 0x6a, 0x4b, 0xb4, 0x74, 0x49, 0x84, 0x8e, 0x48, 0xc5, 0x26, 0x4d, 0xd5, 0x1a, 0x66, 0x36,
+        0x3e, 0x63, 0x87, 0x5c, 0x79, 0x07, 0x4c, 0x8b, 0xc8, 0x94, 0x89, 0xb9, 0xa2, 0x96, 0xf9, 0xaa,
+        0x50, 0xb5, 0x30, 0x52, 0xc4, 0xb6, 0x4e, 0x54, 0xac, 0x50, 0xd5, 0x08, 0x50, 0xd6, 0x4b, 0x5d,
+        0xc6, 0x1c, 0x79, 0x57, 0x84, 0x78, 0x38, 0xa2, 0x8b, 0x68, 0x7c, 0x9c, 0x49, 0xbb, 0x9b, 0xba,
+        0x28, 0x9e, 0x2a, 0x21, 0x9f, 0x7a, 0x12, 0xa1, 0x88, 0xb4, 0x91, 0xb8, 0xdc, 0x7d, 0xf7, 0xfd,
+        0x7f, 0xe6, 0xe0, 0x6c, 0xc7, 0x07, 0x67, 0x36, 0x6e, 0x67, 0x16, 0x2d, 0x67, 0x26, 0x30, 0x71,
+        0x06, 0xe6, 0x6e, 0x38, 0x63, 0x81, 0x28, 0x55, 0x9a, 0xe9, 0x83, 0x97, 0xea, 0xb2, 0xae, 0x9a,
+        0xa9, 0xb3, 0xfb, 0x2e, 0xb3, 0x0b, 0x9a, 0xb6, 0x6b, 0xa4, 0xa9, 0xfa, 0xb8, 0xab, 0x89, 0x81,
+        0x9e, 0x49, 0xa2, 0x82, 0x38, 0x45, 0x84, 0x87, 0x9e, 0x77, 0x07, 0xad, 0x70, 0x27, 0x0e, 0x70,
+        0xc7, 0x34, 0x75, 0x77, 0x15, 0x80, 0x17, 0xf3, 0x7f, 0xa9, 0x73, 0x8f, 0xa9, 0x3e, 0xa8, 0x9a,
+        0x77, 0xa7, 0x3b, 0x01, 0xb2, 0x5a, 0xe6, 0xb5, 0x0b, 0x59, 0xb6, 0x1a, 0xca, 0xa9, 0xda, 0xd8,
+        0x9d, 0xca, 0x00, 0x9f, 0xc8, 0x15, 0x87, 0x78, 0x3b, 0x71, 0xe7, 0x2e, 0x73, 0x06, 0x48, 0x61,
+        0xe6, 0x5a, 0x63, 0xf6, 0x27, 0x62, 0x56, 0x56, 0x68, 0xa6, 0x4e, 0x77, 0x97, 0x43, 0x74, 0x48,
+        0xb9, 0x86, 0x38, 0xa6, 0x99, 0x79, 0x6c, 0x96, 0x69, 0xd4, 0xa1, 0xb9, 0xde, 0x98, 0xa9, 0x80,
+        0x98, 0x49, 0x06, 0x8e, 0x69, 0x23, 0x77, 0x47, 0x98, 0x79, 0x96, 0x27, 0x68, 0x36, 0x42, 0x4e,
+        0xd5, 0x01, 0x50, 0x94, 0xe3, 0x49, 0xd4, 0xdd, 0x4d, 0x84, 0xd7, 0x4d, 0x05, 0x97, 0x5a, 0x95,
+        0x6f, 0x6b, 0x16, 0xa3, 0x6a, 0x28, 0x22, 0x7b, 0x67, 0xf9, 0x8d, 0xb8, 0xde, 0x8d, 0xb8, 0xd6,
+        0x90, 0x68, 0xca, 0x88, 0xc8, 0x9c, 0x8a, 0x97, 0x9c, 0x76, 0xe7, 0xb2, 0x68, 0x46, 0xb2, 0x6b,
+        0x05, 0x02, 0x56, 0x45, 0x20, 0x4b, 0x04, 0xb2, 0x4b, 0x34, 0xaf, 0x47, 0x94, 0xac, 0x58, 0x35,
+        0x62, 0x55, 0xe6, 0x56, 0x68, 0x46, 0x3c, 0x7e, 0x07, 0xa8, 0x7a, 0x99, 0x27, 0x8e, 0x09, 0x1d,
+        0x5c, 0x05, 0xe9, 0x5e, 0xf4, 0xf3, 0x53, 0x84, 0xf3, 0x4c, 0x24, 0xd1, 0x4d, 0x25, 0x8b, 0x52,
+        0xd5, 0x69, 0x6a, 0x16, 0x8e, 0x69, 0x17, 0xb6, 0x7c, 0x67, 0x88, 0x92, 0xd9, 0x15, 0x91, 0x6a,
+        0x09, 0x9b, 0xd9, 0xfb, 0xa6, 0xda, 0x6d, 0xa6, 0xf9, 0x83, 0x9e, 0x69, 0xa3, 0x8d, 0xf8, 0xf6,
+        0x8f, 0xc7, 0xbb, 0x7a, 0x77, 0xe5, 0x6f, 0x36, 0xfb, 0x70, 0x06, 0x23, 0x67, 0xf6, 0x3b, 0x68,
+        0x66, 0x69, 0x66, 0xd7, 0x85, 0x73, 0x77, 0x79, 0x8b, 0x78, 0x87, 0x88, 0x19, 0xe6, 0xa1, 0x29,
+        0xd5, 0xae, 0x1a, 0xbf, 0xac, 0x1b, 0xbb, 0xb7, 0x8b, 0xbb, 0xb4, 0x1b, 0x4f, 0xb5, 0x2a, 0x77,
+        0xad, 0x1a, 0x95, 0x91, 0xf9, 0x43, 0x94, 0x28, 0x54, 0x82, 0xc8, 0x6e, 0x73, 0xf7, 0x5e, 0x75,
+        0x76, 0xed, 0x71, 0xb6, 0xd9, 0x74, 0x87, 0x3a, 0x74, 0x18, 0x70, 0x7f, 0xe8, 0x3d, 0x99, 0x99,
+        0x87, 0x97, 0xda, 0x69, 0xa7, 0xca, 0x3a, 0xb3, 0x3b, 0x2a, 0xb3, 0x3b, 0x3b, 0xaf, 0xcb, 0x34,
+        0xab, 0x2a, 0xce, 0xac, 0x69, 0x14, 0x97, 0x49, 0x3b, 0x80, 0x28, 0x13, 0x81, 0xb6, 0xc7, 0x6a,
+        0x56, 0xe9, 0x63, 0x36, 0x35, 0x63, 0x25, 0xcc, 0x60, 0xf5, 0xd0, 0x68, 0x26, 0x60, 0x65, 0xf7,
+        0xb5, 0x75, 0xc7, 0xa0, 0x8c, 0x18, 0x94, 0x88, 0xb9, 0x70, 0x9a, 0xb9, 0x67, 0x9a, 0xe9, 0xa1,
+        0x9a, 0x39, 0xa9, 0x97, 0xf9, 0xbf, 0x86, 0xf8, 0x8f, 0x88, 0x87, 0x2b, 0x77, 0xe7, 0x4b, 0x5a,
+        0xe5, 0xca, 0x5d, 0x05, 0x24, 0x4e, 0xa5, 0x2c, 0x48, 0xc4, 0x98, 0x49, 0x84, 0xdb, 0x4f, 0x84,
+        0xb9, 0x5b, 0xa5, 0xa6, 0x5a, 0x17, 0x29, 0x6b, 0xa6, 0xf9, 0x83, 0xb8, 0x31, 0x82, 0xe8, 0xb5,
+        0x8d, 0xb8, 0x95, 0x8f, 0x99, 0x00, 0x90, 0x58, 0x75, 0x84, 0x88, 0x85, 0x79, 0x07, 0xbc, 0x7b,
+        0x25, 0xf1, 0x64, 0xe6, 0x15, 0x53, 0x65, 0x40, 0x54, 0x64, 0xac, 0x47, 0xd4, 0xba, 0x4f, 0x44,
+        0xe7, 0x4e, 0x25, 0x65, 0x59, 0x85, 0x58, 0x6d, 0x06, 0x9f, 0x69, 0xf8, 0x4f, 0x80, 0x08, 0x3e,
+        0x6a, 0x76, 0xd8, 0x6d, 0xd5, 0x8a, 0x5d, 0xd5, 0x9c, 0x4e, 0x04, 0xfe, 0x4f, 0xf5, 0x2d, 0x4d,
+        0x65, 0x17, 0x5d, 0x45, 0xca, 0x5c, 0xa6, 0xbf, 0x6d, 0x16, 0x90, 0x84, 0xe8, 0x36, 0x83, 0x59,
+        0x89, 0x92, 0xe9, 0x6a, 0xa6, 0x8a, 0x65, 0xa6, 0x5a, 0x0f, 0xa5, 0xaa, 0x1d, 0x9b, 0xe9, 0xd0,
+        0x9d, 0x58, 0xb7, 0x8a, 0x68, 0xe4, 0x7b, 0xe7, 0xd4, 0x7d, 0x66, 0x88, 0x6e, 0xb6, 0xad, 0x66,
+        0x06, 0x57, 0x65, 0x96, 0xe8, 0x6a, 0x46, 0xe2, 0x7c, 0x37, 0x9b, 0x79, 0x88, 0xed, 0x91, 0x98,
+        0xd7, 0xa2, 0x59, 0xfc, 0xa0, 0x0b, 0x78, 0xb2, 0x9b, 0x66, 0xb8, 0x3b, 0x86, 0xb8, 0x7b, 0x32,
+        0xb7, 0xdb, 0x42, 0xa1, 0x7a, 0x36, 0xa3, 0xa9, 0x42, 0x91, 0xe9, 0x61, 0x7d, 0xf8, 0x0a, 0x80,
+        0x37, 0x16, 0x74, 0xe7, 0x14, 0x6d, 0xc6, 0xe4, 0x6e, 0x57, 0xa5, 0x73, 0xa7, 0x79, 0x89, 0x78,
+        0x7f, 0x88, 0x99, 0x82, 0x99, 0x09, 0x51, 0xaa, 0xca, 0x9c, 0xa9, 0xdb, 0x38, 0xae, 0x6b, 0x28,
+        0xb3, 0x8b, 0x3e, 0xb3, 0xd9, 0xf2, 0xa5, 0x8a, 0x0f, 0x90, 0x09, 0x1b, 0x91, 0xe7, 0x9d, 0x78,
+        0x57, 0xc4, 0x6a, 0x26, 0xac, 0x6a, 0x45, 0xa7, 0x60, 0x25, 0xba, 0x5e, 0xe5, 0xcc, 0x5c, 0xc6,
+        0xc2, 0x67, 0x46, 0xb0, 0x7c, 0x37, 0x8d, 0x78, 0xd8, 0xb4, 0x8d, 0xc8, 0x9e, 0x96, 0x69, 0x47,
+        0x94, 0x79, 0xea, 0x9b, 0x69, 0xf2, 0x92, 0xe9, 0x3c, 0x93, 0xe8, 0x23, 0x88, 0x48, 0x48, 0x69,
+        0xf6, 0xcc, 0x6c, 0xc5, 0xcb, 0x5a, 0x15, 0xe5, 0x4b, 0x34, 0xd2, 0x4c, 0x84, 0x76, 0x4a, 0x14,
+        0x65, 0x4e, 0x14, 0xd5, 0x4d, 0x96, 0x24, 0x5b, 0x35, 0xf3, 0x74, 0xf7, 0x3f, 0x74, 0x08, 0x2a,
+        0x84, 0x07, 0xfa, 0x8f, 0x48, 0xf0, 0x8e, 0xf8, 0xf8, 0x8b, 0xb8, 0xfd, 0x86, 0xf8, 0x96, 0x89,
+        0x56, 0xf0, 0x75, 0x77, 0x18, 0x61, 0x06, 0x25, 0x62, 0xc5, 0x16, 0x4f, 0x95, 0x3e, 0x4d, 0xa4,
+        0xd5, 0x4d, 0x04, 0xc4, 0x50, 0x64, 0xcc, 0x5d, 0xb5, 0xaa, 0x5b, 0x47, 0x4c, 0x6f, 0x97, 0x3e,
+        0x7a, 0x17, 0xd0, 0x7c, 0xf6, 0x69, 0x6b, 0xe6, 0x7d, 0x56, 0x45, 0x8b, 0x58, 0x85, 0x2d, 0x4e,
+        0x25, 0x21, 0x54, 0xf5, 0x50, 0x55, 0x05, 0xe3, 0x5f, 0xb5, 0xb6, 0x75, 0x87, 0x3c, 0x73, 0xd8,
+        0xbe, 0x85, 0x48, 0x93, 0xa0, 0x69, 0xf1, 0x9e, 0xaa, 0x2a, 0xa6, 0x6a, 0x2c, 0xa5, 0xba, 0x61,
+        0xa5, 0xc9, 0xaa, 0x98, 0xa9, 0xcc, 0x8b, 0x68, 0xcf, 0x8c, 0xc7, 0x46, 0x7a, 0xf7, 0x77, 0x6a,
+        0x96, 0xa8, 0x6a, 0xc6, 0xa0, 0x67, 0x16, 0xb2, 0x70, 0xf6, 0xed, 0x6f, 0x07, 0xfe, 0x82, 0x27,
+        0xe1, 0x93, 0x49, 0x08, 0x91, 0x0a, 0xd6, 0xa7, 0xaa, 0xb8, 0xb5, 0xdb, 0x55, 0xb4, 0xcb, 0x95,
+        0xbc, 0xfb, 0x97, 0xad, 0xea, 0xfa, 0xb0, 0x0a, 0x41, 0xa1, 0xba, 0x59, 0x8c, 0x58, 0xf0, 0x8f,
+        0x17, 0x9a, 0x7e, 0x17, 0xa2, 0x6e, 0x56, 0xf9, 0x70, 0x17, 0x23, 0x6c, 0xe7, 0x06, 0x7b, 0x67,
+        0xaa, 0x7a, 0x28, 0x7c, 0x89, 0x08, 0x51, 0x9d, 0xa9, 0xc2, 0x9b, 0xfa, 0xc9, 0xa6, 0xca, 0xa9,
+        0xb4, 0xeb, 0x4f, 0xb4, 0x8a, 0x92, 0xae, 0x0a, 0xaa, 0x9f, 0x2a, 0x03, 0xa0, 0x08, 0x9a, 0x88,
+        0xb8, 0xc8, 0x76, 0x17, 0x7a, 0x77, 0x55, 0xf9, 0x65, 0xa6, 0x20, 0x5a, 0xb5, 0x9d, 0x59, 0xf6,
+        0x08, 0x5c, 0x36, 0x09, 0x6c, 0x76, 0x9a, 0x69, 0xa7, 0xb8, 0x7e, 0x47, 0xa0, 0x8b, 0x88, 0x8b,
+        0x89, 0x39, 0xbb, 0x97, 0x49, 0xb2, 0x98, 0xa9, 0x91, 0x98, 0xb8, 0xf1, 0x94, 0x59, 0x0d, 0x7a,
+        0x37, 0xc9, 0x7c, 0xb6, 0xb8, 0x69, 0x46, 0xd5, 0x54, 0x95, 0x6e, 0x56, 0x84, 0x82, 0x4c, 0x04,
+        0x80, 0x46, 0x44, 0x66, 0x46, 0xd5, 0x49, 0x4d, 0xe5, 0x1b, 0x64, 0x76, 0x38, 0x63, 0x77, 0x42,
+        0x75, 0x37, 0x15, 0x87, 0x68, 0x66, 0x86, 0x69, 0x0d, 0x8b, 0xe8, 0xfe, 0x91, 0x39, 0x26, 0x92,
+        0x27, 0xe6, 0x84, 0xb8, 0x06, 0x71, 0x17, 0x2e, 0x73, 0x65, 0xea, 0x5d, 0x26, 0x0d, 0x52, 0xa5,
+        0x3f, 0x53, 0x64, 0x8a, 0x4d, 0xa4, 0x9c, 0x52, 0xa5, 0x05, 0x50, 0x66, 0x48, 0x5f, 0xc6, 0x3e,
+        0x87, 0xb8, 0xa3, 0x8a, 0x77, 0x63, 0x7b, 0x27, 0x7a, 0x63, 0x16, 0x5e, 0x65, 0xc5, 0x86, 0x55,
+        0x25, 0x90, 0x52, 0xc5, 0x41, 0x54, 0x95, 0x45, 0x56, 0x95, 0x2a, 0x66, 0x96, 0x56, 0x65, 0x07,
+        0xc7, 0x75, 0x87, 0xa2, 0x94, 0x99, 0x28, 0x92, 0xe9, 0xe5, 0xa1, 0x49, 0xd7, 0xa9, 0x7a, 0x94,
+        0xa9, 0x2a, 0x58, 0xa3, 0x5a, 0x77, 0x9a, 0xb9, 0xc0, 0x9b, 0xd8, 0x32, 0x8a, 0x58, 0x66, 0x75,
+        0x07, 0x56, 0x76, 0x36, 0xcb, 0x6a, 0xb6, 0xe8, 0x6b, 0x46, 0x9c, 0x69, 0xf7, 0x2e, 0x76, 0x77,
+        0x24, 0x83, 0xe8, 0x05, 0x81, 0x09, 0xeb, 0x98, 0xc9, 0xcf, 0xad, 0x6a, 0xb9, 0xab, 0x9b, 0x83,
+        0xbb, 0xab, 0x7a, 0xb5, 0x5b, 0x67, 0xb6, 0xab, 0x1d, 0xae, 0xfb, 0x2c, 0x9c, 0x29, 0xf7, 0x9f,
+        0x18, 0x6f, 0x8c, 0x58, 0x86, 0x75, 0x57, 0x78, 0x77, 0xd7, 0x0c, 0x6c, 0x57, 0x03, 0x72, 0x17,
+        0x20, 0x71, 0xe7, 0x91, 0x7a, 0x97, 0x6a, 0x8d, 0xc8, 0xba, 0x8b, 0xca, 0x08, 0x99, 0xd9, 0xe4,
+        0xaf, 0xea, 0xea, 0xae, 0x8a, 0xc5, 0xb0, 0xda, 0xd1, 0xaa, 0x5a, 0xa7, 0xaa, 0x89, 0x91, 0x97,
+        0xb9, 0xb9, 0x85, 0xc8, 0x6f, 0x87, 0x26, 0xae, 0x71, 0x56, 0xd7, 0x5e, 0x55, 0xe4, 0x5e, 0x25,
+        0xb8, 0x58, 0x05, 0xc5, 0x60, 0x05, 0xdc, 0x5d, 0x96, 0xb9, 0x6e, 0x36, 0xa5, 0x7c, 0x97, 0x97,
+        0x79, 0xa9, 0x21, 0x8c, 0xb9, 0x13, 0x97, 0x79, 0x67, 0x97, 0x09, 0x66, 0x9a, 0xf9, 0x70, 0x88,
+        0x18, 0xa0, 0x8a, 0x57, 0xbf, 0x79, 0x77, 0xd8, 0x62, 0x66, 0x5a, 0x65, 0x25, 0x03, 0x54, 0xb5,
+        0x04, 0x45, 0x64, 0x6f, 0x46, 0xc4, 0xb4, 0x44, 0xf4, 0x94, 0x55, 0xe5, 0x4f, 0x55, 0x36, 0x42,
+        0x65, 0x06, 0x0d, 0x7a, 0xb7, 0x8d, 0x78, 0xd8, 0xb7, 0x85, 0x18, 0x96, 0x93, 0xc9, 0x40, 0x93,
+        0xa8, 0x95, 0x8e, 0x48, 0xa6, 0x81, 0x48, 0x22, 0x82, 0xb6, 0xe1, 0x6d, 0x47, 0x10, 0x5e, 0xb6,
+        0x00, 0x5f, 0xe4, 0xc3, 0x52, 0xd4, 0xea, 0x4d, 0x94, 0xbe, 0x4c, 0x75, 0x82, 0x54, 0x15, 0x7e,
+        0x91, 0xa9, 0x33, 0x93, 0x48, 0x4c, 0x89, 0x58, 0x58, 0x72, 0x17, 0x55, 0x75, 0xd6, 0x49, 0x61,
+        0x76, 0x53, 0x57, 0xd5, 0x9c, 0x59, 0x75, 0x08, 0x53, 0xc4, 0xfa, 0x5b, 0x45, 0xb0, 0x5a, 0xe6,
+        0xd8, 0x67, 0x26, 0xab, 0x85, 0x88, 0x3a, 0x83, 0xd9, 0x3e, 0x96, 0x59, 0x20, 0xa6, 0xea, 0x58,
+        0xa5, 0xba, 0xb4, 0xa8, 0x3a, 0xbb, 0xa7, 0x0a, 0x79, 0xa8, 0x29, 0x2c, 0x99, 0xe9, 0x5e, 0x83,
+        0x68, 0x3c, 0x84, 0x57, 0x5d, 0x74, 0x37, 0x80, 0x6b, 0xe6, 0xc0, 0x6b, 0xc6, 0xb7, 0x6f, 0xb6,
+        0xb6, 0x76, 0x07, 0x3f, 0x73, 0xf8, 0xf0, 0x89, 0x08, 0xd0, 0x9f, 0xe9, 0xdc, 0x9d, 0x8b, 0x13,
+        0xb3, 0xfa, 0xf8, 0xb6, 0xeb, 0x71, 0xb7, 0x3b, 0xb9, 0xb7, 0xcb, 0xb9, 0xaa, 0x6a, 0xd1, 0xad,
+        0x69, 0x6b, 0x9c, 0x49, 0x7e, 0x81, 0x88, 0x42, 0x84, 0xa7, 0x5c, 0x72, 0x37, 0x65, 0x6e, 0xb7,
+        0x02, 0x6f, 0xc6, 0xe7, 0x70, 0xa6, 0xc8, 0x7d, 0xf7, 0xcc, 0x7c, 0xd9, 0x10, 0x8a, 0x68, 0xe1,
+        0xa4, 0x7a, 0x30, 0xa2, 0xda, 0x96, 0xac, 0x2a, 0x87, 0xaf, 0x1a, 0xec, 0xae, 0xfa, 0x58, 0xa3,
+        0x6a, 0x74, 0x95, 0x59, 0x6d, 0x96, 0xe7, 0x95, 0x80, 0xc7, 0xca, 0x67, 0xf6, 0x86, 0x68, 0x75,
+        0xca, 0x5a, 0x65, 0xec, 0x58, 0xc5, 0x78, 0x57, 0x45, 0xdd, 0x61, 0x85, 0xdc, 0x6c, 0x56, 0x9d,
+        0x6a, 0x08, 0x44, 0x7e, 0xc8, 0x28, 0x8f, 0x88, 0xe2, 0x8d, 0xc9, 0x71, 0x9a, 0x69, 0x66, 0x91,
+        0x19, 0x1f, 0x91, 0xe8, 0xa4, 0x87, 0x78, 0xbc, 0x72, 0xf7, 0x5e, 0x75, 0xd5, 0xce, 0x62, 0x05,
+        0xe3, 0x4b, 0x74, 0xd7, 0x4e, 0x24, 0x8d, 0x44, 0x04, 0x7a, 0x4b, 0x44, 0xb9, 0x4b, 0x15, 0x4d,
+        0x56, 0x15, 0x21, 0x6a, 0xc6, 0x88, 0x69, 0x17, 0xf2, 0x78, 0xe7, 0xc5, 0x8f, 0xc8, 0xf2, 0x8e,
+        0xc8, 0xdd, 0x91, 0xb8, 0xe6, 0x8c, 0xa8, 0xd6, 0x8d, 0xe7, 0xe9, 0x7d, 0x18, 0x10, 0x6e, 0x47,
+        0x03, 0x6f, 0x75, 0x6e, 0x5d, 0xc5, 0x9c, 0x4f, 0xd4, 0xf4, 0x4f, 0xd5, 0x1f, 0x4e, 0x95, 0x25,
+        0x95, 0x59, 0x5c, 0x95, 0xe8, 0xf5, 0x93, 0xf8, 0xfa, 0x81, 0x38, 0x44, 0x84, 0x67, 0x36, 0x70,
+        0xb7, 0x48, 0x61, 0xa6, 0x4a, 0x64, 0x75, 0x2d, 0x57, 0x45, 0x39, 0x55, 0xd5, 0x64, 0x56, 0x66,
+        0x10, 0x5b, 0x95, 0xf4, 0x76, 0x07, 0x46, 0x74, 0x28, 0x5c, 0x87, 0xd8, 0x3b, 0x9e, 0x39, 0xbe,
+        0x9b, 0xea, 0xa3, 0xa6, 0x8a, 0xa3, 0xae, 0x9a, 0xe8, 0xae, 0xaa, 0x06, 0xa6, 0xba, 0x29, 0x92,
+        0x99, 0x3e, 0x94, 0x38, 0x2b, 0x82, 0x48, 0x60, 0x73, 0x37, 0x3c, 0x73, 0x86, 0xa8, 0x6f, 0x96,
+        0xb9, 0x6c, 0xe6, 0xb8, 0x6b, 0x78, 0x07, 0x7b, 0x57, 0xef, 0x90, 0x58, 0xe6, 0x8e, 0x0a, 0x4f,
+        0xa6, 0xda, 0x30, 0xb1, 0x6b, 0x0a, 0xb0, 0xfb, 0xeb, 0xb9, 0x9b, 0xd1, 0xb5, 0x4b, 0x76, 0xb7,
+        0x1a, 0x5f, 0xaa, 0xda, 0x72, 0x90, 0xc9, 0x3d, 0x93, 0xe8, 0x0b, 0x7e, 0x48, 0x1d, 0x72, 0x37,
+        0x4b, 0x74, 0x06, 0x94, 0x6c, 0x76, 0x8c, 0x72, 0x27, 0x0d, 0x71, 0xa8, 0x17, 0x7a, 0x97, 0xf0,
+        0x95, 0x99, 0x3d, 0x93, 0xc9, 0xfd, 0xa1, 0xc9, 0xdd, 0xad, 0x9a, 0xc8, 0xac, 0x3a, 0xc3, 0xa9,
+        0x0a, 0xd7, 0xa3, 0x0a, 0x3c, 0xa3, 0xa8, 0x95, 0x90, 0x88, 0xc7, 0x75, 0xf7, 0x73, 0x77, 0x06,
+        0x48, 0x63, 0x96, 0x72, 0x58, 0x75, 0x81, 0x58, 0x15, 0x54, 0x59, 0x95, 0x59, 0x5e, 0x95, 0xb8,
+        0x5b, 0xd7, 0x47, 0x6e, 0xa7, 0x29, 0x82, 0x68, 0x07, 0x80, 0x19, 0x08, 0x92, 0xd8, 0xf1, 0x93,
+        0x19, 0x2f, 0x93, 0xe9, 0x4b, 0x91, 0x09, 0x52, 0x81, 0xb8, 0x51, 0x84, 0x76, 0xcd, 0x72, 0x36,
+        0xe8, 0x57, 0xc5, 0xa5, 0x5a, 0x44, 0xcf, 0x49, 0xc4, 0xd2, 0x47, 0x44, 0x83, 0x48, 0x34, 0x90,
+        0x4a, 0xc4, 0x74, 0x5a, 0xc5, 0x90, 0x59, 0x86, 0xf9, 0x68, 0xc6, 0xd0, 0x85, 0x38, 0x40, 0x83,
+        0x58, 0xbe, 0x8e, 0x58, 0xa5, 0x92, 0xc9, 0x2f, 0x93, 0x08, 0xb8, 0x89, 0x78, 0xd6, 0x7e, 0x78,
+        0x02, 0x7f, 0xf6, 0x62, 0x6d, 0x06, 0x90, 0x58, 0xb5, 0x92, 0x59, 0xf5, 0x29, 0x50, 0x35, 0x3e,
+        0x92, 0x89, 0x32, 0x92, 0x89, 0x59, 0x98, 0x99, 0x49, 0x8d, 0xc9, 0x03, 0x90, 0x08, 0x24, 0x7f,
+        0xe8, 0x39, 0x6f, 0xf7, 0x30, 0x73, 0x05, 0xbc, 0x60, 0xa5, 0xc7, 0x56, 0x75, 0x79, 0x57, 0xf5,
+        0x99, 0x54, 0xb5, 0x88, 0x68, 0xf6, 0x76, 0x67, 0x87, 0x60, 0x77, 0xf7, 0x46, 0x91, 0x08, 0xe7,
+        0x8e, 0x6a, 0x36, 0x9e, 0x6a, 0x28, 0xb0, 0x0a, 0xe7, 0xae, 0x8a, 0x95, 0xae, 0xfa, 0xb4, 0xa1,
+        0x6a, 0x1e, 0xa2, 0x39, 0x26, 0x91, 0xd9, 0x59, 0x7f, 0x68, 0x09, 0x80, 0x36, 0xfa, 0x75, 0xc7,
+        0x1d, 0x69, 0xd6, 0x94, 0x69, 0x97, 0x62, 0x71, 0x37, 0x54, 0x81, 0x17, 0xf0, 0x7f, 0x29, 0x5c,
+        0x97, 0x09, 0x35, 0xa6, 0xfa, 0x53, 0xa5, 0x3b, 0xac, 0xb5, 0x2b, 0x92, 0xba, 0x4b, 0xb3, 0xbb,
+        0x1b, 0x21, 0xb6, 0x3b, 0x25, 0xa0, 0x6a, 0x40, 0xa3, 0x78, 0xfe, 0x8d, 0x99, 0x10, 0x7b, 0xb7,
+        0xea, 0x7e, 0x86, 0xb2, 0x6f, 0x36, 0xac, 0x6b, 0x96, 0xba, 0x6b, 0x77, 0x3e, 0x6e, 0x57, 0x21,
+        0x85, 0xf8, 0x40, 0x83, 0xb9, 0x1a, 0x93, 0xb8, 0xf9, 0xa5, 0x7a, 0x32, 0xa3, 0x6a, 0xc5, 0xa8,
+        0x8a, 0xc1, 0xab, 0x2a, 0xb3, 0xab, 0x09, 0x7b, 0x9e, 0x69, 0xa2, 0x85, 0xf8, 0x6b, 0x86, 0xf7,
+        0x18, 0x70, 0x97, 0x52, 0x5e, 0xd5, 0xf9, 0x5f, 0x95, 0x36, 0x58, 0x55, 0x48, 0x54, 0x25, 0x26,
+        0x52, 0x86, 0x4e, 0x5f, 0xa6, 0x37, 0x72, 0x87, 0x07, 0x70, 0x18, 0x4a, 0x86, 0x78, 0x27, 0x8e,
+        0x98, 0xd6, 0x8d, 0x89, 0x8b, 0x94, 0x09, 0x80, 0x8d, 0x68, 0xf6, 0x8f, 0xb7, 0xcb, 0x81, 0xe7,
+        0xdd, 0x66, 0xc6, 0x9d, 0x6a, 0x55, 0x78, 0x55, 0x15, 0x89, 0x49, 0x74, 0xbc, 0x4b, 0x94, 0x2d,
+        0x45, 0xc4, 0x21, 0x4d, 0xf4, 0xd3, 0x4d, 0x65, 0xf4, 0x58, 0xc5, 0xce, 0x76, 0x67, 0x48, 0x74,
+        0x18, 0x29, 0x84, 0x58, 0x05, 0x92, 0x39, 0x0a, 0x91, 0x09, 0x31, 0x90, 0x89, 0x45, 0x8c, 0xa8,
+        0xdc, 0x8d, 0x37, 0x61, 0x7d, 0x67, 0x9a, 0x66, 0x86, 0x7e, 0x68, 0x65, 0xa1, 0x58, 0x65, 0xcb,
+        0x8a, 0x08, 0x97, 0x89, 0xe9, 0x4f, 0x97, 0x79, 0x2b, 0x95, 0x69, 0x6e, 0x96, 0xa8, 0xfd, 0x8d,
+        0x19, 0x0b, 0x7f, 0x08, 0x26, 0x82, 0x06, 0x8c, 0x6e, 0x46, 0xa0, 0x5d, 0x25, 0xf7, 0x5f, 0x35,
+        0x7f, 0x54, 0x55, 0x85, 0x5f, 0xd5, 0xef, 0x5e, 0xb6, 0x7f, 0x6a, 0x56, 0x61, 0x81, 0xa7, 0xec,
+        0x7f, 0x49, 0x76, 0x91, 0xd9, 0x60, 0xaa, 0x6a, 0x8a, 0xa8, 0x9a, 0xca, 0xb1, 0x4a, 0xd7, 0xab,
+        0xaa, 0xbe, 0xab, 0x9a, 0x1a, 0xa0, 0x3a, 0x45, 0x8e, 0x48, 0xf9, 0x8f, 0xf7, 0xa7, 0x80, 0xe7,
+        0xd0, 0x6d, 0x46, 0xd9, 0x6d, 0xa7, 0x0f, 0x6d, 0x17, 0x15, 0x75, 0x27, 0x42, 0x73, 0x58, 0x69,
+        0x87, 0xf8, 0x43, 0x97, 0xe9, 0x60, 0x95, 0xfb, 0x13, 0xaa, 0xfa, 0xf1, 0xb8, 0x9b, 0x89, 0xb8,
+        0xbb, 0x8c, 0xbc, 0x6b, 0x81, 0xad, 0xba, 0xfe, 0xaf, 0xf9, 0xf8, 0x9d, 0x2a, 0x0a, 0x8a, 0x08,
+        0xcc, 0x8c, 0xf7, 0x30, 0x78, 0x27, 0x3f, 0x6b, 0x26, 0xc4, 0x6c, 0x66, 0xb9, 0x66, 0x96, 0xac,
+        0x77, 0xe7, 0x63, 0x76, 0x28, 0x17, 0x83, 0x97, 0xf7, 0x98, 0x69, 0x56, 0x95, 0xfa, 0x59, 0xa1,
+        0x3a, 0x4f, 0xad, 0xaa, 0xc3, 0xac, 0x4a, 0x19, 0xa7, 0xca, 0x37, 0x94, 0xc9, 0x58, 0x95, 0xd8,
+        0x17, 0x81, 0x28, 0x4b, 0x6b, 0x06, 0xc6, 0x6b, 0xf5, 0x7e, 0x5e, 0x55, 0x9d, 0x50, 0x54, 0xf8,
+        0x4f, 0x95, 0x9c, 0x55, 0x15, 0x90, 0x63, 0x26, 0x10, 0x60, 0x87, 0x56, 0x76, 0xd7, 0x2f, 0x83,
+        0xc8, 0x1f, 0x82, 0x59, 0x55, 0x90, 0x29, 0x4a, 0x93, 0x09, 0x47, 0x93, 0xf8, 0x95, 0x8d, 0xb8,
+        0x9f, 0x77, 0x37, 0xa0, 0x7a, 0xa6, 0x66, 0x63, 0xd6, 0x7a, 0x52, 0xe5, 0x5e, 0x55, 0xb4, 0x44,
+        0x48, 0x34, 0x3b, 0x46, 0x84, 0x62, 0x46, 0xb5, 0x1f, 0x4b, 0xc4, 0xf6, 0x65, 0xe6, 0x47, 0x63,
+        0xe7, 0x40, 0x76, 0x07, 0x1f, 0x8b, 0x08, 0x85, 0x88, 0xd9, 0x3d, 0x90, 0x09, 0x3c, 0x95, 0xb9,
+        0x5c, 0x95, 0xf8, 0x4d, 0x8b, 0xb8, 0x83, 0x77, 0x27, 0x82, 0x78, 0x36, 0x71, 0x66, 0x66, 0x9f,
+        0x7d, 0x97, 0xc6, 0x7c, 0x38, 0xe6, 0x8f, 0xc8, 0xb7, 0x96, 0xa9, 0x76, 0x97, 0x09, 0x96, 0x95,
+        0x39, 0x92, 0x8d, 0xd9, 0x03, 0x90, 0x77, 0x81, 0x7d, 0xc7, 0x97, 0x68, 0xf6, 0xba, 0x6b, 0xa5,
+        0xd2, 0x5a, 0x05, 0xe0, 0x5c, 0x45, 0xcb, 0x5c, 0x75, 0xd4, 0x60, 0x25, 0xc1, 0x72, 0xc7, 0x03,
+        0x70, 0x38, 0x83, 0x82, 0xd8, 0x6d, 0xa0, 0x09, 0xd4, 0x9c, 0xaa, 0x96, 0xac, 0xfa, 0x93, 0xb0,
+        0x8a, 0xf9, 0xb0, 0x0a, 0xd2, 0xab, 0xaa, 0xfc, 0x9d, 0x99, 0xee, 0x9f, 0x18, 0x8e, 0x90, 0x38,
+        0xbc, 0x76, 0x87, 0x7b, 0x78, 0x47, 0x2b, 0x6f, 0xa7, 0x3a, 0x6e, 0x76, 0xe4, 0x6e, 0x27, 0x95,
+        0x7b, 0x67, 0x74, 0x88, 0x88, 0x68, 0x86, 0x7a, 0x38, 0x9d, 0x1a, 0x09, 0xb0, 0xca, 0xfe, 0xaf,
+        0xcb, 0x92, 0xbb, 0xcb, 0x76, 0xb6, 0x2b, 0x7e, 0xb7, 0x7a, 0xdd, 0xaa, 0x9a, 0xea, 0x99, 0x89,
+        0xd0, 0x9c, 0x98, 0x02, 0x85, 0x88, 0x12, 0x71, 0xa7, 0x37, 0x73, 0xc6, 0x9a, 0x65, 0x96, 0x98,
+        0x6d, 0xd6, 0xcd, 0x6d, 0x47, 0x29, 0x75, 0x37, 0x13, 0x88, 0xa8, 0x5f, 0x85, 0xf9, 0xa4, 0x94,
+        0xa9, 0x85, 0xa8, 0x8a, 0x67, 0xa6, 0xba, 0x54, 0xaa, 0xba, 0x68, 0xa0, 0x79, 0xff, 0xa0, 0x09,
+        0x17, 0x8f, 0xe9, 0x43, 0x7a, 0x47, 0xbf, 0x7b, 0x86, 0x2f, 0x69, 0x56, 0x59, 0x53, 0x75, 0x3c,
+        0x53, 0xe5, 0x41, 0x50, 0x55, 0x46, 0x56, 0x35, 0x51, 0x54, 0xc6, 0x57, 0x66, 0xc6, 0x2f, 0x75,
+        0x47, 0x30, 0x72, 0xe8, 0xc9, 0x85, 0xe8, 0xa5, 0x91, 0xb9, 0x1f, 0x91, 0x69, 0x08, 0x94, 0x69,
+        0x08, 0x84, 0xa8, 0x76, 0x87, 0x27, 0x6a, 0x74, 0x37, 0x74, 0x60, 0xc6, 0x46, 0x64, 0x44, 0xbd,
+        0x50, 0x74, 0xcb, 0x45, 0xc4, 0x6b, 0x46, 0xe4, 0x86, 0x43, 0x84, 0x74, 0x56, 0xf5, 0x5d, 0x55,
+        0x96, 0x44, 0x65, 0xb6, 0x1a, 0x7d, 0xf7, 0xaa, 0x7b, 0x28, 0xde, 0x89, 0x18, 0xd1, 0x98, 0x59,
+        0x76, 0x97, 0x38, 0xfc, 0x95, 0x99, 0x1d, 0x86, 0x98, 0x70, 0x87, 0x77, 0x6f, 0x76, 0x27, 0xa2
+    },
+    {
+        0x99, 0xe9, 0xb1, 0x9a, 0xf9, 0x30, 0x98, 0x09, 0x3c, 0x83, 0xb8, 0x6f, 0x87, 0x17, 0x42, 0x71,
+        0x77, 0x57, 0x60, 0xb6, 0x43, 0x63, 0xf4, 0xfd, 0x54, 0x45, 0x05, 0x50, 0xa5, 0x0b, 0x51, 0x25,
+        0x9e, 0x53, 0xf5, 0x7f, 0x6e, 0x16, 0xc1, 0x6b, 0xf7, 0xf3, 0x80, 0x77, 0xcb, 0x9a, 0x99, 0x7d,
+        0x97, 0xaa, 0xb3, 0xa7, 0x0a, 0xa5, 0xb4, 0xeb, 0x4c, 0xb4, 0x7a, 0xb8, 0xb1, 0x8a, 0xe2, 0xa0,
+        0x8a, 0x1a, 0xa1, 0xb8, 0xfe, 0x8f, 0xa9, 0x37, 0x7b, 0x77, 0xd6, 0x7c, 0x96, 0xb0, 0x71, 0x36,
+        0xd4, 0x65, 0x16, 0x49, 0x64, 0xa7, 0x12, 0x6c, 0x37, 0x00, 0x7c, 0xa7, 0xa5, 0x7a, 0x49, 0x26,
+        0x93, 0x38, 0xf3, 0xa5, 0x0a, 0x2e, 0xa3, 0x1b, 0xc4, 0xb6, 0x5b, 0xa0, 0xbf, 0x3c, 0x02, 0xbf,
+        0xbb, 0xa1, 0xbe, 0x5b, 0xa7, 0xaa, 0xca, 0xdb, 0xae, 0x19, 0x9d, 0x97, 0x89, 0xb5, 0x82, 0x68,
+        0x60, 0x86, 0x16, 0xc7, 0x71, 0x36, 0xd3, 0x66, 0x36, 0x68, 0x66, 0xb6, 0x89, 0x62, 0xd6, 0x6c,
+        0x76, 0x57, 0x43, 0x74, 0x48, 0x18, 0x83, 0x57, 0xf9, 0x9a, 0x29, 0x6b, 0x97, 0x4a, 0x8f, 0xa3,
+        0xda, 0x80, 0xb2, 0x2b, 0x0c, 0xb0, 0xba, 0x7c, 0xad, 0x4a, 0x93, 0x9b, 0x89, 0xc0, 0x9c, 0x68,
+        0x79, 0x86, 0xd8, 0xb3, 0x6e, 0xa7, 0x09, 0x70, 0xb5, 0x86, 0x5f, 0x25, 0xb3, 0x4c, 0x14, 0xbc,
+        0x4c, 0x15, 0x11, 0x4c, 0x95, 0x0f, 0x57, 0x95, 0x55, 0x55, 0x46, 0x99, 0x6a, 0x86, 0x71, 0x7b,
+        0x27, 0x82, 0x78, 0xa9, 0x27, 0x8c, 0x38, 0xfe, 0x97, 0x19, 0x7a, 0x97, 0x99, 0x50, 0x98, 0xc9,
+        0x4e, 0x87, 0xb8, 0xa8, 0x8a, 0xc7, 0x89, 0x76, 0x07, 0xa0, 0x61, 0x46, 0x52, 0x64, 0x74, 0xa5,
+        0x4f, 0x24, 0xb1, 0x41, 0xd4, 0x2f, 0x43, 0x94, 0x25, 0x3e, 0x04, 0x1a, 0x4f, 0xc4, 0xe9, 0x4e,
+        0x35, 0xc9, 0x5d, 0xe5, 0xa5, 0x77, 0xe7, 0x49, 0x75, 0x08, 0xba, 0x86, 0x68, 0xac, 0x9b, 0x39,
+        0x99, 0x99, 0x89, 0x83, 0x9d, 0x69, 0x91, 0x92, 0x59, 0x33, 0x93, 0x58, 0x44, 0x83, 0xa8, 0x7e,
+        0x99, 0x79, 0xa3, 0x99, 0xb9, 0x8f, 0x9c, 0x89, 0x8d, 0x8d, 0xe9, 0x06, 0x90, 0xb8, 0x00, 0x7d,
+        0x48, 0x0f, 0x6a, 0xe6, 0xeb, 0x6e, 0xe5, 0x69, 0x5b, 0x55, 0x74, 0x51, 0x45, 0x26, 0x52, 0xa5,
+        0x4a, 0x4f, 0xd5, 0x3b, 0x64, 0x56, 0x29, 0x63, 0x17, 0x31, 0x74, 0xa7, 0x0b, 0x8f, 0x88, 0xc6,
+        0x8c, 0xaa, 0x47, 0x9e, 0xca, 0x34, 0xb3, 0x6b, 0x22, 0xb1, 0xdb, 0x05, 0xb5, 0xcb, 0x1f, 0xaa,
+        0x2a, 0xa8, 0xaa, 0xd9, 0xb6, 0x9a, 0xd9, 0xf0, 0x86, 0xa8, 0x87, 0x88, 0x87, 0x25, 0x78, 0xf7,
+        0x54, 0x67, 0x36, 0x76, 0x67, 0x36, 0xcd, 0x68, 0xb6, 0xc8, 0x73, 0x37, 0x1a, 0x71, 0x98, 0x6a,
+        0x87, 0xb8, 0x3c, 0x99, 0x39, 0x71, 0x97, 0x6b, 0x48, 0xad, 0xbb, 0x19, 0xbc, 0xdb, 0xcf, 0xbc,
+        0xdb, 0xda, 0xc1, 0x4b, 0xd7, 0xb4, 0x0b, 0x5c, 0xb6, 0x2a, 0x52, 0xa2, 0xba, 0x71, 0x8d, 0xd9,
+        0x18, 0x91, 0x77, 0x4c, 0x7a, 0x57, 0x5f, 0x68, 0xc6, 0xa5, 0x6a, 0x66, 0x4c, 0x5f, 0xe6, 0x41,
+        0x6d, 0x96, 0xc1, 0x6b, 0xc7, 0x63, 0x77, 0xb7, 0x3b, 0x8e, 0x98, 0xaf, 0x8b, 0x4a, 0x03, 0x9a,
+        0xa9, 0xed, 0xae, 0x3a, 0xc7, 0xac, 0x4a, 0xa6, 0xaf, 0x4a, 0xb5, 0xa3, 0xca, 0x40, 0xa4, 0x09,
+        0x35, 0x92, 0x29, 0x68, 0x7a, 0xb7, 0xc9, 0x7c, 0x56, 0x17, 0x68, 0x86, 0x4a, 0x50, 0x05, 0x06,
+        0x50, 0x64, 0xf0, 0x4b, 0x84, 0xf5, 0x4f, 0x24, 0xe0, 0x4d, 0xd5, 0xdb, 0x5f, 0x15, 0xb7, 0x6e,
+        0x76, 0xbb, 0x6c, 0x98, 0x8f, 0x81, 0xb8, 0x5e, 0x92, 0xf9, 0x23, 0x92, 0x39, 0x70, 0x99, 0x49,
+        0x5c, 0x8f, 0xd9, 0x16, 0x91, 0xc8, 0x40, 0x81, 0x18, 0x58, 0x6d, 0x77, 0x14, 0x71, 0x65, 0x42,
+        0x59, 0x65, 0x5b, 0x46, 0xe4, 0x92, 0x49, 0x44, 0x17, 0x3c, 0xe4, 0x0b, 0x48, 0xb4, 0x7d, 0x47,
+        0x65, 0x13, 0x53, 0x04, 0xf1, 0x6b, 0x66, 0x7b, 0x68, 0x18, 0x1b, 0x7b, 0x57, 0xfc, 0x95, 0xc9,
+        0x3e, 0x93, 0x19, 0x8c, 0x9d, 0x29, 0x91, 0x99, 0x39, 0x93, 0x99, 0x68, 0xf9, 0x8f, 0x09, 0x2c,
+        0x95, 0xf9, 0x58, 0x95, 0x99, 0xaf, 0x9e, 0x09, 0xa0, 0x95, 0x29, 0x79, 0x97, 0x98, 0xae, 0x88,
+        0x78, 0xc4, 0x77, 0x07, 0xa4, 0x7a, 0x55, 0xfc, 0x65, 0x26, 0x15, 0x55, 0x45, 0x7b, 0x57, 0x55,
+        0x30, 0x4e, 0x85, 0x2b, 0x5d, 0x55, 0xc0, 0x5b, 0xf6, 0x83, 0x69, 0xf6, 0x63, 0x83, 0xd8, 0x06,
+        0x80, 0xb9, 0xa8, 0x94, 0xd9, 0x8d, 0xae, 0xfa, 0xcd, 0xac, 0x8b, 0x1a, 0xb6, 0x7b, 0x23, 0xb0,
+        0xdb, 0x0e, 0xb1, 0x1a, 0x6a, 0xa5, 0x9a, 0x97, 0x92, 0x59, 0x41, 0x94, 0x17, 0xc8, 0x83, 0x67,
+        0xf4, 0x6c, 0x26, 0xcf, 0x6c, 0xf6, 0xc1, 0x68, 0x96, 0xca, 0x6c, 0x76, 0xb8, 0x6b, 0xa7, 0xc0,
+        0x7d, 0x37, 0x97, 0x8d, 0xc8, 0xba, 0x8b, 0x7a, 0xa3, 0xa3, 0x1a, 0x6e, 0xb7, 0x5b, 0x65, 0xb6,
+        0x8b, 0xe4, 0xc0, 0xfb, 0xcb, 0xb9, 0xdb, 0xbb, 0xbb, 0x9a, 0xfa, 0xad, 0x2b, 0x10, 0x9a, 0x89,
+        0xd9, 0x9d, 0x77, 0xf7, 0x84, 0xd8, 0x0c, 0x6f, 0x27, 0x11, 0x71, 0x96, 0x50, 0x61, 0x56, 0x4f,
+        0x67, 0xa6, 0x74, 0x66, 0xd6, 0xbe, 0x6d, 0xe6, 0x9e, 0x81, 0xd7, 0xee, 0x7f, 0x19, 0x5a, 0x8f,
+        0xc9, 0x34, 0xa7, 0xba, 0x56, 0xa4, 0xfa, 0x9a, 0xad, 0xea, 0x9a, 0xa8, 0xba, 0x84, 0xa8, 0xb9,
+        0xd1, 0x9c, 0x2a, 0x00, 0x86, 0xe8, 0x84, 0x88, 0xb6, 0xc9, 0x73, 0xd6, 0xff, 0x56, 0x95, 0x7f,
+        0x58, 0x65, 0x07, 0x4d, 0x45, 0x1a, 0x4a, 0xa4, 0x9d, 0x49, 0xc5, 0x3c, 0x55, 0xb5, 0x21, 0x62,
+        0x86, 0x02, 0x5f, 0xe7, 0xdb, 0x76, 0x67, 0xa1, 0x8b, 0x78, 0xa4, 0x89, 0xd9, 0x55, 0x97, 0x29,
+        0x31, 0x93, 0xe9, 0x51, 0x95, 0x48, 0xd5, 0x8a, 0x28, 0xdc, 0x79, 0xd7, 0xd9, 0x7d, 0x45, 0xfa,
+        0x65, 0x66, 0x1b, 0x4e, 0xf5, 0x14, 0x51, 0xb4, 0x37, 0x40, 0x54, 0x46, 0x44, 0xb4, 0x46, 0x44,
+        0x14, 0x7f, 0x4a, 0x24, 0x61, 0x5f, 0x35, 0xc5, 0x5c, 0x57, 0x58, 0x6f, 0x47, 0x36, 0x8d, 0x18,
+        0xa8, 0x89, 0xf9, 0x58, 0x99, 0x89, 0x5b, 0x9c, 0xd9, 0xc3, 0x9c, 0x19, 0x85, 0x96, 0xe9, 0xaf,
+        0x8f, 0x88, 0xe8, 0x8e, 0x99, 0x9e, 0x9c, 0x69, 0x88, 0x99, 0xf9, 0xb7, 0x9c, 0x09, 0x43, 0x91,
+        0x59, 0x54, 0x82, 0x98, 0x62, 0x86, 0x26, 0xa3, 0x70, 0x06, 0xc2, 0x5c, 0x75, 0xf1, 0x5e, 0xc5,
+        0x46, 0x50, 0xb5, 0x4a, 0x58, 0xe5, 0x89, 0x58, 0x45, 0xf0, 0x61, 0x55, 0xd0, 0x77, 0xf7, 0x55,
+        0x74, 0xf8, 0xf9, 0x89, 0xa8, 0xe0, 0xa7, 0x8a, 0x53, 0xa5, 0x0a, 0xf6, 0xb3, 0xca, 0xf7, 0xb5,
+        0x3b, 0x48, 0xb4, 0x8a, 0xf8, 0xae, 0x0b, 0x23, 0x9d, 0xe9, 0xf6, 0x9f, 0xb8, 0x7b, 0x8f, 0x18,
+        0xac, 0x74, 0x17, 0x52, 0x75, 0x16, 0xe4, 0x6b, 0xc6, 0xfb, 0x68, 0xf6, 0x87, 0x68, 0x97, 0x2f,
+        0x75, 0x27, 0x14, 0x82, 0x18, 0x02, 0x80, 0x79, 0xee, 0x97, 0x59, 0xb6, 0xae, 0xda, 0xdb, 0xad,
+        0x9b, 0xb3, 0xbd, 0x0b, 0x94, 0xbd, 0x1b, 0xe2, 0xbe, 0x1b, 0x84, 0xb4, 0xab, 0x8d, 0xa5, 0x6a,
+        0x92, 0xa9, 0x58, 0xa6, 0x90, 0x88, 0xc5, 0x77, 0x97, 0xaa, 0x7a, 0x16, 0x85, 0x65, 0x56, 0x97,
+        0x65, 0x36, 0x55, 0x65, 0x06, 0x3e, 0x66, 0x56, 0x21, 0x76, 0xa7, 0x3d, 0x73, 0xc8, 0x9f, 0x83,
+        0xa8, 0x7b, 0x9e, 0x89, 0xbc, 0x9b, 0x7a, 0x58, 0xa9, 0x1a, 0x50, 0xab, 0x0a, 0x9f, 0xa9, 0xfa,
+        0x50, 0xa3, 0x6a, 0x72, 0x92, 0x29, 0x43, 0x93, 0xc7, 0x89, 0x80, 0x57, 0xc4, 0x60, 0x96, 0x20,
+        0x62, 0x35, 0x4e, 0x52, 0x55, 0x6a, 0x48, 0xc4, 0x94, 0x49, 0x34, 0xce, 0x4f, 0x24, 0xb0, 0x57,
+        0x25, 0x53, 0x55, 0x37, 0x13, 0x6a, 0x16, 0xe5, 0x80, 0xf8, 0x04, 0x7f, 0x79, 0x00, 0x91, 0x68,
+        0xd2, 0x94, 0xd9, 0x59, 0x95, 0xb9, 0x45, 0x90, 0x69, 0x44, 0x84, 0xd8, 0x7d, 0x87, 0xe6, 0xbb,
+        0x71, 0xa6, 0xd9, 0x59, 0x35, 0xbf, 0x5c, 0x54, 0x97, 0x46, 0xa4, 0xac, 0x44, 0x54, 0x4e, 0x44,
+        0xb4, 0x13, 0x44, 0x44, 0x07, 0x54, 0x65, 0x19, 0x51, 0xe6, 0x95, 0x63, 0x26, 0x74, 0x82, 0xa7,
+        0xf7, 0x7f, 0x58, 0xf9, 0x92, 0xa8, 0xeb, 0x9c, 0xf9, 0xb5, 0x9b, 0xa9, 0xed, 0x9c, 0x6a, 0x01,
+        0x86, 0xf8, 0x52, 0x85, 0x39, 0x60, 0x97, 0x79, 0x40, 0x9b, 0xa9, 0xd4, 0x9c, 0xa9, 0xb5, 0x98,
+        0x39, 0xc1, 0x8d, 0x99, 0x08, 0x90, 0x17, 0x5e, 0x7b, 0xf7, 0x7d, 0x66, 0x06, 0x8a, 0x68, 0x85,
+        0x8c, 0x56, 0x25, 0xa0, 0x57, 0x75, 0x81, 0x57, 0x95, 0x7a, 0x5a, 0xd5, 0x6e, 0x6d, 0x76, 0xae,
+        0x6a, 0xb8, 0x45, 0x7e, 0x48, 0x24, 0x9d, 0xf9, 0xa9, 0x9a, 0xba, 0xaf, 0xad, 0xea, 0xa4, 0xb5,
+        0xcb, 0x45, 0xb4, 0xab, 0x5a, 0xb3, 0xeb, 0x83, 0xa8, 0x5a, 0x9e, 0xa9, 0xf9, 0x31, 0x9a, 0x89,
+        0x6a, 0x7d, 0xe7, 0xfb, 0x7f, 0xb7, 0x3e, 0x72, 0x27, 0x62, 0x68, 0x96, 0x94, 0x69, 0x36, 0xd0,
+        0x6f, 0xd6, 0xc0, 0x77, 0xd7, 0x60, 0x75, 0xf9, 0x2d, 0x8b, 0x58, 0xf9, 0xa4, 0xca, 0x32, 0xa3,
+        0x2b, 0x54, 0xb6, 0x8b, 0x23, 0xbc, 0x9b, 0xd1, 0xbd, 0x7b, 0xe4, 0xba, 0x4b, 0xe1, 0xaf, 0xbb,
+        0x2a, 0xb2, 0x89, 0x69, 0x9c, 0x69, 0x86, 0x82, 0x48, 0x57, 0x85, 0x46, 0xef, 0x6c, 0xb7, 0x09,
+        0x65, 0xc6, 0x70, 0x66, 0xd5, 0xe8, 0x61, 0xd5, 0xdf, 0x6c, 0xe6, 0xa7, 0x6a, 0x67, 0xdc, 0x77,
+        0xc7, 0xb9, 0x93, 0xc9, 0x09, 0x90, 0x39, 0xe9, 0xa1, 0x49, 0xd7, 0xa9, 0xea, 0x7e, 0xa7, 0x9a,
+        0x9b, 0xa7, 0x3a, 0xb8, 0x9c, 0x19, 0xcf, 0x9c, 0xb8, 0x47, 0x8c, 0x28, 0x82, 0x6b, 0xb6, 0xda,
+        0x6d, 0xc5, 0xcd, 0x5a, 0xd5, 0xf0, 0x4a, 0x84, 0xba, 0x4b, 0x74, 0x88, 0x4b, 0x84, 0x76, 0x4d,
+        0xe4, 0xc4, 0x4c, 0xc6, 0x57, 0x5e, 0x36, 0x22, 0x75, 0xb7, 0x44, 0x73, 0xa8, 0x84, 0x88, 0xd8,
+        0x49, 0x92, 0x39, 0x24, 0x92, 0x89, 0x80, 0x93, 0x99, 0x79, 0x8d, 0x89, 0x09, 0x90, 0x07, 0x7c,
+        0x7d, 0xb7, 0x96, 0x64, 0x96, 0x7e, 0x68, 0x25, 0x1c, 0x4f, 0xd5, 0x37, 0x47, 0x04, 0x87, 0x48,
+        0x93, 0xe2, 0x41, 0xf3, 0xd9, 0x4b, 0x84, 0x9b, 0x49, 0xd5, 0xda, 0x57, 0x65, 0xbb, 0x76, 0x77,
+        0x33, 0x73, 0x18, 0x68, 0x89, 0x58, 0x5b, 0x99, 0x79, 0x6c, 0x97, 0x6a, 0x16, 0x9e, 0x8a, 0x29,
+        0x7c, 0x67, 0xa8, 0x7a, 0x48, 0xf1, 0x90, 0x98, 0xcb, 0x9a, 0xc9, 0xac, 0x9b, 0x0a, 0x01, 0x9b,
+        0xa9, 0xfe, 0x96, 0xd9, 0x99, 0x99, 0x18, 0x17, 0x86, 0xe8, 0x31, 0x70, 0x27, 0x36, 0x73, 0x95,
+        0xfb, 0x5d, 0xa6, 0x1b, 0x59, 0x15, 0x9b, 0x59, 0xd5, 0x3a, 0x57, 0xc5, 0x38, 0x64, 0xb6, 0x22,
+        0x62, 0x37, 0x8f, 0x72, 0xb7, 0x6d, 0x93, 0x18, 0xfe, 0x8f, 0xfa, 0x2c, 0xa5, 0xca, 0x19, 0xb3,
+        0x9b, 0x12, 0xb1, 0xab, 0x97, 0xb6, 0xfb, 0xb6, 0xb1, 0x6b, 0x27, 0xb1, 0xc9, 0xea, 0xa5, 0xba,
+        0x1c, 0x89, 0x68, 0xb1, 0x8b, 0x47, 0xbf, 0x7a, 0x77, 0xea, 0x6b, 0xc6, 0xca, 0x6c, 0xa6, 0xa2,
+        0x6d, 0x36, 0x94, 0x6f, 0x66, 0xe3, 0x6e, 0x58, 0x7c, 0x80, 0x88, 0x48, 0x99, 0x19, 0x79, 0x97,
+        0x4a, 0xcc, 0xad, 0x5a, 0x9a, 0xb9, 0x6b, 0x92, 0xb9, 0x4c, 0x08, 0xbb, 0xdb, 0xfb, 0xb7, 0x6b,
+        0xa4, 0xb9, 0xea, 0x1c, 0xa7, 0x9a, 0x3c, 0x8d, 0xf9, 0x0d, 0x90, 0xf7, 0x80, 0x76, 0x57, 0x9e,
+        0x6a, 0x56, 0xb8, 0x6b, 0x65, 0xc5, 0x60, 0x95, 0xc6, 0x65, 0x46, 0x36, 0x63, 0xa7, 0x2b, 0x6c,
+        0xf7, 0x10, 0x88, 0x08, 0x49, 0x84, 0x29, 0x4e, 0x97, 0xf9, 0x37, 0xa5, 0x0a, 0x28, 0xa2, 0xaa,
+        0xb5, 0xa8, 0x0a, 0xc6, 0xa2, 0x8a, 0x35, 0xa3, 0x68, 0xfa, 0x96, 0x89, 0x2c, 0x77, 0x87, 0x99,
+        0x79, 0xc6, 0x5d, 0x64, 0xf6, 0x8d, 0x50, 0x05, 0x16, 0x51, 0x24, 0x78, 0x4b, 0xa4, 0x7b, 0x46,
+        0xf4, 0x5e, 0x46, 0x85, 0xaa, 0x53, 0xf5, 0x85, 0x69, 0x86, 0x7f, 0x67, 0xf7, 0xd8, 0x7e, 0x47,
+        0xa5, 0x8c, 0xf8, 0xc3, 0x8c, 0x39, 0x8a, 0x92, 0xb9, 0x75, 0x94, 0x09, 0x64, 0x95, 0xf8, 0x26,
+        0x87, 0xb8, 0x3b, 0x70, 0xe7, 0x3e, 0x74, 0x95, 0xc3, 0x5a, 0x75, 0xe9, 0x4d, 0x64, 0xf9, 0x4f,
+        0x33, 0xe9, 0x43, 0x13, 0xed, 0x45, 0xf4, 0x47, 0x44, 0xa5, 0x31, 0x4d, 0x85, 0x1c, 0x6a, 0x46,
+        0x71, 0x67, 0x07, 0xba, 0x7e, 0x17, 0xa2, 0x92, 0xa8, 0xfa, 0x8f, 0xba, 0x09, 0x9d, 0x3a, 0x12,
+        0x71, 0x26, 0xf5, 0x6f, 0x08, 0x6a, 0x87, 0x68, 0x32, 0x96, 0x69, 0x62, 0x95, 0xfa, 0x1c, 0x9c,
+        0xda, 0x0d, 0x9d, 0xa9, 0xfa, 0x9f, 0xe8, 0xbc, 0x91, 0x58, 0xdb, 0x7b, 0xe7, 0xf1, 0x7e, 0xf6,
+        0x92, 0x67, 0x36, 0xb5, 0x5e, 0x25, 0xf6, 0x5f, 0xb5, 0x29, 0x57, 0x15, 0x32, 0x5d, 0xe5, 0xc2,
+        0x5c, 0x56, 0xe8, 0x68, 0x96, 0xcc, 0x87, 0x78, 0x42, 0x83, 0xd9, 0x95, 0x9c, 0x09, 0x7d, 0xae,
+        0x1a, 0xbe, 0xab, 0xab, 0xa3, 0xb7, 0x0b, 0xad, 0xb6, 0xfb, 0x7b, 0xb7, 0x4a, 0x91, 0xaf, 0x9a,
+        0xc1, 0x94, 0x69, 0x6c, 0x96, 0xf8, 0x61, 0x84, 0xe8, 0x8c, 0x71, 0x37, 0x2f, 0x73, 0x46, 0xa0,
+        0x6e, 0x86, 0xa2, 0x69, 0x96, 0x92, 0x69, 0x67, 0xd8, 0x76, 0xc7, 0xb3, 0x8d, 0x38, 0xb9, 0x8b,
+        0x6a, 0x25, 0xa2, 0x79, 0xec, 0xb2, 0xbb, 0x21, 0xb2, 0x2b, 0xfe, 0xba, 0x4b, 0xe8, 0xbc, 0xab,
+        0xe7, 0xbe, 0xda, 0xbd, 0xb1, 0x3a, 0xc7, 0x99, 0xb9, 0xc9, 0x9c, 0xe8, 0x2d, 0x81, 0x28, 0x54,
+        0x71, 0x17, 0x32, 0x72, 0xe5, 0xda, 0x62, 0xc5, 0xeb, 0x60, 0x75, 0xf8, 0x5f, 0x96, 0x90, 0x63,
+        0xb6, 0x7c, 0x7c, 0x37, 0x8d, 0x78, 0xa8, 0xa3, 0x8c, 0x48, 0x86, 0x9e, 0x19, 0xae, 0x9a, 0xda,
+        0x97, 0xa5, 0xca, 0x97, 0xa7, 0x4a, 0x71, 0xa6, 0x79, 0x8c, 0x9f, 0x49, 0xb1, 0x83, 0x78, 0x55,
+        0x85, 0x77, 0x0d, 0x70, 0x47, 0x43, 0x57, 0xa5, 0xa1, 0x59, 0xe4, 0x9f, 0x4e, 0x84, 0xad, 0x43,
+        0x44, 0x37, 0x43, 0xb5, 0x20, 0x4b, 0x34, 0xfb, 0x5d, 0xd5, 0xc8, 0x5c, 0x07, 0x25, 0x72, 0x76,
+        0xe0, 0x84, 0xf8, 0x30, 0x83, 0x29, 0x58, 0x8f, 0x49, 0x34, 0x96, 0xc9, 0x88, 0x98, 0x08, 0xaf,
+        0x8f, 0x88, 0xba, 0x7c, 0xa7, 0xf7, 0x7f, 0x96, 0x7f, 0x65, 0xf6, 0xaa, 0x56, 0x55, 0x89, 0x58,
+        0xb4, 0x21, 0x47, 0x94, 0x34, 0x43, 0x34, 0x2a, 0x42, 0xd4, 0xb6, 0x46, 0x94, 0xab, 0x5f, 0x15,
+        0xbf, 0x5b, 0xf6, 0xfb, 0x72, 0x46, 0xe1, 0x89, 0x98, 0x5e, 0x85, 0xc9, 0xc0, 0x98, 0x19, 0xc1,
+        0x65, 0xd6, 0x41, 0x63, 0xe7, 0xc5, 0x7c, 0x87, 0x8c, 0x8f, 0xa8, 0xec, 0x8e, 0xea, 0x08, 0x9a,
+        0x79, 0xe9, 0xa1, 0xba, 0x38, 0xa3, 0x59, 0x4d, 0x9a, 0x09, 0x5c, 0x87, 0x58, 0xa2, 0x8a, 0x67,
+        0x3d, 0x72, 0x37, 0x62, 0x64, 0xe6, 0x70, 0x66, 0xf5, 0x4d, 0x59, 0xf5, 0x5b, 0x59, 0xf5, 0x94,
+        0x59, 0x46, 0x5f, 0x60, 0x96, 0x47, 0x7c, 0x87, 0x8f, 0x78, 0x88, 0xe8, 0x90, 0x58, 0xca, 0xa6,
+        0x9a, 0x37, 0xa3, 0x9b, 0x7a, 0xb3, 0xab, 0x79, 0xba, 0x6b, 0xa0, 0xba, 0x4b, 0x12, 0xb7, 0xbb,
+        0x37, 0x9f, 0xca, 0x19, 0xa1, 0xb9, 0x10, 0x90, 0x49, 0x45, 0x79, 0xa7, 0xc2, 0x7c, 0x56, 0xd1,
+        0x71, 0xd6, 0xe3, 0x67, 0x26, 0x77, 0x67, 0x47, 0x5d, 0x6f, 0x97, 0x3a, 0x82, 0x88, 0x0d, 0x80,
+        0x79, 0x72, 0x97, 0x49, 0x39, 0xa9, 0xfa, 0x8a, 0xa9, 0x0b, 0xc5, 0xb6, 0x2b, 0x96, 0xbf, 0x1b,
+        0xfe, 0xc0, 0x1b, 0x30, 0xb7, 0x6b, 0x3b, 0xa4, 0xda, 0x7b, 0xa7, 0x78, 0xe5, 0x8c, 0xd9, 0x08,
+        0x7a, 0x37, 0xcd, 0x7c, 0x96, 0x21, 0x67, 0xb6, 0x39, 0x5f, 0x25, 0xe7, 0x5e, 0x96, 0x1a, 0x5d,
+        0x66, 0x16, 0x71, 0x36, 0xe8, 0x6e, 0x27, 0xe4, 0x80, 0x87, 0xc4, 0x94, 0x49, 0x0a, 0x90, 0xda,
+        0x48, 0x9f, 0xea, 0x39, 0xa8, 0x3a, 0x71, 0xa6, 0xc9, 0xfa, 0xa5, 0x7a, 0x1a, 0x8d, 0xf8, 0xf7,
+        0x8f, 0xa7, 0xd6, 0x7c, 0x68, 0x01, 0x61, 0xe6, 0x42, 0x64, 0x34, 0xf3, 0x54, 0xc5, 0x08, 0x42,
+        0xd4, 0x3d, 0x44, 0x24, 0xbc, 0x46, 0xa4, 0x9e, 0x53, 0x75, 0x27, 0x52, 0x36, 0x60, 0x66, 0x96,
+        0x2c, 0x7a, 0x47, 0x81, 0x78, 0x98, 0xf2, 0x88, 0x48, 0xcd, 0x96, 0xe9, 0x79, 0x97, 0x59, 0x0e,
+        0x94, 0x99, 0x09, 0x86, 0xb8, 0x96, 0x89, 0x27, 0x42, 0x72, 0x17, 0x64, 0x60, 0xd6, 0x3c, 0x63,
+        0x84, 0x89, 0x4e, 0x84, 0xa9, 0x44, 0x64, 0x42, 0x43, 0xf4, 0x5f, 0x41, 0xe4, 0x59, 0x55, 0x05,
+        0x28, 0x52, 0x66, 0x3d, 0x65, 0xf6, 0x25, 0x7e, 0x57, 0xa4, 0x7a, 0xd9, 0x52, 0x90, 0x09, 0x45,
+        0x5b, 0x55, 0x99, 0x59, 0xc7, 0x12, 0x71, 0x66, 0xd7, 0x86, 0xf8, 0x5b, 0x85, 0x79, 0xc6, 0x95,
+        0xd9, 0x9b, 0xa3, 0x8a, 0x3c, 0xa4, 0x29, 0xb7, 0xa0, 0x29, 0xc2, 0x91, 0x79, 0x44, 0x94, 0x37,
+        0xf0, 0x7d, 0x48, 0x15, 0x6e, 0x57, 0x12, 0x70, 0xc5, 0x9b, 0x5f, 0x35, 0xb4, 0x59, 0x55, 0x8f,
+        0x59, 0x05, 0xfc, 0x5b, 0x35, 0xee, 0x72, 0x36, 0xf3, 0x6e, 0xd8, 0x32, 0x85, 0x58, 0x14, 0x9c,
+        0xb9, 0x98, 0x99, 0x5b, 0x1f, 0xad, 0x6b, 0x15, 0xbb, 0x0b, 0x9b, 0xb9, 0x7b, 0x70, 0xbd, 0x2b,
+        0x8a, 0xa9, 0xba, 0xb4, 0xab, 0x19, 0xc9, 0x9b, 0xc9, 0xff, 0x83, 0xc8, 0x67, 0x86, 0x17, 0x2a,
+        0x78, 0xe7, 0x47, 0x67, 0x76, 0x8a, 0x68, 0xa7, 0x08, 0x6b, 0x06, 0xf4, 0x78, 0xb7, 0x7a, 0x77,
+        0xb8, 0xb9, 0x8b, 0x98, 0x7d, 0x9f, 0xa9, 0xe4, 0x9e, 0x5b, 0x5b, 0xaf, 0x2b, 0x26, 0xbd, 0xdb,
+        0xe8, 0xbe, 0x4b, 0x7e, 0xbb, 0xbb, 0x7b, 0xae, 0x1b, 0x0a, 0xb0, 0x69, 0xa4, 0x98, 0x59, 0xc5,
+        0x84, 0x78, 0x7d, 0x87, 0xa6, 0x93, 0x6f, 0x46, 0xb3, 0x60, 0xb6, 0x10, 0x61, 0x05, 0xdb, 0x59,
+        0xb5, 0xde, 0x68, 0x66, 0x54, 0x65, 0x97, 0x2f, 0x75, 0x37, 0x13, 0x89, 0x88, 0x56, 0x85, 0x69,
+        0xc6, 0x97, 0xe9, 0xb7, 0xa5, 0xaa, 0x43, 0xa4, 0x4a, 0x30, 0xa8, 0x3a, 0x43, 0x97, 0x39, 0x7d,
+        0x97, 0x88, 0x8f, 0x87, 0xd8, 0xbd, 0x6d, 0x26, 0xfe, 0x6f, 0xa5, 0x7b, 0x5d, 0x95, 0x97, 0x46,
+        0x14, 0x73, 0x47, 0x44, 0x8e, 0x43, 0xb4, 0x7a, 0x4b, 0x64, 0xab, 0x4a, 0xb5, 0xaf, 0x5b, 0x95,
+        0x77, 0x6e, 0xc6, 0xcb, 0x6c, 0xc8, 0x6b, 0x7f, 0x48, 0x34, 0x93, 0x49, 0x39, 0x93, 0x39, 0x37,
+        0x96, 0x79, 0x29, 0x8e, 0xc9, 0x05, 0x91, 0x07, 0xfc, 0x7d, 0x88, 0x11, 0x6c, 0x46, 0xfb, 0x6f,
+        0xa5, 0x1b, 0x58, 0x05, 0x43, 0x48, 0x64, 0x92, 0x49, 0x94, 0x42, 0x40, 0xa4, 0x4b, 0x4d, 0x64,
+        0xb9, 0x4b, 0x25, 0x92, 0x5a, 0xe5, 0x74, 0x72, 0x46, 0xe6, 0x6e, 0xa8, 0xba, 0x86, 0x28, 0xa7,
+        0x52, 0x25, 0x13, 0x51, 0x06, 0x5c, 0x66, 0x76, 0x25, 0x7c, 0x87, 0xaf, 0x7a, 0xc9, 0x5d, 0x8e,
+        0xc9, 0x29, 0xa1, 0xca, 0x1f, 0xa1, 0xf9, 0xfc, 0xa3, 0xd9, 0xf9, 0x9a, 0x89, 0xc6, 0x9c, 0x68,
+        0xa4, 0x88, 0x98, 0xc5, 0x78, 0xd7, 0xbb, 0x7b, 0x96, 0x0d, 0x66, 0xf6, 0x34, 0x5c, 0x05, 0xc1,
+        0x5b, 0xe5, 0xbb, 0x57, 0xe5, 0xbe, 0x69, 0xa6, 0x73, 0x67, 0x17, 0x7d, 0x7a, 0x37, 0x65, 0x91,
+        0xf8, 0xe5, 0x8e, 0x4a, 0xa8, 0xa5, 0x2a, 0x93, 0xb7, 0xdb, 0x61, 0xb5, 0xfb, 0xa3, 0xbe, 0xfb,
+        0xb4, 0xb1, 0xfb, 0x2a, 0xb3, 0x6a, 0x7b, 0xa6, 0xda, 0xa9, 0x8e, 0xe9, 0x1d, 0x91, 0x67, 0xb4,
+        0x81, 0xb7, 0xd5, 0x6a, 0xe6, 0xc8, 0x6c, 0xb6, 0xdd, 0x69, 0x66, 0xcd, 0x70, 0xe7, 0x08, 0x70,
+        0x78, 0x07, 0x81, 0x47, 0xd7, 0x94, 0x89, 0x2f, 0x92, 0xda, 0xc8, 0xa5, 0x8a, 0x9a, 0xba, 0x2b,
+        0x9d, 0xb9, 0x9b, 0x9e, 0xbc, 0xcb, 0x91, 0xb5, 0x2b, 0x71, 0xb7, 0x4a, 0x4d, 0xa2, 0xaa, 0x6b,
+        0x90, 0x29, 0x34, 0x92, 0xf7, 0x27, 0x78, 0xa7, 0x51, 0x65, 0x26, 0x65, 0x66, 0x45, 0xc6, 0x59,
+        0x65, 0xd8, 0x61, 0x85, 0xf7, 0x5f, 0xa6, 0x89, 0x6a, 0xe6, 0x72, 0x7d, 0xc7, 0x98, 0x79, 0xc9,
+        0x2a, 0x8d, 0xa9, 0x19, 0xa0, 0xb9, 0xe5, 0x9e, 0x2a, 0x39, 0xa7, 0xfa, 0x3d, 0x9c, 0xe9, 0xd7,
+        0x9d, 0x89, 0x32, 0x91, 0x99, 0x59, 0x78, 0xc7, 0xb8, 0x7b, 0x26, 0x1b, 0x68, 0x46, 0x3e, 0x4b,
+        0xe4, 0xd9, 0x4e, 0x04, 0x88, 0x44, 0x54, 0x88, 0x45, 0x84, 0x5f, 0x45, 0xc5, 0x11, 0x51, 0xd4,
+        0xdd, 0x62, 0xc6, 0x0c, 0x61, 0x37, 0xc2, 0x74, 0xb7, 0x89, 0x8c, 0xf8, 0xc3, 0x8c, 0x49, 0x26,
+        0x94, 0xa9, 0x0d, 0x93, 0xb9, 0x50, 0x95, 0x18, 0x8e, 0x86, 0xc8, 0xaa, 0x78, 0x77, 0xba, 0x7b,
+        0x35, 0xca, 0x63, 0x35, 0xf1, 0x4f, 0x65, 0x0a, 0x50, 0xe4, 0x57, 0x42, 0xc4, 0x62, 0x48, 0xa4,
+        0x7c, 0x47, 0x54, 0xf2, 0x52, 0x14, 0xe2, 0x66, 0xa6, 0x2e, 0x63, 0x08, 0x08, 0x7a, 0x87, 0xea,
+        0x4a, 0xd4, 0xaa, 0x4a, 0x55, 0xbd, 0x5c, 0x45, 0x80, 0x71, 0xc6, 0xf8, 0x6f, 0x98, 0xcc, 0x84,
+        0xf8, 0x8c, 0x9d, 0x69, 0xd2, 0x9d, 0x2a, 0x14, 0xa4, 0x4a, 0x00, 0xa0, 0xda, 0x27, 0xa2, 0xb9,
+        0x43, 0x92, 0x39, 0x62, 0x84, 0x38, 0x79, 0x87, 0x06, 0xa6, 0x70, 0x96, 0xd0, 0x60, 0x86, 0x13,
+        0x61, 0x75, 0xae, 0x57, 0xf5, 0xc0, 0x63, 0xe6, 0x18, 0x61, 0xb6, 0xe4, 0x70, 0xa6, 0xc9, 0x86,
+        0xe8, 0x32, 0x82, 0xfa, 0x08, 0x9a, 0xe9, 0xf1, 0xb2, 0x5a, 0xfd, 0xaf, 0xcb, 0xa3, 0xbe, 0x5b,
+        0xa8, 0xb7, 0xab, 0x7f, 0xb8, 0x1b, 0x19, 0xb0, 0x2b, 0x3b, 0x9a, 0x79, 0xd2, 0x9c, 0xd8, 0x56,
+        0x8b, 0x68, 0x7b, 0x70, 0xc7, 0x2e, 0x73, 0x86, 0xeb, 0x6a, 0x86, 0xe7, 0x6c, 0x26, 0xc2, 0x6b,
+        0xc7, 0x71, 0x78, 0x07, 0x42, 0x88, 0xe8, 0x70, 0x87, 0x7a, 0x25, 0x9a, 0xd9, 0xec, 0xb3, 0x8b,
+        0x25, 0xb2, 0x7b, 0x88, 0xba, 0xfb, 0x71, 0xb9, 0xeb, 0xae, 0xba, 0xfa, 0xdb, 0xab, 0x2a, 0xf6,
+        0x9b, 0xa9, 0xec, 0x9e, 0x17, 0xd1, 0x84, 0x17, 0xff, 0x6c, 0x76, 0xdc, 0x6e, 0x05, 0xe7, 0x5b,
+        0xc5, 0xff, 0x5d, 0x85, 0xc5, 0x5c, 0xb5, 0xf4, 0x62, 0x95, 0xea, 0x72, 0x26, 0xe9, 0x6e, 0xd8,
+        0x7b, 0x82, 0x78, 0x68, 0x98, 0xd9, 0x63, 0x95, 0x8a, 0x14, 0xa4, 0xea, 0x0c, 0xa0, 0x6a, 0x00,
+        0xa0, 0x49, 0xc0, 0x99, 0xe9, 0xd6, 0x83, 0xd8, 0x6d, 0x86, 0x46, 0xce, 0x73, 0x26, 0xf9, 0x54,
+        0x35, 0x64, 0x56, 0xd4, 0xbb, 0x48, 0xc4, 0xc4, 0x42, 0xc4, 0x3a, 0x43, 0x54, 0x8b, 0x4a, 0x84,
+        0x66, 0x57, 0x55, 0x5e, 0x56, 0x37, 0x0f, 0x69, 0x16, 0xcc, 0x84, 0x28, 0x30, 0x82, 0x48, 0xe9,
+        0x90, 0xd8, 0xc2, 0x95, 0xe9, 0x67, 0x96, 0xa9, 0x0b, 0x8d, 0x89, 0x1a, 0x83, 0x48, 0x66, 0x86,
+        0x16, 0x87, 0x6f, 0x16, 0xaf, 0x58, 0xb5, 0xa6, 0x5a, 0xa4, 0x9e, 0x47, 0xb4, 0xba, 0x47, 0x44,
+        0x73, 0x46, 0xb4, 0x86, 0x4c, 0x54, 0x80, 0x5b, 0xc5, 0x85, 0x58, 0x77, 0x48, 0x6e, 0xf7, 0x2f,
+        0x46, 0x74, 0x68, 0x46, 0x75, 0x2a, 0x53, 0xe4, 0xfb, 0x66, 0xa6, 0x55, 0x64, 0x88, 0x24, 0x7b,
+        0x07, 0xed, 0x96, 0x89, 0x58, 0x95, 0xd9, 0xfb, 0xa1, 0xd9, 0xde, 0xa4, 0xba, 0x5d, 0xa6, 0x09,
+        0xd8, 0x9a, 0xb9, 0xe9, 0x8f, 0x89, 0x1f, 0x91, 0xa7, 0x49, 0x7b, 0x17, 0x7a, 0x67, 0xf6, 0x94,
+        0x69, 0xd5, 0xd5, 0x5a, 0xf5, 0xf1, 0x60, 0x15, 0xe9, 0x5e, 0xe6, 0x62, 0x68, 0xc6, 0x4e, 0x7b,
+        0xd7, 0x82, 0x78, 0x19, 0x61, 0x90, 0x69, 0x42, 0xaa, 0x3a, 0x7b, 0xa7, 0x6b, 0x75, 0xba, 0xdb,
+        0x6e, 0xba, 0x7b, 0xa0, 0xba, 0x5b, 0x96, 0xb6, 0xdb, 0xb6, 0xa5, 0x2a, 0x7a, 0xa7, 0x89, 0x03,
+        0x97, 0x39, 0x2a, 0x79, 0x77, 0xb9, 0x7c, 0x27, 0x20, 0x6e, 0xa7, 0x28, 0x69, 0xc6, 0xaa, 0x6a,
+        0x96, 0xf7, 0x71, 0x66, 0xd2, 0x7e, 0xa7, 0xc9, 0x7c, 0xb9, 0x75, 0x8f, 0x69, 0x36, 0xaa, 0x8a,
+        0x8e, 0xa9, 0x0b, 0x43, 0xb6, 0x4b, 0x25, 0xbb, 0x5b, 0xbb, 0xbc, 0x0b, 0x4e, 0xb1, 0x8b, 0x56,
+        0xa6, 0x6a, 0x89, 0xa8, 0x48, 0x89, 0x8f, 0x28, 0xb6, 0x75, 0xc7, 0x78, 0x77, 0x96, 0x36, 0x61,
+        0x66, 0x4c, 0x5c, 0x95, 0xca, 0x5c, 0x25, 0x8f, 0x5c, 0x75, 0x8c, 0x67, 0xd6, 0x48, 0x64, 0xa7,
+        0xc9, 0x76, 0xf7, 0xae, 0x8f, 0x28, 0xc1, 0x8b, 0x79, 0xbd, 0x9e, 0x89, 0xaf, 0xa0, 0xd9, 0xfb,
+        0x9f, 0xaa, 0x15, 0x9f, 0x1a, 0x2f, 0x8e, 0x29, 0x01, 0x8f, 0xf7, 0x86, 0x7e, 0xf7, 0xb3, 0x5e,
+        0x76, 0x11, 0x61, 0x35, 0x1c, 0x4f, 0x15, 0x31, 0x43, 0x24, 0x50, 0x44, 0x74, 0x34, 0x45, 0xb4,
+        0x1c, 0x4d, 0xe4, 0xcc, 0x4c, 0xd6, 0x51, 0x5d, 0x86, 0x16, 0x79, 0x87, 0x7f, 0x77, 0xe8, 0x7c,
+        0x89, 0x58, 0x50, 0x94, 0xf9, 0x49, 0x95, 0x19, 0x59, 0x91, 0x89, 0x5a, 0x8c, 0xf8, 0xf5, 0x8e,
+        0xd7, 0x41, 0x7a, 0xf7, 0x6d, 0x63, 0x66, 0x5a, 0x66, 0x45, 0x0d, 0x4f, 0x45, 0x41, 0x48, 0xe4,
+        0x9a, 0x49, 0x14, 0x3b, 0x48, 0x24, 0x42, 0x52, 0xa4, 0xfb, 0x50, 0x26, 0x8c, 0x63, 0x76, 0x73,
+        0x44, 0xa4, 0x51, 0x45, 0x74, 0xbe, 0x4d, 0x64, 0x96, 0x5c, 0x95, 0xb4, 0x5a, 0xb7, 0x73, 0x6f,
+        0xc7, 0x3b, 0x8d, 0xb8, 0xcb, 0x8c, 0x79, 0xb3, 0x9d, 0x39, 0x8f, 0xa5, 0xfa, 0x64, 0xa6, 0x7a,
+        0x3b, 0xa0, 0xaa, 0x4b, 0x99, 0x79, 0xbc, 0x9b, 0xd8, 0x01, 0x86, 0x98, 0x2f, 0x70, 0xd7, 0x30,
+        0x72, 0xe6, 0x29, 0x60, 0x36, 0x48, 0x5f, 0xc5, 0xf3, 0x5f, 0x15, 0xf9, 0x63, 0xb5, 0xfb, 0x71,
+        0xe6, 0xe7, 0x6e, 0xb8, 0xab, 0x84, 0xf8, 0x90, 0xa1, 0x19, 0xd8, 0x9d, 0x5b, 0x21, 0xb4, 0x9b,
+        0x0b, 0xba, 0x6b, 0x90, 0xb8, 0xfb, 0xf2, 0xbc, 0x1c, 0x02, 0xae, 0xab, 0x0b, 0xb0, 0xe9, 0xbd,
+        0xa2, 0x49, 0xe6, 0x83, 0x58, 0x64, 0x86, 0x47, 0x81, 0x75, 0x57, 0x96, 0x6a, 0x36, 0xc3, 0x6b,
+        0x86, 0xac, 0x6d, 0x46, 0x92, 0x74, 0xd7, 0x3f, 0x74, 0x08, 0xb8, 0x84, 0x88, 0x84, 0xa0, 0x29,
+        0xe2, 0x9e, 0x3a, 0xd7, 0xae, 0xca, 0xa9, 0xb9, 0xeb, 0x9c, 0xb9, 0xfb, 0x8f, 0xb5, 0x7b, 0x94,
+        0xaf, 0x1b, 0x1b, 0xb1, 0x09, 0x38, 0x9a, 0x79, 0x66, 0x80, 0x68, 0x2b, 0x82, 0xc6, 0xa8, 0x69,
+        0x76, 0xd3, 0x5e, 0x45, 0xed, 0x5e, 0xf5, 0x53, 0x59, 0xe5, 0x5a, 0x5e, 0xe5, 0xc7, 0x5c, 0xc7,
+        0x1a, 0x6b, 0xd6, 0xfc, 0x84, 0x68, 0x07, 0x80, 0x89, 0x3b, 0x96, 0x99, 0x26, 0x9d, 0xd9, 0xc0,
+        0x9c, 0x4a, 0x47, 0xa1, 0x2a, 0x56, 0x96, 0x59, 0x7d, 0x97, 0xe8, 0x36, 0x8a, 0x08, 0x5d, 0x69,
+        0x56, 0xc5, 0x6c, 0xc5, 0xa0, 0x57, 0xc5, 0xbd, 0x46, 0xf4, 0x90, 0x48, 0x54, 0x0f, 0x44, 0x24,
+        0x02, 0x45, 0xf4, 0x55, 0x45, 0xe5, 0xa3, 0x53, 0x05, 0x69, 0x6e, 0x06, 0xc9, 0x6c, 0x67, 0xf0,
+        0x7f, 0xc7, 0xb8, 0x90, 0xb8, 0xfc, 0x8f, 0xf9, 0x71, 0x92, 0xa9, 0x66, 0x94, 0x29, 0x5b, 0x95,
+        0x67, 0xec, 0x85, 0x28, 0x13, 0x6e, 0xe7, 0x10, 0x71, 0x55, 0xa0, 0x59, 0x25, 0xdb, 0x4d, 0xb4,
+        0xf2, 0x4e, 0xa4, 0x31, 0x48, 0x04, 0x43, 0x4b, 0xf4, 0x9b, 0x4a, 0x55, 0xe5, 0x59, 0x35, 0xd0,
+        0x45, 0x74, 0x6d, 0x46, 0xa4, 0x6f, 0x49, 0x34, 0x54, 0x53, 0xd5, 0x27, 0x52, 0x46, 0xca, 0x64,
+        0xb6, 0x8a, 0x83, 0xc8, 0x24, 0x82, 0x09, 0x4a, 0x95, 0xe9, 0x1f, 0xa4, 0xaa, 0x47, 0xa4, 0x5a,
+        0x7b, 0xa3, 0xca, 0x82, 0xa1, 0xea, 0x3f, 0xa3, 0x98, 0xa5, 0x91, 0x48, 0xd8, 0x7b, 0x47, 0xda,
+        0x7d, 0xb6, 0x9c, 0x68, 0x46, 0xc6, 0x61, 0x56, 0x1b, 0x61, 0xe5, 0xc4, 0x60, 0xe5, 0xcf, 0x69,
+        0xe6, 0x6e, 0x67, 0x28, 0x00, 0x7a, 0x67, 0xe1, 0x96, 0x69, 0x2d, 0x92, 0xea, 0xa1, 0xac, 0x2a,
+        0x8a, 0xb7, 0xdb, 0x5f, 0xb5, 0x8c, 0x18, 0xbe, 0x0c, 0x20, 0xb6, 0x4b, 0x80, 0xb7, 0xba, 0x6a,
+        0xac, 0xba, 0x87, 0x8e, 0x09, 0x12, 0x91, 0x78, 0x0b, 0x7e, 0x78, 0x23, 0x6e, 0x16, 0xff, 0x70,
+        0x36, 0x86, 0x6b, 0x76, 0x7b, 0x6d, 0xc6, 0xd6, 0x6d, 0xa8, 0x12, 0x7a, 0x07, 0xdd, 0x95, 0x09,
+        0x33, 0x93, 0x5a, 0x48, 0xa5, 0x7a, 0x1a, 0xb5, 0x7b, 0x4b, 0xb4, 0xcb, 0xa8, 0xb6, 0x0b, 0xaa,
+        0xb5, 0xeb, 0x78, 0xb7, 0x39, 0xe2, 0xa4, 0x8a, 0x07, 0x8b, 0xe8, 0xde, 0x8d, 0xe7, 0x3b, 0x72,
+        0xf7, 0x70, 0x63, 0x86, 0x46, 0x64, 0x65, 0x4d, 0x59, 0xf5, 0x5e, 0x59, 0x25, 0x71, 0x56, 0xf6,
+        0x73, 0x61, 0xf6, 0x63, 0x78, 0xa7, 0x55, 0x75, 0x38, 0xa1, 0x8c, 0x68, 0x83, 0x98, 0x19, 0x5c,
+        0x95, 0xfa, 0x48, 0xa0, 0x4a, 0x47, 0x9b, 0xf9, 0xcf, 0x9c, 0xa8, 0xd4, 0x93, 0x78, 0xf5, 0x74,
+        0xd7, 0x80, 0x77, 0xf6, 0x4a, 0x62, 0xb6, 0x67, 0x4c, 0xe4, 0xfe, 0x4f, 0xd4, 0x1b, 0x45, 0x54,
+        0x19, 0x41, 0x24, 0x0d, 0x41, 0x75, 0x0b, 0x49, 0x84, 0xd4, 0x62, 0x96, 0x13, 0x60, 0xf7, 0x4a,
+        0x74, 0x97, 0x08, 0x89, 0xe8, 0x88, 0x88, 0xb9, 0x5c, 0x90, 0x59, 0x49, 0x98, 0x49, 0x9b, 0x99,
+        0x88, 0x7e, 0x8d, 0x88, 0x9b, 0x7a, 0x57, 0xc5, 0x7c, 0xc6, 0x52, 0x64, 0xa6, 0x8f, 0x55, 0x55,
+        0x74, 0x56, 0xc4, 0x4e, 0x4a, 0xd4, 0x6a, 0x48, 0x14, 0x68, 0x46, 0xa5, 0x5b, 0x51, 0x45, 0x52,
+        0x48, 0xd4, 0xab, 0x4b, 0x14, 0x50, 0x48, 0x04, 0x41, 0x4c, 0x44, 0xbc, 0x4c, 0x56, 0x23, 0x5a,
+        0xc5, 0xef, 0x79, 0x27, 0x77, 0x77, 0x68, 0xbc, 0x8c, 0xd8, 0x8c, 0xa0, 0x69, 0xfa, 0x9f, 0x4a,
+        0x89, 0xa4, 0x1a, 0x88, 0xa8, 0x6a, 0x9d, 0xaa, 0x09, 0x4f, 0x9b, 0x09, 0x6d, 0x86, 0x28, 0x85,
+        0x88, 0x47, 0x27, 0x71, 0xd7, 0x59, 0x66, 0xc6, 0x73, 0x67, 0x15, 0xb8, 0x60, 0xe5, 0xd0, 0x63,
+        0xf6, 0x18, 0x61, 0xe7, 0x61, 0x70, 0xf7, 0x4f, 0x8b, 0x78, 0x7a, 0x87, 0x9a, 0x07, 0xa2, 0x29,
+        0xe8, 0xb2, 0x1a, 0xf6, 0xaf, 0xac, 0x1e, 0xbd, 0x3c, 0x12, 0xbb, 0xbb, 0xc9, 0xbc, 0xba, 0xfc,
+        0xb5, 0xbb, 0x19, 0x99, 0x59, 0xbe, 0x9c, 0xf8, 0xa7, 0x88, 0x18, 0xc3, 0x74, 0x37, 0x6c, 0x76,
+        0x96, 0x99, 0x6d, 0x86, 0x94, 0x69, 0x46, 0x8d, 0x69, 0x37, 0x88, 0x71, 0x07, 0x58, 0x8a, 0x08,
+        0x89, 0x88, 0x19, 0xa8, 0x9b, 0x39, 0x76, 0xaf, 0x0a, 0xd2, 0xad, 0x7b, 0x8f, 0xb3, 0xcb, 0x7b,
+        0xba, 0x3b, 0xa6, 0xba, 0x9a, 0x69, 0xac, 0xca, 0x90, 0x96, 0xf9, 0x8e, 0x99, 0x17, 0xe3, 0x7d,
+        0xd8, 0x18, 0x6b, 0x06, 0xc8, 0x6c, 0x55, 0x6f, 0x5c, 0x95, 0x85, 0x55, 0xe5, 0x43, 0x54, 0x25,
+        0xef, 0x5a, 0x45, 0xe3, 0x6d, 0xc6, 0xa8, 0x6a, 0x77, 0xf8, 0x81, 0x67, 0xd3, 0x90, 0x98, 0xd9,
+        0x8d, 0x8a, 0x1d, 0x9d, 0x0a, 0x0e, 0x9e, 0xc9, 0xf5, 0x9e, 0xf9, 0x52, 0x9a, 0x89, 0x67, 0x7f,
+        0xd8, 0x28, 0x82, 0xb6, 0xf8, 0x6d, 0xc7, 0x1c, 0x55, 0x55, 0x89, 0x58, 0xa4, 0x51, 0x49, 0xa4,
+        0x5f, 0x3f, 0x63, 0xf6, 0x3f, 0xf4, 0x97, 0x42, 0xd4, 0x6c, 0x57, 0xa5, 0x69, 0x56, 0xa6, 0x93,
+        0x69, 0x86, 0x5d, 0x81, 0x07, 0xeb, 0x7e, 0xf9, 0x13, 0x8b, 0xd8, 0xf9, 0x9a, 0x29, 0xa3, 0x99,
+        0xd8, 0xed, 0x93, 0xb8, 0xfc, 0x84, 0xa8, 0x6c, 0x86, 0xe7, 0x08, 0x6f, 0xb7, 0x42, 0x5e, 0xe6,
+        0x0d, 0x60, 0x94, 0x9f, 0x50, 0x44, 0xc5, 0x47, 0xc4, 0x69, 0x46, 0xd4, 0xf6, 0x4b, 0x44, 0xf1,
+        0x4e, 0xc5, 0x14, 0x51, 0xb4, 0x57, 0x49, 0x74, 0x5b, 0x48, 0x34, 0x85, 0x48, 0x35, 0x98, 0x52,
+        0xf5, 0x61, 0x6e, 0x26, 0xca, 0x6c, 0x68, 0x25, 0x82, 0x87, 0xe5, 0x99, 0xc9, 0x83, 0x98, 0x7a,
+        0x7a, 0xa2, 0x3a, 0x69, 0xac, 0x6a, 0xd0, 0xac, 0xe9, 0xd7, 0xa3, 0x29, 0xf2, 0x90, 0xf9, 0x2f,
+        0x93, 0x47, 0xcc, 0x7c, 0x38, 0x03, 0x6d, 0xb6, 0xef, 0x6f, 0x15, 0xdd, 0x63, 0xa5, 0xfd, 0x60,
+        0x35, 0xf1, 0x5e, 0xe6, 0xe1, 0x69, 0x36, 0xcf, 0x80, 0xe7, 0xcd, 0x7c, 0xe9, 0x5b, 0x98, 0x19,
+        0x40, 0xaa, 0x2a, 0x6c, 0xa7, 0x7b, 0xe6, 0xb9, 0x8b, 0xdd, 0xbe, 0x7b, 0xe7, 0xbe, 0xbb, 0x77,
+        0xbc, 0xab, 0x8e, 0xa4, 0x0a, 0x6a, 0xa6, 0x89, 0x54, 0x93, 0x49, 0x79, 0x7c, 0x67, 0xf9, 0x7f,
+        0x66, 0xcc, 0x71, 0x66, 0xd3, 0x67, 0x16, 0x82, 0x68, 0x07, 0x0d, 0x6a, 0xb6, 0xec, 0x7f, 0x67,
+        0xe6, 0x7d, 0xe8, 0xf8, 0x8f, 0xf8, 0xbf, 0xa6, 0x4a, 0x43, 0xa4, 0x7b, 0x50, 0xaf, 0x0b, 0x2f,
+        0xbb, 0x9b, 0xb8, 0xba, 0xea, 0xd8, 0xb2, 0xfa, 0xec, 0xa0, 0xda, 0x2c, 0xa2, 0xe8, 0x98, 0x89,
+        0x28, 0xd3, 0x74, 0x57, 0x5d, 0x75, 0xe5, 0xb8, 0x62, 0x95, 0xe9, 0x54, 0xc5, 0x43, 0x54, 0x55,
+        0x90, 0x55, 0x05, 0x87, 0x63, 0xc6, 0x0c, 0x60, 0xe7, 0x48, 0x76, 0x27, 0x21, 0x86, 0xe8, 0x32,
+        0x83, 0x79, 0xc2, 0x96, 0xb9, 0xa9, 0x9e, 0x79, 0xe3, 0x9e, 0x19, 0xad, 0x9f, 0xa9, 0xba, 0x89,
+        0x68, 0xbf, 0x8b, 0xd7, 0xaa, 0x78, 0xb7, 0xd2, 0x5f, 0x86, 0x36, 0x62, 0xe4, 0xb9, 0x50, 0x64,
+        0xc5, 0x40, 0x04, 0x1b, 0x41, 0x94, 0x48, 0x3e, 0xd4, 0x2f, 0x4e, 0x14, 0xdd, 0x4d, 0x65, 0xdd,
+        0x5e, 0x45, 0xa4, 0x76, 0xe7, 0x4b, 0x74, 0x88, 0xa8, 0x83, 0xe8, 0x80, 0x98, 0x99, 0x83, 0x97,
+        0xa9, 0x25, 0x97, 0xb9, 0x35, 0x8e, 0x08, 0xf2, 0x8f, 0x97, 0xbf, 0x7b, 0x97, 0xf9, 0x69, 0xa6,
+        0xbe, 0x6b, 0x95, 0x15, 0x58, 0x85, 0x4e, 0x49, 0xb4, 0x9b, 0x49, 0xd4, 0xc0, 0x48, 0x24, 0xc5,
+        0x56, 0xa5, 0x9c, 0x59, 0xb4, 0x91, 0x4d, 0x54, 0x98, 0x45, 0xa4, 0x6e, 0x46, 0x55, 0x29, 0x4c,
+        0x45, 0x03, 0x64, 0x06, 0x2a, 0x62, 0xc7, 0x73, 0x77, 0xc7, 0x3f, 0x91, 0x78, 0xf2, 0x8f, 0xca,
+        0x31, 0x9d, 0xba, 0x1d, 0xad, 0x9a, 0xd6, 0xad, 0xaa, 0x35, 0xa9, 0x2a, 0x52, 0x9a, 0xc9, 0xc7,
+        0x9d, 0x18, 0x7b, 0x86, 0xd8, 0xab, 0x76, 0x47, 0x88, 0x78, 0x06, 0x27, 0x68, 0xe6, 0x50, 0x5f,
+        0xd5, 0xf3, 0x5f, 0x36, 0x84, 0x64, 0x26, 0x78, 0x77, 0x17, 0x3e, 0x73, 0xc8, 0xb2, 0x8c, 0xf8,
+        0x89, 0xa1, 0x29, 0xd9, 0x9d, 0x7b, 0x8e, 0xb3, 0xcb, 0x7b, 0xbe, 0x8b, 0xde, 0xbd, 0xfb, 0xcb,
+        0xc1, 0x9b, 0xd3, 0xad, 0xaa, 0xf9, 0xaf, 0x59, 0xff, 0x9e, 0x9a, 0x21, 0x86, 0x08, 0x9b, 0x89,
+        0xf7, 0x2d, 0x78, 0x07, 0x3c, 0x67, 0xc6, 0x94, 0x69, 0x96, 0xc6, 0x66, 0xa6, 0xa8, 0x76, 0xc7,
+        0x5c, 0x75, 0xd8, 0x4c, 0x85, 0x48, 0x16, 0x9c, 0x09, 0x9f, 0x9a, 0x2a, 0xe1, 0xa7, 0xda, 0xba,
+        0xba, 0x4b, 0x93, 0xb9, 0x2b, 0x1a, 0xb6, 0x5b, 0x24, 0xa9, 0x6a, 0xaf, 0xab, 0x29, 0x44, 0x93,
+        0x79, 0x78, 0x7e, 0x88, 0x0b, 0x80, 0xb6, 0x2f, 0x69, 0xf6, 0x62, 0x57, 0x55, 0x75, 0x57, 0x65,
+        0x55, 0x52, 0x65, 0x6a, 0x5b, 0xa5, 0x92, 0x59, 0x16, 0x97, 0x6b, 0x56, 0x78, 0x7c, 0x17, 0x8b,
+        0x79, 0x09, 0x40, 0x8e, 0x49, 0x26, 0x9b, 0x89, 0xaa, 0x9a, 0x19, 0xd8, 0xa1, 0x69, 0xd7, 0x91,
+        0x39, 0x32, 0x93, 0x78, 0x5b, 0x83, 0x38, 0x77, 0x6a, 0x36, 0xe8, 0x6d, 0xa5, 0x3f, 0x59, 0x25,
+        0x5b, 0x43, 0x64, 0x5a, 0x45, 0xd4, 0x2c, 0x3d, 0x24, 0x13, 0x47, 0x64, 0x76, 0x47, 0x15, 0x36,
+        0x54, 0x14, 0xfa, 0x6b, 0x66, 0x8e, 0x69, 0x68, 0x12, 0x7a, 0xe7, 0xec, 0x94, 0x09, 0x2a, 0x92,
+        0xb9, 0x43, 0x98, 0x09, 0x42, 0x94, 0x99, 0x55, 0x95, 0xb8, 0x63, 0x85, 0x78, 0x90, 0x75, 0x47,
+        0x77, 0x76, 0xf5, 0xb1, 0x62, 0x35, 0xe9, 0x4e, 0xf4, 0xf5, 0x4f, 0x74, 0xb7, 0x48, 0x94, 0xcb,
+        0x5f, 0xf6, 0x38, 0x63, 0x54, 0xee, 0x53, 0xa4, 0xfc, 0x46, 0xc4, 0x83, 0x48, 0x24, 0xdc, 0x48,
+        0x54, 0xbf, 0x5b, 0x35, 0xa5, 0x5a, 0x26, 0xce, 0x6d, 0x86, 0x94, 0x87, 0x88, 0x54, 0x85, 0x89,
+        0xd3, 0x96, 0x99, 0xab, 0xac, 0x6a, 0xbc, 0xab, 0x6a, 0x7c, 0xac, 0x7a, 0x8b, 0xa3, 0x3a, 0x49,
+        0xa4, 0xe9, 0x21, 0x91, 0x69, 0x5a, 0x80, 0xb8, 0x2b, 0x82, 0x56, 0x97, 0x70, 0x56, 0xc7, 0x61,
+        0xe6, 0x1d, 0x61, 0x86, 0x48, 0x61, 0x26, 0x52, 0x6e, 0xe6, 0xc2, 0x6c, 0x28, 0x08, 0x82, 0x67,
+        0xe4, 0x96, 0x79, 0x35, 0x93, 0x4b, 0x20, 0xab, 0xfa, 0xfc, 0xbb, 0xfb, 0xa7, 0xba, 0x8b, 0xf3,
+        0xc3, 0x6b, 0xfb, 0xb4, 0xdb, 0x66, 0xb6, 0xea, 0xaa, 0xa8, 0x6a, 0xc9, 0x90, 0x99, 0x4d, 0x94,
+        0x77, 0xae, 0x80, 0x87, 0xc1, 0x6b, 0x46, 0xdb, 0x6d, 0xc6, 0xa3, 0x65, 0x56, 0x91, 0x6f, 0x46,
+        0xef, 0x6e, 0xc7, 0xa5, 0x7b, 0x17, 0x7a, 0x91, 0x48, 0xef, 0x8e, 0xda, 0x56, 0x9e, 0x8a, 0x27,
+        0xb5, 0x7b, 0x4c, 0xb4, 0x4b, 0x2e, 0xb6, 0xeb, 0x2d, 0xaf, 0xfb, 0x0f, 0xb0, 0xd9, 0xe6, 0x9d,
+        0xba, 0x11, 0x89, 0x58, 0xbe, 0x8b, 0xd6, 0xbd, 0x73, 0xa6, 0xf7, 0x5c, 0x35, 0xca, 0x5c, 0xb5,
+        0x4d, 0x52, 0x15, 0x68, 0x55, 0xa5, 0x3b, 0x53, 0xc5, 0xf6, 0x61, 0xd5, 0xe3, 0x70, 0xc6, 0xd7,
+        0x6d, 0x88, 0xa9, 0x84, 0x38, 0x87, 0x95, 0xe9, 0x41, 0x94, 0x69, 0xcf, 0xa0, 0x99, 0xcf, 0x96,
+        0x79, 0x7a, 0x97, 0xc8, 0xf2, 0x8c, 0x69, 0x0a, 0x75, 0xa7, 0x95, 0x79, 0x15, 0xe3, 0x63, 0xf5,
+        0xf5, 0x49, 0xc4, 0xc6, 0x4c, 0xa4, 0x35, 0x3f, 0x04, 0x32, 0x42, 0xa4, 0x32, 0x43, 0x54, 0xa3,
+        0x4b, 0x54, 0x74, 0x60, 0x25, 0xdf, 0x5e, 0x37, 0x73, 0x6f, 0xd7, 0x41, 0x8c, 0xc8, 0xb6, 0x8a,
+        0xf9, 0x26, 0x95, 0xb9, 0x1d, 0x98, 0x79, 0x86, 0x98, 0xa8, 0xf2, 0x8d, 0xe9, 0x14, 0x80, 0x08,
+        0x25, 0x81, 0xb6, 0x57, 0x6d, 0x96, 0x94, 0x56, 0x65, 0x75, 0x57, 0xd4, 0xdc, 0x4b, 0xf4, 0xfb,
+        0x6a, 0xe6, 0xe2, 0x6e, 0x05, 0x67, 0x5b, 0xb5, 0x79, 0x49, 0x44, 0xba, 0x4c, 0x04, 0xb8, 0x46,
+        0x94, 0xaa, 0x54, 0x45, 0x3d, 0x53, 0xb6, 0x29, 0x63, 0x55, 0xf2, 0x7d, 0x27, 0xab, 0x7a, 0xe9,
+        0x4f, 0x8e, 0x69, 0x22, 0xa8, 0x8a, 0x73, 0xa7, 0x4a, 0x90, 0xad, 0x8a, 0x96, 0xa9, 0xfa, 0xa9,
+        0xaa, 0x89, 0xbb, 0x9b, 0x49, 0xf3, 0x8b, 0x38, 0xcd, 0x8d, 0x57, 0x1b, 0x79, 0x97, 0x58, 0x66,
+        0x56, 0x6c, 0x66, 0xb6, 0x3e, 0x61, 0x06, 0x51, 0x69, 0x36, 0x73, 0x66, 0xf7, 0x6e, 0x79, 0xa7,
+        0x59, 0x8b, 0xe8, 0x83, 0x88, 0x9a, 0x89, 0xa2, 0x5a, 0x65, 0xb6, 0xcb, 0x47, 0xb4, 0x8b, 0xf9,
+        0xc2, 0xfb, 0xf2, 0xba, 0x4b, 0xb8, 0xbb, 0xcb, 0x3f, 0xb1, 0x5b, 0x54, 0x9b, 0xa9, 0xf7, 0x9f,
+        0x08, 0x4a, 0x8a, 0x88, 0x68, 0x71, 0x87, 0x40, 0x73, 0x96, 0xb2, 0x66, 0xa6, 0xa7, 0x6a, 0x86,
+        0xb5, 0x6a, 0xf7, 0x1b, 0x72, 0x56, 0xe5, 0x86, 0xc8, 0x43, 0x84, 0x69, 0xb7, 0x94, 0x99, 0x89,
+        0xaf, 0x5a, 0xd9, 0xad, 0x3b, 0x16, 0xb4, 0xbb, 0x0b, 0xb4, 0x5b, 0x3f, 0xb4, 0x2a, 0x73, 0xa5,
+        0x6a, 0x9a, 0x94, 0x89, 0x64, 0x96, 0x47, 0x6a, 0x7d, 0xf7, 0xa5, 0x63, 0x66, 0x42, 0x64, 0x05,
+        0x74, 0x55, 0x35, 0x91, 0x52, 0x75, 0x16, 0x50, 0xe5, 0x74, 0x5a, 0x65, 0x65, 0x66, 0x56, 0x2d,
+        0x63, 0x47, 0xfd, 0x79, 0xe7, 0xda, 0x8e, 0x38, 0xc3, 0x8c, 0x09, 0xa8, 0x9c, 0xe9, 0x94, 0x99,
+        0x59, 0x9d, 0x99, 0xa9, 0x68, 0x93, 0x59, 0x75, 0x80, 0x18, 0x39, 0x83, 0x66, 0x93, 0x6e, 0xe6,
+        0xb0, 0x52, 0x15, 0x51, 0x56, 0x14, 0x6d, 0x43, 0x84, 0x74, 0x40, 0xc4, 0x22, 0x41, 0x74, 0x34,
+        0x44, 0xc4, 0x0e, 0x55, 0xf5, 0x3f, 0x54, 0x56, 0xc2, 0x64, 0xc6, 0x8e, 0x84, 0x18, 0x1e, 0x81,
+        0xc8, 0xe5, 0x90, 0x78, 0xcb, 0x99, 0xf9, 0x8d, 0x99, 0x89, 0x5d, 0x93, 0x29, 0x76, 0x8a, 0x98,
+        0xc2, 0x8b, 0xe7, 0x0d, 0x78, 0x97, 0x4e, 0x60, 0x06, 0x12, 0x61, 0x75, 0x2d, 0x51, 0x85, 0x5a,
+        0x75, 0x07, 0x8a, 0x78, 0x15, 0xf5, 0x64, 0xc6, 0x15, 0x4e, 0xc5, 0x1a, 0x51, 0x74, 0xbb, 0x47,
+        0xb4, 0xb6, 0x4f, 0x44, 0xf9, 0x4f, 0x25, 0x9f, 0x5b, 0x15, 0x71, 0x72, 0xa7, 0x09, 0x70, 0x88,
+        0xb6, 0x84, 0x78, 0x86, 0xa2, 0x8a, 0x0f, 0xa0, 0xda, 0x86, 0xab, 0xaa, 0x81, 0xad, 0xea, 0xeb,
+        0xae, 0x9a, 0x4d, 0xa3, 0x5a, 0x72, 0x95, 0xb9, 0x7c, 0x97, 0xc7, 0xbb, 0x83, 0xe7, 0xfc, 0x6d,
+        0x06, 0xe1, 0x6e, 0x06, 0x5d, 0x63, 0xa6, 0x7a, 0x65, 0x86, 0x43, 0x63, 0xf6, 0xed, 0x71, 0x86,
+        0xda, 0x81, 0xb7, 0xde, 0x7e, 0x19, 0xe1, 0x98, 0x39, 0xbd, 0xaf, 0x9a, 0xcf, 0xac, 0xdb, 0xd3,
+        0xbf, 0x7b, 0xc2, 0xbc, 0xfb, 0xdd, 0xbe, 0x0b, 0xb6, 0xb8, 0x7b, 0xc6, 0xa5, 0xda, 0x95, 0xa9,
+        0x48, 0xf2, 0x94, 0xd9, 0x08, 0x78, 0xe7, 0xc2, 0x7c, 0x96, 0xe4, 0x6a, 0x96, 0xeb, 0x68, 0x76,
+        0x9d, 0x69, 0x86, 0xa4, 0x6b, 0xd6, 0x84, 0x7c, 0x87, 0xa6, 0x7a, 0x59, 0x0f, 0x89, 0x68, 0xd7,
+        0xa6, 0x3a, 0x4a, 0xa4, 0x4a, 0xd2, 0xb0, 0x1a, 0xc1, 0xb5, 0xdb, 0x4f, 0xb5, 0x8a, 0xdd, 0xab,
+        0xba, 0xf8, 0x9e, 0x89, 0xff, 0xa0, 0x08, 0x14, 0x88, 0xb8, 0x4f, 0x6c, 0x16, 0xdb, 0x6d, 0xc5,
+        0xc2, 0x5a, 0x85, 0xe9, 0x51, 0xa5, 0x0f, 0x51, 0x05, 0x16, 0x54, 0xe5, 0x12, 0x5c, 0xc5, 0x96,
+        0x59, 0xa7, 0x4d, 0x6e, 0xc7, 0x24, 0x85, 0x08, 0x2b, 0x82, 0x29, 0x4d, 0x96, 0xb9, 0x33, 0x98,
+        0xd9, 0x87, 0x99, 0x09, 0xbd, 0x98, 0x79, 0xc2, 0x89, 0x78, 0xc8, 0x8c, 0x57, 0x3d, 0x79, 0xa7,
+        0x5c, 0x5c, 0x45, 0xfb, 0x5f, 0x64, 0xce, 0x4a, 0x54, 0xe0, 0x41, 0xe4, 0x37, 0x43, 0x03, 0xe8,
+        0x40, 0xf3, 0xce, 0x4c, 0xb4, 0xb7, 0x4b, 0x66, 0x16, 0x5a, 0x15, 0xdc, 0x79, 0xa7, 0x7a, 0x77,
+        0x68, 0x72, 0x89, 0x58, 0x53, 0x98, 0x59, 0x63, 0x96, 0xf9, 0x95, 0x96, 0x99, 0xa5, 0x92, 0xb9,
+        0x45, 0x93, 0xc7, 0xc0, 0x83, 0x77, 0xf5, 0x6a, 0xd6, 0xb8, 0x6c, 0x55, 0xa5, 0x59, 0xd5, 0xd9,
+        0x7f, 0x08, 0x25, 0x82, 0x76, 0x93, 0x6f, 0x96, 0xbb, 0x55, 0xc5, 0x94, 0x59, 0x54, 0xe9, 0x4a,
+        0x94, 0xe0, 0x4c, 0xf4, 0xd6, 0x4e, 0x05, 0x2a, 0x54, 0x25, 0x00, 0x68, 0xb6, 0x68, 0x66, 0x28,
+        0x13, 0x7a, 0x57, 0xdd, 0x9a, 0x99, 0x89, 0x98, 0x6a, 0x45, 0xa7, 0x7a, 0x38, 0xaf, 0xda, 0xf8,
+        0xaf, 0xaa, 0xb0, 0xa9, 0x3a, 0xd6, 0x9f, 0xaa, 0x15, 0xa1, 0xa8, 0x69, 0x8e, 0x18, 0x9d, 0x75,
+        0x77, 0x68, 0x77, 0x26, 0xa2, 0x68, 0x86, 0xc9, 0x64, 0x66, 0x39, 0x63, 0x56, 0x8d, 0x6c, 0x86,
+        0x85, 0x77, 0x87, 0x4d, 0x74, 0xc9, 0x3c, 0x8d, 0x39, 0x15, 0xa6, 0x3a, 0x3c, 0xa3, 0xab, 0x81,
+        0xba, 0x2b, 0x65, 0xbd, 0x7b, 0xd4, 0xbd, 0x2c, 0x0f, 0xbd, 0x1c, 0x11, 0xaf, 0x1b, 0x24, 0xb2,
+        0x39, 0x99, 0x9f, 0x59, 0xb9, 0x82, 0x68, 0x5c, 0x86, 0x17, 0x39, 0x70, 0x87, 0x4c, 0x69, 0x26,
+        0xaa, 0x6a, 0x86, 0x58, 0x67, 0xe6, 0x3e, 0x73, 0x67, 0x1d, 0x71, 0x68, 0x65, 0x7f, 0x88, 0x2f,
+        0x9c, 0xe9, 0xa6, 0x9a, 0x2a, 0x72, 0xa9, 0x3a, 0x50, 0xb4, 0x9b, 0x2f, 0xb3, 0x1b, 0x1a, 0xaf,
+        0x5b, 0x2e, 0xa7, 0x1a, 0x84, 0xa8, 0x18, 0xbd, 0x93, 0x68, 0xf5, 0x76, 0x47, 0x7e, 0x78, 0x16,
+        0x30, 0x62, 0x36, 0x5b, 0x53, 0x95, 0x42, 0x53, 0xa4, 0xe0, 0x52, 0x64, 0xe4, 0x54, 0x75, 0x21,
+        0x52, 0x26, 0xa9, 0x64, 0x06, 0x83, 0x7a, 0x67, 0x7c, 0x77, 0x98, 0xd2, 0x8f, 0x78, 0xae, 0x96,
+        0x39, 0x54, 0x95, 0x89, 0xe9, 0x9a, 0x19, 0xe4, 0x90, 0xf9, 0x35, 0x93, 0x87, 0xea, 0x84, 0x37,
+        0xfd, 0x66, 0xa6, 0xa6, 0x6a, 0x75, 0x59, 0x53, 0x05, 0x6e, 0x45, 0x64, 0x85, 0x47, 0xb3, 0xcd,
+        0x3f, 0xa3, 0xbb, 0x45, 0xe4, 0x53, 0x45, 0x35, 0x71, 0x50, 0x55, 0x3f, 0x6e, 0xf6, 0xcb, 0x6c,
+        0x37, 0xe5, 0x7f, 0xb7, 0xc2, 0x93, 0xd9, 0x17, 0x91, 0xd9, 0xa9, 0x97, 0x29, 0xaf, 0x99, 0x69,
+        0x9f, 0x99, 0xc8, 0x63, 0x8d, 0x28, 0x8e, 0x75, 0x77, 0x76, 0x77, 0x26, 0x3d, 0x63, 0x56, 0x6d,
+        0x88, 0x38, 0xb4, 0x8b, 0x07, 0x44, 0x79, 0x97, 0x5b, 0x5e, 0xf6, 0x26, 0x62, 0x65, 0x38, 0x50,
+        0x65, 0x46, 0x4d, 0x34, 0xe5, 0x4e, 0x24, 0xd7, 0x4f, 0xb4, 0xbe, 0x5f, 0xc5, 0xdf, 0x5d, 0xe7,
+        0x6b, 0x6f, 0x97, 0x34, 0x91, 0xc8, 0xf4, 0x8e, 0xf9, 0xee, 0xa1, 0x49, 0xd4, 0xaf, 0x9a, 0xe0,
+        0xae, 0x2a, 0xff, 0xad, 0x1b, 0x13, 0xa7, 0xfa, 0x99, 0xa9, 0x29, 0x0a, 0x98, 0x79, 0x4a, 0x7e,
+        0xf8, 0x0d, 0x80, 0xa7, 0x04, 0x6f, 0x67, 0x35, 0x65, 0xf6, 0x5c, 0x66, 0x06, 0x50, 0x68, 0xe6,
+        0x4f, 0x6f, 0x66, 0xcb, 0x6d, 0x38, 0x95, 0x83, 0x48, 0x73, 0x9c, 0x19, 0x95, 0x99, 0x2b, 0x11,
+        0xb2, 0xaa, 0xf1, 0xbb, 0x2b, 0xa3, 0xba, 0x8c, 0x3e, 0xbf, 0x8c, 0x3a, 0xb6, 0xab, 0x9a, 0xb9,
+        0x3a, 0x45, 0xa9, 0x8a, 0x5b, 0x8c, 0xb9, 0x04, 0x90, 0x77, 0xbc, 0x78, 0xb7, 0xcf, 0x6c, 0x56,
+        0xe2, 0x6e, 0x16, 0x2f, 0x65, 0xf6, 0x24, 0x6c, 0x36, 0xb0, 0x6b, 0x27, 0xbe, 0x75, 0x27, 0x93,
+        0x91, 0xf8, 0xfa, 0x8f, 0xc9, 0xf1, 0xa0, 0x39, 0xc9, 0xb0, 0x9a, 0xea, 0xae, 0x9b, 0x32, 0xaf,
+        0xeb, 0x42, 0xad, 0xaa, 0xe7, 0xad, 0xd9, 0x62, 0x9d, 0x29, 0x91, 0x80, 0xf8, 0x2e, 0x83, 0x06,
+        0xbd, 0x6a, 0xd6, 0xf1, 0x58, 0x35, 0x93, 0x58, 0xf4, 0xd6, 0x52, 0x44, 0xe7, 0x4e, 0xa4, 0xc5,
+        0x4c, 0xc6, 0x0c, 0x5a, 0xc5, 0xef, 0x6f, 0x86, 0xca, 0x6c, 0x98, 0x40, 0x85, 0x98, 0x11, 0x91,
+        0x18, 0xf5, 0x8f, 0x79, 0xe5, 0x99, 0x49, 0xdd, 0x96, 0x69, 0x87, 0x98, 0x28, 0x70, 0x8c, 0xc8,
+        0x8b, 0x71, 0x97, 0x4f, 0x75, 0x65, 0xf2, 0x5c, 0xb6, 0x11, 0x4b, 0x54, 0xe8, 0x4e, 0x43, 0xd4,
+        0x41, 0x43, 0xd6, 0x40, 0xf4, 0x09, 0x41, 0x64, 0xe9, 0x47, 0xd4, 0xb8, 0x63, 0xd6, 0x1c, 0x61,
+        0x97, 0x42, 0x75, 0x87, 0x16, 0x8d, 0x08, 0xa8, 0x8a, 0x59, 0x8f, 0x94, 0x69, 0x87, 0x9d, 0xa9,
+        0xcb, 0x9d, 0x38, 0xe2, 0x95, 0x09, 0x12, 0x80, 0xa8, 0x16, 0x82, 0x16, 0xe8, 0x6d, 0xb7, 0x21,
+        0x8f, 0xd9, 0x2d, 0x92, 0xa7, 0xdf, 0x83, 0x77, 0xf5, 0x68, 0xc6, 0xc6, 0x6c, 0xd5, 0xa4, 0x58,
+        0x15, 0xc0, 0x4f, 0x15, 0x15, 0x51, 0x64, 0xab, 0x4d, 0xd4, 0x9a, 0x58, 0x95, 0x75, 0x57, 0x96,
+        0xc5, 0x66, 0x36, 0x9c, 0x87, 0x78, 0x47, 0x84, 0xa9, 0x72, 0x99, 0x49, 0x55, 0xac, 0x0a, 0xae,
+        0xaa, 0x7b, 0x1d, 0xae, 0x5b, 0x2e, 0xae, 0xca, 0xf8, 0xaf, 0x79, 0xab, 0xa1, 0xf9, 0xde, 0x89,
+        0x18, 0xb1, 0x8a, 0xf7, 0x8c, 0x78, 0x17, 0xba, 0x69, 0xb6, 0xa3, 0x6a, 0x96, 0x36, 0x68, 0x66,
+        0x45, 0x69, 0x76, 0x78, 0x67, 0x57, 0xff, 0x79, 0x77, 0xd5, 0x91, 0xd8, 0xec, 0x8e, 0xfa, 0x85,
+        0xa9, 0x8a, 0x57, 0xb6, 0x8b, 0x56, 0xb4, 0xdc, 0x4a, 0xbf, 0xac, 0x36, 0xbc, 0x3b, 0xe4, 0xbe,
+        0x9a, 0xd5, 0xb2, 0xfa, 0xe8, 0x97, 0x49, 0xb1, 0x9b, 0x68, 0x4a, 0x82, 0xc8, 0x67, 0x71, 0x67,
+        0x44, 0x74, 0x26, 0x37, 0x67, 0x06, 0x32, 0x67, 0x16, 0x6b, 0x66, 0xf7, 0x2d, 0x6c, 0xd7, 0x10,
+        0x87, 0xc8, 0x55, 0x85, 0x29, 0x55, 0x96, 0x99, 0x28, 0xaa, 0x9a, 0x80, 0xa8, 0x3b, 0x21, 0xae,
+        0x4b, 0x23, 0xb1, 0xcb, 0x1f, 0xb1, 0x99, 0xe6, 0xa5, 0x4a, 0x14, 0x8b, 0xe8, 0xd4, 0x8d, 0x87,
+        0x57, 0x75, 0x37, 0x93, 0x5f, 0x06, 0x03, 0x60, 0x64, 0xef, 0x54, 0x75, 0x0b, 0x4a, 0xe4, 0x99,
+        0x49, 0xf5, 0x90, 0x53, 0x65, 0x73, 0x64, 0xe6, 0x29, 0x62, 0x27, 0x99, 0x7a, 0xe7, 0x68, 0x89,
+        0x68, 0x77, 0x87, 0xa9, 0xbc, 0x95, 0xf9, 0x9d, 0x99, 0x39, 0xa6, 0x9a, 0x08, 0xf2, 0x93, 0x98,
+        0xfe, 0x7b, 0xc7, 0xf2, 0x7f, 0x86, 0x9a, 0x67, 0xb6, 0xb5, 0x53, 0x05, 0x71, 0x56, 0xa4, 0x11,
+        0x45, 0x34, 0x17, 0x3f, 0x93, 0xf9, 0x3f, 0xb4, 0x6f, 0x40, 0xe4, 0x50, 0x5a, 0x05, 0x80, 0x57,
+        0xa6, 0x9a, 0x6a, 0xb6, 0x6d, 0x84, 0x18, 0x11, 0x81, 0xa9, 0x4e, 0x8f, 0xc9, 0x42, 0x9e, 0x29,
+        0xde, 0x9d, 0x89, 0x50, 0x9a, 0xe9, 0x6e, 0x8a, 0xa8, 0xb3, 0x8b, 0xc7, 0x8e, 0x79, 0x07, 0xc9,
+        0x95, 0xe9, 0x83, 0x97, 0xf8, 0x73, 0x8c, 0xb8, 0x8b, 0x72, 0xc7, 0x68, 0x76, 0xe6, 0x2f, 0x60,
+        0x76, 0x46, 0x53, 0x95, 0x65, 0x56, 0x34, 0xa7, 0x4e, 0x04, 0x99, 0x53, 0x25, 0x27, 0x52, 0x86,
+        0x3d, 0x5d, 0x06, 0x11, 0x7c, 0xf7, 0xa8, 0x7a, 0x18, 0xe7, 0x90, 0x28, 0xc7, 0xa6, 0xba, 0x4b,
+        0xa4, 0xab, 0x18, 0xad, 0xdb, 0x19, 0xb3, 0xdb, 0x3e, 0xb3, 0xba, 0x32, 0xaa, 0x6a, 0x65, 0x93,
+        0x89, 0x5c, 0x95, 0xa8, 0x1d, 0x81, 0x88, 0x5b, 0x6f, 0xa7, 0x15, 0x70, 0xa6, 0x4b, 0x6a, 0x56,
+        0x61, 0x65, 0x36, 0x44, 0x63, 0xf7, 0x7c, 0x72, 0x67, 0x60, 0x87, 0x78, 0x4c, 0x84, 0x69, 0xe9,
+        0x9f, 0xe9, 0xbf, 0xaf, 0xaa, 0xe1, 0xae, 0x5c, 0x29, 0xbc, 0xec, 0x12, 0xbf, 0xcc, 0x18, 0xc1,
+        0x4b, 0x55, 0xba, 0x0b, 0x61, 0xa1, 0xca, 0x50, 0xa5, 0x18, 0xea, 0x8c, 0xe9, 0x05, 0x78, 0xe7,
+        0xbf, 0x7b, 0xc6, 0x66, 0x6a, 0x96, 0x67, 0x64, 0xa6, 0x4c, 0x64, 0xe6, 0xbf, 0x65, 0xe6, 0x9e,
+        0x7d, 0xf7, 0xb6, 0x7b, 0x98, 0xad, 0x8c, 0x78, 0x83, 0xa2, 0xb9, 0xf4, 0x9f, 0xba, 0xeb, 0xaa,
+        0x3a, 0xdc, 0xb3, 0x9b, 0x30, 0xb2, 0x8a, 0x4f, 0xab, 0x4a, 0x74, 0x95, 0x59, 0x67, 0x96, 0xc8,
+        0x02, 0x7f, 0xc8, 0x3e, 0x67, 0x76, 0x9a, 0x69, 0x15, 0x2d, 0x59, 0xc5, 0x58, 0x49, 0xc4, 0x94,
+        0x49, 0xc5, 0x2c, 0x4d, 0xd5, 0x20, 0x5b, 0x35, 0x93, 0x59, 0x06, 0xf0, 0x70, 0x56, 0xc3, 0x80,
+        0x87, 0xdc, 0x7e, 0x59, 0x6d, 0x90, 0x99, 0x48, 0x99, 0x39, 0x9f, 0x99, 0x89, 0x49, 0x98, 0x79,
+        0x48, 0x84, 0xb8, 0x82, 0x88, 0x17, 0x43, 0x72, 0x47, 0x60, 0x5d, 0x26, 0x0e, 0x60, 0x84, 0x69,
+        0x4b, 0x94, 0x7b, 0x3f, 0xa4, 0x10, 0x40, 0xd4, 0x2b, 0x3d, 0x24, 0x14, 0x51, 0x24, 0xfd, 0x4f,
+        0x35, 0xea, 0x60, 0x25, 0xbf, 0x7a, 0x47, 0x73, 0x77, 0x58, 0xe0, 0x88, 0xf8, 0xc6, 0x9c, 0xa9,
+        0xba, 0x9b, 0x49, 0x8a, 0x9d, 0xb9, 0xa5, 0x92, 0xc9, 0x2e, 0x93, 0x88, 0x3e, 0x83, 0x98, 0x78,
+        0x99, 0xd9, 0xb7, 0x9b, 0xa8, 0xf4, 0x94, 0x69, 0x00, 0x7c, 0xa8, 0x0b, 0x80, 0xb6, 0xc4, 0x6a,
+        0x36, 0xe5, 0x5a, 0x35, 0xd7, 0x5d, 0x54, 0xc5, 0x50, 0x44, 0xc4, 0x4f, 0xa4, 0xf9, 0x50, 0x05,
+        0xc2, 0x55, 0xe5, 0xa3, 0x73, 0x57, 0x03, 0x70, 0xb8, 0x44, 0x85, 0xb8, 0x23, 0x9f, 0xe9, 0xd0,
+        0x9c, 0xfa, 0xea, 0xaa, 0x4a, 0xe7, 0xb5, 0xbb, 0x5a, 0xb5, 0xba, 0xa3, 0xb0, 0xda, 0xc8, 0x9d,
+        0x79, 0xeb, 0x9e, 0xf8, 0xbd, 0x8b, 0x88, 0xf7, 0x77, 0xb7, 0x93, 0x78, 0xb6, 0x81, 0x6e, 0x56,
+        0xa3, 0x63, 0x86, 0x34, 0x62, 0xd7, 0x11, 0x6c, 0x17, 0x00, 0x7d, 0xe7, 0xbe, 0x7b, 0x39, 0x48,
+        0x95, 0x79, 0x1b, 0xa7, 0x9a, 0x52, 0xa5, 0x8b, 0xe8, 0xb8, 0x2b, 0xbf, 0xc0, 0x9c, 0x17, 0xc1,
+        0x4b, 0xae, 0xbf, 0x3b, 0xaf, 0xaa, 0x9a, 0xe1, 0xae, 0x39, 0x91, 0x97, 0x19, 0xac, 0x81, 0xb8,
+        0x55, 0x85, 0x46, 0xb6, 0x70, 0x36, 0xc6, 0x64, 0x66, 0x54, 0x65, 0x96, 0x6e, 0x61, 0x06, 0x50,
+        0x74, 0xb7, 0x2b, 0x72, 0xd8, 0x04, 0x81, 0xc7, 0xdc, 0x99, 0x69, 0x5e, 0x96, 0x1a, 0x92, 0xa3,
+        0xba, 0x79, 0xb2, 0x7b, 0x1e, 0xb1, 0x3a, 0x96, 0xaf, 0x1a, 0xb7, 0x9d, 0xe9, 0xee, 0x9e, 0xe8,
+        0xa8, 0x8a, 0x28, 0xe3, 0x71, 0x97, 0x35, 0x72, 0xf5, 0x98, 0x60, 0x75, 0xc9, 0x4b, 0x84, 0xb6,
+        0x4b, 0xd4, 0xf3, 0x4a, 0x74, 0xeb, 0x53, 0x45, 0x17, 0x51, 0x56, 0x48, 0x66, 0x16, 0x22, 0x76,
+        0x37, 0x42, 0x73, 0xf8, 0xfa, 0x89, 0x08, 0xce, 0x97, 0x09, 0x70, 0x96, 0x99, 0x79, 0x9b, 0x19,
+        0x6f, 0x8c, 0xf8, 0xf0, 0x8f, 0x97, 0xe7, 0x7c, 0x68, 0x06, 0x67, 0x16, 0xb5, 0x6b, 0x14, 0xeb,
+        0x53, 0xf5, 0x01, 0x43, 0x34, 0x4d, 0x45, 0x34, 0x06, 0x3b, 0x73, 0xf9, 0x4a, 0x14, 0x8f, 0x48,
+        0xc5, 0x4a, 0x56, 0x55, 0x27, 0x70, 0x26, 0xc3, 0x6c, 0xd8, 0x5e, 0x7f, 0xc8, 0x3c, 0x98, 0xc9,
+        0x6f, 0x96, 0x59, 0xa1, 0x9e, 0xb9, 0xaf, 0x99, 0x99, 0x92, 0x99, 0x38, 0xdb, 0x8c, 0xe9, 0x0c,
+        0x9b, 0x89, 0xcb, 0x9c, 0x89, 0x52, 0x9a, 0x09, 0x61, 0x86, 0x78, 0x9b, 0x89, 0x57, 0x68, 0x74,
+        0x57, 0x7e, 0x62, 0x86, 0x59, 0x65, 0x95, 0x08, 0x55, 0x15, 0x0e, 0x4f, 0x14, 0xf5, 0x4f, 0xb5,
+        0x65, 0x51, 0x15, 0x51, 0x69, 0xe6, 0x7d, 0x68, 0x27, 0xa7, 0x7c, 0x07, 0x7d, 0x97, 0x39, 0x3d,
+        0x94, 0x0a, 0x9a, 0xa4, 0xfa, 0x8f, 0xb6, 0x5b, 0x51, 0xb5, 0x1a, 0xf7, 0xb5, 0x3b, 0x0e, 0xa6,
+        0x3a, 0x72, 0xa7, 0xd9, 0x5e, 0x95, 0x89, 0x9c, 0x80, 0x88, 0x28, 0x82, 0x26, 0xe0, 0x74, 0x97,
+        0x09, 0x64, 0x06, 0x47, 0x64, 0x96, 0xd0, 0x68, 0x46, 0xc5, 0x75, 0xb7, 0x3a, 0x73, 0x48, 0xa6,
+        0x8b, 0x48, 0x76, 0x9d, 0xe9, 0xb7, 0x9b, 0xeb, 0x87, 0xb1, 0x1b, 0x59, 0xbf, 0x6b, 0xf5, 0xbf,
+        0x1b, 0xe4, 0xc2, 0x5b, 0xe4, 0xb2, 0x8b, 0x50, 0xb5, 0x7a, 0x35, 0xa1, 0x1a, 0x55, 0x8b, 0x58,
+        0xf2, 0x8f, 0x37, 0x1f, 0x77, 0xb7, 0x37, 0x66, 0xc6, 0x81, 0x68, 0x26, 0x3a, 0x5f, 0x96, 0x2c,
+        0x6d, 0x26, 0xbc, 0x6b, 0xc7, 0x67, 0x78, 0x37, 0x3e, 0x8f, 0x28, 0xba, 0x8b, 0xfa, 0x15, 0x9b,
+        0xa9, 0xf5, 0xaf, 0x8a, 0xe1, 0xad, 0xaa, 0xb7, 0xb0, 0x8a, 0xc5, 0xa4, 0xfa, 0x50, 0xa5, 0x99,
+        0x47, 0x93, 0xe9, 0x7c, 0x7b, 0xd7, 0xdb, 0x7d, 0xc6, 0x1b, 0x69, 0x36, 0x55, 0x4f, 0x65, 0x00,
+        0x50, 0x04, 0xdb, 0x4a, 0x14, 0xe2, 0x4c, 0xe4, 0xc2, 0x4b, 0x95, 0xad, 0x5c, 0xb5, 0x89, 0x6b,
+        0xd6, 0x92, 0x69, 0x48, 0x6c, 0x80, 0x08, 0x44, 0x91, 0xd9, 0x1c, 0x91, 0x19, 0x87, 0x9a, 0xe9,
+        0x6d, 0x92, 0x99, 0x3e, 0x94, 0x68, 0x7b, 0x85, 0x68, 0x91, 0x71, 0xc7, 0x61, 0x75, 0xb5, 0x7a,
+        0x5d, 0x95, 0x96, 0x49, 0x04, 0xab, 0x4b, 0x44, 0x06, 0x3c, 0x84, 0x07, 0x45, 0x34, 0x4d, 0x44,
+        0xb4, 0xbe, 0x4d, 0xa4, 0xa2, 0x65, 0x66, 0x21, 0x62, 0xa7, 0xc0, 0x76, 0x87, 0xa0, 0x92, 0x79,
+        0x00, 0x8f, 0xd9, 0x8c, 0x9c, 0xc9, 0x90, 0x9d, 0x49, 0xcc, 0x9c, 0xc9, 0x5f, 0x95, 0x19, 0x90,
+        0x9b, 0x39, 0xae, 0x9b, 0x79, 0xa2, 0x9e, 0x09, 0x9d, 0x8e, 0xa9, 0x13, 0x91, 0xa8, 0x05, 0x7d,
+        0xf8, 0x20, 0x6b, 0xb6, 0xf6, 0x6f, 0x25, 0x66, 0x5b, 0xd5, 0x7a, 0x50, 0x45, 0x17, 0x51, 0x95,
+        0x2d, 0x4d, 0xb5, 0x21, 0x62, 0x96, 0x11, 0x60, 0xb7, 0x0f, 0x72, 0x36, 0xe2, 0x8d, 0x88, 0xa6,
+        0x8a, 0x5a, 0x31, 0x9d, 0x8a, 0x18, 0xb4, 0x2b, 0x20, 0xb2, 0x6b, 0x1e, 0xb7, 0x7b, 0x3d, 0xad,
+        0xea, 0xdb, 0xae, 0x09, 0xfa, 0x9f, 0x8a, 0x33, 0x8a, 0x78, 0xc6, 0x8c, 0x87, 0x53, 0x7b, 0xe7,
+        0x83, 0x67, 0x26, 0x7f, 0x68, 0x06, 0xab, 0x66, 0xa6, 0xaa, 0x6e, 0xb6, 0xd7, 0x6d, 0x48, 0x0b,
+        0x81, 0xd7, 0xe1, 0x93, 0xf9, 0x1a, 0x91, 0x8b, 0x03, 0xa9, 0x3a, 0xd3, 0xbb, 0x4b, 0xac, 0xba,
+        0xeb, 0xfd, 0xc2, 0xbb, 0xee, 0xb8, 0xdb, 0xb1, 0xba, 0xda, 0xc7, 0xaa, 0x3a, 0xe0, 0x95, 0x79,
+        0x9a, 0x99, 0x77, 0xab, 0x80, 0x57, 0xc3, 0x6b, 0xd6, 0xd7, 0x6d, 0xf6, 0x3a, 0x5f, 0x46, 0x2f,
+        0x67, 0xe6, 0x6e, 0x67, 0x06, 0xd7, 0x6f, 0xb6, 0xb3, 0x84, 0xb8, 0x19, 0x81, 0x79, 0x88, 0x92,
+        0x49, 0x64, 0xaa, 0x3a, 0x80, 0xa7, 0x8a, 0xb0, 0xaf, 0x8a, 0xb5, 0xa9, 0x4a, 0x92, 0xa9, 0x79,
+        0xcf, 0x9b, 0xfa, 0x02, 0x86, 0x18, 0x82, 0x87, 0xc6, 0xb5, 0x72, 0xd6, 0xee, 0x55, 0xa5, 0x6c,
+        0x57, 0x34, 0xe9, 0x4b, 0xb4, 0xfa, 0x49, 0x44, 0x8a, 0x48, 0x75, 0x32, 0x54, 0x85, 0x0a, 0x61,
+        0xc5, 0xf2, 0x5f, 0x47, 0xce, 0x75, 0xe7, 0x9c, 0x8b, 0xa8, 0xa1, 0x8a, 0x09, 0x5d, 0x98, 0x09,
+        0x42, 0x95, 0xa9, 0x69, 0x97, 0x18, 0xfd, 0x8c, 0xa9, 0x06, 0x7c, 0x57, 0xfb, 0x7f, 0x96, 0x1a,
+        0x67, 0xd6, 0x39, 0x4f, 0xc5, 0x31, 0x52, 0xf4, 0x34, 0x40, 0x74, 0x41, 0x42, 0xc4, 0x30, 0x42,
+        0xa4, 0x48, 0x47, 0x64, 0x34, 0x5b, 0x55, 0x7c, 0x58, 0x67, 0x1d, 0x6b, 0x66, 0xf6, 0x8a, 0x98,
+        0x73, 0x86, 0xf9, 0x55, 0x98, 0xa9, 0x48, 0x9f, 0x29, 0xd5, 0x9d, 0x99, 0xc5, 0x9a, 0xa9, 0xec,
+        0x98, 0x29, 0x7c, 0x97, 0xf9, 0xc2, 0x9f, 0x89, 0xb5, 0x95, 0x79, 0x7c, 0x97, 0xd8, 0x9b, 0x86,
+        0xe8, 0xb7, 0x75, 0x77, 0x98, 0x79, 0x05, 0xdf, 0x63, 0xc5, 0xf6, 0x53, 0xe5, 0x5e, 0x55, 0xa5,
+        0x17, 0x4c, 0xd5, 0x13, 0x5c, 0x45, 0xb4, 0x5b, 0x06, 0x76, 0x69, 0x56, 0x57, 0x83, 0x98, 0x06,
+        0x80, 0x69, 0xb3, 0x94, 0xd9, 0x92, 0xaf, 0xaa, 0xd0, 0xad, 0x2b, 0x27, 0xb7, 0xab, 0x31, 0xb2,
+        0xbb, 0x2f, 0xb3, 0x0a, 0x88, 0xa7, 0xba, 0xc0, 0x94, 0x49, 0x64, 0x96, 0x57, 0xe2, 0x84, 0xf8,
+        0x13, 0x6c, 0xa6, 0xdb, 0x6d, 0xb6, 0xb0, 0x67, 0xf6, 0xbf, 0x69, 0xf6, 0x96, 0x69, 0x07, 0x84,
+        0x79, 0xa7, 0x5e, 0x8a, 0x18, 0x74, 0x87, 0x6a, 0x70, 0x9f, 0x5a, 0x36, 0xb5, 0xab, 0x4a, 0xb4,
+        0x9b, 0xeb, 0xc1, 0x0b, 0xd2, 0xbc, 0xbb, 0xe4, 0xbe, 0xab, 0x48, 0xb2, 0x0b, 0x5e, 0x9f, 0xba,
+        0x37, 0xa3, 0x48, 0x44, 0x8a, 0x28, 0x60, 0x72, 0x57, 0x52, 0x74, 0xa6, 0x51, 0x62, 0x06, 0x61,
+        0x64, 0xd6, 0x4d, 0x64, 0xa6, 0x64, 0x68, 0x76, 0x44, 0x7a, 0x87, 0x77, 0x77, 0x88, 0xef, 0x88,
+        0x48, 0xc5, 0xa3, 0x79, 0xfe, 0x9f, 0xda, 0x8c, 0xac, 0x6a, 0x80, 0xab, 0xea, 0xb2, 0xab, 0x9a,
+        0x3c, 0xa2, 0x9a, 0x6e, 0x8f, 0xd9, 0x13, 0x91, 0xa7, 0x57, 0x7d, 0x37, 0x95, 0x5d, 0x75, 0xf0,
+        0x5f, 0xa5, 0x24, 0x50, 0x05, 0x49, 0x47, 0x74, 0x7f, 0x47, 0x74, 0xca, 0x4e, 0xf4, 0xaf, 0x58,
+        0x05, 0x5c, 0x56, 0x07, 0x2c, 0x6b, 0x36, 0xf1, 0x83, 0x08, 0x15, 0x81, 0x39, 0x18, 0x92, 0xe8,
+        0xf1, 0x96, 0x69, 0x6f, 0x97, 0x19, 0x56, 0x91, 0xc9, 0x57, 0x85, 0x38, 0x8d, 0x88, 0x26, 0xc2,
+        0x72, 0x16, 0xe4, 0x58, 0xe5, 0xc0, 0x5c, 0x64, 0x86, 0x45, 0xf4, 0x9d, 0x42, 0xe4, 0x3c, 0x43,
+        0x93, 0xf8, 0x42, 0x93, 0xe9, 0x52, 0x44, 0xf5, 0x4f, 0xd6, 0x70, 0x61, 0x06, 0x4e, 0x80, 0xe7,
+        0xdd, 0x7d, 0x78, 0xf3, 0x92, 0x08, 0xdf, 0x9d, 0xc9, 0xbd, 0x9c, 0x5a, 0x07, 0x9e, 0xba, 0x2b,
+        0x93, 0x79, 0x30, 0x92, 0x89, 0xc2, 0x9e, 0x99, 0xaf, 0x9a, 0x09, 0xbe, 0x9b, 0xa9, 0x21, 0x8f,
+        0x79, 0x32, 0x7f, 0x38, 0x33, 0x82, 0xc6, 0x6c, 0x6c, 0xc6, 0x89, 0x59, 0x55, 0xc0, 0x5b, 0xd5,
+        0x29, 0x4e, 0x95, 0x27, 0x58, 0x35, 0x82, 0x57, 0x85, 0xf0, 0x61, 0xb5, 0xdb, 0x79, 0xd7, 0x6b,
+        0x76, 0x49, 0x20, 0x8c, 0x08, 0xff, 0xa9, 0xaa, 0x6e, 0xa6, 0x9b, 0x0f, 0xb5, 0x6b, 0x11, 0xb6,
+        0x7b, 0x5b, 0xb5, 0xdb, 0x01, 0xaf, 0x7b, 0x32, 0x9e, 0x1a, 0x02, 0x9f, 0xc8, 0x74, 0x8e, 0xf8,
+        0xb4, 0x73, 0x47, 0x4b, 0x74, 0xb6, 0xd5, 0x6a, 0xb6, 0xed, 0x67, 0x96, 0x75, 0x67, 0x47, 0x17,
+        0x73, 0x96, 0xf6, 0x80, 0x17, 0xe1, 0x7e, 0x59, 0xd0, 0x95, 0xa9, 0x97, 0xad, 0xba, 0xcc, 0xac,
+        0x9b, 0xbc, 0xbd, 0x0b, 0x91, 0xbe, 0xab, 0xf5, 0xbf, 0x4b, 0xb1, 0xb7, 0x5b, 0xb6, 0xa8, 0xfa,
+        0xc8, 0xac, 0x48, 0xdd, 0x94, 0x19, 0x04, 0x7a, 0x27, 0xcf, 0x7d, 0x56, 0x92, 0x66, 0x66, 0xa7,
+        0x63, 0xc6, 0x49, 0x64, 0x65, 0xfd, 0x62, 0xf5, 0xf7, 0x71, 0xb6, 0xed, 0x6e, 0xe8, 0x44, 0x7d,
+        0xd8, 0x22, 0x9a, 0x79, 0x73, 0x96, 0x8a, 0x3b, 0xa6, 0xca, 0x2b, 0xab, 0xda, 0xa8, 0xaa, 0xca,
+        0x91, 0xa7, 0x0a, 0xb5, 0x98, 0x99, 0x9c, 0x99, 0xa7, 0xf5, 0x86, 0xf8, 0x37, 0x66, 0x86, 0x85,
+        0x68, 0xe5, 0x80, 0x56, 0x65, 0xa3, 0x48, 0x24, 0x94, 0x49, 0x04, 0x89, 0x4b, 0x14, 0x77, 0x4f,
+        0xd4, 0xe0, 0x4e, 0x36, 0x8b, 0x61, 0x76, 0x58, 0x79, 0x97, 0x7d, 0x77, 0x78, 0xaf, 0x8b, 0xf8,
+        0x84, 0x94, 0xa9, 0x47, 0x94, 0xf9, 0x8b, 0x94, 0x89, 0x89, 0x8d, 0x49, 0x03, 0x8f, 0xf7, 0x63,
+        0x7c, 0x57, 0x87, 0x63, 0x06, 0x5c, 0x66, 0x44, 0xfd, 0x4d, 0x55, 0x19, 0x45, 0x94, 0x6c, 0x46,
+        0x93, 0xd3, 0x40, 0xd3, 0xcc, 0x4b, 0x14, 0x8a, 0x49, 0x25, 0xd2, 0x57, 0x45, 0xb2, 0x76, 0xe7,
+        0x3c, 0x73, 0x58, 0x74, 0x89, 0xd8, 0x59, 0x9a, 0x99, 0x7a, 0x97, 0xba, 0x23, 0x9f, 0xaa, 0x41,
+        0x8d, 0x08, 0xbb, 0x8b, 0xa9, 0xa5, 0x9b, 0xd9, 0x84, 0x9c, 0x89, 0xe0, 0x9e, 0x29, 0x99, 0x95,
+        0xd9, 0x9e, 0x88, 0x98, 0xbf, 0x8c, 0x47, 0x02, 0x75, 0xf7, 0x27, 0x60, 0x56, 0x39, 0x63, 0x95,
+        0x53, 0x52, 0x65, 0x67, 0x56, 0x15, 0x60, 0x55, 0xe5, 0x93, 0x5b, 0x95, 0x7a, 0x70, 0x46, 0xd9,
+        0x6d, 0xe8, 0x83, 0x82, 0x28, 0x59, 0xa1, 0xf9, 0xe7, 0x9e, 0x7a, 0xd9, 0xb0, 0xda, 0xcb, 0xb7,
+        0xbb, 0x5e, 0xb6, 0x8b, 0x5b, 0xb4, 0x1b, 0x81, 0xa6, 0xda, 0x8e, 0xa8, 0xa9, 0x17, 0x98, 0x99,
+        0x4b, 0x7b, 0xe7, 0xd9, 0x7d, 0x87, 0x1b, 0x70, 0x27, 0x3d, 0x67, 0xa6, 0x74, 0x67, 0xb6, 0xbe,
+        0x6e, 0xc6, 0xaa, 0x77, 0xc7, 0x5a, 0x75, 0xa9, 0x2e, 0x8b, 0xc8, 0xfc, 0xa5, 0x0a, 0x37, 0xa3,
+        0x7b, 0x65, 0xb7, 0x9b, 0x3c, 0xbe, 0x1b, 0xe4, 0xbe, 0x4b, 0xf8, 0xbb, 0x5b, 0xf3, 0xb1, 0x2b,
+        0x4a, 0xb4, 0x79, 0x83, 0x9e, 0x29, 0xa3, 0x83, 0x48, 0x65, 0x87, 0x06, 0xf1, 0x6d, 0x27, 0x0f,
+        0x64, 0xf6, 0x63, 0x66, 0x35, 0xca, 0x60, 0x35, 0xbe, 0x6a, 0x46, 0x7b, 0x67, 0xa7, 0xa8, 0x74,
+        0x67, 0x84, 0x91, 0x08, 0xd2, 0x8d, 0x59, 0xca, 0x9f, 0xb9, 0xb7, 0xa9, 0xaa, 0x7c, 0xa7, 0xea,
+        0xba, 0xa9, 0x7a, 0xd9, 0x9f, 0x7a, 0x0d, 0xa0, 0xa8, 0x97, 0x90, 0xf8, 0xc8, 0x70, 0x17, 0x2d,
+        0x72, 0x75, 0xf5, 0x5e, 0x56, 0x20, 0x4b, 0x74, 0xd2, 0x4c, 0x24, 0x62, 0x49, 0xb4, 0x63, 0x49,
+        0x24, 0x79, 0x47, 0xf5, 0xf4, 0x57, 0xf5, 0xc1, 0x6f, 0x46, 0xd6, 0x6c, 0xf8, 0x2d, 0x83, 0x77,
+        0xfe, 0x90, 0xc9, 0x04, 0x90, 0x39, 0x9d, 0x95, 0x29, 0x8e, 0x93, 0x59, 0x5a, 0x95, 0x97, 0xfe,
+        0x84, 0xf8, 0x15, 0x6d, 0x47, 0x08, 0x70, 0xc5, 0x86, 0x56, 0x65, 0xae, 0x49, 0xe4, 0xc4, 0x4b,
+        0xf3, 0xc8, 0x40, 0xd3, 0xd5, 0x45, 0xe4, 0x40, 0x44, 0x75, 0x45, 0x4f, 0x45, 0x2a, 0x6c, 0xb6,
+        0x8e, 0x68, 0xe7, 0xdf, 0x80, 0x47, 0xc4, 0x95, 0x09, 0x1b, 0x91, 0xba, 0x1e, 0x9e, 0x8a, 0x2d,
+        0x85, 0x08, 0x38, 0x83, 0xa9, 0x5d, 0x97, 0x99, 0x32, 0x9d, 0x29, 0xe5, 0x9e, 0x99, 0xe8, 0x9a,
+        0xe9, 0xe5, 0x91, 0x29, 0x45, 0x94, 0xc7, 0x9d, 0x7f, 0xc7, 0xbd, 0x68, 0xf6, 0xbb, 0x6c, 0x25,
+        0xa2, 0x57, 0x45, 0xb6, 0x56, 0x95, 0x6c, 0x56, 0xe5, 0x48, 0x57, 0xd5, 0x3b, 0x68, 0x16, 0x59,
+        0x65, 0xc7, 0xe6, 0x78, 0xc7, 0xc3, 0x98, 0xe9, 0x59, 0x95, 0x6a, 0x7e, 0xaa, 0xfa, 0x6d, 0xb6,
+        0x8b, 0x4a, 0xb4, 0xab, 0x9c, 0xb7, 0xcb, 0xb8, 0xae, 0xfb, 0x01, 0xaf, 0xf9, 0xb1, 0xa2, 0x79,
+        0xe7, 0x84, 0x88, 0x71, 0x86, 0xe7, 0x84, 0x76, 0xa7, 0xa8, 0x69, 0x46, 0xa1, 0x69, 0xf6, 0x90,
+        0x6c, 0x56, 0x7e, 0x70, 0x66, 0xf0, 0x6e, 0xf8, 0x99, 0x82, 0x58, 0x62, 0x9b, 0x79, 0x9d, 0x99,
+        0xca, 0xef, 0xaf, 0xfa, 0xc4, 0xbb, 0x7b, 0xad, 0xbb, 0x0c, 0x1c, 0xbd, 0x1c, 0x0d, 0xb8, 0x1b,
+        0xab, 0xba, 0x7a, 0x1c, 0xa7, 0x6a, 0x30, 0x8d, 0x09, 0x02, 0x90, 0x87, 0x75, 0x75, 0x77, 0x92,
+        0x68, 0xc6, 0xa9, 0x6a, 0x35, 0xad, 0x5f, 0x75, 0xb3, 0x63, 0xb6, 0x1d, 0x62, 0x57, 0x13, 0x6b,
+        0x86, 0xf3, 0x87, 0x38, 0x34, 0x83, 0x49, 0x49, 0x97, 0x19, 0x34, 0xa5, 0x9a, 0x2f, 0xa3, 0x1a,
+        0xc6, 0xa9, 0x5a, 0xd5, 0xa4, 0xea, 0x5c, 0xa5, 0x79, 0x25, 0x99, 0x99, 0x59, 0x7a, 0x57, 0xc8,
+        0x7c, 0xc6, 0x82, 0x67, 0x36, 0xb5, 0x50, 0x75, 0x27, 0x52, 0x64, 0x65, 0x4b, 0x04, 0x71, 0x44,
+        0x34, 0x39, 0x43, 0xf5, 0x6b, 0x4f, 0xe5, 0x3e, 0x65, 0x16, 0x3d, 0x63, 0x27, 0x9b, 0x7a, 0x37,
+        0x62, 0x8a, 0xa8, 0x9e, 0x89, 0xa9, 0x8a, 0x93, 0x09, 0x72, 0x96, 0xe9, 0x8f, 0x98, 0x98, 0x76,
+        0x8c, 0xf8, 0x89, 0x77, 0x07, 0xaa, 0x7a, 0x96, 0x20, 0x60, 0x36, 0x43, 0x50, 0xe5, 0x37, 0x53,
+        0x13, 0xec, 0x43, 0xf3, 0xfd, 0x42, 0xd4, 0x10, 0x41, 0xb4, 0xcc, 0x47, 0xc4, 0xbd, 0x62, 0x35,
+        0xf3, 0x5f, 0x37, 0x46, 0x76, 0x17, 0x25, 0x8d, 0x48, 0xa2, 0x8a, 0x39, 0xf2, 0x9a, 0xc9, 0xf1,
+        0x7c, 0x87, 0xa6, 0x7a, 0x79, 0x02, 0x90, 0xe8, 0xcd, 0x9b, 0xf9, 0xbb, 0x9b, 0xfa, 0x21, 0x9d,
+        0x7a, 0x16, 0x98, 0xc9, 0xb6, 0x9b, 0x38, 0x35, 0x88, 0xf8, 0x50, 0x72, 0x07, 0x53, 0x75, 0x36,
+        0x0f, 0x5e, 0xc6, 0x2a, 0x58, 0x75, 0x95, 0x59, 0x85, 0x18, 0x55, 0xc5, 0x1f, 0x61, 0x65, 0xee,
+        0x5f, 0x77, 0x54, 0x6f, 0x87, 0x32, 0x8f, 0xb8, 0xb9, 0x8c, 0x3a, 0x09, 0xa3, 0x29, 0xf7, 0xb3,
+        0x7b, 0x0a, 0xb0, 0xfb, 0xb7, 0xb8, 0xcb, 0xcc, 0xb5, 0x3b, 0x5f, 0xb5, 0x9a, 0x41, 0xab, 0x7a,
+        0x73, 0x8e, 0x79, 0x09, 0x90, 0xe7, 0xfc, 0x7e, 0xd8, 0x2d, 0x6c, 0xf6, 0xe6, 0x6e, 0xa6, 0x7d,
+        0x6c, 0x26, 0x81, 0x6a, 0xf6, 0x99, 0x69, 0xf8, 0x0a, 0x79, 0xb7, 0xda, 0x91, 0xf9, 0x00, 0x8f,
+        0xda, 0x6f, 0xa7, 0x7a, 0x3c, 0xb6, 0xbb, 0x58, 0xb5, 0x7c, 0x21, 0xbc, 0x9c, 0x05, 0xbd, 0x1b,
+        0xea, 0xbe, 0x8a, 0x9e, 0xaf, 0x9a, 0xb6, 0x96, 0xf9, 0xaa, 0x9a, 0x77, 0xf8, 0x7e, 0x78, 0x23,
+        0x6e, 0x07, 0x07, 0x70, 0x45, 0xbf, 0x60, 0xb5, 0xc6, 0x5f, 0xe5, 0xe4, 0x5e, 0x96, 0x96, 0x63,
+        0x86, 0x7d, 0x7c, 0xc7, 0x9b, 0x79, 0x68, 0xb6, 0x8d, 0x78, 0x98, 0x9f, 0x49, 0xbf, 0x9c, 0x4a,
+        0xab, 0xa7, 0x2a, 0xb0, 0xa8, 0x5a, 0x85, 0xa8, 0x09, 0x9f, 0xa0, 0xc9, 0xc5, 0x84, 0x28, 0x64,
+        0x86, 0x67, 0x1f, 0x70, 0xc7, 0x51, 0x57, 0xb5, 0x9f, 0x59, 0x84, 0x8b, 0x4e, 0x44, 0xa5, 0x41,
+        0x74, 0x20, 0x41, 0xf4, 0xfe, 0x49, 0xb4, 0xd7, 0x5b, 0xa5, 0xa3, 0x5a, 0x37, 0x03, 0x70, 0x06,
+        0xc4, 0x83, 0x38, 0x12, 0x81, 0xe9, 0x58, 0x8e, 0xe9, 0x2f, 0x98, 0x99, 0x9c, 0x99, 0x98, 0xe1,
+        0x92, 0x68, 0xe9, 0x80, 0x88, 0x2e, 0x83, 0x96, 0xbe, 0x6a, 0x66, 0xe5, 0x59, 0x15, 0xbd, 0x5c,
+        0x14, 0x2f, 0x48, 0xa4, 0x4e, 0x41, 0xe4, 0x13, 0x41, 0x94, 0x72, 0x42, 0xe4, 0x6e, 0x59, 0x85,
+        0x6e, 0x56, 0x96, 0xa0, 0x6b, 0xf6, 0x83, 0x84, 0x88, 0x0b, 0x81, 0x09, 0x9b, 0x95, 0x89, 0x95
+    },
+    {
+        0x7a, 0x57, 0xe1, 0x7e, 0x36, 0x42, 0x6a, 0x26, 0x5e, 0x50, 0xd5, 0x43, 0x54, 0x34, 0xad, 0x46,
+        0x54, 0xa8, 0x4a, 0xd4, 0xad, 0x4a, 0xf5, 0x27, 0x53, 0x44, 0xf4, 0x69, 0x56, 0x7a, 0x67, 0x28,
+        0x26, 0x7b, 0x87, 0xf7, 0x9c, 0xd9, 0xac, 0x9a, 0x9a, 0x78, 0xaa, 0x0a, 0x61, 0xb2, 0xeb, 0x2d,
+        0xb2, 0x8a, 0xe6, 0xac, 0x4b, 0x03, 0xa2, 0x3a, 0x42, 0xa4, 0x28, 0x8e, 0x90, 0x78, 0xc7, 0x76,
+        0xc7, 0x8b, 0x78, 0x56, 0x91, 0x68, 0x66, 0xc7, 0x61, 0xb6, 0x17, 0x61, 0x76, 0x41, 0x67, 0x86,
+        0x3a, 0x71, 0xf6, 0xe9, 0x6f, 0x68, 0xdb, 0x87, 0x38, 0xb0, 0xa1, 0x69, 0xe6, 0x9e, 0x4b, 0x5d,
+        0xb7, 0x8b, 0x36, 0xbe, 0xdb, 0xe3, 0xbe, 0x3c, 0x65, 0xc2, 0x7c, 0x63, 0xb7, 0xcb, 0xa7, 0xba,
+        0x4a, 0x39, 0xa9, 0x6a, 0x58, 0x8b, 0x78, 0xf7, 0x8f, 0x77, 0x9d, 0x77, 0x37, 0xad, 0x69, 0x36,
+        0xc3, 0x6b, 0xa6, 0x07, 0x63, 0x25, 0xf8, 0x68, 0xc6, 0x7f, 0x68, 0x17, 0x92, 0x72, 0x17, 0x5e,
+        0x90, 0x18, 0xd1, 0x8c, 0xf9, 0xdc, 0x9f, 0x09, 0xb8, 0xb1, 0x0a, 0xf1, 0xae, 0xab, 0x61, 0xb2,
+        0x4b, 0x61, 0xb2, 0x8b, 0x2c, 0xb2, 0x79, 0xbc, 0xa3, 0x59, 0xfa, 0x87, 0x58, 0x8d, 0x89, 0x27,
+        0x08, 0x70, 0x87, 0x46, 0x5a, 0xa5, 0xc1, 0x5b, 0x84, 0xb8, 0x50, 0xc4, 0xcc, 0x49, 0x24, 0x75,
+        0x47, 0xe5, 0x81, 0x52, 0x45, 0x66, 0x65, 0x86, 0x2a, 0x62, 0xd7, 0xb1, 0x7c, 0x47, 0x7f, 0x8b,
+        0xe8, 0x97, 0x89, 0xa9, 0xe3, 0x98, 0x89, 0xcf, 0x9b, 0xd9, 0xd3, 0x9c, 0xb9, 0x1f, 0x97, 0x19,
+        0x32, 0x7e, 0xc8, 0x2a, 0x82, 0xa6, 0xbf, 0x6a, 0x06, 0xe1, 0x54, 0x85, 0x89, 0x57, 0xe4, 0x02,
+        0x44, 0xe4, 0x10, 0x3c, 0x93, 0xd1, 0x3d, 0x04, 0x22, 0x3c, 0x84, 0x05, 0x53, 0xe5, 0x1d, 0x51,
+        0x86, 0x35, 0x64, 0x36, 0x05, 0x7f, 0xb7, 0xba, 0x7c, 0x49, 0x32, 0x8d, 0x79, 0x15, 0xa0, 0x09,
+        0xee, 0x9f, 0x29, 0xa7, 0x9f, 0xd9, 0xc3, 0x93, 0x09, 0x3d, 0x94, 0x58, 0x29, 0x82, 0xd8, 0x71,
+        0x7d, 0x88, 0x16, 0x81, 0x16, 0x76, 0x6d, 0x76, 0x93, 0x53, 0x65, 0x6f, 0x56, 0xd4, 0xbb, 0x47,
+        0xb4, 0xb8, 0x49, 0xf4, 0xa8, 0x4a, 0x95, 0x03, 0x51, 0x94, 0xd6, 0x66, 0x76, 0x42, 0x64, 0x67,
+        0xf9, 0x78, 0x47, 0xc8, 0x9a, 0x49, 0x7f, 0x97, 0x9a, 0x5b, 0xa8, 0x9a, 0x45, 0xb2, 0xab, 0x27,
+        0xb1, 0xfa, 0xfb, 0xae, 0x1b, 0x1b, 0xa5, 0x6a, 0x70, 0xa6, 0xf8, 0xb9, 0x93, 0xc8, 0xfe, 0x79,
+        0xe7, 0xb1, 0x7b, 0xc6, 0xb2, 0x6a, 0x66, 0xe6, 0x62, 0x36, 0x20, 0x62, 0x16, 0x30, 0x66, 0xe6,
+        0x31, 0x6f, 0x36, 0xc7, 0x6c, 0xb8, 0xa2, 0x83, 0xf8, 0x7e, 0x9e, 0x29, 0xb5, 0x9b, 0x1b, 0x3b,
+        0xb5, 0x3b, 0x11, 0xbd, 0xbb, 0xce, 0xbd, 0x3c, 0x71, 0xc2, 0xac, 0x6c, 0xba, 0x3b, 0xca, 0xbc,
+        0x9a, 0x68, 0xac, 0x9a, 0x86, 0x8e, 0x99, 0x27, 0x92, 0xf7, 0xc5, 0x79, 0xf7, 0xde, 0x6b, 0x06,
+        0xd7, 0x6d, 0x56, 0x01, 0x63, 0x45, 0xf4, 0x67, 0x16, 0x62, 0x66, 0x47, 0x5f, 0x6f, 0x17, 0x2e,
+        0x8c, 0x78, 0xa2, 0x89, 0xc9, 0xa7, 0x9b, 0xf9, 0x7c, 0xaf, 0x3a, 0xc8, 0xac, 0x9b, 0x59, 0xb1,
+        0xfb, 0x57, 0xb3, 0xab, 0x40, 0xb3, 0xa9, 0xe8, 0xa5, 0xfa, 0x1d, 0x8a, 0x98, 0xc8, 0x8c, 0xa7,
+        0x3d, 0x73, 0xa7, 0x78, 0x5c, 0x95, 0xe1, 0x5e, 0x04, 0xc7, 0x52, 0x14, 0xe3, 0x48, 0x34, 0x6f,
+        0x47, 0x15, 0x61, 0x50, 0x45, 0x42, 0x62, 0x55, 0xf9, 0x5f, 0x47, 0x7a, 0x78, 0xb7, 0x44, 0x89,
+        0x08, 0x69, 0x86, 0xa9, 0xd2, 0x96, 0xc9, 0xad, 0x9c, 0x79, 0xda, 0x9d, 0x09, 0x45, 0x98, 0x99,
+        0x48, 0x82, 0x38, 0x53, 0x85, 0xa6, 0xf4, 0x6d, 0xb7, 0x16, 0x57, 0xa5, 0xb9, 0x5b, 0x54, 0x20,
+        0x46, 0xf4, 0x2c, 0x3c, 0x53, 0xd9, 0x3d, 0x94, 0x0f, 0x3b, 0x33, 0xf0, 0x50, 0xa4, 0xf3, 0x4e,
+        0xc6, 0x00, 0x61, 0x05, 0xcd, 0x7c, 0xa7, 0x91, 0x79, 0x09, 0x06, 0x8b, 0x48, 0xed, 0x9f, 0xa9,
+        0xdf, 0x9e, 0x19, 0xb8, 0xa0, 0xe9, 0xd3, 0x95, 0x69, 0x66, 0x96, 0xd8, 0x5f, 0x86, 0x08, 0xa1,
+        0x80, 0x28, 0x3f, 0x84, 0x16, 0xa3, 0x70, 0xf6, 0xca, 0x55, 0x85, 0x96, 0x59, 0x74, 0xcb, 0x49,
+        0x24, 0xd2, 0x49, 0xb4, 0xac, 0x4a, 0x74, 0xe4, 0x50, 0x24, 0xbf, 0x63, 0xa6, 0x1d, 0x61, 0x77,
+        0xc6, 0x75, 0x07, 0x90, 0x97, 0x49, 0x51, 0x94, 0xba, 0x46, 0xa6, 0x1a, 0x24, 0xb2, 0xeb, 0x16,
+        0xb1, 0xbb, 0x11, 0xaf, 0x4b, 0x33, 0xa7, 0x8a, 0x95, 0xa9, 0x68, 0xf2, 0x97, 0x39, 0x31, 0x7c,
+        0xa7, 0xe3, 0x7e, 0x76, 0xdb, 0x6c, 0x97, 0x09, 0x63, 0x16, 0x2e, 0x63, 0x06, 0x22, 0x66, 0x56,
+        0x26, 0x6c, 0xb6, 0xa9, 0x6a, 0x48, 0x74, 0x81, 0x48, 0x45, 0x9a, 0xe9, 0x86, 0x97, 0xeb, 0x12,
+        0xb2, 0x6a, 0xeb, 0xbc, 0xcb, 0xbe, 0xbb, 0xdc, 0x73, 0xc2, 0xac, 0x70, 0xbc, 0x1b, 0xe5, 0xbe,
+        0x1a, 0x9a, 0xaf, 0x8a, 0xb9, 0x92, 0x09, 0x62, 0x96, 0x27, 0xf1, 0x7d, 0x08, 0x0c, 0x6c, 0xb6,
+        0xf5, 0x6f, 0x26, 0x01, 0x63, 0xa5, 0xfd, 0x65, 0xf6, 0x4e, 0x65, 0x57, 0x36, 0x6c, 0xa7, 0x06,
+        0x89, 0x18, 0x65, 0x86, 0x19, 0x74, 0x98, 0xe9, 0x4a, 0xad, 0x3a, 0xa3, 0xaa, 0xab, 0x4f, 0xb0,
+        0xcb, 0x4f, 0xb4, 0x8b, 0x4b, 0xb4, 0x8a, 0x15, 0xa8, 0x5a, 0x39, 0x8d, 0xe8, 0xfb, 0x8f, 0x97,
+        0x6f, 0x76, 0xd7, 0xae, 0x5f, 0xa6, 0x0d, 0x60, 0x64, 0xd8, 0x53, 0x14, 0xf5, 0x47, 0x84, 0x68,
+        0x46, 0xb5, 0x39, 0x4e, 0x95, 0x29, 0x5f, 0x35, 0xc7, 0x5c, 0x67, 0x46, 0x75, 0x57, 0x11, 0x86,
+        0x18, 0x3a, 0x83, 0xa9, 0xb9, 0x94, 0xd9, 0x99, 0x9c, 0x39, 0xd8, 0x9d, 0x59, 0x58, 0x99, 0xf9,
+        0x61, 0x84, 0xd8, 0x7a, 0x88, 0x57, 0x2f, 0x70, 0xc7, 0x4d, 0x5a, 0x75, 0xea, 0x5e, 0x94, 0x42,
+        0x49, 0x24, 0x54, 0x3c, 0xf3, 0xe1, 0x3e, 0x23, 0xfc, 0x3a, 0x63, 0xe6, 0x4e, 0x64, 0xcc, 0x4c,
+        0x55, 0xc7, 0x5d, 0xc5, 0x9e, 0x79, 0x27, 0x5a, 0x75, 0xa8, 0xe4, 0x88, 0x38, 0xc8, 0x9e, 0x49,
+        0xce, 0x9c, 0x99, 0xc3, 0xa1, 0x59, 0xda, 0x97, 0x69, 0x81, 0x98, 0x78, 0x91, 0x89, 0x68, 0xd3,
+        0x83, 0x98, 0x73, 0x86, 0xe6, 0xd4, 0x73, 0x96, 0xff, 0x58, 0x95, 0xc2, 0x5b, 0x94, 0xe2, 0x4a,
+        0xa4, 0xef, 0x49, 0x64, 0xae, 0x4a, 0x64, 0xc9, 0x4e, 0x54, 0xa5, 0x60, 0xe5, 0xf0, 0x5f, 0x27,
+        0x95, 0x72, 0x07, 0x61, 0x94, 0x99, 0x1c, 0x91, 0xaa, 0x27, 0xa4, 0x1a, 0x09, 0xb2, 0x3b, 0x16,
+        0xb0, 0xfb, 0x23, 0xaf, 0xdb, 0x39, 0xa9, 0xda, 0xbb, 0xab, 0x29, 0x22, 0x9a, 0x59, 0x5f, 0x7f,
+        0x88, 0x1c, 0x81, 0x36, 0xf7, 0x6e, 0xc7, 0x2d, 0x63, 0x86, 0x42, 0x63, 0xc6, 0x16, 0x65, 0xf6,
+        0x1b, 0x6a, 0xd6, 0x8a, 0x69, 0x08, 0x44, 0x7e, 0x38, 0x1a, 0x97, 0x89, 0x4c, 0x94, 0x6a, 0xe9,
+        0xaf, 0xba, 0xbb, 0xbb, 0x1b, 0xa3, 0xba, 0x7c, 0x72, 0xc2, 0xfc, 0x6f, 0xbd, 0x0b, 0xfb, 0xbf,
+        0x9a, 0xc8, 0xb2, 0x5a, 0xdc, 0x95, 0x59, 0x8c, 0x99, 0x38, 0x1c, 0x7f, 0xa8, 0x3c, 0x6e, 0x97,
+        0x13, 0x71, 0x36, 0x04, 0x64, 0x36, 0x04, 0x64, 0x96, 0x3c, 0x64, 0x47, 0x0c, 0x6a, 0x86, 0xe7,
+        0x86, 0x38, 0x34, 0x82, 0xf9, 0x4a, 0x96, 0x09, 0x1a, 0xab, 0x1a, 0x7d, 0xa8, 0x8b, 0x47, 0xb0,
+        0x5b, 0x40, 0xb5, 0x0b, 0x55, 0xb5, 0x0a, 0x33, 0xaa, 0x0a, 0x5f, 0x91, 0x19, 0x27, 0x92, 0xb7,
+        0x9f, 0x7a, 0x07, 0xe2, 0x61, 0x86, 0x36, 0x63, 0x54, 0xe9, 0x54, 0xb5, 0x06, 0x47, 0x64, 0x5f,
+        0x46, 0x95, 0x1f, 0x4c, 0xa5, 0x0b, 0x5c, 0x75, 0xa0, 0x59, 0x97, 0x13, 0x71, 0xc6, 0xda, 0x83,
+        0x78, 0x0b, 0x81, 0x29, 0x9b, 0x93, 0x29, 0x72, 0x9c, 0x39, 0xcc, 0x9c, 0xc9, 0x72, 0x9b, 0x19,
+        0x77, 0x87, 0x68, 0xa4, 0x8a, 0xd7, 0x5f, 0x73, 0xe7, 0x7d, 0x5d, 0x86, 0x1a, 0x61, 0x64, 0x66,
+        0x4b, 0x24, 0x74, 0x3e, 0x13, 0xf1, 0x3f, 0x13, 0xec, 0x39, 0x93, 0xd2, 0x4c, 0x44, 0xa9, 0x4a,
+        0x35, 0x97, 0x5a, 0xd5, 0x6e, 0x75, 0xe7, 0x24, 0x72, 0xb8, 0xb8, 0x86, 0x38, 0xa0, 0x9d, 0x19,
+        0xbb, 0x9b, 0x29, 0xcb, 0xa1, 0xa9, 0xd9, 0x99, 0xc9, 0x9f, 0x9a, 0x08, 0xc5, 0x8b, 0xb9, 0x00,
+        0x85, 0xe8, 0x97, 0x89, 0xf7, 0x0a, 0x76, 0x87, 0x2b, 0x5a, 0xf5, 0xe9, 0x5e, 0xa4, 0xfa, 0x4c,
+        0x75, 0x04, 0x49, 0xa4, 0xb3, 0x4b, 0x44, 0xb8, 0x4d, 0x64, 0x9a, 0x5e, 0x45, 0xc7, 0x5c, 0xb7,
+        0x6c, 0x6f, 0x27, 0x32, 0x92, 0x08, 0xec, 0x8f, 0x2a, 0x06, 0xa2, 0x69, 0xe6, 0xb1, 0x9b, 0x06,
+        0xb0, 0x4b, 0x33, 0xb0, 0x8b, 0x47, 0xac, 0x6a, 0xde, 0xad, 0x89, 0x56, 0x9c, 0xa9, 0x8d, 0x82,
+        0x18, 0x45, 0x84, 0xb7, 0x1a, 0x71, 0x77, 0x51, 0x64, 0xd6, 0x56, 0x65, 0x26, 0x10, 0x65, 0xa6,
+        0x18, 0x69, 0xa6, 0x71, 0x67, 0x18, 0x17, 0x7b, 0x47, 0xf1, 0x94, 0xe9, 0x17, 0x91, 0xaa, 0xbb,
+        0xac, 0xea, 0x92, 0xb9, 0xeb, 0x83, 0xb8, 0xec, 0x78, 0xc2, 0x7c, 0x69, 0xbe, 0xfc, 0x11, 0xc0,
+        0xca, 0xef, 0xb4, 0x9b, 0x04, 0x97, 0xf9, 0xbd, 0x9c, 0x28, 0x4b, 0x82, 0xf8, 0x67, 0x70, 0x17,
+        0x3b, 0x73, 0x26, 0x0d, 0x64, 0xf6, 0x11, 0x63, 0xa6, 0x32, 0x63, 0x96, 0xe7, 0x68, 0x36, 0xc2,
+        0x83, 0x58, 0x07, 0x80, 0xb9, 0x1b, 0x92, 0xa8, 0xed, 0xa8, 0x6a, 0x5e, 0xa5, 0xeb, 0x35, 0xae,
+        0xdb, 0x2b, 0xb5, 0xcb, 0x5a, 0xb5, 0xba, 0x52, 0xab, 0xaa, 0x80, 0x93, 0xb9, 0x57, 0x95, 0x77,
+        0xd7, 0x7d, 0x78, 0x16, 0x64, 0x96, 0x63, 0x66, 0x04, 0xfe, 0x56, 0x75, 0x28, 0x47, 0x54, 0x6b,
+        0x46, 0x85, 0x03, 0x4b, 0xc4, 0xf7, 0x59, 0xd5, 0x77, 0x57, 0x56, 0xe6, 0x6e, 0xe6, 0xb0, 0x80,
+        0x67, 0xdc, 0x7e, 0x89, 0x80, 0x91, 0x99, 0x54, 0x9b, 0xe9, 0xc1, 0x9b, 0x99, 0x80, 0x9c, 0xa9,
+        0x87, 0x89, 0x98, 0xc9, 0x8d, 0x07, 0x8e, 0x77, 0x17, 0xb3, 0x60, 0x76, 0x49, 0x64, 0x94, 0x82,
+        0x4d, 0xe4, 0x9d, 0x3e, 0x54, 0x01, 0x40, 0x83, 0xdc, 0x39, 0x13, 0xd3, 0x4a, 0x54, 0x8b, 0x48,
+        0xe5, 0x64, 0x57, 0xe5, 0x3f, 0x72, 0xf6, 0xef, 0x6f, 0x68, 0x94, 0x83, 0x68, 0x76, 0x9b, 0xe9,
+        0xa2, 0x99, 0xd9, 0xcb, 0xa1, 0x79, 0xdc, 0x9b, 0x49, 0xb1, 0x9b, 0x68, 0xed, 0x8e, 0x99, 0x28,
+        0x88, 0xb8, 0xbe, 0x8b, 0xf7, 0x38, 0x79, 0x77, 0x50, 0x5d, 0x96, 0x16, 0x61, 0x65, 0x11, 0x4e,
+        0x55, 0x22, 0x4a, 0x04, 0xbc, 0x4b, 0xd4, 0xa4, 0x4c, 0x94, 0x87, 0x5b, 0xf5, 0xac, 0x5a, 0x77,
+        0x3b, 0x6c, 0x37, 0x00, 0x8f, 0x18, 0xc3, 0x8c, 0x49, 0xe5, 0x9f, 0xe9, 0xc8, 0xb0, 0xea, 0xf9,
+        0xaf, 0x7b, 0x3d, 0xb1, 0x2b, 0x51, 0xae, 0x4a, 0xfa, 0xae, 0xe9, 0x7c, 0x9f, 0x79, 0xb5, 0x85,
+        0x68, 0x78, 0x87, 0xb7, 0x3f, 0x73, 0x97, 0x7e, 0x65, 0xd6, 0x67, 0x66, 0x86, 0x0b, 0x65, 0x76,
+        0x14, 0x67, 0x76, 0x53, 0x65, 0xb7, 0xf5, 0x78, 0xa7, 0xcc, 0x92, 0x18, 0xed, 0x8e, 0xca, 0x9b,
+        0xaa, 0x7a, 0x60, 0xb8, 0x3b, 0x69, 0xb6, 0xec, 0x75, 0xc2, 0x4c, 0x62, 0xbf, 0xbc, 0x22, 0xc2,
+        0x1b, 0x1b, 0xb6, 0x6b, 0x2a, 0x9b, 0x39, 0xe9, 0x9f, 0x08, 0x71, 0x85, 0x48, 0x96, 0x71, 0xe7,
+        0x53, 0x75, 0x76, 0x1d, 0x65, 0xb6, 0x1a, 0x62, 0x96, 0x2a, 0x62, 0xe6, 0xc2, 0x66, 0x76, 0xa2,
+        0x80, 0x27, 0xde, 0x7d, 0xf8, 0xe6, 0x8f, 0xe8, 0xc0, 0xa6, 0x8a, 0x37, 0xa3, 0x7b, 0x28, 0xad,
+        0x9b, 0x18, 0xb6, 0x5b, 0x58, 0xb5, 0xda, 0x70, 0xad, 0xaa, 0x93, 0x96, 0xa9, 0x7f, 0x98, 0x58,
+        0x01, 0x80, 0x78, 0x44, 0x66, 0xe6, 0x90, 0x68, 0x95, 0x1b, 0x58, 0x35, 0x44, 0x47, 0x54, 0x68,
+        0x46, 0xe4, 0xee, 0x4a, 0x94, 0xe7, 0x57, 0x95, 0x4d, 0x54, 0xe6, 0xae, 0x6b, 0xf6, 0x7f, 0x7d,
+        0xc7, 0xb4, 0x7b, 0x09, 0x63, 0x8f, 0xd9, 0x38, 0x9b, 0x19, 0xb4, 0x9b, 0x29, 0x92, 0x9c, 0xf9,
+        0x95, 0x8b, 0xf8, 0xeb, 0x8f, 0x17, 0xc6, 0x79, 0xe7, 0xe0, 0x63, 0x76, 0x79, 0x67, 0x94, 0xa4,
+        0x50, 0x34, 0xc3, 0x3f, 0xa4, 0x15, 0x41, 0xb3, 0xd6, 0x38, 0xe3, 0xce, 0x48, 0x24, 0x70, 0x46,
+        0x85, 0x3b, 0x54, 0xc5, 0x12, 0x6f, 0xd6, 0xc2, 0x6c, 0x58, 0x6c, 0x80, 0x88, 0x49, 0x9a, 0x59,
+        0x82, 0x98, 0x19, 0xd0, 0xa1, 0x79, 0xd4, 0x9c, 0xa9, 0xcc, 0x9d, 0x19, 0x15, 0x90, 0xd9, 0x50,
+        0x8a, 0x98, 0xdb, 0x8e, 0x17, 0x60, 0x7c, 0x47, 0x7f, 0x5f, 0xf6, 0x3a, 0x63, 0xd5, 0x2f, 0x50,
+        0x55, 0x42, 0x4a, 0x84, 0xc5, 0x4c, 0x04, 0x97, 0x4b, 0xc4, 0x79, 0x5a, 0x25, 0x87, 0x58, 0xf7,
+        0x10, 0x69, 0x86, 0xda, 0x8c, 0x88, 0x96, 0x89, 0x49, 0xca, 0x9d, 0xf9, 0xa0, 0xaf, 0xba, 0xe4,
+        0xae, 0x3b, 0x43, 0xb1, 0x4b, 0x54, 0xb0, 0x0b, 0x0f, 0xb1, 0x19, 0xa6, 0xa2, 0x79, 0xe2, 0x88,
+        0x08, 0xa1, 0x8a, 0x57, 0x69, 0x76, 0x27, 0xa2, 0x67, 0x16, 0x82, 0x67, 0xe6, 0x06, 0x65, 0x56,
+        0x14, 0x66, 0x56, 0x3e, 0x64, 0x67, 0xc9, 0x76, 0xa7, 0xa8, 0x8f, 0x08, 0xc5, 0x8c, 0x3a, 0x72,
+        0xa7, 0xda, 0x3c, 0xb6, 0x7b, 0x53, 0xb4, 0xec, 0x70, 0xc1, 0xac, 0x57, 0xc1, 0x0c, 0x2d, 0xc3,
+        0x0b, 0x38, 0xb8, 0xcb, 0x4f, 0x9d, 0xba, 0x1d, 0xa1, 0x88, 0xaa, 0x88, 0x48, 0xc5, 0x74, 0x77,
+        0x79, 0x77, 0x86, 0x28, 0x66, 0x76, 0x2c, 0x62, 0x46, 0x25, 0x62, 0x86, 0xad, 0x64, 0x76, 0x86,
+        0x7d, 0x87, 0xb4, 0x7a, 0xa8, 0xbb, 0x8d, 0x38, 0x93, 0xa4, 0x2a, 0x0f, 0xa0, 0xfb, 0x16, 0xac,
+        0x1b, 0x04, 0xb6, 0x9b, 0x5f, 0xb5, 0x9a, 0x84, 0xae, 0xfa, 0xa9, 0x98, 0xe9, 0xa4, 0x9a, 0x78,
+        0x2c, 0x83, 0x28, 0x75, 0x69, 0x56, 0xb7, 0x6b, 0x85, 0x35, 0x59, 0xf5, 0x5f, 0x47, 0x94, 0x74,
+        0x47, 0x04, 0xdf, 0x49, 0x84, 0xd5, 0x55, 0x25, 0x2c, 0x52, 0x86, 0x88, 0x68, 0xe6, 0x56, 0x7a,
+        0xe7, 0x80, 0x78, 0x09, 0x3d, 0x8d, 0x39, 0x13, 0x9a, 0x79, 0xa5, 0x9a, 0x29, 0x9f, 0x9d, 0x99,
+        0x94, 0x8d, 0xc9, 0x0b, 0x91, 0x07, 0xee, 0x7c, 0x68, 0x05, 0x66, 0x96, 0xac, 0x6a, 0xb4, 0xce,
+        0x52, 0xc4, 0xe8, 0x40, 0xb4, 0x29, 0x42, 0xe3, 0xd6, 0x38, 0xe3, 0xce, 0x46, 0xa4, 0x57, 0x45,
+        0x85, 0x11, 0x52, 0x94, 0xea, 0x6c, 0x96, 0x95, 0x69, 0x78, 0x43, 0x7d, 0xc8, 0x1b, 0x98, 0xd9,
+        0x69, 0x96, 0x69, 0xc8, 0xa0, 0xf9, 0xd7, 0x9d, 0xf9, 0xdc, 0x9e, 0x39, 0x3a, 0x93, 0x89, 0x76,
+        0x8d, 0x39, 0x03, 0x8f, 0xc7, 0x83, 0x7e, 0x87, 0xa7, 0x62, 0x76, 0x61, 0x66, 0xa5, 0x4d, 0x52,
+        0x25, 0x61, 0x4b, 0x34, 0xca, 0x4c, 0xd4, 0x8a, 0x4b, 0x64, 0x73, 0x58, 0x95, 0x6e, 0x57, 0x06,
+        0xe4, 0x67, 0x26, 0xaf, 0x89, 0xd8, 0x70, 0x87, 0x09, 0xa7, 0x9b, 0xf9, 0x7f, 0xaf, 0x0a, 0xd5,
+        0xad, 0x6b, 0x52, 0xb1, 0x9b, 0x59, 0xb1, 0x6b, 0x27, 0xb2, 0x79, 0xcb, 0xa4, 0x6a, 0x07, 0x8a,
+        0xa8, 0xd0, 0x8c, 0xc7, 0x8c, 0x78, 0x67, 0xc9, 0x68, 0xb6, 0x96, 0x69, 0x86, 0x0e, 0x66, 0x56,
+        0x20, 0x64, 0xe6, 0x30, 0x63, 0x37, 0xa5, 0x74, 0x67, 0x88, 0x8c, 0x78, 0x94, 0x89, 0x4a, 0x43,
+        0xa5, 0x4a, 0x13, 0xb4, 0xeb, 0x30, 0xb3, 0x6c, 0x65, 0xc0, 0xec, 0x4f, 0xc2, 0x0c, 0x3e, 0xc3,
+        0x5b, 0x50, 0xba, 0x9b, 0x6a, 0xa0, 0x9a, 0x40, 0xa4, 0x88, 0xcd, 0x8a, 0xd8, 0xeb, 0x76, 0x57,
+        0x9f, 0x79, 0xb6, 0x33, 0x67, 0xe6, 0x3b, 0x61, 0xa6, 0x23, 0x61, 0xa6, 0x91, 0x62, 0xc6, 0x6f,
+        0x7a, 0xa7, 0x8e, 0x78, 0x88, 0x90, 0x89, 0xe8, 0x62, 0xa1, 0x99, 0xe5, 0x9e, 0x8a, 0xf9, 0xaa,
+        0x8a, 0xee, 0xb6, 0xab, 0x5c, 0xb5, 0x5a, 0x9f, 0xaf, 0xea, 0xbe, 0x9b, 0x49, 0xc5, 0x9c, 0x98,
+        0x59, 0x85, 0xe8, 0x9a, 0x6b, 0xf6, 0xe2, 0x6e, 0x05, 0x4f, 0x5b, 0xb5, 0x79, 0x48, 0x04, 0x7b,
+        0x48, 0x34, 0xcc, 0x48, 0xb4, 0xc3, 0x52, 0xf5, 0x0f, 0x50, 0x96, 0x5a, 0x66, 0x66, 0x24, 0x78,
+        0x47, 0x58, 0x75, 0xc9, 0x24, 0x8b, 0x88, 0xf0, 0x99, 0xd9, 0x97, 0x98, 0xf9, 0xa3, 0x9d, 0xe9,
+        0x9d, 0x8f, 0xb9, 0x26, 0x92, 0x58, 0x10, 0x7f, 0x78, 0x34, 0x69, 0x46, 0xd5, 0x6d, 0x04, 0xed,
+        0x55, 0x25, 0x0d, 0x41, 0xf4, 0x46, 0x44, 0x43, 0xd6, 0x39, 0x13, 0xcf, 0x45, 0x84, 0x42, 0x44,
+        0x04, 0xeb, 0x50, 0x04, 0xc7, 0x6a, 0x06, 0x65, 0x66, 0xb8, 0x1f, 0x7b, 0x47, 0xf3, 0x97, 0x89,
+        0x52, 0x94, 0xd9, 0xc4, 0xa0, 0x69, 0xca, 0x9e, 0xb9, 0xeb, 0x9e, 0xf9, 0x5e, 0x95, 0x49, 0x95,
+        0x8e, 0xc9, 0x24, 0x91, 0xd7, 0xb4, 0x81, 0x07, 0xd6, 0x65, 0x26, 0x8c, 0x69, 0x15, 0x6b, 0x53,
+        0xf5, 0x81, 0x4c, 0x44, 0xd8, 0x4d, 0x84, 0x7f, 0x4a, 0xa4, 0x6f, 0x56, 0x85, 0x52, 0x55, 0x26,
+        0xc0, 0x64, 0xc6, 0x8f, 0x87, 0x18, 0x47, 0x84, 0x59, 0x86, 0x99, 0xf9, 0x5e, 0xae, 0x2a, 0xc2,
+        0xac, 0x6b, 0x4d, 0xb1, 0x9b, 0x58, 0xb3, 0x0b, 0x3d, 0xb3, 0x99, 0xf3, 0xa6, 0xfa, 0x2a, 0x8d,
+        0x98, 0xf1, 0x8f, 0x87, 0xae, 0x7b, 0x37, 0xf2, 0x6a, 0x56, 0xb0, 0x6a, 0x66, 0x0c, 0x66, 0x06,
+        0x25, 0x63, 0xd6, 0x21, 0x62, 0x47, 0x86, 0x71, 0xf7, 0x64, 0x89, 0xc8, 0x6b, 0x86, 0x6a, 0x1c,
+        0xa2, 0x79, 0xe5, 0xb3, 0x3b, 0x16, 0xb1, 0x3c, 0x5d, 0xc0, 0x7c, 0x43, 0xc2, 0x1c, 0x44, 0xc4,
+        0x3b, 0x6f, 0xbc, 0x0b, 0x8c, 0xa3, 0x0a, 0x6d, 0xa7, 0x18, 0xf9, 0x8d, 0x79, 0x13, 0x78, 0x77,
+        0xc1, 0x7b, 0xd6, 0x44, 0x69, 0x26, 0x51, 0x61, 0x56, 0x22, 0x61, 0xc6, 0x77, 0x61, 0x76, 0x5a,
+        0x78, 0xc7, 0x63, 0x76, 0x68, 0x64, 0x87, 0x28, 0x3b, 0x9f, 0x59, 0xc0, 0x9c, 0xca, 0xe5, 0xa9,
+        0x4a, 0xd6, 0xb6, 0x6b, 0x55, 0xb5, 0x0a, 0xab, 0xb1, 0x4a, 0xd0, 0x9d, 0x79, 0xe6, 0x9f, 0x18,
+        0x88, 0x88, 0x98, 0xce, 0x6e, 0x77, 0x0e, 0x70, 0x25, 0x65, 0x5d, 0x75, 0x9b, 0x48, 0x94, 0x8b,
+        0x48, 0xb4, 0xc2, 0x47, 0xe4, 0xc2, 0x51, 0x24, 0xf4, 0x4e, 0xc6, 0x36, 0x64, 0x16, 0x01, 0x75,
+        0x87, 0x25, 0x73, 0x69, 0x04, 0x88, 0xc8, 0xcf, 0x98, 0x59, 0x84, 0x98, 0x89, 0xae, 0x9e, 0x39,
+        0x9d, 0x91, 0x09, 0x3c, 0x94, 0x38, 0x3b, 0x81, 0xc8, 0x59, 0x6c, 0x17, 0x03, 0x70, 0x05, 0x1d,
+        0x57, 0x35, 0x39, 0x43, 0x54, 0x56, 0x46, 0x03, 0xd2, 0x39, 0x33, 0xd3, 0x43, 0xd4, 0x34, 0x43,
+        0x34, 0xcc, 0x4e, 0x54, 0x9f, 0x67, 0x26, 0x3b, 0x63, 0xd7, 0xef, 0x78, 0xb7, 0xcc, 0x95, 0xa9,
+        0x30, 0x92, 0xf9, 0xba, 0x9f, 0xc9, 0xc1, 0x9f, 0x99, 0xf4, 0x9f, 0xa9, 0x80, 0x97, 0x29, 0xb4,
+        0x90, 0xd9, 0x3a, 0x93, 0x57, 0xd8, 0x83, 0xb7, 0xf9, 0x67, 0x56, 0xb1, 0x6b, 0xc5, 0x86, 0x55,
+        0xf5, 0x9d, 0x4c, 0x84, 0xee, 0x4e, 0xd4, 0x74, 0x4a, 0xb4, 0x6b, 0x55, 0x25, 0x40, 0x53, 0x96,
+        0x91, 0x62, 0x46, 0x68, 0x84, 0xb8, 0x20, 0x81, 0xe9, 0x5f, 0x97, 0xa9, 0x41, 0xac, 0xda, 0xab,
+        0xaa, 0xeb, 0x51, 0xb1, 0xcb, 0x56, 0xb4, 0x5b, 0x48, 0xb4, 0x9a, 0x13, 0xa8, 0x8a, 0x4b, 0x90,
+        0x19, 0x1f, 0x91, 0xf7, 0xda, 0x7c, 0xe8, 0x0d, 0x6b, 0x96, 0xcd, 0x6c, 0xe6, 0x1a, 0x66, 0xa6,
+        0x2c, 0x63, 0x06, 0x18, 0x61, 0xf7, 0x68, 0x70, 0x77, 0x46, 0x87, 0xc8, 0x48, 0x84, 0x89, 0xf5,
+        0x9f, 0xf9, 0xc6, 0xb1, 0x8a, 0xf6, 0xaf, 0x3c, 0x51, 0xbe, 0xfc, 0x35, 0xc2, 0xcc, 0x47, 0xc4,
+        0x4b, 0x8f, 0xbd, 0xeb, 0xa1, 0xa5, 0x4a, 0x8e, 0xa9, 0x49, 0x1a, 0x8f, 0xf9, 0x42, 0x7a, 0x37,
+        0xe6, 0x7d, 0xd6, 0x58, 0x6a, 0x16, 0x62, 0x61, 0xa6, 0x1d, 0x62, 0x16, 0x62, 0x60, 0x86, 0x45,
+        0x76, 0xa7, 0x46, 0x74, 0x78, 0x3e, 0x85, 0x18, 0x13, 0x9d, 0x69, 0x9a, 0x99, 0xca, 0xcc, 0xa7,
+        0xaa, 0xb9, 0xb5, 0xdb, 0x52, 0xb4, 0x8a, 0xba, 0xb1, 0x8a, 0xd8, 0x9f, 0x1a, 0x0a, 0xa0, 0x98,
+        0xb5, 0x8b, 0x48, 0xf1, 0x70, 0xe7, 0x31, 0x72, 0xe5, 0x89, 0x5f, 0xd5, 0xb3, 0x49, 0x64, 0x97,
+        0x4a, 0x14, 0xba, 0x47, 0xa4, 0xba, 0x4f, 0xb4, 0xd6, 0x4d, 0x46, 0x0c, 0x61, 0x85, 0xd8, 0x72,
+        0xf7, 0x08, 0x70, 0x58, 0xdf, 0x86, 0xa8, 0xa7, 0x97, 0x79, 0x77, 0x96, 0xc9, 0xab, 0x9d, 0xe9,
+        0x99, 0x92, 0xe9, 0x4c, 0x95, 0x28, 0x5f, 0x84, 0x28, 0x7c, 0x6e, 0x67, 0x2d, 0x72, 0xd5, 0x3a,
+        0x59, 0xb5, 0x5d, 0x44, 0xd4, 0x73, 0x47, 0x73, 0xd8, 0x39, 0x63, 0xd9, 0x42, 0xf4, 0x22, 0x42,
+        0x14, 0xa4, 0x4c, 0x54, 0x84, 0x64, 0xb6, 0x16, 0x61, 0x77, 0xc8, 0x76, 0x37, 0xa1, 0x93, 0xe9,
+        0x14, 0x90, 0x99, 0xaf, 0x9f, 0x29, 0xb0, 0xa0, 0x59, 0xfc, 0xa0, 0x49, 0x9f, 0x99, 0x29, 0xd2,
+        0x92, 0x59, 0x4d, 0x94, 0xf7, 0xff, 0x86, 0x28, 0x17, 0x69, 0xc6, 0xde, 0x6d, 0xe5, 0xa8, 0x57,
+        0xa5, 0xbd, 0x4d, 0x64, 0xfd, 0x4f, 0x84, 0x73, 0x4a, 0x34, 0x6c, 0x53, 0xc5, 0x2c, 0x53, 0x16,
+        0x72, 0x60, 0x46, 0x45, 0x82, 0xd7, 0xf7, 0x7f, 0xb9, 0x3b, 0x95, 0xb9, 0x13, 0xab, 0xaa, 0x93,
+        0xa9, 0xcb, 0x46, 0xb0, 0xcb, 0x4d, 0xb5, 0x0b, 0x5e, 0xb5, 0x7a, 0x2e, 0xaa, 0x8a, 0x6e, 0x92,
+        0x59, 0x45, 0x94, 0x97, 0xfd, 0x7f, 0xd8, 0x36, 0x6d, 0x66, 0xeb, 0x6e, 0x56, 0x1f, 0x67, 0x66,
+        0x3c, 0x62, 0x86, 0x0d, 0x61, 0x07, 0x4a, 0x6f, 0x27, 0x2a, 0x84, 0xf8, 0x1e, 0x81, 0xf9, 0xd0,
+        0x9d, 0x89, 0x9c, 0xaf, 0xaa, 0xd7, 0xad, 0x4c, 0x44, 0xbe, 0x7c, 0x24, 0xc3, 0x7c, 0x48, 0xc4,
+        0x9b, 0xa7, 0xbf, 0x1b, 0xb2, 0xa7, 0xca, 0xaf, 0xab, 0x39, 0x41, 0x92, 0x99, 0x69, 0x7c, 0x58,
+        0x09, 0x80, 0x56, 0x6d, 0x6b, 0xd6, 0x81, 0x61, 0x96, 0x23, 0x62, 0x66, 0x55, 0x5f, 0x56, 0x36,
+        0x74, 0x67, 0x23, 0x72, 0x28, 0x14, 0x82, 0x77, 0xee, 0x9b, 0x09, 0x77, 0x97, 0x8a, 0xb5, 0xa5,
+        0xea, 0x97, 0xb5, 0xdb, 0x42, 0xb3, 0xfa, 0xc8, 0xb2, 0x9a, 0xdf, 0xa1, 0x4a, 0x23, 0xa2, 0x88,
+        0xd5, 0x8d, 0x89, 0x1a, 0x73, 0x97, 0x58, 0x75, 0x85, 0xa2, 0x61, 0x75, 0xd1, 0x4a, 0x24, 0xaa,
+        0x4a, 0x54, 0xb5, 0x47, 0x74, 0xaf, 0x4e, 0x14, 0xc4, 0x4b, 0xa5, 0xe3, 0x5f, 0x95, 0xb9, 0x70,
+        0xc6, 0xd9, 0x6d, 0xa8, 0xbd, 0x84, 0xa8, 0x8b, 0x96, 0x19, 0x5d, 0x95, 0x89, 0xab, 0x9d, 0xb9,
+        0x99, 0x93, 0xa9, 0x59, 0x96, 0x08, 0x86, 0x85, 0xb8, 0x9c, 0x71, 0x27, 0x5a, 0x75, 0x45, 0x62,
+        0x5b, 0x85, 0x85, 0x46, 0x74, 0x8e, 0x49, 0x23, 0xd6, 0x3a, 0x73, 0xde, 0x42, 0x24, 0x19, 0x41,
+        0x94, 0x90, 0x4a, 0xb4, 0x67, 0x62, 0x65, 0xf1, 0x5f, 0x27, 0xa9, 0x73, 0xa7, 0x79, 0x91, 0xc8,
+        0xf5, 0x8e, 0xa9, 0xa1, 0x9e, 0x59, 0x9d, 0xa0, 0xfa, 0x02, 0xa0, 0x89, 0xb9, 0x9a, 0x39, 0xea,
+        0x93, 0x89, 0x6a, 0x96, 0xc8, 0x20, 0x87, 0xc8, 0x3f, 0x6c, 0x46, 0xfa, 0x70, 0x65, 0xc3, 0x59,
+        0xb5, 0xdc, 0x4e, 0x95, 0x14, 0x51, 0x14, 0x72, 0x4a, 0x84, 0x6a, 0x52, 0x75, 0x1c, 0x51, 0xd6,
+        0x59, 0x5e, 0x76, 0x28, 0x80, 0x37, 0xd1, 0x7c, 0xc9, 0x1c, 0x93, 0xa8, 0xf4, 0xaa, 0x9a, 0x82,
+        0xa7, 0xfb, 0x4a, 0xb0, 0xdb, 0x4b, 0xb6, 0x1b, 0x6c, 0xb6, 0x7a, 0x4f, 0xac, 0x1a, 0x85, 0x94,
+        0x99, 0x6a, 0x96, 0xb8, 0x21, 0x81, 0xc8, 0x57, 0x6e, 0xb7, 0x02, 0x6f, 0xf6, 0x27, 0x68, 0x06,
+        0x46, 0x62, 0x16, 0x05, 0x60, 0x97, 0x31, 0x6d, 0x67, 0x15, 0x82, 0xb7, 0xfe, 0x7f, 0xc9, 0xac,
+        0x9b, 0x99, 0x79, 0xad, 0xda, 0xb4, 0xab, 0x6c, 0x2f, 0xbd, 0x1c, 0x13, 0xc3, 0x9c, 0x45, 0xc4,
+        0x5b, 0xba, 0xc0, 0xab, 0xc2, 0xa9, 0xba, 0xcc, 0xad, 0x29, 0x6f, 0x94, 0xd9, 0x8d, 0x7e, 0xa8,
+        0x25, 0x82, 0x36, 0x83, 0x6c, 0xd6, 0x93, 0x61, 0x96, 0x24, 0x62, 0x76, 0x3f, 0x5e, 0xf6, 0x2a,
+        0x72, 0xd7, 0x0a, 0x70, 0x57, 0xed, 0x80, 0x27, 0xc6, 0x98, 0xb9, 0x51, 0x95, 0x3a, 0x9f, 0xa4,
+        0x5a, 0x82, 0xb5, 0x1b, 0x3c, 0xb2, 0xfa, 0xd7, 0xb2, 0xaa, 0xee, 0xa2, 0xfa, 0x42, 0xa3, 0xc8,
+        0xfb, 0x8f, 0x99, 0x37, 0x75, 0xb7, 0x7f, 0x77, 0xd5, 0xbc, 0x62, 0xe5, 0xf2, 0x4b, 0x24, 0xb4,
+        0x4b, 0x94, 0xb2, 0x47, 0x04, 0xb0, 0x4c, 0x94, 0xb1, 0x4a, 0xe5, 0xc4, 0x5d, 0x15, 0x95, 0x6e,
+        0x16, 0xb0, 0x6b, 0x78, 0x98, 0x82, 0x28, 0x61, 0x95, 0x09, 0x43, 0x94, 0x59, 0xad, 0x9d, 0x59,
+        0x97, 0x94, 0xc9, 0x73, 0x96, 0xf8, 0x9f, 0x87, 0xd8, 0xba, 0x73, 0xb7, 0x7c, 0x77, 0x45, 0x81,
+        0x5e, 0x85, 0xa7, 0x47, 0xd4, 0xa7, 0x4a, 0xd3, 0xe4, 0x3a, 0xd3, 0xef, 0x41, 0xa4, 0x0f, 0x40,
+        0xc4, 0x73, 0x48, 0xe4, 0x4c, 0x5f, 0x85, 0xcc, 0x5c, 0xa7, 0x7a, 0x71, 0x17, 0x53, 0x8f, 0xe8,
+        0xd0, 0x8d, 0x39, 0x97, 0x9d, 0x69, 0x92, 0xa1, 0x7a, 0x04, 0xa0, 0x79, 0xd4, 0x9c, 0x39, 0xfd,
+        0x95, 0x49, 0x75, 0x97, 0xb8, 0x3c, 0x89, 0xa8, 0x5e, 0x6e, 0x27, 0x21, 0x72, 0x25, 0xdd, 0x5c,
+        0x16, 0x00, 0x4f, 0x25, 0x21, 0x51, 0xa4, 0x75, 0x4a, 0xc4, 0x65, 0x51, 0x85, 0x09, 0x50, 0xa6,
+        0x37, 0x5c, 0xb6, 0x07, 0x7d, 0xb7, 0xb3, 0x7b, 0x08, 0xfd, 0x91, 0x38, 0xd7, 0xa9, 0x0a, 0x62,
+        0xa6, 0x7b, 0x47, 0xb0, 0x4b, 0x3f, 0xb6, 0xdb, 0x72, 0xb6, 0xca, 0x6a, 0xad, 0xaa, 0x99, 0x96,
+        0xe9, 0x8e, 0x98, 0xa8, 0x41, 0x84, 0x08, 0x86, 0x70, 0x07, 0x21, 0x71, 0x76, 0x34, 0x68, 0xc6,
+        0x51, 0x61, 0x26, 0x02, 0x60, 0x37, 0x20, 0x6c, 0x57, 0x06, 0x80, 0x67, 0xe5, 0x7e, 0x69, 0x88,
+        0x99, 0x29, 0x55, 0xac, 0x0a, 0x9c, 0xa9, 0x9c, 0x28, 0xbc, 0x0c, 0x06, 0xc3, 0x8c, 0x48, 0xc4,
+        0xab, 0xd1, 0xc1, 0x0b, 0xd4, 0xab, 0xaa, 0xed, 0xaf, 0x09, 0x98, 0x96, 0xd9, 0xb2, 0x80, 0x98,
+        0x43, 0x84, 0x56, 0x95, 0x6e, 0x36, 0xab, 0x61, 0xa6, 0x2d, 0x62, 0xf6, 0x35, 0x5d, 0xe6, 0x22,
+        0x71, 0x06, 0xf2, 0x6e, 0xe7, 0xd0, 0x7d, 0xb7, 0xa4, 0x96, 0xb9, 0x2f, 0x93, 0x3a, 0x81, 0xa2,
+        0x2a, 0x64, 0xb4, 0x4b, 0x2f, 0xb2, 0xca, 0xdb, 0xb3, 0x3a, 0xf0, 0xa4, 0x1a, 0x50, 0xa5, 0x89,
+        0x1c, 0x91, 0x99, 0x5e, 0x77, 0xf7, 0xa1, 0x7a, 0x35, 0xdd, 0x65, 0x06, 0x12, 0x4b, 0xb4, 0xc7,
+        0x4c, 0xb4, 0xb1, 0x47, 0x64, 0xad, 0x4b, 0x34, 0xa1, 0x49, 0xd5, 0xa3, 0x5b, 0x45, 0x79, 0x6b,
+        0x96, 0x8b, 0x68, 0xf8, 0x7d, 0x80, 0x68, 0x46, 0x93, 0xc9, 0x2f, 0x92, 0xa9, 0xae, 0x9d, 0x69,
+        0x95, 0x96, 0x29, 0x78, 0x97, 0x98, 0xc0, 0x89, 0x88, 0xd6, 0x75, 0xe7, 0x9a, 0x79, 0xb5, 0xa5,
+        0x60, 0x85, 0xc6, 0x49, 0x54, 0xc2, 0x4c, 0xa3, 0xee, 0x3b, 0x13, 0xf7, 0x40, 0xc4, 0x08, 0x40,
+        0xb4, 0x4e, 0x47, 0x74, 0x37, 0x5d, 0x85, 0xa5, 0x5a, 0x77, 0x58, 0x6e, 0xd7, 0x2f, 0x8e, 0x18,
+        0xb7, 0x8b, 0x19, 0x8a, 0x9c, 0x19, 0x85, 0xa1, 0xda, 0x0b, 0xa0, 0xa9, 0xe5, 0x9c, 0xaa, 0x09,
+        0x96, 0x59, 0x90, 0x99, 0x48, 0x5e, 0x8b, 0xc8, 0x79, 0x70, 0x47, 0x40, 0x74, 0x66, 0x01, 0x5d,
+        0xd6, 0x19, 0x50, 0xa5, 0x33, 0x53, 0x44, 0x71, 0x4a, 0x84, 0x6e, 0x50, 0x74, 0xfa, 0x4f, 0xa6,
+        0x1c, 0x5b, 0x15, 0xf2, 0x7b, 0xd7, 0x96, 0x78, 0xb8, 0xdd, 0x8f, 0x78, 0xb3, 0xa7, 0xaa, 0x4f,
+        0xa4, 0xcb, 0x40, 0xaf, 0x6b, 0x37, 0xb7, 0x9b, 0x7b, 0xb7, 0x9a, 0x7f, 0xaf, 0x6a, 0xb0, 0x98,
+        0xe9, 0xa6, 0x9a, 0xe8, 0x5e, 0x85, 0xe8, 0x9f, 0x71, 0xc7, 0x3b, 0x73, 0x96, 0x3a, 0x69, 0x96,
+        0x61, 0x60, 0xb6, 0x01, 0x60, 0x87, 0x04, 0x6b, 0x36, 0xf4, 0x7e, 0xc7, 0xc5, 0x7b, 0x99, 0x64,
+        0x97, 0x39, 0x32, 0xaa, 0x2a, 0x7b, 0xa7, 0x6c, 0x0f, 0xba, 0xeb, 0xef, 0xc3, 0xcc, 0x46, 0xc4,
+        0x3b, 0xd8, 0xc2, 0x5b, 0xe2, 0xad, 0x1b, 0x0d, 0xb0, 0xa9, 0xb2, 0x99, 0x99, 0xd2, 0x82, 0x78,
+        0x64, 0x86, 0x36, 0xa7, 0x6f, 0xf6, 0xbe, 0x62, 0x16, 0x33, 0x63, 0x96, 0x28, 0x5d, 0x96, 0x19,
+        0x6f, 0x46, 0xd4, 0x6d, 0x77, 0xa8, 0x7b, 0xf7, 0x82, 0x94, 0x79, 0x10, 0x91, 0x2a, 0x6d, 0xa0,
+        0xea, 0x4b, 0xb3, 0x9b, 0x20, 0xb1, 0xda, 0xdf, 0xb3, 0x3a, 0xf4, 0xa5, 0xaa, 0x61, 0xa6, 0xa9,
+        0x3a, 0x93, 0xf9, 0x74, 0x79, 0xe7, 0xcc, 0x7c, 0x05, 0xf8, 0x66, 0xf6, 0x30, 0x4c, 0xe4, 0xdb,
+        0x4e, 0x04, 0xa9, 0x47, 0x34, 0xb5, 0x4a, 0x84, 0x91, 0x48, 0xf5, 0x88, 0x59, 0x85, 0x55, 0x69,
+        0x76, 0x6a, 0x67, 0x48, 0x5b, 0x7e, 0x18, 0x28, 0x92, 0xa9, 0x16, 0x91, 0x79, 0xa0, 0x9c, 0xa9,
+        0x87, 0x96, 0x59, 0x84, 0x98, 0x68, 0xda, 0x8a, 0xc8, 0xf0, 0x77, 0x87, 0xc4, 0x7b, 0xe5, 0xc9,
+        0x62, 0x95, 0xee, 0x4a, 0xd4, 0xd6, 0x4d, 0xf3, 0xf3, 0x3c, 0x24, 0x04, 0x40, 0x64, 0x0e, 0x3f,
+        0xc4, 0x3f, 0x46, 0x14, 0x22, 0x5b, 0xd5, 0x82, 0x58, 0xb7, 0x34, 0x6c, 0xe7, 0x0d, 0x8c, 0x68,
+        0x96, 0x89, 0x59, 0x7b, 0x9b, 0x09, 0x6e, 0xa1, 0x6a, 0x06, 0xa0, 0xa9, 0xf2, 0x9d, 0xea, 0x1a,
+        0x97, 0xa9, 0xa1, 0x99, 0xd8, 0x78, 0x8d, 0x28, 0x92, 0x72, 0x37, 0x5d, 0x76, 0x26, 0x17, 0x5f,
+        0x36, 0x32, 0x51, 0xc5, 0x47, 0x54, 0x54, 0x78, 0x4a, 0xe4, 0x73, 0x4f, 0x74, 0xf3, 0x4f, 0x05,
+        0xff, 0x59, 0x35, 0xd7, 0x79, 0xd7, 0x69, 0x77, 0x38, 0xc4, 0x8d, 0x28, 0x9c, 0xa6, 0x8a, 0x38,
+        0xa3, 0xeb, 0x39, 0xaf, 0x3b, 0x2d, 0xb7, 0xeb, 0x7c, 0xb7, 0xca, 0x9a, 0xb0, 0x7a, 0xc7, 0x9b,
+        0x09, 0xc7, 0x9c, 0xa8, 0x7d, 0x87, 0xe8, 0xb8, 0x73, 0x77, 0x50, 0x74, 0xc6, 0x46, 0x6a, 0x66,
+        0x69, 0x61, 0x06, 0x02, 0x60, 0x66, 0xf4, 0x6a, 0x16, 0xe3, 0x7d, 0x07, 0xa3, 0x7a, 0x49, 0x42,
+        0x95, 0x09, 0x0e, 0xa8, 0x5a, 0x59, 0xa6, 0x1b, 0xff, 0xb9, 0xdb, 0xd3, 0xc3, 0x9c, 0x40, 0xc3,
+        0xfb, 0xeb, 0xc2, 0xab, 0xec, 0xaf, 0x0b, 0x21, 0xb2, 0x89, 0xd0, 0x9b, 0x09, 0xf1, 0x84, 0x78,
+        0x87, 0x88, 0x76, 0xbf, 0x71, 0x86, 0xd2, 0x62, 0x86, 0x3e, 0x64, 0x36, 0x1c, 0x5c, 0xe6, 0x11,
+        0x6e, 0x16, 0xc2, 0x6c, 0x07, 0x8c, 0x79, 0xf7, 0x5e, 0x92, 0x78, 0xe7, 0x8e, 0xca, 0x4d, 0x9e,
+        0xfa, 0x36, 0xb2, 0xfb, 0x10, 0xb0, 0xea, 0xe2, 0xb3, 0x8a, 0xfb, 0xa7, 0x0a, 0x7d, 0xa7, 0x69,
+        0x5a, 0x95, 0x59, 0x97, 0x7c, 0x37, 0xe7, 0x7e, 0x76, 0x17, 0x69, 0x16, 0x50, 0x4e, 0x14, 0xeb,
+        0x4f, 0x14, 0xac, 0x47, 0xa4, 0xb8, 0x49, 0x44, 0x7f, 0x48, 0x25, 0x68, 0x57, 0xe5, 0x3e, 0x67,
+        0xa6, 0x4c, 0x64, 0x88, 0x3e, 0x7c, 0x88, 0x07, 0x91, 0x59, 0x02, 0x8f, 0xc9, 0xa0, 0x9c, 0x19,
+        0x84, 0x97, 0x29, 0x8f, 0x99, 0x18, 0xf4, 0x8c, 0x89, 0x01, 0x79, 0xc7, 0xe1, 0x7d, 0xa5, 0xe5,
+        0x64, 0xb6, 0x13, 0x4d, 0x44, 0xf7, 0x4f, 0xb4, 0x06, 0x3c, 0xd4, 0x12, 0x40, 0x04, 0x02, 0x40,
+        0x24, 0x28, 0x45, 0x24, 0x12, 0x59, 0xd5, 0x69, 0x57, 0x07, 0x0f, 0x6a, 0x86, 0xeb, 0x8a, 0xc8,
+        0x7b, 0x87, 0x39, 0x67, 0x99, 0x99, 0x61, 0xa1, 0x8a, 0x03, 0xa0, 0x5a, 0x0d, 0x9e, 0xca, 0x29,
+        0x98, 0x79, 0xac, 0x9a, 0xd8, 0x94, 0x8e, 0xa8, 0xab, 0x74, 0x67, 0x81, 0x78, 0x26, 0x36, 0x61,
+        0x16, 0x51, 0x52, 0xc5, 0x56, 0x55, 0x34, 0x77, 0x4b, 0xa4, 0x73, 0x4f, 0x44, 0xe9, 0x4e, 0x85,
+        0xeb, 0x57, 0xe5, 0xc2, 0x77, 0xd7, 0x55, 0x75, 0x08, 0xa5, 0x8b, 0x38, 0x7a, 0xa5, 0x1a, 0x27,
+        0xa2, 0x7b, 0x2d, 0xae, 0xbb, 0x2a, 0xb8, 0x1b, 0x7d, 0xb7, 0xea, 0xa9, 0xb1, 0x7a, 0xdc, 0x9c,
+        0x79, 0xe4, 0x9e, 0x78, 0xa5, 0x8a, 0x38, 0xe4, 0x75, 0x77, 0x6b, 0x76, 0x76, 0x58, 0x6b, 0xa6,
+        0x79, 0x60, 0xa5, 0xff, 0x60, 0x36, 0xe4, 0x68, 0xc6, 0xd4, 0x7b, 0x97, 0x8c, 0x78, 0x69, 0x26,
+        0x93, 0x48, 0xf3, 0xa6, 0x8a, 0x3c, 0xa4, 0x5b, 0xf4, 0xb8, 0x5b, 0xca, 0xc3, 0x4c, 0x3f, 0xc3,
+        0xcb, 0xf4, 0xc3, 0x6b, 0xf8, 0xb0, 0x9b, 0x36, 0xb3, 0x79, 0xe9, 0x9d, 0x1a, 0x0d, 0x86, 0xb8,
+        0xaa, 0x8a, 0x16, 0xd7, 0x72, 0x96, 0xed, 0x63, 0x26, 0x46, 0x64, 0xb6, 0x15, 0x5c, 0x66, 0x08,
+        0x6c, 0x66, 0xab, 0x6a, 0xc7, 0x6d, 0x78, 0x07, 0x40, 0x90, 0x68, 0xce, 0x8d, 0x4a, 0x32, 0x9d,
+        0xda, 0x1b, 0xb2, 0x6b, 0x06, 0xb0, 0x1a, 0xea, 0xb3, 0x5a, 0xf8, 0xa7, 0xfa, 0x87, 0xa8, 0x79,
+        0x77, 0x97, 0x89, 0xaf, 0x7d, 0xd8, 0x05, 0x80, 0x26, 0x35, 0x6a, 0xd6, 0x6c, 0x4e, 0xf4, 0xff,
+        0x50, 0x14, 0xae, 0x47, 0xc4, 0xbf, 0x48, 0xa4, 0x79, 0x47, 0x25, 0x4e, 0x56, 0x55, 0x25, 0x65,
+        0xa6, 0x2d, 0x62, 0xe8, 0x1e, 0x7a, 0x67, 0xe8, 0x90, 0x18, 0xef, 0x8e, 0x59, 0x9d, 0x9c, 0x19,
+        0x79, 0x97, 0xc9, 0x93, 0x99, 0xb9, 0x10, 0x8d, 0x99, 0x13, 0x7b, 0x97, 0xfe, 0x7f, 0x46, 0x06,
+        0x66, 0xc6, 0x2c, 0x4e, 0x45, 0x11, 0x51, 0x44, 0x10, 0x3d, 0xd4, 0x1e, 0x40, 0x24, 0x04, 0x3f,
+        0xb4, 0x17, 0x43, 0xd4, 0x01, 0x58, 0x35, 0x4c, 0x55, 0x06, 0xf3, 0x68, 0x66, 0xc8, 0x89, 0x08,
+        0x5e, 0x85, 0x49, 0x59, 0x98, 0x99, 0x49, 0xa1, 0xc9, 0xfa, 0xa0, 0x6a, 0x13, 0x9f, 0x7a, 0x36,
+        0x99, 0x29, 0xba, 0x9b, 0x58, 0xad, 0x90, 0x48, 0xc6, 0x75, 0x87, 0xa3, 0x79, 0xe6, 0x4f, 0x62,
+        0xe6, 0x69, 0x53, 0xd5, 0x6b, 0x56, 0xb4, 0x84, 0x4b, 0xd4, 0x7b, 0x4e, 0x54, 0xd8, 0x4e, 0x15,
+        0xd1, 0x57, 0x35, 0xae, 0x76, 0x47, 0x37, 0x73, 0x88, 0x8a, 0x89, 0xc8, 0x5b, 0xa3, 0xaa, 0x0b,
+        0xa0, 0xfb, 0x25, 0xad, 0xfb, 0x20, 0xb8, 0xeb, 0x8a, 0xb8, 0x1a, 0xbe, 0xb3, 0x0a, 0xeb, 0x9e,
+        0x5a, 0x01, 0xa0, 0x48, 0xc0, 0x8b, 0xa8, 0xf9, 0x76, 0xb7, 0x82, 0x78, 0x66, 0x64, 0x6c, 0x26,
+        0x8d, 0x60, 0xd6, 0x00, 0x60, 0x36, 0xd4, 0x68, 0x56, 0xc9, 0x79, 0xc7, 0x73, 0x76, 0xf9, 0x0c,
+        0x91, 0x38, 0xd6, 0xa4, 0xaa, 0x2a, 0xa2, 0xab, 0xdf, 0xb7, 0x7b, 0xb9, 0xc3, 0x2c, 0x37, 0xc3,
+        0x5c, 0x00, 0xc3, 0xeb, 0xfc, 0xb1, 0xbb, 0x4d, 0xb5, 0x0a, 0x0e, 0x9e, 0xda, 0x29, 0x87, 0xd8,
+        0xc4, 0x8b, 0xf6, 0xe9, 0x74, 0x17, 0x00, 0x63, 0xe6, 0x52, 0x65, 0x16, 0x12, 0x5c, 0x46, 0x06,
+        0x6b, 0x96, 0x99, 0x6a, 0x07, 0x53, 0x76, 0xf7, 0x2e, 0x8e, 0xd8, 0xb3, 0x8b, 0x3a, 0x18, 0x9b,
+        0xfa, 0x01, 0xb1, 0x5a, 0xf4, 0xae, 0xfa, 0xec, 0xb3, 0x9a, 0xf5, 0xa8, 0xda, 0x90, 0xa9, 0x99,
+        0x8f, 0x98, 0xa9, 0xcd, 0x7f, 0xd8, 0x20, 0x82, 0x06, 0x51, 0x6c, 0x56, 0x87, 0x50, 0x15, 0x0f,
+        0x51, 0xb4, 0xb3, 0x48, 0x14, 0xbe, 0x47, 0xb4, 0x6c, 0x46, 0x95, 0x33, 0x55, 0x35, 0x13, 0x64,
+        0x26, 0x12, 0x61, 0x38, 0x04, 0x78, 0x87, 0xcb, 0x8e, 0xb8, 0xd3, 0x8d, 0x39, 0x92, 0x9a, 0x99,
+        0x73, 0x98, 0x49, 0x99, 0x99, 0x69, 0x1b, 0x8e, 0x89, 0x2d, 0x7d, 0x58, 0x12, 0x81, 0x36, 0x25,
+        0x68, 0xb6, 0x4b, 0x4f, 0x95, 0x2c, 0x53, 0x04, 0x1f, 0x3f, 0x04, 0x2f, 0x3f, 0xb4, 0x05, 0x3f,
+        0xd4, 0x08, 0x42, 0xf3, 0xef, 0x56, 0x65, 0x35, 0x53, 0x96, 0xd2, 0x66, 0xb6, 0xaa, 0x87, 0xa8,
+        0x40, 0x83, 0xe9, 0x46, 0x97, 0x39, 0x39, 0xa1, 0x69, 0xfb, 0x9f, 0xba, 0x20, 0xa0, 0x4a, 0x43,
+        0x9a, 0x19, 0xc3, 0x9c, 0x28, 0xc3, 0x91, 0x98, 0xd4, 0x77, 0x67, 0xb8, 0x7b, 0x56, 0x67, 0x64,
+        0x26, 0x82, 0x54, 0xd5, 0x80, 0x57, 0xe4, 0x82, 0x4c, 0x44, 0x83, 0x4e, 0x04, 0xd6, 0x4d, 0xa5,
+        0xbf, 0x56, 0x25, 0x98, 0x74, 0x97, 0x22, 0x71, 0xc8, 0x73, 0x87, 0xf8, 0x3f, 0xa2, 0x99, 0xf5,
+        0x9f, 0xab, 0x1d, 0xad, 0x4b, 0x13, 0xb8, 0xbb, 0x8b, 0xb8, 0x7a, 0xcf, 0xb3, 0x6a, 0xfb, 0x9f,
+        0xba, 0x16, 0xa1, 0x88, 0xd6, 0x8d, 0x89, 0x16, 0x77, 0xb7, 0x96, 0x79, 0xc6, 0x72, 0x6d, 0x86,
+        0x91, 0x60, 0xd6, 0x05, 0x60, 0x66, 0xca, 0x67, 0x96, 0xbc, 0x78, 0x77, 0x5e, 0x75, 0xc8, 0xf0,
+        0x8f, 0xa8, 0xba, 0xa3, 0x4a, 0x11, 0xa0, 0xcb, 0xd0, 0xb6, 0x5b, 0xa1, 0xc2, 0xac, 0x32, 0xc2,
+        0xec, 0x07, 0xc4, 0x9c, 0x04, 0xb3, 0x3b, 0x60, 0xb6, 0x6a, 0x22, 0xa0, 0x2a, 0x48, 0x89, 0x98,
+        0xe1, 0x8d, 0xd6, 0xf7, 0x75, 0x27, 0x1c, 0x63, 0xe6, 0x59, 0x65, 0xf6, 0x0c, 0x5c, 0x06, 0x07,
+        0x6a, 0x96, 0x8d, 0x68, 0x67, 0x3d, 0x75, 0x37, 0x0d, 0x8d, 0x08, 0x94, 0x89, 0x5a, 0x0a, 0x9a,
+        0x69, 0xe5, 0xb0, 0x9a, 0xe4, 0xae, 0x4a, 0xe7, 0xb3, 0x3a, 0xf8, 0xa9, 0xaa, 0xa1, 0xaa, 0x59,
+        0xa6, 0x99, 0x99, 0xdf, 0x81, 0x78, 0x3e, 0x83, 0xb6, 0x64, 0x6e, 0x36, 0xa1, 0x51, 0x05, 0x24,
+        0x52, 0x94, 0xb8, 0x48, 0x84, 0xc5, 0x47, 0x34, 0x69, 0x46, 0x35, 0x23, 0x53, 0xd4, 0xff, 0x61,
+        0xe5, 0xf2, 0x5f, 0x57, 0xf0, 0x76, 0xc7, 0xae, 0x8d, 0x78, 0xc3, 0x8b, 0xa9, 0x87, 0x9a, 0x99,
+        0x65, 0x98, 0x49, 0x9a, 0x9a, 0x39, 0x2d, 0x8f, 0xa9, 0x3a, 0x7f, 0x28, 0x36, 0x82, 0xd6, 0x47,
+        0x6a, 0x86, 0x69, 0x50, 0xe5, 0x45, 0x54, 0x74, 0x26, 0x3f, 0xd4, 0x40, 0x3f, 0xd4, 0x03, 0x40,
+        0x13, 0xfa, 0x42, 0x93, 0xe5, 0x54, 0xc5, 0x17, 0x51, 0xe6, 0xb9, 0x64, 0xf6, 0x8b, 0x85, 0xa8,
+        0x24, 0x82, 0x29, 0x3b, 0x96, 0x39, 0x23, 0xa1, 0x19, 0xeb, 0x9f, 0x8a, 0x2d, 0xa0, 0xaa, 0x49,
+        0x9a, 0x99, 0xd1, 0x9c, 0xc8, 0xd2, 0x92, 0xa8, 0xed, 0x79, 0x97, 0xcd, 0x7d, 0x06, 0x7e, 0x65,
+        0xe6, 0x9d, 0x55, 0xf5, 0x91, 0x58, 0x94, 0x89, 0x4c, 0xe4, 0x8c, 0x4d, 0x74, 0xd5, 0x4d, 0x45,
+        0xb0, 0x54, 0xb5, 0x89, 0x72, 0xd7, 0x06, 0x70, 0x38, 0x59, 0x86, 0x78, 0x2a, 0xa1, 0x49, 0xe1,
+        0x9e, 0x4b, 0x13, 0xac, 0xdb, 0x0a, 0xb9, 0x3b, 0x8b, 0xb8, 0xba, 0xdc, 0xb4, 0xbb, 0x04, 0xa1,
+        0x5a, 0x2a, 0xa2, 0xe8, 0xf3, 0x8e, 0xf9, 0x2e, 0x79, 0x37, 0xb7, 0x7b, 0x66, 0x7b, 0x6e, 0x96,
+        0xa8, 0x61, 0x06, 0x06, 0x60, 0x66, 0xc1, 0x66, 0xd6, 0xab, 0x77, 0x17, 0x49, 0x74, 0x78, 0xd5,
+        0x8d, 0xd8, 0xa0, 0xa1, 0xd9, 0xf9, 0x9f, 0xab, 0xc0, 0xb5, 0x2b, 0x95, 0xc2, 0x6c, 0x27, 0xc2,
+        0x3c, 0x10, 0xc4, 0xdc, 0x11, 0xb4, 0x3b, 0x71, 0xb6, 0xfa, 0x3e, 0xa1, 0x9a, 0x5c, 0x8b, 0x38,
+        0xfa, 0x8f, 0x47, 0x0e, 0x76, 0xb7, 0x2c, 0x64, 0xf6, 0x66, 0x66, 0xb6, 0x0f, 0x5c, 0x86, 0x01,
+        0x69, 0x76, 0x7c, 0x67, 0x87, 0x20, 0x73, 0xa6, 0xfa, 0x8b, 0x68, 0x7b, 0x88, 0x09, 0xed, 0x98,
+        0xf9, 0xc9, 0xaf, 0xba, 0xd5, 0xad, 0x5a, 0xe8, 0xb3, 0x2a, 0xf5, 0xaa, 0xba, 0xaa, 0xaa, 0x89,
+        0xba, 0x9b, 0x49, 0xf4, 0x83, 0x68, 0x55, 0x85, 0x56, 0x84, 0x6f, 0x66, 0xbc, 0x52, 0x65, 0x38,
+        0x53, 0xb4, 0xbe, 0x48, 0xd4, 0xcd, 0x46, 0x74, 0x60, 0x45, 0xf5, 0x0f, 0x52, 0xb4, 0xef, 0x60,
+        0x75, 0xd9, 0x5e, 0x47, 0xcb, 0x75, 0x67, 0x96, 0x8c, 0x08, 0xac, 0x8a, 0x39, 0x7c, 0x99, 0xa9,
+        0x63, 0x99, 0x29, 0x9e, 0x9a, 0x19, 0x3e, 0x90, 0x79, 0x4e, 0x80, 0xb8, 0x49, 0x84, 0x46, 0x65,
+        0x6c, 0x36, 0x83, 0x52, 0xa5, 0x55, 0x55, 0xa4, 0x38, 0x40, 0x84, 0x49, 0x3f, 0x84, 0x02, 0x40,
+        0xa3, 0xeb, 0x41, 0x73, 0xd6, 0x53, 0x65, 0x03, 0x50, 0xb6, 0x96, 0x63, 0x86, 0x77, 0x84, 0x18,
+        0x0f, 0x80, 0xd9, 0x2c, 0x95, 0x59, 0x15, 0xa0, 0xb9, 0xf0, 0x9e, 0xda, 0x36, 0xa1, 0x0a, 0x52,
+        0x9b, 0x49, 0xd6, 0x9c, 0xf8, 0xe5, 0x93, 0xe9, 0x01, 0x7a, 0x87, 0xe5, 0x7e, 0xb6, 0x8f, 0x67,
+        0x56, 0xba, 0x56, 0xd5, 0xa1, 0x5a, 0x14, 0x92, 0x4d, 0x14, 0x8f, 0x4d, 0x64, 0xcf, 0x4d, 0x15,
+        0xa1, 0x53, 0xd5, 0x81, 0x71, 0x86, 0xe9, 0x6f, 0x08, 0x45, 0x85, 0x38, 0x12, 0xa0, 0x19, 0xcf,
+        0x9c, 0xeb, 0x07, 0xab, 0xca, 0xf9, 0xb9, 0x2b, 0x8c, 0xb8, 0xaa, 0xe6, 0xb5, 0x3b, 0x13, 0xa2,
+        0x7a, 0x40, 0xa4, 0x19, 0x09, 0x90, 0xb9, 0x4b, 0x7a, 0xc7, 0xcd, 0x7c, 0x96, 0x89, 0x6f, 0x16,
+        0xb3, 0x60, 0xe6, 0x12, 0x60, 0x96, 0xb6, 0x66, 0x96, 0xab, 0x75, 0xb7, 0x38, 0x73, 0x58, 0xbb,
+        0x8c, 0xb8, 0x8d, 0xa0, 0x89, 0xdd, 0x9e, 0x0b, 0xaf, 0xb4, 0x0b, 0x83, 0xc2, 0x4c, 0x21, 0xc2,
+        0x0c, 0x18, 0xc4, 0xbc, 0x10, 0xb5, 0x5b, 0x82, 0xb8, 0x0a, 0x5a, 0xa3, 0x4a, 0x6f, 0x8c, 0xf9,
+        0x10, 0x90, 0xa7, 0x20, 0x78, 0x47, 0x3e, 0x65, 0x86, 0x6f, 0x67, 0x16, 0x0c, 0x5b, 0xf5, 0xfa,
+        0x68, 0xd6, 0x76, 0x66, 0xe7, 0x0d, 0x72, 0x76, 0xe5, 0x89, 0xd8, 0x62, 0x86, 0xc9, 0xd9, 0x98,
+        0x09, 0xba, 0xae, 0xea, 0xc8, 0xac, 0xaa, 0xe7, 0xb2, 0xfa, 0xf0, 0xab, 0x3a, 0xb4, 0xab, 0x29,
+        0xcf, 0x9c, 0xaa, 0x02, 0x84, 0xb8, 0x75, 0x86, 0x96, 0x98, 0x71, 0x26, 0xd5, 0x53, 0x35, 0x43,
+        0x54, 0xb4, 0xbc, 0x49, 0x44, 0xd1, 0x46, 0x64, 0x5f, 0x45, 0x55, 0x01, 0x52, 0x24, 0xdf, 0x5f,
+        0x05, 0xbd, 0x5c, 0xb7, 0xb2, 0x73, 0x77, 0x7d, 0x8b, 0x38, 0x96, 0x89, 0x29, 0x6f, 0x99, 0x09,
+        0x53, 0x98, 0xe9, 0x9f, 0x9a, 0x69, 0x4e, 0x91, 0x29, 0x51, 0x82, 0x28, 0x5f, 0x85, 0x96, 0x77,
+        0x6d, 0xb6, 0x9b, 0x54, 0x05, 0x71, 0x57, 0x44, 0x44, 0x41, 0x84, 0x53, 0x3f, 0xb4, 0x08, 0x40,
+        0x33, 0xe0, 0x41, 0x23, 0xd1, 0x52, 0x24, 0xf2, 0x4f, 0x66, 0x8a, 0x61, 0xa6, 0x5b, 0x82, 0xd7,
+        0xf8, 0x7f, 0x49, 0x19, 0x93, 0xe9, 0x07, 0xa0, 0x99, 0xe3, 0x9e, 0xba, 0x38, 0xa1, 0xca, 0x55,
+        0x9b, 0xa9, 0xd4, 0x9d, 0x68, 0xfb, 0x94, 0xd9, 0x0e, 0x7c, 0x38, 0x00, 0x7f, 0xb6, 0xac, 0x68,
+        0xa6, 0xcb, 0x57, 0xf5, 0xb3, 0x5b, 0x64, 0x97, 0x4d, 0x94, 0x98, 0x4d, 0x14, 0xc7, 0x4c, 0xe5,
+        0x93, 0x53, 0x15, 0x6c, 0x70, 0x36, 0xdb, 0x6d, 0xe8, 0x2b, 0x83, 0xc7, 0xfd, 0x9f, 0x29, 0xb9,
+        0x9b, 0xfb, 0x00, 0xab, 0x5a, 0xf0, 0xb9, 0xab, 0x87, 0xb8, 0xba, 0xf1, 0xb6, 0x4b, 0x1c, 0xa3,
+        0xaa, 0x51, 0xa5, 0x39, 0x1e, 0x91, 0xb9, 0x64, 0x7b, 0xf7, 0xde, 0x7d, 0xc6, 0x9c, 0x70, 0x26,
+        0xbd, 0x60, 0xc6, 0x0e, 0x61, 0x16, 0xad, 0x66, 0x36, 0x9f, 0x74, 0xc7, 0x28, 0x72, 0x58, 0xa6,
+        0x8b, 0x58, 0x75, 0x9f, 0x39, 0xcb, 0x9c, 0x8b, 0x9c, 0xb3, 0x0b, 0x6c, 0xc1, 0xec, 0x1b, 0xc1,
+        0x6c, 0x1e, 0xc4, 0xec, 0x19, 0xb6, 0x3b, 0x8e, 0xb9, 0x8a, 0x71, 0xa4, 0xfa, 0x85, 0x8e, 0x39,
+        0x25, 0x92, 0x27, 0x3b, 0x78, 0xf7, 0x4e, 0x65, 0xf6, 0x7d, 0x68, 0x26, 0x08, 0x5c, 0x26, 0x03,
+        0x67, 0x96, 0x65, 0x66, 0xa6, 0xf4, 0x71, 0x36, 0xcd, 0x88, 0x38, 0x4c, 0x85, 0x09, 0xca, 0x96,
+        0x99, 0x9f, 0xad, 0xda, 0xb7, 0xab, 0x7a, 0xe6, 0xb2, 0xca, 0xed, 0xab, 0xba, 0xbb, 0xab, 0xf9,
+        0xe7, 0x9d, 0x7a, 0x1b, 0x85, 0xf8, 0x8a, 0x88, 0x66, 0xab, 0x72, 0x66, 0xea, 0x54, 0x55, 0x59,
+        0x55, 0xb4, 0xc9, 0x4a, 0x14, 0xdc, 0x45, 0xe4, 0x56, 0x45, 0x34, 0xf1, 0x50, 0xe4, 0xce, 0x5d,
+        0xa5, 0xac, 0x5b, 0x07, 0xa0, 0x72, 0x97, 0x63, 0x89, 0xe8, 0x81, 0x87, 0xf9, 0x72, 0x98, 0xb9,
+        0x4f, 0x99, 0x69, 0x9b, 0x9a, 0x09, 0x55, 0x92, 0x79, 0x5e, 0x83, 0x58, 0x75, 0x87, 0x16, 0x8c,
+        0x6f, 0x76, 0xb1, 0x55, 0x55, 0x80, 0x58, 0x64, 0x50, 0x42, 0x14, 0x66, 0x3f, 0xf4, 0x0b, 0x40,
+        0x93, 0xd9, 0x40, 0xa3, 0xc8, 0x51, 0x24, 0xdf, 0x4e, 0x36, 0x6c, 0x60, 0x56, 0x46, 0x81, 0x37,
+        0xe1, 0x7d, 0x79, 0x09, 0x92, 0xe8, 0xed, 0xa0, 0x39, 0xdd, 0x9e, 0x6a, 0x42, 0xa2, 0x2a, 0x5c,
+        0x9c, 0x59, 0xe2, 0x9e, 0x09, 0x04, 0x95, 0x59, 0x1b, 0x7d, 0x28, 0x0d, 0x80, 0xf6, 0xbf, 0x69,
+        0xe6, 0xe1, 0x58, 0x95, 0xc6, 0x5c, 0x34, 0x96, 0x4e, 0x44, 0xa3, 0x4c, 0xb4, 0xc9, 0x4c, 0x95,
+        0x87, 0x51, 0xe5, 0x68, 0x6f, 0x56, 0xc9, 0x6c, 0xa8, 0x18, 0x82, 0x07, 0xe5, 0x9d, 0xd9, 0xa9,
+        0x9b, 0x1a, 0xf1, 0xaa, 0x5a, 0xe6, 0xb9, 0x2b, 0x85, 0xb8, 0x5b, 0x01, 0xb6, 0x4b, 0x23, 0xa4,
+        0x8a, 0x65, 0xa6, 0x99, 0x34, 0x93, 0x49, 0x71, 0x7d, 0x07, 0xf2, 0x7e, 0xc6, 0xa8, 0x70, 0xf6,
+        0xce, 0x61, 0x36, 0x15, 0x61, 0x26, 0xa4, 0x66, 0x06, 0x99, 0x73, 0xb7, 0x18, 0x71, 0xa8, 0x92,
+        0x8a, 0x28, 0x5c, 0x9e, 0x49, 0xaa, 0x9b, 0x7b, 0x8a, 0xb1, 0xcb, 0x66, 0xc1, 0x7c, 0x12, 0xc0,
+        0xdc, 0x20, 0xc5, 0x7c, 0x15, 0xb7, 0x4b, 0x9b, 0xb9, 0xca, 0x7c, 0xa5, 0xea, 0x9b, 0x8f, 0xa9,
+        0x3b, 0x93, 0xe7, 0x4a, 0x7a, 0x17, 0x63, 0x66, 0xa6, 0x89, 0x68, 0xa6, 0x08, 0x5b, 0xe5, 0xff,
+        0x67, 0x56, 0x60, 0x65, 0xc6, 0xec, 0x6f, 0xf6, 0xc0, 0x87, 0x38, 0x35, 0x83, 0x39, 0xb5, 0x94,
+        0xc9, 0x91, 0xad, 0x1a, 0xaf, 0xaa, 0xba, 0xe1, 0xb2, 0x2a, 0xe7, 0xac, 0x4a, 0xc2, 0xac, 0x39,
+        0xf0, 0x9e, 0xaa, 0x28, 0x87, 0x98, 0x9a, 0x89, 0xb6, 0xbf, 0x73, 0xa7, 0x05, 0x54, 0xf5, 0x6a,
+        0x56, 0xc4, 0xcc, 0x4a, 0x34, 0xe0, 0x45, 0x54, 0x56, 0x45, 0x34, 0xde, 0x50, 0x14, 0xc9, 0x5c,
+        0xc5, 0x9c, 0x5a, 0x37, 0x8a, 0x70, 0xe7, 0x52, 0x88, 0x98, 0x75, 0x87, 0x19, 0x65, 0x97, 0xb9,
+        0x37, 0x99, 0x59, 0x9a, 0x9a, 0x29, 0x65, 0x92, 0xf9, 0x6c, 0x84, 0x58, 0x84, 0x88, 0x36, 0xa1,
+        0x70, 0x96, 0xca, 0x56, 0x65, 0x9b, 0x59, 0xd4, 0x52, 0x43, 0x74, 0x79, 0x3f, 0xb4, 0x14, 0x40,
+        0x93, 0xd5, 0x40, 0x23, 0xc4, 0x50, 0x04, 0xcf, 0x4d, 0x36, 0x50, 0x5f, 0x36, 0x33, 0x7f, 0xf7,
+        0xcb, 0x7c, 0x58, 0xf9, 0x92, 0x88, 0xe6, 0xa0, 0x19, 0xda, 0x9d, 0xfa, 0x4b, 0xa2, 0x1a, 0x63,
+        0x9c, 0xa9, 0xde, 0x9e, 0x49, 0x12, 0x96, 0x49, 0x28, 0x7e, 0x98, 0x22, 0x82, 0x66, 0xd1, 0x6b,
+        0x46, 0xef, 0x59, 0x95, 0xd2, 0x5d, 0x04, 0xa3, 0x4e, 0x64, 0xa6, 0x4c, 0x34, 0xcf, 0x4c, 0xc5,
+        0x79, 0x51, 0x75, 0x58, 0x6e, 0x36, 0xb4, 0x6b, 0x37, 0xfd, 0x81, 0x17, 0xd3, 0x9c, 0xa9, 0x95,
+        0x99, 0x3a, 0xe5, 0xa9, 0xca, 0xdd, 0xb9, 0x6b, 0x87, 0xb8, 0x6b, 0x0f, 0xb6, 0xeb, 0x2e, 0xa6,
+        0x2a, 0x6e, 0xa7, 0x99, 0x41, 0x94, 0xa9, 0x86, 0x7e, 0x58, 0x09, 0x80, 0x46, 0xb6, 0x71, 0xc6,
+        0xde, 0x61, 0x76, 0x16, 0x61, 0x86, 0xa0, 0x65, 0xa6, 0x93, 0x73, 0x07, 0x0c, 0x70, 0xd8, 0x85,
+        0x88, 0xf8, 0x50, 0x9c, 0xd9, 0xa2, 0x99, 0xdb, 0x7c, 0xb0, 0xbb, 0x4c, 0xc0, 0xdc, 0x0c, 0xc0,
+        0x4c, 0x21, 0xc5, 0x8c, 0x1b, 0xb8, 0x3b, 0xa6, 0xba, 0x8a, 0x92, 0xa6, 0xea, 0xa8, 0x90, 0xf9,
+        0x51, 0x94, 0xe7, 0x5b, 0x7b, 0x27, 0x77, 0x67, 0x76, 0x8f, 0x69, 0x56, 0x00, 0x5c, 0x06, 0x02,
+        0x66, 0xa6, 0x53, 0x65, 0x36, 0xd5, 0x6f, 0x36, 0xb4, 0x86, 0x18, 0x21, 0x82, 0x79, 0xa5, 0x94,
+        0x59, 0x81, 0xac, 0xaa, 0xa0, 0xaa, 0x0a, 0xe3, 0xb2, 0x1a, 0xe7, 0xac, 0x6a, 0xc1, 0xac, 0x6a,
+        0x04, 0x9f, 0x9a, 0x30, 0x88, 0x78, 0xb3, 0x8a, 0x96, 0xd4, 0x75, 0x07, 0x14, 0x56, 0x05, 0x7a,
+        0x57, 0x64, 0xd4, 0x4a, 0xd4, 0xec, 0x45, 0xa4, 0x50, 0x44, 0xb4, 0xd9, 0x4f, 0x34, 0xb6, 0x5b,
+        0x55, 0x87, 0x58, 0xb7, 0x6f, 0x6f, 0xa7, 0x40, 0x87, 0xe8, 0x5e, 0x85, 0xf9, 0x5c, 0x96, 0xf9,
+        0x33, 0x99, 0x79, 0x9e, 0x99, 0xe9, 0x6d, 0x93, 0x59, 0x75, 0x85, 0xa8, 0x98, 0x89, 0x26, 0xb6,
+        0x71, 0xe6, 0xdc, 0x57, 0x55, 0xb2, 0x5b, 0x34, 0x65, 0x43, 0x94, 0x7e, 0x40, 0x24, 0x12, 0x41,
+        0x03, 0xc2, 0x3f, 0xa3, 0xbb, 0x4f, 0x24, 0xc7, 0x4c, 0xf6, 0x40, 0x5d, 0xd6, 0x20, 0x7f, 0x37,
+        0xb2, 0x7b, 0x28, 0xe4, 0x91, 0x28, 0xd4, 0x9f, 0xc9, 0xd1, 0x9d, 0x6a, 0x4b, 0xa2, 0x3a, 0x5f,
+        0x9c, 0xa9, 0xe9, 0x9e, 0x49, 0x22, 0x97, 0x39, 0x35, 0x7f, 0x68, 0x35, 0x83, 0x06, 0xde, 0x6c,
+        0x57, 0x02, 0x5a, 0xd5, 0xdb, 0x5d, 0xb4, 0xa9, 0x4f, 0x24, 0xb3, 0x4c, 0x74, 0xca, 0x4c, 0x15,
+        0x6c, 0x50, 0xf5, 0x4f, 0x6c, 0xe6, 0xa5, 0x6a, 0x67, 0xf3, 0x80, 0x47, 0xc7, 0x9b, 0xd9, 0x88,
+        0x98, 0xba, 0xe3, 0xa9, 0x1a, 0xd2, 0xb9, 0x8b, 0x85, 0xb8, 0x2b, 0x10, 0xb7, 0x3b, 0x38, 0xa6,
+        0x7a, 0x85, 0xa8, 0x59, 0x5a, 0x95, 0x89, 0x97, 0x7f, 0x18, 0x12, 0x81, 0xa6, 0xbd, 0x72, 0xa6,
+        0xeb, 0x61, 0xa6, 0x1a, 0x62, 0x16, 0x96, 0x65, 0x66, 0x92, 0x72, 0x46, 0xff, 0x6f, 0xa8, 0x6d,
+        0x87, 0x98, 0x40, 0x9b, 0xf9, 0x8a, 0x98, 0xeb, 0x76, 0xb0, 0x2b, 0x43, 0xc0, 0xdc, 0x01, 0xc0,
+        0x2c, 0x26, 0xc5, 0xac, 0x1d, 0xb8, 0x9b, 0xaf, 0xbb, 0x7a, 0xa1, 0xa7, 0x9a, 0xbd, 0x91, 0xc9,
+        0x64, 0x95, 0xe7, 0x67, 0x7c, 0x27, 0x88, 0x68, 0x06, 0x98, 0x6a, 0x46, 0x03, 0x5c, 0x45, 0xff,
+        0x65, 0xf6, 0x4e, 0x64, 0x76, 0xd0, 0x6d, 0xc6, 0xa1, 0x84, 0x78, 0x0f, 0x81, 0x49, 0x97, 0x92,
+        0xf9, 0x75, 0xac, 0x1a, 0x92, 0xa9, 0x0a, 0xd8, 0xb2, 0x3a, 0xde, 0xac, 0xea, 0xcd, 0xad, 0x0a,
+        0x0d, 0xa0, 0x9a, 0x45, 0x89, 0x88, 0xbf, 0x8b, 0xa6, 0xe6, 0x76, 0x07, 0x25, 0x56, 0xf5, 0x86,
+        0x58, 0x84, 0xdc, 0x4a, 0xf4, 0xf2, 0x45, 0x44, 0x53, 0x44, 0xb4, 0xc7, 0x4e, 0x74, 0xaf, 0x5a,
+        0x15, 0x7c, 0x57, 0xd7, 0x62, 0x6e, 0xa7, 0x29, 0x86, 0xc8, 0x50, 0x84, 0xe9, 0x53, 0x96, 0x99,
+        0x27, 0x99, 0x39, 0x9b, 0x9a, 0x29, 0x7a, 0x93, 0xf9, 0x7b, 0x86, 0x48, 0xa4, 0x89, 0xf6, 0xc8,
+        0x73, 0x26, 0xf2, 0x58, 0xb5, 0xb5, 0x5c, 0x14, 0x75, 0x45, 0x64, 0x8c, 0x40, 0x34, 0x17, 0x40,
+        0xd3, 0xc3, 0x3e, 0xd3, 0xb7, 0x4e, 0x34, 0xb3, 0x4b, 0x66, 0x36, 0x5c, 0xd6, 0x0c, 0x7d, 0xe7,
+        0xa5, 0x79, 0xf8, 0xd5, 0x8f, 0xe8, 0xc4, 0x9f, 0x39, 0xcb, 0x9c, 0xea, 0x4e, 0xa2, 0x9a, 0x64,
+        0x9d, 0x39, 0xeb, 0x9e, 0x89, 0x2d, 0x97, 0xf9, 0x3f, 0x80, 0x58, 0x42, 0x84, 0x56, 0xf8, 0x6d,
+        0x27, 0x14, 0x5b, 0x85, 0xee, 0x5e, 0xb4, 0xb4, 0x4f, 0x74, 0xb7, 0x4c, 0x34, 0xca, 0x4c, 0xa5,
+        0x64, 0x50, 0x45, 0x47, 0x6c, 0x36, 0x99, 0x69, 0xa7, 0xde, 0x7f, 0x27, 0xb6, 0x9a, 0xe9, 0x81,
+        0x97, 0x9a, 0xdc, 0xa8, 0x6a, 0xc5, 0xb9, 0x7b, 0x83, 0xb8, 0x2b, 0x17, 0xb7, 0xbb, 0x3d, 0xa7,
+        0xba, 0x8f, 0xa9, 0x09, 0x67, 0x96, 0x99, 0xa4, 0x80, 0x18, 0x26, 0x82, 0x36, 0xc4, 0x73, 0x56,
+        0xf3, 0x62, 0x06, 0x19, 0x62, 0x46, 0x92, 0x65, 0x36, 0x8d, 0x71, 0x26, 0xf4, 0x6f, 0x28, 0x5b,
+        0x87, 0x28, 0x31, 0x9a, 0x49, 0x7e, 0x97, 0x9b, 0x69, 0xaf, 0x3b, 0x35, 0xbf, 0xdc, 0x01, 0xbf,
+        0xdc, 0x26, 0xc5, 0xbc, 0x20, 0xb9, 0x2b, 0xbf, 0xbb, 0xda, 0xb1, 0xa8, 0xca, 0xcb, 0x92, 0xf9,
+        0x6a, 0x96, 0xb7, 0x74, 0x7d, 0x37, 0x95, 0x68, 0x56, 0xa5, 0x6a, 0x76, 0x08, 0x5c, 0x96, 0x04,
+        0x65, 0x86, 0x4c, 0x64, 0x36, 0xbc, 0x6d, 0x86, 0x99, 0x83, 0xf7, 0xfb, 0x80, 0x99, 0x83, 0x91,
+        0xf9, 0x5a, 0xab, 0x6a, 0x88, 0xa8, 0x4a, 0xd6, 0xb1, 0xba, 0xdd, 0xad, 0x6a, 0xc8, 0xad, 0x4a,
+        0x1c, 0xa0, 0x9a, 0x4c, 0x8a, 0xf8, 0xd2, 0x8d, 0x06, 0xee, 0x77, 0x77, 0x33, 0x57, 0xa5, 0x94,
+        0x59, 0xb4, 0xdd, 0x4b, 0x54, 0xfa, 0x44, 0xe4, 0x4b, 0x44, 0x94, 0xbb, 0x4e, 0x74, 0x9d, 0x59,
+        0x65, 0x68, 0x57, 0x37, 0x50, 0x6d, 0xb7, 0x1a, 0x85, 0xd8, 0x45, 0x83, 0xe9, 0x49, 0x95, 0xa9,
+        0x23, 0x99, 0x59, 0x9a, 0x9a, 0x09, 0x78, 0x94, 0x39, 0x85, 0x87, 0x48, 0xaf, 0x8a, 0xf6, 0xdb,
+        0x73, 0xe6, 0xff, 0x59, 0x95, 0xcf, 0x5d, 0x44, 0x78, 0x45, 0x74, 0x97, 0x40, 0x74, 0x1d, 0x41,
+        0x63, 0xbc, 0x3f, 0x03, 0xb0, 0x4d, 0xa4, 0xa9, 0x4a, 0xe6, 0x1d, 0x5b, 0xc5, 0xf7, 0x7c, 0xb7,
+        0x91, 0x78, 0xa8, 0xd3, 0x8f, 0x38, 0xb4, 0x9e, 0x99, 0xc1, 0x9c, 0x6a, 0x4d, 0xa2, 0x6a, 0x66,
+        0x9d, 0x89, 0xf1, 0x9e, 0xd9, 0x36, 0x98, 0x49, 0x4a, 0x80, 0xf8, 0x4b, 0x85, 0x07, 0x01, 0x6d,
+        0xf7, 0x1d, 0x5b, 0xf5, 0xf8, 0x5f, 0x34, 0xb7, 0x4f, 0xc4, 0xbf, 0x4b, 0xc4, 0xc9, 0x4c, 0x55,
+        0x5e, 0x50, 0x35, 0x3a, 0x6b, 0xb6, 0x90, 0x68, 0xe7, 0xd2, 0x7e, 0x77, 0xa2, 0x99, 0xc9, 0x6f,
+        0x97, 0x1a, 0xd2, 0xa7, 0xda, 0xbb, 0xb9, 0x9b, 0x86, 0xb7, 0xeb, 0x1c, 0xb7, 0xeb, 0x42, 0xa8,
+        0x8a, 0x96, 0xa9, 0x79, 0x74, 0x97, 0x89, 0xb4, 0x80, 0xc8, 0x36, 0x83, 0x46, 0xd4, 0x73, 0xc7,
+        0x01, 0x62, 0x06, 0x26, 0x62, 0x86, 0x94, 0x64, 0xf6, 0x8b, 0x70, 0xa6, 0xf1, 0x6e, 0x78, 0x4f,
+        0x86, 0x18, 0x21, 0x99, 0x69, 0x6a, 0x97, 0x0b, 0x60, 0xae, 0x9b, 0x26, 0xc0, 0x0b, 0xf7, 0xbf,
+        0x7c, 0x2c, 0xc5, 0x8c, 0x1a, 0xb9, 0x7b, 0xc1, 0xbb, 0xfa, 0xba, 0xa9, 0xea, 0xd6, 0x93, 0xc9,
+        0x81, 0x98, 0x17, 0x84, 0x7e, 0x37, 0xa3, 0x68, 0x56, 0xaa, 0x6a, 0xe6, 0x0e, 0x5c, 0x56, 0x0c,
+        0x65, 0x56, 0x3e, 0x64, 0x06, 0xa9, 0x6c, 0x96, 0x86, 0x82, 0xa7, 0xef, 0x7f, 0x89, 0x75, 0x90,
+        0xf9, 0x4b, 0xaa, 0xba, 0x79, 0xa8, 0x0a, 0xd6, 0xb1, 0xda, 0xd4, 0xad, 0x8a, 0xd1, 0xad, 0x5a,
+        0x26, 0xa1, 0x4a, 0x5a, 0x8c, 0x08, 0xdb, 0x8d, 0x57, 0x07, 0x77, 0xb7, 0x46, 0x58, 0x15, 0xa3,
+        0x5a, 0x34, 0xe5, 0x4c, 0x34, 0xf9, 0x44, 0xb4, 0x4b, 0x44, 0xe4, 0xba, 0x4d, 0xb4, 0x9d, 0x58,
+        0x75, 0x5e, 0x56, 0x17, 0x40, 0x6c, 0xa7, 0x09, 0x84, 0xf8, 0x37, 0x82, 0xf9, 0x47, 0x95, 0x89,
+        0x1b, 0x99, 0x29, 0x98, 0x99, 0xf9, 0x87, 0x94, 0xb9, 0x89, 0x88, 0x68, 0xbf, 0x8b, 0xc6, 0xef,
+        0x74, 0xc7, 0x0a, 0x5a, 0x65, 0xde, 0x5e, 0x14, 0x88, 0x46, 0x04, 0x9f, 0x40, 0xd4, 0x1e, 0x41,
+        0xc3, 0xbb, 0x3e, 0xb3, 0xab, 0x4c, 0x84, 0x9f, 0x4a, 0x96, 0x14, 0x5a, 0xf5, 0xec, 0x7b, 0xe7,
+        0x82, 0x77, 0xe8, 0xc8, 0x8e, 0x88, 0xaa, 0x9e, 0x69, 0xbb, 0x9c, 0x1a, 0x4f, 0xa2, 0xba, 0x68,
+        0x9d, 0x79, 0xec, 0x9f, 0x39, 0x3e, 0x98, 0xf9, 0x4c, 0x81, 0xb8, 0x5b, 0x85, 0xf7, 0x0c, 0x6e,
+        0xb7, 0x2e, 0x5c, 0x66, 0x05, 0x5f, 0xf4, 0xb9, 0x50, 0x54, 0xc5, 0x4b, 0xe4, 0xcb, 0x4c, 0xa5,
+        0x58, 0x4f, 0xc5, 0x3f, 0x6a, 0xb6, 0x85, 0x68, 0x57, 0xc7, 0x7d, 0x27, 0x9b, 0x99, 0x59, 0x62,
+        0x96, 0x6a, 0xcb, 0xa7, 0x9a, 0xbc, 0xb9, 0x3b, 0x7a, 0xb7, 0xab, 0x26, 0xb8, 0x4b, 0x44, 0xa8,
+        0xfa, 0xa0, 0xaa, 0x49, 0x83, 0x97, 0xf9, 0xc2, 0x81, 0x88, 0x3f, 0x83, 0xd6, 0xdb, 0x74, 0xc7,
+        0x09, 0x62, 0x56, 0x2c, 0x62, 0xa6, 0x8b, 0x64, 0xa6, 0x8d, 0x6f, 0xe6, 0xe5, 0x6e, 0x68, 0x45,
+        0x85, 0x08, 0x16, 0x98, 0x99, 0x62, 0x96, 0x9b, 0x52, 0xad, 0xdb, 0x21, 0xbf, 0x8b, 0xf3, 0xbe,
+        0xfc, 0x27, 0xc5, 0x6c, 0x1e, 0xb9, 0xfb, 0xc7, 0xbc, 0xfa, 0xc9, 0xaa, 0x5a, 0xde, 0x94, 0x99,
+        0x8b, 0x98, 0xc7, 0x88, 0x7e, 0xc7, 0xa7, 0x69, 0x46, 0xb8, 0x6b, 0x46, 0x0b, 0x5c, 0x46, 0x0d,
+        0x64, 0xc6, 0x43, 0x63, 0xb6, 0xa5, 0x6b, 0xe6, 0x83, 0x82, 0x17, 0xeb, 0x7e, 0x79, 0x65, 0x90,
+        0x49, 0x40, 0xa9, 0xfa, 0x76, 0xa7, 0x4a, 0xd6, 0xb1, 0x5a, 0xd1, 0xad, 0xca, 0xd3, 0xad, 0x4a,
+        0x2b, 0xa1, 0xfa, 0x61, 0x8c, 0x18, 0xef, 0x8e, 0x57, 0x17, 0x79, 0x07, 0x4c, 0x59, 0x25, 0xa9,
+        0x5b, 0x34, 0xec, 0x4c, 0x45, 0x01, 0x44, 0xc4, 0x4e, 0x44, 0xb4, 0xb2, 0x4d, 0x94, 0x91, 0x57,
+        0xa5, 0x53, 0x55, 0x87, 0x36, 0x6b, 0xa6, 0xfd, 0x84, 0x78, 0x2d, 0x82, 0x59, 0x39, 0x94, 0xe9,
+        0x0f, 0x99, 0x19, 0x9c, 0x99, 0xc9, 0x8d, 0x94, 0xe9, 0x8e, 0x89, 0x18, 0xc9, 0x8c, 0x66, 0xf5,
+        0x75, 0xa7, 0x17, 0x5b, 0x95, 0xea, 0x5e, 0xa4, 0x8e, 0x46, 0xd4, 0xad, 0x41, 0x34, 0x21, 0x42,
+        0x63, 0xb1, 0x3e, 0x53, 0xa7, 0x4c, 0x54, 0x95, 0x49, 0xe6, 0x05, 0x5a, 0x05, 0xdd, 0x7b, 0x07,
+        0x78, 0x77, 0x18, 0xb5, 0x8e, 0x38, 0xa2, 0x9e, 0x79, 0xb7, 0x9b, 0xca, 0x56, 0xa2, 0xca, 0x67,
+        0x9d, 0x89, 0xf1, 0x9e, 0xf9, 0x4b, 0x99, 0x29, 0x56, 0x82, 0x88, 0x66, 0x86, 0x27, 0x13, 0x6f,
+        0xa7, 0x39, 0x5d, 0x66, 0x0e, 0x61, 0x14, 0xbe, 0x50, 0xa4, 0xc6, 0x4c, 0x34, 0xca, 0x4c, 0xc5,
+        0x50, 0x4f, 0x35, 0x36, 0x6a, 0x06, 0x79, 0x67, 0x47, 0xbc, 0x7d, 0x07, 0x8c, 0x98, 0xe9, 0x58,
+        0x95, 0x7a, 0xc3, 0xa7, 0x3a, 0xb0, 0xb9, 0x6b, 0x79, 0xb7, 0xeb, 0x26, 0xb8, 0x2b, 0x49, 0xa9,
+        0x4a, 0xa9, 0xaa, 0x69, 0x8f, 0x99, 0x09, 0xcd, 0x82, 0x78, 0x45, 0x84, 0xb6, 0xe2, 0x75, 0x27,
+        0x10, 0x62, 0xe6, 0x31, 0x62, 0x66, 0x8a, 0x64, 0x76, 0x86, 0x6f, 0xa6, 0xdd, 0x6e, 0x28, 0x3a,
+        0x84, 0xa8, 0x09, 0x98, 0x39, 0x56, 0x95, 0x7b, 0x49, 0xad, 0xfb, 0x14, 0xbf, 0x4b, 0xeb, 0xbe,
+        0x8c, 0x2c, 0xc5, 0xfc, 0x20, 0xba, 0xab, 0xc9, 0xbd, 0x2a, 0xd0, 0xaa, 0xca, 0xed, 0x95, 0x89,
+        0x94, 0x99, 0x67, 0x93, 0x7f, 0x57, 0xb5, 0x69, 0x16, 0xbd, 0x6c, 0x06, 0x04, 0x5c, 0xb6, 0x08,
+        0x64, 0xc6, 0x3d, 0x63, 0xb6, 0x9b, 0x6b, 0x86, 0x76, 0x81, 0x37, 0xdb, 0x7d, 0xe9, 0x5a, 0x8f,
+        0xc9, 0x37, 0xa9, 0x9a, 0x69, 0xa6, 0xca, 0xce, 0xb1, 0x0a, 0xd1, 0xad, 0xea, 0xd2, 0xad, 0x4a,
+        0x37, 0xa2, 0x7a, 0x60, 0x8c, 0xd8, 0xf6, 0x8e, 0xb7, 0x19, 0x79, 0xb7, 0x60, 0x59, 0xa5, 0xb7,
+        0x5b, 0x94, 0xee, 0x4c, 0xb5, 0x0f, 0x44, 0xe4, 0x4e, 0x44, 0x94, 0xaa, 0x4c, 0xa4, 0x8d, 0x57,
+        0x25, 0x4b, 0x54, 0xc7, 0x2c, 0x6b, 0x56, 0xf2, 0x84, 0x08, 0x1b, 0x81, 0xc9, 0x33, 0x94, 0x99,
+        0x07, 0x99, 0x09, 0x95, 0x99, 0x99, 0x8e, 0x95, 0x39, 0x8e, 0x89, 0x78, 0xd2, 0x8c, 0xb7, 0x03,
+        0x76, 0x67, 0x26, 0x5b, 0xd5, 0xf2, 0x5f, 0xb4, 0x98, 0x47, 0x64, 0xb6, 0x41, 0x04, 0x2a, 0x41,
+        0xf3, 0xb0, 0x3e, 0xa3, 0xad, 0x4b, 0xa4, 0x91, 0x49, 0x25, 0xf4, 0x59, 0x35, 0xd3, 0x7a, 0x77,
+        0x69, 0x76, 0xc8, 0xb2, 0x8d, 0x88, 0x98, 0x9d, 0xd9, 0xb1, 0x9b, 0x5a, 0x56, 0xa2, 0xaa, 0x69,
+        0x9d, 0xc9, 0xec, 0x9e, 0xe9, 0x4b, 0x99, 0x89, 0x5e, 0x83, 0x68, 0x6b, 0x86, 0xc7, 0x22, 0x70,
+        0x27, 0x40, 0x5d, 0x76, 0x12, 0x61, 0x44, 0xc2, 0x50, 0xf4, 0xcc, 0x4c, 0x44, 0xc3, 0x4c, 0xa5,
+        0x49, 0x4e, 0xc5, 0x31, 0x69, 0xe6, 0x71, 0x67, 0x17, 0xb0, 0x7c, 0x27, 0x85, 0x98, 0xa9, 0x50,
+        0x95, 0x3a, 0xc1, 0xa7, 0x0a, 0xaa, 0xb9, 0x2b, 0x7b, 0xb8, 0x1b, 0x2c, 0xb8, 0x8b, 0x4f, 0xa9,
+        0xda, 0xb7, 0xab, 0x59, 0x94, 0x99, 0x89, 0xd8, 0x82, 0xd8, 0x4d, 0x85, 0x76, 0xe6, 0x75, 0x87,
+        0x1a, 0x62, 0xa6, 0x31, 0x63, 0x56, 0x8a, 0x64, 0x06, 0x84, 0x6f, 0x96, 0xd8, 0x6d, 0xc8, 0x30,
+        0x84, 0x17, 0xff, 0x97, 0x09, 0x4d, 0x94, 0xfb, 0x3e, 0xac, 0xeb, 0x10, 0xbe, 0xeb, 0xea, 0xbe,
+        0x7c, 0x27, 0xc5, 0xac, 0x1c, 0xba, 0x8b, 0xd3, 0xbd, 0x3a, 0xd9, 0xab, 0x7a, 0xf6, 0x95, 0xd9,
+        0x9d, 0x99, 0x87, 0x9c, 0x7f, 0xa7, 0xc0, 0x69, 0xb6, 0xbf, 0x6c, 0x16, 0x0d, 0x5c, 0xd6, 0x08,
+        0x64, 0x56, 0x36, 0x63, 0x76, 0x93, 0x6a, 0xe6, 0x7c, 0x80, 0x67, 0xce, 0x7d, 0x69, 0x51, 0x8f,
+        0x59, 0x30, 0xa9, 0x0a, 0x66, 0xa6, 0x0a, 0xc8, 0xb0, 0x8a, 0xce, 0xae, 0x2a, 0xd4, 0xad, 0xaa,
+        0x40, 0xa2, 0xda, 0x71, 0x8d, 0xb8, 0xff, 0x8f, 0x47, 0x26, 0x7a, 0x17, 0x64, 0x59, 0xf5, 0xb7,
+        0x5b, 0xa4, 0xf0, 0x4d, 0x15, 0x14, 0x44, 0xf4, 0x4f, 0x44, 0xb4, 0xa3, 0x4c, 0x64, 0x8b, 0x56,
+        0xe5, 0x43, 0x54, 0x27, 0x22, 0x6a, 0x56, 0xeb, 0x83, 0x68, 0x15, 0x81, 0x29, 0x30, 0x93, 0xb9,
+        0x02, 0x99, 0x09, 0x94, 0x99, 0xb9, 0x8e, 0x95, 0x99, 0x93, 0x89, 0xa8, 0xd7, 0x8d, 0x47, 0x0b,
+        0x76, 0xd7, 0x32, 0x5c, 0x65, 0xfd, 0x60, 0x24, 0x9c, 0x47, 0x94, 0xba, 0x41, 0x74, 0x2b, 0x42,
+        0x93, 0xb2, 0x3e, 0x53, 0xa9, 0x4b, 0x84, 0x87, 0x48, 0xd5, 0xf2, 0x58, 0xd5, 0xd0, 0x79, 0xa7,
+        0x5b, 0x75, 0xd8, 0xae, 0x8d, 0x18, 0x90, 0x9d, 0x89, 0xb2, 0x9b, 0x4a, 0x56, 0xa2, 0x8a, 0x65,
+        0x9d, 0xe9, 0xf0, 0x9f, 0x59, 0x55, 0x99, 0xb9, 0x61, 0x83, 0x58, 0x77, 0x87, 0x97, 0x26, 0x70,
+        0xa7, 0x44, 0x5e, 0x26, 0x1a, 0x61, 0x54, 0xc6, 0x51, 0x24, 0xd3, 0x4b, 0xa4, 0xc3, 0x4c, 0xb5,
+        0x48, 0x4e, 0xc5, 0x2a, 0x68, 0xe6, 0x6b, 0x66, 0x97, 0xa9, 0x7b, 0x97, 0x7a, 0x97, 0xf9, 0x46,
+        0x94, 0xca, 0xc1, 0xa6, 0x5a, 0xaa, 0xb9, 0x0b, 0x83, 0xb7, 0x9b, 0x2e, 0xb8, 0xdb, 0x4b, 0xaa,
+        0x0a, 0xb7, 0xab, 0x89, 0x9e, 0x99, 0xb9, 0xe4, 0x83, 0x88, 0x60, 0x85, 0xc6, 0xf0, 0x75, 0xb7,
+        0x1a, 0x62, 0xd6, 0x32, 0x63, 0xe6, 0x83, 0x64, 0x86, 0x82, 0x6f, 0x16, 0xd0, 0x6d, 0x18, 0x2b,
+        0x83, 0x67, 0xfa, 0x97, 0x09, 0x44, 0x94, 0xbb, 0x3a, 0xac, 0x4b, 0x0c, 0xbe, 0xab, 0xdf, 0xbe,
+        0x3c, 0x2a, 0xc5, 0x8c, 0x1d, 0xba, 0xfb, 0xd4, 0xbe, 0x0a, 0xe3, 0xab, 0xcb, 0x00, 0x96, 0x99,
+        0xad, 0x9a, 0x37, 0xa9, 0x80, 0x17, 0xcb, 0x6a, 0x16, 0xc8, 0x6c, 0xc6, 0x0a, 0x5d, 0x16, 0x0a,
+        0x64, 0x26, 0x37, 0x62, 0xd6, 0x8f, 0x6a, 0xa6, 0x6a, 0x80, 0x67, 0xcb, 0x7c, 0xd9, 0x4d, 0x8e,
+        0x79, 0x29, 0xa8, 0xaa, 0x5d, 0xa6, 0x4a, 0xc9, 0xb0, 0xfa, 0xca, 0xae, 0x5a, 0xda, 0xad, 0xba,
+        0x43, 0xa3, 0x5a, 0x70, 0x8e, 0x69, 0x06, 0x90, 0x07, 0x24, 0x7a, 0xa7, 0x6b, 0x5a, 0x25, 0xcc,
+        0x5c, 0xa4, 0xf5, 0x4d, 0x35, 0x14, 0x44, 0xc4, 0x4f, 0x44, 0xa4, 0xa6, 0x4c, 0xd4, 0x8a, 0x56,
+        0x25, 0x3a, 0x54, 0x17, 0x1b, 0x6a, 0x46, 0xdd, 0x82, 0xd8, 0x0b, 0x80, 0xd9, 0x2e, 0x93, 0x88,
+        0xfa, 0x98, 0xc9, 0x91, 0x99, 0xc9, 0x91, 0x95, 0x99, 0x8f, 0x8a, 0xc8, 0xe5, 0x8d, 0x97, 0x11,
+        0x77, 0x67, 0x36, 0x5d, 0x06, 0x03, 0x60, 0x34, 0xa2, 0x47, 0xc4, 0xbf, 0x41, 0xb4, 0x30, 0x42,
+        0x73, 0xae, 0x3e, 0x13, 0xa3, 0x4a, 0xe4, 0x84, 0x48, 0x85, 0xe8, 0x58, 0x85, 0xc2, 0x79, 0x57,
+        0x58, 0x75, 0x88, 0xa3, 0x8c, 0x88, 0x85, 0x9d, 0x39, 0xab, 0x9a, 0xba, 0x57, 0xa2, 0x4a, 0x69,
+        0x9d, 0xf9, 0xf5, 0x9f, 0x69, 0x55, 0x9a, 0x69, 0x64, 0x84, 0x28, 0x77, 0x87, 0xe7, 0x25, 0x70,
+        0xe7, 0x4f, 0x5e, 0x56, 0x1b, 0x61, 0xc4, 0xcc, 0x51, 0x64, 0xd7, 0x4c, 0x14, 0xc5, 0x4c, 0x65,
+        0x48, 0x4e, 0xc5, 0x29, 0x69, 0x06, 0x69, 0x66, 0x47, 0xa5, 0x7b, 0x37, 0x6f, 0x97, 0xa9, 0x43,
+        0x94, 0x5a, 0xbd, 0xa6, 0x9a, 0xa0, 0xb9, 0x2b, 0x74, 0xb8, 0x0b, 0x2b, 0xb8, 0xeb, 0x4e, 0xaa,
+        0x4a, 0xb8, 0xac, 0x09, 0xa7, 0x99, 0xf9, 0xe2, 0x83, 0xf8, 0x60, 0x85, 0x86, 0xef, 0x76, 0x77,
+        0x23, 0x62, 0xb6, 0x36, 0x63, 0xb6, 0x87, 0x64, 0xb6, 0x83, 0x6e, 0xa6, 0xca, 0x6c, 0xd8, 0x26,
+        0x83, 0x47, 0xf3, 0x96, 0x99, 0x3c, 0x94, 0x1b, 0x36, 0xab, 0xab, 0x06, 0xbe, 0x6b, 0xdf, 0xbd,
+        0xdc, 0x29, 0xc5, 0xac, 0x21, 0xbb, 0x3b, 0xd6, 0xbd, 0xba, 0xe4, 0xac, 0x0a, 0xfe, 0x97, 0x39,
+        0xac, 0x9a, 0x97, 0xb1, 0x80, 0xc7, 0xcd, 0x6a, 0x66, 0xcf, 0x6c, 0xe6, 0x0b, 0x5c, 0xb6, 0x0f,
+        0x64, 0x16, 0x32, 0x63, 0x06, 0x88, 0x6a, 0x86, 0x6a, 0x80, 0x17, 0xc4, 0x7c, 0x69, 0x47, 0x8e,
+        0x59, 0x20, 0xa8, 0x7a, 0x5b, 0xa5, 0x8a, 0xc9, 0xb0, 0x4a, 0xcf, 0xad, 0xda, 0xd7, 0xae, 0x0a,
+        0x47, 0xa3, 0x2a, 0x77, 0x8e, 0x99, 0x08, 0x90, 0x87, 0x37, 0x7b, 0x17, 0x72, 0x5a, 0xe5, 0xcc,
+        0x5c, 0xf4, 0xf1, 0x4d, 0x75, 0x15, 0x44, 0xa4, 0x4b, 0x44, 0x64, 0x9b, 0x4c, 0x74, 0x82, 0x55,
+        0x65, 0x34, 0x53, 0xf7, 0x0f, 0x69, 0xb6, 0xd7, 0x82, 0x18, 0x08, 0x80, 0x19, 0x25, 0x93, 0x98,
+        0xf8, 0x98, 0xf9, 0x90, 0x99, 0x29, 0x96, 0x95, 0xb9, 0x99, 0x8a, 0x88, 0xe4, 0x8d, 0x57, 0x1d,
+        0x77, 0xf7, 0x3a, 0x5d, 0x76, 0x08, 0x60, 0xf4, 0xa4, 0x48, 0x54, 0xc7, 0x41, 0x84, 0x2e, 0x42,
+        0xa3, 0xad, 0x3d, 0xf3, 0x9e, 0x4a, 0x94, 0x7e, 0x48, 0x45, 0xe7, 0x57, 0xe5, 0xc3, 0x78, 0xe7,
+        0x55, 0x75, 0x18, 0x9f, 0x8c, 0x48, 0x80, 0x9d, 0x39, 0xa9, 0x9a, 0xca, 0x56, 0xa2, 0x5a, 0x6a,
+        0x9d, 0xe9, 0xf4, 0x9f, 0x29, 0x5b, 0x9a, 0x29, 0x66, 0x84, 0x48, 0x7c, 0x88, 0x37, 0x2f, 0x71,
+        0x17, 0x51, 0x5e, 0x76, 0x26, 0x62, 0x24, 0xc9, 0x51, 0x34, 0xd8, 0x4c, 0x14, 0xc3, 0x4c, 0xb5,
+        0x44, 0x4e, 0x95, 0x30, 0x68, 0xc6, 0x67, 0x65, 0xf7, 0x9e, 0x7a, 0xd7, 0x6b, 0x97, 0x79, 0x3f,
+        0x94, 0x2a, 0xb4, 0xa6, 0x3a, 0x9f, 0xb8, 0xeb, 0x73, 0xb7, 0x2b, 0x2e, 0xb9, 0x3b, 0x51, 0xaa,
+        0xca, 0xbc, 0xab, 0xa9, 0xab, 0x9a, 0x99, 0xe0, 0x83, 0xf8, 0x65, 0x86, 0x56, 0xf8, 0x76, 0x97,
+        0x21, 0x62, 0xc6, 0x38, 0x63, 0x76, 0x86, 0x64, 0x36, 0x83, 0x6e, 0xf6, 0xcc, 0x6c, 0x58, 0x21,
+        0x83, 0x27, 0xf2, 0x96, 0xb9, 0x3e, 0x93, 0xab, 0x33, 0xab, 0xbb, 0x00, 0xbe, 0x4b, 0xdd, 0xbe,
+        0x0c, 0x23, 0xc5, 0x9c, 0x1a, 0xbb, 0x9b, 0xdb, 0xbe, 0x0a, 0xee, 0xac, 0x2b, 0x08, 0x96, 0xb9,
+        0xb9, 0x9a, 0xe7, 0xb6, 0x81, 0x47, 0xd2, 0x6a, 0xe6, 0xcf, 0x6d, 0x06, 0x05, 0x5c, 0xb6, 0x11,
+        0x63, 0xe6, 0x38, 0x62, 0xc6, 0x83, 0x6a, 0x46, 0x64, 0x7f, 0x57, 0xc0, 0x7c, 0x49, 0x43, 0x8d,
+        0xa9, 0x1f, 0xa8, 0x4a, 0x59, 0xa5, 0x4a, 0xc7, 0xb0, 0xaa, 0xc7, 0xae, 0x9a, 0xdd, 0xad, 0xda,
+        0x4b, 0xa3, 0x5a, 0x7c, 0x8e, 0xf9, 0x0f, 0x90, 0xb7, 0x38, 0x7b, 0x37, 0x77, 0x5b, 0x65, 0xc8,
+        0x5c, 0xf4, 0xfc, 0x4e, 0x35, 0x1b, 0x44, 0x94, 0x4d, 0x44, 0x54, 0x9b, 0x4c, 0x34, 0x83, 0x55,
+        0x85, 0x38, 0x53, 0x07, 0x0b, 0x69, 0x06, 0xd2, 0x82, 0x58, 0x0a, 0x80, 0x79, 0x28, 0x93, 0x88,
+        0xf5, 0x98, 0xd9, 0x91, 0x99, 0x99, 0x96, 0x95, 0xc9, 0x98, 0x8a, 0xb8, 0xe3, 0x8e, 0x57, 0x1d,
+        0x78, 0x37, 0x46, 0x5d, 0x96, 0x13, 0x61, 0x74, 0xab, 0x48, 0x94, 0xc6, 0x41, 0x54, 0x2e, 0x42,
+        0xa3, 0xa9, 0x3e, 0x13, 0xaa, 0x4a, 0x94, 0x82, 0x48, 0x35, 0xe1, 0x57, 0xe5, 0xb5, 0x78, 0xb7,
+        0x4e, 0x74, 0x88, 0x98, 0x8b, 0xa8, 0x78, 0x9c, 0xe9, 0xa5, 0x9a, 0xba, 0x57, 0xa2, 0xca, 0x65
+    }
+};
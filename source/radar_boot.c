@@ -0,0 +1,95 @@
+/*****************************************************************************
+ * File name: radar_boot.c
+ *
+ * Description: This file implements the boot timeline: start and end of the
+ * startup phases and the first frame and result after reset.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <string.h>
+
+#include "radar_dsp.h"
+#include "radar_boot.h"
+
+/*
+ * Start the timeline
+ */
+void radar_boot_init(radar_boot_s *boot)
+{
+    (void)memset(boot, 0, sizeof(*boot));
+    boot->origin = radar_dsp_cycles();
+}
+
+/*
+ * Mark the start of a phase
+ */
+int32_t radar_boot_begin(radar_boot_s *boot, const char *name)
+{
+    radar_boot_phase_s *phase;
+
+    if (boot->num_phases >= RADAR_BOOT_PHASES_MAX)
+    {
+        return -1;
+    }
+
+    phase = &boot->phases[boot->num_phases];
+    phase->name = name;
+    phase->start = radar_dsp_cycles() - boot->origin;
+    phase->end = 0;
+
+    return (int32_t)boot->num_phases++;
+}
+
+/*
+ * Mark the end of a phase
+ */
+void radar_boot_end(radar_boot_s *boot, int32_t phase)
+{
+    if ((phase < 0) || ((uint32_t)phase >= boot->num_phases))
+    {
+        return;
+    }
+
+    boot->phases[phase].end = radar_dsp_cycles() - boot->origin;
+}
+
+/*
+ * Mark the first frame read
+ */
+void radar_boot_first_frame(radar_boot_s *boot)
+{
+    if (!boot->first_frame_done)
+    {
+        boot->first_frame = radar_dsp_cycles() - boot->origin;
+        boot->first_frame_done = true;
+    }
+}
+
+/*
+ * Mark the first result of the inference
+ */
+void radar_boot_first_result(radar_boot_s *boot)
+{
+    if (!boot->first_result_done)
+    {
+        boot->first_result = radar_dsp_cycles() - boot->origin;
+        boot->first_result_done = true;
+    }
+}
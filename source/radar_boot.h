@@ -0,0 +1,113 @@
+/******************************************************************************
+** File name: radar_boot.h
+**
+** Description: This file contains the interface of the boot timeline. The
+**   application marks the start and end of every startup phase and the
+**   first frame and first result after reset. Times are cycles of the
+**   cycle counter, counted from its initialization right after the board
+**   support package is initialized. Phases may overlap.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_BOOT_H_
+#define RADAR_BOOT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_BOOT_PHASES_MAX
+ * Phases of the timeline
+ */
+#define RADAR_BOOT_PHASES_MAX               (12U)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_boot_phase_s
+ * Startup phase
+ */
+typedef struct {
+    const char *name;
+    uint32_t start;                     /*<< cycles from the origin */
+    uint32_t end;                       /*<< cycles from the origin, 0 while running */
+} radar_boot_phase_s;
+
+/*
+ * @typedef typedef struct  radar_boot_s
+ * Boot timeline
+ */
+typedef struct {
+    uint32_t origin;                    /*<< cycle counter at the start of the timeline */
+    uint32_t num_phases;
+    radar_boot_phase_s phases[RADAR_BOOT_PHASES_MAX];
+
+    volatile bool first_frame_done;
+    uint32_t first_frame;               /*<< cycles from the origin to the first frame read */
+    volatile bool first_result_done;
+    uint32_t first_result;              /*<< cycles from the origin to the first inference */
+} radar_boot_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Start the timeline at the current cycle count
+ *
+ * @param[out] boot timeline
+ */
+void radar_boot_init(radar_boot_s *boot);
+
+/** @brief Mark the start of a phase
+ *
+ * @param[in,out] boot timeline
+ * @param[in] name phase name, kept by reference
+ *
+ * @return phase for \ref radar_boot_end, -1 if the timeline has
+ *         RADAR_BOOT_PHASES_MAX phases
+ */
+int32_t radar_boot_begin(radar_boot_s *boot, const char *name);
+
+/** @brief Mark the end of a phase
+ *
+ * @param[in,out] boot timeline
+ * @param[in] phase phase returned by \ref radar_boot_begin, -1 is ignored
+ */
+void radar_boot_end(radar_boot_s *boot, int32_t phase);
+
+/** @brief Mark the first frame read, later calls are ignored
+ *
+ * @param[in,out] boot timeline
+ */
+void radar_boot_first_frame(radar_boot_s *boot);
+
+/** @brief Mark the first result of the inference, later calls are ignored
+ *
+ * @param[in,out] boot timeline
+ */
+void radar_boot_first_result(radar_boot_s *boot);
+
+#endif /* RADAR_BOOT_H_ */
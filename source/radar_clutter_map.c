@@ -0,0 +1,289 @@
+/*****************************************************************************
+ * File name: radar_clutter_map.c
+ *
+ * Description: This file implements the static clutter map. Mean chirp,
+ * background update and subtraction run on whole antenna planes with the
+ * CMSIS-DSP vector functions, RADAR_DSP_REFERENCE selects plain loops for
+ * host builds.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <string.h>
+
+#include "radar_clutter_map.h"
+
+/*******************************************************************************
+ * Function Name: vec_add
+ ********************************************************************************
+ * Summary:
+ *   dst = a + b, element wise
+ *
+ * Parameters:
+ *   a: first operand
+ *   b: second operand
+ *   dst: result, may alias an operand
+ *   n: number of elements
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static inline void vec_add(const float32_t *a, const float32_t *b, float32_t *dst, uint32_t n)
+{
+#ifdef RADAR_DSP_REFERENCE
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        dst[i] = a[i] + b[i];
+    }
+#else
+    arm_add_f32(a, b, dst, n);
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: vec_sub
+ ********************************************************************************
+ * Summary:
+ *   dst = a - b, element wise
+ *
+ * Parameters:
+ *   a: minuend
+ *   b: subtrahend
+ *   dst: result, may alias an operand
+ *   n: number of elements
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static inline void vec_sub(const float32_t *a, const float32_t *b, float32_t *dst, uint32_t n)
+{
+#ifdef RADAR_DSP_REFERENCE
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        dst[i] = a[i] - b[i];
+    }
+#else
+    arm_sub_f32(a, b, dst, n);
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: vec_scale
+ ********************************************************************************
+ * Summary:
+ *   dst = a * scale, element wise
+ *
+ * Parameters:
+ *   a: operand
+ *   scale: scale factor
+ *   dst: result, may alias an operand
+ *   n: number of elements
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static inline void vec_scale(const float32_t *a, float32_t scale, float32_t *dst, uint32_t n)
+{
+#ifdef RADAR_DSP_REFERENCE
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        dst[i] = a[i] * scale;
+    }
+#else
+    arm_scale_f32(a, scale, dst, n);
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: mean_chirps
+ ********************************************************************************
+ * Summary:
+ *   Averages the chirps of every antenna plane of a frame into cm->mean
+ *
+ * Parameters:
+ *   cm: clutter map state
+ *   frame: de-interleaved frame
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void mean_chirps(radar_clutter_map_s *cm, const float32_t *frame)
+{
+    const uint32_t n = cm->num_samples_per_chirp;
+
+    for (uint32_t antenna = 0; antenna < cm->num_rx_antennas; ++antenna)
+    {
+        const float32_t *plane = &frame[antenna * cm->num_chirps_per_frame * n];
+        float32_t *mean = &cm->mean[antenna * n];
+
+        memcpy(mean, plane, n * sizeof(float32_t));
+
+        for (uint32_t chirp = 1; chirp < cm->num_chirps_per_frame; ++chirp)
+        {
+            vec_add(mean, &plane[chirp * n], mean, n);
+        }
+    }
+
+    vec_scale(cm->mean, 1.0f / (float32_t)cm->num_chirps_per_frame,
+              cm->mean, cm->num_rx_antennas * n);
+}
+
+/*******************************************************************************
+ * Function Name: update_background
+ ********************************************************************************
+ * Summary:
+ *   background += alpha * (mean - background), cm->mean is overwritten
+ *
+ * Parameters:
+ *   cm: clutter map state
+ *   alpha: weight of the current frame
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void update_background(radar_clutter_map_s *cm, float32_t alpha)
+{
+    const uint32_t len = cm->num_rx_antennas * cm->num_samples_per_chirp;
+
+    vec_sub(cm->mean, cm->background, cm->mean, len);
+    vec_scale(cm->mean, alpha, cm->mean, len);
+    vec_add(cm->background, cm->mean, cm->background, len);
+}
+
+/*
+ * Initialize clutter map
+ */
+int32_t radar_clutter_map_init(radar_clutter_map_s *cm,
+                               uint32_t num_samples_per_chirp,
+                               uint32_t num_chirps_per_frame,
+                               uint32_t num_rx_antennas,
+                               void* (*alloc_func)(size_t size))
+{
+    if ((NULL == cm) || (NULL == alloc_func) || (0U == num_samples_per_chirp) ||
+        (0U == num_chirps_per_frame) || (0U == num_rx_antennas))
+    {
+        return -1;
+    }
+
+    /* a disabled map stays disabled, any other mode learns the new geometry first */
+    radar_clutter_map_mode_e mode = (cm->requested_mode == RADAR_CLUTTER_MAP_MODE_OFF) ?
+            RADAR_CLUTTER_MAP_MODE_OFF : RADAR_CLUTTER_MAP_MODE_LEARN;
+
+    memset(cm, 0, sizeof(radar_clutter_map_s));
+
+    cm->num_samples_per_chirp = num_samples_per_chirp;
+    cm->num_chirps_per_frame = num_chirps_per_frame;
+    cm->num_rx_antennas = num_rx_antennas;
+    cm->mode = mode;
+    cm->requested_mode = mode;
+
+    cm->background = (float32_t*)alloc_func(num_samples_per_chirp * num_rx_antennas * sizeof(float32_t));
+    cm->mean = (float32_t*)alloc_func(num_samples_per_chirp * num_rx_antennas * sizeof(float32_t));
+
+    if ((NULL == cm->background) || (NULL == cm->mean))
+    {
+        return -2;
+    }
+
+    memset(cm->background, 0, num_samples_per_chirp * num_rx_antennas * sizeof(float32_t));
+
+    return 0;
+}
+
+/*
+ * Select operating mode
+ */
+void radar_clutter_map_set_mode(radar_clutter_map_s *cm, radar_clutter_map_mode_e mode)
+{
+    if (mode < RADAR_CLUTTER_MAP_MODE_NUM)
+    {
+        cm->requested_mode = mode;
+    }
+}
+
+/*
+ * Suspend background updates
+ */
+void radar_clutter_map_hold(radar_clutter_map_s *cm, uint32_t frames)
+{
+    if (frames > cm->hold_frames)
+    {
+        cm->hold_frames = frames;
+    }
+}
+
+/*
+ * Subtract background and update it
+ */
+void radar_clutter_map_run(radar_clutter_map_s *cm, float32_t *frame)
+{
+    const uint32_t n = cm->num_samples_per_chirp;
+    uint32_t cycles;
+
+    if (cm->requested_mode != cm->mode)
+    {
+        cm->mode = cm->requested_mode;
+        cm->learned_frames = 0;
+    }
+
+    if (cm->mode == RADAR_CLUTTER_MAP_MODE_OFF)
+    {
+        return;
+    }
+
+    cycles = radar_dsp_cycles();
+
+    mean_chirps(cm, frame);
+
+    if ((cm->mode == RADAR_CLUTTER_MAP_MODE_TRACK) || (cm->mode == RADAR_CLUTTER_MAP_MODE_FROZEN))
+    {
+        for (uint32_t antenna = 0; antenna < cm->num_rx_antennas; ++antenna)
+        {
+            const float32_t *background = &cm->background[antenna * n];
+            float32_t *plane = &frame[antenna * cm->num_chirps_per_frame * n];
+
+            for (uint32_t chirp = 0; chirp < cm->num_chirps_per_frame; ++chirp)
+            {
+                vec_sub(&plane[chirp * n], background, &plane[chirp * n], n);
+            }
+        }
+    }
+
+    if (cm->hold_frames > 0U)
+    {
+        cm->hold_frames--;
+    }
+    else if (cm->mode == RADAR_CLUTTER_MAP_MODE_LEARN)
+    {
+        /* running mean over the learned frames */
+        update_background(cm, 1.0f / (float32_t)(cm->learned_frames + 1U));
+
+        if (++cm->learned_frames >= RADAR_CLUTTER_MAP_LEARN_FRAMES)
+        {
+            cm->mode = RADAR_CLUTTER_MAP_MODE_TRACK;
+            cm->requested_mode = RADAR_CLUTTER_MAP_MODE_TRACK;
+        }
+    }
+    else if (cm->mode == RADAR_CLUTTER_MAP_MODE_TRACK)
+    {
+        update_background(cm, RADAR_CLUTTER_MAP_ALPHA);
+    }
+
+    radar_dsp_stats_add(&cm->stats, radar_dsp_cycles() - cycles);
+}
@@ -0,0 +1,152 @@
+/******************************************************************************
+** File name: radar_clutter_map.h
+**
+** Description: This file contains the interface of the static clutter map.
+**   The map holds the background chirp of every antenna as an exponential
+**   moving average and subtracts it from the de-interleaved frame before the
+**   frame reaches the gestures library and the range transform. A chirp of N
+**   real samples carries the same information as N/2 complex range bins, so
+**   the background is kept in the time domain and costs no transform.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_CLUTTER_MAP_H_
+#define RADAR_CLUTTER_MAP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "radar_dsp.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_CLUTTER_MAP_LEARN_FRAMES
+ * Frames averaged at startup before the background is subtracted
+ */
+#define RADAR_CLUTTER_MAP_LEARN_FRAMES      (32U)
+
+/*
+ * @def RADAR_CLUTTER_MAP_ALPHA
+ * Weight of a new frame in the moving average once the background is learned,
+ * a time constant of about two seconds at 33 frames per second
+ */
+#define RADAR_CLUTTER_MAP_ALPHA             (1.0f / 64.0f)
+
+/*
+ * @def RADAR_CLUTTER_MAP_MEM_SIZE
+ * Bytes the map allocates: background and mean chirp of every antenna
+ */
+#define RADAR_CLUTTER_MAP_MEM_SIZE(samples, antennas) \
+    (2U * (samples) * (antennas) * sizeof(float32_t))
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_clutter_map_mode_e
+ * Clutter map operating mode
+ */
+typedef enum
+{
+    RADAR_CLUTTER_MAP_MODE_OFF = 0,     /*<< frames pass unmodified, background is not updated */
+    RADAR_CLUTTER_MAP_MODE_LEARN = 1,   /*<< background is averaged, frames pass unmodified */
+    RADAR_CLUTTER_MAP_MODE_TRACK = 2,   /*<< background is subtracted and follows slow changes */
+    RADAR_CLUTTER_MAP_MODE_FROZEN = 3,  /*<< background is subtracted and kept */
+    RADAR_CLUTTER_MAP_MODE_NUM
+} radar_clutter_map_mode_e;
+
+/*
+ * @typedef typedef struct  radar_clutter_map_s
+ * Clutter map state
+ */
+typedef struct {
+    uint32_t num_samples_per_chirp;
+    uint32_t num_chirps_per_frame;
+    uint32_t num_rx_antennas;
+
+    radar_clutter_map_mode_e mode;
+    volatile radar_clutter_map_mode_e requested_mode; /*<< applied at the start of the next frame */
+    uint32_t learned_frames;        /*<< frames averaged in learn mode */
+    volatile uint32_t hold_frames;  /*<< frames left without background update */
+
+    float32_t *background;          /*<< [antenna][sample] background chirp */
+    float32_t *mean;                /*<< [antenna][sample] mean chirp of the current frame */
+
+    radar_dsp_stats_s stats;        /*<< cycles per frame */
+} radar_clutter_map_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize clutter map
+ *
+ * The map starts learning the background unless the mode requested before
+ * is \ref RADAR_CLUTTER_MAP_MODE_OFF. On re-initialization for another frame
+ * geometry a disabled map stays disabled, otherwise learning restarts.
+ *
+ * @param[in,out] cm clutter map state
+ * @param[in] num_samples_per_chirp samples per chirp
+ * @param[in] num_chirps_per_frame chirps per frame
+ * @param[in] num_rx_antennas number of antennas
+ * @param[in] alloc_func allocator returning memory aligned to at least 8 bytes
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid, -2 if allocation fails
+ */
+int32_t radar_clutter_map_init(radar_clutter_map_s *cm,
+                               uint32_t num_samples_per_chirp,
+                               uint32_t num_chirps_per_frame,
+                               uint32_t num_rx_antennas,
+                               void* (*alloc_func)(size_t size));
+
+/** @brief Select operating mode
+ *
+ * The mode takes effect with the next frame, so it can be selected from
+ * another task. Selecting learn mode discards the background.
+ *
+ * @param[in,out] cm clutter map state
+ * @param[in] mode operating mode
+ */
+void radar_clutter_map_set_mode(radar_clutter_map_s *cm, radar_clutter_map_mode_e mode);
+
+/** @brief Suspend background updates
+ *
+ * Used while a gesture is in progress, so the hand does not become part
+ * of the background. May be called from another task than the one running
+ * the map, a concurrent update shortens the hold by at most one frame.
+ *
+ * @param[in,out] cm clutter map state
+ * @param[in] frames number of frames without background update
+ */
+void radar_clutter_map_hold(radar_clutter_map_s *cm, uint32_t frames);
+
+/** @brief Subtract background from a frame and update the background
+ *
+ * @param[in,out] cm clutter map state
+ * @param[in,out] frame de-interleaved frame [antenna][chirp][sample], modified in place
+ */
+void radar_clutter_map_run(radar_clutter_map_s *cm, float32_t *frame);
+
+#endif /* RADAR_CLUTTER_MAP_H_ */
@@ -0,0 +1,234 @@
+/*****************************************************************************
+ * File name: radar_config_store.c
+ *
+ * Description: This file implements the persistent configuration store:
+ * a ring of slots holding CRC protected records, the newest valid one is
+ * current.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "radar_config_store.h"
+
+/* bytes of the header covered by the CRC */
+#define HEADER_CRC_BYTES            (offsetof(radar_config_store_header_s, crc))
+
+/*******************************************************************************
+ * Function Name: crc32_update
+ ********************************************************************************
+ * Summary:
+ *   Updates a CRC-32 (IEEE 802.3, reflected) with bytes, bitwise as the
+ *   records are small and seldom checked
+ *
+ * Parameters:
+ *   crc: CRC so far, 0xFFFFFFFF to start
+ *   data: bytes
+ *   len: number of bytes
+ *
+ * Return:
+ *   updated CRC, to be inverted after the last bytes
+ *******************************************************************************/
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; ++i)
+    {
+        crc ^= data[i];
+        for (uint32_t bit = 0; bit < 8U; ++bit)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+        }
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+ * Function Name: record_crc
+ ********************************************************************************
+ * Summary:
+ *   CRC-32 of a record
+ *
+ * Parameters:
+ *   header: header of the record
+ *   payload: payload of header->size bytes
+ *
+ * Return:
+ *   CRC
+ *******************************************************************************/
+static uint32_t record_crc(const radar_config_store_header_s *header, const uint8_t *payload)
+{
+    uint32_t crc = 0xFFFFFFFFUL;
+
+    crc = crc32_update(crc, (const uint8_t*)header, HEADER_CRC_BYTES);
+    crc = crc32_update(crc, payload, header->size);
+
+    return ~crc;
+}
+
+/*
+ * Initialize the store
+ */
+int32_t radar_config_store_init(radar_config_store_s *store, const radar_config_store_backend_s *backend)
+{
+    if ((store == NULL) || (backend == NULL) || (backend->read == NULL) || (backend->write == NULL) ||
+        (backend->num_slots < 2U) || (backend->num_slots > RADAR_CONFIG_STORE_SLOTS_MAX) ||
+        (backend->slot_size < RADAR_CONFIG_STORE_RECORD_SIZE(RADAR_CONFIG_STORE_PAYLOAD_MAX)))
+    {
+        return -1;
+    }
+
+    (void)memset(store, 0, sizeof(*store));
+    store->backend = backend;
+
+    for (uint32_t slot = 0; slot < backend->num_slots; ++slot)
+    {
+        radar_config_store_header_s header;
+
+        if (backend->read(backend->ctx, slot * backend->slot_size, &header, sizeof(header)) != 0)
+        {
+            return -2;
+        }
+
+        if ((header.magic == RADAR_CONFIG_STORE_MAGIC) && (header.size <= RADAR_CONFIG_STORE_PAYLOAD_MAX))
+        {
+            store->sequences[slot] = header.sequence;
+        }
+
+        /* the CRC is checked on load, a torn newest record still advances the sequence */
+        if (store->sequences[slot] > store->sequence)
+        {
+            store->sequence = store->sequences[slot];
+            store->slot = slot;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Load the current record
+ */
+int32_t radar_config_store_load(radar_config_store_s *store, uint16_t version, void *payload, uint32_t size)
+{
+    const radar_config_store_backend_s *backend;
+    uint32_t below = UINT32_MAX;
+
+    if ((store == NULL) || (store->backend == NULL) || (payload == NULL) || (size > RADAR_CONFIG_STORE_PAYLOAD_MAX))
+    {
+        return -1;
+    }
+    backend = store->backend;
+
+    /* newest to oldest record */
+    for (;;)
+    {
+        uint8_t record[RADAR_CONFIG_STORE_RECORD_SIZE(RADAR_CONFIG_STORE_PAYLOAD_MAX)];
+        radar_config_store_header_s header;
+        uint32_t sequence = 0;
+        uint32_t slot = 0;
+
+        for (uint32_t i = 0; i < backend->num_slots; ++i)
+        {
+            if ((store->sequences[i] > sequence) && (store->sequences[i] < below))
+            {
+                sequence = store->sequences[i];
+                slot = i;
+            }
+        }
+        if (sequence == 0U)
+        {
+            return -2;
+        }
+        below = sequence;
+
+        if (backend->read(backend->ctx, slot * backend->slot_size, record, sizeof(record)) != 0)
+        {
+            continue;
+        }
+        (void)memcpy(&header, record, sizeof(header));
+
+        if ((header.sequence != sequence) || (header.size > RADAR_CONFIG_STORE_PAYLOAD_MAX) ||
+            (header.crc != record_crc(&header, &record[sizeof(header)])))
+        {
+            continue;
+        }
+
+        /* the newest record has another layout, older ones are stale */
+        if ((header.version != version) || (header.size != size))
+        {
+            return -2;
+        }
+
+        (void)memcpy(payload, &record[sizeof(header)], size);
+
+        /* the next save goes after the loaded record, never over it */
+        store->slot = slot;
+
+        return 0;
+    }
+}
+
+/*
+ * Save a record
+ */
+int32_t radar_config_store_save(radar_config_store_s *store, uint16_t version, const void *payload, uint32_t size)
+{
+    uint8_t record[RADAR_CONFIG_STORE_RECORD_SIZE(RADAR_CONFIG_STORE_PAYLOAD_MAX)];
+    radar_config_store_header_s header;
+    const radar_config_store_backend_s *backend;
+    uint32_t slot;
+
+    if ((store == NULL) || (store->backend == NULL) || (payload == NULL) || (size > RADAR_CONFIG_STORE_PAYLOAD_MAX))
+    {
+        return -1;
+    }
+    backend = store->backend;
+
+    /* the slot after the current one, every slot takes its turn */
+    slot = (store->sequence == 0U) ? 0U : ((store->slot + 1U) % backend->num_slots);
+
+    header.magic = RADAR_CONFIG_STORE_MAGIC;
+    header.sequence = store->sequence + 1U;
+    header.version = version;
+    header.size = (uint16_t)size;
+    header.crc = record_crc(&header, (const uint8_t*)payload);
+
+    (void)memcpy(record, &header, sizeof(header));
+    (void)memcpy(&record[sizeof(header)], payload, size);
+
+    store->saves++;
+
+    /* the slot may hold a partial record now, it fails its CRC on load */
+    store->sequences[slot] = 0;
+
+    if (backend->write(backend->ctx, slot, record, RADAR_CONFIG_STORE_RECORD_SIZE(size)) != 0)
+    {
+        store->failures++;
+        return -2;
+    }
+
+    store->sequences[slot] = header.sequence;
+    store->sequence = header.sequence;
+    store->slot = slot;
+
+    return 0;
+}
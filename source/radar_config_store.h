@@ -0,0 +1,157 @@
+/******************************************************************************
+** File name: radar_config_store.h
+**
+** Description: This file contains the interface of the persistent
+**   configuration store. The configuration is kept as a record of a
+**   versioned payload protected by a CRC-32 in a ring of slots on a storage
+**   medium, like the emulated EEPROM region of the flash. Every save goes
+**   to the slot after the current one with the next sequence number, so the
+**   writes are spread over all slots and a save torn by a reset leaves the
+**   previous record intact. The medium is accessed through a backend, the
+**   application supplies one for the flash, the host tools one for a file.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_CONFIG_STORE_H_
+#define RADAR_CONFIG_STORE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_CONFIG_STORE_MAGIC
+ * First word of a record, "RCFG"
+ */
+#define RADAR_CONFIG_STORE_MAGIC            (0x47464352UL)
+
+/*
+ * @def RADAR_CONFIG_STORE_SLOTS_MAX
+ * Slots of a store
+ */
+#define RADAR_CONFIG_STORE_SLOTS_MAX        (16U)
+
+/*
+ * @def RADAR_CONFIG_STORE_PAYLOAD_MAX
+ * Bytes of the largest payload
+ */
+#define RADAR_CONFIG_STORE_PAYLOAD_MAX      (128U)
+
+/*
+ * @def RADAR_CONFIG_STORE_RECORD_SIZE
+ * Bytes of a record with the given payload, a slot must hold it
+ */
+#define RADAR_CONFIG_STORE_RECORD_SIZE(payload_size) \
+    (sizeof(radar_config_store_header_s) + (payload_size))
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_config_store_header_s
+ * Header of a record, followed by the payload
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;                  /*<< incremented with every save, the highest valid record is current */
+    uint16_t version;                   /*<< layout of the payload */
+    uint16_t size;                      /*<< payload bytes */
+    uint32_t crc;                       /*<< CRC-32 of the header fields before and of the payload */
+} radar_config_store_header_s;
+
+/*
+ * @typedef typedef struct  radar_config_store_backend_s
+ * Storage medium of a store
+ */
+typedef struct {
+    void *ctx;                          /*<< passed to read and write */
+    uint32_t num_slots;                 /*<< at least two, a torn save must leave a record */
+    uint32_t slot_size;                 /*<< bytes of a slot, the unit the medium is erased and programmed in */
+
+    /** Read bytes at an offset of the medium, zero (0) on success */
+    int32_t (*read)(void *ctx, uint32_t offset, void *data, uint32_t len);
+
+    /** Erase and program a slot with the bytes, the rest of the slot is undefined, zero (0) on success */
+    int32_t (*write)(void *ctx, uint32_t slot, const void *data, uint32_t len);
+} radar_config_store_backend_s;
+
+/*
+ * @typedef typedef struct  radar_config_store_s
+ * Store state
+ */
+typedef struct {
+    const radar_config_store_backend_s *backend;
+    uint32_t sequences[RADAR_CONFIG_STORE_SLOTS_MAX];   /*<< of the slot headers, 0 for a slot without record */
+    uint32_t sequence;                  /*<< of the current record, 0 without record */
+    uint32_t slot;                      /*<< of the current record */
+    uint32_t saves;                     /*<< since initialization */
+    uint32_t failures;                  /*<< saves the backend failed */
+} radar_config_store_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the store from the headers of the slots on the medium
+ *
+ * @param[out] store store
+ * @param[in] backend storage medium, kept by reference
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid,
+ *         -2 if the medium cannot be read
+ */
+int32_t radar_config_store_init(radar_config_store_s *store, const radar_config_store_backend_s *backend);
+
+/** @brief Load the current record
+ *
+ * The record of the newest slot is read at once. A record failing its CRC,
+ * the remains of a torn save, is skipped for the next older one. The next
+ * save goes to the slot after the loaded record.
+ *
+ * @param[in,out] store store
+ * @param[in] version payload layout expected
+ * @param[out] payload payload, unchanged unless loaded
+ * @param[in] size payload bytes expected
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid,
+ *         -2 if there is no valid record of this version and size
+ */
+int32_t radar_config_store_load(radar_config_store_s *store, uint16_t version, void *payload, uint32_t size);
+
+/** @brief Save a record into the slot after the current one
+ *
+ * @note Programming the medium may block for milliseconds, the caller
+ *       must not be on the processing path.
+ *
+ * @param[in,out] store store
+ * @param[in] version payload layout
+ * @param[in] payload payload
+ * @param[in] size payload bytes
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid,
+ *         -2 if the backend failed, the current record is kept
+ */
+int32_t radar_config_store_save(radar_config_store_s *store, uint16_t version, const void *payload, uint32_t size);
+
+#endif /* RADAR_CONFIG_STORE_H_ */
@@ -0,0 +1,210 @@
+/*****************************************************************************
+ * File name: radar_decision.c
+ *
+ * Description: This file implements the gesture decision: detect list,
+ * threshold, vote and hold of the reported gestures.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <string.h>
+
+#include "radar_decision.h"
+
+/*******************************************************************************
+ * Macros
+ ********************************************************************************/
+#define RING_NO_CLASS                       (0xFFU)
+
+/*******************************************************************************
+ * Function Name: ring_push
+ ********************************************************************************
+ * Summary:
+ *   Adds a frame to the ring, the oldest frame leaves a full ring. Votes and
+ *   sums are updated by the frames entering and leaving only. The sum of a
+ *   class is restarted from zero when its last frame leaves, so rounding
+ *   does not build up over time.
+ *
+ * Parameters:
+ *   decision: decision state
+ *   idx: class of the frame
+ *   score: score of the class
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void ring_push(radar_decision_s *decision, uint32_t idx, float32_t score)
+{
+    const uint32_t head = decision->ring_head;
+
+    if (decision->ring_count == decision->vote.window)
+    {
+        const uint32_t old = decision->ring_idx[head];
+
+        if (old != RING_NO_CLASS)
+        {
+            decision->class_frames[old] -= 1U;
+            if (decision->ring_score[head] > decision->vote.score)
+            {
+                decision->class_votes[old] -= 1U;
+            }
+            decision->class_sum[old] = (decision->class_frames[old] == 0U) ?
+                                       0.0f : (decision->class_sum[old] - decision->ring_score[head]);
+        }
+    }
+    else
+    {
+        decision->ring_count += 1U;
+    }
+
+    if (idx < RADAR_DECISION_NUM_CLASSES)
+    {
+        decision->ring_idx[head] = (uint8_t)idx;
+        decision->class_frames[idx] += 1U;
+        if (score > decision->vote.score)
+        {
+            decision->class_votes[idx] += 1U;
+        }
+        decision->class_sum[idx] += score;
+    }
+    else
+    {
+        decision->ring_idx[head] = RING_NO_CLASS;
+    }
+    decision->ring_score[head] = score;
+
+    decision->ring_head = (head + 1U == decision->vote.window) ? 0U : (head + 1U);
+}
+
+/*******************************************************************************
+ * Function Name: ring_clear
+ ********************************************************************************
+ * Summary:
+ *   Removes all frames from the ring
+ *
+ * Parameters:
+ *   decision: decision state
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void ring_clear(radar_decision_s *decision)
+{
+    decision->ring_head = 0;
+    decision->ring_count = 0;
+    (void)memset(decision->class_frames, 0, sizeof(decision->class_frames));
+    (void)memset(decision->class_votes, 0, sizeof(decision->class_votes));
+    (void)memset(decision->class_sum, 0, sizeof(decision->class_sum));
+}
+
+/*
+ * Initialize the decision
+ */
+void radar_decision_init(radar_decision_s *decision, const bool *detect_list, int32_t hold_frames)
+{
+    const radar_decision_vote_s vote = RADAR_DECISION_VOTE_DEFAULT;
+
+    decision->detect_list = detect_list;
+    decision->hold_frames = hold_frames;
+    decision->vote = vote;
+    radar_decision_reset(decision);
+}
+
+/*
+ * Configure the frames an event is decided on
+ */
+int32_t radar_decision_set_vote(radar_decision_s *decision, const radar_decision_vote_s *vote)
+{
+    if ((vote->mode >= RADAR_DECISION_MODE_NUM) ||
+        (vote->window == 0U) || (vote->window > RADAR_DECISION_WINDOW_MAX) ||
+        (vote->votes == 0U) || (vote->votes > vote->window) ||
+        (vote->score < 0.0f) || (vote->integral <= 0.0f))
+    {
+        return -1;
+    }
+
+    decision->vote = *vote;
+    radar_decision_reset(decision);
+
+    return 0;
+}
+
+/*
+ * Forget the frames seen before and release the hold
+ */
+void radar_decision_reset(radar_decision_s *decision)
+{
+    decision->hold = 0;
+    ring_clear(decision);
+}
+
+/*
+ * Decide on the result of a frame
+ */
+radar_decision_e radar_decision_run(radar_decision_s *decision, uint32_t idx, float32_t score, float32_t threshold)
+{
+    radar_decision_e result = RADAR_DECISION_NONE;
+    bool fire;
+
+    /* the ring is not used by single frame decisions, it may not be set up */
+    if (decision->vote.mode != RADAR_DECISION_MODE_FRAME)
+    {
+        ring_push(decision, idx, score);
+    }
+
+    if ((idx >= RADAR_DECISION_NUM_CLASSES) || !decision->detect_list[idx])
+    {
+        return RADAR_DECISION_RELEASE;
+    }
+
+    if (decision->hold > 0)
+    {
+        decision->hold += 1;
+    }
+
+    switch (decision->vote.mode)
+    {
+        case RADAR_DECISION_MODE_VOTE:
+            fire = (decision->class_votes[idx] >= decision->vote.votes);
+            break;
+        case RADAR_DECISION_MODE_INTEGRAL:
+            fire = (decision->class_sum[idx] > decision->vote.integral);
+            break;
+        default:
+            fire = (score > threshold);
+            break;
+    }
+
+    if (fire && (decision->hold == 0))
+    {
+        decision->hold += 1;
+        result = RADAR_DECISION_EVENT;
+    }
+
+    if (decision->hold > decision->hold_frames)
+    {
+        decision->hold = 0;
+        result = RADAR_DECISION_RELEASE;
+
+        /* frames of the held gesture do not vote on the next one */
+        ring_clear(decision);
+    }
+
+    return result;
+}
@@ -0,0 +1,174 @@
+/******************************************************************************
+** File name: radar_decision.h
+**
+** Description: This file contains the interface of the gesture decision.
+**   The decision turns the class and score of every frame into gesture
+**   events: a class on the detect list scoring above the threshold fires an
+**   event, and no further event fires until the hold has expired. Instead
+**   of a single frame, the event can be voted on by the last frames: a class
+**   fires when enough of them score above a lower vote score, or when its
+**   scores over them sum above a threshold. The last frames are kept in a
+**   ring with running votes and sums per class, so a frame costs the same
+**   for any window. The state is kept in the caller's structure, so host
+**   tools can run any number of decisions side by side with the same
+**   behavior as the application.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_DECISION_H_
+#define RADAR_DECISION_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "radar_dsp.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_DECISION_NUM_CLASSES
+ * Classes of the gestures library, the size of the detect list
+ */
+#define RADAR_DECISION_NUM_CLASSES          (8U)
+
+/*
+ * @def RADAR_DECISION_HOLD_FRAMES
+ * Frames of a class on the detect list after an event before the next event
+ */
+#define RADAR_DECISION_HOLD_FRAMES          (10)
+
+/*
+ * @def RADAR_DECISION_WINDOW_MAX
+ * Most frames voting on an event
+ */
+#define RADAR_DECISION_WINDOW_MAX           (16U)
+
+/*
+ * @def RADAR_DECISION_VOTE_DEFAULT
+ * Vote of the decision after init: mode, window, votes, vote score and
+ * score integral
+ */
+#define RADAR_DECISION_VOTE_DEFAULT \
+    { RADAR_DECISION_MODE_FRAME, 4U, 2U, 0.35f, 0.9f }
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_decision_e
+ * Outcome of a frame
+ */
+typedef enum
+{
+    RADAR_DECISION_NONE = 0,            /*<< nothing changed */
+    RADAR_DECISION_EVENT = 1,           /*<< a gesture is reported */
+    RADAR_DECISION_RELEASE = 2          /*<< the hold expired or the class is not detected */
+} radar_decision_e;
+
+/*
+ * @def enum radar_decision_mode_e
+ * Frames an event is decided on
+ */
+typedef enum
+{
+    RADAR_DECISION_MODE_FRAME = 0,      /*<< the frame scores above the threshold */
+    RADAR_DECISION_MODE_VOTE = 1,       /*<< votes of the last window frames of the class score above the vote score */
+    RADAR_DECISION_MODE_INTEGRAL = 2,   /*<< scores of the class over the last window frames sum above the integral */
+    RADAR_DECISION_MODE_NUM
+} radar_decision_mode_e;
+
+/*
+ * @typedef typedef struct  radar_decision_vote_s
+ * Vote configuration
+ */
+typedef struct {
+    radar_decision_mode_e mode;
+    uint32_t window;                    /*<< frames voting, 1 to RADAR_DECISION_WINDOW_MAX */
+    uint32_t votes;                     /*<< votes firing an event, 1 to window */
+    float32_t score;                    /*<< score a frame votes with */
+    float32_t integral;                 /*<< sum of scores firing an event */
+} radar_decision_vote_s;
+
+/*
+ * @typedef typedef struct  radar_decision_s
+ * Decision state
+ */
+typedef struct {
+    const bool *detect_list;            /*<< RADAR_DECISION_NUM_CLASSES entries, true if reported */
+    int32_t hold_frames;
+    int32_t hold;                       /*<< frames counted since the last event, 0 when released */
+
+    radar_decision_vote_s vote;
+    uint8_t ring_idx[RADAR_DECISION_WINDOW_MAX];        /*<< class of the last frames */
+    float32_t ring_score[RADAR_DECISION_WINDOW_MAX];    /*<< score of the last frames */
+    uint32_t ring_head;                 /*<< ring entry of the next frame */
+    uint32_t ring_count;                /*<< frames in the ring */
+    uint8_t class_frames[RADAR_DECISION_NUM_CLASSES];   /*<< frames of the class in the ring */
+    uint8_t class_votes[RADAR_DECISION_NUM_CLASSES];    /*<< frames of the class scoring above the vote score */
+    float32_t class_sum[RADAR_DECISION_NUM_CLASSES];    /*<< scores of the class in the ring */
+} radar_decision_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the decision
+ *
+ * @param[out] decision decision state
+ * @param[in] detect_list classes reported, kept by reference so changes apply at once
+ * @param[in] hold_frames frames after an event before the next event
+ */
+void radar_decision_init(radar_decision_s *decision, const bool *detect_list, int32_t hold_frames);
+
+/** @brief Configure the frames an event is decided on
+ *
+ * The frames seen before and the hold are forgotten.
+ *
+ * @param[in,out] decision decision state
+ * @param[in] vote vote configuration
+ *
+ * @return zero (0) on success, -1 if the configuration is not valid
+ */
+int32_t radar_decision_set_vote(radar_decision_s *decision, const radar_decision_vote_s *vote);
+
+/** @brief Forget the frames seen before and release the hold
+ *
+ * @param[in,out] decision decision state
+ */
+void radar_decision_reset(radar_decision_s *decision);
+
+/** @brief Decide on the result of a frame
+ *
+ * The hold only counts frames whose class is on the detect list. Every
+ * frame enters the ring, the frames of an event leave it.
+ *
+ * @param[in,out] decision decision state
+ * @param[in] idx class of the frame
+ * @param[in] score score of the class
+ * @param[in] threshold score an event must exceed in RADAR_DECISION_MODE_FRAME
+ *
+ * @return outcome of the frame
+ */
+radar_decision_e radar_decision_run(radar_decision_s *decision, uint32_t idx, float32_t score, float32_t threshold);
+
+#endif /* RADAR_DECISION_H_ */
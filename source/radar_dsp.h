@@ -0,0 +1,130 @@
+/******************************************************************************
+** File name: radar_dsp.h
+**
+** Description: This file selects the DSP backend used by the radar
+**   preprocessing stages. On target the stages use CMSIS-DSP, on a host the
+**   portable reference implementation is selected by RADAR_DSP_REFERENCE.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_DSP_H_
+#define RADAR_DSP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef RADAR_DSP_REFERENCE
+#include <time.h>
+typedef float float32_t;
+#else
+#include "cy_pdl.h"
+#include "arm_math.h"
+#endif
+
+/*
+ * @def RADAR_DSP_PI
+ * Pi in single precision, available for both backends
+ */
+#define RADAR_DSP_PI                    (3.14159265358979f)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_dsp_stats_s
+ * Cycle statistics of a preprocessing stage
+ */
+typedef struct {
+    uint32_t frames;            /*<< frames processed */
+    uint64_t cycles_total;      /*<< sum of cycles per frame */
+    uint32_t cycles_max;        /*<< worst case cycles per frame */
+} radar_dsp_stats_s;
+
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Enable the cycle counter used to profile the preprocessing stages
+ *
+ * On target this enables the DWT cycle counter of the Cortex-M4.
+ */
+static inline void radar_dsp_cycles_init(void)
+{
+#ifndef RADAR_DSP_REFERENCE
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/** @brief Read the cycle counter
+ *
+ * @return DWT cycle count on target, processor clock() ticks on a host
+ */
+static inline uint32_t radar_dsp_cycles(void)
+{
+#ifdef RADAR_DSP_REFERENCE
+    return (uint32_t)clock();
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/** @brief Get rate of the cycle counter
+ *
+ * @return core clock frequency in Hz on target, CLOCKS_PER_SEC on a host
+ */
+static inline uint32_t radar_dsp_cycles_per_second(void)
+{
+#ifdef RADAR_DSP_REFERENCE
+    return (uint32_t)CLOCKS_PER_SEC;
+#else
+    return SystemCoreClock;
+#endif
+}
+
+/** @brief Add the cycles of one frame to stage statistics
+ *
+ * @param[in,out] stats stage statistics
+ * @param[in] cycles cycles spent on the frame
+ */
+static inline void radar_dsp_stats_add(radar_dsp_stats_s *stats, uint32_t cycles)
+{
+    stats->frames++;
+    stats->cycles_total += cycles;
+    if (cycles > stats->cycles_max)
+    {
+        stats->cycles_max = cycles;
+    }
+}
+
+/** @brief Get mean cycles per frame
+ *
+ * @param[in] stats stage statistics
+ *
+ * @return mean cycles per frame, 0 if no frame was processed
+ */
+static inline uint32_t radar_dsp_stats_mean(const radar_dsp_stats_s *stats)
+{
+    return (stats->frames > 0U) ? (uint32_t)(stats->cycles_total / stats->frames) : 0U;
+}
+
+#endif /* RADAR_DSP_H_ */
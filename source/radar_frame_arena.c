@@ -0,0 +1,101 @@
+/*****************************************************************************
+ * File name: radar_frame_arena.c
+ *
+ * Description: This file implements a bump allocator over a statically
+ * allocated arena sized for the largest radar profile.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include "cy_utils.h"
+
+#include "radar_frame_arena.h"
+
+/*******************************************************************************
+ * Variables
+ ********************************************************************************/
+CY_ALIGN(RADAR_FRAME_ARENA_ALIGN) static uint8_t arena[RADAR_FRAME_ARENA_SIZE];
+
+static size_t arena_used;
+
+/*
+ * release all allocations
+ */
+void radar_frame_arena_reset(void)
+{
+    arena_used = 0;
+}
+
+/*
+ * allocate from arena
+ */
+void* radar_frame_arena_alloc(size_t size)
+{
+    size_t aligned_size = (size + (RADAR_FRAME_ARENA_ALIGN - 1U)) & ~((size_t)RADAR_FRAME_ARENA_ALIGN - 1U);
+
+    if ((0 == size) || (aligned_size > (sizeof(arena) - arena_used)))
+    {
+        return NULL;
+    }
+
+    void *ptr = &arena[arena_used];
+    arena_used += aligned_size;
+
+    return ptr;
+}
+
+/*
+ * free is a no-op, the arena is released as a whole
+ */
+void radar_frame_arena_free(void *ptr)
+{
+    (void)ptr;
+}
+
+/*
+ * arena bytes of the buffers of a profile
+ */
+size_t radar_frame_arena_profile_size(const radar_profile_s *profile)
+{
+    const uint32_t samples = profile->num_samples_per_chirp;
+    const uint32_t chirps = profile->num_chirps_per_frame;
+    const uint32_t antennas = profile->num_rx_antennas;
+
+#ifdef RADAR_ACQ_CM0P
+    return RADAR_SHM_RING_MEM_SIZE(RADAR_ACQ_IPC_RING_SLOTS, profile->num_samples_per_frame * 2U) +
+#else
+    return (RADAR_FRAME_ARENA_RDM_RECORD_SIZE(profile->num_samples_per_frame) * RADAR_PROFILE_RDM_FRAMES) +
+#endif
+           (profile->num_samples_per_frame * sizeof(float32_t) * RADAR_PIPELINE_NUM_SLOTS) +
+           RADAR_RANGE_FFT_MEM_SIZE(samples, chirps, antennas) +
+           RADAR_RANGE_DOPPLER_MEM_SIZE(chirps, (samples / 2U), RANGE_DOPPLER_NUM_DOPPLER_BINS_UB) +
+           RADAR_CLUTTER_MAP_MEM_SIZE(samples, antennas) +
+           RADAR_AOA_MEM_SIZE(chirps, (samples / 2U)) +
+           RADAR_RECORDER_MEM_SIZE(RADAR_PROFILE_MAX_SAMPLES_PER_FRAME, profile->num_samples_per_frame) +
+           RADAR_INFERENCE_MEM_SIZE(samples, chirps, antennas) +
+           RADAR_FRAME_ARENA_PADDING;
+}
+
+/*
+ * allocated bytes
+ */
+size_t radar_frame_arena_used(void)
+{
+    return arena_used;
+}
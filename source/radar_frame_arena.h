@@ -0,0 +1,155 @@
+/******************************************************************************
+** File name: radar_frame_arena.h
+**
+** Description: This file contains the interface of the preallocated memory
+**   arena the radar data manager buffer and the frame processing buffers
+**   are provisioned from.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_FRAME_ARENA_H_
+#define RADAR_FRAME_ARENA_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "radar_profiles.h"
+#include "radar_range_fft.h"
+#include "radar_range_doppler.h"
+#include "radar_clutter_map.h"
+#include "radar_aoa.h"
+#include "radar_pipeline.h"
+#include "radar_shm_ring.h"
+#include "radar_acq_ipc.h"
+#include "radar_sample12.h"
+#include "radar_recorder.h"
+#include "radar_inference.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/* Alignment of every allocation in bytes */
+#define RADAR_FRAME_ARENA_ALIGN         (8U)
+
+#ifdef RADAR_ACQ_CM0P
+/* Ring between the cores in place of the RDM buffer: raw 16-bit samples and slot headers */
+#define RADAR_FRAME_ARENA_RDM_SIZE      RADAR_SHM_RING_MEM_SIZE(RADAR_ACQ_IPC_RING_SLOTS,\
+                                                                (RADAR_PROFILE_MAX_SAMPLES_PER_FRAME * 2U))
+#else
+/* Frame record of the RDM buffer: packed 12-bit samples and the cycles of their FIFO read */
+#define RADAR_FRAME_ARENA_RDM_RECORD_SIZE(num_samples) (RADAR_SAMPLE12_BYTES(num_samples) + sizeof(uint32_t))
+
+/* RDM buffer: records of RADAR_PROFILE_RDM_FRAMES frames */
+#define RADAR_FRAME_ARENA_RDM_SIZE      (RADAR_FRAME_ARENA_RDM_RECORD_SIZE(RADAR_PROFILE_MAX_SAMPLES_PER_FRAME) *\
+                                         RADAR_PROFILE_RDM_FRAMES)
+#endif
+
+/* De-interleaved float frames of the pipeline slots */
+#define RADAR_FRAME_ARENA_FRAME_SIZE    (RADAR_PROFILE_MAX_SAMPLES_PER_FRAME * 4U * RADAR_PIPELINE_NUM_SLOTS)
+
+/* Range FFT stage buffers */
+#define RADAR_FRAME_ARENA_RANGE_FFT_SIZE RADAR_RANGE_FFT_MEM_SIZE(RADAR_PROFILE_MAX_SAMPLES_PER_CHIRP,\
+                                                                  RADAR_PROFILE_MAX_CHIRPS_PER_FRAME,\
+                                                                  RADAR_PROFILE_MAX_RX_ANTENNAS)
+
+/* Range-Doppler stage buffers */
+#define RADAR_FRAME_ARENA_RANGE_DOPPLER_SIZE RADAR_RANGE_DOPPLER_MEM_SIZE(RADAR_PROFILE_MAX_CHIRPS_PER_FRAME,\
+                                                                          (RADAR_PROFILE_MAX_SAMPLES_PER_CHIRP / 2U),\
+                                                                          RANGE_DOPPLER_NUM_DOPPLER_BINS_UB)
+
+/* Clutter map background */
+#define RADAR_FRAME_ARENA_CLUTTER_MAP_SIZE RADAR_CLUTTER_MAP_MEM_SIZE(RADAR_PROFILE_MAX_SAMPLES_PER_CHIRP,\
+                                                                      RADAR_PROFILE_MAX_RX_ANTENNAS)
+
+/* Angle-of-arrival stage buffers */
+#define RADAR_FRAME_ARENA_AOA_SIZE      RADAR_AOA_MEM_SIZE(RADAR_PROFILE_MAX_CHIRPS_PER_FRAME,\
+                                                           (RADAR_PROFILE_MAX_SAMPLES_PER_CHIRP / 2U))
+
+/* Flight recorder store and the record buffer of its dump */
+#define RADAR_FRAME_ARENA_RECORDER_SIZE RADAR_RECORDER_MEM_SIZE(RADAR_PROFILE_MAX_SAMPLES_PER_FRAME,\
+                                                                RADAR_PROFILE_MAX_SAMPLES_PER_FRAME)
+
+/* State and buffers of the inference backends */
+#define RADAR_FRAME_ARENA_INFERENCE_SIZE RADAR_INFERENCE_MEM_SIZE(RADAR_PROFILE_MAX_SAMPLES_PER_CHIRP,\
+                                                                  RADAR_PROFILE_MAX_CHIRPS_PER_FRAME,\
+                                                                  RADAR_PROFILE_MAX_RX_ANTENNAS)
+
+/* Padding for the alignment of the individual allocations, one alignment unit per allocation */
+#define RADAR_FRAME_ARENA_PADDING       (RADAR_FRAME_ARENA_ALIGN * 32U)
+
+/* Total arena size, sized for the largest profile */
+#define RADAR_FRAME_ARENA_SIZE          (RADAR_FRAME_ARENA_RDM_SIZE +\
+                                         RADAR_FRAME_ARENA_FRAME_SIZE +\
+                                         RADAR_FRAME_ARENA_RANGE_FFT_SIZE +\
+                                         RADAR_FRAME_ARENA_RANGE_DOPPLER_SIZE +\
+                                         RADAR_FRAME_ARENA_CLUTTER_MAP_SIZE +\
+                                         RADAR_FRAME_ARENA_AOA_SIZE +\
+                                         RADAR_FRAME_ARENA_RECORDER_SIZE +\
+                                         RADAR_FRAME_ARENA_INFERENCE_SIZE +\
+                                         RADAR_FRAME_ARENA_PADDING)
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Release all allocations of the arena
+ *
+ * Every pointer handed out before is invalid after this call.
+ */
+void radar_frame_arena_reset(void);
+
+/** @brief Allocate memory from the arena
+ *
+ * Follows the malloc() prototype so it can be supplied to
+ * \ref radar_data_manager_set_malloc_free
+ *
+ * @param[in] size number of bytes
+ *
+ * @return pointer aligned to RADAR_FRAME_ARENA_ALIGN or NULL if the arena is exhausted
+ */
+void* radar_frame_arena_alloc(size_t size);
+
+/** @brief Free memory allocated from the arena
+ *
+ * Follows the free() prototype. Single allocations are not released,
+ * the arena is released as a whole by \ref radar_frame_arena_reset
+ *
+ * @param[in] ptr pointer returned by \ref radar_frame_arena_alloc
+ */
+void radar_frame_arena_free(void *ptr);
+
+/** @brief Get number of bytes the buffers of a profile take from the arena
+ *
+ * Upper bound with the range gate open, the alignment padding included.
+ *
+ * @param[in] profile profile from the table
+ *
+ * @return arena bytes provisioned for the profile
+ */
+size_t radar_frame_arena_profile_size(const radar_profile_s *profile);
+
+/** @brief Get number of bytes allocated from the arena
+ *
+ * @return allocated bytes including alignment padding
+ */
+size_t radar_frame_arena_used(void);
+
+#endif /* RADAR_FRAME_ARENA_H_ */
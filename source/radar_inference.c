@@ -0,0 +1,650 @@
+/*****************************************************************************
+ * File name: radar_inference.c
+ *
+ * Description: This file implements the inference backend table and the
+ * backends wrapping the gestures library, the motion classifier and the
+ * quantized classifier.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "radar_inference.h"
+
+#ifndef RADAR_DSP_REFERENCE
+#include "radar_settings.h"
+#include "xensiv_radar_gestures.h"
+#endif
+
+/*******************************************************************************
+ * Macros
+ ********************************************************************************/
+#define NUMBER_OF_BACKENDS (sizeof(backend_table) / sizeof(backend_table[0]))
+
+/*******************************************************************************
+ * Function Prototypes
+ ********************************************************************************/
+#ifndef RADAR_DSP_REFERENCE
+static bool library_compatible(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas);
+static size_t library_mem_size(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas);
+static int32_t library_init(void *state, uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame,
+                            uint32_t num_rx_antennas, void* (*alloc_func)(size_t size));
+static void library_run(void *state, const radar_inference_input_s *input, radar_inference_result_s *result);
+static void library_reset(void *state);
+#endif
+
+static bool motion_compatible(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas);
+static size_t motion_mem_size(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas);
+static int32_t motion_init(void *state, uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame,
+                           uint32_t num_rx_antennas, void* (*alloc_func)(size_t size));
+static void motion_run(void *state, const radar_inference_input_s *input, radar_inference_result_s *result);
+static void motion_reset(void *state);
+
+static bool nn_compatible(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas);
+static size_t nn_mem_size(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas);
+static int32_t nn_init(void *state, uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame,
+                       uint32_t num_rx_antennas, void* (*alloc_func)(size_t size));
+static void nn_run_s8(void *state, const radar_inference_input_s *input, radar_inference_result_s *result);
+static void nn_run_f32(void *state, const radar_inference_input_s *input, radar_inference_result_s *result);
+static void nn_reset(void *state);
+
+/*******************************************************************************
+ * Variables
+ ********************************************************************************/
+
+static const radar_inference_backend_s backend_table[] =
+{
+#ifndef RADAR_DSP_REFERENCE
+    {
+        .name = "library",
+        .description = "prebuilt gestures library, default frame geometry only",
+        .state_size = 0,
+        .single_instance = true,
+        .uses_features = false,
+        .compatible = library_compatible,
+        .mem_size = library_mem_size,
+        .init = library_init,
+        .run = library_run,
+        .reset = library_reset
+    },
+#endif
+    {
+        .name = "motion",
+        .description = "heuristic classifier on the angle-of-arrival trajectory",
+        .state_size = sizeof(radar_motion_s),
+        .single_instance = false,
+        .uses_features = true,
+        .compatible = motion_compatible,
+        .mem_size = motion_mem_size,
+        .init = motion_init,
+        .run = motion_run,
+        .reset = motion_reset
+    },
+    {
+        .name = "nn",
+        .description = "int8 classifier on the angle-of-arrival trajectory",
+        .state_size = sizeof(radar_nn_s),
+        .single_instance = false,
+        .uses_features = true,
+        .compatible = nn_compatible,
+        .mem_size = nn_mem_size,
+        .init = nn_init,
+        .run = nn_run_s8,
+        .reset = nn_reset
+    },
+    {
+        .name = "nn_float",
+        .description = "float model the int8 classifier is calibrated from",
+        .state_size = sizeof(radar_nn_s),
+        .single_instance = false,
+        .uses_features = true,
+        .compatible = nn_compatible,
+        .mem_size = nn_mem_size,
+        .init = nn_init,
+        .run = nn_run_f32,
+        .reset = nn_reset
+    }
+};
+
+static const radar_inference_backend_s *active_backend = &backend_table[0];
+
+static void *backend_state[NUMBER_OF_BACKENDS];
+
+static bool backend_ready[NUMBER_OF_BACKENDS];
+
+static radar_dsp_stats_s backend_stats[NUMBER_OF_BACKENDS];
+
+#ifndef RADAR_DSP_REFERENCE
+/*******************************************************************************
+ * Function Name: library_compatible
+ ********************************************************************************
+ * Summary:
+ *   The gestures library only supports the frame geometry it is trained on
+ *
+ * Parameters:
+ *   num_samples_per_chirp: number of samples per chirp
+ *   num_chirps_per_frame: number of chirps per frame
+ *   num_rx_antennas: number of receive antennas
+ *
+ * Return:
+ *   true for the default geometry of radar_settings.h
+ *******************************************************************************/
+static bool library_compatible(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas)
+{
+    return (num_samples_per_chirp == XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP) &&
+           (num_chirps_per_frame == XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME) &&
+           (num_rx_antennas == XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS);
+}
+
+/*******************************************************************************
+ * Function Name: library_mem_size
+ ********************************************************************************
+ * Summary:
+ *   The gestures library keeps its buffers internally
+ *
+ * Parameters:
+ *   num_samples_per_chirp: number of samples per chirp
+ *   num_chirps_per_frame: number of chirps per frame
+ *   num_rx_antennas: number of receive antennas
+ *
+ * Return:
+ *   0
+ *******************************************************************************/
+static size_t library_mem_size(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas)
+{
+    (void)num_samples_per_chirp;
+    (void)num_chirps_per_frame;
+    (void)num_rx_antennas;
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: library_init
+ ********************************************************************************
+ * Summary:
+ *   Initializes the gestures library on the first call. The library is
+ *   initialized once for the application lifetime, re-provisioning the
+ *   frame buffers does not touch it.
+ *
+ * Parameters:
+ *   state: unused
+ *   num_samples_per_chirp: number of samples per chirp
+ *   num_chirps_per_frame: number of chirps per frame
+ *   num_rx_antennas: number of receive antennas
+ *   alloc_func: unused
+ *
+ * Return:
+ *   0
+ *******************************************************************************/
+static int32_t library_init(void *state, uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame,
+                            uint32_t num_rx_antennas, void* (*alloc_func)(size_t size))
+{
+    static bool initialized = false;
+
+    (void)state;
+    (void)num_samples_per_chirp;
+    (void)num_chirps_per_frame;
+    (void)num_rx_antennas;
+    (void)alloc_func;
+
+    if (!initialized)
+    {
+        gestures_init();
+        initialized = true;
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: library_run
+ ********************************************************************************
+ * Summary:
+ *   Passes the de-interleaved frame on to the gestures library
+ *
+ * Parameters:
+ *   state: unused
+ *   input: frame and preprocessing stages
+ *   result: receives class and score
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void library_run(void *state, const radar_inference_input_s *input, radar_inference_result_s *result)
+{
+    inference_results_t results;
+
+    (void)state;
+
+    gestures_run(input->frame, &results);
+
+    result->idx = results.idx;
+    result->score = results.score;
+}
+
+/*******************************************************************************
+ * Function Name: library_reset
+ ********************************************************************************
+ * Summary:
+ *   The gestures library has no reset, its history fades within a gesture
+ *
+ * Parameters:
+ *   state: unused
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void library_reset(void *state)
+{
+    (void)state;
+}
+#endif
+
+/*******************************************************************************
+ * Function Name: motion_compatible
+ ********************************************************************************
+ * Summary:
+ *   The motion classifier needs the angle of arrival of three antennas
+ *
+ * Parameters:
+ *   num_samples_per_chirp: number of samples per chirp
+ *   num_chirps_per_frame: number of chirps per frame
+ *   num_rx_antennas: number of receive antennas
+ *
+ * Return:
+ *   true for three antennas
+ *******************************************************************************/
+static bool motion_compatible(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas)
+{
+    (void)num_samples_per_chirp;
+    (void)num_chirps_per_frame;
+
+    return (num_rx_antennas == 3U);
+}
+
+/*******************************************************************************
+ * Function Name: motion_mem_size
+ ********************************************************************************
+ * Summary:
+ *   The motion classifier works on the trajectory of the angle-of-arrival
+ *   stage and has no buffers
+ *
+ * Parameters:
+ *   num_samples_per_chirp: number of samples per chirp
+ *   num_chirps_per_frame: number of chirps per frame
+ *   num_rx_antennas: number of receive antennas
+ *
+ * Return:
+ *   0
+ *******************************************************************************/
+static size_t motion_mem_size(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas)
+{
+    (void)num_samples_per_chirp;
+    (void)num_chirps_per_frame;
+    (void)num_rx_antennas;
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: motion_init
+ ********************************************************************************
+ * Summary:
+ *   Initializes the motion classifier state
+ *
+ * Parameters:
+ *   state: motion classifier state
+ *   num_samples_per_chirp: number of samples per chirp
+ *   num_chirps_per_frame: number of chirps per frame
+ *   num_rx_antennas: number of receive antennas
+ *   alloc_func: unused
+ *
+ * Return:
+ *   0
+ *******************************************************************************/
+static int32_t motion_init(void *state, uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame,
+                           uint32_t num_rx_antennas, void* (*alloc_func)(size_t size))
+{
+    (void)num_samples_per_chirp;
+    (void)num_chirps_per_frame;
+    (void)num_rx_antennas;
+    (void)alloc_func;
+
+    radar_motion_init((radar_motion_s*)state);
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: motion_run
+ ********************************************************************************
+ * Summary:
+ *   Classifies the latest frame of the angle-of-arrival trajectory
+ *
+ * Parameters:
+ *   state: motion classifier state
+ *   input: frame and preprocessing stages
+ *   result: receives class and score
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void motion_run(void *state, const radar_inference_input_s *input, radar_inference_result_s *result)
+{
+    result->idx = radar_motion_run((radar_motion_s*)state, input->aoa, &result->score);
+}
+
+/*******************************************************************************
+ * Function Name: motion_reset
+ ********************************************************************************
+ * Summary:
+ *   Drops the path in progress
+ *
+ * Parameters:
+ *   state: motion classifier state
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void motion_reset(void *state)
+{
+    radar_motion_init((radar_motion_s*)state);
+}
+
+/*******************************************************************************
+ * Function Name: nn_compatible
+ ********************************************************************************
+ * Summary:
+ *   The classifier is trained on the angle of arrival of three antennas
+ *
+ * Parameters:
+ *   num_samples_per_chirp: number of samples per chirp
+ *   num_chirps_per_frame: number of chirps per frame
+ *   num_rx_antennas: number of receive antennas
+ *
+ * Return:
+ *   true for three antennas
+ *******************************************************************************/
+static bool nn_compatible(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas)
+{
+    (void)num_samples_per_chirp;
+    (void)num_chirps_per_frame;
+
+    return (num_rx_antennas == 3U);
+}
+
+/*******************************************************************************
+ * Function Name: nn_mem_size
+ ********************************************************************************
+ * Summary:
+ *   Features and layer outputs, independent of the frame geometry
+ *
+ * Parameters:
+ *   num_samples_per_chirp: number of samples per chirp
+ *   num_chirps_per_frame: number of chirps per frame
+ *   num_rx_antennas: number of receive antennas
+ *
+ * Return:
+ *   RADAR_NN_MEM_SIZE
+ *******************************************************************************/
+static size_t nn_mem_size(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas)
+{
+    (void)num_samples_per_chirp;
+    (void)num_chirps_per_frame;
+    (void)num_rx_antennas;
+
+    return RADAR_NN_MEM_SIZE;
+}
+
+/*******************************************************************************
+ * Function Name: nn_init
+ ********************************************************************************
+ * Summary:
+ *   Initializes the classifier with the generated model
+ *
+ * Parameters:
+ *   state: classifier state
+ *   num_samples_per_chirp: number of samples per chirp
+ *   num_chirps_per_frame: number of chirps per frame
+ *   num_rx_antennas: number of receive antennas
+ *   alloc_func: allocator of the buffers
+ *
+ * Return:
+ *   Success or error
+ *******************************************************************************/
+static int32_t nn_init(void *state, uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame,
+                       uint32_t num_rx_antennas, void* (*alloc_func)(size_t size))
+{
+    (void)num_samples_per_chirp;
+    (void)num_chirps_per_frame;
+    (void)num_rx_antennas;
+
+    return radar_nn_init((radar_nn_s*)state, &radar_nn_model, alloc_func);
+}
+
+/*******************************************************************************
+ * Function Name: nn_run_s8
+ ********************************************************************************
+ * Summary:
+ *   Classifies the latest frame of the trajectory with the int8 model
+ *
+ * Parameters:
+ *   state: classifier state
+ *   input: frame and preprocessing stages
+ *   result: receives class and score
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void nn_run_s8(void *state, const radar_inference_input_s *input, radar_inference_result_s *result)
+{
+    result->idx = radar_nn_run((radar_nn_s*)state, input->aoa, true, &result->score);
+}
+
+/*******************************************************************************
+ * Function Name: nn_run_f32
+ ********************************************************************************
+ * Summary:
+ *   Classifies the latest frame of the trajectory with the float model
+ *
+ * Parameters:
+ *   state: classifier state
+ *   input: frame and preprocessing stages
+ *   result: receives class and score
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void nn_run_f32(void *state, const radar_inference_input_s *input, radar_inference_result_s *result)
+{
+    result->idx = radar_nn_run((radar_nn_s*)state, input->aoa, false, &result->score);
+}
+
+/*******************************************************************************
+ * Function Name: nn_reset
+ ********************************************************************************
+ * Summary:
+ *   Forgets the class of the previous frames
+ *
+ * Parameters:
+ *   state: classifier state
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void nn_reset(void *state)
+{
+    radar_nn_reset((radar_nn_s*)state);
+}
+
+/*
+ * number of backends
+ */
+uint32_t radar_inference_backend_count(void)
+{
+    return NUMBER_OF_BACKENDS;
+}
+
+/*
+ * backend by index
+ */
+const radar_inference_backend_s* radar_inference_backend_get(uint32_t idx)
+{
+    if (idx >= NUMBER_OF_BACKENDS)
+    {
+        return NULL;
+    }
+
+    return &backend_table[idx];
+}
+
+/*
+ * backend by name
+ */
+const radar_inference_backend_s* radar_inference_backend_find(const char *name)
+{
+    for (uint32_t i = 0; i < NUMBER_OF_BACKENDS; ++i)
+    {
+        if (strcmp(backend_table[i].name, name) == 0)
+        {
+            return &backend_table[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * initialize all backends for a frame geometry
+ */
+int32_t radar_inference_init(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame,
+                             uint32_t num_rx_antennas, void* (*alloc_func)(size_t size))
+{
+    if (alloc_func == NULL)
+    {
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < NUMBER_OF_BACKENDS; ++i)
+    {
+        const radar_inference_backend_s *backend = &backend_table[i];
+
+        backend_ready[i] = false;
+        backend_state[i] = NULL;
+
+        if (!backend->compatible(num_samples_per_chirp, num_chirps_per_frame, num_rx_antennas))
+        {
+            continue;
+        }
+
+        if (backend->state_size > 0U)
+        {
+            backend_state[i] = alloc_func(backend->state_size);
+            if (backend_state[i] == NULL)
+            {
+                return -2;
+            }
+        }
+
+        if (backend->init(backend_state[i], num_samples_per_chirp, num_chirps_per_frame,
+                          num_rx_antennas, alloc_func) != 0)
+        {
+            return -2;
+        }
+
+        backend_ready[i] = true;
+    }
+
+    return 0;
+}
+
+/*
+ * backend initialized for the current frame geometry
+ */
+bool radar_inference_backend_ready(const radar_inference_backend_s *backend)
+{
+    return backend_ready[backend - backend_table];
+}
+
+/*
+ * classify one frame with a backend
+ */
+void radar_inference_backend_run(const radar_inference_backend_s *backend,
+                                 const radar_inference_input_s *input,
+                                 radar_inference_result_s *result)
+{
+    const ptrdiff_t idx = backend - backend_table;
+    uint32_t cycles = radar_dsp_cycles();
+
+    backend->run(backend_state[idx], input, result);
+
+    radar_dsp_stats_add(&backend_stats[idx], radar_dsp_cycles() - cycles);
+}
+
+/*
+ * reset a backend
+ */
+void radar_inference_backend_reset(const radar_inference_backend_s *backend)
+{
+    const ptrdiff_t idx = backend - backend_table;
+
+    if (backend_ready[idx])
+    {
+        backend->reset(backend_state[idx]);
+    }
+}
+
+/*
+ * RAM of a backend
+ */
+size_t radar_inference_backend_ram(const radar_inference_backend_s *backend, uint32_t num_samples_per_chirp,
+                                   uint32_t num_chirps_per_frame, uint32_t num_rx_antennas)
+{
+    return backend->state_size + backend->mem_size(num_samples_per_chirp, num_chirps_per_frame, num_rx_antennas);
+}
+
+/*
+ * active backend
+ */
+const radar_inference_backend_s* radar_inference_backend_get_active(void)
+{
+    return active_backend;
+}
+
+/*
+ * set active backend
+ */
+void radar_inference_backend_set_active(const radar_inference_backend_s *backend)
+{
+    if (NULL != backend)
+    {
+        active_backend = backend;
+    }
+}
+
+/*
+ * run cycle statistics of a backend
+ */
+radar_dsp_stats_s* radar_inference_backend_get_stats(const radar_inference_backend_s *backend)
+{
+    return &backend_stats[backend - backend_table];
+}
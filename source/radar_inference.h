@@ -0,0 +1,225 @@
+/******************************************************************************
+** File name: radar_inference.h
+**
+** Description: This file contains the interface of the inference backends.
+**   A backend turns the preprocessed frame into the class and score the
+**   decision works on. Backends are kept in a table like the radar profiles
+**   and share one set of entry points, so the application, the host tools
+**   and benchmarks can run any of them on the same frames. The default is
+**   selected with INFERENCE_BACKEND in the Makefile, another one at runtime.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_INFERENCE_H_
+#define RADAR_INFERENCE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "radar_dsp.h"
+#include "radar_range_fft.h"
+#include "radar_range_doppler.h"
+#include "radar_aoa.h"
+#include "radar_motion.h"
+#include "radar_nn.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_INFERENCE_BACKEND_DEFAULT
+ * Backend selected at startup, set with INFERENCE_BACKEND in the Makefile.
+ * Host builds have no gestures library.
+ */
+#ifndef RADAR_INFERENCE_BACKEND_DEFAULT
+#ifdef RADAR_DSP_REFERENCE
+#define RADAR_INFERENCE_BACKEND_DEFAULT     "motion"
+#else
+#define RADAR_INFERENCE_BACKEND_DEFAULT     "library"
+#endif
+#endif
+
+/*
+ * @def RADAR_INFERENCE_MEM_SIZE
+ * Bytes all backends take from the frame arena together, state included
+ */
+#define RADAR_INFERENCE_MEM_SIZE(samples, chirps, antennas) \
+    (sizeof(radar_motion_s) + (2U * (sizeof(radar_nn_s) + RADAR_NN_MEM_SIZE)))
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_inference_result_s
+ * Result of a frame
+ */
+typedef struct {
+    uint32_t idx;                       /*<< class, numbered like the classes of the gestures library */
+    float32_t score;
+} radar_inference_result_s;
+
+/*
+ * @typedef typedef struct  radar_inference_input_s
+ * Frame and preprocessing stages a backend may use
+ */
+typedef struct {
+    float32_t *frame;                   /*<< de-interleaved frame [antenna][chirp][sample] after the clutter map */
+    const radar_range_fft_s *range_fft; /*<< features of the frame, NULL unless the backend uses them */
+    const radar_range_doppler_s *range_doppler;
+    const radar_aoa_s *aoa;
+} radar_inference_input_s;
+
+/*
+ * @typedef typedef struct  radar_inference_backend_s
+ * Inference backend
+ */
+typedef struct {
+    const char *name;                   /*<< name used to select the backend from CLI */
+    const char *description;            /*<< one line description printed by the CLI */
+    size_t state_size;                  /*<< bytes of the state the caller provides */
+    bool single_instance;               /*<< keeps its state internally, only one instance can run */
+    bool uses_features;                 /*<< needs the range FFT, range-Doppler and angle-of-arrival stages */
+
+    /** Check if the backend supports a frame geometry */
+    bool (*compatible)(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas);
+
+    /** Bytes init takes from the allocator for a frame geometry */
+    size_t (*mem_size)(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame, uint32_t num_rx_antennas);
+
+    /** Initialize the state for a compatible frame geometry, zero (0) on success */
+    int32_t (*init)(void *state, uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame,
+                    uint32_t num_rx_antennas, void* (*alloc_func)(size_t size));
+
+    /** Classify one frame */
+    void (*run)(void *state, const radar_inference_input_s *input, radar_inference_result_s *result);
+
+    /** Forget the frames seen before */
+    void (*reset)(void *state);
+} radar_inference_backend_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Get number of entries in the backend table
+ *
+ * @return number of backends
+ */
+uint32_t radar_inference_backend_count(void);
+
+/** @brief Get backend by index
+ *
+ * @param[in] idx index into the backend table
+ *
+ * @return pointer to the backend or NULL if the index is out of range
+ */
+const radar_inference_backend_s* radar_inference_backend_get(uint32_t idx);
+
+/** @brief Find backend by name
+ *
+ * @param[in] name backend name
+ *
+ * @return pointer to the backend or NULL if no backend has this name
+ */
+const radar_inference_backend_s* radar_inference_backend_find(const char *name);
+
+/** @brief Initialize all backends for a frame geometry
+ *
+ * Takes the state and buffers of every backend from the allocator. Backends
+ * that do not support the geometry are skipped and are not ready.
+ *
+ * @param[in] num_samples_per_chirp number of samples per chirp
+ * @param[in] num_chirps_per_frame number of chirps per frame
+ * @param[in] num_rx_antennas number of receive antennas
+ * @param[in] alloc_func allocator
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid,
+ *         -2 if the allocator is exhausted
+ */
+int32_t radar_inference_init(uint32_t num_samples_per_chirp, uint32_t num_chirps_per_frame,
+                             uint32_t num_rx_antennas, void* (*alloc_func)(size_t size));
+
+/** @brief Check if a backend is initialized for the current frame geometry
+ *
+ * @param[in] backend backend from the table
+ *
+ * @return true if the backend can run
+ */
+bool radar_inference_backend_ready(const radar_inference_backend_s *backend);
+
+/** @brief Classify one frame with a backend
+ *
+ * The cycles spent are added to the statistics of the backend.
+ *
+ * @param[in] backend ready backend from the table
+ * @param[in] input frame and preprocessing stages
+ * @param[out] result class and score
+ */
+void radar_inference_backend_run(const radar_inference_backend_s *backend,
+                                 const radar_inference_input_s *input,
+                                 radar_inference_result_s *result);
+
+/** @brief Reset a backend
+ *
+ * @param[in] backend backend from the table
+ */
+void radar_inference_backend_reset(const radar_inference_backend_s *backend);
+
+/** @brief Get bytes of RAM a backend takes for a frame geometry
+ *
+ * @param[in] backend backend from the table
+ * @param[in] num_samples_per_chirp number of samples per chirp
+ * @param[in] num_chirps_per_frame number of chirps per frame
+ * @param[in] num_rx_antennas number of receive antennas
+ *
+ * @return state and buffer bytes, RAM the backend keeps internally not included
+ */
+size_t radar_inference_backend_ram(const radar_inference_backend_s *backend, uint32_t num_samples_per_chirp,
+                                   uint32_t num_chirps_per_frame, uint32_t num_rx_antennas);
+
+/** @brief Get active backend
+ *
+ * @return pointer to the backend the application classifies with
+ */
+const radar_inference_backend_s* radar_inference_backend_get_active(void);
+
+/** @brief Mark a backend as the active one
+ *
+ * @note This only updates the bookkeeping. Resetting the backend and
+ *       configuring the stages it uses is done by the application.
+ *
+ * @param[in] backend backend from the table
+ */
+void radar_inference_backend_set_active(const radar_inference_backend_s *backend);
+
+/** @brief Get run cycle statistics of a backend
+ *
+ * Cycles per frame collected by \ref radar_inference_backend_run
+ *
+ * @param[in] backend backend from the table
+ *
+ * @return statistics of the backend
+ */
+radar_dsp_stats_s* radar_inference_backend_get_stats(const radar_inference_backend_s *backend);
+
+#endif /* RADAR_INFERENCE_H_ */
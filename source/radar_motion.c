@@ -0,0 +1,180 @@
+/*****************************************************************************
+ * File name: radar_motion.c
+ *
+ * Description: This file implements the motion classifier: tracking of the
+ * target path on the angle-of-arrival trajectory and its classification.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "radar_motion.h"
+
+/* points averaged at either end of the path */
+#define END_POINTS                  (2U)
+
+/*******************************************************************************
+ * Function Name: classify_path
+ ********************************************************************************
+ * Summary:
+ *   Classifies the path between two ages of the trajectory by its largest
+ *   movement. The ends of the path are averaged over END_POINTS targets.
+ *
+ * Parameters:
+ *   aoa: angle-of-arrival stage holding the trajectory
+ *   newest: age of the last target of the path
+ *   oldest: age of the first target of the path
+ *   score: receives the score of the class
+ *
+ * Return:
+ *   class of the path
+ *******************************************************************************/
+static uint32_t classify_path(const radar_aoa_s *aoa, uint32_t newest, uint32_t oldest, float32_t *score)
+{
+    float32_t azimuth[2] = { 0.0f, 0.0f };
+    float32_t elevation[2] = { 0.0f, 0.0f };
+    float32_t range[2] = { 0.0f, 0.0f };
+    uint32_t count[2] = { 0U, 0U };
+    float32_t range_min = 255.0f;
+    uint32_t targets = 0;
+    float32_t swipe_az;
+    float32_t swipe_el;
+    float32_t push;
+
+    /* oldest first, index 0 collects the start and index 1 the end of the path */
+    for (uint32_t age = oldest + 1U; age-- > newest;)
+    {
+        const radar_aoa_point_s *point = radar_aoa_get_point(aoa, age);
+
+        if (point->valid == 0U)
+        {
+            continue;
+        }
+
+        if (count[0] < END_POINTS)
+        {
+            azimuth[0] += (float32_t)point->azimuth_deg;
+            elevation[0] += (float32_t)point->elevation_deg;
+            range[0] += (float32_t)point->range_bin;
+            count[0]++;
+        }
+        if ((float32_t)point->range_bin < range_min)
+        {
+            range_min = (float32_t)point->range_bin;
+        }
+        targets++;
+    }
+
+    for (uint32_t age = newest; (age <= oldest) && (count[1] < END_POINTS); ++age)
+    {
+        const radar_aoa_point_s *point = radar_aoa_get_point(aoa, age);
+
+        if (point->valid != 0U)
+        {
+            azimuth[1] += (float32_t)point->azimuth_deg;
+            elevation[1] += (float32_t)point->elevation_deg;
+            range[1] += (float32_t)point->range_bin;
+            count[1]++;
+        }
+    }
+
+    if ((targets < RADAR_MOTION_MIN_FRAMES) || (count[0] == 0U) || (count[1] == 0U))
+    {
+        *score = 0.0f;
+        return RADAR_MOTION_CLASS_BACKGROUND;
+    }
+
+    swipe_az = ((azimuth[1] / (float32_t)count[1]) - (azimuth[0] / (float32_t)count[0])) / RADAR_MOTION_SWIPE_DEG;
+    swipe_el = ((elevation[1] / (float32_t)count[1]) - (elevation[0] / (float32_t)count[0])) / RADAR_MOTION_SWIPE_DEG;
+    push = ((((range[0] / (float32_t)count[0]) + (range[1] / (float32_t)count[1])) * 0.5f) - range_min) /
+           RADAR_MOTION_PUSH_BINS;
+
+    if ((push >= fabsf(swipe_az)) && (push >= fabsf(swipe_el)))
+    {
+        *score = fminf(push, 1.0f);
+        return RADAR_MOTION_CLASS_PUSH;
+    }
+
+    if (fabsf(swipe_az) >= fabsf(swipe_el))
+    {
+        *score = fminf(fabsf(swipe_az), 1.0f);
+        return (swipe_az > 0.0f) ? RADAR_MOTION_CLASS_SWIPE_RIGHT : RADAR_MOTION_CLASS_SWIPE_LEFT;
+    }
+
+    *score = fminf(fabsf(swipe_el), 1.0f);
+    return (swipe_el > 0.0f) ? RADAR_MOTION_CLASS_SWIPE_UP : RADAR_MOTION_CLASS_SWIPE_DOWN;
+}
+
+/*
+ * Initialize the motion classifier
+ */
+void radar_motion_init(radar_motion_s *motion)
+{
+    memset(motion, 0, sizeof(radar_motion_s));
+}
+
+/*
+ * Classify the latest frame of the trajectory
+ */
+uint32_t radar_motion_run(radar_motion_s *motion, const radar_aoa_s *aoa, float32_t *score)
+{
+    const radar_aoa_point_s *point = radar_aoa_get_point(aoa, 0);
+    uint32_t idx = RADAR_MOTION_CLASS_BACKGROUND;
+    uint32_t cycles = radar_dsp_cycles();
+
+    *score = 0.0f;
+
+    if (point->valid != 0U)
+    {
+        /* a path longer than the trajectory keeps its latest part */
+        motion->span = (motion->span == 0U) ? 1U : (motion->span + motion->gap + 1U);
+        if (motion->span > RADAR_AOA_TRAJECTORY_LEN)
+        {
+            motion->span = RADAR_AOA_TRAJECTORY_LEN;
+        }
+        motion->gap = 0;
+    }
+    else if ((motion->span > 0U) && (++motion->gap >= RADAR_MOTION_GAP_FRAMES))
+    {
+        motion->span = 0;
+        motion->gap = 0;
+        motion->peak = 0.0f;
+    }
+
+    /* the path so far is classified on every frame, like the class of the gestures library */
+    if ((motion->span > 0U) && (motion->gap == 0U))
+    {
+        float32_t path_score;
+
+        idx = classify_path(aoa, 0U, motion->span - 1U, &path_score);
+
+        /* a path scores only while it rises, so a long gesture crosses a threshold once */
+        if (path_score > motion->peak)
+        {
+            *score = path_score;
+            motion->peak = path_score;
+        }
+    }
+
+    radar_dsp_stats_add(&motion->stats, radar_dsp_cycles() - cycles);
+
+    return idx;
+}
@@ -0,0 +1,116 @@
+/******************************************************************************
+** File name: radar_motion.h
+**
+** Description: This file contains the interface of the motion classifier, a
+**   heuristic gesture detector on the angle-of-arrival trajectory. The path
+**   of a target is classified by its largest movement so far: a change of
+**   azimuth or elevation is a swipe, a range that comes closer than the ends
+**   of the path is a push. It needs no model and runs
+**   wherever the preprocessing stages run, including host tools.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_MOTION_H_
+#define RADAR_MOTION_H_
+
+#include <stdint.h>
+
+#include "radar_dsp.h"
+#include "radar_aoa.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_MOTION_MIN_FRAMES
+ * Frames with a target a gesture needs at least
+ */
+#define RADAR_MOTION_MIN_FRAMES             (4U)
+
+/*
+ * @def RADAR_MOTION_GAP_FRAMES
+ * Frames without a target that end a gesture, shorter gaps are bridged
+ */
+#define RADAR_MOTION_GAP_FRAMES             (2U)
+
+/*
+ * @def RADAR_MOTION_SWIPE_DEG
+ * Change of azimuth or elevation that scores 1
+ */
+#define RADAR_MOTION_SWIPE_DEG              (40.0f)
+
+/*
+ * @def RADAR_MOTION_PUSH_BINS
+ * Range bins a push comes closer than its start and end that score 1
+ */
+#define RADAR_MOTION_PUSH_BINS              (3.0f)
+
+/*
+ * Classes reported, numbered like the classes of the gestures library
+ */
+#define RADAR_MOTION_CLASS_BACKGROUND       (0U)
+#define RADAR_MOTION_CLASS_PUSH             (1U)
+#define RADAR_MOTION_CLASS_SWIPE_LEFT       (2U)    /*<< towards negative azimuth */
+#define RADAR_MOTION_CLASS_SWIPE_RIGHT      (3U)    /*<< towards positive azimuth */
+#define RADAR_MOTION_CLASS_SWIPE_UP         (6U)    /*<< towards positive elevation */
+#define RADAR_MOTION_CLASS_SWIPE_DOWN       (7U)    /*<< towards negative elevation */
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_motion_s
+ * Motion classifier state
+ */
+typedef struct {
+    uint32_t span;                      /*<< frames from the first to the last target of the path */
+    uint32_t gap;                       /*<< frames without a target since the last one */
+    float32_t peak;                     /*<< highest score of the path */
+    radar_dsp_stats_s stats;            /*<< cycles per frame */
+} radar_motion_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the motion classifier
+ *
+ * @param[out] motion classifier state
+ */
+void radar_motion_init(radar_motion_s *motion);
+
+/** @brief Classify the latest frame of the trajectory
+ *
+ * Call once per frame after \ref radar_aoa_run. Every frame with a target
+ * reports the class of the path so far. The score grows with the movement
+ * and is 0 on frames that do not raise the highest score of the path.
+ * Frames without a target are background with score 0.
+ *
+ * @param[in,out] motion classifier state
+ * @param[in] aoa angle-of-arrival stage holding the trajectory
+ * @param[out] score score of the class, 0 to 1
+ *
+ * @return class of the frame
+ */
+uint32_t radar_motion_run(radar_motion_s *motion, const radar_aoa_s *aoa, float32_t *score);
+
+#endif /* RADAR_MOTION_H_ */
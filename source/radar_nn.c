@@ -0,0 +1,379 @@
+/*****************************************************************************
+ * File name: radar_nn.c
+ *
+ * Description: This file implements the quantized gesture classifier:
+ * trajectory features, int8 and float inference and the class report.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "radar_nn.h"
+
+#ifdef RADAR_NN_CMSIS
+#include "arm_nnfunctions.h"
+#endif
+
+/*******************************************************************************
+ * Macros
+ ********************************************************************************/
+#define INT8_MIN_VALUE              (-128)
+#define INT8_MAX_VALUE              (127)
+
+/*******************************************************************************
+ * Function Name: clamp_s8
+ ********************************************************************************
+ * Summary:
+ *   Saturates a value to the int8 range
+ *
+ * Parameters:
+ *   value: value to saturate
+ *
+ * Return:
+ *   saturated value
+ *******************************************************************************/
+static inline int8_t clamp_s8(int32_t value)
+{
+    return (int8_t)((value < INT8_MIN_VALUE) ? INT8_MIN_VALUE : ((value > INT8_MAX_VALUE) ? INT8_MAX_VALUE : value));
+}
+
+#ifndef RADAR_NN_CMSIS
+/*******************************************************************************
+ * Function Name: requantize
+ ********************************************************************************
+ * Summary:
+ *   Scales an accumulator by multiplier * 2^(shift - 31) with the rounding of
+ *   the CMSIS-NN kernels, so host and target produce the same outputs
+ *
+ * Parameters:
+ *   value: accumulator
+ *   multiplier: Q31 multiplier
+ *   shift: left shift if positive, right shift if negative
+ *
+ * Return:
+ *   scaled value
+ *******************************************************************************/
+static int32_t requantize(int32_t value, int32_t multiplier, int32_t shift)
+{
+    const int32_t left_shift = (shift > 0) ? shift : 0;
+    const int32_t right_shift = (shift > 0) ? 0 : -shift;
+    const int32_t remainder_mask = (int32_t)((1U << right_shift) - 1U);
+    int32_t threshold = remainder_mask >> 1;
+    int64_t product = (int64_t)1 << 30;
+    int32_t result;
+
+    /* doubling high multiply, rounded */
+    product += (int64_t)(value * (1 << left_shift)) * multiplier;
+    result = (int32_t)(product >> 31);
+
+    /* rounding divide by a power of two, ties away from zero */
+    if ((result >> right_shift) < 0)
+    {
+        threshold++;
+    }
+    if ((result & remainder_mask) > threshold)
+    {
+        return (result >> right_shift) + 1;
+    }
+
+    return result >> right_shift;
+}
+#endif
+
+/*******************************************************************************
+ * Function Name: fully_connected_s8
+ ********************************************************************************
+ * Summary:
+ *   int8 fully connected layer with symmetric weights and per tensor
+ *   requantization, arm_fully_connected_s8() of CMSIS-NN on target
+ *
+ * Parameters:
+ *   input: input_len inputs
+ *   input_offset: negated zero point of the inputs
+ *   weights: [output_len][input_len] weights
+ *   bias: output_len biases in the scale of the accumulator
+ *   input_len: number of inputs
+ *   output_len: number of outputs
+ *   multiplier: Q31 multiplier of the output scale
+ *   shift: shift of the output scale
+ *   output_offset: zero point of the outputs
+ *   activation_min: lowest output, the zero point for a ReLU
+ *   output: output_len outputs
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void fully_connected_s8(const int8_t *input, int32_t input_offset, const int8_t *weights,
+                               const int32_t *bias, uint32_t input_len, uint32_t output_len,
+                               int32_t multiplier, int32_t shift, int32_t output_offset,
+                               int32_t activation_min, int8_t *output)
+{
+#ifdef RADAR_NN_CMSIS
+    const cmsis_nn_context ctx = { .buf = NULL, .size = 0 };
+    const cmsis_nn_fc_params fc_params = {
+        .input_offset = input_offset,
+        .filter_offset = 0,
+        .output_offset = output_offset,
+        .activation = { .min = activation_min, .max = INT8_MAX_VALUE }
+    };
+    const cmsis_nn_per_tensor_quant_params quant_params = { .multiplier = multiplier, .shift = shift };
+    const cmsis_nn_dims input_dims = { .n = 1, .h = 1, .w = 1, .c = (int32_t)input_len };
+    const cmsis_nn_dims filter_dims = { .n = (int32_t)input_len, .h = 1, .w = 1, .c = (int32_t)output_len };
+    const cmsis_nn_dims bias_dims = { .n = 1, .h = 1, .w = 1, .c = (int32_t)output_len };
+    const cmsis_nn_dims output_dims = { .n = 1, .h = 1, .w = 1, .c = (int32_t)output_len };
+
+    (void)arm_fully_connected_s8(&ctx, &fc_params, &quant_params, &input_dims, input, &filter_dims, weights,
+                                 &bias_dims, bias, &output_dims, output);
+#else
+    for (uint32_t o = 0; o < output_len; ++o)
+    {
+        const int8_t *row = &weights[o * input_len];
+        int32_t acc = bias[o];
+        int32_t value;
+
+        for (uint32_t i = 0; i < input_len; ++i)
+        {
+            acc += ((int32_t)input[i] + input_offset) * (int32_t)row[i];
+        }
+
+        value = requantize(acc, multiplier, shift) + output_offset;
+        output[o] = clamp_s8((value < activation_min) ? activation_min : value);
+    }
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: softmax
+ ********************************************************************************
+ * Summary:
+ *   Converts the class outputs to probabilities in place
+ *
+ * Parameters:
+ *   values: RADAR_NN_NUM_CLASSES outputs
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void softmax(float32_t *values)
+{
+    float32_t max = values[0];
+    float32_t sum = 0.0f;
+
+    for (uint32_t i = 1; i < RADAR_NN_NUM_CLASSES; ++i)
+    {
+        max = fmaxf(max, values[i]);
+    }
+    for (uint32_t i = 0; i < RADAR_NN_NUM_CLASSES; ++i)
+    {
+        values[i] = expf(values[i] - max);
+        sum += values[i];
+    }
+    for (uint32_t i = 0; i < RADAR_NN_NUM_CLASSES; ++i)
+    {
+        values[i] /= sum;
+    }
+}
+
+/*
+ * Initialize the classifier
+ */
+int32_t radar_nn_init(radar_nn_s *nn, const radar_nn_model_s *model, void* (*alloc_func)(size_t size))
+{
+    if ((model == NULL) || (alloc_func == NULL))
+    {
+        return -1;
+    }
+
+    nn->model = model;
+    nn->features = alloc_func(RADAR_NN_INPUT_LEN);
+    nn->hidden = alloc_func(RADAR_NN_HIDDEN_LEN);
+    nn->output = alloc_func(RADAR_NN_NUM_CLASSES);
+    nn->hidden_f32 = alloc_func(RADAR_NN_HIDDEN_LEN * sizeof(float32_t));
+    nn->output_f32 = alloc_func(RADAR_NN_NUM_CLASSES * sizeof(float32_t));
+
+    if ((nn->features == NULL) || (nn->hidden == NULL) || (nn->output == NULL) ||
+        (nn->hidden_f32 == NULL) || (nn->output_f32 == NULL))
+    {
+        return -2;
+    }
+
+    radar_nn_reset(nn);
+
+    return 0;
+}
+
+/*
+ * Forget the class of the previous frames
+ */
+void radar_nn_reset(radar_nn_s *nn)
+{
+    nn->idx = 0;
+    nn->peak = 0.0f;
+}
+
+/*
+ * Compute the int8 features of the trajectory
+ */
+void radar_nn_features(const radar_aoa_s *aoa, int8_t *features)
+{
+    int32_t azimuth = 0;
+    int32_t elevation = 0;
+    int32_t range = 0;
+    int32_t count = 0;
+
+    /* relative to the mean, the features do not depend on where the hand is */
+    for (uint32_t age = 0; age < RADAR_AOA_TRAJECTORY_LEN; ++age)
+    {
+        const radar_aoa_point_s *point = radar_aoa_get_point(aoa, age);
+
+        if (point->valid != 0U)
+        {
+            azimuth += point->azimuth_deg;
+            elevation += point->elevation_deg;
+            range += point->range_bin;
+            count++;
+        }
+    }
+
+    if (count > 0)
+    {
+        azimuth /= count;
+        elevation /= count;
+        range = (range * RADAR_NN_RANGE_STEPS) / count;
+    }
+
+    for (uint32_t age = 0; age < RADAR_AOA_TRAJECTORY_LEN; ++age)
+    {
+        const radar_aoa_point_s *point = radar_aoa_get_point(aoa, age);
+        int8_t *point_features = &features[age * RADAR_NN_POINT_FEATURES];
+
+        if (point->valid != 0U)
+        {
+            point_features[0] = clamp_s8(point->azimuth_deg - azimuth);
+            point_features[1] = clamp_s8(point->elevation_deg - elevation);
+            point_features[2] = clamp_s8(((int32_t)point->range_bin * RADAR_NN_RANGE_STEPS) - range);
+            point_features[3] = RADAR_NN_VALID_STEPS;
+        }
+        else
+        {
+            memset(point_features, 0, RADAR_NN_POINT_FEATURES);
+        }
+    }
+}
+
+/*
+ * Run the int8 model on features
+ */
+void radar_nn_infer_s8(radar_nn_s *nn, const int8_t *features, float32_t *probs)
+{
+    const radar_nn_model_s *model = nn->model;
+
+    fully_connected_s8(features, 0, &model->hidden_weights[0][0], model->hidden_bias,
+                       RADAR_NN_INPUT_LEN, RADAR_NN_HIDDEN_LEN,
+                       model->hidden_multiplier, model->hidden_shift,
+                       model->hidden_offset, model->hidden_offset, nn->hidden);
+
+    fully_connected_s8(nn->hidden, -model->hidden_offset, &model->output_weights[0][0], model->output_bias,
+                       RADAR_NN_HIDDEN_LEN, RADAR_NN_NUM_CLASSES,
+                       model->output_multiplier, model->output_shift,
+                       0, INT8_MIN_VALUE, nn->output);
+
+    for (uint32_t i = 0; i < RADAR_NN_NUM_CLASSES; ++i)
+    {
+        probs[i] = (float32_t)nn->output[i] * model->output_scale;
+    }
+    softmax(probs);
+}
+
+/*
+ * Run the float model on features
+ */
+void radar_nn_infer_f32(radar_nn_s *nn, const int8_t *features, float32_t *probs)
+{
+    const radar_nn_model_s *model = nn->model;
+
+    for (uint32_t o = 0; o < RADAR_NN_HIDDEN_LEN; ++o)
+    {
+        float32_t acc = 0.0f;
+
+        for (uint32_t i = 0; i < RADAR_NN_INPUT_LEN; ++i)
+        {
+            acc += (float32_t)features[i] * model->hidden_weights_f32[o][i];
+        }
+        nn->hidden_f32[o] = fmaxf((acc * RADAR_NN_INPUT_SCALE) + model->hidden_bias_f32[o], 0.0f);
+    }
+
+    for (uint32_t o = 0; o < RADAR_NN_NUM_CLASSES; ++o)
+    {
+        float32_t acc = model->output_bias_f32[o];
+
+        for (uint32_t i = 0; i < RADAR_NN_HIDDEN_LEN; ++i)
+        {
+            acc += nn->hidden_f32[i] * model->output_weights_f32[o][i];
+        }
+        probs[o] = acc;
+    }
+    softmax(probs);
+}
+
+/*
+ * Classify the latest frame of the trajectory
+ */
+uint32_t radar_nn_run(radar_nn_s *nn, const radar_aoa_s *aoa, bool quantized, float32_t *score)
+{
+    float32_t probs[RADAR_NN_NUM_CLASSES];
+    uint32_t idx = 0;
+
+    radar_nn_features(aoa, nn->features);
+
+    if (quantized)
+    {
+        radar_nn_infer_s8(nn, nn->features, probs);
+    }
+    else
+    {
+        radar_nn_infer_f32(nn, nn->features, probs);
+    }
+
+    for (uint32_t i = 1; i < RADAR_NN_NUM_CLASSES; ++i)
+    {
+        if (probs[i] > probs[idx])
+        {
+            idx = i;
+        }
+    }
+
+    /* a class scores only while it rises, so a gesture crosses a threshold once */
+    if (idx != nn->idx)
+    {
+        nn->idx = idx;
+        nn->peak = 0.0f;
+    }
+
+    *score = 0.0f;
+    if (probs[idx] > nn->peak)
+    {
+        *score = probs[idx];
+        nn->peak = probs[idx];
+    }
+
+    return idx;
+}
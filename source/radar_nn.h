@@ -0,0 +1,206 @@
+/******************************************************************************
+** File name: radar_nn.h
+**
+** Description: This file contains the interface of the quantized gesture
+**   classifier, a two layer perceptron on the angle-of-arrival trajectory.
+**   The trajectory is turned into int8 features, both layers run as int8
+**   fully connected layers with CMSIS-NN kernels on target or the portable
+**   reference kernels, and the class scores are a softmax of the
+**   dequantized outputs. The float model the int8 model is calibrated from
+**   runs on the same features for comparison. The parameters are generated
+**   by tools/radar_nn_train.c into radar_nn_model.c.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_NN_H_
+#define RADAR_NN_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "radar_dsp.h"
+#include "radar_aoa.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_NN_POINT_FEATURES
+ * Features of a trajectory point: azimuth, elevation and range relative to
+ * the mean of the valid points, and the valid flag
+ */
+#define RADAR_NN_POINT_FEATURES             (4U)
+
+/*
+ * @def RADAR_NN_INPUT_LEN
+ * Input features, newest trajectory point first
+ */
+#define RADAR_NN_INPUT_LEN                  (RADAR_AOA_TRAJECTORY_LEN * RADAR_NN_POINT_FEATURES)
+
+/*
+ * @def RADAR_NN_HIDDEN_LEN
+ * Neurons of the hidden layer
+ */
+#define RADAR_NN_HIDDEN_LEN                 (32U)
+
+/*
+ * @def RADAR_NN_NUM_CLASSES
+ * Outputs, numbered like the classes of the gestures library
+ */
+#define RADAR_NN_NUM_CLASSES                (8U)
+
+/*
+ * @def RADAR_NN_INPUT_SCALE
+ * Value of one step of the int8 input features, their zero point is 0
+ */
+#define RADAR_NN_INPUT_SCALE                (1.0f / 32.0f)
+
+/*
+ * @def RADAR_NN_RANGE_STEPS
+ * Input steps per range bin
+ */
+#define RADAR_NN_RANGE_STEPS                (8)
+
+/*
+ * @def RADAR_NN_VALID_STEPS
+ * Input value of the valid flag
+ */
+#define RADAR_NN_VALID_STEPS                (32)
+
+/*
+ * @def RADAR_NN_MEM_SIZE
+ * Bytes the classifier allocates: features and layer outputs of both models
+ */
+#define RADAR_NN_MEM_SIZE \
+    (RADAR_NN_INPUT_LEN + RADAR_NN_HIDDEN_LEN + RADAR_NN_NUM_CLASSES +\
+     ((RADAR_NN_HIDDEN_LEN + RADAR_NN_NUM_CLASSES) * sizeof(float32_t)))
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_nn_model_s
+ * Parameters of the int8 model and of the float model it is calibrated from.
+ * Weights are stored output by output, symmetric per tensor. Multipliers
+ * and shifts follow CMSIS-NN: the scale is multiplier * 2^(shift - 31).
+ */
+typedef struct {
+    int8_t hidden_weights[RADAR_NN_HIDDEN_LEN][RADAR_NN_INPUT_LEN];
+    int32_t hidden_bias[RADAR_NN_HIDDEN_LEN];
+    int32_t hidden_multiplier;
+    int32_t hidden_shift;
+    int32_t hidden_offset;              /*<< zero point of the hidden layer output */
+
+    int8_t output_weights[RADAR_NN_NUM_CLASSES][RADAR_NN_HIDDEN_LEN];
+    int32_t output_bias[RADAR_NN_NUM_CLASSES];
+    int32_t output_multiplier;
+    int32_t output_shift;
+    float32_t output_scale;             /*<< value of one step of the outputs, their zero point is 0 */
+
+    float32_t hidden_weights_f32[RADAR_NN_HIDDEN_LEN][RADAR_NN_INPUT_LEN];
+    float32_t hidden_bias_f32[RADAR_NN_HIDDEN_LEN];
+    float32_t output_weights_f32[RADAR_NN_NUM_CLASSES][RADAR_NN_HIDDEN_LEN];
+    float32_t output_bias_f32[RADAR_NN_NUM_CLASSES];
+} radar_nn_model_s;
+
+/*
+ * @typedef typedef struct  radar_nn_s
+ * Classifier state
+ */
+typedef struct {
+    const radar_nn_model_s *model;
+    int8_t *features;                   /*<< [RADAR_NN_INPUT_LEN] */
+    int8_t *hidden;                     /*<< [RADAR_NN_HIDDEN_LEN] */
+    int8_t *output;                     /*<< [RADAR_NN_NUM_CLASSES] */
+    float32_t *hidden_f32;              /*<< [RADAR_NN_HIDDEN_LEN] */
+    float32_t *output_f32;              /*<< [RADAR_NN_NUM_CLASSES] */
+    uint32_t idx;                       /*<< class of the previous frame */
+    float32_t peak;                     /*<< highest score since the class changed */
+} radar_nn_s;
+
+/*******************************************************************************
+ * Variables
+ *******************************************************************************/
+
+/* Parameters generated by tools/radar_nn_train.c */
+extern const radar_nn_model_s radar_nn_model;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the classifier
+ *
+ * @param[out] nn classifier state
+ * @param[in] model model parameters
+ * @param[in] alloc_func allocator returning memory aligned to at least 4 bytes
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid, -2 if allocation fails
+ */
+int32_t radar_nn_init(radar_nn_s *nn, const radar_nn_model_s *model, void* (*alloc_func)(size_t size));
+
+/** @brief Forget the class of the previous frames
+ *
+ * @param[in,out] nn classifier state
+ */
+void radar_nn_reset(radar_nn_s *nn);
+
+/** @brief Compute the int8 features of the trajectory
+ *
+ * @param[in] aoa angle-of-arrival stage holding the trajectory
+ * @param[out] features RADAR_NN_INPUT_LEN features
+ */
+void radar_nn_features(const radar_aoa_s *aoa, int8_t *features);
+
+/** @brief Run the int8 model on features
+ *
+ * @param[in] nn classifier state
+ * @param[in] features RADAR_NN_INPUT_LEN features
+ * @param[out] probs RADAR_NN_NUM_CLASSES class probabilities
+ */
+void radar_nn_infer_s8(radar_nn_s *nn, const int8_t *features, float32_t *probs);
+
+/** @brief Run the float model on features
+ *
+ * @param[in] nn classifier state
+ * @param[in] features RADAR_NN_INPUT_LEN features
+ * @param[out] probs RADAR_NN_NUM_CLASSES class probabilities
+ */
+void radar_nn_infer_f32(radar_nn_s *nn, const int8_t *features, float32_t *probs);
+
+/** @brief Classify the latest frame of the trajectory
+ *
+ * Call once per frame after \ref radar_aoa_run. Reports the most probable
+ * class. Its probability is the score while it rises, the score is 0 on
+ * frames that do not raise the highest probability since the class changed.
+ *
+ * @param[in,out] nn classifier state
+ * @param[in] aoa angle-of-arrival stage holding the trajectory
+ * @param[in] quantized true for the int8 model, false for the float model
+ * @param[out] score score of the class, 0 to 1
+ *
+ * @return class of the frame
+ */
+uint32_t radar_nn_run(radar_nn_s *nn, const radar_aoa_s *aoa, bool quantized, float32_t *score);
+
+#endif /* RADAR_NN_H_ */
@@ -0,0 +1,1042 @@
+/*****************************************************************************
+ * File name: radar_nn_model.c
+ *
+ * Description: This file contains the parameters of the gesture classifier
+ * of radar_nn.h. It is generated by tools/radar_nn_train.c, do not edit.
+ *
+ * Trained on 38865 frames of 6 recordings in 30 epochs.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include "radar_nn.h"
+
+const radar_nn_model_s radar_nn_model =
+{
+    .hidden_weights = {
+        {
+            -5, 2, -36, 41, -5, 1, -33, 23, -8, -2, -28, 27, -8, -4, -13, 6,
+            -3, -5, -6, 4, 7, -8, -2, -26, 3, -12, -61, -27, 0, -14, -33, -32,
+            -2, -10, -1, -32, -3, -9, -2, -45, -3, -5, 2, -25, -3, -2, -5, -31,
+            -7, 28, -17, -40, -8, 1, 6, 17, -7, 1, -8, 10, -8, 4, 8, -5,
+            -3, 5, 16, 13, -3, 6, 7, 14, -2, 5, 1, -6, 1, 5, -16, -5,
+            0, 5, -17, 6, 7, -6, -12, 16, 19, -5, -8, 1, 16, -2, -10, 8,
+            7, 8, -11, 22, -1, 9, -8, 24, -4, 9, -8, 28, -7, 0, 1, 25,
+            -9, 0, 35, 51, -12, 2, 31, 46, -13, -2, 31, 37, -13, -1, 30, 34
+        },
+        {
+            7, -2, -21, 17, 7, -1, -20, 10, 6, -3, -23, 10, 6, -2, -12, 10,
+            8, -3, -4, 18, 22, -5, -5, -2, 12, -6, -26, -11, 6, -8, -15, -10,
+            1, -5, -1, -7, -3, -4, -7, -8, -5, 0, -5, -8, -8, 2, -6, -15,
+            -12, 17, -11, -14, -11, 0, -3, 14, -11, -1, -8, 12, -13, 2, -4, 10,
+            -5, 3, -6, 14, -4, 4, -9, 15, -5, 4, -12, 10, -1, 4, -16, 8,
+            -2, 4, -19, 5, 5, -6, -8, 19, 13, -4, -6, 19, 12, -2, 6, 14,
+            5, 5, 14, 34, -2, 5, 14, 32, -6, 5, 12, 29, -7, 0, 11, 21,
+            -9, 1, 23, 26, -10, 2, 20, 23, -11, -1, 20, 19, -12, 0, 20, 18
+        },
+        {
+            11, 20, 16, -13, 12, 22, 15, -8, 13, 23, 13, -7, 12, 23, 9, 4,
+            11, 24, 11, 2, 17, 38, 8, 15, 15, 33, 40, 27, 10, 26, 22, 26,
+            7, 15, 1, 18, 3, 6, -4, 26, -1, -4, -8, 22, -5, -14, -6, 21,
+            -8, -20, 0, 24, -3, -14, -4, 10, -1, -14, 4, 16, -2, -18, -2, 12,
+            -10, -20, -6, 0, -10, -20, 2, 8, -9, -20, 4, 5, -9, -20, 14, 9,
+            -8, -19, 15, 10, -8, -8, 9, 5, -10, -8, 7, 5, -10, -5, -1, 8,
+            -5, -4, 2, 9, -1, -4, 1, 3, 2, -5, -1, 3, 4, -2, -1, 4,
+            5, -2, -18, -9, 6, -3, -16, -8, 7, -1, -16, -5, 8, -1, -16, -4
+        },
+        {
+            25, -23, 0, 12, 27, -25, 2, 8, 26, -26, 2, 10, 23, -24, 9, 10,
+            24, -24, 6, 14, 35, -37, 1, -7, 36, -31, -8, -4, 23, -23, -11, -2,
+            12, -12, -9, 1, 0, -2, -15, 0, -11, 8, -14, -3, -21, 18, -15, -2,
+            -29, 23, -14, -12, -14, 15, -3, 18, -13, 14, 2, 18, -13, 16, 3, 10,
+            -13, 18, 3, 11, -15, 19, 4, 7, -17, 18, 1, 3, -17, 18, -2, 0,
+            -19, 17, -5, -4, -16, 6, 0, 1, -14, 6, 0, 3, -11, 4, 4, 0,
+            -1, 3, 3, 13, -4, 4, 3, 12, -6, 5, 2, 13, -7, 3, 2, 10,
+            -8, 3, 7, 14, -8, 3, 9, 14, -9, 0, 9, 12, -9, 0, 10, 11
+        },
+        {
+            0, 0, -10, -5, 0, 0, -10, -7, 0, 0, -7, -8, 0, 0, -2, -10,
+            -3, 0, -7, -7, 0, 0, -2, -17, -3, 0, -28, -36, -3, 0, -19, -20,
+            -3, 0, -4, -34, -3, 0, -4, -25, -3, 1, -2, -22, -3, 1, -2, -26,
+            -2, 0, -2, -26, -2, 2, 2, -16, -3, -1, 0, -8, -3, -1, -1, -3,
+            8, -1, 14, -1, 8, -1, 10, -3, 8, -1, 8, 2, 8, -1, 3, 0,
+            8, -1, 4, 0, 7, 0, -1, 5, 7, 0, -1, 2, 6, 0, -5, 6,
+            3, 0, -6, 19, -4, 1, -4, 15, -7, 1, -2, 23, -8, 2, 6, 15,
+            -8, 0, -1, 20, -8, 0, -1, 19, -9, 1, -1, 19, -9, 1, 6, 21
+        },
+        {
+            -55, 68, 8, 19, -59, 71, 8, 20, -58, 67, 10, 19, -54, 61, 3, 25,
+            -54, 59, 8, 27, -72, 94, 16, 36, -74, 80, 15, 13, -51, 55, 5, 10,
+            -28, 28, 0, 9, -5, 1, -11, 10, 18, -25, -15, 9, 38, -49, -17, 4,
+            57, -37, -17, 39, 26, -33, -17, 28, 22, -34, -13, 30, 29, -39, -11, 16,
+            32, -44, -4, 13, 36, -47, 3, 11, 37, -50, 7, 10, 37, -50, 15, 6,
+            37, -48, 22, 4, 33, -38, 12, -5, 27, -34, 10, -14, 18, -23, -3, 2,
+            5, -6, 2, 13, 10, -7, -1, 10, 12, -9, -2, 6, 14, -7, -2, 9,
+            14, -6, -7, 4, 14, -5, -8, 3, 12, -1, -9, 2, 11, -1, -10, 1
+        },
+        {
+            -20, -23, 3, 4, -21, -24, 3, 4, -20, -23, 6, 4, -18, -21, 2, 6,
+            -17, -20, 3, 5, -25, -33, 1, 9, -28, -28, -1, 5, -20, -20, -3, 5,
+            -11, -11, -3, 5, -3, -1, -4, 5, 5, 8, -5, 5, 13, 17, -8, 7,
+            20, 17, -7, -1, 5, 11, -5, 10, 3, 11, -4, 9, 7, 13, -3, 6,
+            10, 16, -1, 4, 13, 16, -1, 2, 14, 17, 1, 3, 14, 17, 3, 0,
+            14, 16, 1, -1, 12, 8, 3, 2, 10, 7, 4, 1, 9, 5, 0, -1,
+            2, 2, 3, 7, 4, 3, 3, 5, 6, 3, 2, 4, 7, 3, 3, 2,
+            8, 2, 3, 2, 8, 2, 2, 2, 7, 0, 2, -1, 5, 0, 0, -3
+        },
+        {
+            -16, -21, 0, -8, -17, -22, 0, -5, -16, -20, 1, -4, -15, -19, -4, -5,
+            -13, -19, -5, -1, -14, -30, -5, 6, -11, -27, -6, 6, -5, -19, -2, 7,
+            0, -11, 1, 8, 5, -2, 7, 6, 9, 7, 10, 7, 14, 15, 9, 12,
+            17, 9, 8, -2, 4, 13, 4, -12, 5, 15, 1, -15, 5, 16, 1, -6,
+            6, 17, 2, -2, 6, 16, 1, -2, 5, 17, 0, 4, 6, 15, 0, 4,
+            5, 14, -1, 2, 4, 12, 0, 7, 1, 11, -1, 4, 1, 7, -1, -1,
+            0, 1, -1, -6, 0, 1, 0, -5, 0, 1, 0, -4, 0, 1, 0, -4,
+            0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0
+        },
+        {
+            37, 34, -19, 8, 38, 36, -20, 9, 37, 35, -21, 7, 35, 32, -9, 0,
+            33, 30, -8, 2, 43, 45, -6, 2, 44, 37, -22, 8, 29, 25, -6, 8,
+            14, 10, 8, 15, 0, -4, 14, 16, -14, -17, 20, 13, -26, -29, 21, 5,
+            -37, -26, 17, 21, -15, -19, 8, 2, -15, -19, -2, -6, -20, -22, 2, 3,
+            -25, -25, 0, 4, -27, -25, -7, 3, -28, -25, -8, -3, -25, -24, -20, -3,
+            -25, -20, -22, -9, -22, -13, -15, -4, -15, -11, -15, -7, -11, -7, 3, -20,
+            -1, -1, -4, -39, -2, -1, -1, -36, -3, -2, 0, -33, -3, -2, 1, -33,
+            -4, -1, 13, -19, -4, -1, 13, -19, -2, 0, 13, -16, 0, 0, 13, -15
+        },
+        {
+            54, -33, 4, -2, 57, -35, 4, 1, 55, -34, 3, 4, 50, -31, 9, 7,
+            50, -31, 4, 10, 70, -48, -5, 6, 72, -40, 12, 25, 51, -27, 7, 29,
+            31, -14, 0, 27, 9, 0, 1, 26, -13, 13, 4, 28, -33, 26, 5, 29,
+            -51, 21, 7, 15, -23, 21, 10, 14, -18, 22, 13, 15, -25, 24, 8, 15,
+            -30, 25, 5, 11, -34, 25, 6, 10, -36, 25, 5, 8, -37, 24, 3, 8,
+            -38, 22, 2, 7, -34, 17, -2, 7, -29, 14, -3, 12, -19, 10, -3, 4,
+            -7, 2, -9, -1, -9, 3, -9, -1, -10, 3, -6, 0, -9, 4, -7, 2,
+            -9, 2, -12, -3, -9, 2, -11, -1, -6, 0, -11, 0, -4, 0, -11, 2
+        },
+        {
+            8, -9, -38, -18, 5, -9, -35, -12, 5, -7, -24, -11, 5, -5, -3, -8,
+            1, -1, 29, -15, -8, 8, 65, 7, -23, 13, 117, 7, -21, 16, 81, 10,
+            -17, 15, 45, 3, -12, 15, 12, 7, -9, 13, -29, 6, -6, 11, -68, 9,
+            0, 5, -81, -14, 3, 1, -105, 0, 7, -1, -99, -7, 10, -5, -90, -2,
+            6, -7, -66, -2, 10, -10, -35, 5, 13, -11, -14, 23, 15, -10, 22, 20,
+            14, -11, 27, 13, 8, -2, 41, 4, 1, -3, 34, 3, -5, -3, 45, 5,
+            -4, -4, 53, 9, 6, -4, 50, 11, 9, -4, 45, -3, 10, 2, 38, 9,
+            12, 1, -8, -41, 12, 0, -4, -37, 12, 0, -4, -35, 12, -1, -10, -33
+        },
+        {
+            6, 4, -1, -4, 6, 4, -1, -3, 6, 4, -2, -2, 5, 4, -1, -2,
+            5, 3, -1, -4, 6, 6, -2, 0, 9, 4, -3, 5, 7, 3, 0, 5,
+            4, 2, 1, 5, 2, 0, 3, 5, -1, -1, 4, 5, -3, -3, 4, 6,
+            -5, -5, 5, 7, -2, -1, 4, -1, -1, -2, 2, -3, -1, -3, 1, -1,
+            -2, -3, 1, 1, -3, -3, 0, 1, -4, -3, -1, 1, -4, -3, -2, 1,
+            -5, -3, -2, 1, -5, 0, -1, 1, -5, 0, -2, 1, -5, 0, 0, -2,
+            -1, 0, -1, -9, -1, 0, -1, -8, -2, 0, -2, -8, -2, 0, -1, -7,
+            -2, 0, -1, -3, -2, 0, -1, -3, -1, 0, -1, -2, 0, 0, 0, -1
+        },
+        {
+            -60, -68, 12, 4, -64, -72, 13, 9, -62, -69, 17, 9, -58, -63, 7, 16,
+            -58, -61, 6, 21, -83, -97, 4, 39, -87, -82, 20, 29, -60, -56, 8, 28,
+            -34, -28, 1, 28, -8, 0, 1, 28, 18, 26, -5, 28, 42, 51, -12, 32,
+            63, 42, -9, 8, 31, 34, -6, 20, 27, 35, -1, 23, 36, 40, -3, 16,
+            37, 47, -1, 9, 41, 50, 3, 9, 44, 53, 9, 12, 44, 51, 18, 7,
+            45, 47, 14, 7, 39, 36, 10, 5, 29, 31, 10, 1, 20, 21, -7, 5,
+            3, 6, -1, 11, 9, 8, -3, 10, 12, 9, -4, 7, 14, 8, -5, 6,
+            15, 6, -12, -8, 16, 6, -11, -7, 16, 1, -13, -6, 15, 1, -13, -5
+        },
+        {
+            -39, -45, -30, 8, -42, -47, -30, 7, -43, -44, -26, 5, -41, -42, -17, 0,
+            -42, -43, -14, 2, -71, -65, -8, 23, -57, -57, -31, 17, -40, -38, -2, 18,
+            -22, -20, 26, 18, -5, -1, 42, 18, 12, 16, 45, 18, 28, 33, 39, 20,
+            40, 25, 23, -2, 23, 28, 8, -12, 26, 34, -14, -29, 27, 36, -2, -11,
+            25, 38, 0, 5, 27, 36, -12, 7, 27, 38, -11, -1, 26, 34, -23, -3,
+            27, 31, -25, -13, 21, 27, -13, -5, 20, 23, -9, -7, 18, 14, 1, -23,
+            2, 0, -8, -44, 2, 0, -4, -45, 3, 0, -7, -42, 3, 0, -2, -38,
+            3, 1, 15, -19, 4, 1, 15, -18, 4, 0, 15, -17, 4, 0, 15, -17
+        },
+        {
+            1, 2, -27, 33, 1, 4, -26, 23, -1, 2, -29, 22, -1, 2, -17, 18,
+            1, 2, -5, 18, 15, 3, -8, -3, 5, 0, -30, -14, 2, -3, -14, -14,
+            -1, -2, 2, -14, -2, -3, -3, -13, -2, -1, 0, -13, -4, 0, -2, -26,
+            -6, 17, -9, -19, -9, -3, -2, 13, -8, -3, -10, 8, -11, -1, -3, 7,
+            -2, 0, -8, 3, 0, 1, -10, 4, -1, 1, -13, -3, 2, 3, -19, -6,
+            1, 1, -21, -10, 7, -11, -10, 3, 15, -9, -7, 8, 14, -7, 5, 3,
+            7, 5, 14, 25, -1, 5, 15, 25, -5, 5, 12, 22, -7, -1, 11, 9,
+            -9, 0, 26, 23, -10, 2, 23, 19, -11, -2, 22, 16, -12, 0, 22, 17
+        },
+        {
+            0, 0, -5, 9, 0, 0, -4, 8, 0, 0, -1, 2, 0, 0, 3, -9,
+            0, 0, 1, -2, 0, 0, 5, -15, 0, 0, -21, -34, 0, 0, -17, -27,
+            0, 0, -6, -26, 0, 0, -10, -30, 0, 0, -6, -32, 0, 0, 0, -32,
+            0, 0, 0, -24, 0, 0, 0, -2, 0, 0, -1, 6, 0, 0, 0, -3,
+            0, 0, 12, 2, 0, 0, 11, -7, 0, 0, 8, -7, 0, 0, 3, -4,
+            0, 0, 2, -12, 0, 0, 0, -10, 0, 0, 0, -14, 0, 0, -4, -1,
+            0, 0, -6, 18, 0, 0, -5, 14, 0, 0, -6, 13, 0, 0, -2, 6,
+            0, 0, 0, 4, 1, 0, 0, 4, 1, 0, 0, 4, 0, 0, 0, 7
+        },
+        {
+            46, 44, 1, 9, 49, 47, 1, 11, 48, 45, -3, 14, 44, 42, 8, 17,
+            44, 42, 3, 19, 59, 65, 5, 5, 62, 56, 6, 14, 44, 38, 4, 15,
+            26, 20, -1, 14, 7, 1, -7, 14, -13, -17, -6, 13, -30, -33, -2, 10,
+            -46, -29, 0, 28, -22, -27, 2, 21, -19, -28, 5, 21, -23, -31, 3, 17,
+            -26, -33, 3, 13, -29, -34, 5, 11, -31, -35, 2, 6, -32, -34, 1, 6,
+            -33, -31, 4, 4, -29, -22, 0, 1, -24, -20, -1, 2, -17, -14, 0, 0,
+            -5, -4, -8, 0, -7, -5, -8, 1, -9, -6, -7, 0, -10, -5, -7, 3,
+            -11, -4, -9, 4, -11, -4, -7, 3, -10, -1, -5, 7, -10, 0, -5, 8
+        },
+        {
+            -23, 41, -1, 1, -24, 44, -2, 6, -24, 43, -3, 6, -22, 39, -9, 8,
+            -23, 37, -4, 6, -32, 58, 3, 29, -31, 49, 0, 19, -21, 35, 2, 18,
+            -11, 18, 2, 18, -1, 1, 8, 17, 9, -15, 8, 18, 18, -31, 10, 17,
+            25, -32, 8, 30, 11, -20, -2, 3, 10, -20, -6, -2, 13, -23, -5, 1,
+            13, -26, -4, 3, 14, -29, -5, 3, 15, -30, -5, 5, 14, -30, -3, 5,
+            15, -28, 2, 6, 12, -16, 0, -1, 11, -15, 0, -5, 9, -11, 3, -3,
+            1, -5, 4, -15, 3, -6, 4, -14, 5, -7, 4, -14, 6, -5, 4, -11,
+            6, -4, 4, -11, 6, -4, 2, -11, 6, -1, 2, -9, 6, -1, 2, -9
+        },
+        {
+            39, 9, 1, 0, 41, 10, 0, 3, 40, 10, -3, 5, 36, 10, 6, 6,
+            36, 10, 1, 9, 50, 14, -1, 3, 53, 12, 6, 17, 37, 9, 5, 18,
+            22, 5, 2, 17, 6, 1, 0, 17, -10, -3, 2, 17, -25, -7, 4, 18,
+            -38, -9, 6, 17, -16, -6, 6, 12, -11, -6, 8, 12, -17, -7, 5, 10,
+            -21, -8, 4, 8, -25, -8, 4, 7, -26, -8, 3, 4, -27, -8, 1, 5,
+            -28, -7, 1, 4, -25, -2, -2, 2, -22, -2, -2, 5, -15, -1, -2, 1,
+            -5, 0, -8, -5, -7, 0, -8, -4, -8, -1, -7, -3, -9, 0, -7, -1,
+            -9, 0, -9, -2, -9, 0, -8, -2, -7, 0, -7, 1, -5, 0, -8, 3
+        },
+        {
+            -23, -28, 0, -4, -24, -29, 0, -2, -23, -27, 3, -2, -20, -24, -4, -1,
+            -21, -23, -2, -1, -31, -35, -2, 17, -30, -30, -6, 15, -20, -20, -4, 15,
+            -10, -9, -1, 15, -1, 2, 4, 15, 9, 12, 5, 16, 17, 21, 3, 19,
+            24, 16, 2, 2, 9, 14, 0, 0, 8, 14, -3, -3, 12, 15, -2, -1,
+            13, 17, -3, 1, 14, 17, -4, 0, 15, 18, -2, 3, 14, 17, -2, 1,
+            15, 15, -3, 0, 12, 13, 0, 0, 10, 11, 0, -2, 10, 8, 2, -7,
+            1, 2, 6, -9, 2, 2, 6, -9, 4, 2, 6, -8, 4, 2, 6, -9,
+            5, 2, 6, -8, 5, 1, 5, -8, 5, 0, 4, -9, 6, 0, 4, -8
+        },
+        {
+            -24, 30, 4, 1, -25, 31, 4, 6, -24, 30, 4, 5, -22, 27, 0, 8,
+            -23, 26, 2, 10, -30, 42, 6, 20, -30, 36, 13, 10, -20, 26, 8, 9,
+            -10, 14, 3, 10, 0, 1, 0, 10, 9, -11, -1, 8, 17, -22, -1, 8,
+            25, -21, -1, 21, 9, -15, -4, 7, 8, -15, -3, 9, 12, -18, -4, 6,
+            12, -20, -1, 2, 14, -21, 2, 2, 15, -22, 4, 5, 13, -22, 9, 4,
+            14, -21, 13, 5, 11, -12, 6, -4, 8, -11, 6, -6, 7, -8, -5, 1,
+            1, -3, -2, 5, 4, -4, -2, 4, 7, -4, -2, 2, 8, -4, -2, 4,
+            9, -3, -9, -3, 9, -3, -9, -3, 9, 0, -9, -2, 9, -1, -10, -2
+        },
+        {
+            2, 4, -23, 26, 2, 4, -22, 23, 0, 2, -19, 22, 0, 1, -8, 8,
+            3, 0, -7, 6, 14, -1, -6, -7, 6, -3, -41, -30, 2, -6, -23, -15,
+            -1, -5, -5, -16, -3, -5, -4, -24, -3, -4, -4, -26, -5, -3, -8, -30,
+            -8, 16, -13, -30, -8, -1, 0, 5, -8, -2, -6, 3, -10, 0, 1, 6,
+            -3, 1, 12, 13, -3, 2, 4, 8, -4, 2, 0, 2, 0, 2, -12, 5,
+            -1, 3, -14, 1, 6, -6, -8, 10, 14, -5, -6, 0, 13, -3, -2, 2,
+            5, 4, 0, 20, -1, 5, 1, 12, -5, 5, 4, 17, -7, 0, 6, 12,
+            -9, 1, 23, 29, -10, 2, 20, 26, -11, -1, 20, 20, -12, 0, 20, 19
+        },
+        {
+            0, 0, -7, -1, 0, 0, -7, -2, 0, 0, -5, -3, 0, 0, 2, -8,
+            0, 0, 0, -8, 0, 0, 0, -9, 0, 0, -13, -6, 0, 0, -4, -7,
+            0, 0, 3, -10, 0, 0, 4, -7, 0, 0, 4, -7, 0, 0, 0, -5,
+            0, 0, 0, -5, 0, 0, 2, 0, 0, 0, 1, -4, 0, 0, 3, -5,
+            0, 0, 7, -2, 0, 0, 4, -2, 0, 0, 6, -3, 0, 0, 0, -4,
+            0, 0, 0, -6, 0, 0, 0, -5, 0, 0, 0, -9, 0, 0, -4, -14,
+            0, 0, -9, -23, 0, 0, -8, -19, 0, 0, -7, -14, 0, 0, -7, -13,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2
+        },
+        {
+            18, 16, -8, 7, 18, 17, -8, 6, 17, 16, -10, 5, 15, 15, -6, 4,
+            16, 14, -4, 3, 20, 21, -1, 3, 22, 17, -13, 2, 14, 12, -5, 2,
+            7, 6, -1, 2, 0, -1, 0, 2, -6, -7, 2, 2, -12, -13, 4, -1,
+            -18, -12, 2, 3, -5, -8, 0, -2, -6, -9, -4, -4, -8, -10, -3, 0,
+            -11, -11, -7, 0, -13, -11, -9, 1, -15, -11, -13, -3, -13, -11, -15, -4,
+            -13, -9, -16, -5, -10, -5, -4, -2, -7, -4, -5, -1, -6, -3, 9, -6,
+            -1, 0, 6, -13, -1, 0, 8, -11, -2, -1, 8, -10, -2, -1, 8, -10,
+            -2, 0, 11, -9, -3, 0, 10, -10, -2, 0, 10, -8, 0, 0, 10, -8
+        },
+        {
+            15, 4, -8, 9, 16, 4, -8, 6, 15, 4, -10, 4, 13, 4, -5, 4,
+            14, 4, -3, 3, 20, 5, -2, 0, 20, 3, -13, -2, 13, 2, -6, -2,
+            6, 0, -1, -2, -1, -1, -2, -2, -6, -2, -1, -2, -11, -4, 0, -5,
+            -16, -3, -1, -5, -5, -3, 0, 0, -6, -3, -3, -2, -9, -2, -3, 1,
+            -11, -2, -7, 0, -13, -2, -9, 1, -15, -2, -12, -6, -12, -1, -14, -6,
+            -12, 0, -15, -8, -8, -1, -4, -1, -4, -1, -4, 2, -3, 0, 8, -3,
+            0, 0, 7, -6, 0, 0, 9, -5, 0, 0, 9, -4, 0, 0, 8, -6,
+            0, 0, 11, -5, 0, 0, 11, -5, 0, 0, 11, -5, 0, 0, 10, -5
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        {
+            15, -13, -2, -10, 16, -14, -2, -8, 15, -13, -3, -6, 14, -12, -2, -7,
+            13, -12, -4, -7, 14, -18, -6, 0, 20, -15, -5, 10, 14, -10, -1, 9,
+            8, -5, -1, 10, 2, 0, 5, 9, -4, 5, 7, 10, -9, 10, 8, 13,
+            -14, 6, 8, 3, -4, 8, 6, -5, -2, 9, 3, -7, -3, 10, 4, -2,
+            -6, 11, 2, 0, -8, 9, -1, 0, -9, 10, -3, 1, -10, 8, -5, 3,
+            -11, 8, -7, 2, -10, 7, -3, 5, -9, 6, -4, 6, -8, 4, 2, 0,
+            -2, 0, -1, -13, -3, 0, 0, -11, -4, 1, 1, -10, -5, 1, 1, -9,
+            -5, 0, 1, -9, -5, 0, 1, -9, -3, 0, 2, -7, -1, 0, 3, -4
+        },
+        {
+            1, 0, -17, -6, 1, 0, -16, -7, 1, 0, -9, -9, 0, -2, 10, 5,
+            0, -1, 30, 7, 3, 2, 47, 3, -11, 3, 80, -2, -10, 3, 60, -2,
+            -8, 3, 33, -2, -5, 3, 11, -4, -3, 1, -10, -4, -2, 1, -30, -1,
+            0, 2, -36, -2, 1, -1, -45, -4, 2, -1, -40, -3, 2, -1, -35, 3,
+            -3, -2, -18, 5, -1, -3, 4, 10, 2, -5, 13, 15, 5, -4, 30, 10,
+            5, -6, 28, 7, 6, -2, 21, -1, 5, -2, 16, -1, -2, -1, 1, 18,
+            -5, 0, 6, 38, 2, 1, 3, 33, 5, 1, 1, 27, 6, 2, -3, 26,
+            6, 0, -18, -3, 7, -1, -16, -2, 8, -1, -15, -2, 8, -1, -16, -2
+        },
+        {
+            -19, -15, 6, 14, -20, -17, 8, 11, -20, -18, 12, 11, -18, -17, 11, 13,
+            -17, -16, 10, 14, -19, -25, 8, 2, -27, -20, 10, -8, -19, -16, -1, -7,
+            -11, -8, -3, -7, -3, -2, -15, -7, 5, 5, -19, -8, 11, 12, -24, -11,
+            17, 21, -22, -8, 8, 10, -12, 17, 4, 9, -4, 22, 5, 10, -4, 11,
+            8, 11, 0, 6, 11, 13, 6, 4, 12, 12, 10, 1, 13, 13, 13, -3,
+            13, 12, 13, -3, 13, 3, 8, -2, 13, 3, 10, -4, 9, 3, -4, 4,
+            4, 3, 1, 25, 6, 3, -1, 21, 7, 4, -3, 18, 8, 3, -4, 15,
+            9, 3, -5, 14, 9, 3, -5, 14, 6, 0, -6, 10, 4, 0, -7, 9
+        },
+        {
+            -36, 28, 127, -47, -33, 26, 127, -15, -29, 23, 114, -8, -27, 21, 74, 5,
+            -21, 20, 39, 5, -21, 17, 3, 6, -5, 10, -38, 6, 8, 1, -85, 11,
+            17, -8, -107, 2, 23, -15, -99, 12, 29, -22, -87, 2, 34, -28, -47, 9,
+            37, -27, -4, 17, 17, -7, 45, 0, 9, -2, 98, 24, 12, -5, 86, -6,
+            0, -5, 80, -13, 0, -3, 81, -11, 1, -4, 71, -10, -6, -3, 52, -6,
+            -9, -5, 41, -9, -9, 0, 6, -21, -9, -2, -6, -23, -14, -3, -35, -9,
+            -10, -7, -51, -8, 2, -8, -54, -10, 7, -8, -54, -9, 9, -3, -54, 5,
+            10, -1, -53, 6, 10, -2, -52, 8, 10, 3, -53, 11, 11, 2, -55, 10
+        },
+        {
+            -34, 34, -15, -16, -38, 39, -15, -8, -39, 40, -13, -5, -37, 38, -16, -5,
+            -39, 39, -8, -8, -61, 60, -7, 22, -54, 51, -9, 13, -36, 38, 7, 15,
+            -20, 21, 17, 15, -3, 6, 28, 12, 12, -10, 29, 14, 27, -26, 32, 17,
+            39, -39, 27, 28, 23, -24, 7, -11, 23, -23, -6, -26, 26, -27, 2, -7,
+            26, -29, 1, -1, 27, -32, -5, 0, 28, -31, -4, 0, 27, -30, -9, 0,
+            28, -27, -7, 0, 23, -12, -5, -3, 18, -11, -3, -10, 18, -8, -1, -10,
+            2, -5, -2, -29, 5, -6, 0, -26, 6, -7, -1, -25, 6, -4, 0, -21,
+            7, -5, 1, -15, 7, -5, -2, -14, 7, 0, -2, -11, 7, 0, -2, -10
+        },
+        {
+            62, -47, 28, -11, 66, -51, 24, 2, 65, -49, 22, 7, 59, -45, 8, 7,
+            53, -43, 6, 10, 80, -66, -8, 5, 78, -53, 32, 31, 55, -34, 2, 31,
+            34, -15, -29, 31, 10, 4, -33, 31, -14, 21, -37, 28, -36, 37, -35, 37,
+            -53, 27, -23, 20, -26, 27, -24, 10, -22, 27, -6, 20, -29, 28, -22, 5,
+            -28, 31, -29, -1, -32, 32, -19, 3, -35, 33, -11, 0, -37, 32, 4, 11,
+            -38, 29, 9, 14, -36, 27, 16, 4, -33, 22, 16, -3, -22, 16, 33, -2,
+            -5, 2, 39, -14, -9, 3, 36, -13, -11, 4, 40, -16, -12, 6, 30, -13,
+            -13, 4, -7, -34, -12, 3, -5, -31, -8, 2, -3, -25, -5, 1, -1, -21
+        }
+    },
+    .hidden_bias = {
+        7733, 5148, 0, 2655, 4899, 1613, 889, -41,
+        1568, 31, -194, 15, 99, 1073, 5907, 4824,
+        936, -3, 73, 37, 24, 5256, 1921, 519,
+        879, 0, 9, 158, 2274, -210, -25, 3
+    },
+    .hidden_multiplier = 1344482771,
+    .hidden_shift = -7,
+    .hidden_offset = -128,
+
+    .output_weights = {
+        {
+            100, 60, -21, 23, 59, 12, 7, -11, 9, -11, -57, -4, -14, -2, 74, 57,
+            6, -10, -3, -5, -3, 62, 19, 3, 9, 0, -8, -9, 23, -91, -26, -41
+        },
+        {
+            -30, -13, 22, 14, -5, 21, 7, -14, -26, 4, 85, -7, 14, -56, -20, 7,
+            8, -8, 3, -4, 7, -12, -11, -9, -5, 1, -9, 52, 26, 127, -46, 38
+        },
+        {
+            -16, -18, -9, -32, -9, 51, 21, 14, -30, -54, 2, -5, 61, 54, -10, -9,
+            -46, 26, -36, 24, 23, -13, -3, -12, -10, 0, -10, -8, 17, 3, 47, -65
+        },
+        {
+            -18, -2, 16, 21, -11, -61, -22, -5, 44, 59, -22, 6, -66, -25, -8, -11,
+            47, -16, 44, -19, -21, -7, -4, 17, 14, 0, 21, -16, -29, -27, -11, 65
+        },
+        {
+            -13, -12, -4, -7, -8, -10, -3, 0, -4, -5, -2, 0, -8, -4, -12, -8,
+            -6, -4, -3, -2, -2, -9, -3, -1, -2, 0, 0, -2, -6, -2, -1, -6
+        },
+        {
+            -13, -12, -4, -7, -8, -10, -3, 0, -4, -5, -2, 0, -8, -4, -12, -8,
+            -6, -4, -3, -2, -2, -9, -3, -1, -2, 0, 0, -2, -6, -2, -1, -6
+        },
+        {
+            -21, -11, 26, -28, -11, 69, -24, -4, 43, -30, -4, 4, -74, -31, -7, -10,
+            49, 52, 11, -24, 35, -8, -4, 19, 6, 0, -4, -6, -23, -3, 53, -48
+        },
+        {
+            -9, -5, -22, 25, -10, -75, 25, 27, -30, 37, -15, -1, 67, 64, -13, -10,
+            -45, -39, -5, 34, -31, -8, -4, -12, -1, 0, 16, -9, 10, -18, -17, 46
+        }
+    },
+    .output_bias = {
+        1280, -143, -184, -145, -266, -266, -177, -157
+    },
+    .output_multiplier = 1678315880,
+    .output_shift = -8,
+    .output_scale = 0.206826106f,
+
+    .hidden_weights_f32 = {
+        {
+            -0.0333686285f, 0.0130560743f, -0.22844024f, 0.256528467f, -0.0316774137f, 0.00886468776f, -0.209556684f, 0.141600505f,
+            -0.0479117483f, -0.0107492404f, -0.176680744f, 0.167771459f, -0.0479865894f, -0.0225948431f, -0.0838580728f, 0.0356040522f,
+            -0.015808966f, -0.0316147991f, -0.0383451432f, 0.0242349189f, 0.0456188321f, -0.0484726802f, -0.0102102514f, -0.162564635f,
+            0.0185962711f, -0.075935334f, -0.386226475f, -0.167980075f, 0.00110721588f, -0.0878687277f, -0.205096066f, -0.202232391f,
+            -0.0145251788f, -0.0637412965f, -0.00916531682f, -0.203841925f, -0.0218285955f, -0.0576929003f, -0.00960159302f, -0.283847839f,
+            -0.0161968023f, -0.0337918214f, 0.0144924447f, -0.155550525f, -0.0210283045f, -0.015602435f, -0.0342599079f, -0.193008453f,
+            -0.0459874384f, 0.178632051f, -0.109784432f, -0.251021057f, -0.0491781831f, 0.00814685505f, 0.0393958278f, 0.107765764f,
+            -0.0423490331f, 0.00402945653f, -0.0515781678f, 0.0626017153f, -0.0527700074f, 0.0254785996f, 0.0510465205f, -0.0298389103f,
+            -0.0160364956f, 0.0313017145f, 0.101380803f, 0.0810035244f, -0.019715216f, 0.0374709629f, 0.0420816764f, 0.0892494023f,
+            -0.0141913667f, 0.032388024f, 0.00408362271f, -0.0383042134f, 0.00915060844f, 0.03275254f, -0.0976235121f, -0.0308705177f,
+            0.00242965715f, 0.0313937105f, -0.10578911f, 0.0378726386f, 0.0457512587f, -0.0406557545f, -0.0743056834f, 0.101020135f,
+            0.121127926f, -0.0316632912f, -0.0476959944f, 0.00610579737f, 0.0988759547f, -0.0119145848f, -0.0645057261f, 0.0513304882f,
+            0.0443925448f, 0.0496530309f, -0.0706493407f, 0.13762942f, -0.0061727399f, 0.0539112724f, -0.0491160341f, 0.149968386f,
+            -0.0272794589f, 0.0560869649f, -0.0510337614f, 0.176361352f, -0.0412688665f, -0.00213783816f, 0.00450441893f, 0.155622363f,
+            -0.0585290641f, -0.00129007862f, 0.217175394f, 0.322949857f, -0.0731259659f, 0.00991626177f, 0.194989771f, 0.289951354f,
+            -0.0834440291f, -0.014557302f, 0.193226814f, 0.231678575f, -0.0823281184f, -0.00618414534f, 0.189687625f, 0.213370845f
+        },
+        {
+            0.0424921103f, -0.0146402363f, -0.133261696f, 0.108545065f, 0.0447430015f, -0.0089912666f, -0.123113573f, 0.0623599216f,
+            0.0389382876f, -0.016340334f, -0.145824671f, 0.0600548014f, 0.0353026018f, -0.0147598041f, -0.0782902911f, 0.0599739924f,
+            0.0476786122f, -0.017804211f, -0.0230807923f, 0.112140164f, 0.140486658f, -0.0310958978f, -0.0316545814f, -0.0109185968f,
+            0.0753630772f, -0.0369905494f, -0.166321173f, -0.0712954998f, 0.0385938212f, -0.048098594f, -0.0939684883f, -0.0614448376f,
+            0.00672018295f, -0.0307227597f, -0.00722223846f, -0.0429323688f, -0.0169202201f, -0.0241347272f, -0.0421751402f, -0.0517833866f,
+            -0.0318150446f, -0.00281990273f, -0.0301722195f, -0.0503438786f, -0.0505605936f, 0.0125916079f, -0.0364615954f, -0.0960586295f,
+            -0.0735406727f, 0.105244018f, -0.0686623082f, -0.0892992914f, -0.0708491579f, 0.0015311212f, -0.0200355146f, 0.0855761915f,
+            -0.0667469725f, -0.00410007546f, -0.0530073531f, 0.0778284296f, -0.0833443701f, 0.01178631f, -0.023826506f, 0.0655385926f,
+            -0.0344084352f, 0.0166127849f, -0.0398461185f, 0.0909892544f, -0.0260027424f, 0.023137657f, -0.0552058332f, 0.0965142623f,
+            -0.030322887f, 0.022331344f, -0.0739903972f, 0.0622830018f, -0.00728949998f, 0.0265025552f, -0.10306605f, 0.0479389615f,
+            -0.0136279073f, 0.0262649208f, -0.118504435f, 0.0329955705f, 0.0282979291f, -0.0347987004f, -0.0533939637f, 0.118258804f,
+            0.0838820189f, -0.0250549018f, -0.037628904f, 0.116222598f, 0.0772395134f, -0.0110273873f, 0.0375068374f, 0.0899499953f,
+            0.0326952301f, 0.0284049157f, 0.0882420391f, 0.214775965f, -0.0121043203f, 0.0316781215f, 0.0909783915f, 0.199058741f,
+            -0.0349462591f, 0.0338018164f, 0.0749601349f, 0.182970375f, -0.0466276668f, 2.01186504e-05f, 0.0717815384f, 0.131164387f,
+            -0.0565194823f, 0.00805809535f, 0.14182882f, 0.163097322f, -0.0634629652f, 0.0133192148f, 0.12677595f, 0.14760448f,
+            -0.0713585913f, -0.00485924678f, 0.124216214f, 0.117313646f, -0.0756511912f, 0.00103589625f, 0.124102876f, 0.114423349f
+        },
+        {
+            0.0698273033f, 0.127002552f, 0.097525239f, -0.0802260265f, 0.0771997049f, 0.140658885f, 0.0949826092f, -0.0496486463f,
+            0.0817800015f, 0.144986764f, 0.0828383267f, -0.0409565233f, 0.0769483373f, 0.141953513f, 0.0576230511f, 0.0259171128f,
+            0.0710826516f, 0.148409218f, 0.0677449331f, 0.0134009924f, 0.10569898f, 0.237906188f, 0.0517710522f, 0.0931619033f,
+            0.0918374583f, 0.208804697f, 0.252348781f, 0.1725045f, 0.0652154833f, 0.160499021f, 0.139957175f, 0.164188698f,
+            0.0437653288f, 0.0969420671f, 0.0074578817f, 0.112867095f, 0.0184862223f, 0.0365192033f, -0.0273180362f, 0.165151775f,
+            -0.00924187154f, -0.0282359384f, -0.0481100231f, 0.135409445f, -0.033048816f, -0.0898701772f, -0.035332866f, 0.129811555f,
+            -0.048457019f, -0.128455997f, -0.00174793927f, 0.15256463f, -0.0204137173f, -0.0908124596f, -0.0224589501f, 0.0634925291f,
+            -0.00583798904f, -0.0897687972f, 0.0255701821f, 0.0997144133f, -0.0116784703f, -0.110414356f, -0.0141299209f, 0.0771201178f,
+            -0.0630335063f, -0.123000257f, -0.0363830961f, 0.00177968189f, -0.0646003336f, -0.126101032f, 0.00966301374f, 0.050454542f,
+            -0.0565702096f, -0.128159121f, 0.0253287908f, 0.032537099f, -0.0559570119f, -0.124475092f, 0.0860631689f, 0.0580317006f,
+            -0.0481293052f, -0.118736066f, 0.0957848951f, 0.0627765134f, -0.0520362519f, -0.0481458604f, 0.0551086441f, 0.0344880149f,
+            -0.060293328f, -0.0478002355f, 0.0428394563f, 0.0317903273f, -0.0614222325f, -0.0330213569f, -0.0069822236f, 0.0513254143f,
+            -0.0342854038f, -0.0226341244f, 0.0124907447f, 0.0584018454f, -0.00718088588f, -0.0263410844f, 0.00345300045f, 0.0208304897f,
+            0.0146993585f, -0.0306987446f, -0.00563009689f, 0.0190475006f, 0.0264026318f, -0.0138311535f, -0.00554697309f, 0.0227297712f,
+            0.0316315517f, -0.0156197976f, -0.110637374f, -0.05851629f, 0.0364968106f, -0.016733354f, -0.100829057f, -0.0499684401f,
+            0.0437408872f, -0.00541894417f, -0.0975372046f, -0.0297495313f, 0.0486343019f, -0.00607552938f, -0.099623166f, -0.0220919661f
+        },
+        {
+            0.155851543f, -0.14428629f, -0.000814323663f, 0.0735792443f, 0.168395057f, -0.159566507f, 0.00962095149f, 0.0486641675f,
+            0.162460774f, -0.163747638f, 0.0150924735f, 0.0617879257f, 0.147084996f, -0.153139278f, 0.0550453588f, 0.0605651513f,
+            0.15057008f, -0.152439654f, 0.0367541797f, 0.0855188146f, 0.220954776f, -0.231137648f, 0.00825723074f, -0.0433779657f,
+            0.224022999f, -0.195015475f, -0.0477486886f, -0.0247840136f, 0.146710873f, -0.142674342f, -0.0677623525f, -0.0146183763f,
+            0.0757743716f, -0.0764888749f, -0.057348676f, 0.00684715342f, 0.00142979319f, -0.0142210284f, -0.0921636894f, 0.00208547967f,
+            -0.0685864016f, 0.0485772938f, -0.0888005197f, -0.0167261269f, -0.130639032f, 0.11027988f, -0.0957272649f, -0.0122212507f,
+            -0.181097299f, 0.143571079f, -0.0874289945f, -0.0766519606f, -0.0849461034f, 0.0920674652f, -0.018422354f, 0.114002518f,
+            -0.0793109462f, 0.0867634937f, 0.0140266344f, 0.115714356f, -0.0841949806f, 0.100819774f, 0.0158516094f, 0.0627861843f,
+            -0.0821003765f, 0.110967234f, 0.0219376832f, 0.0677682087f, -0.0970654562f, 0.11683055f, 0.0267377552f, 0.0423786007f,
+            -0.10790351f, 0.116192773f, 0.00856207125f, 0.0173691791f, -0.108978942f, 0.112986386f, -0.0126640582f, 0.000740255462f,
+            -0.121278852f, 0.105641544f, -0.0334606394f, -0.0254819002f, -0.10309054f, 0.0390471146f, -0.00113467115f, 0.00916385371f,
+            -0.0899460167f, 0.0380368978f, -0.000835439074f, 0.0160221551f, -0.0702964813f, 0.0280954521f, 0.0238936786f, 0.000493144034f,
+            -0.00690496713f, 0.0207384676f, 0.0201330278f, 0.084458217f, -0.0245247986f, 0.0260788202f, 0.0202300865f, 0.0770936012f,
+            -0.0353798829f, 0.0312533453f, 0.012148696f, 0.0806345716f, -0.0421381034f, 0.0218388624f, 0.0103890849f, 0.0614633746f,
+            -0.0474997051f, 0.0192791596f, 0.0461580083f, 0.087389797f, -0.0522894002f, 0.0207388401f, 0.0548376255f, 0.0848409981f,
+            -0.0561429523f, 0.00261395122f, 0.0540017299f, 0.0725769848f, -0.0567273013f, 0.00265657366f, 0.0598195046f, 0.067558594f
+        },
+        {
+            -0.00179988192f, -4.22601829e-07f, -0.0659534782f, -0.0289685968f, -0.000124342652f, 2.17987667e-06f, -0.0645749643f, -0.0433317423f,
+            -0.00273550628f, -5.42144744e-06f, -0.0428693518f, -0.0498997569f, -0.00304406439f, 9.55243304e-05f, -0.0115236659f, -0.06067992f,
+            -0.0157931037f, 0.000140704797f, -0.0447373018f, -0.0442085117f, -0.00216240948f, 0.00033101227f, -0.00949511304f, -0.107404597f,
+            -0.0167823713f, 0.000452919921f, -0.174174443f, -0.223640487f, -0.0165334474f, 2.83924946e-05f, -0.120452493f, -0.128720105f,
+            -0.0165687427f, 6.73827481e-06f, -0.0225891378f, -0.211540192f, -0.0167586543f, 1.24069775e-05f, -0.0273809917f, -0.158582702f,
+            -0.0174346715f, 0.00881218724f, -0.0104146935f, -0.135581374f, -0.0172250587f, 0.008642097f, -0.0108434893f, -0.161836535f,
+            -0.0137059996f, 6.2294481e-07f, -0.0102466792f, -0.163049072f, -0.0139623899f, 0.00973985344f, 0.0107210614f, -0.10175924f,
+            -0.016232904f, -0.00441551581f, -0.00173329085f, -0.0506332144f, -0.0167242102f, -0.00364465127f, -0.006096764f, -0.021965662f,
+            0.0482860543f, -0.00584936794f, 0.0875130296f, -0.00601761881f, 0.0479248837f, -0.00773575669f, 0.0620907061f, -0.0161125753f,
+            0.050156679f, -0.00704044895f, 0.0486023948f, 0.0115880789f, 0.0499853119f, -0.00579828257f, 0.021263849f, -0.00192369858f,
+            0.0487222858f, -0.00393668842f, 0.0244067479f, 0.00231567444f, 0.0471121892f, -0.00285944995f, -0.00727031939f, 0.0295290034f,
+            0.0455725193f, -0.00112154463f, -0.00765225105f, 0.0108141219f, 0.0348262265f, 0.000375772623f, -0.0317866877f, 0.0385016054f,
+            0.017435329f, 0.00289070769f, -0.036708761f, 0.117452659f, -0.0259597059f, 0.00428970996f, -0.0226757843f, 0.0968593583f,
+            -0.0441225246f, 0.00580673991f, -0.0127018206f, 0.147187606f, -0.0487630107f, 0.0100357272f, 0.0368398502f, 0.0944571421f,
+            -0.0507302359f, -0.000828219461f, -0.00840316713f, 0.124149583f, -0.0523082651f, -0.000524519477f, -0.00838958379f, 0.120513916f,
+            -0.0547057167f, 0.00613232097f, -0.00785084534f, 0.117412955f, -0.056957081f, 0.00809949264f, 0.0392739102f, 0.129282713f
+        },
+        {
+            -0.345392346f, 0.424575716f, 0.0488343388f, 0.119191028f, -0.372786045f, 0.44397074f, 0.0532821789f, 0.127653822f,
+            -0.36152494f, 0.419106901f, 0.0654760823f, 0.120009221f, -0.336474985f, 0.381727457f, 0.0197197478f, 0.155682102f,
+            -0.337110698f, 0.373768717f, 0.0507672131f, 0.168636143f, -0.451532245f, 0.589692116f, 0.102624841f, 0.228293344f,
+            -0.463405669f, 0.505376756f, 0.0918411911f, 0.0794061348f, -0.318514198f, 0.346555471f, 0.0333658569f, 0.0655886158f,
+            -0.178740814f, 0.178154185f, -0.00213976181f, 0.0579887033f, -0.0315040611f, 0.00544791715f, -0.0670739114f, 0.0642376468f,
+            0.112803079f, -0.156248748f, -0.0968117639f, 0.0555470251f, 0.241316244f, -0.309978604f, -0.109291166f, 0.0269322526f,
+            0.355564237f, -0.234703243f, -0.107400626f, 0.246787161f, 0.165228814f, -0.20474188f, -0.107969135f, 0.173148587f,
+            0.137328193f, -0.216614768f, -0.0794862881f, 0.188011184f, 0.182308659f, -0.244486243f, -0.0714157894f, 0.102231875f,
+            0.202122912f, -0.278201699f, -0.0243382379f, 0.0795250833f, 0.225168139f, -0.29536438f, 0.0166899618f, 0.0674309433f,
+            0.232214123f, -0.315746903f, 0.047023531f, 0.0603634007f, 0.234356448f, -0.314008117f, 0.0963377282f, 0.0375797264f,
+            0.234338686f, -0.30114609f, 0.136892736f, 0.0266605262f, 0.204761863f, -0.236500293f, 0.0730876699f, -0.0342823379f,
+            0.168405935f, -0.212756753f, 0.0656872466f, -0.0863817781f, 0.115411237f, -0.14737761f, -0.0179623086f, 0.0137151871f,
+            0.0324656777f, -0.0363553762f, 0.0113963215f, 0.0813020691f, 0.0616967455f, -0.0455504283f, -0.00543648656f, 0.0614916533f,
+            0.078162834f, -0.0556089543f, -0.014546318f, 0.0377643667f, 0.0854885206f, -0.0466036499f, -0.0143986503f, 0.0536046065f,
+            0.0892908946f, -0.0369691364f, -0.0444354974f, 0.026749054f, 0.0896524414f, -0.0338663496f, -0.0525471233f, 0.0188262593f,
+            0.0776637644f, -0.00771155022f, -0.0538645498f, 0.0102449665f, 0.0681102946f, -0.00486616977f, -0.0638016313f, 0.00402257824f
+        },
+        {
+            -0.128220186f, -0.143475458f, 0.0174550135f, 0.0228082202f, -0.131171718f, -0.151005641f, 0.0183319822f, 0.0223129131f,
+            -0.125321656f, -0.147002876f, 0.0388406217f, 0.0246491786f, -0.110496715f, -0.133606434f, 0.00973467529f, 0.0390986241f,
+            -0.10949377f, -0.126396909f, 0.0174138546f, 0.0318554193f, -0.158807591f, -0.204787299f, 0.00429249462f, 0.05861938f,
+            -0.175198019f, -0.175029561f, -0.00416850392f, 0.0324028097f, -0.122994266f, -0.127123773f, -0.0216638464f, 0.0333489813f,
+            -0.0709539056f, -0.0677017719f, -0.0178346206f, 0.0335855223f, -0.0188381933f, -0.00868869014f, -0.0271816794f, 0.0336438604f,
+            0.0341510288f, 0.0497950092f, -0.0331453122f, 0.0335774273f, 0.0801856965f, 0.106142931f, -0.0486359894f, 0.0432034135f,
+            0.124588773f, 0.109670117f, -0.0470917486f, -0.00804918539f, 0.0344871581f, 0.0720754862f, -0.0311011747f, 0.0597782657f,
+            0.0193426218f, 0.0686774477f, -0.0225169435f, 0.058221519f, 0.0408859551f, 0.0816763565f, -0.0172534604f, 0.0368773863f,
+            0.0621536821f, 0.0982474238f, -0.00784082338f, 0.0221630875f, 0.0817742348f, 0.103064731f, -0.00387483952f, 0.0117719257f,
+            0.0893049166f, 0.109557018f, 0.00761127844f, 0.0173521172f, 0.0876761153f, 0.107829921f, 0.0174351372f, 0.00102738524f,
+            0.0903630927f, 0.102247603f, 0.00376320141f, -0.00611748872f, 0.07821282f, 0.0500642247f, 0.020089535f, 0.0120294718f,
+            0.0640416592f, 0.0454561189f, 0.0241869893f, 0.0034832079f, 0.0564566925f, 0.0311472379f, 0.00149581279f, -0.00589839555f,
+            0.0139955021f, 0.0133202821f, 0.0213686749f, 0.0431376174f, 0.025807647f, 0.0168349668f, 0.0168220047f, 0.0318269245f,
+            0.0368731245f, 0.0208712202f, 0.0134893823f, 0.0253706556f, 0.0443989038f, 0.0169843342f, 0.0161067359f, 0.0155312745f,
+            0.0489167981f, 0.0103394082f, 0.0173352752f, 0.0135991396f, 0.0520150624f, 0.0110112475f, 0.0155107733f, 0.0135499341f,
+            0.0412789509f, 0.00177429896f, 0.010850356f, -0.00883761887f, 0.0321068652f, 0.00175985601f, 0.00190005638f, -0.0167754013f
+        },
+        {
+            -0.0995439216f, -0.12978071f, 0.000503199757f, -0.0500377193f, -0.104178943f, -0.135272726f, 0.000588544528f, -0.0339568965f,
+            -0.10120409f, -0.125518084f, 0.00908999145f, -0.0271224342f, -0.0924726129f, -0.117231138f, -0.0251570512f, -0.0297013801f,
+            -0.0789716914f, -0.117555924f, -0.0309882592f, -0.00877931528f, -0.0910775289f, -0.189439848f, -0.0341954529f, 0.0366347432f,
+            -0.0683308616f, -0.168302372f, -0.0373825356f, 0.0389066674f, -0.0315854214f, -0.11759007f, -0.0107138241f, 0.0461807027f,
+            -0.000569464697f, -0.0679152384f, 0.00367219793f, 0.0483443961f, 0.0306738745f, -0.0115004769f, 0.0451515503f, 0.0365717262f,
+            0.0592199974f, 0.0409398265f, 0.060380064f, 0.0461606011f, 0.0852678493f, 0.0929641798f, 0.0558645986f, 0.0737381876f,
+            0.109813266f, 0.056085486f, 0.0474742129f, -0.0113145811f, 0.0281805247f, 0.0812191293f, 0.0235877093f, -0.0725225285f,
+            0.0285313465f, 0.0938669071f, 0.00674597267f, -0.0933812633f, 0.0332583785f, 0.10099531f, 0.00449347962f, -0.0403970964f,
+            0.0359395556f, 0.107982717f, 0.00943585299f, -0.0110372929f, 0.0401056558f, 0.0983712822f, 0.00329836621f, -0.0108998287f,
+            0.0344561078f, 0.104982913f, 0.00063280412f, 0.0232413653f, 0.0347643159f, 0.0954980031f, 0.00107482669f, 0.0274067204f,
+            0.0305182114f, 0.0870307311f, -0.00868017785f, 0.0155948447f, 0.0268050116f, 0.0782340243f, -0.000533396029f, 0.040937297f,
+            0.00798834767f, 0.0697386861f, -0.00555141224f, 0.0253278539f, 0.0061130058f, 0.0457178801f, -0.00615773629f, -0.00523431692f,
+            -2.95110249e-06f, 0.00495197531f, -0.0064859488f, -0.0367922634f, 1.4482177e-05f, 0.00445628725f, -0.00220747106f, -0.029575279f,
+            2.9400986e-05f, 0.00503276708f, -0.00139537675f, -0.0252198745f, 6.14842647e-05f, 0.00559182558f, 8.85404297e-05f, -0.0230609849f,
+            9.89975379e-05f, 0.00118510507f, 5.0048664e-05f, -0.015612266f, 0.000134324058f, 0.000442705641f, 7.15415881e-05f, -0.0132164285f,
+            0.000196505731f, 0.000469969382f, 6.55721669e-05f, -0.0044952319f, 8.6760534e-05f, 8.78588035e-05f, 0.000212594779f, -0.000799098983f
+        },
+        {
+            0.23194088f, 0.214224085f, -0.117508955f, 0.0516759083f, 0.241671517f, 0.227355719f, -0.12410605f, 0.0545446724f,
+            0.234535739f, 0.221977651f, -0.128877506f, 0.0451694727f, 0.220008075f, 0.201109186f, -0.0577960536f, 0.00116216158f,
+            0.207381263f, 0.19144699f, -0.0525513291f, 0.0132207852f, 0.270418227f, 0.285625041f, -0.0379511751f, 0.013714822f,
+            0.276532501f, 0.234110594f, -0.14093326f, 0.0494884104f, 0.184755757f, 0.154944509f, -0.0355856754f, 0.052159708f,
+            0.0901438594f, 0.065392293f, 0.0511325039f, 0.0915438011f, 0.000576465623f, -0.0223667976f, 0.0856575817f, 0.099061124f,
+            -0.086014919f, -0.104286842f, 0.122894928f, 0.0836613327f, -0.162258625f, -0.181418747f, 0.130888134f, 0.0343962684f,
+            -0.235224143f, -0.164748043f, 0.104020402f, 0.130812585f, -0.0947941616f, -0.119734615f, 0.0488647446f, 0.0137260221f,
+            -0.093453005f, -0.122346587f, -0.0149830431f, -0.0389130786f, -0.124917135f, -0.140522212f, 0.0129586998f, 0.0170529317f,
+            -0.154924363f, -0.154533356f, -0.00235412689f, 0.0257787704f, -0.171758965f, -0.158827379f, -0.0450348407f, 0.0215565786f,
+            -0.176099345f, -0.156668231f, -0.051534906f, -0.0173422843f, -0.159000367f, -0.150288358f, -0.127786413f, -0.0206932463f,
+            -0.15400587f, -0.124749534f, -0.138464928f, -0.0544394888f, -0.137416914f, -0.0786671862f, -0.0968156159f, -0.0230219923f,
+            -0.0962441191f, -0.0664256439f, -0.0936079472f, -0.042524308f, -0.0672364607f, -0.0444341525f, 0.0190932117f, -0.127839983f,
+            -0.00729812915f, -0.00462026009f, -0.0235263463f, -0.243236095f, -0.0138715822f, -0.00757004414f, -0.00813439023f, -0.225595653f,
+            -0.0188588556f, -0.0106127011f, -0.00226726616f, -0.208192036f, -0.0219191574f, -0.00981021766f, 0.00387716922f, -0.206237584f,
+            -0.0247965809f, -0.007698189f, 0.080928877f, -0.119735934f, -0.0257898532f, -0.00843833201f, 0.0812455267f, -0.117609315f,
+            -0.0121363364f, 2.2016477e-06f, 0.0839421526f, -0.0980766863f, -0.000447386206f, 4.23283655e-06f, 0.0841771588f, -0.0927856788f
+        },
+        {
+            0.337225586f, -0.208837181f, 0.0249005519f, -0.0135876723f, 0.358363122f, -0.221052974f, 0.0248172786f, 0.00681836298f,
+            0.347300082f, -0.212038979f, 0.0203927439f, 0.0271190926f, 0.317218453f, -0.1969046f, 0.0554310121f, 0.0459323674f,
+            0.314563185f, -0.195251003f, 0.0232960191f, 0.0608652234f, 0.436615378f, -0.300329953f, -0.0287556089f, 0.0396285094f,
+            0.454488009f, -0.253340423f, 0.0757795647f, 0.159077227f, 0.321515352f, -0.172097877f, 0.0447298884f, 0.179543436f,
+            0.195755094f, -0.0861195475f, -0.00186212023f, 0.167344525f, 0.0584530793f, 0.00214394508f, 0.00518787233f, 0.165405825f,
+            -0.0804830417f, 0.0827528238f, 0.0239946526f, 0.17890501f, -0.209790543f, 0.160656467f, 0.0289267972f, 0.184508607f,
+            -0.321622312f, 0.132825539f, 0.0463463552f, 0.0940946713f, -0.14331159f, 0.131466195f, 0.0616059564f, 0.0893295854f,
+            -0.113202162f, 0.139302015f, 0.0797637999f, 0.0972904339f, -0.159639373f, 0.148435608f, 0.0525926203f, 0.0956231952f,
+            -0.190513283f, 0.15834932f, 0.0309428554f, 0.0689668655f, -0.214725852f, 0.154713482f, 0.0389151834f, 0.0615601912f,
+            -0.224294379f, 0.159166262f, 0.0307172704f, 0.0525985435f, -0.232062191f, 0.149300352f, 0.0188020654f, 0.0510516278f,
+            -0.237613499f, 0.136888668f, 0.0110494588f, 0.0432079248f, -0.214283198f, 0.104271993f, -0.0112530123f, 0.0418324955f,
+            -0.181763142f, 0.0907886401f, -0.0162277687f, 0.0745024681f, -0.119976364f, 0.0643285438f, -0.0216965321f, 0.0268119536f,
+            -0.0456583798f, 0.0144276256f, -0.0535750203f, -0.00631188042f, -0.0575583428f, 0.0175585151f, -0.0552453063f, -0.00346674747f,
+            -0.0602029078f, 0.0215198845f, -0.0392115638f, 0.00259273173f, -0.0582136475f, 0.0223578177f, -0.0429055542f, 0.00972759072f,
+            -0.0570045412f, 0.0135553023f, -0.0774838924f, -0.0170426294f, -0.054833971f, 0.0127992872f, -0.0700049549f, -0.00845325179f,
+            -0.0396729261f, 0.00205918844f, -0.066907756f, 0.00274526584f, -0.026663335f, 0.000599017541f, -0.0688276216f, 0.0105905775f
+        },
+        {
+            0.0488034412f, -0.0541076325f, -0.237323418f, -0.11581111f, 0.0302900597f, -0.0546355434f, -0.220717326f, -0.0777678862f,
+            0.0294052623f, -0.0434892997f, -0.15241763f, -0.0682082698f, 0.0306197554f, -0.0299267657f, -0.0164815728f, -0.051852759f,
+            0.00482143229f, -0.00585130276f, 0.180122942f, -0.0912868604f, -0.0495324023f, 0.0526932292f, 0.407431602f, 0.0457869284f,
+            -0.144311532f, 0.0835084692f, 0.73638314f, 0.0435879901f, -0.130001917f, 0.100042462f, 0.509291053f, 0.0613628626f,
+            -0.10875795f, 0.095751062f, 0.282542527f, 0.0176081546f, -0.0776649192f, 0.0949726999f, 0.0766774341f, 0.0421387814f,
+            -0.0562067367f, 0.0799181014f, -0.185111776f, 0.0352788046f, -0.0361320823f, 0.0692037493f, -0.424649298f, 0.0556635596f,
+            -0.000925984641f, 0.0291193016f, -0.51018554f, -0.0873155966f, 0.0205484089f, 0.00711926306f, -0.656916678f, 0.00256647728f,
+            0.0468722358f, -0.00658365898f, -0.620658696f, -0.0471068583f, 0.0622510687f, -0.0290359426f, -0.56470418f, -0.0137397274f,
+            0.0390607417f, -0.0446652211f, -0.41297105f, -0.0148963099f, 0.0638508424f, -0.0597359985f, -0.219826058f, 0.02841557f,
+            0.0808050931f, -0.0675397292f, -0.0872228444f, 0.141604945f, 0.0925521106f, -0.0643251762f, 0.136355639f, 0.124169514f,
+            0.0893058851f, -0.0708278567f, 0.168035969f, 0.0806117803f, 0.05331387f, -0.0109036444f, 0.260522366f, 0.0274544638f,
+            0.0058094142f, -0.0185565501f, 0.215807289f, 0.0186051149f, -0.0333874226f, -0.0160507653f, 0.28315106f, 0.03008244f,
+            -0.027362898f, -0.0235069338f, 0.333637595f, 0.0551243275f, 0.0406556688f, -0.0241729245f, 0.311028779f, 0.068008624f,
+            0.0559334718f, -0.026004022f, 0.282367826f, -0.0215259772f, 0.0635622293f, 0.0152601767f, 0.239118055f, 0.0563153997f,
+            0.0729241297f, 0.00502952887f, -0.0498752892f, -0.255166441f, 0.0730733871f, -0.000268319272f, -0.0271753445f, -0.23139593f,
+            0.0733650178f, -0.00258037588f, -0.0229757261f, -0.218397036f, 0.0723892525f, -0.00358154718f, -0.0648374632f, -0.206064373f
+        },
+        {
+            0.0384180881f, 0.0230090562f, -0.00469743647f, -0.0267388318f, 0.0371136516f, 0.0238415133f, -0.00892240461f, -0.01901366f,
+            0.0362527966f, 0.0247662161f, -0.0104966145f, -0.0121736871f, 0.0320713222f, 0.0231378768f, -0.00688473089f, -0.0142893475f,
+            0.0323495083f, 0.0208632927f, -0.0081776483f, -0.0230119843f, 0.0346151628f, 0.0348904394f, -0.0124407345f, -0.000521236041f,
+            0.0583508462f, 0.0278626531f, -0.0186299831f, 0.0305245742f, 0.0418329351f, 0.0217137765f, 0.00023538692f, 0.0302443933f,
+            0.0267244447f, 0.0111746658f, 0.00574624864f, 0.0302885696f, 0.0107319877f, 0.00107290875f, 0.0169729199f, 0.0301137771f,
+            -0.00577122997f, -0.00888051465f, 0.0246090516f, 0.030303441f, -0.0195776671f, -0.017604854f, 0.0267898533f, 0.0352125578f,
+            -0.0321294367f, -0.0313138105f, 0.0315456763f, 0.0453354567f, -0.00984227378f, -0.00930111948f, 0.0237453617f, -0.00329230702f,
+            -0.00687852036f, -0.0132603683f, 0.0135189677f, -0.0171494856f, -0.00591982901f, -0.0163639747f, 0.00901273917f, -0.00732274912f,
+            -0.0132372603f, -0.0186851341f, 0.00566512393f, 0.00333029893f, -0.0188156161f, -0.0200087987f, -0.00150441227f, 0.00334467529f,
+            -0.0228757821f, -0.0177389402f, -0.00540904934f, 0.00531718694f, -0.0272939596f, -0.0192508399f, -0.0109942388f, 0.00711727329f,
+            -0.0295432676f, -0.0169862173f, -0.0120808547f, 0.00399782276f, -0.0315296315f, 0.000601858832f, -0.00754497759f, 0.00410361588f,
+            -0.0299829915f, -1.78616901e-05f, -0.0132345278f, 0.00336277159f, -0.0292437412f, 0.00067241129f, 0.00151174888f, -0.0124896728f,
+            -0.00458645215f, 1.02090653e-05f, -0.00922450237f, -0.0563061312f, -0.00828438811f, -9.24076303e-05f, -0.00728802523f, -0.0510213673f,
+            -0.0101458617f, -0.000223845156f, -0.0105426311f, -0.0480053499f, -0.0122628398f, -0.000120035911f, -0.00902446825f, -0.043594189f,
+            -0.0132050645f, -0.000164907542f, -0.00522620603f, -0.0205065161f, -0.0140279895f, -0.000198731548f, -0.00531101972f, -0.0205063187f,
+            -0.00929874275f, 0.000436330127f, -0.00453075813f, -0.0111623323f, -0.00221658312f, -2.23598909e-05f, -6.78715878e-05f, -0.00432195282f
+        },
+        {
+            -0.37450099f, -0.425346434f, 0.0778894424f, 0.0270727817f, -0.401479632f, -0.451521009f, 0.0829506293f, 0.0584561899f,
+            -0.392018974f, -0.432435066f, 0.1070081f, 0.0554517433f, -0.364067137f, -0.396160245f, 0.0426486582f, 0.0996365622f,
+            -0.362078846f, -0.3855277f, 0.0388107225f, 0.134323314f, -0.524457753f, -0.607448578f, 0.0258861911f, 0.243436649f,
+            -0.543648839f, -0.515786469f, 0.127441466f, 0.180045247f, -0.37678048f, -0.350667477f, 0.0510706455f, 0.173708484f,
+            -0.21282427f, -0.176629901f, 0.00698886812f, 0.174354628f, -0.0471662842f, 0.000403822807f, 0.00718192291f, 0.173489809f,
+            0.115315482f, 0.164569736f, -0.031945996f, 0.176436916f, 0.263397068f, 0.318983257f, -0.0726750791f, 0.203827202f,
+            0.396547198f, 0.265585423f, -0.0542207547f, 0.0487594903f, 0.193496123f, 0.211811259f, -0.0348219797f, 0.127906203f,
+            0.172530174f, 0.219199419f, -0.00913953688f, 0.1445425f, 0.225048572f, 0.253473461f, -0.016254995f, 0.101456925f,
+            0.230123043f, 0.295945913f, -0.00393231399f, 0.0589899942f, 0.259504735f, 0.315712035f, 0.021918634f, 0.0589693114f,
+            0.274228752f, 0.330088079f, 0.0574565642f, 0.07737609f, 0.277018279f, 0.322003961f, 0.112808049f, 0.0463775359f,
+            0.283396602f, 0.297400147f, 0.088393867f, 0.0421221331f, 0.244657382f, 0.223062709f, 0.0642689466f, 0.0316801816f,
+            0.181964129f, 0.196144849f, 0.0613206774f, 0.00483327173f, 0.125284225f, 0.134759471f, -0.0415496379f, 0.0310397577f,
+            0.0192406606f, 0.0394918583f, -0.00785001367f, 0.071348384f, 0.0566985831f, 0.0479492433f, -0.0196294915f, 0.0627638623f,
+            0.0758379623f, 0.0580235943f, -0.0235268176f, 0.046641238f, 0.086015977f, 0.0522480085f, -0.0343647227f, 0.0357934386f,
+            0.0959745869f, 0.0399606787f, -0.0728030279f, -0.053390298f, 0.103075959f, 0.0361156873f, -0.0706654936f, -0.0443540588f,
+            0.103226528f, 0.00890929345f, -0.0785591304f, -0.0401878618f, 0.0959354043f, 0.00494848005f, -0.0823280215f, -0.0296034347f
+        },
+        {
+            -0.243622914f, -0.284959942f, -0.187908649f, 0.0524617396f, -0.264282763f, -0.294850886f, -0.191136897f, 0.042204611f,
+            -0.271844178f, -0.278460413f, -0.16203776f, 0.0295026675f, -0.258734077f, -0.263536423f, -0.107648283f, 0.00132002821f,
+            -0.264561683f, -0.268947482f, -0.0902313814f, 0.0140443677f, -0.444136351f, -0.410105973f, -0.0487706177f, 0.143884778f,
+            -0.36120069f, -0.357075512f, -0.192783087f, 0.104585953f, -0.24846445f, -0.240975976f, -0.00995242875f, 0.110331394f,
+            -0.140732303f, -0.128124923f, 0.163138732f, 0.110413991f, -0.0297055338f, -0.00823236722f, 0.263984859f, 0.112929136f,
+            0.0770208687f, 0.102345839f, 0.284961998f, 0.114521697f, 0.178787395f, 0.209143132f, 0.242616221f, 0.125327617f,
+            0.252658397f, 0.159337997f, 0.142159045f, -0.014069696f, 0.142220274f, 0.177735031f, 0.0479716957f, -0.0770878494f,
+            0.163635075f, 0.210945353f, -0.0873036981f, -0.180260658f, 0.170663744f, 0.227706835f, -0.0107454192f, -0.0661676228f,
+            0.159387454f, 0.241295695f, 0.000286829192f, 0.0298085008f, 0.16953063f, 0.227734759f, -0.072892189f, 0.0408577137f,
+            0.172749549f, 0.23672919f, -0.069800742f, -0.00329303253f, 0.165637881f, 0.216666326f, -0.143074736f, -0.0166137796f,
+            0.168585241f, 0.193545893f, -0.160135075f, -0.0830763653f, 0.130930647f, 0.166653827f, -0.0823756829f, -0.0299559291f,
+            0.123833619f, 0.145209596f, -0.0547700003f, -0.0434363522f, 0.114229023f, 0.0849171355f, 0.00352264452f, -0.143795729f,
+            0.0116304774f, 0.00283961091f, -0.0476114377f, -0.278012425f, 0.0146296164f, -0.00165526604f, -0.0251141619f, -0.284167558f,
+            0.0171289798f, -0.000509523263f, -0.0410955846f, -0.261808425f, 0.0193880759f, 0.000831845391f, -0.014575405f, -0.23759523f,
+            0.0212348457f, 0.00491110561f, 0.0959104225f, -0.118288331f, 0.0227469318f, 0.00433306349f, 0.0962538272f, -0.114524059f,
+            0.0241891164f, 0.000287394942f, 0.0939716697f, -0.108844653f, 0.0248271301f, 3.21123298e-05f, 0.0944081247f, -0.105498195f
+        },
+        {
+            0.00672030356f, 0.010908463f, -0.171588123f, 0.207249403f, 0.00421345327f, 0.0223122705f, -0.16098018f, 0.143014774f,
+            -0.00357309403f, 0.0141135622f, -0.183937803f, 0.136367559f, -0.00482253544f, 0.0155757144f, -0.109013841f, 0.114523053f,
+            0.0072399443f, 0.0151288947f, -0.0289981961f, 0.113924779f, 0.0930569544f, 0.0166362822f, -0.0499391481f, -0.0192398131f,
+            0.0334340967f, 0.000110276625f, -0.187308908f, -0.0850716308f, 0.013061557f, -0.0218480006f, -0.0867300779f, -0.087253049f,
+            -0.00389829208f, -0.0144810379f, 0.0156411249f, -0.0861559436f, -0.0132750105f, -0.0186838191f, -0.0203042105f, -0.079440698f,
+            -0.015366585f, -0.00794974901f, -0.00216945331f, -0.0796737298f, -0.0241170749f, -0.00244598137f, -0.0104690893f, -0.160761654f,
+            -0.0393405445f, 0.104500227f, -0.0545673035f, -0.121432506f, -0.05469542f, -0.0166943613f, -0.011673646f, 0.0794957578f,
+            -0.0530699678f, -0.0204844326f, -0.0642366484f, 0.0532302149f, -0.0694454312f, -0.00418637507f, -0.0206017066f, 0.0461729243f,
+            -0.0127581097f, 0.000114199029f, -0.0507477932f, 0.0189615563f, -0.00278516044f, 0.0084636528f, -0.064524062f, 0.0222183634f,
+            -0.00742016593f, 0.00816544797f, -0.0818889588f, -0.0196883604f, 0.0147852236f, 0.0161128305f, -0.117314942f, -0.0358431563f,
+            0.00488328375f, 0.00512837013f, -0.133450076f, -0.0618251041f, 0.0435715802f, -0.0704048276f, -0.0624059364f, 0.016755987f,
+            0.0966257155f, -0.0579438135f, -0.0458562672f, 0.0533612035f, 0.086655423f, -0.0447118282f, 0.0300553255f, 0.0215236265f,
+            0.0436329432f, 0.0307375677f, 0.0907028988f, 0.155576542f, -0.00891822483f, 0.0323758833f, 0.0930483043f, 0.155536756f,
+            -0.0335550681f, 0.0326993503f, 0.0765269697f, 0.139120281f, -0.0457648002f, -0.00655645085f, 0.0701448619f, 0.0568625107f,
+            -0.0568933301f, 0.00182859681f, 0.163774788f, 0.142818689f, -0.0621495508f, 0.00948647503f, 0.145403981f, 0.122299716f,
+            -0.069694899f, -0.00986993778f, 0.139863655f, 0.0997231379f, -0.0761213452f, -0.00268831523f, 0.141231522f, 0.10832002f
+        },
+        {
+            -0.000798423775f, 0.00229045586f, -0.0311817937f, 0.0540821142f, -2.04716598e-05f, 0.0013900206f, -0.0262004565f, 0.0528895035f,
+            -0.00108822947f, 0.000488017075f, -0.00841659401f, 0.012789919f, -0.00106940814f, 5.74800761e-05f, 0.019246906f, -0.0570372678f,
+            -1.58877938e-05f, 6.09853168e-06f, 0.00571716391f, -0.0129032945f, -0.000869320065f, 3.13467918e-09f, 0.0327200443f, -0.0920447856f,
+            -0.000688464672f, 5.51615476e-10f, -0.133271754f, -0.214238599f, -0.000386544765f, -1.6702478e-06f, -0.105263762f, -0.169647291f,
+            -0.000221752867f, -4.57576098e-05f, -0.0388447717f, -0.162602797f, 9.35972275e-05f, -0.000476074638f, -0.0618181825f, -0.186726332f,
+            0.00020344324f, -0.00093415234f, -0.0381336585f, -0.202080682f, 0.000254350016f, -0.00178275886f, -0.000983401318f, -0.203406349f,
+            0.00113375555f, -6.74903276e-05f, -0.000848485972f, -0.150919199f, 0.00121770042f, 0.00228049397f, -0.00224494096f, -0.0133518958f,
+            -0.001438434f, 0.00255266391f, -0.00496348878f, 0.0366189219f, -0.00204306841f, 0.00254113181f, 0.00010535503f, -0.0158395879f,
+            -0.00194898655f, 0.00236244453f, 0.0739764795f, 0.0096223997f, -0.00118181447f, 0.00197120081f, 0.0690161213f, -0.0437003225f,
+            -0.000586351322f, 0.00131742784f, 0.047757104f, -0.0435868055f, -0.000549655408f, 0.00064659596f, 0.0172549821f, -0.0277279206f,
+            -0.000667708926f, -3.31986666e-05f, 0.0121262548f, -0.0741602108f, -0.000406321342f, -0.000755179382f, 0.00134076213f, -0.0630966499f,
+            -0.000155797621f, -0.0012874793f, 0.000547235599f, -0.0882011056f, -0.000865050242f, -0.00162234553f, -0.0258300677f, -0.00772303622f,
+            -2.68114418e-05f, -0.00224265689f, -0.0350509025f, 0.116068974f, 0.000546184659f, -0.00270983903f, -0.0320429541f, 0.0891067758f,
+            0.0017773665f, -0.0029948873f, -0.0358916894f, 0.0810110942f, 0.00234820275f, -0.000357528363f, -0.015554999f, 0.0354038514f,
+            0.00250163605f, -0.000280453358f, -0.00151062943f, 0.0231671501f, 0.00318085146f, -0.000305822759f, -0.00139982114f, 0.0227854084f,
+            0.00325392466f, -9.10576491e-05f, -0.00103879848f, 0.0264522918f, 0.00254223379f, -2.15133714e-05f, -0.000525049982f, 0.0436247252f
+        },
+        {
+            0.286644667f, 0.27543062f, 0.00577394571f, 0.0534453094f, 0.305846661f, 0.293008149f, 0.0060674944f, 0.0689132363f,
+            0.298524201f, 0.283407509f, -0.021509001f, 0.0898929834f, 0.275212824f, 0.264222145f, 0.0503381044f, 0.105173722f,
+            0.276080757f, 0.261756629f, 0.0200457387f, 0.118448421f, 0.368058503f, 0.405432463f, 0.032050278f, 0.0291990358f,
+            0.392067462f, 0.349143088f, 0.039100457f, 0.0849305019f, 0.27588281f, 0.24085632f, 0.0251204316f, 0.0915549248f,
+            0.161455423f, 0.124258071f, -0.00403259182f, 0.0877082571f, 0.0421385504f, 0.00639445428f, -0.0411227904f, 0.0878438279f,
+            -0.0791500211f, -0.104022481f, -0.0355444178f, 0.082603991f, -0.19158189f, -0.207650036f, -0.0115987733f, 0.0601348318f,
+            -0.288636684f, -0.1841463f, -0.0022813899f, 0.178043962f, -0.137555242f, -0.167979956f, 0.0101656057f, 0.131312937f,
+            -0.116544373f, -0.174059063f, 0.0298670605f, 0.130438343f, -0.146943569f, -0.19159767f, 0.0184012596f, 0.106056929f,
+            -0.160317898f, -0.209516004f, 0.0184930954f, 0.0821768269f, -0.183862045f, -0.21309261f, 0.0306826103f, 0.0694700405f,
+            -0.194573224f, -0.221942142f, 0.0146821644f, 0.0356692933f, -0.198935464f, -0.21420449f, 0.00771785108f, 0.038195882f,
+            -0.207039952f, -0.195901617f, 0.0275015887f, 0.0279597342f, -0.181411788f, -0.138463214f, -0.00217713811f, 0.00333258952f,
+            -0.148884609f, -0.124885961f, -0.00874259602f, 0.0114381751f, -0.104244709f, -0.0879712999f, -0.0029743223f, 0.00283131166f,
+            -0.0293377992f, -0.0253233872f, -0.0471438132f, -0.00181765156f, -0.0467090346f, -0.0299810432f, -0.0489086211f, 0.00337369181f,
+            -0.0575196631f, -0.0366220362f, -0.0426651202f, 0.00296571199f, -0.0634361804f, -0.031120304f, -0.0459895954f, 0.018777255f,
+            -0.0681093112f, -0.0235974044f, -0.0582335293f, 0.0224819817f, -0.0706168637f, -0.0227406677f, -0.0462507159f, 0.0201860536f,
+            -0.0632003322f, -0.00357783004f, -0.0340033062f, 0.043005053f, -0.0647630766f, -0.00294220145f, -0.0314580649f, 0.0528590083f
+        },
+        {
+            -0.141519487f, 0.257501602f, -0.008771942f, 0.00549017638f, -0.153481036f, 0.275974065f, -0.0147049986f, 0.0386055931f,
+            -0.149172664f, 0.269502223f, -0.0169989094f, 0.0406615846f, -0.136992529f, 0.243037939f, -0.0588459745f, 0.0474021919f,
+            -0.144581392f, 0.232543543f, -0.025893366f, 0.0402179547f, -0.203718528f, 0.366179258f, 0.0193115342f, 0.180528015f,
+            -0.197517157f, 0.308787763f, -0.00289899693f, 0.12224178f, -0.132385045f, 0.220005289f, 0.014084137f, 0.109953672f,
+            -0.0697615147f, 0.112703979f, 0.01504145f, 0.110183857f, -0.00409192964f, 0.0072700996f, 0.0475446917f, 0.109490097f,
+            0.0583742894f, -0.0961684063f, 0.0497613959f, 0.11191301f, 0.112762645f, -0.194640338f, 0.0620670393f, 0.106987953f,
+            0.157781124f, -0.20278728f, 0.0509347655f, 0.188969582f, 0.0699819699f, -0.128592461f, -0.0107869301f, 0.0193579085f,
+            0.0640255436f, -0.123497546f, -0.0386000723f, -0.0100244507f, 0.0812164247f, -0.143843919f, -0.0327282436f, 0.00651199324f,
+            0.0831533223f, -0.164170325f, -0.0263712015f, 0.0205174945f, 0.0895426795f, -0.181706682f, -0.0343983509f, 0.0201124996f,
+            0.0935080051f, -0.18836695f, -0.0304814279f, 0.0334023945f, 0.0892386809f, -0.188074172f, -0.0185199268f, 0.0284620132f,
+            0.0956892371f, -0.176354304f, 0.00955814589f, 0.0349486284f, 0.0773914233f, -0.0984771773f, 0.00221764925f, -0.00855234638f,
+            0.0691796243f, -0.0921778753f, 0.00254893093f, -0.034224093f, 0.0548135713f, -0.0713074431f, 0.0167366248f, -0.0206140317f,
+            0.00919091515f, -0.0292078014f, 0.0267897528f, -0.092503123f, 0.0211564321f, -0.0368543863f, 0.0244763903f, -0.0888701379f,
+            0.0297203921f, -0.0442052335f, 0.0228731036f, -0.0888276622f, 0.0346453562f, -0.03336199f, 0.0244737174f, -0.0694818348f,
+            0.0378302634f, -0.0276010986f, 0.0250677112f, -0.0676150844f, 0.0401111022f, -0.0275610238f, 0.0138144651f, -0.0683771372f,
+            0.0399983674f, -0.00370510039f, 0.0142146312f, -0.0547201335f, 0.0396034569f, -0.00423611328f, 0.0101003032f, -0.0554888882f
+        },
+        {
+            0.245633379f, 0.055794768f, 0.00607779203f, -0.000895595527f, 0.257889539f, 0.0613559f, 0.00263581728f, 0.0162431169f,
+            0.248914644f, 0.0632902756f, -0.016091384f, 0.0285052117f, 0.226201072f, 0.0621499531f, 0.0383627526f, 0.0349952318f,
+            0.226811349f, 0.059828341f, 0.0043031578f, 0.0546193458f, 0.312634259f, 0.0904744044f, -0.00844702218f, 0.0175467003f,
+            0.333919942f, 0.0758226141f, 0.0386834741f, 0.108384743f, 0.234167606f, 0.0558697172f, 0.0332780629f, 0.110100649f,
+            0.139292195f, 0.0303301644f, 0.010224957f, 0.106320873f, 0.037518736f, 0.00514805689f, 0.00290889596f, 0.10949403f,
+            -0.0656323805f, -0.021482937f, 0.0141034694f, 0.104679041f, -0.159383893f, -0.0427902713f, 0.0271648001f, 0.113550819f,
+            -0.239879072f, -0.0557087623f, 0.0372233279f, 0.104123503f, -0.097522907f, -0.0366238877f, 0.0405854471f, 0.0734718144f,
+            -0.0702852681f, -0.0387808681f, 0.0472380482f, 0.0729538277f, -0.107216083f, -0.0465863943f, 0.0329666287f, 0.0654599667f,
+            -0.134632662f, -0.0508665852f, 0.023265643f, 0.0493303426f, -0.1554223f, -0.0502453782f, 0.0264511406f, 0.0421320386f,
+            -0.164769351f, -0.0504042469f, 0.0160138253f, 0.0235105883f, -0.170099258f, -0.0491008386f, 0.00582860829f, 0.0314350128f,
+            -0.176387325f, -0.0426004231f, 0.00806449819f, 0.0246364065f, -0.157879651f, -0.0112882378f, -0.0104516391f, 0.0130945034f,
+            -0.13558872f, -0.00946441665f, -0.0146135576f, 0.0313584432f, -0.0926699862f, -0.00489789806f, -0.0130039509f, 0.00866502244f,
+            -0.0294000078f, -0.00216510356f, -0.0526700914f, -0.0322960056f, -0.0439497679f, -0.00308102858f, -0.0531352721f, -0.0242662262f,
+            -0.0520461835f, -0.00441697752f, -0.0409794748f, -0.0184007809f, -0.0552562997f, -0.00236446667f, -0.0429617539f, -0.00720314402f,
+            -0.05742383f, -0.000926623063f, -0.0593475886f, -0.0122880051f, -0.0581141561f, -0.00111072103f, -0.0524323508f, -0.009608455f,
+            -0.0439327024f, 0.00151817489f, -0.0469199084f, 0.00827683322f, -0.0333381072f, 0.00180065923f, -0.0479896478f, 0.0162013099f
+        },
+        {
+            -0.141987398f, -0.173990369f, 0.00248951581f, -0.0248233583f, -0.148281708f, -0.181101054f, 0.00256794808f, -0.0116130346f,
+            -0.141799554f, -0.169203833f, 0.0186468344f, -0.0116365524f, -0.128190592f, -0.153697714f, -0.0266676135f, -0.00421130843f,
+            -0.133540213f, -0.146419778f, -0.0124056293f, -0.00533938501f, -0.196240157f, -0.221192017f, -0.01262544f, 0.106898434f,
+            -0.185720429f, -0.188229382f, -0.0388951264f, 0.0959760249f, -0.123936303f, -0.123405516f, -0.0230389275f, 0.0943877473f,
+            -0.0635692999f, -0.058620628f, -0.00818417594f, 0.0924567804f, -0.00344848889f, 0.0103681469f, 0.0272427034f, 0.0931337401f,
+            0.0556529723f, 0.0739953965f, 0.029332431f, 0.0984052718f, 0.106376186f, 0.134656236f, 0.0212518983f, 0.116895273f,
+            0.150429934f, 0.101487197f, 0.014032145f, 0.0118473684f, 0.0551548526f, 0.0858106986f, -0.00123280508f, 0.00304719526f,
+            0.0527599193f, 0.0861800686f, -0.020154221f, -0.0203228667f, 0.0753883794f, 0.0955641195f, -0.0128962304f, -0.00411470141f,
+            0.0823456347f, 0.108390339f, -0.0158918481f, 0.0038577849f, 0.0898421854f, 0.105654188f, -0.0246322695f, -0.0030870738f,
+            0.0925251842f, 0.114098474f, -0.0152416807f, 0.0175075848f, 0.0872636512f, 0.106468767f, -0.0133379865f, 0.00532008801f,
+            0.0928778127f, 0.0972432122f, -0.0185583886f, 0.00120594027f, 0.0750439242f, 0.0810030103f, 0.0013361912f, 0.0025383858f,
+            0.0635418743f, 0.07168594f, 0.00229833601f, -0.0101627409f, 0.0612044781f, 0.0486314893f, 0.0121752294f, -0.0466206297f,
+            0.00514753489f, 0.00966852438f, 0.0365842618f, -0.0563433133f, 0.0143572558f, 0.0113206478f, 0.037291985f, -0.0561228432f,
+            0.0227570795f, 0.0145167774f, 0.0360391103f, -0.0527374186f, 0.027572846f, 0.0137812393f, 0.0366833992f, -0.056263797f,
+            0.0309071727f, 0.00947702024f, 0.03801715f, -0.0523771122f, 0.0329485647f, 0.00921740197f, 0.0298905559f, -0.0494969003f,
+            0.0340514481f, 0.00050729356f, 0.0251137801f, -0.0546136275f, 0.0352902599f, 0.000112072863f, 0.0232832991f, -0.0533079579f
+        },
+        {
+            -0.149278626f, 0.187213674f, 0.0279375296f, 0.0067701987f, -0.15810962f, 0.195601091f, 0.0255620461f, 0.0369989537f,
+            -0.151775926f, 0.187287956f, 0.0233565401f, 0.0325223394f, -0.138575211f, 0.169395834f, 0.0030488465f, 0.0502995364f,
+            -0.143367991f, 0.166390434f, 0.013810982f, 0.0620748699f, -0.19152087f, 0.266945124f, 0.0378677994f, 0.12749286f,
+            -0.191532195f, 0.22810109f, 0.0826912224f, 0.0610588863f, -0.128106192f, 0.163146079f, 0.0528656468f, 0.0587298274f,
+            -0.0641474128f, 0.084876813f, 0.0190628469f, 0.0658843666f, -0.00167523092f, 0.00682314299f, 0.000137021561f, 0.060096737f,
+            0.0569946468f, -0.0686724856f, -0.00502444711f, 0.051731009f, 0.10877163f, -0.141094416f, -0.00613319827f, 0.0515045896f,
+            0.156200618f, -0.129361436f, -0.00635922793f, 0.129574448f, 0.0556752458f, -0.094156161f, -0.0235083997f, 0.0441444516f,
+            0.0513015352f, -0.0956152827f, -0.0193490777f, 0.0537807047f, 0.0742817149f, -0.113629319f, -0.0234398283f, 0.0407314412f,
+            0.0734483451f, -0.127306506f, -0.00903615355f, 0.0132981902f, 0.0856184959f, -0.134433806f, 0.0105187651f, 0.0148474174f,
+            0.0919492468f, -0.141284391f, 0.0232958626f, 0.0290595479f, 0.0838695988f, -0.139269859f, 0.0592699535f, 0.0251161046f,
+            0.0873787999f, -0.130951151f, 0.0836185589f, 0.0288691968f, 0.0661259219f, -0.0762522742f, 0.0368964337f, -0.0226728823f,
+            0.0479027368f, -0.0702248812f, 0.0407727361f, -0.0364189297f, 0.0408767313f, -0.0529181398f, -0.0313726999f, 0.00887653604f,
+            0.0079088835f, -0.0181909259f, -0.00944580417f, 0.0312237889f, 0.0254966263f, -0.0230536368f, -0.0145344548f, 0.0252994634f,
+            0.0414179303f, -0.0281149801f, -0.0119808717f, 0.0118424296f, 0.051240243f, -0.0220511723f, -0.0146651343f, 0.0262453072f,
+            0.0567528531f, -0.0159069486f, -0.0553260744f, -0.020465184f, 0.059356872f, -0.0163809713f, -0.0585660338f, -0.0214949958f,
+            0.0575711392f, -0.00287325075f, -0.057688199f, -0.0124844508f, 0.0576425791f, -0.00320856739f, -0.0634958073f, -0.0138511183f
+        },
+        {
+            0.009846434f, 0.0238924101f, -0.144229233f, 0.161788374f, 0.0114620067f, 0.0235981867f, -0.135770276f, 0.143261328f,
+            0.0028802522f, 0.0105483336f, -0.117026888f, 0.135879889f, 0.00158645515f, 0.00404856633f, -0.0488431267f, 0.0514735766f,
+            0.0188308302f, -0.00137865846f, -0.0424865372f, 0.0387815982f, 0.0901459232f, -0.00656654034f, -0.0362703428f, -0.0458847433f,
+            0.0380532406f, -0.0201894026f, -0.260057718f, -0.190349847f, 0.0149066793f, -0.0379983932f, -0.143906608f, -0.0964740291f,
+            -0.00439326558f, -0.0292139594f, -0.0297956374f, -0.0973776728f, -0.0158198699f, -0.0329474322f, -0.0269720443f, -0.149452224f,
+            -0.0196061824f, -0.0248927251f, -0.0223920047f, -0.162029788f, -0.0296776108f, -0.019929586f, -0.0472939499f, -0.185969353f,
+            -0.0505457558f, 0.0978674442f, -0.0814682096f, -0.188791052f, -0.0498442203f, -0.00672563305f, 0.00302520371f, 0.0294932779f,
+            -0.0476532206f, -0.0122072846f, -0.035537716f, 0.0180618335f, -0.0609673969f, 0.00260779075f, 0.00544077996f, 0.0374657921f,
+            -0.0160926208f, 0.00599941006f, 0.0727054402f, 0.0832763687f, -0.0192277487f, 0.0119957346f, 0.023971308f, 0.0494466722f,
+            -0.0221658982f, 0.00946027506f, -0.00127553032f, 0.0154545754f, 0.00142031442f, 0.01337694f, -0.0761458725f, 0.030871911f,
+            -0.00345018762f, 0.0161970165f, -0.0867797211f, 0.00551277958f, 0.0360775143f, -0.0408001766f, -0.052881714f, 0.0610227399f,
+            0.0891552493f, -0.0321104042f, -0.0400918759f, 0.00311486144f, 0.0789569542f, -0.0159297846f, -0.0113840345f, 0.0126819862f,
+            0.0339316055f, 0.0265797824f, -0.00180788152f, 0.122793458f, -0.00919211656f, 0.02973314f, 0.00551099144f, 0.0744370371f,
+            -0.031662073f, 0.0315836966f, 0.0268855914f, 0.106816664f, -0.0437990241f, -0.00149888406f, 0.0370954946f, 0.0736029968f,
+            -0.0545452796f, 0.00665015215f, 0.142690852f, 0.183539644f, -0.0629646257f, 0.0120845875f, 0.127893463f, 0.163138106f,
+            -0.0719149709f, -0.0055151186f, 0.125576422f, 0.127850518f, -0.0744502246f, 0.000534308027f, 0.125179783f, 0.119420558f
+        },
+        {
+            8.439058e-05f, 6.05858113e-05f, -0.0420212746f, -0.00343486317f, 3.45848235e-07f, 2.64535538e-05f, -0.0440052636f, -0.0136674382f,
+            0.000171059975f, 4.19190883e-06f, -0.0290588271f, -0.0218902156f, 0.000160273106f, 7.46407665e-08f, 0.0150672179f, -0.0526299775f,
+            9.83589644e-07f, 2.220399e-10f, -0.00132604479f, -0.0485550314f, 0.000320100313f, 7.57255261e-19f, -0.000484514545f, -0.055646155f,
+            0.000132664485f, 8.53619373e-19f, -0.079625383f, -0.0379477702f, 9.83486825e-05f, 1.6131578e-10f, -0.0264449921f, -0.0453249179f,
+            3.87831642e-05f, -3.1490849e-08f, 0.0175938662f, -0.0653568208f, 8.47540105e-06f, -3.1545444e-06f, 0.0240869299f, -0.0426103733f,
+            1.10488395e-06f, -1.61034113e-05f, 0.0248159282f, -0.0466332398f, -2.15088836e-08f, -5.38075037e-05f, 7.93519462e-07f, -0.0340703987f,
+            -6.1503556e-06f, -6.57325601e-20f, -1.19109268e-06f, -0.0293772984f, -1.43522755e-06f, -2.08296991e-39f, 0.0151495486f, 0.000594786892f,
+            -1.34354559e-06f, 8.02227957e-40f, 0.00821421295f, -0.0253401641f, -1.38184964e-06f, -1.48764507e-39f, 0.0176899359f, -0.0294037741f,
+            -0.000486452831f, 9.48278289e-40f, 0.0430253483f, -0.0113755846f, -0.000651613518f, 2.4456441e-33f, 0.0260632243f, -0.0139671145f,
+            -4.66312849e-05f, -2.1467992e-28f, 0.0355883501f, -0.0186213553f, -9.48809538e-05f, -1.85579836e-26f, 0.00241035968f, -0.0262707341f,
+            -0.000133642301f, -2.99221203e-25f, 0.00177281233f, -0.0395170227f, -0.000143494661f, -1.27261723e-40f, -1.11849147e-06f, -0.0323941f,
+            -3.52259813e-05f, -3.05805364e-40f, -4.31350736e-06f, -0.0545047782f, -1.05257413e-39f, -3.11050424e-40f, -0.0246638134f, -0.0884248167f,
+            -6.48921851e-15f, -8.31943892e-40f, -0.0545262173f, -0.141967669f, -6.18475369e-08f, -1.36332574e-06f, -0.050721515f, -0.117844924f,
+            1.63115851e-06f, -3.37172946e-06f, -0.0411262512f, -0.0892784819f, -4.29730699e-06f, -1.18864932e-06f, -0.0408751033f, -0.0791875944f,
+            1.21683606e-05f, -5.44996283e-06f, 4.02586302e-05f, 0.000495046726f, -4.50243988e-07f, 5.47901664e-07f, 6.62533421e-05f, 0.00147707388f,
+            -5.95855818e-06f, -1.23555101e-05f, 5.81381282e-05f, 0.00434682565f, -3.43518877e-05f, 3.11119147e-05f, -0.000187430865f, 0.0112845926f
+        },
+        {
+            0.112675965f, 0.0995587558f, -0.0484168157f, 0.0453878231f, 0.113471493f, 0.10606502f, -0.0487126783f, 0.0348478742f,
+            0.106995814f, 0.103411473f, -0.0636596307f, 0.0310659874f, 0.0950206593f, 0.0927598029f, -0.0387160555f, 0.0238970481f,
+            0.0988684446f, 0.0861617029f, -0.0253431275f, 0.0214278661f, 0.127076596f, 0.129982457f, -0.006266132f, 0.0202991609f,
+            0.136410788f, 0.107150607f, -0.0787706748f, 0.0111955218f, 0.0905956328f, 0.0745607764f, -0.0292614866f, 0.0112868194f,
+            0.043420855f, 0.0348032713f, -0.00577336736f, 0.0112492209f, 0.000540620589f, -0.00532701705f, 0.000708814361f, 0.011549443f,
+            -0.0401894823f, -0.0441442542f, 0.013293623f, 0.00994007289f, -0.0759724975f, -0.0808706954f, 0.0247839708f, -0.00488993013f,
+            -0.11127793f, -0.0778412744f, 0.0146601237f, 0.021288164f, -0.0303072929f, -0.0487795398f, 0.00265486306f, -0.0120630618f,
+            -0.0359108336f, -0.0534535833f, -0.0225223508f, -0.0280749165f, -0.0507654063f, -0.0600966439f, -0.0190419275f, -0.002146821f,
+            -0.0696640536f, -0.066076614f, -0.0421034917f, -3.79520134e-05f, -0.0828578696f, -0.0684431121f, -0.0591286756f, 0.00469549745f,
+            -0.0912317485f, -0.0675949752f, -0.0792240798f, -0.0196840577f, -0.0809136331f, -0.0687749535f, -0.093601957f, -0.0236339346f,
+            -0.0842886642f, -0.0590294302f, -0.0981096327f, -0.0339223295f, -0.0640346557f, -0.0312161427f, -0.0263034943f, -0.0139476163f,
+            -0.0430223793f, -0.0279632211f, -0.0314176604f, -0.00361199235f, -0.0359572098f, -0.0173572693f, 0.0561354049f, -0.0356700122f,
+            -0.00470842374f, -0.0010758671f, 0.039330706f, -0.0806823969f, -0.00814767182f, -0.00237880088f, 0.0483158827f, -0.0669121072f,
+            -0.0108363712f, -0.00380385388f, 0.0505686626f, -0.0609204248f, -0.0130317956f, -0.00405927189f, 0.0516734272f, -0.0604968481f,
+            -0.0146725401f, -0.00239470927f, 0.0662429854f, -0.0592731275f, -0.0157208722f, -0.00230168947f, 0.0633630529f, -0.0613910817f,
+            -0.0122576831f, -9.85923876e-09f, 0.0654916093f, -0.0501864813f, 0.000376288604f, 1.0050062e-06f, 0.0639245808f, -0.0480638854f
+        },
+        {
+            0.0968895033f, 0.0242085252f, -0.0497769266f, 0.0564393289f, 0.0984397978f, 0.0273698624f, -0.0478328392f, 0.0361209586f,
+            0.0927889198f, 0.02735072f, -0.0600900874f, 0.0276796706f, 0.0823527649f, 0.0269963536f, -0.0327988639f, 0.023869263f,
+            0.0878962874f, 0.0253275037f, -0.0198835861f, 0.0219050739f, 0.126739144f, 0.0296118874f, -0.0129215606f, 0.00267564156f,
+            0.125136554f, 0.0211196449f, -0.0804134458f, -0.01465391f, 0.0790737644f, 0.0102771996f, -0.0385375842f, -0.0135318013f,
+            0.0346826948f, 0.00224718172f, -0.00926011149f, -0.0135564273f, -0.00339248125f, -0.00716564711f, -0.015665954f, -0.0138415201f,
+            -0.038249515f, -0.0155650266f, -0.0083233444f, -0.0156172477f, -0.0697783232f, -0.0231914222f, 0.000296204846f, -0.0301874783f,
+            -0.100518644f, -0.0186723676f, -0.00767233456f, -0.0286563076f, -0.0286344886f, -0.0183056761f, -0.0021067725f, -0.000763795862f,
+            -0.0395327024f, -0.0173134375f, -0.0202588681f, -0.0104098562f, -0.0571313538f, -0.0153920976f, -0.0193067584f, 0.00356098823f,
+            -0.0708337724f, -0.0151711116f, -0.042592328f, -0.00117584737f, -0.0833618641f, -0.0135179954f, -0.0549474135f, 0.00450117933f,
+            -0.0911106691f, -0.0113349436f, -0.074361071f, -0.0361903645f, -0.0757154301f, -0.00681296829f, -0.0881917328f, -0.040619649f,
+            -0.0781305358f, -0.00266976515f, -0.0956889018f, -0.048143696f, -0.0476218201f, -0.00806193799f, -0.0261941515f, -0.0039094449f,
+            -0.0256197453f, -0.00436913315f, -0.0272338577f, 0.0139175877f, -0.0205328092f, -0.0021267992f, 0.0524014719f, -0.0205332935f,
+            -0.000585063128f, 0.00102644414f, 0.0461831726f, -0.0387312211f, -0.00120911654f, 0.00104865024f, 0.0537567064f, -0.0291321799f,
+            -0.0016315073f, 0.000941452105f, 0.0538100153f, -0.0256266501f, -0.00193296233f, 9.58691162e-05f, 0.053034991f, -0.0398170091f,
+            -0.0023782663f, -7.814938e-05f, 0.0695022345f, -0.0289487392f, -0.00249651074f, -0.000107201653f, 0.0660429597f, -0.0318352915f,
+            -0.00153732556f, 2.52795053e-06f, 0.0670853406f, -0.0339249074f, 0.000581691391f, 1.35503687e-05f, 0.0650031045f, -0.0319442227f
+        },
+        {
+            -1.08999649e-23f, 9.71938649e-16f, 5.22057014e-20f, -2.1846643e-05f, -1.23475398e-26f, 2.75146659e-17f, 4.22052575e-23f, -1.96592428e-05f,
+            1.53338198e-30f, 8.74133694e-21f, -1.37901961e-26f, -1.88223257e-05f, 4.32908798e-36f, 1.99723765e-29f, 2.68680456e-17f, -2.2768485e-05f,
+            -3.20366256e-40f, -2.49871134e-39f, 4.71339226e-17f, -2.3174387e-05f, 2.81256296e-39f, 1.98532191e-09f, -1.50324699e-14f, -2.50309295e-05f,
+            -3.03036398e-39f, 1.82280302e-09f, -3.23368475e-13f, -3.42105377e-05f, -2.4719045e-40f, 2.21687801e-09f, -2.83184175e-13f, -3.42597887e-05f,
+            5.15397629e-36f, 2.33360908e-09f, -1.7141425e-18f, -3.42806343e-05f, -5.51954107e-33f, 3.9374165e-10f, -1.54804331e-20f, -3.4527493e-05f,
+            -9.99436596e-28f, 4.58346243e-11f, -1.94922253e-37f, -3.51206181e-05f, 1.16726861e-25f, 4.23971665e-12f, 5.13085433e-40f, -3.5304005e-05f,
+            3.17158592e-23f, 1.67672951e-16f, -2.84427154e-40f, -1.953225e-05f, 2.75768531e-40f, -4.26849665e-39f, 2.66548945e-29f, -1.33065159e-05f,
+            2.9795529e-40f, 8.17605806e-40f, 6.84184112e-23f, -1.19544857e-05f, 1.41036206e-39f, -2.25509701e-39f, 2.50943592e-20f, -7.51839161e-06f,
+            -1.14975418e-39f, 1.16522891e-25f, 3.09193428e-21f, -6.89139642e-06f, 7.18599865e-41f, -3.17129135e-16f, 3.54879585e-19f, -6.8675181e-06f,
+            7.4612417e-40f, -3.60392543e-13f, 2.98422413e-17f, -5.30578291e-06f, 1.45189235e-39f, -2.48425482e-11f, 6.30512767e-22f, -5.09762185e-06f,
+            -8.57283572e-40f, -2.23240704e-10f, 4.00081922e-40f, -4.15164732e-06f, -8.30217492e-40f, -6.93301194e-10f, 1.06587105e-39f, -3.17243439e-06f,
+            2.68944628e-39f, -1.34713207e-09f, -1.07471865e-18f, -2.93105472e-06f, -2.64567813e-39f, -3.86911525e-09f, -1.26709462e-17f, -1.7679854e-06f,
+            -5.47249089e-41f, -5.22226103e-40f, -3.17726625e-17f, -1.69593593e-11f, -4.32579435e-40f, -1.52291856e-39f, -3.09715446e-17f, -1.6487511e-11f,
+            -1.61159132e-40f, 1.62806219e-39f, -1.68099963e-13f, -1.57191274e-11f, -1.08422666e-40f, -2.5637386e-39f, -1.69586635e-13f, -1.39875195e-11f,
+            -1.42228431e-39f, 5.78467216e-40f, -4.59230231e-29f, 4.04534758e-35f, 1.16057361e-39f, 6.67906492e-40f, -4.65707675e-29f, 2.43723981e-36f,
+            2.0438891e-39f, -1.58492181e-39f, -2.2345217e-29f, -1.73775373e-35f, -2.88806492e-39f, -3.18392107e-39f, -2.8297153e-29f, -7.56464192e-35f
+        },
+        {
+            0.0968135819f, -0.0834551826f, -0.0114516336f, -0.0643223748f, 0.100527413f, -0.0860053152f, -0.0120162973f, -0.0496288165f,
+            0.0966425613f, -0.0795201585f, -0.0188057963f, -0.0402315892f, 0.0874414966f, -0.0746020973f, -0.0101253493f, -0.0426268466f,
+            0.0843776539f, -0.0733609349f, -0.0235009976f, -0.0428649709f, 0.0882871374f, -0.111649364f, -0.0386797339f, -0.00213391776f,
+            0.127620965f, -0.09639889f, -0.0341320075f, 0.0601893328f, 0.0886738002f, -0.0652062669f, -0.00484959641f, 0.0588370636f,
+            0.0514165461f, -0.0345351249f, -0.00337989349f, 0.060453862f, 0.0144969206f, 0.000154569163f, 0.0324846394f, 0.0592863485f,
+            -0.0232277364f, 0.0320282727f, 0.0430323109f, 0.0619435832f, -0.0558257885f, 0.0636588484f, 0.0504091419f, 0.082702063f,
+            -0.0852670148f, 0.0385712907f, 0.0516173989f, 0.0203464758f, -0.0279553887f, 0.0509291813f, 0.0348792337f, -0.0302796029f,
+            -0.0141275693f, 0.0541265979f, 0.016822366f, -0.0453845784f, -0.0164153315f, 0.0613048226f, 0.0243728925f, -0.0133080222f,
+            -0.0372995324f, 0.0664540753f, 0.0105498983f, -2.39489927e-05f, -0.0518953465f, 0.0577760004f, -0.00762745319f, -0.000214778163f,
+            -0.0591774583f, 0.0613282174f, -0.0190046486f, 0.00831067655f, -0.0652867183f, 0.0522480458f, -0.0304759685f, 0.0173722263f,
+            -0.0667034984f, 0.0475908965f, -0.0469461419f, 0.0134433564f, -0.0651370138f, 0.0411668047f, -0.0159093998f, 0.0296934638f,
+            -0.0586260781f, 0.0349319577f, -0.027691653f, 0.0354442671f, -0.0500300974f, 0.0223133694f, 0.0144349821f, 0.00157598092f,
+            -0.012456459f, 0.00268389191f, -0.00549759017f, -0.0844931379f, -0.0216016714f, 0.00300101656f, 0.000382256927f, -0.0721395761f,
+            -0.0278999433f, 0.00354514318f, 0.00397133455f, -0.0611928031f, -0.0317060947f, 0.00364984013f, 0.00534405466f, -0.0556449555f,
+            -0.0333280675f, 0.000316781952f, 0.00880088937f, -0.0583475232f, -0.0341950357f, 0.000196264213f, 0.00879647955f, -0.0557535142f,
+            -0.0215380061f, -1.46952643e-05f, 0.0134530878f, -0.0417322479f, -0.0078448765f, 1.1933181e-06f, 0.0180541221f, -0.0279069468f
+        },
+        {
+            0.00719255861f, -1.68518618e-05f, -0.109879293f, -0.0399126932f, 0.00457913009f, -4.34559615e-06f, -0.101589292f, -0.0459802002f,
+            0.00501023978f, -0.000965853513f, -0.05914535f, -0.0580585934f, 0.0018583698f, -0.00968982466f, 0.0640746132f, 0.0306150578f,
+            0.00210763304f, -0.00926843379f, 0.187140509f, 0.0426978432f, 0.0214808211f, 0.0119511895f, 0.295460552f, 0.0184659697f,
+            -0.0681402683f, 0.0199452508f, 0.50413239f, -0.0138165578f, -0.0614033826f, 0.0209389962f, 0.379947305f, -0.0121319378f,
+            -0.0472942032f, 0.0190276094f, 0.208510667f, -0.0124842664f, -0.0330069885f, 0.0188044775f, 0.0663556084f, -0.0221772473f,
+            -0.0199175626f, 0.00925922953f, -0.0610714108f, -0.0265292674f, -0.0124288965f, 0.00676359003f, -0.186009347f, -0.00782594737f,
+            0.0024997443f, 0.0140391029f, -0.227795273f, -0.0103487093f, 0.0046435385f, -0.00440274319f, -0.285437256f, -0.0243296046f,
+            0.0105590085f, -0.00351970037f, -0.251388997f, -0.0166612156f, 0.0151302591f, -0.00752074923f, -0.221779913f, 0.0216118302f,
+            -0.0189189594f, -0.0143945431f, -0.112997368f, 0.0306124501f, -0.00589912059f, -0.0209574308f, 0.0223748367f, 0.0605444238f,
+            0.0154440822f, -0.0309314523f, 0.0785537362f, 0.0933703259f, 0.0289004296f, -0.0264579821f, 0.187104657f, 0.0655231327f,
+            0.0286570601f, -0.0379403792f, 0.176896974f, 0.0457806177f, 0.0348760188f, -0.0152265998f, 0.129360661f, -0.00711336033f,
+            0.0317604877f, -0.0126222195f, 0.100884497f, -0.00470912829f, -0.0111256521f, -0.00388004305f, 0.00662213191f, 0.115257621f,
+            -0.0297256429f, 0.000930545386f, 0.035658896f, 0.235784218f, 0.0108033484f, 0.00350218313f, 0.0200843215f, 0.210409507f,
+            0.0295222644f, 0.00384420576f, 0.00323689752f, 0.168584228f, 0.0382217392f, 0.0105362469f, -0.0203318223f, 0.163319781f,
+            0.0363366976f, -0.00160663179f, -0.111769088f, -0.0203616675f, 0.0453750715f, -0.00323352241f, -0.0992964953f, -0.014172907f,
+            0.0473132543f, -0.00357698067f, -0.0968265757f, -0.0129325055f, 0.0497712754f, -0.00404315023f, -0.0984838977f, -0.0131133152f
+        },
+        {
+            -0.118668444f, -0.0942984372f, 0.0380548015f, 0.0878820345f, -0.123418115f, -0.107266076f, 0.050359156f, 0.0660836324f,
+            -0.122914791f, -0.115041539f, 0.0752594769f, 0.0677012503f, -0.114276133f, -0.105983146f, 0.0694318786f, 0.0814294368f,
+            -0.106917299f, -0.103137076f, 0.0659414083f, 0.0869744197f, -0.122291535f, -0.156012684f, 0.0514860004f, 0.0142215062f,
+            -0.16750291f, -0.127856225f, 0.0633922219f, -0.0516370609f, -0.117986225f, -0.0974753797f, -0.00929304585f, -0.0454459749f,
+            -0.0696302801f, -0.0506352745f, -0.0211778209f, -0.0466944501f, -0.0216787234f, -0.00970382523f, -0.0933406502f, -0.0450938195f,
+            0.0283496734f, 0.0344950892f, -0.122332767f, -0.0506516509f, 0.0697325915f, 0.0759913549f, -0.152775809f, -0.0685050115f,
+            0.106977336f, 0.131721258f, -0.140552565f, -0.049866315f, 0.0479237027f, 0.0615285188f, -0.0734256953f, 0.109410539f,
+            0.0221369304f, 0.0552279502f, -0.0230411645f, 0.138301104f, 0.0345253162f, 0.064611353f, -0.0240976382f, 0.0717248619f,
+            0.0527243391f, 0.0708480328f, 0.00285999198f, 0.0383138061f, 0.0660738125f, 0.0795642138f, 0.0389034078f, 0.0231655147f,
+            0.0723125488f, 0.0772961527f, 0.0628625825f, 0.00350098452f, 0.0810253546f, 0.0785460845f, 0.0826807544f, -0.0170919504f,
+            0.0805111676f, 0.0723173395f, 0.0803846344f, -0.0208217241f, 0.0798086673f, 0.0163075905f, 0.0530526303f, -0.0128910383f,
+            0.0805442929f, 0.0180510096f, 0.0597012676f, -0.0259363037f, 0.0587029643f, 0.0161092822f, -0.0221061651f, 0.0252823886f,
+            0.0222869571f, 0.015748458f, 0.00828018133f, 0.158214703f, 0.0363841541f, 0.0212841816f, -0.00690750219f, 0.132804349f,
+            0.0465880632f, 0.0256245062f, -0.0214977004f, 0.114236906f, 0.0525645651f, 0.0180192068f, -0.0256121755f, 0.0953812152f,
+            0.0549671836f, 0.0159035157f, -0.0301070977f, 0.0901141688f, 0.055178307f, 0.0169088375f, -0.0289621279f, 0.0862405747f,
+            0.0376841165f, 0.00226150732f, -0.0385712832f, 0.0627910644f, 0.0230413843f, 0.0021448331f, -0.0456770882f, 0.0558533706f
+        },
+        {
+            -0.224515587f, 0.173475012f, 0.79487139f, -0.29559806f, -0.20510684f, 0.165479422f, 0.797798157f, -0.0923631862f,
+            -0.182672277f, 0.145437166f, 0.717350245f, -0.0507244021f, -0.167406604f, 0.131046176f, 0.462458491f, 0.034162391f,
+            -0.129723862f, 0.128564611f, 0.243156284f, 0.0335141383f, -0.130431965f, 0.105425745f, 0.016910756f, 0.0365012027f,
+            -0.0321442224f, 0.0630710274f, -0.239301383f, 0.0347210206f, 0.0485517345f, 0.00624451973f, -0.532961428f, 0.0702843666f,
+            0.105737329f, -0.0490362197f, -0.670660019f, 0.0105595533f, 0.14263387f, -0.0952505395f, -0.620977521f, 0.0751134306f,
+            0.179209396f, -0.141232654f, -0.547202229f, 0.0147969956f, 0.211525083f, -0.177361503f, -0.29248482f, 0.0548679456f,
+            0.229866549f, -0.168769374f, -0.0235576648f, 0.107927926f, 0.10695155f, -0.0461380519f, 0.282799244f, 0.00308892503f,
+            0.0575680733f, -0.0137501778f, 0.617870092f, 0.152903408f, 0.0759443045f, -0.0296316426f, 0.540256441f, -0.0396969095f,
+            0.00252985395f, -0.0313487425f, 0.503171265f, -0.0835668594f, 5.81632485e-05f, -0.0203878731f, 0.508324206f, -0.0703341737f,
+            0.00432747649f, -0.0233240947f, 0.444865823f, -0.0641229972f, -0.0398669466f, -0.0189310946f, 0.329270095f, -0.0370621085f,
+            -0.0537358411f, -0.0318742841f, 0.257278115f, -0.0594777241f, -0.0542521216f, 0.000857952458f, 0.0386829302f, -0.133327976f,
+            -0.0585818812f, -0.0113969157f, -0.0391926132f, -0.143638462f, -0.0858913139f, -0.0179823786f, -0.221117973f, -0.0550109819f,
+            -0.0613568276f, -0.0460750721f, -0.322330266f, -0.052883625f, 0.0144941416f, -0.0479420759f, -0.336509913f, -0.0642521381f,
+            0.0411982872f, -0.050561171f, -0.340797901f, -0.0570692681f, 0.0546541438f, -0.0214354862f, -0.336208105f, 0.0283086635f,
+            0.0605000108f, -0.00898721535f, -0.332686007f, 0.0407277085f, 0.0640632734f, -0.0139891366f, -0.327472895f, 0.0522912815f,
+            0.0659429803f, 0.0179069731f, -0.333235323f, 0.0705604553f, 0.0695995763f, 0.0100908093f, -0.347059548f, 0.0628794804f
+        },
+        {
+            -0.213688269f, 0.21572867f, -0.0972513109f, -0.0981563628f, -0.240653589f, 0.243703917f, -0.0962529778f, -0.0512783453f,
+            -0.243320853f, 0.253338754f, -0.0842477977f, -0.0332691558f, -0.231226429f, 0.238955483f, -0.101541169f, -0.0294091292f,
+            -0.244221509f, 0.242812887f, -0.0486196391f, -0.0509655923f, -0.3851372f, 0.375669956f, -0.0448832624f, 0.137666449f,
+            -0.337179214f, 0.31727311f, -0.0578089841f, 0.0827125758f, -0.226761162f, 0.236865029f, 0.0414128155f, 0.094511494f,
+            -0.126653731f, 0.13457568f, 0.105676942f, 0.0966211706f, -0.0211396664f, 0.037184462f, 0.173151195f, 0.0738041103f,
+            0.0779886916f, -0.0638383105f, 0.182281733f, 0.0858500451f, 0.17123504f, -0.162636459f, 0.202726483f, 0.105006784f,
+            0.246533573f, -0.242979109f, 0.17024672f, 0.173182622f, 0.146676406f, -0.149373591f, 0.0441134349f, -0.0699839219f,
+            0.144835249f, -0.147179827f, -0.0358892903f, -0.166070744f, 0.161165178f, -0.166539967f, 0.00966227893f, -0.0428776331f,
+            0.160580143f, -0.184792116f, 0.0055962489f, -0.00392962433f, 0.171641722f, -0.198333651f, -0.0289559569f, 0.00208609784f,
+            0.178392157f, -0.19610326f, -0.0259553306f, -6.4245316e-05f, 0.172658667f, -0.189689815f, -0.0544715188f, -0.00292306207f,
+            0.178524926f, -0.171147406f, -0.0459279269f, -0.00122519908f, 0.142859116f, -0.0785159841f, -0.0344854742f, -0.0180439204f,
+            0.116014794f, -0.0675244629f, -0.019625036f, -0.064203985f, 0.110502422f, -0.0475536846f, -0.00625577988f, -0.0643882975f,
+            0.0149333114f, -0.028589651f, -0.0118056461f, -0.179367676f, 0.0316389166f, -0.0361084454f, -0.000216677072f, -0.165482372f,
+            0.0384703279f, -0.0425476022f, -0.0066037043f, -0.159413368f, 0.0405500531f, -0.0281374361f, -0.00263275974f, -0.134783342f,
+            0.0427611992f, -0.0305169355f, 0.00676266337f, -0.0940982178f, 0.0455584638f, -0.0324080959f, -0.0136971157f, -0.0907582343f,
+            0.0466110036f, -3.40253825e-10f, -0.0135301957f, -0.0710958242f, 0.0423126556f, -2.41318467e-08f, -0.0124923401f, -0.0613540821f
+        },
+        {
+            0.390870959f, -0.298089862f, 0.178162903f, -0.0690296888f, 0.41379413f, -0.320271164f, 0.152708113f, 0.00968194567f,
+            0.410246551f, -0.305856705f, 0.138362736f, 0.0466435403f, 0.370863527f, -0.279923737f, 0.0482141785f, 0.0461874381f,
+            0.33467266f, -0.270776451f, 0.0356711932f, 0.0616120212f, 0.501883447f, -0.41469124f, -0.052013699f, 0.0323915705f,
+            0.492112577f, -0.334260672f, 0.199571863f, 0.193870097f, 0.348020077f, -0.212352708f, 0.0125629613f, 0.19317162f,
+            0.212711871f, -0.0968030989f, -0.183928668f, 0.196391091f, 0.0640959963f, 0.025040498f, -0.206025511f, 0.194694519f,
+            -0.0849571228f, 0.133380145f, -0.233025506f, 0.176198199f, -0.224846169f, 0.235490233f, -0.217276588f, 0.231116757f,
+            -0.335772157f, 0.167412117f, -0.144901559f, 0.126140162f, -0.163797691f, 0.170437619f, -0.149149209f, 0.0658926964f,
+            -0.139748722f, 0.17257528f, -0.0399976857f, 0.125672415f, -0.179791316f, 0.178611904f, -0.136257738f, 0.0329940431f,
+            -0.176874727f, 0.19705613f, -0.184250921f, -0.00394932041f, -0.201636195f, 0.202279672f, -0.118051916f, 0.0173200965f,
+            -0.218577772f, 0.208366871f, -0.072027564f, 0.000788913225f, -0.231226653f, 0.199185565f, 0.026589971f, 0.070891276f,
+            -0.238450274f, 0.183830783f, 0.0550980195f, 0.0848911032f, -0.224121749f, 0.167815179f, 0.0997178629f, 0.0272752382f,
+            -0.209836021f, 0.140821204f, 0.102199554f, -0.0194447469f, -0.1384314f, 0.0987241417f, 0.204725787f, -0.0121096317f,
+            -0.0334574655f, 0.014711271f, 0.247357756f, -0.0867326409f, -0.0558536053f, 0.0188814271f, 0.224518731f, -0.0827432275f,
+            -0.0689584613f, 0.0235887077f, 0.248600826f, -0.100001127f, -0.0759795904f, 0.0389265679f, 0.189084843f, -0.0817796886f,
+            -0.0815815255f, 0.0255000312f, -0.0447553694f, -0.215130746f, -0.0751008689f, 0.0199415255f, -0.0323879309f, -0.193596929f,
+            -0.0516037196f, 0.011956919f, -0.0186600387f, -0.15772438f, -0.0298601612f, 0.00565568265f, -0.0045280112f, -0.132796466f
+        }
+    },
+    .hidden_bias_f32 = {
+        1.51803827f, 1.0105511f, -6.6788547e-05f, 0.52122587f, 0.961677909f, 0.316719085f, 0.174568102f, -0.008115476f,
+        0.307719827f, 0.00606470043f, -0.0380673036f, 0.00290750805f, 0.0194723438f, 0.210573897f, 1.15950024f, 0.947004199f,
+        0.183674157f, -0.000605811249f, 0.0143210031f, 0.00721471803f, 0.00467291521f, 1.03176177f, 0.377139002f, 0.101792604f,
+        0.172615454f, -2.06406803e-05f, 0.00183228764f, 0.0309262928f, 0.446340144f, -0.0411867648f, -0.00498565193f, 0.000623754575f
+    },
+    .output_weights_f32 = {
+        {
+            1.57438338f, 0.951322556f, -0.332714766f, 0.356160134f, 0.923356652f, 0.191290319f, 0.108263813f, -0.171258435f,
+            0.142019793f, -0.169063181f, -0.901026249f, -0.0699583143f, -0.217881233f, -0.0239805747f, 1.1605345f, 0.903553843f,
+            0.0886710733f, -0.153494954f, -0.0479746386f, -0.0784170777f, -0.0427252874f, 0.97424072f, 0.29325965f, 0.0482154004f,
+            0.137130111f, -0.00375545793f, -0.131158754f, -0.136116609f, 0.36500597f, -1.4365716f, -0.412753344f, -0.637785733f
+        },
+        {
+            -0.464233249f, -0.210863903f, 0.349057555f, 0.21687898f, -0.0784279257f, 0.328220069f, 0.115572907f, -0.214677483f,
+            -0.403160363f, 0.0671380237f, 1.34099972f, -0.113879718f, 0.220393613f, -0.877895415f, -0.318210036f, 0.117169738f,
+            0.131400764f, -0.119723961f, 0.04275655f, -0.0695812628f, 0.109907627f, -0.191316903f, -0.169626042f, -0.145205542f,
+            -0.0777289122f, 0.00890844408f, -0.138135225f, 0.812548101f, 0.402676612f, 1.99797034f, -0.725906432f, 0.594627976f
+        },
+        {
+            -0.246966869f, -0.281192273f, -0.136327341f, -0.50828445f, -0.142054096f, 0.807106376f, 0.323400915f, 0.218987301f,
+            -0.472602785f, -0.842590928f, 0.0383662879f, -0.0799393654f, 0.961987257f, 0.850935459f, -0.163121268f, -0.14067018f,
+            -0.729773402f, 0.412136704f, -0.565092504f, 0.370513141f, 0.358457565f, -0.197829753f, -0.05445081f, -0.182401955f,
+            -0.152457833f, 0.000363464933f, -0.156185955f, -0.12474256f, 0.268467784f, 0.0488583446f, 0.735330045f, -1.02265489f
+        },
+        {
+            -0.286839008f, -0.0388515294f, 0.245891944f, 0.325634778f, -0.165390238f, -0.958293915f, -0.341236502f, -0.0713727772f,
+            0.695399106f, 0.931854427f, -0.35309124f, 0.0963385105f, -1.03685331f, -0.400473356f, -0.118775323f, -0.166218072f,
+            0.741023481f, -0.255845696f, 0.693304956f, -0.296506494f, -0.330128133f, -0.117833287f, -0.0570276603f, 0.265376449f,
+            0.221028686f, 1.60967102e-05f, 0.32610774f, -0.255483776f, -0.455884933f, -0.420762479f, -0.17354016f, 1.01666343f
+        },
+        {
+            -0.208301976f, -0.184061587f, -0.0649291724f, -0.102964796f, -0.121290937f, -0.153506085f, -0.0501400493f, -0.00421440601f,
+            -0.0705208257f, -0.0776428804f, -0.037605755f, -0.00272033364f, -0.118720204f, -0.0571406484f, -0.19516021f, -0.119015343f,
+            -0.0975308791f, -0.0554373376f, -0.0480466411f, -0.0265545454f, -0.0392713808f, -0.144673869f, -0.0474477112f, -0.0186717007f,
+            -0.0264262035f, 2.20223442e-39f, -0.00606428785f, -0.0239982028f, -0.0867297575f, -0.0377472378f, -0.0112179564f, -0.0927686691f
+        },
+        {
+            -0.208301976f, -0.184061572f, -0.0649291724f, -0.102964796f, -0.12129093f, -0.15350607f, -0.050140053f, -0.00421440555f,
+            -0.0705208257f, -0.0776428804f, -0.0376057513f, -0.0027203334f, -0.118720204f, -0.0571406484f, -0.195160225f, -0.119015351f,
+            -0.0975308791f, -0.0554373413f, -0.0480466485f, -0.0265545454f, -0.0392713808f, -0.144673869f, -0.047447715f, -0.0186717026f,
+            -0.0264262054f, 1.71161881e-39f, -0.00606428832f, -0.0239982009f, -0.08672975f, -0.0377472341f, -0.0112179564f, -0.0927686691f
+        },
+        {
+            -0.327872306f, -0.168047309f, 0.415697694f, -0.448149204f, -0.167754114f, 1.08918631f, -0.372419417f, -0.0586204864f,
+            0.676056385f, -0.472286522f, -0.068899028f, 0.0593170263f, -1.16663134f, -0.48541382f, -0.113674708f, -0.159126595f,
+            0.764176965f, 0.811480045f, 0.177593127f, -0.372913122f, 0.546828985f, -0.126090452f, -0.0621596985f, 0.306768656f,
+            0.0997988805f, 5.09262973e-05f, -0.0682450011f, -0.0932770967f, -0.357622087f, -0.0441162921f, 0.835088253f, -0.762688398f
+        },
+        {
+            -0.141440094f, -0.0798479319f, -0.3471798f, 0.400940746f, -0.164620996f, -1.17619359f, 0.3958143f, 0.426752955f,
+            -0.465304613f, 0.575220406f, -0.229125425f, -0.0161246769f, 1.0585674f, 1.00475669f, -0.212128878f, -0.161473051f,
+            -0.707236409f, -0.608124912f, -0.0746813342f, 0.528062344f, -0.482584924f, -0.128584281f, -0.0640590265f, -0.184164479f,
+            -0.00889869686f, -0.000190991632f, 0.25392434f, -0.148087412f, 0.154302359f, -0.279450655f, -0.259904444f, 0.721712947f
+        }
+    },
+    .output_bias_f32 = {
+        0.807906449f, -0.0900693834f, -0.116235361f, -0.0917279869f, -0.168146744f, -0.168146729f, -0.111653902f, -0.0993028358f
+    }
+};
@@ -0,0 +1,404 @@
+/*****************************************************************************
+ * File name: radar_pipeline.c
+ *
+ * Description: This file implements the frame processing pipeline.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "radar_pipeline.h"
+
+/*******************************************************************************
+ * Function Name: update_shed_level
+ ********************************************************************************
+ * Summary:
+ *   Accounts a delivered frame and raises or lowers the shed level at the
+ *   end of every window. Called by the last stage only.
+ *
+ * Parameters:
+ *   pipeline: pipeline state
+ *   latency: cycles from submit to the end of the last stage
+ *   missed: true if the frame missed its deadline
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void update_shed_level(radar_pipeline_s *pipeline, uint32_t latency, bool missed)
+{
+    radar_pipeline_shed_e level = pipeline->shed_level;
+
+    pipeline->window_frames++;
+    if (missed)
+    {
+        pipeline->window_misses++;
+    }
+    if (latency > pipeline->window_latency_max)
+    {
+        pipeline->window_latency_max = latency;
+    }
+
+    if (pipeline->window_frames < RADAR_PIPELINE_SHED_WINDOW)
+    {
+        return;
+    }
+
+    if ((pipeline->window_misses >= RADAR_PIPELINE_SHED_MISSES) &&
+        (level < (RADAR_PIPELINE_SHED_NUM - 1)))
+    {
+        pipeline->shed_level = (radar_pipeline_shed_e)(level + 1);
+        pipeline->level_changes++;
+    }
+    else if ((pipeline->window_misses == 0U) && (level > RADAR_PIPELINE_SHED_NONE) &&
+             (pipeline->window_latency_max < ((pipeline->deadline_cycles / 100U) * RADAR_PIPELINE_SHED_HEADROOM_PCT)))
+    {
+        pipeline->shed_level = (radar_pipeline_shed_e)(level - 1);
+        pipeline->level_changes++;
+    }
+
+    pipeline->window_frames = 0;
+    pipeline->window_misses = 0;
+    pipeline->window_latency_max = 0;
+}
+
+/*******************************************************************************
+ * Function Name: complete_frame
+ ********************************************************************************
+ * Summary:
+ *   Returns a frame slot that left the pipeline to the free slots
+ *
+ * Parameters:
+ *   pipeline: pipeline state
+ *   frame: frame slot
+ *   delivered: true if the frame passed all stages
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void complete_frame(radar_pipeline_s *pipeline, radar_pipeline_frame_s *frame, bool delivered)
+{
+    if (delivered)
+    {
+        uint32_t now = radar_dsp_cycles();
+        uint32_t latency = now - frame->submitted_at;
+
+        radar_dsp_stats_add(&pipeline->latency, latency);
+
+        if (pipeline->deadline_cycles != 0U)
+        {
+            /* wrap-safe, the cycle counter overflows every few tens of seconds */
+            bool missed = ((int32_t)(now - frame->deadline) > 0);
+
+            if (missed)
+            {
+                pipeline->deadline_misses++;
+            }
+            update_shed_level(pipeline, latency, missed);
+        }
+    }
+
+    taskENTER_CRITICAL();
+    pipeline->in_flight--;
+    taskEXIT_CRITICAL();
+
+    (void)xQueueSend(pipeline->free_slots, &frame, 0);
+}
+
+/*******************************************************************************
+ * Function Name: stage_task
+ ********************************************************************************
+ * Summary:
+ *   Stage task. Runs the stage function on every frame of its input queue
+ *   and passes the frame to the next stage.
+ *
+ * Parameters:
+ *   pvParameters: stage
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static __NO_RETURN void stage_task(void *pvParameters)
+{
+    radar_pipeline_stage_s *stage = (radar_pipeline_stage_s*)pvParameters;
+    radar_pipeline_s *pipeline = stage->pipeline;
+    radar_pipeline_frame_s *frame;
+
+    for(;;)
+    {
+        (void)xQueueReceive(stage->queue, &frame, portMAX_DELAY);
+
+        uint32_t backlog = (uint32_t)uxQueueMessagesWaiting(stage->queue) + 1U;
+        if (backlog > stage->backlog_max)
+        {
+            stage->backlog_max = backlog;
+        }
+
+        int32_t result = 0;
+
+        if (stage->optional && radar_pipeline_shed_optional(frame))
+        {
+            stage->skipped++;
+        }
+        else
+        {
+            uint32_t cycles = radar_dsp_cycles();
+            result = stage->process(frame, stage->ctx);
+            cycles = radar_dsp_cycles() - cycles;
+
+            radar_dsp_stats_add(&stage->stats, cycles);
+            if ((stage->budget_cycles != 0U) && (cycles > stage->budget_cycles))
+            {
+                stage->overruns++;
+            }
+        }
+
+        if (result != 0)
+        {
+            stage->dropped++;
+            complete_frame(pipeline, frame, false);
+        }
+        else if ((stage->idx + 1U) < pipeline->num_stages)
+        {
+            /* queues hold every slot, this never blocks */
+            (void)xQueueSend(pipeline->stages[stage->idx + 1U].queue, &frame, portMAX_DELAY);
+        }
+        else
+        {
+            complete_frame(pipeline, frame, true);
+        }
+    }
+}
+
+/*
+ * Initialize pipeline
+ */
+int32_t radar_pipeline_init(radar_pipeline_s *pipeline)
+{
+    memset(pipeline, 0, sizeof(radar_pipeline_s));
+
+    pipeline->free_slots = xQueueCreate(RADAR_PIPELINE_NUM_SLOTS, sizeof(radar_pipeline_frame_s*));
+    if (pipeline->free_slots == NULL)
+    {
+        return -2;
+    }
+
+    for (uint32_t i = 0; i < RADAR_PIPELINE_NUM_SLOTS; ++i)
+    {
+        radar_pipeline_frame_s *frame = &pipeline->slots[i];
+        (void)xQueueSend(pipeline->free_slots, &frame, 0);
+    }
+
+    return 0;
+}
+
+/*
+ * Append a stage
+ */
+int32_t radar_pipeline_add_stage(radar_pipeline_s *pipeline, const char *name,
+                                 radar_pipeline_stage_fn process, void *ctx,
+                                 UBaseType_t priority, uint16_t stack_size)
+{
+    if ((NULL == pipeline) || (NULL == name) || (NULL == process) || pipeline->started)
+    {
+        return -1;
+    }
+
+    if (pipeline->num_stages >= RADAR_PIPELINE_STAGES_UB)
+    {
+        return -2;
+    }
+
+    radar_pipeline_stage_s *stage = &pipeline->stages[pipeline->num_stages];
+
+    stage->queue = xQueueCreate(RADAR_PIPELINE_NUM_SLOTS, sizeof(radar_pipeline_frame_s*));
+    if (stage->queue == NULL)
+    {
+        return -2;
+    }
+
+    stage->name = name;
+    stage->process = process;
+    stage->ctx = ctx;
+    stage->priority = priority;
+    stage->stack_size = stack_size;
+    stage->pipeline = pipeline;
+    stage->idx = pipeline->num_stages;
+
+    return (int32_t)(pipeline->num_stages++);
+}
+
+/*
+ * Set shedding options and time budget of a stage
+ */
+int32_t radar_pipeline_configure_stage(radar_pipeline_s *pipeline, uint32_t idx,
+                                       bool optional, uint32_t budget_cycles)
+{
+    if ((NULL == pipeline) || (idx >= pipeline->num_stages))
+    {
+        return -1;
+    }
+
+    pipeline->stages[idx].optional = optional;
+    pipeline->stages[idx].budget_cycles = budget_cycles;
+
+    return 0;
+}
+
+/*
+ * Set the frame deadline
+ */
+void radar_pipeline_set_deadline(radar_pipeline_s *pipeline, uint32_t deadline_cycles)
+{
+    pipeline->deadline_cycles = deadline_cycles;
+
+    if (deadline_cycles == 0U)
+    {
+        pipeline->shed_level = RADAR_PIPELINE_SHED_NONE;
+    }
+}
+
+/*
+ * Create the stage tasks
+ */
+int32_t radar_pipeline_start(radar_pipeline_s *pipeline)
+{
+    for (uint32_t i = 0; i < pipeline->num_stages; ++i)
+    {
+        radar_pipeline_stage_s *stage = &pipeline->stages[i];
+
+        if (xTaskCreate(stage_task, stage->name, stage->stack_size, stage, stage->priority, &stage->task) != pdPASS)
+        {
+            return -2;
+        }
+    }
+
+    pipeline->started = true;
+
+    return 0;
+}
+
+/*
+ * Take a free frame slot
+ */
+radar_pipeline_frame_s* radar_pipeline_acquire(radar_pipeline_s *pipeline, TickType_t wait)
+{
+    radar_pipeline_frame_s *frame;
+
+    if (xQueueReceive(pipeline->free_slots, &frame, 0) == pdPASS)
+    {
+        return frame;
+    }
+
+    pipeline->acquire_stalls++;
+
+    if (xQueueReceive(pipeline->free_slots, &frame, wait) == pdPASS)
+    {
+        return frame;
+    }
+
+    return NULL;
+}
+
+/*
+ * Return a frame slot that was not submitted
+ */
+void radar_pipeline_release(radar_pipeline_s *pipeline, radar_pipeline_frame_s *frame)
+{
+    (void)xQueueSend(pipeline->free_slots, &frame, 0);
+}
+
+/*
+ * Count buffered frames the acquisition discarded
+ */
+void radar_pipeline_add_coalesced(radar_pipeline_s *pipeline, uint32_t discarded)
+{
+    pipeline->coalesced += discarded;
+}
+
+/*
+ * Pass a filled frame slot to the first stage
+ */
+void radar_pipeline_submit(radar_pipeline_s *pipeline, radar_pipeline_frame_s *frame)
+{
+    frame->seq = pipeline->seq++;
+    frame->submitted_at = radar_dsp_cycles();
+    frame->deadline = frame->submitted_at + pipeline->deadline_cycles;
+    frame->shed_level = pipeline->shed_level;
+
+    if ((frame->shed_level >= RADAR_PIPELINE_SHED_DECIMATE) && ((frame->seq & 1U) != 0U))
+    {
+        pipeline->decimated++;
+        radar_pipeline_release(pipeline, frame);
+        return;
+    }
+
+    if (pipeline->num_stages == 0U)
+    {
+        radar_pipeline_release(pipeline, frame);
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    pipeline->in_flight++;
+    taskEXIT_CRITICAL();
+
+    (void)xQueueSend(pipeline->stages[0].queue, &frame, portMAX_DELAY);
+}
+
+/*
+ * Wait until all submitted frames have passed the pipeline
+ */
+void radar_pipeline_drain(const radar_pipeline_s *pipeline)
+{
+    while (pipeline->in_flight > 0U)
+    {
+        vTaskDelay(1);
+    }
+}
+
+/*
+ * Park the stage tasks
+ */
+void radar_pipeline_suspend(radar_pipeline_s *pipeline)
+{
+    radar_pipeline_drain(pipeline);
+
+    for (uint32_t i = 0; i < pipeline->num_stages; ++i)
+    {
+        vTaskSuspend(pipeline->stages[i].task);
+    }
+}
+
+/*
+ * Resume the parked stage tasks
+ */
+void radar_pipeline_resume(radar_pipeline_s *pipeline)
+{
+    pipeline->shed_level = RADAR_PIPELINE_SHED_NONE;
+    pipeline->window_frames = 0;
+    pipeline->window_misses = 0;
+    pipeline->window_latency_max = 0;
+
+    for (uint32_t i = 0; i < pipeline->num_stages; ++i)
+    {
+        vTaskResume(pipeline->stages[i].task);
+    }
+}
@@ -0,0 +1,320 @@
+/******************************************************************************
+** File name: radar_pipeline.h
+**
+** Description: This file contains the interface of the frame processing
+**   pipeline. Stages run in their own RTOS tasks and are connected by
+**   fixed-capacity queues of frame descriptors, so a stage works on frame N+1
+**   while the stages after it still handle frame N. The number of frames in
+**   flight is bounded by the frame slots of the pipeline. Every frame carries
+**   a deadline; when frames miss it, the pipeline sheds load in steps and
+**   restores full processing once the frames are on time again.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_PIPELINE_H_
+#define RADAR_PIPELINE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#include "radar_dsp.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_PIPELINE_STAGES_UB
+ * Maximum number of stages
+ */
+#define RADAR_PIPELINE_STAGES_UB        (6)
+
+/*
+ * @def RADAR_PIPELINE_NUM_SLOTS
+ * Frames in flight. Every slot holds a de-interleaved frame, two slots let
+ * consecutive frames overlap without exceeding the RAM of the smaller kits.
+ */
+#define RADAR_PIPELINE_NUM_SLOTS        (2U)
+
+/*
+ * @def RADAR_PIPELINE_SHED_WINDOW
+ * Delivered frames evaluated before the shed level is raised or lowered
+ */
+#define RADAR_PIPELINE_SHED_WINDOW      (16U)
+
+/*
+ * @def RADAR_PIPELINE_SHED_MISSES
+ * Deadline misses within a window that raise the shed level
+ */
+#define RADAR_PIPELINE_SHED_MISSES      (2U)
+
+/*
+ * @def RADAR_PIPELINE_SHED_HEADROOM_PCT
+ * The shed level is lowered after a window without misses whose worst
+ * latency stayed below this share of the deadline
+ */
+#define RADAR_PIPELINE_SHED_HEADROOM_PCT (50U)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_pipeline_shed_e
+ * Load shedding levels, every level includes the ones below it
+ */
+typedef enum
+{
+    RADAR_PIPELINE_SHED_NONE = 0,       /*<< every frame passes every stage */
+    RADAR_PIPELINE_SHED_OPTIONAL = 1,   /*<< optional stages and optional work are skipped */
+    RADAR_PIPELINE_SHED_DECIMATE = 2,   /*<< every other frame is dropped on submit */
+    RADAR_PIPELINE_SHED_COALESCE = 3,   /*<< of the frames buffered by the acquisition only the newest is taken */
+    RADAR_PIPELINE_SHED_NUM
+} radar_pipeline_shed_e;
+
+/*
+ * @typedef typedef struct  radar_pipeline_frame_s
+ * Frame descriptor passed between the stages
+ */
+typedef struct {
+    uint32_t seq;                   /*<< frame sequence number */
+    uint32_t submitted_at;          /*<< cycle counter when the frame entered the first stage */
+    uint32_t deadline;              /*<< cycle counter by which the frame has to leave the last stage */
+    radar_pipeline_shed_e shed_level; /*<< shed level when the frame was submitted */
+    float32_t *data;                /*<< de-interleaved frame, provisioned by the application */
+    void *user;                     /*<< per slot application data */
+} radar_pipeline_frame_s;
+
+/*
+ * @typedef typedef int32_t (*radar_pipeline_stage_fn)(radar_pipeline_frame_s *frame, void *ctx)
+ * Stage function prototype. Returning non-zero drops the frame, the stages
+ * after it do not see it.
+ */
+typedef int32_t (*radar_pipeline_stage_fn)(radar_pipeline_frame_s *frame, void *ctx);
+
+struct radar_pipeline_s;
+
+/*
+ * @typedef typedef struct  radar_pipeline_stage_s
+ * Stage definition, RTOS objects and counters
+ */
+typedef struct {
+    const char *name;
+    radar_pipeline_stage_fn process;
+    void *ctx;                      /*<< passed to process */
+    UBaseType_t priority;
+    uint16_t stack_size;            /*<< task stack in words */
+    bool optional;                  /*<< skipped from RADAR_PIPELINE_SHED_OPTIONAL on */
+    uint32_t budget_cycles;         /*<< cycles per frame the stage should not exceed, 0 if none */
+
+    struct radar_pipeline_s *pipeline;
+    uint32_t idx;
+    QueueHandle_t queue;            /*<< input queue, RADAR_PIPELINE_NUM_SLOTS descriptors */
+    TaskHandle_t task;
+
+    radar_dsp_stats_s stats;        /*<< cycles per frame, including preemption by other tasks */
+    uint32_t backlog_max;           /*<< largest number of frames waiting for the stage */
+    uint32_t dropped;               /*<< frames dropped by the stage */
+    uint32_t skipped;               /*<< frames passed on without processing while shedding */
+    uint32_t overruns;              /*<< frames that exceeded budget_cycles */
+} radar_pipeline_stage_s;
+
+/*
+ * @typedef typedef struct  radar_pipeline_s
+ * Pipeline state
+ */
+typedef struct radar_pipeline_s {
+    radar_pipeline_stage_s stages[RADAR_PIPELINE_STAGES_UB];
+    uint32_t num_stages;
+    bool started;
+
+    radar_pipeline_frame_s slots[RADAR_PIPELINE_NUM_SLOTS];
+    QueueHandle_t free_slots;
+    volatile uint32_t in_flight;    /*<< frames submitted and not yet released */
+    uint32_t seq;
+
+    uint32_t acquire_stalls;        /*<< acquisitions that had to wait for a free slot */
+    radar_dsp_stats_s latency;      /*<< cycles from submit to the end of the last stage */
+
+    uint32_t deadline_cycles;       /*<< cycles from submit to the deadline, 0 disables shedding */
+    volatile radar_pipeline_shed_e shed_level; /*<< written by the last stage only */
+    uint32_t deadline_misses;       /*<< delivered frames that left the last stage after their deadline */
+    uint32_t decimated;             /*<< frames dropped on submit */
+    uint32_t coalesced;             /*<< buffered frames discarded by the acquisition */
+    uint32_t level_changes;         /*<< changes of the shed level */
+
+    uint32_t window_frames;         /*<< delivered frames of the current window */
+    uint32_t window_misses;         /*<< deadline misses of the current window */
+    uint32_t window_latency_max;    /*<< worst latency of the current window */
+} radar_pipeline_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize pipeline
+ *
+ * @param[out] pipeline pipeline state
+ *
+ * @return zero (0) on success, -2 if the RTOS objects cannot be created
+ */
+int32_t radar_pipeline_init(radar_pipeline_s *pipeline);
+
+/** @brief Append a stage
+ *
+ * Stages run in the order they are added. Stages can be added by any module
+ * until the pipeline is started.
+ *
+ * @param[in,out] pipeline pipeline state
+ * @param[in] name stage and task name
+ * @param[in] process stage function
+ * @param[in] ctx context passed to the stage function
+ * @param[in] priority RTOS priority of the stage task
+ * @param[in] stack_size stack of the stage task in words
+ *
+ * @return stage index on success, -1 if the parameters are not valid or the
+ *         pipeline is started, -2 if no stage is left or the queue cannot be created
+ */
+int32_t radar_pipeline_add_stage(radar_pipeline_s *pipeline, const char *name,
+                                 radar_pipeline_stage_fn process, void *ctx,
+                                 UBaseType_t priority, uint16_t stack_size);
+
+/** @brief Set shedding options and time budget of a stage
+ *
+ * @param[in,out] pipeline pipeline state
+ * @param[in] idx stage index returned by \ref radar_pipeline_add_stage
+ * @param[in] optional true if the stage is skipped while shedding
+ * @param[in] budget_cycles cycles per frame counted as overrun when exceeded, 0 for none
+ *
+ * @return zero (0) on success, -1 if the stage does not exist
+ */
+int32_t radar_pipeline_configure_stage(radar_pipeline_s *pipeline, uint32_t idx,
+                                       bool optional, uint32_t budget_cycles);
+
+/** @brief Set the frame deadline
+ *
+ * @param[in,out] pipeline pipeline state
+ * @param[in] deadline_cycles cycles from submit by which a frame has to leave
+ *            the last stage, 0 disables deadline tracking and shedding
+ */
+void radar_pipeline_set_deadline(radar_pipeline_s *pipeline, uint32_t deadline_cycles);
+
+/** @brief Create the stage tasks
+ *
+ * @param[in,out] pipeline pipeline state
+ *
+ * @return zero (0) on success, -2 if a task cannot be created
+ */
+int32_t radar_pipeline_start(radar_pipeline_s *pipeline);
+
+/** @brief Take a free frame slot
+ *
+ * @param[in,out] pipeline pipeline state
+ * @param[in] wait ticks to wait for a slot
+ *
+ * @return frame slot or NULL if no slot became free
+ */
+radar_pipeline_frame_s* radar_pipeline_acquire(radar_pipeline_s *pipeline, TickType_t wait);
+
+/** @brief Return a frame slot that was acquired but not submitted
+ *
+ * @param[in,out] pipeline pipeline state
+ * @param[in] frame frame slot
+ */
+void radar_pipeline_release(radar_pipeline_s *pipeline, radar_pipeline_frame_s *frame);
+
+/** @brief Count buffered frames the acquisition discarded
+ *
+ * @param[in,out] pipeline pipeline state
+ * @param[in] discarded frames discarded, see \ref radar_pipeline_coalescing
+ */
+void radar_pipeline_add_coalesced(radar_pipeline_s *pipeline, uint32_t discarded);
+
+/** @brief Pass a filled frame slot to the first stage
+ *
+ * From \ref RADAR_PIPELINE_SHED_DECIMATE on, every other frame is returned
+ * to the free slots instead.
+ *
+ * @param[in,out] pipeline pipeline state
+ * @param[in] frame frame slot
+ */
+void radar_pipeline_submit(radar_pipeline_s *pipeline, radar_pipeline_frame_s *frame);
+
+/** @brief Wait until all submitted frames have passed the pipeline
+ *
+ * Used before the frame slots are re-provisioned. The caller must keep new
+ * frames from being submitted meanwhile.
+ *
+ * @param[in] pipeline pipeline state
+ */
+void radar_pipeline_drain(const radar_pipeline_s *pipeline);
+
+/** @brief Park the stage tasks
+ *
+ * Waits until all submitted frames have passed the pipeline and suspends the
+ * stage tasks. The caller must keep new frames from being submitted until
+ * \ref radar_pipeline_resume.
+ *
+ * @param[in,out] pipeline pipeline state
+ */
+void radar_pipeline_suspend(radar_pipeline_s *pipeline);
+
+/** @brief Resume the parked stage tasks
+ *
+ * The pipeline restarts without shedding, frames missed before suspending do
+ * not count against the first window.
+ *
+ * @param[in,out] pipeline pipeline state
+ */
+void radar_pipeline_resume(radar_pipeline_s *pipeline);
+
+/** @brief Check whether optional work is skipped for a frame
+ *
+ * Stages use this to leave out work such as verbose logging.
+ *
+ * @param[in] frame frame descriptor
+ *
+ * @return true if optional work is skipped
+ */
+static inline bool radar_pipeline_shed_optional(const radar_pipeline_frame_s *frame)
+{
+    return (frame->shed_level >= RADAR_PIPELINE_SHED_OPTIONAL);
+}
+
+/** @brief Check whether the acquisition coalesces its buffered frames
+ *
+ * From \ref RADAR_PIPELINE_SHED_COALESCE on, the acquisition discards all
+ * frames it buffered but the newest before it fills a slot, and reports
+ * them with \ref radar_pipeline_add_coalesced.
+ *
+ * @param[in] pipeline pipeline state
+ *
+ * @return true if only the newest buffered frame is taken
+ */
+static inline bool radar_pipeline_coalescing(const radar_pipeline_s *pipeline)
+{
+    return (pipeline->shed_level >= RADAR_PIPELINE_SHED_COALESCE);
+}
+
+#endif /* RADAR_PIPELINE_H_ */
@@ -0,0 +1,273 @@
+/*****************************************************************************
+ * File name: radar_profiles.c
+ *
+ * Description: This file implements the table of radar configuration
+ * profiles and the generation of their register lists.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#define XENSIV_BGT60TRXX_CONF_IMPL
+#include "radar_profiles.h"
+
+/*******************************************************************************
+ * Macros
+ ********************************************************************************/
+#define RX_COUNT(mask_) ((((mask_) >> 0) & 1UL) + (((mask_) >> 1) & 1UL) + (((mask_) >> 2) & 1UL) + (((mask_) >> 3) & 1UL))
+
+#define RADAR_PROFILE(name_, description_, samples_, chirps_, rx_mask_, gestures_)  \
+    {                                                                               \
+        .name = (name_),                                                            \
+        .description = (description_),                                              \
+        .num_samples_per_chirp = (samples_),                                        \
+        .num_chirps_per_frame = (chirps_),                                          \
+        .rx_mask = (rx_mask_),                                                      \
+        .num_rx_antennas = RX_COUNT(rx_mask_),                                      \
+        .num_samples_per_frame = ((samples_) * (chirps_) * RX_COUNT(rx_mask_)),     \
+        .gestures_compatible = (gestures_)                                          \
+    }
+
+#define NUMBER_OF_PROFILES (sizeof(profile_table) / sizeof(profile_table[0]))
+
+/*******************************************************************************
+ * Variables
+ ********************************************************************************/
+
+/* First entry is the default profile and must match radar_settings.h */
+static const radar_profile_s profile_table[] =
+{
+    RADAR_PROFILE(RADAR_PROFILE_NAME_DEFAULT, "full resolution, gesture detection",
+                  XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP,
+                  XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME,
+                  RADAR_PROFILE_RX_MASK_ALL,
+                  true),
+    RADAR_PROFILE("balanced", "full range resolution, half Doppler resolution",
+                  XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP,
+                  XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME / 2,
+                  RADAR_PROFILE_RX_MASK_ALL,
+                  false),
+    RADAR_PROFILE("coarse", "half range and Doppler resolution, lowest load",
+                  XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP / 2,
+                  XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME / 2,
+                  RADAR_PROFILE_RX_MASK_ALL,
+                  false),
+    RADAR_PROFILE("single", "full resolution on RX3 only, coarse gestures",
+                  XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP,
+                  XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME,
+                  RADAR_PROFILE_RX_MASK_RX3,
+                  false),
+    RADAR_PROFILE("presence", "RX3 only, half Doppler resolution, presence detection",
+                  XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP,
+                  XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME / 2,
+                  RADAR_PROFILE_RX_MASK_RX3,
+                  false)
+};
+
+static const radar_profile_s *active_profile = &profile_table[0];
+
+static radar_dsp_stats_s profile_stats[NUMBER_OF_PROFILES];
+
+/*******************************************************************************
+ * Function Name: patch_register
+ ********************************************************************************
+ * Summary:
+ *   Replaces a field in the register list entry of the given register address
+ *
+ * Parameters:
+ *   regs: register list
+ *   num_regs: number of entries in register list
+ *   addr: register address
+ *   mask: field mask
+ *   pos: field position
+ *   value: new field value
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void patch_register(uint32_t *regs, uint32_t num_regs, uint32_t addr,
+        uint32_t mask, uint32_t pos, uint32_t value)
+{
+    for (uint32_t i = 0; i < num_regs; ++i)
+    {
+        if ((regs[i] >> RADAR_PROFILE_REG_ADDR_POS) == addr)
+        {
+            regs[i] = (regs[i] & ~mask) | ((value << pos) & mask);
+            return;
+        }
+    }
+}
+
+/*
+ * number of profiles
+ */
+uint32_t radar_profile_count(void)
+{
+    return NUMBER_OF_PROFILES;
+}
+
+/*
+ * profile by index
+ */
+const radar_profile_s* radar_profile_get(uint32_t idx)
+{
+    if (idx >= NUMBER_OF_PROFILES)
+    {
+        return NULL;
+    }
+
+    return &profile_table[idx];
+}
+
+/*
+ * profile by name
+ */
+const radar_profile_s* radar_profile_find(const char *name)
+{
+    for (uint32_t i = 0; i < NUMBER_OF_PROFILES; ++i)
+    {
+        if (strcmp(profile_table[i].name, name) == 0)
+        {
+            return &profile_table[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * active profile
+ */
+const radar_profile_s* radar_profile_get_active(void)
+{
+    return active_profile;
+}
+
+/*
+ * set active profile
+ */
+void radar_profile_set_active(const radar_profile_s *profile)
+{
+    if (NULL != profile)
+    {
+        active_profile = profile;
+    }
+}
+
+/*
+ * generate register list of a profile from base configuration
+ */
+uint32_t radar_profile_generate_registers(const radar_profile_s *profile, uint32_t *regs)
+{
+    memcpy(regs, register_list, sizeof(register_list));
+
+    /* number of ADC samples per chirp */
+    patch_register(regs, XENSIV_BGT60TRXX_CONF_NUM_REGS, RADAR_PROFILE_REG_PLL1_3,
+            RADAR_PROFILE_PLL1_3_NUM_SAMPLES_MSK, RADAR_PROFILE_PLL1_3_NUM_SAMPLES_POS,
+            profile->num_samples_per_chirp);
+
+    /* number of chirps per frame, programmed as length - 1 */
+    patch_register(regs, XENSIV_BGT60TRXX_CONF_NUM_REGS, RADAR_PROFILE_REG_CCR2,
+            RADAR_PROFILE_CCR2_FRAME_LEN_MSK, RADAR_PROFILE_CCR2_FRAME_LEN_POS,
+            profile->num_chirps_per_frame - 1U);
+
+    /* baseband channels sampled into the FIFO, one per enabled antenna */
+    patch_register(regs, XENSIV_BGT60TRXX_CONF_NUM_REGS, RADAR_PROFILE_REG_CSD1_2,
+            RADAR_PROFILE_CSD1_2_BBCH_SEL_MSK, RADAR_PROFILE_CSD1_2_BBCH_SEL_POS,
+            profile->rx_mask);
+
+    return XENSIV_BGT60TRXX_CONF_NUM_REGS;
+}
+
+/*
+ * SPI payload bytes per frame
+ */
+uint32_t radar_profile_spi_bytes_per_frame(const radar_profile_s *profile)
+{
+    return ((profile->num_samples_per_frame + 1U) / 2U) * RADAR_PROFILE_SPI_BYTES_PER_2_SAMPLES;
+}
+
+/*
+ * acquisition cycle statistics of a profile
+ */
+radar_dsp_stats_s* radar_profile_get_stats(const radar_profile_s *profile)
+{
+    return &profile_stats[profile - profile_table];
+}
+
+/*
+ * range covered by one range FFT bin
+ */
+float radar_profile_range_resolution(const radar_profile_s *profile)
+{
+    const float bandwidth = (float)(XENSIV_BGT60TRXX_CONF_END_FREQ_HZ - XENSIV_BGT60TRXX_CONF_START_FREQ_HZ);
+    const float sample_rate = (float)XENSIV_BGT60TRXX_CONF_SAMPLE_RATE;
+
+    /* chirp slope in Hz/s and beat frequency spacing of the range FFT bins */
+    float slope = (bandwidth * sample_rate) / (float)XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP;
+    float bin_hz = sample_rate / (float)profile->num_samples_per_chirp;
+
+    return (RADAR_PROFILE_SPEED_OF_LIGHT * bin_hz) / (2.0f * slope);
+}
+
+/*
+ * range FFT bins of a range gate
+ */
+int32_t radar_profile_range_gate_bins(const radar_profile_s *profile, uint32_t min_cm, uint32_t max_cm,
+        uint32_t *first_bin, uint32_t *num_bins)
+{
+    const uint32_t range_bins = profile->num_samples_per_chirp / 2U;
+    float resolution_cm = radar_profile_range_resolution(profile) * 100.0f;
+    uint32_t first;
+    uint32_t last;
+
+    if (min_cm > max_cm)
+    {
+        return -1;
+    }
+
+    first = (uint32_t)ceilf((float)min_cm / resolution_cm);
+    last = (uint32_t)floorf((float)max_cm / resolution_cm);
+
+    if (first >= range_bins)
+    {
+        return -1;
+    }
+
+    if (last < first)
+    {
+        /* gate narrower than a bin: take the bin nearest to its center */
+        first = (uint32_t)((((float)(min_cm + max_cm) * 0.5f) / resolution_cm) + 0.5f);
+        first = (first < range_bins) ? first : (range_bins - 1U);
+        last = first;
+    }
+
+    if (last >= range_bins)
+    {
+        last = range_bins - 1U;
+    }
+
+    *first_bin = first;
+    *num_bins = last - first + 1U;
+
+    return 0;
+}
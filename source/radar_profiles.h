@@ -0,0 +1,206 @@
+/******************************************************************************
+** File name: radar_profiles.h
+**
+** Description: This file contains the radar configuration profile table
+**   interface. A profile bundles a register list for the radar device with the
+**   frame geometry derived from it, so the acquisition and processing buffers
+**   can be re-provisioned at runtime.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_PROFILES_H_
+#define RADAR_PROFILES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "radar_settings.h"
+#include "radar_dsp.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/* Number of frames the radar data manager buffers for every profile */
+#define RADAR_PROFILE_RDM_FRAMES                (6)
+
+/* Largest frame geometry in the profile table. The default configuration from
+ * radar_settings.h is the largest one, every other profile is reduced from it. */
+#define RADAR_PROFILE_MAX_SAMPLES_PER_CHIRP     XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP
+#define RADAR_PROFILE_MAX_CHIRPS_PER_FRAME      XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME
+#define RADAR_PROFILE_MAX_RX_ANTENNAS           XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS
+#define RADAR_PROFILE_MAX_SAMPLES_PER_FRAME     (RADAR_PROFILE_MAX_SAMPLES_PER_CHIRP *\
+                                                 RADAR_PROFILE_MAX_CHIRPS_PER_FRAME *\
+                                                 RADAR_PROFILE_MAX_RX_ANTENNAS)
+
+#define RADAR_PROFILE_NAME_DEFAULT              ("gestures")
+
+/* Receive antennas enabled by the base configuration, bit n selects RX(n+1) */
+#define RADAR_PROFILE_RX_MASK_ALL               ((1UL << XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS) - 1UL)
+#define RADAR_PROFILE_RX_MASK_RX3               (0x4UL)
+
+/* SPI bytes of two samples read from the sensor FIFO, which packs 12-bit samples */
+#define RADAR_PROFILE_SPI_BYTES_PER_2_SAMPLES   (3U)
+
+/* Default range gate. Gestures are performed between 20 cm and 1 m from the
+ * sensor, the gate leaves some margin around that interval. */
+#define RADAR_PROFILE_RANGE_GATE_MIN_CM_DEFAULT (10U)
+#define RADAR_PROFILE_RANGE_GATE_MAX_CM_DEFAULT (100U)
+
+#define RADAR_PROFILE_SPEED_OF_LIGHT            (299792458.0f)
+
+/* Register list word layout: 7-bit address, write bit, 24-bit data */
+#define RADAR_PROFILE_REG_ADDR_POS              (25U)
+#define RADAR_PROFILE_REG_DATA_MSK              (0x00FFFFFFUL)
+
+/* Register fields patched when a profile register list is generated from the
+ * base configuration (BGT60TR13C register map) */
+#define RADAR_PROFILE_REG_CCR2                  (0x2EUL)
+#define RADAR_PROFILE_CCR2_FRAME_LEN_POS        (12U)
+#define RADAR_PROFILE_CCR2_FRAME_LEN_MSK        (0x3FUL << RADAR_PROFILE_CCR2_FRAME_LEN_POS)
+#define RADAR_PROFILE_REG_PLL1_3                (0x33UL)
+#define RADAR_PROFILE_PLL1_3_NUM_SAMPLES_POS    (0U)
+#define RADAR_PROFILE_PLL1_3_NUM_SAMPLES_MSK    (0xFFFUL << RADAR_PROFILE_PLL1_3_NUM_SAMPLES_POS)
+#define RADAR_PROFILE_REG_CSD1_2                (0x11UL)
+#define RADAR_PROFILE_CSD1_2_BBCH_SEL_POS       (20U)
+#define RADAR_PROFILE_CSD1_2_BBCH_SEL_MSK       (0xFUL << RADAR_PROFILE_CSD1_2_BBCH_SEL_POS)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_profile_s
+ * Radar configuration profile: name, frame geometry and derived sizes
+ */
+typedef struct {
+    const char *name;                   /*<< name used to select the profile from CLI */
+    const char *description;            /*<< one line description printed by the CLI */
+    uint32_t num_samples_per_chirp;     /*<< ADC samples per chirp */
+    uint32_t num_chirps_per_frame;      /*<< chirps per frame */
+    uint32_t rx_mask;                   /*<< enabled receive antennas, bit n selects RX(n+1) */
+    uint32_t num_rx_antennas;           /*<< derived: enabled receive antennas */
+    uint32_t num_samples_per_frame;     /*<< derived: samples per chirp * chirps * antennas */
+    bool gestures_compatible;           /*<< frame geometry matches the one the gestures library is trained on */
+} radar_profile_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Get number of entries in the profile table
+ *
+ * @return number of profiles
+ */
+uint32_t radar_profile_count(void);
+
+/** @brief Get profile by index
+ *
+ * @param[in] idx index into the profile table
+ *
+ * @return pointer to the profile or NULL if the index is out of range
+ */
+const radar_profile_s* radar_profile_get(uint32_t idx);
+
+/** @brief Find profile by name
+ *
+ * @param[in] name profile name
+ *
+ * @return pointer to the profile or NULL if no profile has this name
+ */
+const radar_profile_s* radar_profile_find(const char *name);
+
+/** @brief Get active profile
+ *
+ * @return pointer to the profile the radar and buffers are currently configured for
+ */
+const radar_profile_s* radar_profile_get_active(void);
+
+/** @brief Mark a profile as the active one
+ *
+ * @note This only updates the bookkeeping. Reprogramming the device and
+ *       re-provisioning of the buffers is done by the application.
+ *
+ * @param[in] profile profile from the table
+ */
+void radar_profile_set_active(const radar_profile_s *profile);
+
+/** @brief Generate register list for a profile
+ *
+ * The register list is generated from the base configuration in radar_settings.h
+ * by patching the number of samples per chirp, chirps per frame and the
+ * baseband channels sampled into the FIFO.
+ *
+ * @param[in] profile profile from the table
+ * @param[out] regs register list, XENSIV_BGT60TRXX_CONF_NUM_REGS entries
+ *
+ * @return number of registers written to regs
+ */
+uint32_t radar_profile_generate_registers(const radar_profile_s *profile, uint32_t *regs);
+
+/** @brief Get bytes read from the sensor FIFO per frame
+ *
+ * @param[in] profile profile from the table
+ *
+ * @return SPI payload bytes per frame
+ */
+uint32_t radar_profile_spi_bytes_per_frame(const radar_profile_s *profile);
+
+/** @brief Get acquisition cycle statistics of a profile
+ *
+ * Cycles the CM4 spends per frame on reading the sensor FIFO and
+ * de-interleaving the frame, collected while the profile is active.
+ *
+ * @param[in] profile profile from the table
+ *
+ * @return statistics of the profile
+ */
+radar_dsp_stats_s* radar_profile_get_stats(const radar_profile_s *profile);
+
+/** @brief Get range covered by one range FFT bin
+ *
+ * The chirp slope follows from the bandwidth between START_FREQ_HZ and END_FREQ_HZ,
+ * which is swept while the base configuration samples a chirp. A profile sampling
+ * fewer samples per chirp covers a smaller part of the sweep, so its bins are wider.
+ *
+ * @param[in] profile profile from the table
+ *
+ * @return range resolution in meters
+ */
+float radar_profile_range_resolution(const radar_profile_s *profile);
+
+/** @brief Convert a range gate to range FFT bins
+ *
+ * Bins whose range lies within the gate are selected, at least one bin is
+ * selected if the gate is narrower than a bin. Bins beyond the last range
+ * bin of the profile are dropped.
+ *
+ * @param[in] profile profile from the table
+ * @param[in] min_cm near end of the gate in centimeters
+ * @param[in] max_cm far end of the gate in centimeters
+ * @param[out] first_bin first range bin inside the gate
+ * @param[out] num_bins number of range bins inside the gate
+ *
+ * @return zero (0) on success, -1 if the gate is empty or starts beyond the last range bin
+ */
+int32_t radar_profile_range_gate_bins(const radar_profile_s *profile, uint32_t min_cm, uint32_t max_cm,
+        uint32_t *first_bin, uint32_t *num_bins);
+
+#endif /* RADAR_PROFILES_H_ */
@@ -0,0 +1,434 @@
+/*****************************************************************************
+ * File name: radar_range_doppler.c
+ *
+ * Description: This file implements the streaming range-Doppler stage on
+ * top of the range FFT stage.
+ *
+ * The ring holds the coherent antenna sum of the range spectra of the last
+ * num_chirps chirps, ordered oldest first from ring_pos. The map is the
+ * Hann weighted Doppler spectrum of the ring, with the window applied in the
+ * frequency domain (0.5 X[k] - 0.25 (X[k-1] + X[k+1])) so both update
+ * strategies produce the same result.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "radar_range_doppler.h"
+
+/*******************************************************************************
+ * Macros
+ ********************************************************************************/
+
+/* Sliding DFT state holds one extra bin on each side for the Hann kernel */
+#define STATE_BINS(rd)      ((rd)->num_doppler_bins + 2U)
+
+/*******************************************************************************
+ * Function Name: state_bin_to_fft_bin
+ ********************************************************************************
+ * Summary:
+ *   Maps a sliding DFT state index to the Doppler FFT bin, state index 1
+ *   is the most negative velocity bin of the map
+ *
+ * Parameters:
+ *   rd: stage state
+ *   j: state index
+ *
+ * Return:
+ *   FFT bin index
+ *******************************************************************************/
+static uint32_t state_bin_to_fft_bin(const radar_range_doppler_s *rd, uint32_t j)
+{
+    return (j + rd->num_chirps - 1U - (rd->num_doppler_bins / 2U)) % rd->num_chirps;
+}
+
+/*******************************************************************************
+ * Function Name: doppler_bins_from_ring
+ ********************************************************************************
+ * Summary:
+ *   Computes the Doppler bins of the state of one range bin from the ring
+ *
+ * Parameters:
+ *   rd: stage state
+ *   range_bin: range bin index
+ *   out: STATE_BINS complex values
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void doppler_bins_from_ring(radar_range_doppler_s *rd, uint32_t range_bin, float32_t *out)
+{
+    const uint32_t w = rd->num_chirps;
+
+    /* gather the slow time column, oldest chirp first */
+    for (uint32_t m = 0; m < w; ++m)
+    {
+        const float32_t *src = &rd->ring[((((rd->ring_pos + m) % w) * rd->num_range_bins) + range_bin) * 2U];
+        rd->column[2U * m] = src[0];
+        rd->column[(2U * m) + 1U] = src[1];
+    }
+
+#ifdef RADAR_DSP_REFERENCE
+    for (uint32_t j = 0; j < STATE_BINS(rd); ++j)
+    {
+        uint32_t k = state_bin_to_fft_bin(rd, j);
+        float32_t re = 0.0f;
+        float32_t im = 0.0f;
+
+        for (uint32_t m = 0; m < w; ++m)
+        {
+            float32_t phi = (2.0f * RADAR_DSP_PI * (float32_t)((k * m) % w)) / (float32_t)w;
+            float32_t c = cosf(phi);
+            float32_t s = sinf(phi);
+            re += (rd->column[2U * m] * c) + (rd->column[(2U * m) + 1U] * s);
+            im += (rd->column[(2U * m) + 1U] * c) - (rd->column[2U * m] * s);
+        }
+
+        out[2U * j] = re;
+        out[(2U * j) + 1U] = im;
+    }
+#else
+    arm_cfft_f32(&rd->cfft, rd->column, 0, 1);
+
+    for (uint32_t j = 0; j < STATE_BINS(rd); ++j)
+    {
+        uint32_t k = state_bin_to_fft_bin(rd, j);
+        out[2U * j] = rd->column[2U * k];
+        out[(2U * j) + 1U] = rd->column[(2U * k) + 1U];
+    }
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: resync_sliding_state
+ ********************************************************************************
+ * Summary:
+ *   Recomputes the sliding DFT state of all range bins from the ring
+ *
+ * Parameters:
+ *   rd: stage state
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void resync_sliding_state(radar_range_doppler_s *rd)
+{
+    for (uint32_t r = 0; r < rd->num_range_bins; ++r)
+    {
+        doppler_bins_from_ring(rd, r, &rd->sliding[r * STATE_BINS(rd) * 2U]);
+    }
+
+    rd->frames_since_resync = 0;
+}
+
+/*******************************************************************************
+ * Function Name: push_chirp
+ ********************************************************************************
+ * Summary:
+ *   Adds the antenna sum of one chirp to the ring. In sliding mode the
+ *   Doppler bins are updated with X[k] = (X[k] + x_new - x_old) * exp(+j2*pi*k/W)
+ *
+ * Parameters:
+ *   rd: stage state
+ *   fft: range FFT stage
+ *   chirp: chirp index within the frame
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void push_chirp(radar_range_doppler_s *rd, const radar_range_fft_s *fft, uint32_t chirp)
+{
+    float32_t *slot = &rd->ring[rd->ring_pos * rd->num_range_bins * 2U];
+
+    for (uint32_t r = 0; r < rd->num_range_bins; ++r)
+    {
+        float32_t re = 0.0f;
+        float32_t im = 0.0f;
+
+        for (uint32_t antenna = 0; antenna < fft->num_rx_antennas; ++antenna)
+        {
+            const float32_t *spectrum = radar_range_fft_get_chirp(fft, antenna, chirp);
+            re += spectrum[2U * r];
+            im += spectrum[(2U * r) + 1U];
+        }
+
+        if (rd->mode == RANGE_DOPPLER_MODE_SLIDING)
+        {
+            float32_t d_re = re - slot[2U * r];
+            float32_t d_im = im - slot[(2U * r) + 1U];
+            float32_t *state = &rd->sliding[r * STATE_BINS(rd) * 2U];
+
+            for (uint32_t j = 0; j < STATE_BINS(rd); ++j)
+            {
+                float32_t s_re = state[2U * j] + d_re;
+                float32_t s_im = state[(2U * j) + 1U] + d_im;
+                float32_t t_re = rd->twiddle[2U * j];
+                float32_t t_im = rd->twiddle[(2U * j) + 1U];
+
+                state[2U * j] = (s_re * t_re) - (s_im * t_im);
+                state[(2U * j) + 1U] = (s_re * t_im) + (s_im * t_re);
+            }
+        }
+
+        slot[2U * r] = re;
+        slot[(2U * r) + 1U] = im;
+    }
+
+    rd->ring_pos = (rd->ring_pos + 1U) % rd->num_chirps;
+}
+
+/*******************************************************************************
+ * Function Name: state_to_map
+ ********************************************************************************
+ * Summary:
+ *   Applies the Hann kernel to the Doppler bins of one range bin and stores
+ *   their magnitudes in the map
+ *
+ * Parameters:
+ *   rd: stage state
+ *   range_bin: range bin index
+ *   state: STATE_BINS complex values
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void state_to_map(radar_range_doppler_s *rd, uint32_t range_bin, const float32_t *state)
+{
+    float32_t *row = &rd->map[range_bin * rd->num_doppler_bins];
+
+    for (uint32_t d = 0; d < rd->num_doppler_bins; ++d)
+    {
+        const float32_t *x = &state[2U * d];
+        float32_t re = (0.5f * x[2]) - (0.25f * (x[0] + x[4]));
+        float32_t im = (0.5f * x[3]) - (0.25f * (x[1] + x[5]));
+
+        row[d] = sqrtf((re * re) + (im * im));
+    }
+}
+
+/*******************************************************************************
+ * Function Name: apply_range_gate
+ ********************************************************************************
+ * Summary:
+ *   Takes over the range gate of the range FFT stage. The ring holds chirps
+ *   of other range bins afterwards, so the Doppler history is cleared.
+ *   Cycle statistics restart to reflect the new gate.
+ *
+ * Parameters:
+ *   rd: stage state
+ *   fft: range FFT stage
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void apply_range_gate(radar_range_doppler_s *rd, const radar_range_fft_s *fft)
+{
+    rd->first_range_bin = fft->first_bin;
+    rd->num_range_bins = (fft->num_gated_bins < rd->max_range_bins) ? fft->num_gated_bins : rd->max_range_bins;
+    rd->ring_pos = 0;
+    rd->frames_since_resync = 0;
+
+    memset(rd->ring, 0, 2U * rd->num_chirps * rd->max_range_bins * sizeof(float32_t));
+    memset(rd->sliding, 0, 2U * STATE_BINS(rd) * rd->max_range_bins * sizeof(float32_t));
+    memset(rd->map, 0, rd->num_doppler_bins * rd->max_range_bins * sizeof(float32_t));
+    memset(rd->stats, 0, sizeof(rd->stats));
+}
+
+/*
+ * Initialize range-Doppler stage
+ */
+int32_t radar_range_doppler_init(radar_range_doppler_s *rd,
+                                 uint32_t num_chirps,
+                                 uint32_t max_range_bins,
+                                 void* (*alloc_func)(size_t size))
+{
+    if ((NULL == rd) || (NULL == alloc_func) || (num_chirps < 4U) ||
+        ((num_chirps & (num_chirps - 1U)) != 0U) || (0U == max_range_bins))
+    {
+        return -1;
+    }
+
+    /* subscriptions and mode survive re-provisioning for another frame geometry */
+    cb_range_doppler_event subscriptions[RANGE_DOPPLER_SUBSCRIPTION_UB + 1];
+    radar_range_doppler_mode_e mode = (rd->mode < RANGE_DOPPLER_MODE_NUM) ? rd->mode : RANGE_DOPPLER_MODE_RECOMPUTE;
+    memcpy(subscriptions, rd->subscriptions, sizeof(subscriptions));
+
+    memset(rd, 0, sizeof(radar_range_doppler_s));
+
+    memcpy(rd->subscriptions, subscriptions, sizeof(subscriptions));
+    rd->mode = mode;
+    rd->requested_mode = mode;
+    rd->num_chirps = num_chirps;
+    rd->max_range_bins = max_range_bins;
+    rd->num_range_bins = max_range_bins;
+    rd->num_doppler_bins = (num_chirps < RANGE_DOPPLER_NUM_DOPPLER_BINS_UB) ? num_chirps : RANGE_DOPPLER_NUM_DOPPLER_BINS_UB;
+
+#ifndef RADAR_DSP_REFERENCE
+    if (arm_cfft_init_f32(&rd->cfft, (uint16_t)num_chirps) != ARM_MATH_SUCCESS)
+    {
+        return -1;
+    }
+#endif
+
+    rd->ring = (float32_t*)alloc_func(2U * num_chirps * max_range_bins * sizeof(float32_t));
+    rd->sliding = (float32_t*)alloc_func(2U * STATE_BINS(rd) * max_range_bins * sizeof(float32_t));
+    rd->twiddle = (float32_t*)alloc_func(2U * STATE_BINS(rd) * sizeof(float32_t));
+    rd->column = (float32_t*)alloc_func(2U * num_chirps * sizeof(float32_t));
+    rd->map = (float32_t*)alloc_func(rd->num_doppler_bins * max_range_bins * sizeof(float32_t));
+
+    if ((NULL == rd->ring) || (NULL == rd->sliding) || (NULL == rd->twiddle) ||
+        (NULL == rd->column) || (NULL == rd->map))
+    {
+        return -2;
+    }
+
+    memset(rd->ring, 0, 2U * num_chirps * max_range_bins * sizeof(float32_t));
+    memset(rd->sliding, 0, 2U * STATE_BINS(rd) * max_range_bins * sizeof(float32_t));
+    memset(rd->map, 0, rd->num_doppler_bins * max_range_bins * sizeof(float32_t));
+
+    for (uint32_t j = 0; j < STATE_BINS(rd); ++j)
+    {
+        float32_t phi = (2.0f * RADAR_DSP_PI * (float32_t)state_bin_to_fft_bin(rd, j)) / (float32_t)num_chirps;
+        rd->twiddle[2U * j] = cosf(phi);
+        rd->twiddle[(2U * j) + 1U] = sinf(phi);
+    }
+
+    return 0;
+}
+
+/*
+ * Select update strategy
+ */
+void radar_range_doppler_set_mode(radar_range_doppler_s *rd, radar_range_doppler_mode_e mode)
+{
+    if (mode < RANGE_DOPPLER_MODE_NUM)
+    {
+        rd->requested_mode = mode;
+    }
+}
+
+/*
+ * Run range-Doppler stage on one frame
+ */
+void radar_range_doppler_run(radar_range_doppler_s *rd, const radar_range_fft_s *fft)
+{
+    uint32_t chirps = (fft->num_chirps_per_frame < rd->num_chirps) ? fft->num_chirps_per_frame : rd->num_chirps;
+    uint32_t cycles;
+
+    if ((fft->first_bin != rd->first_range_bin) || (fft->num_gated_bins != rd->num_range_bins))
+    {
+        apply_range_gate(rd, fft);
+    }
+
+    if (rd->requested_mode != rd->mode)
+    {
+        rd->mode = rd->requested_mode;
+
+        if (rd->mode == RANGE_DOPPLER_MODE_SLIDING)
+        {
+            resync_sliding_state(rd);
+        }
+    }
+
+    cycles = radar_dsp_cycles();
+
+    for (uint32_t chirp = 0; chirp < chirps; ++chirp)
+    {
+        push_chirp(rd, fft, chirp);
+    }
+
+    if (rd->mode == RANGE_DOPPLER_MODE_SLIDING)
+    {
+        if (++rd->frames_since_resync >= RANGE_DOPPLER_RESYNC_FRAMES)
+        {
+            resync_sliding_state(rd);
+        }
+
+        for (uint32_t r = 0; r < rd->num_range_bins; ++r)
+        {
+            state_to_map(rd, r, &rd->sliding[r * STATE_BINS(rd) * 2U]);
+        }
+    }
+    else
+    {
+        /* the sliding state doubles as scratch for the extracted bins */
+        for (uint32_t r = 0; r < rd->num_range_bins; ++r)
+        {
+            doppler_bins_from_ring(rd, r, rd->sliding);
+            state_to_map(rd, r, rd->sliding);
+        }
+    }
+
+    cycles = radar_dsp_cycles() - cycles;
+
+    radar_dsp_stats_add(&rd->stats[rd->mode], cycles);
+
+    for (uint32_t sub = 1; sub <= RANGE_DOPPLER_SUBSCRIPTION_UB; sub++)
+    {
+        if (NULL != rd->subscriptions[sub])
+        {
+            rd->subscriptions[sub](rd);
+        }
+    }
+}
+
+/*
+ * subscribe to range-Doppler maps
+ */
+int32_t radar_range_doppler_subscribe(radar_range_doppler_s *rd, cb_range_doppler_event call_back)
+{
+    if ((NULL == rd) || (NULL == call_back))
+    {
+        return -1;
+    }
+
+    for (uint32_t sub = 1; sub <= RANGE_DOPPLER_SUBSCRIPTION_UB; sub++)
+    {
+        if (rd->subscriptions[sub] == call_back)
+        {
+            return (int32_t)sub;
+        }
+    }
+
+    for (uint32_t sub = 1; sub <= RANGE_DOPPLER_SUBSCRIPTION_UB; sub++)
+    {
+        if (NULL == rd->subscriptions[sub])
+        {
+            rd->subscriptions[sub] = call_back;
+            return (int32_t)sub;
+        }
+    }
+
+    return -2;
+}
+
+/*
+ * un-subscribe from range-Doppler maps
+ */
+void radar_range_doppler_unsubscribe(radar_range_doppler_s *rd, int32_t subscription_id)
+{
+    if ((NULL == rd) || (subscription_id <= 0) || (subscription_id > RANGE_DOPPLER_SUBSCRIPTION_UB))
+    {
+        return;
+    }
+
+    rd->subscriptions[subscription_id] = NULL;
+}
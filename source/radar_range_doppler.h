@@ -0,0 +1,192 @@
+/******************************************************************************
+** File name: radar_range_doppler.h
+**
+** Description: This file contains the interface of the streaming
+**   range-Doppler stage. The stage keeps a ring of the range spectra of the
+**   last chirps and derives a range-Doppler map from it, either by updating
+**   the Doppler bins with a sliding DFT for every chirp or by recomputing
+**   the Doppler FFT once per frame. Maps are delivered to subscribers.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_RANGE_DOPPLER_H_
+#define RADAR_RANGE_DOPPLER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "radar_dsp.h"
+#include "radar_range_fft.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RANGE_DOPPLER_SUBSCRIPTION_UB
+ * Maximum supported map subscriptions
+ */
+#define RANGE_DOPPLER_SUBSCRIPTION_UB       (4)
+
+/*
+ * @def RANGE_DOPPLER_NUM_DOPPLER_BINS_UB
+ * Doppler bins around zero velocity kept in the map. Hand gestures occupy
+ * the low velocity bins, limiting them bounds the sliding DFT cost.
+ */
+#define RANGE_DOPPLER_NUM_DOPPLER_BINS_UB   (16U)
+
+/*
+ * @def RANGE_DOPPLER_RESYNC_FRAMES
+ * Frames after which the sliding DFT state is recomputed from the ring
+ * to remove accumulated rounding errors
+ */
+#define RANGE_DOPPLER_RESYNC_FRAMES         (64U)
+
+/*
+ * @def RADAR_RANGE_DOPPLER_MEM_SIZE
+ * Bytes the stage allocates: ring, sliding DFT state, twiddles, FFT column and map
+ */
+#define RADAR_RANGE_DOPPLER_MEM_SIZE(chirps, range_bins, doppler_bins) \
+    (((2U * (chirps) * (range_bins)) + (2U * ((doppler_bins) + 2U) * (range_bins)) + \
+      (2U * ((doppler_bins) + 2U)) + (2U * (chirps)) + ((doppler_bins) * (range_bins))) * sizeof(float32_t))
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_range_doppler_mode_e
+ * Strategy used to derive the Doppler bins
+ */
+typedef enum
+{
+    RANGE_DOPPLER_MODE_RECOMPUTE = 0, /*<< Doppler FFT over the ring once per frame */
+    RANGE_DOPPLER_MODE_SLIDING = 1,   /*<< sliding DFT update of the map bins for every chirp */
+    RANGE_DOPPLER_MODE_NUM
+} radar_range_doppler_mode_e;
+
+struct radar_range_doppler_s;
+
+/*
+ * @typedef typedef void (*cb_range_doppler_event)(const struct radar_range_doppler_s *rd)
+ * Map subscriber callback prototype, called from the processing task once a map is complete
+ */
+typedef void (*cb_range_doppler_event)(const struct radar_range_doppler_s *rd);
+
+/*
+ * @typedef typedef struct  radar_range_doppler_s
+ * Range-Doppler stage state
+ */
+typedef struct radar_range_doppler_s {
+    uint32_t num_chirps;            /*<< Doppler window, chirps per frame */
+    uint32_t max_range_bins;        /*<< range bins the buffers are sized for */
+    uint32_t num_range_bins;        /*<< range bins inside the range gate */
+    uint32_t first_range_bin;       /*<< range bin of map row 0 */
+    uint32_t num_doppler_bins;      /*<< Doppler bins in the map, centered at zero velocity */
+    radar_range_doppler_mode_e mode;
+    volatile radar_range_doppler_mode_e requested_mode; /*<< applied at the start of the next frame */
+
+    float32_t *ring;                /*<< [chirp][range bin] complex antenna sum, oldest at ring_pos */
+    uint32_t ring_pos;
+    float32_t *sliding;             /*<< [range bin][doppler bin + 2] complex sliding DFT state */
+    float32_t *twiddle;             /*<< [doppler bin + 2] complex exp(+j2*pi*k/num_chirps) */
+    float32_t *column;              /*<< num_chirps complex, Doppler FFT input */
+    float32_t *map;                 /*<< [range bin][doppler bin] magnitude, Hann weighted */
+    uint32_t frames_since_resync;
+
+    radar_dsp_stats_s stats[RANGE_DOPPLER_MODE_NUM]; /*<< cycles per frame of each strategy since the gate was set */
+    cb_range_doppler_event subscriptions[RANGE_DOPPLER_SUBSCRIPTION_UB + 1];
+
+#ifndef RADAR_DSP_REFERENCE
+    arm_cfft_instance_f32 cfft;
+#endif
+} radar_range_doppler_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize range-Doppler stage
+ *
+ * Subscriptions and the update strategy are kept when the stage is
+ * re-initialized for another frame geometry. The stage follows the range
+ * gate of the range FFT stage, a gate change restarts the Doppler history.
+ *
+ * @param[in,out] rd stage state
+ * @param[in] num_chirps chirps per frame, power of two supported by the CMSIS tables linked in
+ * @param[in] max_range_bins range bins per chirp with an open range gate
+ * @param[in] alloc_func allocator returning memory aligned to at least 8 bytes
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid, -2 if allocation fails
+ */
+int32_t radar_range_doppler_init(radar_range_doppler_s *rd,
+                                 uint32_t num_chirps,
+                                 uint32_t max_range_bins,
+                                 void* (*alloc_func)(size_t size));
+
+/** @brief Select update strategy
+ *
+ * The strategy takes effect with the next frame, so it can be selected from
+ * another task. Switching to the sliding DFT resynchronizes its state from the ring.
+ *
+ * @param[in,out] rd stage state
+ * @param[in] mode update strategy
+ */
+void radar_range_doppler_set_mode(radar_range_doppler_s *rd, radar_range_doppler_mode_e mode);
+
+/** @brief Run range-Doppler stage on the chirps of one frame and notify subscribers
+ *
+ * @param[in,out] rd stage state
+ * @param[in] fft range FFT stage holding the spectra of the frame
+ */
+void radar_range_doppler_run(radar_range_doppler_s *rd, const radar_range_fft_s *fft);
+
+/** @brief Subscribe to range-Doppler maps
+ *
+ * @param[in,out] rd stage state
+ * @param[in] call_back callback called with the stage state once per frame
+ *
+ * @return subscription id from 1 to \ref RANGE_DOPPLER_SUBSCRIPTION_UB, the existing id
+ *         if the callback is subscribed already, -1 if the parameters are not valid,
+ *         -2 if no subscription is left
+ */
+int32_t radar_range_doppler_subscribe(radar_range_doppler_s *rd, cb_range_doppler_event call_back);
+
+/** @brief Un-subscribe from range-Doppler maps
+ *
+ * @param[in,out] rd stage state
+ * @param[in] subscription_id id returned by \ref radar_range_doppler_subscribe
+ */
+void radar_range_doppler_unsubscribe(radar_range_doppler_s *rd, int32_t subscription_id);
+
+/** @brief Get map row of one range bin
+ *
+ * @param[in] rd stage state
+ * @param[in] range_bin range bin index relative to first_range_bin
+ *
+ * @return pointer to num_doppler_bins magnitudes, from negative to positive velocity
+ */
+static inline const float32_t* radar_range_doppler_get_row(const radar_range_doppler_s *rd,
+        uint32_t range_bin)
+{
+    return &rd->map[range_bin * rd->num_doppler_bins];
+}
+
+#endif /* RADAR_RANGE_DOPPLER_H_ */
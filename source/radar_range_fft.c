@@ -0,0 +1,263 @@
+/*****************************************************************************
+ * File name: radar_range_fft.c
+ *
+ * Description: This file implements the range FFT preprocessing stage.
+ * On target the transform uses the CMSIS-DSP real FFT with the tables
+ * selected in the Makefile, RADAR_DSP_REFERENCE selects a portable
+ * implementation with the same output layout for host builds.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "radar_range_fft.h"
+
+/*******************************************************************************
+ * Function Name: prepare_chirp
+ ********************************************************************************
+ * Summary:
+ *   Removes the DC offset of one chirp and applies the window into scratch
+ *
+ * Parameters:
+ *   fft: stage state
+ *   chirp: time domain samples of one chirp
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void prepare_chirp(radar_range_fft_s *fft, const float32_t *chirp)
+{
+    const uint32_t n = fft->num_samples_per_chirp;
+    float32_t mean;
+
+#ifdef RADAR_DSP_REFERENCE
+    mean = 0.0f;
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        mean += chirp[i];
+    }
+    mean /= (float32_t)n;
+
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        fft->scratch[i] = (chirp[i] - mean) * fft->window[i];
+    }
+#else
+    arm_mean_f32(chirp, n, &mean);
+    arm_offset_f32(chirp, -mean, fft->scratch, n);
+    arm_mult_f32(fft->scratch, fft->window, fft->scratch, n);
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: transform_chirp
+ ********************************************************************************
+ * Summary:
+ *   Real FFT of scratch, the gated bins are stored into out. The imaginary
+ *   part of the DC bin is zero.
+ *
+ * Parameters:
+ *   fft: stage state
+ *   out: num_gated_bins complex values
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void transform_chirp(radar_range_fft_s *fft, float32_t *out)
+{
+#ifdef RADAR_DSP_REFERENCE
+    const uint32_t n = fft->num_samples_per_chirp;
+
+    /* the direct transform only evaluates the gated bins */
+    for (uint32_t k = fft->first_bin; k < (fft->first_bin + fft->num_gated_bins); ++k)
+    {
+        float32_t re = 0.0f;
+        float32_t im = 0.0f;
+
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            float32_t phi = (2.0f * RADAR_DSP_PI * (float32_t)((k * i) % n)) / (float32_t)n;
+            re += fft->scratch[i] * cosf(phi);
+            im -= fft->scratch[i] * sinf(phi);
+        }
+
+        out[2U * (k - fft->first_bin)] = re;
+        out[(2U * (k - fft->first_bin)) + 1U] = im;
+    }
+#else
+    arm_rfft_fast_f32(&fft->rfft, fft->scratch, fft->fft_out, 0);
+
+    /* CMSIS packs the real bin at half the sample rate into the imaginary part of DC */
+    fft->fft_out[1] = 0.0f;
+
+    memcpy(out, &fft->fft_out[2U * fft->first_bin], 2U * fft->num_gated_bins * sizeof(float32_t));
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: accumulate_magnitude
+ ********************************************************************************
+ * Summary:
+ *   Adds the magnitude of a complex spectrum to a range profile
+ *
+ * Parameters:
+ *   fft: stage state
+ *   spectrum: complex spectrum of one chirp
+ *   profile: range profile to accumulate into
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void accumulate_magnitude(radar_range_fft_s *fft, const float32_t *spectrum, float32_t *profile)
+{
+#ifdef RADAR_DSP_REFERENCE
+    for (uint32_t k = 0; k < fft->num_gated_bins; ++k)
+    {
+        float32_t re = spectrum[2U * k];
+        float32_t im = spectrum[(2U * k) + 1U];
+        profile[k] += sqrtf((re * re) + (im * im));
+    }
+#else
+    /* scratch is free once the chirp is transformed */
+    arm_cmplx_mag_f32(spectrum, fft->scratch, fft->num_gated_bins);
+    arm_add_f32(profile, fft->scratch, profile, fft->num_gated_bins);
+#endif
+}
+
+/*
+ * Initialize range FFT stage
+ */
+int32_t radar_range_fft_init(radar_range_fft_s *fft,
+                             uint32_t num_samples_per_chirp,
+                             uint32_t num_chirps_per_frame,
+                             uint32_t num_rx_antennas,
+                             void* (*alloc_func)(size_t size))
+{
+    const uint32_t n = num_samples_per_chirp;
+
+    if ((NULL == fft) || (NULL == alloc_func) || (n < 4U) || ((n & (n - 1U)) != 0U) ||
+        (0U == num_chirps_per_frame) || (0U == num_rx_antennas))
+    {
+        return -1;
+    }
+
+    memset(fft, 0, sizeof(radar_range_fft_s));
+
+    fft->num_samples_per_chirp = n;
+    fft->num_chirps_per_frame = num_chirps_per_frame;
+    fft->num_rx_antennas = num_rx_antennas;
+    fft->num_range_bins = n / 2U;
+    fft->num_gated_bins = fft->num_range_bins;
+    fft->requested_num_bins = fft->num_range_bins;
+
+#ifndef RADAR_DSP_REFERENCE
+    if (arm_rfft_fast_init_f32(&fft->rfft, (uint16_t)n) != ARM_MATH_SUCCESS)
+    {
+        return -1;
+    }
+#endif
+
+    fft->window = (float32_t*)alloc_func(n * sizeof(float32_t));
+    fft->scratch = (float32_t*)alloc_func(n * sizeof(float32_t));
+    fft->fft_out = (float32_t*)alloc_func(n * sizeof(float32_t));
+    fft->spectrum = (float32_t*)alloc_func(n * num_chirps_per_frame * num_rx_antennas * sizeof(float32_t));
+    fft->range_profile = (float32_t*)alloc_func(fft->num_range_bins * num_rx_antennas * sizeof(float32_t));
+
+    if ((NULL == fft->window) || (NULL == fft->scratch) || (NULL == fft->fft_out) ||
+        (NULL == fft->spectrum) || (NULL == fft->range_profile))
+    {
+        return -2;
+    }
+
+    /* Hann window */
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        fft->window[i] = 0.5f - (0.5f * cosf((2.0f * RADAR_DSP_PI * (float32_t)i) / (float32_t)(n - 1U)));
+    }
+
+    return 0;
+}
+
+/*
+ * Set range gate
+ */
+int32_t radar_range_fft_set_gate(radar_range_fft_s *fft, uint32_t first_bin, uint32_t num_bins)
+{
+    if ((0U == num_bins) || (first_bin >= fft->num_range_bins) ||
+        (num_bins > (fft->num_range_bins - first_bin)))
+    {
+        return -1;
+    }
+
+    /* run validates the pair again, it may read it between the two stores */
+    fft->requested_first_bin = first_bin;
+    fft->requested_num_bins = num_bins;
+
+    return 0;
+}
+
+/*
+ * Run range FFT stage
+ */
+void radar_range_fft_run(radar_range_fft_s *fft, const float32_t *frame)
+{
+    const uint32_t n = fft->num_samples_per_chirp;
+    const float32_t chirp_scale = 1.0f / (float32_t)fft->num_chirps_per_frame;
+    uint32_t first_bin = fft->requested_first_bin;
+    uint32_t num_bins = fft->requested_num_bins;
+    uint32_t cycles;
+
+    if (((first_bin != fft->first_bin) || (num_bins != fft->num_gated_bins)) &&
+        (first_bin < fft->num_range_bins) && (num_bins > 0U) &&
+        (num_bins <= (fft->num_range_bins - first_bin)))
+    {
+        /* statistics are kept per gate so gates can be compared */
+        fft->first_bin = first_bin;
+        fft->num_gated_bins = num_bins;
+        memset(&fft->stats, 0, sizeof(fft->stats));
+    }
+
+    cycles = radar_dsp_cycles();
+
+    memset(fft->range_profile, 0, fft->num_gated_bins * fft->num_rx_antennas * sizeof(float32_t));
+
+    for (uint32_t antenna = 0; antenna < fft->num_rx_antennas; ++antenna)
+    {
+        float32_t *profile = &fft->range_profile[antenna * fft->num_gated_bins];
+
+        for (uint32_t chirp = 0; chirp < fft->num_chirps_per_frame; ++chirp)
+        {
+            const float32_t *samples = &frame[((antenna * fft->num_chirps_per_frame) + chirp) * n];
+            float32_t *spectrum = (float32_t*)radar_range_fft_get_chirp(fft, antenna, chirp);
+
+            prepare_chirp(fft, samples);
+            transform_chirp(fft, spectrum);
+            accumulate_magnitude(fft, spectrum, profile);
+        }
+
+        for (uint32_t k = 0; k < fft->num_gated_bins; ++k)
+        {
+            profile[k] *= chirp_scale;
+        }
+    }
+
+    radar_dsp_stats_add(&fft->stats, radar_dsp_cycles() - cycles);
+}
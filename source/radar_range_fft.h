@@ -0,0 +1,157 @@
+/******************************************************************************
+** File name: radar_range_fft.h
+**
+** Description: This file contains the interface of the range FFT
+**   preprocessing stage. The stage computes one windowed real FFT per chirp
+**   and antenna and a range profile per frame, so detectors running on top
+**   of the gestures library share a single range transform. Only the bins
+**   inside the range gate are kept, later stages work on the gated bins.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_RANGE_FFT_H_
+#define RADAR_RANGE_FFT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "radar_dsp.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_RANGE_FFT_MEM_SIZE
+ * Bytes the stage allocates for a frame geometry: window, scratch chirp, FFT
+ * output, complex spectra of all chirps and the range profile of all antennas.
+ * Spectra and profiles are sized for an open gate so the gate can be changed
+ * at runtime.
+ */
+#define RADAR_RANGE_FFT_MEM_SIZE(samples, chirps, antennas) \
+    ((((samples) * 3U) + ((samples) * (chirps) * (antennas)) + (((samples) / 2U) * (antennas))) * sizeof(float32_t))
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_range_fft_s
+ * Range FFT stage state.
+ *
+ * Spectra are stored per antenna and chirp as num_gated_bins complex values
+ * (re, im interleaved) starting at range bin first_bin. The bin at half the
+ * sample rate is always dropped.
+ */
+typedef struct {
+    uint32_t num_samples_per_chirp;     /*<< FFT length */
+    uint32_t num_chirps_per_frame;      /*<< chirps per antenna plane */
+    uint32_t num_rx_antennas;           /*<< antenna planes */
+    uint32_t num_range_bins;            /*<< num_samples_per_chirp / 2 */
+    uint32_t first_bin;                 /*<< first range bin inside the gate */
+    uint32_t num_gated_bins;            /*<< range bins inside the gate */
+    volatile uint32_t requested_first_bin;  /*<< gate applied at the start of the next frame */
+    volatile uint32_t requested_num_bins;
+
+    float32_t *window;                  /*<< window coefficients, num_samples_per_chirp */
+    float32_t *scratch;                 /*<< FFT input, overwritten by every transform */
+    float32_t *fft_out;                 /*<< FFT output, num_range_bins complex */
+    float32_t *spectrum;                /*<< [antenna][chirp][gated bin] complex */
+    float32_t *range_profile;           /*<< [antenna][gated bin] magnitude averaged over chirps */
+
+    radar_dsp_stats_s stats;            /*<< cycles per frame since the gate was set */
+
+#ifndef RADAR_DSP_REFERENCE
+    arm_rfft_fast_instance_f32 rfft;    /*<< CMSIS-DSP instance using the precomputed tables */
+#endif
+} radar_range_fft_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize range FFT stage
+ *
+ * Allocates the stage buffers with the supplied allocator and precomputes the
+ * window. Buffers are never released individually, the owner frees the memory
+ * pool as a whole.
+ *
+ * @param[out] fft stage state
+ * @param[in] num_samples_per_chirp FFT length, power of two supported by the CMSIS tables linked in
+ * @param[in] num_chirps_per_frame number of chirps
+ * @param[in] num_rx_antennas number of antennas
+ * @param[in] alloc_func allocator returning memory aligned to at least 8 bytes
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid, -2 if allocation fails
+ */
+int32_t radar_range_fft_init(radar_range_fft_s *fft,
+                             uint32_t num_samples_per_chirp,
+                             uint32_t num_chirps_per_frame,
+                             uint32_t num_rx_antennas,
+                             void* (*alloc_func)(size_t size));
+
+/** @brief Set range gate
+ *
+ * The gate takes effect with the next frame, so it can be set from another
+ * task. The stage starts with an open gate covering all range bins.
+ *
+ * @param[in,out] fft stage state
+ * @param[in] first_bin first range bin inside the gate
+ * @param[in] num_bins number of range bins inside the gate
+ *
+ * @return zero (0) on success, -1 if the gate exceeds the range bins
+ */
+int32_t radar_range_fft_set_gate(radar_range_fft_s *fft, uint32_t first_bin, uint32_t num_bins);
+
+/** @brief Run range FFT stage on a de-interleaved frame
+ *
+ * @param[in,out] fft stage state
+ * @param[in] frame de-interleaved frame [antenna][chirp][sample]
+ */
+void radar_range_fft_run(radar_range_fft_s *fft, const float32_t *frame);
+
+/** @brief Get complex range spectrum of one chirp
+ *
+ * @param[in] fft stage state
+ * @param[in] antenna antenna index
+ * @param[in] chirp chirp index
+ *
+ * @return pointer to num_gated_bins complex values, the first one is range bin first_bin
+ */
+static inline const float32_t* radar_range_fft_get_chirp(const radar_range_fft_s *fft,
+        uint32_t antenna, uint32_t chirp)
+{
+    return &fft->spectrum[((antenna * fft->num_chirps_per_frame) + chirp) * fft->num_gated_bins * 2U];
+}
+
+/** @brief Get range profile of one antenna
+ *
+ * @param[in] fft stage state
+ * @param[in] antenna antenna index
+ *
+ * @return pointer to num_gated_bins magnitudes, the first one is range bin first_bin
+ */
+static inline const float32_t* radar_range_fft_get_profile(const radar_range_fft_s *fft,
+        uint32_t antenna)
+{
+    return &fft->range_profile[antenna * fft->num_gated_bins];
+}
+
+#endif /* RADAR_RANGE_FFT_H_ */
@@ -0,0 +1,221 @@
+/*****************************************************************************
+ * File name: radar_recorder.c
+ *
+ * Description: This file implements the flight recorder: circular store of
+ * packed frames, trigger handling and the dump of the frozen window.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <string.h>
+
+#include "radar_recorder.h"
+#include "radar_profiles.h"
+
+/*******************************************************************************
+ * Function Name: get_slot
+ ********************************************************************************
+ * Summary:
+ *   Returns a slot of the store
+ *
+ * Parameters:
+ *   rec: recorder state
+ *   index: slot index
+ *
+ * Return:
+ *   slot, the record header followed by the packed frame
+ *******************************************************************************/
+static inline uint8_t* get_slot(const radar_recorder_s *rec, uint32_t index)
+{
+    return &rec->store[index * rec->slot_size];
+}
+
+/*
+ * Initialize the recorder for a frame geometry
+ */
+int32_t radar_recorder_init(radar_recorder_s *rec,
+                            uint32_t num_samples_per_chirp,
+                            uint32_t num_chirps_per_frame,
+                            uint32_t num_rx_antennas,
+                            void* (*alloc_func)(size_t size))
+{
+    const uint32_t num_samples = num_samples_per_chirp * num_chirps_per_frame * num_rx_antennas;
+
+    if ((NULL == rec) || (NULL == rec->sink) || (NULL == alloc_func) || (0U == num_samples))
+    {
+        return -1;
+    }
+
+    rec->store = NULL;
+    rec->record = NULL;
+    rec->num_slots = 0;
+    rec->slot_size = RADAR_RECORDER_SLOT_SIZE(num_samples);
+
+    rec->header.num_samples_per_chirp = (uint16_t)num_samples_per_chirp;
+    rec->header.num_chirps_per_frame = (uint16_t)num_chirps_per_frame;
+    rec->header.num_rx_antennas = (uint8_t)num_rx_antennas;
+    rec->header.mode = (uint8_t)RADAR_RICE_MODE_RAW;
+    rec->header.payload_len = RADAR_SAMPLE12_BYTES(num_samples);
+
+    if (RADAR_RECORDER_FRAMES > 0)
+    {
+        /* the store has the same size for every profile, smaller frames fit more slots */
+        rec->store = (uint8_t*)alloc_func(RADAR_RECORDER_STORE_SIZE(RADAR_PROFILE_MAX_SAMPLES_PER_FRAME));
+        rec->record = (uint8_t*)alloc_func(RADAR_RICE_RECORD_SIZE(num_samples));
+        if ((NULL == rec->store) || (NULL == rec->record))
+        {
+            return -2;
+        }
+        rec->num_slots = (uint32_t)(RADAR_RECORDER_STORE_SIZE(RADAR_PROFILE_MAX_SAMPLES_PER_FRAME) / rec->slot_size);
+    }
+
+    rec->post_frames = (RADAR_RECORDER_POST_FRAMES < rec->num_slots) ? RADAR_RECORDER_POST_FRAMES :
+                       ((rec->num_slots > 0U) ? (rec->num_slots - 1U) : 0U);
+
+    radar_recorder_arm(rec, rec->triggers);
+
+    return 0;
+}
+
+/*
+ * Select the enabled triggers and arm the recorder
+ */
+void radar_recorder_arm(radar_recorder_s *rec, uint32_t triggers)
+{
+    taskENTER_CRITICAL();
+    rec->triggers = triggers & (uint32_t)RADAR_RECORDER_TRIGGER_ALL;
+    rec->next = 0;
+    rec->stored = 0;
+    rec->post_remaining = 0;
+    rec->state = ((rec->triggers != 0U) && (rec->num_slots > 0U)) ?
+                 RADAR_RECORDER_STATE_RECORDING : RADAR_RECORDER_STATE_OFF;
+    taskEXIT_CRITICAL();
+}
+
+/*
+ * Offer a frame to the recorder
+ */
+uint8_t* radar_recorder_claim(const radar_recorder_s *rec)
+{
+    if ((rec->state != RADAR_RECORDER_STATE_RECORDING) && (rec->state != RADAR_RECORDER_STATE_TRIGGERED))
+    {
+        return NULL;
+    }
+
+    return get_slot(rec, rec->next) + sizeof(radar_rice_header_s);
+}
+
+/*
+ * Add the copied frame to the window
+ */
+void radar_recorder_commit(radar_recorder_s *rec)
+{
+    radar_rice_header_s *header = (radar_rice_header_s*)get_slot(rec, rec->next);
+
+    *header = rec->header;
+    header->seq = rec->seq++;
+
+    /* a trigger from a lower priority task may come in between */
+    taskENTER_CRITICAL();
+    rec->next = ((rec->next + 1U) < rec->num_slots) ? (rec->next + 1U) : 0U;
+    rec->stored++;
+    if ((rec->state == RADAR_RECORDER_STATE_TRIGGERED) && (--rec->post_remaining == 0U))
+    {
+        rec->state = RADAR_RECORDER_STATE_FROZEN;
+        rec->freezes++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/*
+ * Trigger the recorder
+ */
+void radar_recorder_trigger(radar_recorder_s *rec, radar_recorder_trigger_e source)
+{
+    const uint32_t post_frames = (source == RADAR_RECORDER_TRIGGER_COMMAND) ? 0U : rec->post_frames;
+
+    taskENTER_CRITICAL();
+    /* a command also cuts short the frames taken after another trigger */
+    if (((rec->state == RADAR_RECORDER_STATE_RECORDING) ||
+         ((rec->state == RADAR_RECORDER_STATE_TRIGGERED) && (post_frames == 0U))) &&
+        ((rec->triggers & (uint32_t)source) != 0U))
+    {
+        rec->trigger = source;
+        rec->trigger_seq = (uint16_t)(rec->seq - 1U);
+        rec->post_remaining = post_frames;
+        if (post_frames == 0U)
+        {
+            rec->state = RADAR_RECORDER_STATE_FROZEN;
+            rec->freezes++;
+        }
+        else
+        {
+            rec->state = RADAR_RECORDER_STATE_TRIGGERED;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+/*
+ * Write the frozen window to the sink and arm the recorder again
+ */
+int32_t radar_recorder_dump(radar_recorder_s *rec)
+{
+    uint32_t count;
+    uint32_t index;
+
+    taskENTER_CRITICAL();
+    if (rec->state == RADAR_RECORDER_STATE_TRIGGERED)
+    {
+        rec->state = RADAR_RECORDER_STATE_FROZEN;
+        rec->freezes++;
+    }
+    taskEXIT_CRITICAL();
+
+    if (rec->state != RADAR_RECORDER_STATE_FROZEN)
+    {
+        return -2;
+    }
+
+    /* the acquisition leaves a frozen store alone */
+    count = (rec->stored < rec->num_slots) ? rec->stored : rec->num_slots;
+    index = (rec->next + rec->num_slots - count) % rec->num_slots;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const uint8_t *slot = get_slot(rec, index);
+        radar_rice_header_s header;
+        uint32_t len;
+
+        memcpy(&header, slot, sizeof(header));
+        len = radar_rice_encode(slot + sizeof(radar_rice_header_s), &header, rec->record);
+        if (len > 0U)
+        {
+            rec->sink(rec->record, len);
+            rec->dumped++;
+            rec->dumped_bytes += len;
+        }
+
+        index = ((index + 1U) < rec->num_slots) ? (index + 1U) : 0U;
+    }
+
+    radar_recorder_arm(rec, rec->triggers);
+
+    return (int32_t)count;
+}
@@ -0,0 +1,221 @@
+/******************************************************************************
+** File name: radar_recorder.h
+**
+** Description: This file contains the interface of the flight recorder.
+**   The acquisition copies every frame in the packed 12-bit format into a
+**   circular store. A trigger lets the recorder take a few more frames and
+**   then freezes the store, so the window around the trigger is kept until
+**   it is dumped as records of the raw frame stream.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_RECORDER_H_
+#define RADAR_RECORDER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "radar_dsp.h"
+#include "radar_rice.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_RECORDER_FRAMES
+ * Frames of the largest profile the store holds, smaller profiles fit more
+ * frames into the same memory. Set with RECORDER_FRAMES in the Makefile,
+ * 0 removes the store.
+ */
+#ifndef RADAR_RECORDER_FRAMES
+#define RADAR_RECORDER_FRAMES               (16)
+#endif
+
+/*
+ * @def RADAR_RECORDER_POST_FRAMES
+ * Frames taken after a detection or low confidence trigger
+ */
+#define RADAR_RECORDER_POST_FRAMES          (4U)
+
+/*
+ * @def RADAR_RECORDER_SLOT_SIZE
+ * Bytes of a slot, the record header followed by the packed frame
+ */
+#define RADAR_RECORDER_SLOT_SIZE(num_samples) \
+    (sizeof(radar_rice_header_s) + ((RADAR_SAMPLE12_BYTES(num_samples) + 3U) & ~3U))
+
+/*
+ * @def RADAR_RECORDER_STORE_SIZE
+ * Bytes of the store, the same for every profile
+ */
+#define RADAR_RECORDER_STORE_SIZE(max_samples) \
+    ((size_t)RADAR_RECORDER_FRAMES * RADAR_RECORDER_SLOT_SIZE(max_samples))
+
+/*
+ * @def RADAR_RECORDER_MEM_SIZE
+ * Bytes the recorder allocates: the store and the record buffer of the dump
+ */
+#define RADAR_RECORDER_MEM_SIZE(max_samples, num_samples) \
+    ((RADAR_RECORDER_FRAMES > 0) ? \
+     (RADAR_RECORDER_STORE_SIZE(max_samples) + RADAR_RICE_RECORD_SIZE(num_samples)) : 0U)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_recorder_trigger_e
+ * Trigger sources, combined into the mask of enabled triggers
+ */
+typedef enum
+{
+    RADAR_RECORDER_TRIGGER_NONE = 0x0,
+    RADAR_RECORDER_TRIGGER_DETECTION = 0x1,         /*<< gesture reported by the application */
+    RADAR_RECORDER_TRIGGER_LOW_CONFIDENCE = 0x2,    /*<< gesture scored below the detection threshold */
+    RADAR_RECORDER_TRIGGER_COMMAND = 0x4,           /*<< console command, freezes at once */
+    RADAR_RECORDER_TRIGGER_ALL = 0x7
+} radar_recorder_trigger_e;
+
+/*
+ * @def enum radar_recorder_state_e
+ * State of the store
+ */
+typedef enum
+{
+    RADAR_RECORDER_STATE_OFF = 0,       /*<< no trigger enabled, frames are not taken */
+    RADAR_RECORDER_STATE_RECORDING = 1, /*<< frames overwrite the oldest slot */
+    RADAR_RECORDER_STATE_TRIGGERED = 2, /*<< taking the frames after the trigger */
+    RADAR_RECORDER_STATE_FROZEN = 3,    /*<< window kept until dumped */
+    RADAR_RECORDER_STATE_NUM
+} radar_recorder_state_e;
+
+/*
+ * @typedef typedef void (*radar_recorder_sink_fn)(const uint8_t *data, uint32_t len)
+ * Sink prototype, called from the dumping task with one record
+ */
+typedef void (*radar_recorder_sink_fn)(const uint8_t *data, uint32_t len);
+
+/*
+ * @typedef typedef struct  radar_recorder_s
+ * Recorder state. The triggers and the sink are kept across initializations.
+ */
+typedef struct {
+    uint32_t triggers;                  /*<< enabled radar_recorder_trigger_e */
+    radar_recorder_sink_fn sink;
+
+    uint8_t *store;
+    uint8_t *record;                    /*<< encoded record of the dump */
+    uint32_t num_slots;
+    uint32_t slot_size;
+    uint32_t post_frames;               /*<< frames taken after a trigger, less than num_slots */
+    radar_rice_header_s header;         /*<< geometry of the frames */
+
+    volatile radar_recorder_state_e state;
+    uint32_t next;                      /*<< slot of the next frame */
+    uint32_t stored;                    /*<< frames taken since armed */
+    uint32_t post_remaining;
+    uint16_t seq;                       /*<< sequence number of the next frame */
+
+    radar_recorder_trigger_e trigger;   /*<< source of the last trigger */
+    uint16_t trigger_seq;               /*<< last frame taken before the trigger */
+    uint32_t freezes;                   /*<< windows frozen */
+    uint32_t dumped;                    /*<< frames dumped */
+    uint64_t dumped_bytes;              /*<< record bytes written to the sink */
+    radar_dsp_stats_s stats;            /*<< copy cycles per frame */
+} radar_recorder_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the recorder for a frame geometry
+ *
+ * Takes the store from the allocator and arms the enabled triggers. A
+ * window frozen before is lost.
+ *
+ * @param[in,out] rec recorder state, triggers and sink set
+ * @param[in] num_samples_per_chirp samples per chirp
+ * @param[in] num_chirps_per_frame chirps per frame
+ * @param[in] num_rx_antennas receive antennas
+ * @param[in] alloc_func allocator of the store
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid, -2 if the allocation fails
+ */
+int32_t radar_recorder_init(radar_recorder_s *rec,
+                            uint32_t num_samples_per_chirp,
+                            uint32_t num_chirps_per_frame,
+                            uint32_t num_rx_antennas,
+                            void* (*alloc_func)(size_t size));
+
+/** @brief Select the enabled triggers and arm the recorder
+ *
+ * A window frozen before is discarded.
+ *
+ * @param[in,out] rec recorder state
+ * @param[in] triggers mask of radar_recorder_trigger_e, NONE stops recording
+ */
+void radar_recorder_arm(radar_recorder_s *rec, uint32_t triggers);
+
+/** @brief Offer a frame to the recorder
+ *
+ * Called by the acquisition for every frame. If the recorder takes the
+ * frame, the caller copies it in the packed 12-bit format into the returned
+ * slot and calls \ref radar_recorder_commit.
+ *
+ * @param[in] rec recorder state
+ *
+ * @return slot for the packed frame, NULL while off or frozen
+ */
+uint8_t* radar_recorder_claim(const radar_recorder_s *rec);
+
+/** @brief Add the copied frame to the window
+ *
+ * @param[in,out] rec recorder state
+ */
+void radar_recorder_commit(radar_recorder_s *rec);
+
+/** @brief Trigger the recorder
+ *
+ * Ignored unless the source is enabled and the recorder is recording. A
+ * command freezes the window at once, also one already triggered, the other
+ * sources after RADAR_RECORDER_POST_FRAMES more frames.
+ *
+ * @param[in,out] rec recorder state
+ * @param[in] source trigger source
+ */
+void radar_recorder_trigger(radar_recorder_s *rec, radar_recorder_trigger_e source);
+
+/** @brief Write the frozen window to the sink and arm the recorder again
+ *
+ * Every frame is encoded into a record of the raw frame stream, oldest
+ * first. A window still taking frames after its trigger is frozen first.
+ *
+ * @param[in,out] rec recorder state
+ *
+ * @return number of frames written, -2 if no window is frozen
+ */
+int32_t radar_recorder_dump(radar_recorder_s *rec);
+
+#endif /* RADAR_RECORDER_H_ */
@@ -0,0 +1,405 @@
+/*****************************************************************************
+ * File name: radar_rice.c
+ *
+ * Description: This file implements the lossless codec for raw radar frames.
+ * The encoder reads the samples straight from the packed FIFO format, the
+ * decoder is built for the host tool as well.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "radar_rice.h"
+
+/*******************************************************************************
+ * Macros
+ ********************************************************************************/
+
+/* prediction of the first sample of an antenna, mid-scale */
+#define PREDICTION_FIRST    (0x800U)
+
+/* largest Rice parameter, a residual has at most 13 significant bits */
+#define K_MAX               (12U)
+
+/*******************************************************************************
+ * Local Declarations
+ ********************************************************************************/
+typedef struct {
+    uint8_t *buf;
+    uint32_t size;
+    uint32_t pos;
+    uint32_t acc;
+    uint32_t bits;
+    bool overflow;
+} bit_writer_s;
+
+typedef struct {
+    const uint8_t *buf;
+    uint32_t size;
+    uint32_t pos;
+    uint32_t acc;
+    uint32_t bits;
+    bool underflow;
+} bit_reader_s;
+
+/*******************************************************************************
+ * Function Name: get_sample
+ ********************************************************************************
+ * Summary:
+ *   Reads one sample from a frame in the packed FIFO format
+ *
+ * Parameters:
+ *   packed: packed frame
+ *   i: sample index
+ *
+ * Return:
+ *   12-bit sample
+ *******************************************************************************/
+static inline uint32_t get_sample(const uint8_t *packed, uint32_t i)
+{
+    const uint8_t *p = &packed[(i >> 1) * 3U];
+
+    return ((i & 1U) == 0U) ? (((uint32_t)p[0] << 4) | ((uint32_t)p[1] >> 4)) :
+                              ((((uint32_t)p[1] & 0x0FU) << 8) | (uint32_t)p[2]);
+}
+
+/*******************************************************************************
+ * Function Name: put_bits
+ ********************************************************************************
+ * Summary:
+ *   Appends the lower bits of a value, most significant bit first
+ *
+ * Parameters:
+ *   bw: bit writer
+ *   value: bits to append
+ *   n: number of bits, at most 24
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static inline void put_bits(bit_writer_s *bw, uint32_t value, uint32_t n)
+{
+    bw->acc = (bw->acc << n) | (value & ((1UL << n) - 1UL));
+    bw->bits += n;
+
+    while (bw->bits >= 8U)
+    {
+        bw->bits -= 8U;
+        if (bw->pos < bw->size)
+        {
+            bw->buf[bw->pos] = (uint8_t)(bw->acc >> bw->bits);
+        }
+        else
+        {
+            bw->overflow = true;
+        }
+        bw->pos++;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: get_bits
+ ********************************************************************************
+ * Summary:
+ *   Reads bits written by put_bits()
+ *
+ * Parameters:
+ *   br: bit reader
+ *   n: number of bits, at most 24
+ *
+ * Return:
+ *   bits read, zero bits past the end of the payload
+ *******************************************************************************/
+static inline uint32_t get_bits(bit_reader_s *br, uint32_t n)
+{
+    while (br->bits < n)
+    {
+        if (br->pos < br->size)
+        {
+            br->acc = (br->acc << 8) | br->buf[br->pos];
+        }
+        else
+        {
+            br->acc <<= 8;
+            br->underflow = true;
+        }
+        br->pos++;
+        br->bits += 8U;
+    }
+
+    br->bits -= n;
+
+    return (br->acc >> br->bits) & ((1UL << n) - 1UL);
+}
+
+/*******************************************************************************
+ * Function Name: predict
+ ********************************************************************************
+ * Summary:
+ *   Predicts a sample from the decoded or original samples before it
+ *
+ * Parameters:
+ *   samples: packed frame for the encoder, NULL for the decoder
+ *   decoded: decoded samples for the decoder
+ *   i: sample index
+ *   line: samples of one chirp, all antennas
+ *   antennas: interleaved antennas
+ *
+ * Return:
+ *   predicted sample
+ *******************************************************************************/
+static inline uint32_t predict(const uint8_t *samples, const uint16_t *decoded,
+        uint32_t i, uint32_t line, uint32_t antennas)
+{
+    uint32_t ref;
+
+    if (i >= line)
+    {
+        ref = i - line;                 /* same sample of the previous chirp */
+    }
+    else if (i >= antennas)
+    {
+        ref = i - antennas;             /* previous sample of the antenna */
+    }
+    else
+    {
+        return PREDICTION_FIRST;
+    }
+
+    return (samples != NULL) ? get_sample(samples, ref) : decoded[ref];
+}
+
+/*******************************************************************************
+ * Function Name: write_header
+ ********************************************************************************
+ * Summary:
+ *   Serializes the record header
+ *
+ * Parameters:
+ *   header: record header
+ *   record: RADAR_RICE_HEADER_SIZE bytes
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void write_header(const radar_rice_header_s *header, uint8_t *record)
+{
+    const uint32_t words[4] = {
+        RADAR_RICE_MAGIC,
+        (uint32_t)header->seq | ((uint32_t)header->num_samples_per_chirp << 16),
+        (uint32_t)header->num_chirps_per_frame | ((uint32_t)header->num_rx_antennas << 16) |
+            ((uint32_t)header->mode << 24),
+        header->payload_len
+    };
+
+    for (uint32_t i = 0; i < 16U; ++i)
+    {
+        record[i] = (uint8_t)(words[i >> 2] >> ((i & 3U) * 8U));
+    }
+}
+
+/*
+ * encode a frame into a record
+ */
+uint32_t radar_rice_encode(const uint8_t *packed, radar_rice_header_s *header, uint8_t *record)
+{
+    const uint32_t antennas = header->num_rx_antennas;
+    const uint32_t line = header->num_samples_per_chirp * antennas;
+    const uint32_t num_samples = line * header->num_chirps_per_frame;
+    const uint32_t raw_bytes = RADAR_SAMPLE12_BYTES(num_samples);
+    bit_writer_s bw = {
+        .buf = &record[RADAR_RICE_HEADER_SIZE],
+        .size = raw_bytes
+    };
+
+    if (num_samples == 0U)
+    {
+        return 0;
+    }
+
+    for (uint32_t start = 0; (start < num_samples) && !bw.overflow; start += line)
+    {
+        uint32_t sum = 0;
+        uint32_t k = 0;
+
+        /* Rice parameter near log2 of the mean residual of the chirp */
+        for (uint32_t i = start; i < (start + line); ++i)
+        {
+            int32_t r = (int32_t)get_sample(packed, i) - (int32_t)predict(packed, NULL, i, line, antennas);
+            sum += ((uint32_t)r << 1) ^ (uint32_t)(r >> 31);
+        }
+
+        while ((k < K_MAX) && ((line << (k + 1U)) <= sum))
+        {
+            k++;
+        }
+
+        put_bits(&bw, k, RADAR_RICE_K_BITS);
+
+        for (uint32_t i = start; (i < (start + line)) && !bw.overflow; ++i)
+        {
+            int32_t r = (int32_t)get_sample(packed, i) - (int32_t)predict(packed, NULL, i, line, antennas);
+            uint32_t u = ((uint32_t)r << 1) ^ (uint32_t)(r >> 31);
+            uint32_t q = u >> k;
+
+            if (q < RADAR_RICE_ESCAPE)
+            {
+                /* q ones, a zero and the k low bits */
+                put_bits(&bw, ((1UL << (q + 1U)) - 2UL), q + 1U);
+                if (k > 0U)
+                {
+                    put_bits(&bw, u, k);
+                }
+            }
+            else
+            {
+                put_bits(&bw, (1UL << RADAR_RICE_ESCAPE) - 1UL, RADAR_RICE_ESCAPE);
+                put_bits(&bw, u, RADAR_RICE_ESCAPE_BITS);
+            }
+        }
+    }
+
+    if (bw.bits > 0U)
+    {
+        put_bits(&bw, 0, 8U - bw.bits);
+    }
+
+    /* the coded frame must be smaller than the packed one */
+    if (bw.overflow || (bw.pos >= raw_bytes))
+    {
+        memcpy(&record[RADAR_RICE_HEADER_SIZE], packed, raw_bytes);
+        header->mode = (uint8_t)RADAR_RICE_MODE_RAW;
+        header->payload_len = raw_bytes;
+    }
+    else
+    {
+        header->mode = (uint8_t)RADAR_RICE_MODE_RICE;
+        header->payload_len = bw.pos;
+    }
+
+    write_header(header, record);
+
+    return RADAR_RICE_HEADER_SIZE + header->payload_len;
+}
+
+/*
+ * parse and check a record header
+ */
+int32_t radar_rice_parse_header(const uint8_t *record, uint32_t len, radar_rice_header_s *header)
+{
+    uint32_t words[4] = {0};
+    uint32_t num_samples;
+
+    if (len < RADAR_RICE_HEADER_SIZE)
+    {
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < 16U; ++i)
+    {
+        words[i >> 2] |= (uint32_t)record[i] << ((i & 3U) * 8U);
+    }
+
+    if (words[0] != RADAR_RICE_MAGIC)
+    {
+        return -1;
+    }
+
+    header->seq = (uint16_t)words[1];
+    header->num_samples_per_chirp = (uint16_t)(words[1] >> 16);
+    header->num_chirps_per_frame = (uint16_t)words[2];
+    header->num_rx_antennas = (uint8_t)(words[2] >> 16);
+    header->mode = (uint8_t)(words[2] >> 24);
+    header->payload_len = words[3];
+
+    num_samples = (uint32_t)header->num_samples_per_chirp * header->num_chirps_per_frame * header->num_rx_antennas;
+
+    if ((num_samples == 0U) || (header->mode > (uint8_t)RADAR_RICE_MODE_RICE) ||
+        (header->payload_len > RADAR_SAMPLE12_BYTES(num_samples)) ||
+        ((header->mode == (uint8_t)RADAR_RICE_MODE_RAW) && (header->payload_len != RADAR_SAMPLE12_BYTES(num_samples))))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * decode the payload of a record
+ */
+int32_t radar_rice_decode(const radar_rice_header_s *header, const uint8_t *payload, uint16_t *samples)
+{
+    const uint32_t antennas = header->num_rx_antennas;
+    const uint32_t line = (uint32_t)header->num_samples_per_chirp * antennas;
+    const uint32_t num_samples = line * header->num_chirps_per_frame;
+    bit_reader_s br = {
+        .buf = payload,
+        .size = header->payload_len
+    };
+
+    if (header->mode == (uint8_t)RADAR_RICE_MODE_RAW)
+    {
+        radar_sample12_unpack(payload, samples, num_samples);
+        return 0;
+    }
+
+    for (uint32_t start = 0; start < num_samples; start += line)
+    {
+        uint32_t k = get_bits(&br, RADAR_RICE_K_BITS);
+
+        if (k > K_MAX)
+        {
+            return -2;
+        }
+
+        for (uint32_t i = start; i < (start + line); ++i)
+        {
+            uint32_t q = 0;
+            uint32_t u;
+            int32_t x;
+
+            while ((q < RADAR_RICE_ESCAPE) && (get_bits(&br, 1U) == 1U))
+            {
+                q++;
+            }
+
+            if (q == RADAR_RICE_ESCAPE)
+            {
+                u = get_bits(&br, RADAR_RICE_ESCAPE_BITS);
+            }
+            else
+            {
+                u = (q << k) | ((k > 0U) ? get_bits(&br, k) : 0U);
+            }
+
+            x = (int32_t)predict(NULL, samples, i, line, antennas) + ((int32_t)(u >> 1) ^ -(int32_t)(u & 1U));
+
+            if ((x < 0) || (x > (int32_t)RADAR_SAMPLE12_MAX) || br.underflow)
+            {
+                return -2;
+            }
+
+            samples[i] = (uint16_t)x;
+        }
+    }
+
+    return 0;
+}
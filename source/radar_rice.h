@@ -0,0 +1,134 @@
+/******************************************************************************
+** File name: radar_rice.h
+**
+** Description: This file contains the interface of the lossless codec for
+**   raw radar frames. Every 12-bit sample is predicted by the same sample of
+**   the previous chirp (by the previous sample of the antenna in the first
+**   chirp), the residuals are Rice coded with one parameter per chirp.
+**   A record carries a fixed header and the payload of one frame, frames the
+**   coder cannot shrink are stored in the packed FIFO format.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_RICE_H_
+#define RADAR_RICE_H_
+
+#include <stdint.h>
+
+#include "radar_sample12.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_RICE_MAGIC
+ * First bytes of every record, "RRC1"
+ */
+#define RADAR_RICE_MAGIC                    (0x31435252UL)
+
+/*
+ * @def RADAR_RICE_HEADER_SIZE
+ * Bytes of the record header, little endian fields
+ */
+#define RADAR_RICE_HEADER_SIZE              (16U)
+
+/*
+ * @def RADAR_RICE_K_BITS
+ * Bits of the Rice parameter sent in front of every chirp
+ */
+#define RADAR_RICE_K_BITS                   (4U)
+
+/*
+ * @def RADAR_RICE_ESCAPE
+ * Unary quotient from which the residual follows in RADAR_RICE_ESCAPE_BITS
+ * bits, bounds the code of a single sample
+ */
+#define RADAR_RICE_ESCAPE                   (16U)
+#define RADAR_RICE_ESCAPE_BITS              (13U)
+
+/*
+ * @def RADAR_RICE_RECORD_SIZE
+ * Largest record of a frame, the payload never exceeds the packed frame
+ */
+#define RADAR_RICE_RECORD_SIZE(num_samples) (RADAR_RICE_HEADER_SIZE + RADAR_SAMPLE12_BYTES(num_samples))
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_rice_mode_e
+ * Payload format of a record
+ */
+typedef enum
+{
+    RADAR_RICE_MODE_RAW = 0,        /*<< packed 12-bit FIFO format */
+    RADAR_RICE_MODE_RICE = 1        /*<< predicted and Rice coded */
+} radar_rice_mode_e;
+
+/*
+ * @typedef typedef struct  radar_rice_header_s
+ * Record header. Samples are in FIFO order, antennas interleaved.
+ */
+typedef struct {
+    uint16_t seq;                   /*<< frame sequence number */
+    uint16_t num_samples_per_chirp;
+    uint16_t num_chirps_per_frame;
+    uint8_t num_rx_antennas;
+    uint8_t mode;                   /*<< radar_rice_mode_e */
+    uint32_t payload_len;           /*<< bytes following the header */
+} radar_rice_header_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Encode a frame into a record
+ *
+ * @param[in] packed frame in the packed 12-bit FIFO format
+ * @param[in,out] header sequence number and geometry in, mode and payload length out
+ * @param[out] record RADAR_RICE_RECORD_SIZE() bytes
+ *
+ * @return bytes of the record including the header, 0 if the geometry is invalid
+ */
+uint32_t radar_rice_encode(const uint8_t *packed, radar_rice_header_s *header, uint8_t *record);
+
+/** @brief Parse and check a record header
+ *
+ * @param[in] record record bytes
+ * @param[in] len bytes available
+ * @param[out] header parsed header
+ *
+ * @return zero (0) on success, -1 if the bytes do not start a valid header
+ */
+int32_t radar_rice_parse_header(const uint8_t *record, uint32_t len, radar_rice_header_s *header);
+
+/** @brief Decode the payload of a record
+ *
+ * @param[in] header parsed header
+ * @param[in] payload header->payload_len bytes
+ * @param[out] samples samples of the frame in FIFO order
+ *
+ * @return zero (0) on success, -2 if the payload is corrupt
+ */
+int32_t radar_rice_decode(const radar_rice_header_s *header, const uint8_t *payload, uint16_t *samples);
+
+#endif /* RADAR_RICE_H_ */
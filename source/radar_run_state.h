@@ -0,0 +1,66 @@
+/******************************************************************************
+** File name: radar_run_state.h
+**
+** Description: This file contains the run states of the application. Only
+**   the active state runs the radar and the processing pipeline; the other
+**   states stop the frames, flush the buffered data and park the stage tasks.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_RUN_STATE_H_
+#define RADAR_RUN_STATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_run_state_e
+ * Application run states
+ */
+typedef enum
+{
+    RADAR_RUN_STATE_ACTIVE = 0,     /*<< radar framing, frames pass the pipeline */
+    RADAR_RUN_STATE_SETTINGS = 1,   /*<< console settings mode, radar stopped, stages parked */
+    RADAR_RUN_STATE_STANDBY = 2,    /*<< radar stopped and configured, stages parked */
+    RADAR_RUN_STATE_SUSPENDED = 3,  /*<< sensor powered down, reconfigured when activated */
+    RADAR_RUN_STATE_NUM
+} radar_run_state_e;
+
+/*
+ * @typedef typedef struct  radar_run_state_s
+ * Run state and resume timing
+ */
+typedef struct {
+    volatile radar_run_state_e state;
+    radar_run_state_e resume_state;     /*<< state entered when the settings mode is left */
+    bool sensor_powered;
+    uint32_t transitions;
+
+    uint32_t resumed_at;                /*<< cycle counter when the active state was entered */
+    volatile bool first_inference_pending;
+    uint32_t first_inference_cycles;    /*<< cycles from the last resume to its first inference */
+    uint32_t first_inference_cycles_max;
+} radar_run_state_s;
+
+#endif /* RADAR_RUN_STATE_H_ */
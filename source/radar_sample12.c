@@ -0,0 +1,109 @@
+/*****************************************************************************
+ * File name: radar_sample12.c
+ *
+ * Description: This file implements packing, unpacking and de-interleaving of
+ * frames in the packed 12-bit format of the sensor FIFO.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include "radar_sample12.h"
+
+/*
+ * pack samples into the FIFO format
+ */
+void radar_sample12_pack(const uint16_t *src, uint8_t *dst, uint32_t num_samples)
+{
+    uint32_t i = 0;
+
+    for (; (i + 1U) < num_samples; i += 2U)
+    {
+        uint32_t s0 = src[i] & RADAR_SAMPLE12_MAX;
+        uint32_t s1 = src[i + 1U] & RADAR_SAMPLE12_MAX;
+
+        *dst++ = (uint8_t)(s0 >> 4);
+        *dst++ = (uint8_t)((s0 << 4) | (s1 >> 8));
+        *dst++ = (uint8_t)s1;
+    }
+
+    if (i < num_samples)
+    {
+        uint32_t s0 = src[i] & RADAR_SAMPLE12_MAX;
+
+        *dst++ = (uint8_t)(s0 >> 4);
+        *dst++ = (uint8_t)(s0 << 4);
+        *dst = 0;
+    }
+}
+
+/*
+ * unpack samples in the FIFO format
+ */
+void radar_sample12_unpack(const uint8_t *src, uint16_t *dst, uint32_t num_samples)
+{
+    uint32_t i = 0;
+
+    for (; (i + 1U) < num_samples; i += 2U)
+    {
+        dst[i] = (uint16_t)(((uint32_t)src[0] << 4) | ((uint32_t)src[1] >> 4));
+        dst[i + 1U] = (uint16_t)((((uint32_t)src[1] & 0x0FU) << 8) | (uint32_t)src[2]);
+        src += 3;
+    }
+
+    if (i < num_samples)
+    {
+        dst[i] = (uint16_t)(((uint32_t)src[0] << 4) | ((uint32_t)src[1] >> 4));
+    }
+}
+
+/*
+ * unpack and de-interleave a frame
+ */
+void radar_sample12_deinterleave(const uint8_t *src, float32_t *frame,
+        uint32_t num_samples, uint32_t num_rx_antennas)
+{
+    const uint32_t samples_per_antenna = num_samples / num_rx_antennas;
+    uint32_t antenna = 0;
+    uint32_t index = 0;
+
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        uint32_t sample;
+
+        /* even samples start a three byte group, odd samples end it */
+        if ((i & 1U) == 0U)
+        {
+            sample = ((uint32_t)src[0] << 4) | ((uint32_t)src[1] >> 4);
+        }
+        else
+        {
+            sample = (((uint32_t)src[1] & 0x0FU) << 8) | (uint32_t)src[2];
+            src += 3;
+        }
+
+        frame[index + (antenna * samples_per_antenna)] = (float32_t)sample;
+
+        antenna++;
+        if (antenna == num_rx_antennas)
+        {
+            antenna = 0;
+            index++;
+        }
+    }
+}
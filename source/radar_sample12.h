@@ -0,0 +1,85 @@
+/******************************************************************************
+** File name: radar_sample12.h
+**
+** Description: This file contains the kernels for frames kept in the packed
+**   12-bit format of the sensor FIFO. Two samples take three bytes, the first
+**   sample in the upper twelve bits of the big-endian 24-bit word. The radar
+**   data manager buffers the frames in this format and the de-interleaving
+**   unpacks them, so the buffer needs three quarters of the 16-bit size.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_SAMPLE12_H_
+#define RADAR_SAMPLE12_H_
+
+#include <stdint.h>
+
+#include "radar_dsp.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_SAMPLE12_BYTES
+ * Bytes of num_samples packed samples, an odd sample takes a full pair
+ */
+#define RADAR_SAMPLE12_BYTES(num_samples)   ((((num_samples) + 1U) / 2U) * 3U)
+
+/*
+ * @def RADAR_SAMPLE12_MAX
+ * Largest sample value
+ */
+#define RADAR_SAMPLE12_MAX                  (0x0FFFU)
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Pack 12-bit samples into the FIFO format
+ *
+ * @param[in] src samples, only the lower twelve bits are kept
+ * @param[out] dst RADAR_SAMPLE12_BYTES(num_samples) bytes
+ * @param[in] num_samples number of samples
+ */
+void radar_sample12_pack(const uint16_t *src, uint8_t *dst, uint32_t num_samples);
+
+/** @brief Unpack samples in the FIFO format
+ *
+ * @param[in] src RADAR_SAMPLE12_BYTES(num_samples) bytes
+ * @param[out] dst samples
+ * @param[in] num_samples number of samples
+ */
+void radar_sample12_unpack(const uint8_t *src, uint16_t *dst, uint32_t num_samples);
+
+/** @brief Unpack and de-interleave a frame in the FIFO format
+ *
+ * The FIFO interleaves the enabled antennas sample by sample. The frame is
+ * written as [antenna][chirp][sample] in one pass over the packed data.
+ *
+ * @param[in] src packed frame
+ * @param[out] frame de-interleaved frame, num_samples floats
+ * @param[in] num_samples samples of all antennas, a multiple of num_rx_antennas
+ * @param[in] num_rx_antennas interleaved antennas
+ */
+void radar_sample12_deinterleave(const uint8_t *src, float32_t *frame,
+        uint32_t num_samples, uint32_t num_rx_antennas);
+
+#endif /* RADAR_SAMPLE12_H_ */
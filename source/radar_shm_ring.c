@@ -0,0 +1,165 @@
+/*****************************************************************************
+ * File name: radar_shm_ring.c
+ *
+ * Description: This file implements the single-producer single-consumer
+ * frame ring in shared memory.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <string.h>
+
+#include "radar_shm_ring.h"
+
+/*******************************************************************************
+ * Function Name: slot_at
+ ********************************************************************************
+ * Summary:
+ *   Returns the header of the slot a frame count maps to
+ *
+ * Parameters:
+ *   ring: ring state
+ *   count: head or tail index
+ *
+ * Return:
+ *   slot header
+ *******************************************************************************/
+static inline radar_shm_ring_slot_s* slot_at(const radar_shm_ring_s *ring, uint32_t count)
+{
+    return (radar_shm_ring_slot_s*)&ring->slots[(count & (ring->num_slots - 1U)) * ring->slot_stride];
+}
+
+/*
+ * Initialize ring
+ */
+int32_t radar_shm_ring_init(radar_shm_ring_s *ring,
+                            uint32_t num_slots,
+                            uint32_t slot_size,
+                            void* (*alloc_func)(size_t size))
+{
+    if ((NULL == ring) || (NULL == alloc_func) || (0U == slot_size) ||
+        (0U == num_slots) || ((num_slots & (num_slots - 1U)) != 0U))
+    {
+        return -1;
+    }
+
+    memset(ring, 0, sizeof(radar_shm_ring_s));
+
+    ring->num_slots = num_slots;
+    ring->slot_size = slot_size;
+    ring->slot_stride = RADAR_SHM_RING_SLOT_STRIDE(slot_size);
+
+    ring->slots = (uint8_t*)alloc_func(RADAR_SHM_RING_MEM_SIZE(num_slots, slot_size));
+    if (NULL == ring->slots)
+    {
+        return -2;
+    }
+
+    RADAR_SHM_RING_BARRIER();
+
+    return 0;
+}
+
+/*
+ * Get the payload of the next free slot (producer)
+ */
+uint8_t* radar_shm_ring_claim(radar_shm_ring_s *ring)
+{
+    const uint32_t head = ring->head;
+
+    if ((head - ring->tail) >= ring->num_slots)
+    {
+        return NULL;
+    }
+
+    /* the consumer is done with the slot before it advances the tail */
+    RADAR_SHM_RING_BARRIER();
+
+    return (uint8_t*)&slot_at(ring, head)[1];
+}
+
+/*
+ * Publish the claimed slot (producer)
+ */
+void radar_shm_ring_publish(radar_shm_ring_s *ring, uint32_t length)
+{
+    const uint32_t head = ring->head;
+    radar_shm_ring_slot_s *slot = slot_at(ring, head);
+
+    slot->seq = head + ring->dropped;
+    slot->length = (length < ring->slot_size) ? length : ring->slot_size;
+
+    /* payload and header are visible before the new head */
+    RADAR_SHM_RING_BARRIER();
+
+    ring->head = head + 1U;
+}
+
+/*
+ * Count a discarded frame (producer)
+ */
+void radar_shm_ring_drop(radar_shm_ring_s *ring)
+{
+    ring->dropped = ring->dropped + 1U;
+}
+
+/*
+ * Get the oldest published slot (consumer)
+ */
+const uint8_t* radar_shm_ring_peek(const radar_shm_ring_s *ring, uint32_t *length, uint32_t *seq)
+{
+    const uint32_t tail = ring->tail;
+    const radar_shm_ring_slot_s *slot;
+
+    if (ring->head == tail)
+    {
+        return NULL;
+    }
+
+    /* slot contents are read after the head that published them */
+    RADAR_SHM_RING_BARRIER();
+
+    slot = slot_at(ring, tail);
+
+    *length = slot->length;
+    if (seq != NULL)
+    {
+        *seq = slot->seq;
+    }
+
+    return (const uint8_t*)&slot[1];
+}
+
+/*
+ * Hand the oldest published slot back to the producer (consumer)
+ */
+void radar_shm_ring_release(radar_shm_ring_s *ring)
+{
+    const uint32_t tail = ring->tail;
+
+    if (ring->head == tail)
+    {
+        return;
+    }
+
+    /* all reads of the slot complete before the producer may reuse it */
+    RADAR_SHM_RING_BARRIER();
+
+    ring->tail = tail + 1U;
+}
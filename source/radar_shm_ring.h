@@ -0,0 +1,171 @@
+/******************************************************************************
+** File name: radar_shm_ring.h
+**
+** Description: This file contains the interface of the shared-memory frame
+**   ring between the acquisition core and the processing core. The ring has
+**   exactly one producer and one consumer. The producer writes only the head
+**   index and the consumer writes only the tail index, so neither side needs
+**   a lock and the ring works across cores that share SRAM but no mutex.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_SHM_RING_H_
+#define RADAR_SHM_RING_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef RADAR_DSP_REFERENCE
+#include "cy_pdl.h"
+#endif
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_SHM_RING_BARRIER
+ * Orders the slot contents against the index updates. The data memory
+ * barrier of the Cortex-M is sufficient between CM0+ and CM4, host builds
+ * use a full compiler and CPU fence.
+ */
+#ifdef RADAR_DSP_REFERENCE
+#define RADAR_SHM_RING_BARRIER()        __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+#define RADAR_SHM_RING_BARRIER()        __DMB()
+#endif
+
+/*
+ * @def RADAR_SHM_RING_SLOT_STRIDE
+ * Bytes of one slot: header and payload, rounded up to 8 bytes
+ */
+#define RADAR_SHM_RING_SLOT_STRIDE(slot_size) \
+    ((sizeof(radar_shm_ring_slot_s) + (slot_size) + 7U) & ~7U)
+
+/*
+ * @def RADAR_SHM_RING_MEM_SIZE
+ * Bytes the ring allocates for its slots
+ */
+#define RADAR_SHM_RING_MEM_SIZE(num_slots, slot_size) \
+    ((num_slots) * RADAR_SHM_RING_SLOT_STRIDE(slot_size))
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_shm_ring_slot_s
+ * Header in front of the payload of every slot
+ */
+typedef struct {
+    uint32_t seq;                   /*<< frame number of the producer, gaps are dropped frames */
+    uint32_t length;                /*<< payload bytes */
+} radar_shm_ring_slot_s;
+
+/*
+ * @typedef typedef struct  radar_shm_ring_s
+ * Ring state. Must be placed in memory both cores can access. Head and tail
+ * count frames and wrap at 2^32, the slot is the count modulo num_slots.
+ */
+typedef struct {
+    volatile uint32_t head;         /*<< frames published, written by the producer only */
+    volatile uint32_t tail;         /*<< frames released, written by the consumer only */
+    volatile uint32_t dropped;      /*<< frames lost on a full ring, written by the producer only */
+
+    uint32_t num_slots;             /*<< power of two */
+    uint32_t slot_size;             /*<< maximum payload bytes */
+    uint32_t slot_stride;
+    uint8_t *slots;
+} radar_shm_ring_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize ring
+ *
+ * Must be called while neither side accesses the ring.
+ *
+ * @param[out] ring ring state
+ * @param[in] num_slots number of slots, a power of two
+ * @param[in] slot_size maximum payload bytes of a slot
+ * @param[in] alloc_func allocator returning memory aligned to at least 8 bytes
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid, -2 if allocation fails
+ */
+int32_t radar_shm_ring_init(radar_shm_ring_s *ring,
+                            uint32_t num_slots,
+                            uint32_t slot_size,
+                            void* (*alloc_func)(size_t size));
+
+/** @brief Get the payload of the next free slot (producer)
+ *
+ * The slot becomes visible to the consumer with \ref radar_shm_ring_publish.
+ * Calling this again before publishing returns the same slot.
+ *
+ * @param[in] ring ring state
+ *
+ * @return payload of the slot or NULL if the ring is full
+ */
+uint8_t* radar_shm_ring_claim(radar_shm_ring_s *ring);
+
+/** @brief Publish the claimed slot (producer)
+ *
+ * @param[in,out] ring ring state
+ * @param[in] length payload bytes written, at most slot_size
+ */
+void radar_shm_ring_publish(radar_shm_ring_s *ring, uint32_t length);
+
+/** @brief Count a frame that was discarded because the ring was full (producer)
+ *
+ * @param[in,out] ring ring state
+ */
+void radar_shm_ring_drop(radar_shm_ring_s *ring);
+
+/** @brief Get the oldest published slot (consumer)
+ *
+ * The slot stays valid until \ref radar_shm_ring_release.
+ *
+ * @param[in] ring ring state
+ * @param[out] length payload bytes
+ * @param[out] seq frame number of the producer, may be NULL
+ *
+ * @return payload of the slot or NULL if the ring is empty
+ */
+const uint8_t* radar_shm_ring_peek(const radar_shm_ring_s *ring, uint32_t *length, uint32_t *seq);
+
+/** @brief Hand the oldest published slot back to the producer (consumer)
+ *
+ * @param[in,out] ring ring state
+ */
+void radar_shm_ring_release(radar_shm_ring_s *ring);
+
+/** @brief Get number of published slots not yet released
+ *
+ * @param[in] ring ring state
+ *
+ * @return number of slots
+ */
+static inline uint32_t radar_shm_ring_count(const radar_shm_ring_s *ring)
+{
+    return ring->head - ring->tail;
+}
+
+#endif /* RADAR_SHM_RING_H_ */
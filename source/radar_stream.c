@@ -0,0 +1,180 @@
+/*****************************************************************************
+ * File name: radar_stream.c
+ *
+ * Description: This file implements the raw frame stream: frame hand-over
+ * with a cycle budget and the encoder task.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stddef.h>
+
+#include "radar_stream.h"
+
+/*******************************************************************************
+ * Function Name: stream_task
+ ********************************************************************************
+ * Summary:
+ *   Encoder task. Encodes every committed frame, charges its cycles to the
+ *   budget and writes the record to the sink.
+ *
+ * Parameters:
+ *   pvParameters: stream
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static __NO_RETURN void stream_task(void *pvParameters)
+{
+    radar_stream_s *stream = (radar_stream_s*)pvParameters;
+
+    for (;;)
+    {
+        uint32_t start;
+        uint32_t cycles;
+        uint32_t len;
+
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        start = radar_dsp_cycles();
+        len = radar_rice_encode(stream->frame, &stream->header, stream->record);
+        cycles = radar_dsp_cycles() - start;
+
+        radar_dsp_stats_add(&stream->stats, cycles);
+
+        /* the acquisition grants the budget from a higher priority task */
+        taskENTER_CRITICAL();
+        stream->credit -= (int32_t)cycles;
+        taskEXIT_CRITICAL();
+
+        if (len > 0U)
+        {
+            stream->sink(stream->record, len);
+            stream->encoded++;
+            stream->raw_bytes += RADAR_SAMPLE12_BYTES((uint32_t)stream->header.num_samples_per_chirp *
+                                                      stream->header.num_chirps_per_frame *
+                                                      stream->header.num_rx_antennas);
+            stream->coded_bytes += len;
+        }
+
+        stream->busy = false;
+    }
+}
+
+/*
+ * Initialize the stream
+ */
+int32_t radar_stream_init(radar_stream_s *stream, radar_stream_sink_fn sink,
+                          UBaseType_t priority, uint16_t stack_size)
+{
+    if ((stream == NULL) || (sink == NULL))
+    {
+        return -1;
+    }
+
+    stream->sink = sink;
+    stream->enabled = false;
+    stream->busy = false;
+    stream->credit = 0;
+
+    if (xTaskCreate(stream_task, "stream", stack_size, stream, priority, &stream->task) != pdPASS)
+    {
+        return -2;
+    }
+
+    return 0;
+}
+
+/*
+ * Set the encode cycles granted per frame
+ */
+void radar_stream_set_budget(radar_stream_s *stream, uint32_t budget_cycles)
+{
+    stream->budget_cycles = budget_cycles;
+}
+
+/*
+ * Enable or disable the stream
+ */
+void radar_stream_enable(radar_stream_s *stream, bool enable)
+{
+    taskENTER_CRITICAL();
+    stream->credit = 0;
+    stream->enabled = enable;
+    taskEXIT_CRITICAL();
+}
+
+/*
+ * Offer a frame to the stream
+ */
+uint8_t* radar_stream_claim(radar_stream_s *stream)
+{
+    const int32_t credit_max = (int32_t)stream->budget_cycles * RADAR_STREAM_CREDIT_FRAMES;
+
+    if (!stream->enabled)
+    {
+        return NULL;
+    }
+
+    stream->offered++;
+
+    stream->credit += (int32_t)stream->budget_cycles;
+    if (stream->credit > credit_max)
+    {
+        stream->credit = credit_max;
+    }
+
+    if (stream->busy)
+    {
+        stream->skipped_busy++;
+        return NULL;
+    }
+
+    /* take the frame only if the budget covers a frame of mean cost */
+    if (stream->credit < (int32_t)radar_dsp_stats_mean(&stream->stats))
+    {
+        stream->skipped_budget++;
+        return NULL;
+    }
+
+    return stream->frame;
+}
+
+/*
+ * Hand the copied frame to the encoder task
+ */
+void radar_stream_commit(radar_stream_s *stream, const radar_profile_s *profile)
+{
+    /* the sequence number counts offered frames, gaps are skipped frames */
+    stream->header.seq = (uint16_t)stream->offered;
+    stream->header.num_samples_per_chirp = (uint16_t)profile->num_samples_per_chirp;
+    stream->header.num_chirps_per_frame = (uint16_t)profile->num_chirps_per_frame;
+    stream->header.num_rx_antennas = (uint8_t)profile->num_rx_antennas;
+
+    stream->busy = true;
+    xTaskNotifyGive(stream->task);
+}
+
+/*
+ * Compression ratio of the written records
+ */
+float radar_stream_ratio(const radar_stream_s *stream)
+{
+    return (stream->coded_bytes > 0U) ? ((float)stream->raw_bytes / (float)stream->coded_bytes) : 0.0f;
+}
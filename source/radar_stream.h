@@ -0,0 +1,147 @@
+/******************************************************************************
+** File name: radar_stream.h
+**
+** Description: This file contains the interface of the raw frame stream.
+**   The acquisition hands a copy of a frame to the stream, a low priority
+**   task encodes it with the lossless codec and writes the record to a sink.
+**   Frames are only taken while the encoder is idle and the encode cycles
+**   spent stay within a budget per frame, so the pipeline is not delayed.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_STREAM_H_
+#define RADAR_STREAM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "radar_dsp.h"
+#include "radar_profiles.h"
+#include "radar_rice.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_STREAM_CREDIT_FRAMES
+ * Frames of unused budget the stream can save up, lets a frame above the
+ * mean through after idle frames
+ */
+#define RADAR_STREAM_CREDIT_FRAMES      (8)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef void (*radar_stream_sink_fn)(const uint8_t *data, uint32_t len)
+ * Sink prototype, called from the stream task with one record
+ */
+typedef void (*radar_stream_sink_fn)(const uint8_t *data, uint32_t len);
+
+/*
+ * @typedef typedef struct  radar_stream_s
+ * Stream state, buffers for the largest profile
+ */
+typedef struct {
+    radar_stream_sink_fn sink;
+    TaskHandle_t task;
+    volatile bool enabled;
+    volatile bool busy;             /*<< a frame is copied and not yet written to the sink */
+
+    uint32_t budget_cycles;         /*<< encode cycles granted per offered frame */
+    int32_t credit;                 /*<< budget granted and not yet spent */
+    radar_rice_header_s header;     /*<< geometry and sequence number of the copied frame */
+    uint8_t frame[RADAR_SAMPLE12_BYTES(RADAR_PROFILE_MAX_SAMPLES_PER_FRAME)];
+    uint8_t record[RADAR_RICE_RECORD_SIZE(RADAR_PROFILE_MAX_SAMPLES_PER_FRAME)];
+
+    uint32_t offered;               /*<< frames offered while enabled */
+    uint32_t encoded;               /*<< frames written to the sink */
+    uint32_t skipped_busy;          /*<< frames offered while the encoder was busy */
+    uint32_t skipped_budget;        /*<< frames offered while the budget was spent */
+    uint64_t raw_bytes;             /*<< packed bytes of the encoded frames */
+    uint64_t coded_bytes;           /*<< record bytes written to the sink */
+    radar_dsp_stats_s stats;        /*<< encode cycles per frame, including preemption */
+} radar_stream_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the stream and create its task
+ *
+ * The stream starts disabled.
+ *
+ * @param[out] stream stream state
+ * @param[in] sink receives the records
+ * @param[in] priority RTOS priority of the encoder task
+ * @param[in] stack_size stack of the encoder task in words
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid, -2 if the task cannot be created
+ */
+int32_t radar_stream_init(radar_stream_s *stream, radar_stream_sink_fn sink,
+                          UBaseType_t priority, uint16_t stack_size);
+
+/** @brief Set the encode cycles granted per offered frame
+ *
+ * @param[in,out] stream stream state
+ * @param[in] budget_cycles cycles per frame
+ */
+void radar_stream_set_budget(radar_stream_s *stream, uint32_t budget_cycles);
+
+/** @brief Enable or disable the stream
+ *
+ * @param[in,out] stream stream state
+ * @param[in] enable true to take frames
+ */
+void radar_stream_enable(radar_stream_s *stream, bool enable);
+
+/** @brief Offer a frame to the stream
+ *
+ * Called by the acquisition for every frame. If the stream takes the frame,
+ * the caller copies it in the packed 12-bit format into the returned buffer
+ * and calls \ref radar_stream_commit.
+ *
+ * @param[in,out] stream stream state
+ *
+ * @return buffer for the packed frame, NULL if the frame is not taken
+ */
+uint8_t* radar_stream_claim(radar_stream_s *stream);
+
+/** @brief Hand the copied frame to the encoder task
+ *
+ * @param[in,out] stream stream state
+ * @param[in] profile geometry of the frame
+ */
+void radar_stream_commit(radar_stream_s *stream, const radar_profile_s *profile);
+
+/** @brief Get compression ratio of the written records
+ *
+ * @param[in] stream stream state
+ *
+ * @return packed bytes per record byte, 0 if nothing was written
+ */
+float radar_stream_ratio(const radar_stream_s *stream);
+
+#endif /* RADAR_STREAM_H_ */
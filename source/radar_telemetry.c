@@ -0,0 +1,261 @@
+/*****************************************************************************
+ * File name: radar_telemetry.c
+ *
+ * Description: This file implements the encoder of the binary telemetry
+ * protocol: message layout, CRC-16 and COBS framing.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "radar_telemetry.h"
+
+/* CRC-16/CCITT-FALSE, polynomial 0x1021, four bits per step */
+static const uint16_t crc16_table[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/*******************************************************************************
+ * Function Name: cobs_encode
+ ********************************************************************************
+ * Summary:
+ *   COBS encodes a message between two zero delimiters. Every code byte
+ *   gives the distance to the next zero of the message, 0xFF a run of 254
+ *   bytes without a zero. The leading delimiter separates the message from
+ *   console text written before it.
+ *
+ * Parameters:
+ *   src: message
+ *   len: bytes of the message
+ *   dst: encoded bytes, len + len / 254 + 3 bytes
+ *
+ * Return:
+ *   bytes written to dst
+ *******************************************************************************/
+static uint32_t cobs_encode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+    uint32_t code_pos = 1;
+    uint32_t out = 2;
+    uint8_t code = 1;
+
+    dst[0] = 0U;
+
+    for (uint32_t i = 0; i < len; ++i)
+    {
+        if (src[i] == 0U)
+        {
+            dst[code_pos] = code;
+            code_pos = out++;
+            code = 1;
+        }
+        else
+        {
+            dst[out++] = src[i];
+            if (++code == 0xFFU)
+            {
+                dst[code_pos] = code;
+                code_pos = out++;
+                code = 1;
+            }
+        }
+    }
+
+    dst[code_pos] = code;
+    dst[out++] = 0U;
+
+    return out;
+}
+
+/*
+ * CRC-16/CCITT-FALSE of the bytes
+ */
+uint16_t radar_telemetry_crc16(const uint8_t *data, uint32_t len)
+{
+    uint16_t crc = 0xFFFFU;
+
+    for (uint32_t i = 0; i < len; ++i)
+    {
+        crc = (uint16_t)((crc << 4) ^ crc16_table[((crc >> 12) ^ (data[i] >> 4)) & 0x0FU]);
+        crc = (uint16_t)((crc << 4) ^ crc16_table[((crc >> 12) ^ data[i]) & 0x0FU]);
+    }
+
+    return crc;
+}
+
+/*
+ * Initialize the encoder
+ */
+int32_t radar_telemetry_init(radar_telemetry_s *telemetry, radar_telemetry_sink_fn sink)
+{
+    if ((telemetry == NULL) || (sink == NULL))
+    {
+        return -1;
+    }
+
+    memset(telemetry, 0, sizeof(*telemetry));
+    telemetry->sink = sink;
+    telemetry->mode = RADAR_TELEMETRY_MODE_TEXT;
+
+#ifndef RADAR_DSP_REFERENCE
+    telemetry->lock = xSemaphoreCreateMutex();
+    if (telemetry->lock == NULL)
+    {
+        return -2;
+    }
+#endif
+
+    return 0;
+}
+
+/*
+ * Encode and send a message
+ */
+int32_t radar_telemetry_send(radar_telemetry_s *telemetry, radar_telemetry_msg_e type,
+                             const uint8_t *payload, uint32_t len)
+{
+    uint32_t start;
+    uint32_t wire_len;
+    uint16_t crc;
+
+    if ((len > RADAR_TELEMETRY_PAYLOAD_UB) || (type >= RADAR_TELEMETRY_MSG_NUM))
+    {
+        return -1;
+    }
+
+#ifndef RADAR_DSP_REFERENCE
+    /* a low priority sender may hold the UART, drop rather than stall a stage */
+    if (xSemaphoreTake(telemetry->lock, pdMS_TO_TICKS(RADAR_TELEMETRY_LOCK_MS)) != pdTRUE)
+    {
+        telemetry->dropped++;
+        return -2;
+    }
+#endif
+
+    start = radar_dsp_cycles();
+
+    telemetry->message[0] = (uint8_t)type;
+    telemetry->message[1] = telemetry->seq++;
+    memcpy(&telemetry->message[2], payload, len);
+    crc = radar_telemetry_crc16(telemetry->message, len + 2U);
+    telemetry->message[len + 2U] = (uint8_t)crc;
+    telemetry->message[len + 3U] = (uint8_t)(crc >> 8);
+
+    wire_len = cobs_encode(telemetry->message, len + 4U, telemetry->wire);
+    telemetry->sink(telemetry->wire, wire_len);
+
+    telemetry->messages[type]++;
+    telemetry->payload_bytes += len;
+    telemetry->wire_bytes += wire_len;
+    radar_dsp_stats_add(&telemetry->stats, radar_dsp_cycles() - start);
+
+#ifndef RADAR_DSP_REFERENCE
+    xSemaphoreGive(telemetry->lock);
+#endif
+
+    return 0;
+}
+
+/*
+ * Send a gesture event
+ */
+int32_t radar_telemetry_send_gesture(radar_telemetry_s *telemetry, uint8_t gesture,
+                                     float32_t score, uint32_t timestamp_ms)
+{
+    uint8_t payload[9];
+    uint32_t score_bits;
+
+    memcpy(&score_bits, &score, sizeof(score_bits));
+
+    payload[0] = gesture;
+    radar_telemetry_put_u32(&payload[1], score_bits);
+    radar_telemetry_put_u32(&payload[5], timestamp_ms);
+
+    return radar_telemetry_send(telemetry, RADAR_TELEMETRY_MSG_GESTURE, payload, sizeof(payload));
+}
+
+/*
+ * Send the pipeline metrics
+ */
+int32_t radar_telemetry_send_metrics(radar_telemetry_s *telemetry, const radar_telemetry_metrics_s *metrics)
+{
+    uint8_t payload[25];
+
+    radar_telemetry_put_u32(&payload[0], metrics->timestamp_ms);
+    radar_telemetry_put_u32(&payload[4], metrics->frames);
+    radar_telemetry_put_u32(&payload[8], metrics->deadline_misses);
+    radar_telemetry_put_u32(&payload[12], metrics->latency_mean);
+    radar_telemetry_put_u32(&payload[16], metrics->latency_max);
+    radar_telemetry_put_u32(&payload[20], metrics->dropped);
+    payload[24] = metrics->shed_level;
+
+    return radar_telemetry_send(telemetry, RADAR_TELEMETRY_MSG_METRICS, payload, sizeof(payload));
+}
+
+/*
+ * Send a trace event
+ */
+int32_t radar_telemetry_send_trace(radar_telemetry_s *telemetry, radar_telemetry_trace_e event,
+                                   uint32_t arg, uint32_t cycles)
+{
+    uint8_t payload[10];
+
+    payload[0] = (uint8_t)event;
+    payload[1] = (uint8_t)((uint32_t)event >> 8);
+    radar_telemetry_put_u32(&payload[2], arg);
+    radar_telemetry_put_u32(&payload[6], cycles);
+
+    return radar_telemetry_send(telemetry, RADAR_TELEMETRY_MSG_TRACE, payload, sizeof(payload));
+}
+
+/*
+ * Send a frame record in chunks
+ */
+int32_t radar_telemetry_send_frame(radar_telemetry_s *telemetry, const uint8_t *record, uint32_t len)
+{
+    const uint32_t chunk_ub = RADAR_TELEMETRY_PAYLOAD_UB - RADAR_TELEMETRY_CHUNK_HEADER_SIZE;
+    const uint16_t number = telemetry->frame_records++;
+    uint8_t payload[RADAR_TELEMETRY_PAYLOAD_UB];
+    int32_t result = 0;
+
+    for (uint32_t offset = 0; offset < len; offset += chunk_ub)
+    {
+        const uint32_t chunk = ((len - offset) < chunk_ub) ? (len - offset) : chunk_ub;
+
+        payload[0] = (uint8_t)number;
+        payload[1] = (uint8_t)(number >> 8);
+        radar_telemetry_put_u32(&payload[2], offset);
+        radar_telemetry_put_u32(&payload[6], len);
+        memcpy(&payload[RADAR_TELEMETRY_CHUNK_HEADER_SIZE], &record[offset], chunk);
+
+        /* the chunk is taken under the lock, other messages go out in between */
+        if (radar_telemetry_send(telemetry, RADAR_TELEMETRY_MSG_FRAME, payload,
+                                 RADAR_TELEMETRY_CHUNK_HEADER_SIZE + chunk) != 0)
+        {
+            /* the receiver discards the incomplete record */
+            result = -2;
+            break;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,289 @@
+/******************************************************************************
+** File name: radar_telemetry.h
+**
+** Description: This file contains the binary telemetry protocol of the debug
+**   UART. Every message is a type, a sequence number, a little endian payload
+**   and a CRC-16, COBS encoded between zero bytes, so a receiver can start
+**   anywhere in the stream and discards damaged messages and console text.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_TELEMETRY_H_
+#define RADAR_TELEMETRY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "radar_dsp.h"
+
+#ifndef RADAR_DSP_REFERENCE
+#include "FreeRTOS.h"
+#include "semphr.h"
+#endif
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_TELEMETRY_PAYLOAD_UB
+ * Largest payload of a message, frame records are sent in chunks
+ */
+#define RADAR_TELEMETRY_PAYLOAD_UB          (200U)
+
+/*
+ * @def RADAR_TELEMETRY_CHUNK_HEADER_SIZE
+ * Bytes in front of the data of a frame chunk: record number, offset and
+ * length of the record
+ */
+#define RADAR_TELEMETRY_CHUNK_HEADER_SIZE   (10U)
+
+/*
+ * @def RADAR_TELEMETRY_WIRE_UB
+ * Largest encoded message: type, sequence number, payload and CRC, one
+ * COBS code byte per started 254 bytes and the delimiters on both sides
+ */
+#define RADAR_TELEMETRY_WIRE_UB             (2U + RADAR_TELEMETRY_PAYLOAD_UB + 2U + 2U + 2U)
+
+/*
+ * @def RADAR_TELEMETRY_LOCK_MS
+ * Time a sender waits for the UART before the message is dropped
+ */
+#define RADAR_TELEMETRY_LOCK_MS             (50U)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_telemetry_mode_e
+ * Output format of the results on the debug UART
+ */
+typedef enum
+{
+    RADAR_TELEMETRY_MODE_TEXT = 0,      /*<< printf text, raw frame records unframed */
+    RADAR_TELEMETRY_MODE_BINARY = 1     /*<< every output is a telemetry message */
+} radar_telemetry_mode_e;
+
+/*
+ * @def enum radar_telemetry_msg_e
+ * Message types, the payload layouts are little endian without padding
+ */
+typedef enum
+{
+    RADAR_TELEMETRY_MSG_GESTURE = 1,    /*<< class u8, score f32, timestamp_ms u32 */
+    RADAR_TELEMETRY_MSG_METRICS = 2,    /*<< timestamp_ms u32, frames u32, deadline_misses u32,
+                                             latency_mean u32, latency_max u32 (cycles), dropped u32,
+                                             shed_level u8 */
+    RADAR_TELEMETRY_MSG_TRACE = 3,      /*<< event u16, arg u32, cycles u32 */
+    RADAR_TELEMETRY_MSG_FRAME = 4,      /*<< record u16, offset u32, record_len u32, data */
+    RADAR_TELEMETRY_MSG_NUM
+} radar_telemetry_msg_e;
+
+/*
+ * @def enum radar_telemetry_trace_e
+ * Events of trace messages
+ */
+typedef enum
+{
+    RADAR_TELEMETRY_TRACE_RUN_STATE = 1,    /*<< arg: radar_run_state_e entered */
+    RADAR_TELEMETRY_TRACE_SHED_LEVEL = 2    /*<< arg: radar_pipeline_shed_e entered */
+} radar_telemetry_trace_e;
+
+/*
+ * @typedef typedef struct  radar_telemetry_gesture_s
+ * Gesture event
+ */
+typedef struct {
+    uint8_t gesture;
+    float32_t score;
+    uint32_t timestamp_ms;
+} radar_telemetry_gesture_s;
+
+/*
+ * @typedef typedef struct  radar_telemetry_metrics_s
+ * Pipeline metrics
+ */
+typedef struct {
+    uint32_t timestamp_ms;
+    uint32_t frames;
+    uint32_t deadline_misses;
+    uint32_t latency_mean;          /*<< cycles */
+    uint32_t latency_max;           /*<< cycles */
+    uint32_t dropped;
+    uint8_t shed_level;
+} radar_telemetry_metrics_s;
+
+/*
+ * @typedef typedef struct  radar_telemetry_trace_s
+ * Trace event
+ */
+typedef struct {
+    uint16_t event;
+    uint32_t arg;
+    uint32_t cycles;
+} radar_telemetry_trace_s;
+
+/*
+ * @typedef typedef void (*radar_telemetry_sink_fn)(const uint8_t *data, uint32_t len)
+ * Sink prototype, called with the encoded bytes of a message
+ */
+typedef void (*radar_telemetry_sink_fn)(const uint8_t *data, uint32_t len);
+
+/*
+ * @typedef typedef struct  radar_telemetry_s
+ * Encoder state, shared by all senders
+ */
+typedef struct {
+    radar_telemetry_sink_fn sink;
+    volatile radar_telemetry_mode_e mode;
+#ifndef RADAR_DSP_REFERENCE
+    SemaphoreHandle_t lock;             /*<< serializes the messages of the senders */
+#endif
+    uint8_t seq;
+    uint16_t frame_records;             /*<< frame records sent */
+    uint8_t message[2U + RADAR_TELEMETRY_PAYLOAD_UB + 2U];
+    uint8_t wire[RADAR_TELEMETRY_WIRE_UB];
+
+    uint32_t messages[RADAR_TELEMETRY_MSG_NUM]; /*<< messages sent per type */
+    uint32_t dropped;                   /*<< messages dropped while the UART was taken */
+    uint64_t payload_bytes;
+    uint64_t wire_bytes;
+    radar_dsp_stats_s stats;            /*<< cycles per message, including the sink */
+} radar_telemetry_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the encoder
+ *
+ * The telemetry starts in the text mode.
+ *
+ * @param[out] telemetry encoder state
+ * @param[in] sink receives the encoded messages
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid, -2 if the lock cannot be created
+ */
+int32_t radar_telemetry_init(radar_telemetry_s *telemetry, radar_telemetry_sink_fn sink);
+
+/** @brief Check if the results are sent as messages
+ *
+ * @param[in] telemetry encoder state
+ *
+ * @return true in the binary mode
+ */
+static inline bool radar_telemetry_binary(const radar_telemetry_s *telemetry)
+{
+    return (telemetry->mode == RADAR_TELEMETRY_MODE_BINARY);
+}
+
+/** @brief Encode and send a message
+ *
+ * @param[in,out] telemetry encoder state
+ * @param[in] type radar_telemetry_msg_e
+ * @param[in] payload payload bytes
+ * @param[in] len bytes of the payload
+ *
+ * @return zero (0) on success, -1 if the payload is too large, -2 if the
+ *         message was dropped because the UART stayed taken
+ */
+int32_t radar_telemetry_send(radar_telemetry_s *telemetry, radar_telemetry_msg_e type,
+                             const uint8_t *payload, uint32_t len);
+
+/** @brief Send a gesture event
+ *
+ * @param[in,out] telemetry encoder state
+ * @param[in] gesture class index
+ * @param[in] score score of the class
+ * @param[in] timestamp_ms time of the detection
+ *
+ * @return see \ref radar_telemetry_send
+ */
+int32_t radar_telemetry_send_gesture(radar_telemetry_s *telemetry, uint8_t gesture,
+                                     float32_t score, uint32_t timestamp_ms);
+
+/** @brief Send the pipeline metrics
+ *
+ * @param[in,out] telemetry encoder state
+ * @param[in] metrics metrics
+ *
+ * @return see \ref radar_telemetry_send
+ */
+int32_t radar_telemetry_send_metrics(radar_telemetry_s *telemetry, const radar_telemetry_metrics_s *metrics);
+
+/** @brief Send a trace event
+ *
+ * @param[in,out] telemetry encoder state
+ * @param[in] event radar_telemetry_trace_e
+ * @param[in] arg event argument
+ * @param[in] cycles cycle counter of the event
+ *
+ * @return see \ref radar_telemetry_send
+ */
+int32_t radar_telemetry_send_trace(radar_telemetry_s *telemetry, radar_telemetry_trace_e event,
+                                   uint32_t arg, uint32_t cycles);
+
+/** @brief Send a frame record in chunks
+ *
+ * Other senders can interleave their messages between the chunks.
+ *
+ * @param[in,out] telemetry encoder state
+ * @param[in] record frame record
+ * @param[in] len bytes of the record
+ *
+ * @return zero (0) on success, -2 if a chunk was dropped
+ */
+int32_t radar_telemetry_send_frame(radar_telemetry_s *telemetry, const uint8_t *record, uint32_t len);
+
+/** @brief Calculate the CRC-16/CCITT-FALSE of the bytes
+ *
+ * @param[in] data bytes
+ * @param[in] len number of bytes
+ *
+ * @return CRC
+ */
+uint16_t radar_telemetry_crc16(const uint8_t *data, uint32_t len);
+
+/** @brief Store a value in little endian order
+ *
+ * @param[out] dst 4 bytes
+ * @param[in] value value
+ */
+static inline void radar_telemetry_put_u32(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8);
+    dst[2] = (uint8_t)(value >> 16);
+    dst[3] = (uint8_t)(value >> 24);
+}
+
+/** @brief Load a value stored in little endian order
+ *
+ * @param[in] src 4 bytes
+ *
+ * @return value
+ */
+static inline uint32_t radar_telemetry_get_u32(const uint8_t *src)
+{
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+#endif /* RADAR_TELEMETRY_H_ */
@@ -0,0 +1,204 @@
+/*****************************************************************************
+ * File name: radar_uart_tx.c
+ *
+ * Description: This file implements the transmit ring of the debug UART.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "radar_uart_tx.h"
+
+/* writers and the completion interrupt share the indices, the host build is single threaded */
+#ifdef RADAR_DSP_REFERENCE
+#define TX_LOCK()                   do { } while (0)
+#define TX_UNLOCK()                 do { } while (0)
+#define TX_LOCK_FROM_ISR()          (0U)
+#define TX_UNLOCK_FROM_ISR(state)   ((void)(state))
+#define TX_DELAY()                  do { } while (0)
+#else
+#define TX_LOCK()                   taskENTER_CRITICAL()
+#define TX_UNLOCK()                 taskEXIT_CRITICAL()
+#define TX_LOCK_FROM_ISR()          taskENTER_CRITICAL_FROM_ISR()
+#define TX_UNLOCK_FROM_ISR(state)   taskEXIT_CRITICAL_FROM_ISR(state)
+#define TX_DELAY()                  vTaskDelay(1)
+#endif
+
+/*******************************************************************************
+ * Function Name: start_next
+ ********************************************************************************
+ * Summary:
+ *   Starts a transfer of the bytes from the tail up to the head or the end
+ *   of the ring if no transfer is running. Called with the lock held.
+ *
+ * Parameters:
+ *   tx: ring state
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void start_next(radar_uart_tx_s *tx)
+{
+    const uint32_t offset = tx->tail & (RADAR_UART_TX_RING_SIZE - 1U);
+    uint32_t len = tx->head - tx->tail;
+
+    if ((tx->in_flight != 0U) || (len == 0U))
+    {
+        return;
+    }
+
+    if (len > (RADAR_UART_TX_RING_SIZE - offset))
+    {
+        len = RADAR_UART_TX_RING_SIZE - offset;
+    }
+
+    tx->in_flight = len;
+    if (tx->start(tx->ctx, &tx->ring[offset], len) != 0)
+    {
+        /* retried by the next write */
+        tx->in_flight = 0;
+        tx->start_errors++;
+        return;
+    }
+    tx->transfers++;
+}
+
+/*******************************************************************************
+ * Function Name: copy_in
+ ********************************************************************************
+ * Summary:
+ *   Copies bytes to the head of the ring, wrapping at its end. Called with
+ *   the lock held and enough space.
+ *
+ * Parameters:
+ *   tx: ring state
+ *   data: bytes
+ *   len: number of bytes
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void copy_in(radar_uart_tx_s *tx, const uint8_t *data, uint32_t len)
+{
+    const uint32_t offset = tx->head & (RADAR_UART_TX_RING_SIZE - 1U);
+    const uint32_t first = ((RADAR_UART_TX_RING_SIZE - offset) < len) ? (RADAR_UART_TX_RING_SIZE - offset) : len;
+
+    memcpy(&tx->ring[offset], data, first);
+    memcpy(tx->ring, &data[first], len - first);
+
+    tx->head += len;
+    tx->written += len;
+    if ((tx->head - tx->tail) > tx->level_max)
+    {
+        tx->level_max = tx->head - tx->tail;
+    }
+}
+
+/*
+ * Initialize the ring
+ */
+int32_t radar_uart_tx_init(radar_uart_tx_s *tx, radar_uart_tx_start_fn start, void *ctx)
+{
+    if ((tx == NULL) || (start == NULL))
+    {
+        return -1;
+    }
+
+    memset(tx, 0, sizeof(*tx));
+    tx->start = start;
+    tx->ctx = ctx;
+
+    return 0;
+}
+
+/*
+ * Write bytes without waiting on the UART
+ */
+uint32_t radar_uart_tx_write(radar_uart_tx_s *tx, const uint8_t *data, uint32_t len,
+                             radar_uart_tx_policy_e policy, TickType_t wait)
+{
+    uint32_t taken = 0;
+    bool waited = false;
+
+    if ((policy == RADAR_UART_TX_ATOMIC) && (len > RADAR_UART_TX_RING_SIZE))
+    {
+        wait = 0;
+    }
+
+    for (;;)
+    {
+        uint32_t space;
+        uint32_t chunk;
+
+        TX_LOCK();
+        space = RADAR_UART_TX_RING_SIZE - (tx->head - tx->tail);
+        chunk = ((len - taken) < space) ? (len - taken) : space;
+
+        if ((policy == RADAR_UART_TX_ATOMIC) && (chunk < len))
+        {
+            chunk = 0;
+        }
+
+        if (chunk > 0U)
+        {
+            copy_in(tx, &data[taken], chunk);
+            taken += chunk;
+        }
+        start_next(tx);
+
+        if ((taken == len) || (wait == 0U))
+        {
+            if (taken < len)
+            {
+                tx->dropped += len - taken;
+                tx->dropped_writes++;
+            }
+            if (waited)
+            {
+                tx->waits++;
+            }
+            TX_UNLOCK();
+            break;
+        }
+        TX_UNLOCK();
+
+        /* the UART drains about a byte every 87 us at 115200 baud */
+        TX_DELAY();
+        wait--;
+        waited = true;
+    }
+
+    return taken;
+}
+
+/*
+ * Report the completion of the running transfer
+ */
+void radar_uart_tx_done(radar_uart_tx_s *tx)
+{
+    const uint32_t state = TX_LOCK_FROM_ISR();
+
+    tx->tail += tx->in_flight;
+    tx->in_flight = 0;
+    start_next(tx);
+
+    TX_UNLOCK_FROM_ISR(state);
+}
@@ -0,0 +1,144 @@
+/******************************************************************************
+** File name: radar_uart_tx.h
+**
+** Description: This file contains the transmit ring of the debug UART.
+**   Writers copy into the ring and return, the ring is drained by
+**   asynchronous transfers (DMA or the TX FIFO interrupt) that are chained
+**   from the transfer completion. A writer that finds the ring full waits
+**   only as long as it allows, the rest is dropped and counted.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_UART_TX_H_
+#define RADAR_UART_TX_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef RADAR_DSP_REFERENCE
+#include "FreeRTOS.h"
+#include "task.h"
+#else
+typedef uint32_t TickType_t;
+#endif
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_UART_TX_RING_SIZE
+ * Bytes of the ring, a power of two. Holds about 0.35 s of output at 115200 baud.
+ */
+#define RADAR_UART_TX_RING_SIZE             (4096U)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_uart_tx_policy_e
+ * Handling of a write that does not fit into the ring
+ */
+typedef enum
+{
+    RADAR_UART_TX_TRUNCATE = 0,     /*<< take what fits, drop the rest, for console text */
+    RADAR_UART_TX_ATOMIC = 1        /*<< take all or nothing, for framed messages */
+} radar_uart_tx_policy_e;
+
+/*
+ * @typedef typedef int32_t (*radar_uart_tx_start_fn)(void *ctx, const uint8_t *data, uint32_t len)
+ * Starts an asynchronous transfer of contiguous ring bytes. The completion
+ * has to be reported by \ref radar_uart_tx_done. Returns zero on success.
+ */
+typedef int32_t (*radar_uart_tx_start_fn)(void *ctx, const uint8_t *data, uint32_t len);
+
+/*
+ * @typedef typedef struct  radar_uart_tx_s
+ * Ring state and counters
+ */
+typedef struct {
+    radar_uart_tx_start_fn start;
+    void *ctx;                      /*<< passed to start */
+
+    uint8_t ring[RADAR_UART_TX_RING_SIZE];
+    volatile uint32_t head;         /*<< free running, advanced by the writers */
+    volatile uint32_t tail;         /*<< free running, advanced on completion */
+    volatile uint32_t in_flight;    /*<< bytes of the running transfer, 0 if idle */
+
+    uint32_t written;               /*<< bytes taken */
+    uint32_t dropped;               /*<< bytes dropped on a full ring */
+    uint32_t dropped_writes;        /*<< writes that lost bytes */
+    uint32_t waits;                 /*<< writes that waited for space */
+    uint32_t transfers;             /*<< transfers started */
+    uint32_t start_errors;          /*<< transfers that could not be started */
+    uint32_t level_max;             /*<< highest fill level in bytes */
+} radar_uart_tx_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the ring
+ *
+ * @param[out] tx ring state
+ * @param[in] start starts a transfer
+ * @param[in] ctx context passed to start
+ *
+ * @return zero (0) on success, -1 if the parameters are not valid
+ */
+int32_t radar_uart_tx_init(radar_uart_tx_s *tx, radar_uart_tx_start_fn start, void *ctx);
+
+/** @brief Write bytes without waiting on the UART
+ *
+ * Safe to call from several tasks. A write waits for space in steps of a
+ * tick for at most wait ticks, zero never blocks.
+ *
+ * @param[in,out] tx ring state
+ * @param[in] data bytes to send
+ * @param[in] len number of bytes
+ * @param[in] policy handling of bytes that do not fit
+ * @param[in] wait ticks to wait for space
+ *
+ * @return bytes taken
+ */
+uint32_t radar_uart_tx_write(radar_uart_tx_s *tx, const uint8_t *data, uint32_t len,
+                             radar_uart_tx_policy_e policy, TickType_t wait);
+
+/** @brief Report the completion of the running transfer
+ *
+ * Called from the transfer interrupt, starts the next transfer.
+ *
+ * @param[in,out] tx ring state
+ */
+void radar_uart_tx_done(radar_uart_tx_s *tx);
+
+/** @brief Get bytes waiting in the ring, including the running transfer
+ *
+ * @param[in] tx ring state
+ *
+ * @return number of bytes
+ */
+static inline uint32_t radar_uart_tx_level(const radar_uart_tx_s *tx)
+{
+    return tx->head - tx->tail;
+}
+
+#endif /* RADAR_UART_TX_H_ */
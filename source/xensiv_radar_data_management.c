@@ -270,47 +270,7 @@ radar_data_manager_run()
             }
         }
 
-        // now adjust queue if all the subscribers tasks have consumed the data
-        bool adjust_queue = true;
-        for (int sub = 1; sub <= ACTIVE_SUBSCRIPTION_UB; sub++)
-        {
-            if ((NULL != manager.subscriptions[sub].suscriber_task_handle) &&
-                (manager.subscriptions[sub].data_read == false))
-            {
-                adjust_queue = false;
-            }
-        }
-
-        if (adjust_queue == true)
-        {
-            // now adjust the queue by fill level
-            // considering reader has read all data till fill level
-            manager.head += manager.fill_level;
-
-            //move the buffer to front by amount data already read
-            if (manager.head >0)
-            {
-                uint32_t sz = (manager.tail - manager.head);
-
-                //move the buffer for new data
-                memcpy(manager.buffer, (manager.buffer + manager.head), sz);
-
-                manager.tail = sz;
-
-                manager.head = 0;
-
-
-            }
-            for (int sub = 1; sub <= ACTIVE_SUBSCRIPTION_UB; sub++)
-            {
-
-                if (manager.subscriptions[sub].data_read == true )
-                {
-                    manager.subscriptions[sub].data_read = false;
-                }
-            }
-
-        }
+        // the data is consumed when all subscribers acknowledged it, see consume()
 
 #else
         //now inform all subscribers about available data
@@ -362,6 +322,39 @@ radar_data_manager_run()
 
 #ifdef FREERTOS_AWARE
 
+/*
+ * drop the oldest fill levels from the queue, called in a critical section
+ * while no subscriber reads the buffer
+ */
+static void consume(uint32_t fill_levels)
+{
+    manager.head += fill_levels * manager.fill_level;
+
+    for (int sub = 1; sub <= ACTIVE_SUBSCRIPTION_UB; sub++)
+    {
+        manager.subscriptions[sub].data_read = false;
+    }
+
+    if (manager.head == manager.tail)
+    {
+        // empty, start at the front again without moving anything
+        manager.head = 0;
+        manager.tail = 0;
+    }
+    else
+    {
+        // move the unread data to the front, the next read finds the room behind it
+        uint32_t sz = (manager.tail - manager.head);
+
+        memmove(manager.buffer, (manager.buffer + manager.head), sz);
+
+        manager.tail = sz;
+        manager.head = 0;
+    }
+
+    manager.samples = manager.tail - manager.head;
+}
+
 /*
  * read from RDM data buffer
  */
@@ -378,7 +371,9 @@ radar_data_manager_read_buffer(int32_t subscription_id, uint16_t **data_ptr, uin
         return -2;
     }
 
-    if (NULL != manager.subscriptions[subscription_id].suscriber_task_handle)
+    // the subscriber read this data already, the others have not acknowledged it yet
+    if ((NULL != manager.subscriptions[subscription_id].suscriber_task_handle) &&
+        (manager.subscriptions[subscription_id].data_read == false))
     {
         *data_ptr = (uint16_t*) (manager.buffer + manager.head);
 
@@ -404,8 +399,76 @@ radar_data_manager_ack_data_read(int32_t subscription_id)
         return;
     }
 
+    taskENTER_CRITICAL();
+
     manager.subscriptions[subscription_id].data_read = true;
 
+    // the data is consumed once all subscribers have read it
+    bool all_read = (manager.samples >= manager.fill_level);
+    for (int sub = 1; sub <= ACTIVE_SUBSCRIPTION_UB; sub++)
+    {
+        if ((NULL != manager.subscriptions[sub].suscriber_task_handle) &&
+            (manager.subscriptions[sub].data_read == false))
+        {
+            all_read = false;
+        }
+    }
+
+    if (all_read)
+    {
+        consume(1U);
+    }
+
+    taskEXIT_CRITICAL();
+}
+
+/*
+ * number of fill levels buffered
+ */
+uint32_t
+radar_data_manager_get_buffered(void)
+{
+    if ((NULL == manager.buffer) || (0U == manager.fill_level))
+    {
+        return 0;
+    }
+
+    return manager.samples / manager.fill_level;
+}
+
+/*
+ * discard the oldest buffered data
+ */
+uint32_t
+radar_data_manager_discard(uint32_t keep)
+{
+    uint32_t discarded = 0;
+
+    if (NULL == manager.buffer)
+    {
+        return 0;
+    }
+
+    taskENTER_CRITICAL();
+
+    uint32_t buffered = manager.samples / manager.fill_level;
+    if (buffered > keep)
+    {
+        discarded = buffered - keep;
+        consume(discarded);
+    }
+    else
+    {
+        // nothing to drop, the data kept is read again by every subscriber
+        for (int sub = 1; sub <= ACTIVE_SUBSCRIPTION_UB; sub++)
+        {
+            manager.subscriptions[sub].data_read = false;
+        }
+    }
+
+    taskEXIT_CRITICAL();
+
+    return discarded;
 }
 
 #endif
@@ -510,6 +573,10 @@ radar_data_manager_init(radar_data_manager_s* mgr_interface, uint32_t buffer_siz
     mgr_interface->read_from_buffer = radar_data_manager_read_buffer;
 
     mgr_interface->ack_data_read = radar_data_manager_ack_data_read;
+
+    mgr_interface->get_buffered = radar_data_manager_get_buffered;
+
+    mgr_interface->discard = radar_data_manager_discard;
 #endif
 
     manager_interface = mgr_interface;
@@ -113,15 +113,37 @@ int32_t (*read_from_buffer)(int32_t subscription_id, uint16_t **data_ptr, uint32
 /** @brief Provided interface:Acknowledge to RDM that the subscriber has read the data from buffer
  *
  * Subscriber task shall notify RDM by calling this function, that it has finished reading the data from buffer
- * Once all subscribers finish reading data, RDM would then manage the internal queue accordingly.
- * @note The old data in the buffer will persist until all subscribers acknowledge their respective data reads
- *          However on arrival of new data
+ * Once all subscribers finish reading data, RDM consumes the oldest fill level of the queue and the next
+ * read returns the data after it.
+ * @note The old data in the buffer will persist until all subscribers acknowledge their respective data reads.
+ *       Until then \ref read_from_buffer fails for a subscriber that has acknowledged already.
  * @param[in] subscription_id subscribers' identifier
  *
  * @return Nothing
  */
 void (*ack_data_read)(int32_t subscription_id);
 
+/** @brief Provided interface:Get the amount of buffered data
+ *
+ * Notifications of the subscriber task may coalesce, the subscriber shall read and acknowledge
+ * until this returns zero.
+ *
+ * @return number of fill levels buffered and not consumed yet
+ */
+uint32_t (*get_buffered)(void);
+
+/** @brief Provided interface:Discard the oldest buffered data
+ *
+ * Consumes the oldest fill levels without reading them, regardless of the acknowledges of the
+ * subscribers, and resets the read state of all subscribers.
+ * @note No subscriber may read the buffer meanwhile, the remaining data is moved to the front.
+ *
+ * @param[in] keep number of the newest fill levels to keep, zero (0) flushes the buffer
+ *
+ * @return number of fill levels discarded
+ */
+uint32_t (*discard)(uint32_t keep);
+
 /** @brief Provided interface:Schedule radar data manager to run
  *
  * Subscriber task shall schedule the RDM by calling this method. This is generally done on
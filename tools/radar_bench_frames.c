@@ -0,0 +1,197 @@
+/*****************************************************************************
+ * File name: radar_bench_frames.c
+ *
+ * Description: Host tool writing the canned frames of the stage benchmark
+ * of radar_bench.h as C source. The frames are synthesized like
+ * radar_fmcw_gen does, consecutive frames from the middle of the first
+ * gesture of the scene, so the stages after the range FFT see a moving
+ * hand. They are stored in the packed 12-bit format of the sensor FIFO.
+ *
+ * Build: gcc -O2 -DRADAR_DSP_REFERENCE -Isource -Itools
+ *            tools/radar_bench_frames.c tools/radar_fmcw_gen.c
+ *            source/radar_sample12.c -lm -o radar_bench_frames
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "radar_fmcw_gen.h"
+#include "radar_sample12.h"
+#include "radar_bench.h"
+
+/* bytes per line of the generated source */
+#define BYTES_PER_LINE              (16U)
+
+/* samples of a canned frame */
+#define NUM_SAMPLES \
+    (RADAR_BENCH_NUM_SAMPLES_PER_CHIRP * RADAR_BENCH_NUM_CHIRPS_PER_FRAME * RADAR_BENCH_NUM_RX_ANTENNAS)
+
+/*******************************************************************************
+ * Function Name: first_gesture
+ ********************************************************************************
+ * Summary:
+ *   Finds the first run of frames of a gesture in the scene
+ *
+ * Return:
+ *   zero (0) if a gesture was found within the period of the scene
+ *******************************************************************************/
+static int first_gesture(const radar_fmcw_gen_scene_s *scene, uint64_t *first, uint64_t *last)
+{
+    const uint64_t num_frames = (uint64_t)(scene->period_s / scene->chirp.frame_repetition_s);
+    uint64_t frame = 0;
+
+    while ((frame < num_frames) && (radar_fmcw_gen_label(scene, frame) == RADAR_FMCW_GEN_BACKGROUND))
+    {
+        frame++;
+    }
+    if (frame == num_frames)
+    {
+        return -1;
+    }
+
+    *first = frame;
+    while ((frame < num_frames) && (radar_fmcw_gen_label(scene, frame) != RADAR_FMCW_GEN_BACKGROUND))
+    {
+        frame++;
+    }
+    *last = frame - 1U;
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    static radar_fmcw_gen_scene_s scene;
+    static uint16_t samples[NUM_SAMPLES];
+    static uint8_t packed[RADAR_BENCH_FRAME_BYTES];
+    const char *out_path = "source/radar_bench_frames.c";
+    uint32_t seed = 0;
+    uint64_t first;
+    uint64_t last;
+    uint64_t start;
+    FILE *f;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:r:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'o':
+                out_path = optarg;
+                break;
+            case 'r':
+                seed = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-o source/radar_bench_frames.c] [-r seed]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    radar_fmcw_gen_default_scene(&scene);
+    if (seed != 0U)
+    {
+        scene.seed = seed;
+    }
+
+    if ((scene.chirp.num_samples_per_chirp != RADAR_BENCH_NUM_SAMPLES_PER_CHIRP) ||
+        (scene.chirp.num_chirps_per_frame != RADAR_BENCH_NUM_CHIRPS_PER_FRAME) ||
+        (scene.chirp.num_rx_antennas != RADAR_BENCH_NUM_RX_ANTENNAS))
+    {
+        fprintf(stderr, "the chirps of radar_settings.h do not match the frames of radar_bench.h\n");
+        return 1;
+    }
+
+    if (first_gesture(&scene, &first, &last) != 0)
+    {
+        fprintf(stderr, "the scene has no gesture\n");
+        return 1;
+    }
+    /* centered on the middle of the gesture */
+    start = (first + last) / 2U;
+    start = (start > (RADAR_BENCH_FRAMES / 2U)) ? (start - (RADAR_BENCH_FRAMES / 2U)) : 0U;
+
+    f = fopen(out_path, "w");
+    if (f == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", out_path);
+        return 1;
+    }
+
+    fprintf(f, "/*****************************************************************************\n"
+               " * File name: radar_bench_frames.c\n"
+               " *\n"
+               " * Description: This file contains the canned frames of the stage benchmark\n"
+               " * of radar_bench.h. It is generated by tools/radar_bench_frames.c, do not\n"
+               " * edit.\n"
+               " *\n"
+               " * Frames %llu to %llu of %s, seed %u.\n"
+               " *\n"
+               " * ===========================================================================\n"
+               " * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.\n"
+               " * ===========================================================================\n"
+               " *\n"
+               " * ===========================================================================\n"
+               " * Infineon Technologies AG (INFINEON) is supplying this file for use\n"
+               " * exclusively with Infineon's sensor products. This file can be freely\n"
+               " * distributed within development tools and software supporting such\n"
+               " * products.\n"
+               " *\n"
+               " * THIS SOFTWARE IS PROVIDED \"AS IS\".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED\n"
+               " * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF\n"
+               " * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.\n"
+               " * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,\n"
+               " * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON\n"
+               " * WHATSOEVER.\n"
+               " * ===========================================================================\n"
+               " */\n"
+               "\n"
+               "#include \"radar_bench.h\"\n"
+               "\n"
+               "const uint8_t radar_bench_frames[RADAR_BENCH_FRAMES][RADAR_BENCH_FRAME_BYTES] =\n"
+               "{\n",
+            (unsigned long long)start, (unsigned long long)(start + RADAR_BENCH_FRAMES - 1U),
+            radar_fmcw_gen_gesture_name(radar_fmcw_gen_label(&scene, first)), scene.seed);
+
+    for (uint32_t i = 0; i < RADAR_BENCH_FRAMES; ++i)
+    {
+        radar_fmcw_gen_frame(&scene, start + i, samples);
+        radar_sample12_pack(samples, packed, NUM_SAMPLES);
+
+        fprintf(f, "    {\n");
+        for (uint32_t j = 0; j < RADAR_BENCH_FRAME_BYTES; ++j)
+        {
+            const char *separator = (j == (RADAR_BENCH_FRAME_BYTES - 1U)) ? "\n" :
+                                    (((j % BYTES_PER_LINE) == (BYTES_PER_LINE - 1U)) ? ",\n" : ",");
+
+            fprintf(f, "%s0x%02x%s", ((j % BYTES_PER_LINE) == 0U) ? "        " : " ", packed[j], separator);
+        }
+        fprintf(f, "    }%s\n", (i == (RADAR_BENCH_FRAMES - 1U)) ? "" : ",");
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+
+    printf("%u frames of %s written to %s\n", RADAR_BENCH_FRAMES,
+           radar_fmcw_gen_gesture_name(radar_fmcw_gen_label(&scene, first)), out_path);
+
+    return 0;
+}
@@ -0,0 +1,261 @@
+/*****************************************************************************
+ * File name: radar_config_store_sim.c
+ *
+ * Description: Host simulation of the configuration store on a file that
+ * stands in for the flash rows of the emulated EEPROM region. Saves records
+ * of changing settings, tears some of the writes at a random byte like a
+ * reset during programming would, then loads the store from the file again
+ * like a boot does and checks that the newest complete record is found. It
+ * reports the writes per slot, the load time and any mismatch.
+ *
+ * Build: gcc -O2 -DRADAR_DSP_REFERENCE -Isource tools/radar_config_store_sim.c
+ *            source/radar_config_store.c -o radar_config_store_sim
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "radar_config_store.h"
+
+/* bytes of a flash row of the PSoC 6 */
+#define SLOT_SIZE                   (512U)
+
+/* payload of the simulated settings, the size of the record of main.c */
+#define PAYLOAD_SIZE                (72U)
+#define PAYLOAD_VERSION             (1U)
+
+/* one save in TEAR_ONE_IN is torn */
+#define TEAR_ONE_IN                 (8U)
+
+/*
+ * @typedef typedef struct  sim_file_s
+ * File backend
+ */
+typedef struct {
+    FILE *f;
+    uint32_t num_slots;
+    uint32_t tear_at;               /*<< bytes of the next write reaching the file, UINT32_MAX for all */
+    uint32_t writes[RADAR_CONFIG_STORE_SLOTS_MAX];
+} sim_file_s;
+
+/*******************************************************************************
+ * Function Name: file_read
+ ********************************************************************************
+ * Summary:
+ *   Read function of the store
+ *******************************************************************************/
+static int32_t file_read(void *ctx, uint32_t offset, void *data, uint32_t len)
+{
+    sim_file_s *file = (sim_file_s*)ctx;
+
+    if ((fseek(file->f, (long)offset, SEEK_SET) != 0) || (fread(data, 1, len, file->f) != len))
+    {
+        return -2;
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: file_write
+ ********************************************************************************
+ * Summary:
+ *   Write function of the store. The slot is erased to zeros like a flash
+ *   row, then the record is programmed up to the tear point.
+ *******************************************************************************/
+static int32_t file_write(void *ctx, uint32_t slot, const void *data, uint32_t len)
+{
+    sim_file_s *file = (sim_file_s*)ctx;
+    uint8_t row[SLOT_SIZE] = { 0U };
+    const uint32_t programmed = (len < file->tear_at) ? len : file->tear_at;
+
+    if ((slot >= file->num_slots) || (len > SLOT_SIZE))
+    {
+        return -1;
+    }
+
+    memcpy(row, data, programmed);
+    file->writes[slot]++;
+
+    if ((fseek(file->f, (long)(slot * SLOT_SIZE), SEEK_SET) != 0) ||
+        (fwrite(row, 1, SLOT_SIZE, file->f) != SLOT_SIZE) || (fflush(file->f) != 0))
+    {
+        return -2;
+    }
+
+    /* the reset hits before the write completes */
+    return (programmed == len) ? 0 : -2;
+}
+
+/*******************************************************************************
+ * Function Name: now_ns
+ ********************************************************************************
+ * Summary:
+ *   Monotonic time in nanoseconds
+ *******************************************************************************/
+static uint64_t now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+int main(int argc, char **argv)
+{
+    static sim_file_s file;
+    radar_config_store_backend_s backend;
+    radar_config_store_s store;
+    uint8_t expected[PAYLOAD_SIZE] = { 0U };
+    uint8_t payload[PAYLOAD_SIZE];
+    uint8_t loaded[PAYLOAD_SIZE];
+    const char *path = "radar_config_store.bin";
+    uint32_t saves = 1000U;
+    uint32_t seed = 1U;
+    uint32_t torn = 0;
+    uint32_t mismatches = 0;
+    uint32_t writes_min = UINT32_MAX;
+    uint32_t writes_max = 0;
+    uint64_t load_ns = 0;
+    bool have_expected = false;
+    int opt;
+
+    file.num_slots = 8U;
+
+    while ((opt = getopt(argc, argv, "f:s:n:r:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'f':
+                path = optarg;
+                break;
+            case 's':
+                file.num_slots = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                saves = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                seed = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            default:
+                saves = 0;
+                break;
+        }
+    }
+
+    if ((saves == 0U) || (file.num_slots < 2U) || (file.num_slots > RADAR_CONFIG_STORE_SLOTS_MAX) ||
+        (optind != argc))
+    {
+        fprintf(stderr, "usage: %s [-f file] [-s slots] [-n saves] [-r seed]\n", argv[0]);
+        return 2;
+    }
+    srand(seed);
+
+    /* a new file is erased flash */
+    file.f = fopen(path, "w+b");
+    if (file.f == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    for (uint32_t i = 0; i < (file.num_slots * SLOT_SIZE); ++i)
+    {
+        fputc(0, file.f);
+    }
+
+    backend.ctx = &file;
+    backend.num_slots = file.num_slots;
+    backend.slot_size = SLOT_SIZE;
+    backend.read = file_read;
+    backend.write = file_write;
+
+    if ((radar_config_store_init(&store, &backend) != 0) ||
+        (radar_config_store_load(&store, PAYLOAD_VERSION, loaded, sizeof(loaded)) != -2))
+    {
+        fprintf(stderr, "erased store not empty\n");
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < saves; ++i)
+    {
+        uint64_t start;
+        int32_t result;
+
+        for (uint32_t j = 0; j < PAYLOAD_SIZE; ++j)
+        {
+            payload[j] = (uint8_t)rand();
+        }
+
+        file.tear_at = ((uint32_t)rand() % TEAR_ONE_IN == 0U) ?
+                       ((uint32_t)rand() % RADAR_CONFIG_STORE_RECORD_SIZE(PAYLOAD_SIZE)) : UINT32_MAX;
+        result = radar_config_store_save(&store, PAYLOAD_VERSION, payload, sizeof(payload));
+        if (result == 0)
+        {
+            memcpy(expected, payload, sizeof(expected));
+            have_expected = true;
+        }
+        else
+        {
+            torn++;
+        }
+
+        /* reset: the store is loaded from the file again */
+        start = now_ns();
+        result = radar_config_store_init(&store, &backend);
+        if (result == 0)
+        {
+            result = radar_config_store_load(&store, PAYLOAD_VERSION, loaded, sizeof(loaded));
+        }
+        load_ns += now_ns() - start;
+
+        if ((have_expected && ((result != 0) || (memcmp(loaded, expected, sizeof(loaded)) != 0))) ||
+            (!have_expected && (result != -2)))
+        {
+            mismatches++;
+        }
+    }
+
+    /* a record of another layout is not loaded */
+    if (have_expected && (radar_config_store_load(&store, PAYLOAD_VERSION + 1U, loaded, sizeof(loaded)) != -2))
+    {
+        mismatches++;
+    }
+
+    for (uint32_t slot = 0; slot < file.num_slots; ++slot)
+    {
+        writes_min = (file.writes[slot] < writes_min) ? file.writes[slot] : writes_min;
+        writes_max = (file.writes[slot] > writes_max) ? file.writes[slot] : writes_max;
+    }
+
+    printf("%u saves, %u torn, into %u slots of %u bytes: %s\n", saves, torn, file.num_slots, SLOT_SIZE,
+           (mismatches == 0U) ? "newest complete record loaded after every reset" : "MISMATCH");
+    printf("writes per slot min %u max %u, sequence %u, load %.1f us, mismatches %u\n",
+           writes_min, writes_max, store.sequence, (double)load_ns / saves / 1000.0, mismatches);
+
+    fclose(file.f);
+
+    return (mismatches == 0U) ? 0 : 1;
+}
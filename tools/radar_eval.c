@@ -0,0 +1,820 @@
+/*****************************************************************************
+ * File name: radar_eval.c
+ *
+ * Description: Host tool evaluating the gesture chain on labelled
+ * recordings. Every worker thread owns a complete chain, clutter map, range
+ * FFT, range-Doppler and angle-of-arrival stages, an instance of the
+ * selected inference backend and the decision of the application, in its
+ * own arena. Recordings are dealt to the workers, which steal from each
+ * other when they run out. The tool reports the confusion matrix of the
+ * labelled gestures, the latency from the start of a gesture to its event
+ * per class, the RAM and time per frame of the backend and the frames per
+ * second of every worker. The decision can vote on events over the last
+ * frames (-m, -w) to compare thresholds and windows on the same recordings.
+ *
+ * The labels of name.raw are read from name.txt, one run of frames per
+ * line as first frame, last frame and gesture name, as written by
+ * radar_fmcw_gen.
+ *
+ * Build: gcc -O2 -pthread -DRADAR_DSP_REFERENCE -Isource -Itools
+ *            tools/radar_eval.c tools/radar_fmcw_gen.c source/radar_sample12.c
+ *            source/radar_clutter_map.c source/radar_range_fft.c
+ *            source/radar_range_doppler.c source/radar_aoa.c
+ *            source/radar_motion.c source/radar_decision.c
+ *            source/radar_inference.c source/radar_nn.c
+ *            source/radar_nn_model.c -lm -o radar_eval
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "radar_settings.h"
+#include "radar_sample12.h"
+#include "radar_clutter_map.h"
+#include "radar_range_fft.h"
+#include "radar_range_doppler.h"
+#include "radar_aoa.h"
+#include "radar_decision.h"
+#include "radar_inference.h"
+#include "radar_fmcw_gen.h"
+
+/* upper bound of worker threads and of gestures labelled in a recording */
+#define THREADS_UB                  (64U)
+#define RUNS_UB                     (65536U)
+
+/* frames after the end of a gesture in which its event still counts */
+#define MATCH_FRAMES                (15U)
+
+/* arena alignment and padding, one alignment unit per allocation */
+#define ARENA_ALIGN                 (8U)
+#define ARENA_PADDING               (ARENA_ALIGN * 32U)
+
+#define NUM_CLASSES                 RADAR_DECISION_NUM_CLASSES
+
+/*
+ * @typedef typedef struct  label_run_s
+ * Labelled gesture
+ */
+typedef struct {
+    uint64_t first;
+    uint64_t last;
+    uint32_t gesture;
+    uint32_t matched;
+} label_run_s;
+
+/*
+ * @typedef typedef struct  results_s
+ * Results of a worker, summed up at the end
+ */
+typedef struct {
+    uint64_t confusion[NUM_CLASSES][NUM_CLASSES];   /*<< [label][event], background row are false events */
+    uint64_t latency_frames[NUM_CLASSES];           /*<< sum over the matched gestures */
+    uint64_t latency_count[NUM_CLASSES];
+    uint64_t latency_max[NUM_CLASSES];
+    uint64_t frames;
+    radar_dsp_stats_s inference;                    /*<< thread CPU nanoseconds of the backend per frame */
+    uint32_t recordings;
+    uint32_t stolen;
+    double cpu_s;
+} results_s;
+
+/*
+ * @typedef typedef struct  chain_s
+ * Gesture chain of a worker, nothing is shared with the other workers
+ */
+typedef struct {
+    uint8_t *arena;
+    size_t arena_size;
+    size_t arena_used;
+
+    uint8_t *raw;
+    float32_t *frame;
+    radar_clutter_map_s clutter_map;
+    radar_range_fft_s range_fft;
+    radar_range_doppler_s range_doppler;
+    radar_aoa_s aoa;
+    void *backend_state;
+    radar_decision_s decision;
+} chain_s;
+
+/*
+ * @typedef typedef struct  deque_s
+ * Recordings of a worker, the owner takes from the tail and thieves from the head
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t *items;
+    uint32_t head;
+    uint32_t tail;
+} deque_s;
+
+/*
+ * @typedef typedef struct  worker_s
+ * Worker thread
+ */
+typedef struct {
+    pthread_t thread;
+    uint32_t id;
+    deque_s deque;
+    chain_s chain;
+    results_s results;
+} worker_s;
+
+static struct {
+    char **paths;
+    long *file_sizes;
+    uint32_t num_recordings;
+    uint32_t num_samples_per_chirp;
+    uint32_t num_chirps_per_frame;
+    uint32_t num_rx_antennas;
+    const radar_inference_backend_s *backend;
+    int packed;
+    float32_t threshold;
+    radar_decision_vote_s vote;
+    worker_s *workers;
+    uint32_t num_workers;
+} eval;
+
+static const bool detect_list[NUM_CLASSES] = { false, true, true, true, false, false, true, true };
+
+/* arena of the chain initialized by the calling thread */
+static _Thread_local chain_s *alloc_chain;
+
+/*******************************************************************************
+ * Function Name: thread_ns
+ ********************************************************************************
+ * Summary:
+ *   CPU time of the calling thread, the process clock of radar_dsp_cycles()
+ *   counts all workers
+ *******************************************************************************/
+static uint64_t thread_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+/*******************************************************************************
+ * Function Name: chain_alloc
+ ********************************************************************************
+ * Summary:
+ *   Allocator of the stages, takes memory from the arena of the worker
+ *   calling it
+ *******************************************************************************/
+static void *chain_alloc(size_t size)
+{
+    chain_s *chain = alloc_chain;
+    void *ptr;
+
+    size = (size + ARENA_ALIGN - 1U) & ~((size_t)ARENA_ALIGN - 1U);
+    if ((chain->arena_used + size) > chain->arena_size)
+    {
+        return NULL;
+    }
+
+    ptr = &chain->arena[chain->arena_used];
+    chain->arena_used += size;
+
+    return ptr;
+}
+
+/*******************************************************************************
+ * Function Name: chain_init
+ ********************************************************************************
+ * Summary:
+ *   Initializes the chain of a worker for a new recording, like the
+ *   application after power up
+ *
+ * Return:
+ *   0 on success, -1 otherwise
+ *******************************************************************************/
+static int32_t chain_init(chain_s *chain)
+{
+    const uint32_t samples = eval.num_samples_per_chirp;
+    const uint32_t chirps = eval.num_chirps_per_frame;
+    const uint32_t antennas = eval.num_rx_antennas;
+    const uint32_t num_samples = samples * chirps * antennas;
+
+    if (chain->arena == NULL)
+    {
+        chain->arena_size = (num_samples * sizeof(float32_t)) + RADAR_SAMPLE12_BYTES(num_samples) +
+                            (num_samples * sizeof(uint16_t)) +
+                            RADAR_CLUTTER_MAP_MEM_SIZE(samples, antennas) +
+                            RADAR_RANGE_FFT_MEM_SIZE(samples, chirps, antennas) +
+                            RADAR_RANGE_DOPPLER_MEM_SIZE(chirps, samples / 2U, RANGE_DOPPLER_NUM_DOPPLER_BINS_UB) +
+                            RADAR_AOA_MEM_SIZE(chirps, samples / 2U) +
+                            radar_inference_backend_ram(eval.backend, samples, chirps, antennas) + ARENA_PADDING;
+        chain->arena = aligned_alloc(ARENA_ALIGN, (chain->arena_size + ARENA_ALIGN - 1U) & ~((size_t)ARENA_ALIGN - 1U));
+        if (chain->arena == NULL)
+        {
+            return -1;
+        }
+    }
+
+    alloc_chain = chain;
+    chain->arena_used = 0;
+
+    chain->frame = chain_alloc(num_samples * sizeof(float32_t));
+    chain->raw = chain_alloc(eval.packed ? RADAR_SAMPLE12_BYTES(num_samples) : (num_samples * sizeof(uint16_t)));
+
+    memset(&chain->clutter_map, 0, sizeof(chain->clutter_map));
+    memset(&chain->range_doppler, 0, sizeof(chain->range_doppler));
+    chain->clutter_map.requested_mode = RADAR_CLUTTER_MAP_MODE_LEARN;
+
+    if ((chain->frame == NULL) || (chain->raw == NULL) ||
+        (radar_clutter_map_init(&chain->clutter_map, samples, chirps, antennas, chain_alloc) != 0) ||
+        (radar_range_fft_init(&chain->range_fft, samples, chirps, antennas, chain_alloc) != 0) ||
+        (radar_range_doppler_init(&chain->range_doppler, chirps, chain->range_fft.num_range_bins, chain_alloc) != 0) ||
+        (radar_aoa_init(&chain->aoa, chirps, chain->range_fft.num_range_bins, chain_alloc) != 0))
+    {
+        return -1;
+    }
+
+    chain->backend_state = NULL;
+    if (eval.backend->state_size > 0U)
+    {
+        chain->backend_state = chain_alloc(eval.backend->state_size);
+        if (chain->backend_state == NULL)
+        {
+            return -1;
+        }
+    }
+
+    if (eval.backend->init(chain->backend_state, samples, chirps, antennas, chain_alloc) != 0)
+    {
+        return -1;
+    }
+
+    radar_decision_init(&chain->decision, detect_list, RADAR_DECISION_HOLD_FRAMES);
+
+    return radar_decision_set_vote(&chain->decision, &eval.vote);
+}
+
+/*******************************************************************************
+ * Function Name: chain_run
+ ********************************************************************************
+ * Summary:
+ *   Runs the chain on the raw frame of the worker
+ *
+ * Parameters:
+ *   chain: chain of the worker
+ *   idx: receives the class of the event
+ *   stats: receives the time spent in the backend
+ *
+ * Return:
+ *   non-zero if the frame fired an event
+ *******************************************************************************/
+static int chain_run(chain_s *chain, uint32_t *idx, radar_dsp_stats_s *stats)
+{
+    const uint32_t num_samples = eval.num_samples_per_chirp * eval.num_chirps_per_frame * eval.num_rx_antennas;
+    const radar_inference_input_s input = {
+        .frame = chain->frame,
+        .range_fft = &chain->range_fft,
+        .range_doppler = &chain->range_doppler,
+        .aoa = &chain->aoa
+    };
+    radar_inference_result_s result;
+    uint64_t start;
+
+    if (eval.packed)
+    {
+        radar_sample12_deinterleave(chain->raw, chain->frame, num_samples, eval.num_rx_antennas);
+    }
+    else
+    {
+        const uint16_t *raw = (const uint16_t*)chain->raw;
+        const uint32_t samples_per_antenna = num_samples / eval.num_rx_antennas;
+
+        for (uint32_t i = 0; i < num_samples; ++i)
+        {
+            chain->frame[((i % eval.num_rx_antennas) * samples_per_antenna) + (i / eval.num_rx_antennas)] =
+                (float32_t)raw[i];
+        }
+    }
+
+    radar_clutter_map_run(&chain->clutter_map, chain->frame);
+    radar_range_fft_run(&chain->range_fft, chain->frame);
+    radar_range_doppler_run(&chain->range_doppler, &chain->range_fft);
+    radar_aoa_run(&chain->aoa, &chain->range_fft);
+
+    start = thread_ns();
+    eval.backend->run(chain->backend_state, &input, &result);
+    radar_dsp_stats_add(stats, (uint32_t)(thread_ns() - start));
+    *idx = result.idx;
+
+    /* keep the hand out of the background while a gesture is performed */
+    if ((*idx != 0U) && (result.score > eval.threshold))
+    {
+        radar_clutter_map_hold(&chain->clutter_map, RADAR_DECISION_HOLD_FRAMES);
+    }
+
+    return radar_decision_run(&chain->decision, *idx, result.score, eval.threshold) == RADAR_DECISION_EVENT;
+}
+
+/*******************************************************************************
+ * Function Name: load_labels
+ ********************************************************************************
+ * Summary:
+ *   Reads the labelled gestures of a recording from the file next to it
+ *
+ * Return:
+ *   number of gestures, -1 if the labels cannot be read
+ *******************************************************************************/
+static int32_t load_labels(const char *recording, label_run_s *runs)
+{
+    char path[1024];
+    char line[256];
+    const char *dot = strrchr(recording, '.');
+    const size_t stem = ((dot != NULL) && (strchr(dot, '/') == NULL)) ? (size_t)(dot - recording) : strlen(recording);
+    int32_t count = 0;
+    FILE *f;
+
+    if ((stem + 5U) > sizeof(path))
+    {
+        return -1;
+    }
+    memcpy(path, recording, stem);
+    strcpy(&path[stem], ".txt");
+
+    f = fopen(path, "r");
+    if (f == NULL)
+    {
+        return -1;
+    }
+
+    while ((fgets(line, sizeof(line), f) != NULL) && (count < (int32_t)RUNS_UB))
+    {
+        unsigned long long first;
+        unsigned long long last;
+        char name[32];
+
+        if (sscanf(line, "%llu %llu %31s", &first, &last, name) != 3)
+        {
+            continue;
+        }
+
+        for (uint32_t i = 1; i < NUM_CLASSES; ++i)
+        {
+            if (strcmp(name, radar_fmcw_gen_gesture_name((radar_fmcw_gen_gesture_e)i)) == 0)
+            {
+                runs[count].first = first;
+                runs[count].last = last;
+                runs[count].gesture = i;
+                runs[count].matched = 0;
+                count++;
+            }
+        }
+    }
+
+    fclose(f);
+
+    return count;
+}
+
+/*******************************************************************************
+ * Function Name: evaluate_recording
+ ********************************************************************************
+ * Summary:
+ *   Runs a recording through the chain of a worker. An event within a
+ *   labelled gesture, or up to MATCH_FRAMES after it, counts for the first
+ *   unmatched gesture; other events are false events.
+ *******************************************************************************/
+static void evaluate_recording(worker_s *worker, uint32_t index, label_run_s *runs)
+{
+    chain_s *chain = &worker->chain;
+    results_s *results = &worker->results;
+    const uint32_t num_samples = eval.num_samples_per_chirp * eval.num_chirps_per_frame * eval.num_rx_antennas;
+    const size_t frame_bytes = eval.packed ? RADAR_SAMPLE12_BYTES(num_samples) : (num_samples * sizeof(uint16_t));
+    const int32_t num_runs = load_labels(eval.paths[index], runs);
+    FILE *f = fopen(eval.paths[index], "rb");
+    int32_t run = 0;
+    uint64_t frame = 0;
+
+    if ((f == NULL) || (num_runs < 0) || (chain_init(chain) != 0))
+    {
+        fprintf(stderr, "skipping %s: cannot read the recording or its labels\n", eval.paths[index]);
+        if (f != NULL)
+        {
+            fclose(f);
+        }
+        return;
+    }
+
+    while (fread(chain->raw, frame_bytes, 1, f) == 1U)
+    {
+        uint32_t idx;
+
+        if (chain_run(chain, &idx, &results->inference))
+        {
+            /* gestures ended too long ago cannot match any more */
+            while ((run < num_runs) && ((runs[run].last + MATCH_FRAMES) < frame))
+            {
+                run++;
+            }
+
+            if ((run < num_runs) && (runs[run].first <= frame) && !runs[run].matched)
+            {
+                const uint64_t latency = frame - runs[run].first + 1U;
+
+                runs[run].matched = 1;
+                results->confusion[runs[run].gesture][idx]++;
+                results->latency_frames[idx] += (runs[run].gesture == idx) ? latency : 0U;
+                results->latency_count[idx] += (runs[run].gesture == idx) ? 1U : 0U;
+                if ((runs[run].gesture == idx) && (latency > results->latency_max[idx]))
+                {
+                    results->latency_max[idx] = latency;
+                }
+            }
+            else
+            {
+                results->confusion[0][idx]++;
+            }
+        }
+        frame++;
+    }
+
+    for (int32_t i = 0; i < num_runs; ++i)
+    {
+        if (!runs[i].matched && (runs[i].last < frame))
+        {
+            results->confusion[runs[i].gesture][0]++;
+        }
+    }
+
+    results->frames += frame;
+    results->recordings++;
+    fclose(f);
+}
+
+/*******************************************************************************
+ * Function Name: take_work
+ ********************************************************************************
+ * Summary:
+ *   Takes the next recording of a worker, or steals the oldest one of
+ *   another worker when its own deque is empty
+ *
+ * Return:
+ *   index of the recording, -1 when all recordings are taken
+ *******************************************************************************/
+static int32_t take_work(worker_s *worker)
+{
+    int32_t index = -1;
+
+    pthread_mutex_lock(&worker->deque.lock);
+    if (worker->deque.tail > worker->deque.head)
+    {
+        index = (int32_t)worker->deque.items[--worker->deque.tail];
+    }
+    pthread_mutex_unlock(&worker->deque.lock);
+
+    for (uint32_t i = 1; (index < 0) && (i < eval.num_workers); ++i)
+    {
+        deque_s *victim = &eval.workers[(worker->id + i) % eval.num_workers].deque;
+
+        pthread_mutex_lock(&victim->lock);
+        if (victim->tail > victim->head)
+        {
+            index = (int32_t)victim->items[victim->head++];
+            worker->results.stolen++;
+        }
+        pthread_mutex_unlock(&victim->lock);
+    }
+
+    return index;
+}
+
+/*******************************************************************************
+ * Function Name: worker_run
+ ********************************************************************************
+ * Summary:
+ *   Evaluates recordings until none is left
+ *******************************************************************************/
+static void *worker_run(void *arg)
+{
+    worker_s *worker = (worker_s*)arg;
+    label_run_s *runs = malloc(RUNS_UB * sizeof(label_run_s));
+    struct timespec start;
+    struct timespec end;
+    int32_t index;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
+
+    while ((runs != NULL) && ((index = take_work(worker)) >= 0))
+    {
+        evaluate_recording(worker, (uint32_t)index, runs);
+    }
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
+    worker->results.cpu_s = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) * 1e-9);
+
+    free(runs);
+    free(worker->chain.arena);
+
+    return NULL;
+}
+
+/*******************************************************************************
+ * Function Name: compare_size
+ ********************************************************************************
+ * Summary:
+ *   Orders recordings by decreasing file size
+ *******************************************************************************/
+static int compare_size(const void *a, const void *b)
+{
+    const long sa = eval.file_sizes[*(const uint32_t*)a];
+    const long sb = eval.file_sizes[*(const uint32_t*)b];
+
+    return (sa < sb) ? 1 : ((sa > sb) ? -1 : 0);
+}
+
+/*******************************************************************************
+ * Function Name: print_results
+ ********************************************************************************
+ * Summary:
+ *   Prints the summed results of the workers
+ *******************************************************************************/
+static void print_results(const results_s *total, double wall_s)
+{
+    const double frame_ms = XENSIV_BGT60TRXX_CONF_FRAME_REPETITION_TIME_S * 1000.0;
+    uint64_t labelled = 0;
+    uint64_t correct = 0;
+    uint64_t false_events = 0;
+
+    printf("\nconfusion (rows labelled, columns reported):\n%12s", "");
+    for (uint32_t j = 0; j < NUM_CLASSES; ++j)
+    {
+        if ((j == 0U) || detect_list[j])
+        {
+            printf(" %11s", (j == 0U) ? "missed" : radar_fmcw_gen_gesture_name((radar_fmcw_gen_gesture_e)j));
+        }
+    }
+    printf("\n");
+
+    for (uint32_t i = 0; i < NUM_CLASSES; ++i)
+    {
+        if ((i != 0U) && !detect_list[i])
+        {
+            continue;
+        }
+
+        printf("%12s", (i == 0U) ? "false" : radar_fmcw_gen_gesture_name((radar_fmcw_gen_gesture_e)i));
+        for (uint32_t j = 0; j < NUM_CLASSES; ++j)
+        {
+            if ((j == 0U) || detect_list[j])
+            {
+                printf(" %11llu", (unsigned long long)total->confusion[i][j]);
+            }
+            labelled += (i != 0U) ? total->confusion[i][j] : 0U;
+            false_events += (i == 0U) ? total->confusion[i][j] : 0U;
+        }
+        correct += (i != 0U) ? total->confusion[i][i] : 0U;
+        printf("\n");
+    }
+
+    printf("\ngestures %llu, correct %llu (%.1f %%), false events %llu (%.2f per hour)\n",
+           (unsigned long long)labelled, (unsigned long long)correct,
+           (labelled > 0U) ? (100.0 * (double)correct / (double)labelled) : 0.0,
+           (unsigned long long)false_events,
+           (total->frames > 0U) ? ((double)false_events * 3600000.0 / ((double)total->frames * frame_ms)) : 0.0);
+
+    printf("\nlatency from gesture start to event:\n");
+    for (uint32_t i = 1; i < NUM_CLASSES; ++i)
+    {
+        if (detect_list[i] && (total->latency_count[i] > 0U))
+        {
+            printf("%12s mean %6.0f ms, max %6.0f ms\n", radar_fmcw_gen_gesture_name((radar_fmcw_gen_gesture_e)i),
+                   frame_ms * (double)total->latency_frames[i] / (double)total->latency_count[i],
+                   frame_ms * (double)total->latency_max[i]);
+        }
+    }
+
+    printf("\nbackend %s: ram %zu bytes, %.1f us per frame mean, %.1f us max\n", eval.backend->name,
+           radar_inference_backend_ram(eval.backend, eval.num_samples_per_chirp, eval.num_chirps_per_frame,
+                                       eval.num_rx_antennas),
+           (double)radar_dsp_stats_mean(&total->inference) * 1e-3, (double)total->inference.cycles_max * 1e-3);
+
+    printf("\nworkers:\n");
+    for (uint32_t w = 0; w < eval.num_workers; ++w)
+    {
+        const results_s *r = &eval.workers[w].results;
+
+        printf("%4u: %5u recordings (%u stolen), %9llu frames, %8.0f frames/s\n", w, r->recordings, r->stolen,
+               (unsigned long long)r->frames, (r->cpu_s > 0.0) ? ((double)r->frames / r->cpu_s) : 0.0);
+    }
+    printf("%llu frames in %.2f s: %.0f frames/s, %.0f x real time\n", (unsigned long long)total->frames, wall_s,
+           (double)total->frames / wall_s, ((double)total->frames * frame_ms) / (wall_s * 1000.0));
+}
+
+int main(int argc, char **argv)
+{
+    static results_s total;
+    static const char *mode_names[RADAR_DECISION_MODE_NUM] = { "frame", "vote", "integral" };
+    const radar_decision_vote_s vote = RADAR_DECISION_VOTE_DEFAULT;
+    radar_decision_s decision;
+    uint32_t num_threads = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t *order;
+    struct timespec start;
+    struct timespec end;
+    int opt;
+
+    eval.packed = 1;
+    eval.threshold = 0.6f;
+    eval.vote = vote;
+    eval.num_samples_per_chirp = XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP;
+    eval.num_chirps_per_frame = XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME;
+    eval.num_rx_antennas = XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS;
+    eval.backend = radar_inference_backend_find(RADAR_INFERENCE_BACKEND_DEFAULT);
+
+    while ((opt = getopt(argc, argv, "t:f:d:g:b:m:w:")) != -1)
+    {
+        switch (opt)
+        {
+            case 't':
+                num_threads = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                eval.packed = (strcmp(optarg, "u16") == 0) ? 0 : ((strcmp(optarg, "packed") == 0) ? 1 : -1);
+                break;
+            case 'd':
+                eval.threshold = strtof(optarg, NULL);
+                break;
+            case 'g':
+                if (sscanf(optarg, "%u,%u,%u", &eval.num_samples_per_chirp, &eval.num_chirps_per_frame,
+                           &eval.num_rx_antennas) != 3)
+                {
+                    eval.packed = -1;
+                }
+                break;
+            case 'b':
+                eval.backend = radar_inference_backend_find(optarg);
+                break;
+            case 'm':
+                eval.vote.mode = RADAR_DECISION_MODE_NUM;
+                for (uint32_t mode = 0; mode < RADAR_DECISION_MODE_NUM; ++mode)
+                {
+                    if (strcmp(optarg, mode_names[mode]) == 0)
+                    {
+                        eval.vote.mode = (radar_decision_mode_e)mode;
+                    }
+                }
+                break;
+            case 'w':
+                if (sscanf(optarg, "%u,%u,%f,%f", &eval.vote.window, &eval.vote.votes, &eval.vote.score,
+                           &eval.vote.integral) != 4)
+                {
+                    eval.packed = -1;
+                }
+                break;
+            default:
+                eval.packed = -1;
+                break;
+        }
+    }
+
+    radar_decision_init(&decision, detect_list, RADAR_DECISION_HOLD_FRAMES);
+    if ((optind >= argc) || (eval.packed < 0) || (num_threads == 0U) || (num_threads > THREADS_UB) ||
+        (radar_decision_set_vote(&decision, &eval.vote) != 0))
+    {
+        fprintf(stderr, "usage: %s [-t threads] [-f packed|u16] [-d threshold] [-g samples,chirps,antennas] "
+                "[-b backend] [-m frame|vote|integral] [-w window,votes,score,integral] <recording.raw>...\n",
+                argv[0]);
+        return 2;
+    }
+
+    /* every worker runs an instance of its own */
+    if ((eval.backend == NULL) || eval.backend->single_instance ||
+        !eval.backend->compatible(eval.num_samples_per_chirp, eval.num_chirps_per_frame, eval.num_rx_antennas))
+    {
+        fprintf(stderr, "backend not available, one of:");
+        for (uint32_t i = 0; i < radar_inference_backend_count(); ++i)
+        {
+            if (!radar_inference_backend_get(i)->single_instance)
+            {
+                fprintf(stderr, " %s", radar_inference_backend_get(i)->name);
+            }
+        }
+        fprintf(stderr, "\n");
+        return 2;
+    }
+
+    eval.paths = &argv[optind];
+    eval.num_recordings = (uint32_t)(argc - optind);
+    eval.num_workers = (num_threads < eval.num_recordings) ? num_threads : eval.num_recordings;
+    eval.workers = calloc(eval.num_workers, sizeof(worker_s));
+    order = malloc(eval.num_recordings * sizeof(uint32_t));
+    eval.file_sizes = malloc(eval.num_recordings * sizeof(long));
+    if ((eval.workers == NULL) || (order == NULL) || (eval.file_sizes == NULL))
+    {
+        return 1;
+    }
+
+    /* the longest recordings are dealt first, so the stealing evens out the short tail */
+    for (uint32_t i = 0; i < eval.num_recordings; ++i)
+    {
+        FILE *f = fopen(eval.paths[i], "rb");
+
+        eval.file_sizes[i] = 0;
+        if ((f != NULL) && (fseek(f, 0, SEEK_END) == 0))
+        {
+            eval.file_sizes[i] = ftell(f);
+        }
+        if (f != NULL)
+        {
+            fclose(f);
+        }
+        order[i] = i;
+    }
+    qsort(order, eval.num_recordings, sizeof(uint32_t), compare_size);
+
+    for (uint32_t w = 0; w < eval.num_workers; ++w)
+    {
+        worker_s *worker = &eval.workers[w];
+
+        worker->id = w;
+        worker->deque.items = malloc(eval.num_recordings * sizeof(uint32_t));
+        if (worker->deque.items == NULL)
+        {
+            return 1;
+        }
+        pthread_mutex_init(&worker->deque.lock, NULL);
+    }
+    /* dealt in reverse, the owner takes from the tail */
+    for (uint32_t i = eval.num_recordings; i-- > 0U;)
+    {
+        deque_s *deque = &eval.workers[i % eval.num_workers].deque;
+
+        deque->items[deque->tail++] = order[i];
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t w = 0; w < eval.num_workers; ++w)
+    {
+        pthread_create(&eval.workers[w].thread, NULL, worker_run, &eval.workers[w]);
+    }
+    for (uint32_t w = 0; w < eval.num_workers; ++w)
+    {
+        pthread_join(eval.workers[w].thread, NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    for (uint32_t w = 0; w < eval.num_workers; ++w)
+    {
+        const results_s *r = &eval.workers[w].results;
+
+        for (uint32_t i = 0; i < NUM_CLASSES; ++i)
+        {
+            for (uint32_t j = 0; j < NUM_CLASSES; ++j)
+            {
+                total.confusion[i][j] += r->confusion[i][j];
+            }
+            total.latency_frames[i] += r->latency_frames[i];
+            total.latency_count[i] += r->latency_count[i];
+            total.latency_max[i] = (r->latency_max[i] > total.latency_max[i]) ? r->latency_max[i] : total.latency_max[i];
+        }
+        total.frames += r->frames;
+        total.inference.frames += r->inference.frames;
+        total.inference.cycles_total += r->inference.cycles_total;
+        total.inference.cycles_max = (r->inference.cycles_max > total.inference.cycles_max) ?
+                                     r->inference.cycles_max : total.inference.cycles_max;
+        total.recordings += r->recordings;
+    }
+
+    printf("%u of %u recordings evaluated by %u workers, threshold %.2f\n",
+           total.recordings, eval.num_recordings, eval.num_workers, eval.threshold);
+    if (eval.vote.mode == RADAR_DECISION_MODE_VOTE)
+    {
+        printf("decision: %u of %u frames scoring above %.2f\n", eval.vote.votes, eval.vote.window,
+               eval.vote.score);
+    }
+    else if (eval.vote.mode == RADAR_DECISION_MODE_INTEGRAL)
+    {
+        printf("decision: scores over %u frames summing above %.2f\n", eval.vote.window, eval.vote.integral);
+    }
+    print_results(&total, (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) * 1e-9));
+
+    return (total.recordings == eval.num_recordings) ? 0 : 1;
+}
@@ -0,0 +1,543 @@
+/*****************************************************************************
+ * File name: radar_fmcw_gen.c
+ *
+ * Description: This file implements the generator of synthetic radar
+ * frames: gesture trajectories, the IF signal of the reflectors on every
+ * receive antenna, noise and the script parser.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "radar_fmcw_gen.h"
+#include "radar_settings.h"
+#include "radar_sample12.h"
+
+/* speed of light in m/s */
+#define SPEED_OF_LIGHT              (299792458.0)
+
+/* mid-scale of the ADC */
+#define ADC_OFFSET                  (2048.0)
+
+/* travel of the hand during a gesture in meters */
+#define PUSH_TRAVEL_M               (0.10f)
+#define SWIPE_TRAVEL_M              (0.15f)
+
+/* reflectors of a frame: the hand and the clutter */
+#define REFLECTORS_UB               (RADAR_FMCW_GEN_CLUTTER_UB + 1U)
+
+/*
+ * @typedef typedef struct  reflector_s
+ * Reflector seen by one chirp
+ */
+typedef struct {
+    double range_m;
+    double sin_azimuth;
+    double sin_elevation;
+    double amplitude;
+} reflector_s;
+
+/*
+ * @typedef typedef struct  rng_s
+ * xorshift64* generator, one per frame
+ */
+typedef struct {
+    uint64_t state;
+    double spare;
+    int has_spare;
+} rng_s;
+
+static const char *const gesture_names[RADAR_FMCW_GEN_NUM_CLASSES] =
+{
+    "background", "push", "swipe_left", "swipe_right", "unknown_1", "unknown_2", "swipe_up", "swipe_down"
+};
+
+/*******************************************************************************
+ * Function Name: mix64
+ ********************************************************************************
+ * Summary:
+ *   splitmix64 finalizer, derives independent seeds from indices
+ *******************************************************************************/
+static uint64_t mix64(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/*******************************************************************************
+ * Function Name: rng_uniform
+ ********************************************************************************
+ * Summary:
+ *   Uniform number in [0, 1)
+ *******************************************************************************/
+static double rng_uniform(rng_s *rng)
+{
+    rng->state ^= rng->state >> 12;
+    rng->state ^= rng->state << 25;
+    rng->state ^= rng->state >> 27;
+    return (double)((rng->state * 0x2545F4914F6CDD1DULL) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/*******************************************************************************
+ * Function Name: rng_gauss
+ ********************************************************************************
+ * Summary:
+ *   Standard normal number, Box-Muller in pairs
+ *******************************************************************************/
+static double rng_gauss(rng_s *rng)
+{
+    double radius;
+    double angle;
+
+    if (rng->has_spare)
+    {
+        rng->has_spare = 0;
+        return rng->spare;
+    }
+
+    radius = sqrt(-2.0 * log(1.0 - rng_uniform(rng)));
+    angle = 2.0 * M_PI * rng_uniform(rng);
+    rng->spare = radius * sin(angle);
+    rng->has_spare = 1;
+
+    return radius * cos(angle);
+}
+
+/*******************************************************************************
+ * Function Name: jitter_factor
+ ********************************************************************************
+ * Summary:
+ *   Factor in [1 - jitter, 1 + jitter] of a parameter of an event in a
+ *   repetition of the script, the same for every frame
+ *******************************************************************************/
+static float32_t jitter_factor(const radar_fmcw_gen_scene_s *scene, uint64_t repetition,
+                               uint32_t event, uint32_t parameter)
+{
+    const uint64_t h = mix64(((uint64_t)scene->seed << 32) ^ (repetition * 0x100000001B3ULL) ^
+                             ((uint64_t)event << 8) ^ parameter);
+
+    return 1.0f + (scene->jitter * (float32_t)((((double)(h >> 11) * (1.0 / 9007199254740992.0)) * 2.0) - 1.0));
+}
+
+/*******************************************************************************
+ * Function Name: find_event
+ ********************************************************************************
+ * Summary:
+ *   Finds the event of the script covering a point in time
+ *
+ * Parameters:
+ *   scene: scene
+ *   t: seconds from the start of the recording
+ *   repetition: receives the repetition of the script
+ *   progress: receives the progress through the gesture, 0 to 1
+ *   duration: receives the jittered duration
+ *
+ * Return:
+ *   index of the event, -1 if no gesture is performed
+ *******************************************************************************/
+static int32_t find_event(const radar_fmcw_gen_scene_s *scene, double t, uint64_t *repetition,
+                          float32_t *progress, float32_t *duration)
+{
+    double offset;
+
+    if ((scene->num_events == 0U) || (scene->period_s <= 0.0f))
+    {
+        return -1;
+    }
+
+    *repetition = (uint64_t)(t / scene->period_s);
+    offset = t - ((double)*repetition * scene->period_s);
+
+    for (uint32_t i = 0; i < scene->num_events; ++i)
+    {
+        const radar_fmcw_gen_event_s *event = &scene->events[i];
+
+        *duration = event->duration_s * jitter_factor(scene, *repetition, i, 0U);
+        if ((offset >= event->start_s) && (offset < (event->start_s + *duration)))
+        {
+            *progress = (float32_t)((offset - event->start_s) / *duration);
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+/*******************************************************************************
+ * Function Name: hand_reflector
+ ********************************************************************************
+ * Summary:
+ *   Position and strength of the hand at a point in time. The hand fades in
+ *   and out over the gesture.
+ *
+ * Parameters:
+ *   scene: scene
+ *   t: seconds from the start of the recording
+ *   hand: receives the reflector
+ *
+ * Return:
+ *   non-zero if a hand is present
+ *******************************************************************************/
+static int hand_reflector(const radar_fmcw_gen_scene_s *scene, double t, reflector_s *hand)
+{
+    uint64_t repetition;
+    float32_t u;
+    float32_t duration;
+    const int32_t index = find_event(scene, t, &repetition, &u, &duration);
+    const radar_fmcw_gen_event_s *event;
+    float32_t distance;
+    float32_t travel;
+    float32_t x;
+    float32_t y;
+    float32_t z;
+
+    if (index < 0)
+    {
+        return 0;
+    }
+
+    event = &scene->events[index];
+    distance = event->distance_m * jitter_factor(scene, repetition, (uint32_t)index, 1U);
+    travel = jitter_factor(scene, repetition, (uint32_t)index, 2U);
+    /* the path is offset sideways by up to jitter times half the swipe travel */
+    x = 0.5f * SWIPE_TRAVEL_M * (jitter_factor(scene, repetition, (uint32_t)index, 3U) - 1.0f);
+    y = distance;
+    z = 0.0f;
+
+    switch (event->gesture)
+    {
+        case RADAR_FMCW_GEN_PUSH:
+            y = distance + (PUSH_TRAVEL_M * travel * cosf(2.0f * RADAR_DSP_PI * u));
+            break;
+        case RADAR_FMCW_GEN_SWIPE_LEFT:
+            x += SWIPE_TRAVEL_M * travel * cosf(RADAR_DSP_PI * u);
+            break;
+        case RADAR_FMCW_GEN_SWIPE_RIGHT:
+            x -= SWIPE_TRAVEL_M * travel * cosf(RADAR_DSP_PI * u);
+            break;
+        case RADAR_FMCW_GEN_SWIPE_UP:
+            z = -SWIPE_TRAVEL_M * travel * cosf(RADAR_DSP_PI * u);
+            break;
+        case RADAR_FMCW_GEN_SWIPE_DOWN:
+            z = SWIPE_TRAVEL_M * travel * cosf(RADAR_DSP_PI * u);
+            break;
+        default:
+            break;
+    }
+
+    hand->range_m = sqrt((double)((x * x) + (y * y) + (z * z)));
+    hand->sin_azimuth = x / hand->range_m;
+    hand->sin_elevation = z / hand->range_m;
+    hand->amplitude = scene->hand_amplitude * sinf(RADAR_DSP_PI * u) *
+                      (RADAR_FMCW_GEN_REFERENCE_RANGE_M * RADAR_FMCW_GEN_REFERENCE_RANGE_M) /
+                      (hand->range_m * hand->range_m);
+
+    return 1;
+}
+
+/*******************************************************************************
+ * Function Name: add_reflector
+ ********************************************************************************
+ * Summary:
+ *   Adds the beat signal of a reflector to one chirp of one antenna. The
+ *   samples are produced by rotating a phasor, one sine and cosine per
+ *   reflector and chirp.
+ *
+ * Parameters:
+ *   chirp: chirp parameters
+ *   reflector: reflector
+ *   antenna: receive antenna, 0 is RX1
+ *   signal: samples of the chirp
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void add_reflector(const radar_fmcw_gen_chirp_s *chirp, const reflector_s *reflector,
+                          uint32_t antenna, double *signal)
+{
+    const double slope = (chirp->end_freq_hz - chirp->start_freq_hz) * chirp->sample_rate_hz /
+                         (double)chirp->num_samples_per_chirp;
+    const double beat = 2.0 * slope * reflector->range_m / SPEED_OF_LIGHT;
+    const double step = 2.0 * M_PI * beat / chirp->sample_rate_hz;
+    double phase = 4.0 * M_PI * chirp->start_freq_hz * reflector->range_m / SPEED_OF_LIGHT;
+    double re;
+    double im;
+    const double step_re = cos(step);
+    const double step_im = sin(step);
+
+    /* half wavelength spacing: RX1 leads RX3 by pi sin(azimuth), RX2 by pi sin(elevation) */
+    if (antenna == 0U)
+    {
+        phase += M_PI * reflector->sin_azimuth;
+    }
+    else if (antenna == 1U)
+    {
+        phase += M_PI * reflector->sin_elevation;
+    }
+
+    re = reflector->amplitude * cos(phase);
+    im = reflector->amplitude * sin(phase);
+
+    for (uint32_t n = 0; n < chirp->num_samples_per_chirp; ++n)
+    {
+        const double next_re = (re * step_re) - (im * step_im);
+
+        signal[n] += re;
+        im = (re * step_im) + (im * step_re);
+        re = next_re;
+    }
+}
+
+/*
+ * Initialize the default scene
+ */
+void radar_fmcw_gen_default_scene(radar_fmcw_gen_scene_s *scene)
+{
+    static const radar_fmcw_gen_event_s events[] =
+    {
+        { RADAR_FMCW_GEN_PUSH, 1.0f, 0.6f, 0.35f },
+        { RADAR_FMCW_GEN_SWIPE_LEFT, 3.0f, 0.5f, 0.30f },
+        { RADAR_FMCW_GEN_SWIPE_RIGHT, 5.0f, 0.5f, 0.30f },
+        { RADAR_FMCW_GEN_SWIPE_UP, 7.0f, 0.5f, 0.30f },
+        { RADAR_FMCW_GEN_SWIPE_DOWN, 9.0f, 0.5f, 0.30f }
+    };
+    static const radar_fmcw_gen_reflector_s clutter[] =
+    {
+        { 0.04f, 0.0f, 0.0f, 6.0f },    /* transmitter leakage */
+        { 0.60f, 0.0f, -40.0f, 150.0f },/* table */
+        { 1.10f, 10.0f, 0.0f, 400.0f }  /* wall */
+    };
+
+    memset(scene, 0, sizeof(*scene));
+
+    scene->chirp.start_freq_hz = (double)XENSIV_BGT60TRXX_CONF_START_FREQ_HZ;
+    scene->chirp.end_freq_hz = (double)XENSIV_BGT60TRXX_CONF_END_FREQ_HZ;
+    scene->chirp.sample_rate_hz = (double)XENSIV_BGT60TRXX_CONF_SAMPLE_RATE;
+    scene->chirp.chirp_repetition_s = XENSIV_BGT60TRXX_CONF_CHIRP_REPETITION_TIME_S;
+    scene->chirp.frame_repetition_s = XENSIV_BGT60TRXX_CONF_FRAME_REPETITION_TIME_S;
+    scene->chirp.num_samples_per_chirp = XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP;
+    scene->chirp.num_chirps_per_frame = XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME;
+    scene->chirp.num_rx_antennas = XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS;
+
+    memcpy(scene->events, events, sizeof(events));
+    scene->num_events = sizeof(events) / sizeof(events[0]);
+    scene->period_s = 10.0f;
+    scene->jitter = 0.2f;
+    scene->hand_amplitude = 300.0f;
+
+    memcpy(scene->clutter, clutter, sizeof(clutter));
+    scene->num_clutter = sizeof(clutter) / sizeof(clutter[0]);
+
+    scene->noise_rms = 3.0f;
+    scene->seed = 1U;
+}
+
+/*
+ * Load a script into a scene
+ */
+int32_t radar_fmcw_gen_load_script(radar_fmcw_gen_scene_s *scene, const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+    int32_t line_number = 0;
+    int32_t result = 0;
+    float32_t end_s = 0.0f;
+    int period_set = 0;
+
+    if (f == NULL)
+    {
+        return -1;
+    }
+
+    scene->num_events = 0;
+    scene->num_clutter = 0;
+
+    while ((result == 0) && (fgets(line, sizeof(line), f) != NULL))
+    {
+        char keyword[32];
+        float32_t v[4];
+        int n;
+        char *comment = strchr(line, '#');
+
+        ++line_number;
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+
+        n = sscanf(line, "%31s %f %f %f %f", keyword, &v[0], &v[1], &v[2], &v[3]);
+        if (n <= 0)
+        {
+            continue;
+        }
+
+        if ((strcmp(keyword, "period") == 0) && (n == 2) && (v[0] > 0.0f))
+        {
+            scene->period_s = v[0];
+            period_set = 1;
+        }
+        else if ((strcmp(keyword, "jitter") == 0) && (n == 2) && (v[0] >= 0.0f) && (v[0] < 1.0f))
+        {
+            scene->jitter = v[0];
+        }
+        else if ((strcmp(keyword, "noise") == 0) && (n == 2) && (v[0] >= 0.0f))
+        {
+            scene->noise_rms = v[0];
+        }
+        else if ((strcmp(keyword, "hand") == 0) && (n == 2) && (v[0] >= 0.0f))
+        {
+            scene->hand_amplitude = v[0];
+        }
+        else if ((strcmp(keyword, "seed") == 0) && (n == 2))
+        {
+            scene->seed = (uint32_t)v[0];
+        }
+        else if ((strcmp(keyword, "clutter") == 0) && (n == 5) && (v[0] > 0.0f) &&
+                 (scene->num_clutter < RADAR_FMCW_GEN_CLUTTER_UB))
+        {
+            radar_fmcw_gen_reflector_s *reflector = &scene->clutter[scene->num_clutter++];
+
+            reflector->range_m = v[0];
+            reflector->azimuth_deg = v[1];
+            reflector->elevation_deg = v[2];
+            reflector->amplitude = v[3];
+        }
+        else
+        {
+            radar_fmcw_gen_event_s *event = &scene->events[scene->num_events];
+            uint32_t gesture = RADAR_FMCW_GEN_NUM_CLASSES;
+
+            for (uint32_t i = 1; i < RADAR_FMCW_GEN_NUM_CLASSES; ++i)
+            {
+                if (strcmp(keyword, gesture_names[i]) == 0)
+                {
+                    gesture = i;
+                }
+            }
+
+            if ((gesture == RADAR_FMCW_GEN_NUM_CLASSES) || (n != 4) || (v[0] < 0.0f) || (v[1] <= 0.0f) ||
+                (v[2] <= 0.0f) || (scene->num_events >= RADAR_FMCW_GEN_EVENTS_UB))
+            {
+                result = line_number;
+                break;
+            }
+
+            event->gesture = (radar_fmcw_gen_gesture_e)gesture;
+            event->start_s = v[0];
+            event->duration_s = v[1];
+            event->distance_m = v[2];
+            scene->num_events++;
+
+            if ((v[0] + v[1]) > end_s)
+            {
+                end_s = v[0] + v[1];
+            }
+        }
+    }
+
+    fclose(f);
+
+    if ((result == 0) && !period_set)
+    {
+        scene->period_s = end_s + 1.0f;
+    }
+
+    return result;
+}
+
+/*
+ * Generate a frame
+ */
+void radar_fmcw_gen_frame(const radar_fmcw_gen_scene_s *scene, uint64_t frame, uint16_t *samples)
+{
+    const radar_fmcw_gen_chirp_s *chirp = &scene->chirp;
+    const uint32_t num_antennas = chirp->num_rx_antennas;
+    const double frame_start = (double)frame * chirp->frame_repetition_s;
+    reflector_s reflectors[REFLECTORS_UB];
+    double signal[RADAR_FMCW_GEN_MAX_SAMPLES_PER_CHIRP];
+    rng_s rng = { .state = mix64(((uint64_t)scene->seed << 40) ^ frame) | 1U };
+    uint32_t num_clutter = 0;
+
+    for (uint32_t i = 0; i < scene->num_clutter; ++i)
+    {
+        const radar_fmcw_gen_reflector_s *c = &scene->clutter[i];
+        reflector_s *r = &reflectors[num_clutter++];
+
+        r->range_m = c->range_m;
+        r->sin_azimuth = sin(c->azimuth_deg * M_PI / 180.0);
+        r->sin_elevation = sin(c->elevation_deg * M_PI / 180.0);
+        r->amplitude = c->amplitude * (RADAR_FMCW_GEN_REFERENCE_RANGE_M * RADAR_FMCW_GEN_REFERENCE_RANGE_M) /
+                       (c->range_m * c->range_m);
+    }
+
+    for (uint32_t c = 0; c < chirp->num_chirps_per_frame; ++c)
+    {
+        /* the hand moves from chirp to chirp, which gives the Doppler shift */
+        const uint32_t num_reflectors = num_clutter +
+            (uint32_t)hand_reflector(scene, frame_start + ((double)c * chirp->chirp_repetition_s),
+                                     &reflectors[num_clutter]);
+
+        for (uint32_t a = 0; a < num_antennas; ++a)
+        {
+            uint16_t *out = &samples[(c * chirp->num_samples_per_chirp * num_antennas) + a];
+
+            memset(signal, 0, chirp->num_samples_per_chirp * sizeof(signal[0]));
+            for (uint32_t r = 0; r < num_reflectors; ++r)
+            {
+                add_reflector(chirp, &reflectors[r], a, signal);
+            }
+
+            for (uint32_t n = 0; n < chirp->num_samples_per_chirp; ++n)
+            {
+                double value = ADC_OFFSET + signal[n] + (scene->noise_rms * rng_gauss(&rng));
+
+                value = (value < 0.0) ? 0.0 : ((value > (double)RADAR_SAMPLE12_MAX) ? (double)RADAR_SAMPLE12_MAX : value);
+                out[n * num_antennas] = (uint16_t)lrint(value);
+            }
+        }
+    }
+}
+
+/*
+ * Get the gesture performed during a frame
+ */
+radar_fmcw_gen_gesture_e radar_fmcw_gen_label(const radar_fmcw_gen_scene_s *scene, uint64_t frame)
+{
+    const double t = ((double)frame + 0.5) * scene->chirp.frame_repetition_s;
+    uint64_t repetition;
+    float32_t progress;
+    float32_t duration;
+    const int32_t index = find_event(scene, t, &repetition, &progress, &duration);
+
+    return (index < 0) ? RADAR_FMCW_GEN_BACKGROUND : scene->events[index].gesture;
+}
+
+/*
+ * Get the name of a gesture
+ */
+const char *radar_fmcw_gen_gesture_name(radar_fmcw_gen_gesture_e gesture)
+{
+    return ((uint32_t)gesture < RADAR_FMCW_GEN_NUM_CLASSES) ? gesture_names[gesture] : gesture_names[0];
+}
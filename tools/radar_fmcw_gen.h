@@ -0,0 +1,210 @@
+/******************************************************************************
+** File name: radar_fmcw_gen.h
+**
+** Description: This file contains the host generator of synthetic radar
+**   frames. It models the IF signal of the FMCW chirps in radar_settings.h
+**   for a hand moving along scripted gesture trajectories, static clutter
+**   and receiver noise, and delivers frames in the FIFO order of the sensor.
+**   Every frame is a function of the scene and its index only, so frames
+**   can be generated by any number of threads in any order.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_FMCW_GEN_H_
+#define RADAR_FMCW_GEN_H_
+
+#include <stdint.h>
+
+#include "radar_dsp.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/*
+ * @def RADAR_FMCW_GEN_EVENTS_UB
+ * Gestures of a script
+ */
+#define RADAR_FMCW_GEN_EVENTS_UB            (64U)
+
+/*
+ * @def RADAR_FMCW_GEN_CLUTTER_UB
+ * Static reflectors of a scene
+ */
+#define RADAR_FMCW_GEN_CLUTTER_UB           (8U)
+
+/*
+ * @def RADAR_FMCW_GEN_MAX_SAMPLES_PER_CHIRP
+ * Samples per chirp the generator supports
+ */
+#define RADAR_FMCW_GEN_MAX_SAMPLES_PER_CHIRP (1024U)
+
+/*
+ * @def RADAR_FMCW_GEN_REFERENCE_RANGE_M
+ * Range at which a reflector has its nominal amplitude, the amplitude
+ * falls with the square of the range
+ */
+#define RADAR_FMCW_GEN_REFERENCE_RANGE_M    (0.3f)
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @def enum radar_fmcw_gen_gesture_e
+ * Scripted gestures, numbered like the classes of the gestures library
+ */
+typedef enum
+{
+    RADAR_FMCW_GEN_BACKGROUND = 0,
+    RADAR_FMCW_GEN_PUSH = 1,
+    RADAR_FMCW_GEN_SWIPE_LEFT = 2,      /*<< towards negative azimuth */
+    RADAR_FMCW_GEN_SWIPE_RIGHT = 3,     /*<< towards positive azimuth */
+    RADAR_FMCW_GEN_SWIPE_UP = 6,        /*<< towards positive elevation */
+    RADAR_FMCW_GEN_SWIPE_DOWN = 7,      /*<< towards negative elevation */
+    RADAR_FMCW_GEN_NUM_CLASSES = 8
+} radar_fmcw_gen_gesture_e;
+
+/*
+ * @typedef typedef struct  radar_fmcw_gen_chirp_s
+ * Chirp and frame parameters of the sensor
+ */
+typedef struct {
+    double start_freq_hz;
+    double end_freq_hz;
+    double sample_rate_hz;
+    double chirp_repetition_s;
+    double frame_repetition_s;
+    uint32_t num_samples_per_chirp;     /*<< up to RADAR_FMCW_GEN_MAX_SAMPLES_PER_CHIRP */
+    uint32_t num_chirps_per_frame;
+    uint32_t num_rx_antennas;           /*<< 1 to 3, RX1 beside and RX2 above RX3 */
+} radar_fmcw_gen_chirp_s;
+
+/*
+ * @typedef typedef struct  radar_fmcw_gen_event_s
+ * Gesture of the script
+ */
+typedef struct {
+    radar_fmcw_gen_gesture_e gesture;
+    float32_t start_s;                  /*<< from the start of the script */
+    float32_t duration_s;
+    float32_t distance_m;               /*<< distance of the hand on boresight */
+} radar_fmcw_gen_event_s;
+
+/*
+ * @typedef typedef struct  radar_fmcw_gen_reflector_s
+ * Static reflector
+ */
+typedef struct {
+    float32_t range_m;
+    float32_t azimuth_deg;
+    float32_t elevation_deg;
+    float32_t amplitude;                /*<< ADC counts at RADAR_FMCW_GEN_REFERENCE_RANGE_M */
+} radar_fmcw_gen_reflector_s;
+
+/*
+ * @typedef typedef struct  radar_fmcw_gen_scene_s
+ * Scene description. The script repeats every period_s, every repetition
+ * varies distance, duration and path of its gestures by up to jitter.
+ */
+typedef struct {
+    radar_fmcw_gen_chirp_s chirp;
+
+    radar_fmcw_gen_event_s events[RADAR_FMCW_GEN_EVENTS_UB];
+    uint32_t num_events;
+    float32_t period_s;
+    float32_t jitter;                   /*<< relative variation, 0 repeats the script exactly */
+    float32_t hand_amplitude;           /*<< ADC counts at RADAR_FMCW_GEN_REFERENCE_RANGE_M */
+
+    radar_fmcw_gen_reflector_s clutter[RADAR_FMCW_GEN_CLUTTER_UB];
+    uint32_t num_clutter;
+
+    float32_t noise_rms;                /*<< ADC counts */
+    uint32_t seed;
+} radar_fmcw_gen_scene_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the default scene
+ *
+ * The chirps of radar_settings.h, the five gestures two seconds apart,
+ * the transmitter leakage, a table and a wall as clutter and a few counts
+ * of noise.
+ *
+ * @param[out] scene scene
+ */
+void radar_fmcw_gen_default_scene(radar_fmcw_gen_scene_s *scene);
+
+/** @brief Load a script into a scene
+ *
+ * One statement per line, '#' starts a comment:
+ *   <gesture> <start_s> <duration_s> <distance_m>   gesture of the script
+ *   period <s> | jitter <fraction> | noise <counts> | hand <counts> | seed <n>
+ *   clutter <range_m> <azimuth_deg> <elevation_deg> <counts>
+ * Gestures are push, swipe_left, swipe_right, swipe_up and swipe_down. The
+ * events and clutter of the scene are replaced by those of the script, the
+ * period defaults to the end of the last event plus a second.
+ *
+ * @param[in,out] scene scene
+ * @param[in] path script file
+ *
+ * @return zero (0) on success, -1 if the file cannot be read, otherwise the line number of the first invalid statement
+ */
+int32_t radar_fmcw_gen_load_script(radar_fmcw_gen_scene_s *scene, const char *path);
+
+/** @brief Generate a frame
+ *
+ * @param[in] scene scene
+ * @param[in] frame frame index from the start of the recording
+ * @param[out] samples 12-bit samples in FIFO order, antennas interleaved
+ */
+void radar_fmcw_gen_frame(const radar_fmcw_gen_scene_s *scene, uint64_t frame, uint16_t *samples);
+
+/** @brief Get the gesture performed during a frame
+ *
+ * @param[in] scene scene
+ * @param[in] frame frame index from the start of the recording
+ *
+ * @return gesture whose trajectory covers the middle of the frame
+ */
+radar_fmcw_gen_gesture_e radar_fmcw_gen_label(const radar_fmcw_gen_scene_s *scene, uint64_t frame);
+
+/** @brief Get the name of a gesture
+ *
+ * @param[in] gesture gesture
+ *
+ * @return name as used in scripts, "background" for anything else
+ */
+const char *radar_fmcw_gen_gesture_name(radar_fmcw_gen_gesture_e gesture);
+
+/** @brief Get the number of samples of a frame
+ *
+ * @param[in] scene scene
+ *
+ * @return samples of all antennas
+ */
+static inline uint32_t radar_fmcw_gen_frame_samples(const radar_fmcw_gen_scene_s *scene)
+{
+    return scene->chirp.num_samples_per_chirp * scene->chirp.num_chirps_per_frame * scene->chirp.num_rx_antennas;
+}
+
+#endif /* RADAR_FMCW_GEN_H_ */
@@ -0,0 +1,290 @@
+/*****************************************************************************
+ * File name: radar_fmcw_gen_tool.c
+ *
+ * Description: Host tool generating recordings of synthetic radar frames
+ * for soak and regression runs. Frames are generated by several threads
+ * and written in order, as 16-bit samples or in the packed 12-bit format
+ * of the sensor FIFO, together with the gesture labels of the frames.
+ *
+ * Build: gcc -O2 -pthread -DRADAR_DSP_REFERENCE -Isource -Itools
+ *            tools/radar_fmcw_gen_tool.c tools/radar_fmcw_gen.c
+ *            source/radar_sample12.c -lm -o radar_fmcw_gen
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "radar_fmcw_gen.h"
+#include "radar_sample12.h"
+
+/* frames per thread and batch */
+#define BATCH_FRAMES                (64U)
+
+/* upper bound of worker threads */
+#define THREADS_UB                  (64U)
+
+/*
+ * @typedef typedef struct  batch_s
+ * Frames of a batch, shared by the workers
+ */
+typedef struct {
+    const radar_fmcw_gen_scene_s *scene;
+    uint64_t first_frame;
+    uint32_t num_frames;
+    uint32_t num_threads;
+    uint32_t frame_bytes;
+    int packed;
+    uint16_t *samples;              /*<< one frame per worker */
+    uint8_t *out;                   /*<< num_frames encoded frames */
+} batch_s;
+
+/*
+ * @typedef typedef struct  worker_s
+ * Worker of a batch
+ */
+typedef struct {
+    pthread_t thread;
+    batch_s *batch;
+    uint32_t id;
+} worker_s;
+
+/*******************************************************************************
+ * Function Name: worker_run
+ ********************************************************************************
+ * Summary:
+ *   Generates every num_threads-th frame of the batch into its place in the
+ *   output buffer
+ *******************************************************************************/
+static void *worker_run(void *arg)
+{
+    const worker_s *worker = (const worker_s*)arg;
+    const batch_s *batch = worker->batch;
+    const uint32_t num_samples = radar_fmcw_gen_frame_samples(batch->scene);
+    uint16_t *samples = &batch->samples[(size_t)worker->id * num_samples];
+
+    for (uint32_t i = worker->id; i < batch->num_frames; i += batch->num_threads)
+    {
+        uint8_t *out = &batch->out[(size_t)i * batch->frame_bytes];
+
+        if (batch->packed)
+        {
+            radar_fmcw_gen_frame(batch->scene, batch->first_frame + i, samples);
+            radar_sample12_pack(samples, out, num_samples);
+        }
+        else
+        {
+            radar_fmcw_gen_frame(batch->scene, batch->first_frame + i, (uint16_t*)out);
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+ * Function Name: write_labels
+ ********************************************************************************
+ * Summary:
+ *   Writes the runs of frames with the same label, one per line as first
+ *   frame, last frame and gesture name
+ *******************************************************************************/
+static int write_labels(const radar_fmcw_gen_scene_s *scene, uint64_t num_frames, const char *path)
+{
+    FILE *f = fopen(path, "w");
+    uint64_t first = 0;
+    radar_fmcw_gen_gesture_e label;
+
+    if (f == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+
+    label = radar_fmcw_gen_label(scene, 0);
+    for (uint64_t frame = 1; frame <= num_frames; ++frame)
+    {
+        const radar_fmcw_gen_gesture_e next = (frame < num_frames) ? radar_fmcw_gen_label(scene, frame) : label;
+
+        if ((frame == num_frames) || (next != label))
+        {
+            fprintf(f, "%llu %llu %s\n", (unsigned long long)first, (unsigned long long)(frame - 1U),
+                    radar_fmcw_gen_gesture_name(label));
+            first = frame;
+            label = next;
+        }
+    }
+
+    fclose(f);
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: now_s
+ ********************************************************************************
+ * Summary:
+ *   Monotonic time in seconds
+ *******************************************************************************/
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+int main(int argc, char **argv)
+{
+    static radar_fmcw_gen_scene_s scene;
+    const char *out_path = "frames.raw";
+    const char *labels_path = NULL;
+    const char *script_path = NULL;
+    uint32_t num_threads = 1;
+    uint32_t seed = 0;
+    int packed = 1;
+    double seconds;
+    uint64_t num_frames;
+    uint32_t num_samples;
+    batch_s batch;
+    worker_s workers[THREADS_UB];
+    FILE *out;
+    double start;
+    double elapsed;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:l:s:t:f:r:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'o':
+                out_path = optarg;
+                break;
+            case 'l':
+                labels_path = optarg;
+                break;
+            case 's':
+                script_path = optarg;
+                break;
+            case 't':
+                num_threads = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                packed = (strcmp(optarg, "u16") == 0) ? 0 : ((strcmp(optarg, "packed") == 0) ? 1 : -1);
+                break;
+            case 'r':
+                seed = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            default:
+                packed = -1;
+                break;
+        }
+    }
+
+    if ((optind != (argc - 1)) || (packed < 0) || (num_threads == 0U) || (num_threads > THREADS_UB) ||
+        ((seconds = strtod(argv[argc - 1], NULL)) <= 0.0))
+    {
+        fprintf(stderr, "usage: %s [-o frames.raw] [-l labels.txt] [-s script] [-t threads] [-f packed|u16] [-r seed] <seconds>\n",
+                argv[0]);
+        return 2;
+    }
+
+    radar_fmcw_gen_default_scene(&scene);
+    if (script_path != NULL)
+    {
+        const int32_t result = radar_fmcw_gen_load_script(&scene, script_path);
+
+        if (result == -1)
+        {
+            fprintf(stderr, "cannot open %s\n", script_path);
+            return 1;
+        }
+        if (result != 0)
+        {
+            fprintf(stderr, "%s:%d: invalid statement\n", script_path, result);
+            return 1;
+        }
+    }
+    if (seed != 0U)
+    {
+        scene.seed = seed;
+    }
+
+    num_frames = (uint64_t)(seconds / scene.chirp.frame_repetition_s);
+    num_samples = radar_fmcw_gen_frame_samples(&scene);
+
+    batch.scene = &scene;
+    batch.num_threads = num_threads;
+    batch.packed = packed;
+    batch.frame_bytes = packed ? RADAR_SAMPLE12_BYTES(num_samples) : (num_samples * sizeof(uint16_t));
+    batch.samples = malloc((size_t)num_threads * num_samples * sizeof(uint16_t));
+    batch.out = malloc((size_t)num_threads * BATCH_FRAMES * batch.frame_bytes);
+    out = fopen(out_path, "wb");
+    if ((batch.samples == NULL) || (batch.out == NULL) || (out == NULL))
+    {
+        fprintf(stderr, "cannot open %s\n", out_path);
+        return 1;
+    }
+
+    start = now_s();
+    for (uint64_t frame = 0; frame < num_frames; frame += batch.num_frames)
+    {
+        const uint64_t remaining = num_frames - frame;
+
+        batch.first_frame = frame;
+        batch.num_frames = (remaining < ((uint64_t)num_threads * BATCH_FRAMES)) ? (uint32_t)remaining :
+                           (num_threads * BATCH_FRAMES);
+
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            workers[i].batch = &batch;
+            workers[i].id = i;
+            pthread_create(&workers[i].thread, NULL, worker_run, &workers[i]);
+        }
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            pthread_join(workers[i].thread, NULL);
+        }
+
+        /* written in frame order whatever thread generated the frame */
+        fwrite(batch.out, batch.frame_bytes, batch.num_frames, out);
+    }
+    elapsed = now_s() - start;
+
+    fclose(out);
+    free(batch.samples);
+    free(batch.out);
+
+    if ((labels_path != NULL) && (write_labels(&scene, num_frames, labels_path) != 0))
+    {
+        return 1;
+    }
+
+    printf("%llu frames of %u x %u x %u samples, %u bytes each (%s), seed %u\n",
+           (unsigned long long)num_frames, scene.chirp.num_samples_per_chirp, scene.chirp.num_chirps_per_frame,
+           scene.chirp.num_rx_antennas, batch.frame_bytes, packed ? "packed" : "u16", scene.seed);
+    printf("%.2f s with %u threads: %.0f frames/s, %.1f hours of data per minute\n",
+           elapsed, num_threads, (double)num_frames / elapsed, (seconds / 3600.0) * (60.0 / elapsed));
+
+    return 0;
+}
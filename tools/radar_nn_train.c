@@ -0,0 +1,1065 @@
+/*****************************************************************************
+ * File name: radar_nn_train.c
+ *
+ * Description: Host tool training the gesture classifier of radar_nn.h on
+ * labelled recordings and calibrating its int8 model. The recordings run
+ * through the clutter map, range FFT and angle-of-arrival stages like on
+ * target, every frame gives one feature vector. Frames up to LABEL_FRAMES
+ * after the end of a labelled gesture are labelled with the gesture,
+ * frames within a gesture or shortly after the labelled ones are not used,
+ * the other frames are background.
+ *
+ * The float model is trained with Adam on the class weighted cross entropy.
+ * The calibration runs the float model over the training frames: the
+ * largest hidden and output values set the scales of the int8 layers, the
+ * weights are quantized symmetric per tensor. The tool reports the frame
+ * accuracy of both models on the validation recordings, or the training
+ * recordings without them, and writes the parameters as C source.
+ *
+ * Build: gcc -O2 -pthread -DRADAR_DSP_REFERENCE -Isource -Itools
+ *            tools/radar_nn_train.c tools/radar_fmcw_gen.c source/radar_sample12.c
+ *            source/radar_clutter_map.c source/radar_range_fft.c
+ *            source/radar_aoa.c source/radar_nn.c source/radar_nn_model.c
+ *            -lm -o radar_nn_train
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "radar_settings.h"
+#include "radar_sample12.h"
+#include "radar_clutter_map.h"
+#include "radar_range_fft.h"
+#include "radar_aoa.h"
+#include "radar_nn.h"
+#include "radar_fmcw_gen.h"
+
+/* upper bound of worker threads and recordings */
+#define THREADS_UB                  (64U)
+#define RECORDINGS_UB               (256U)
+
+/* frames from the end of a gesture labelled with it, and frames not used after them */
+#define LABEL_FRAMES                (6U)
+#define SKIP_FRAMES                 (6U)
+
+/* label of the frames not used */
+#define LABEL_SKIP                  (0xFFU)
+
+#define IN                          RADAR_NN_INPUT_LEN
+#define HID                         RADAR_NN_HIDDEN_LEN
+#define OUT                         RADAR_NN_NUM_CLASSES
+
+/* training */
+#define BATCH                       (32U)
+#define LEARNING_RATE               (2e-3f)
+#define WEIGHT_DECAY                (1e-4f)
+#define ADAM_BETA1                  (0.9f)
+#define ADAM_BETA2                  (0.999f)
+#define ADAM_EPSILON                (1e-8f)
+
+/*
+ * @typedef typedef struct  dataset_s
+ * Feature vectors and labels of the frames
+ */
+typedef struct {
+    int8_t *features;               /*<< [count][IN] */
+    uint8_t *labels;
+    size_t count;
+    size_t capacity;
+} dataset_s;
+
+/*
+ * @typedef typedef struct  params_s
+ * Float model parameters, also used for gradients and Adam moments
+ */
+typedef struct {
+    float w1[HID][IN];
+    float b1[HID];
+    float w2[OUT][HID];
+    float b2[OUT];
+} params_s;
+
+/*
+ * @typedef typedef struct  job_s
+ * Recording processed by a worker thread
+ */
+typedef struct {
+    const char *path;
+    dataset_s data;
+    int ok;
+} job_s;
+
+static struct {
+    uint32_t num_samples_per_chirp;
+    uint32_t num_chirps_per_frame;
+    uint32_t num_rx_antennas;
+    int packed;
+    job_s *jobs;
+    uint32_t num_jobs;
+    uint32_t next_job;
+    pthread_mutex_t lock;
+} train = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+/*******************************************************************************
+ * Function Name: rng_uniform
+ ********************************************************************************
+ * Summary:
+ *   xorshift64* generator, uniform in [0, 1)
+ *******************************************************************************/
+static float rng_uniform(void)
+{
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+
+    return (float)((rng_state * 0x2545F4914F6CDD1DULL) >> 40) / (float)(1U << 24);
+}
+
+/*******************************************************************************
+ * Function Name: dataset_add
+ ********************************************************************************
+ * Summary:
+ *   Appends a frame to a dataset
+ *
+ * Return:
+ *   0 on success, -1 if memory is exhausted
+ *******************************************************************************/
+static int dataset_add(dataset_s *data, const int8_t *features, uint8_t label)
+{
+    if (data->count == data->capacity)
+    {
+        const size_t capacity = (data->capacity == 0U) ? 4096U : (data->capacity * 2U);
+        int8_t *f = realloc(data->features, capacity * IN);
+        uint8_t *l = realloc(data->labels, capacity);
+
+        if ((f == NULL) || (l == NULL))
+        {
+            free((f != NULL) ? f : data->features);
+            free((l != NULL) ? l : data->labels);
+            data->features = NULL;
+            data->labels = NULL;
+            return -1;
+        }
+        data->features = f;
+        data->labels = l;
+        data->capacity = capacity;
+    }
+
+    memcpy(&data->features[data->count * IN], features, IN);
+    data->labels[data->count] = label;
+    data->count++;
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: load_labels
+ ********************************************************************************
+ * Summary:
+ *   Reads the labelled gestures of a recording from the file next to it and
+ *   labels its frames
+ *
+ * Return:
+ *   0 on success, -1 if the labels cannot be read
+ *******************************************************************************/
+static int load_labels(const char *recording, uint8_t *labels, uint64_t num_frames)
+{
+    char path[1024];
+    char line[256];
+    const char *dot = strrchr(recording, '.');
+    const size_t stem = ((dot != NULL) && (strchr(dot, '/') == NULL)) ? (size_t)(dot - recording) : strlen(recording);
+    FILE *f;
+
+    if ((stem + 5U) > sizeof(path))
+    {
+        return -1;
+    }
+    memcpy(path, recording, stem);
+    strcpy(&path[stem], ".txt");
+
+    f = fopen(path, "r");
+    if (f == NULL)
+    {
+        return -1;
+    }
+
+    memset(labels, 0, num_frames);
+
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        unsigned long long first;
+        unsigned long long last;
+        char name[32];
+
+        if (sscanf(line, "%llu %llu %31s", &first, &last, name) != 3)
+        {
+            continue;
+        }
+
+        for (uint32_t i = 1; i < OUT; ++i)
+        {
+            if (strcmp(name, radar_fmcw_gen_gesture_name((radar_fmcw_gen_gesture_e)i)) != 0)
+            {
+                continue;
+            }
+
+            /* only gestures the trajectory can hold as a whole are labelled */
+            for (uint64_t t = first; (t <= (last + LABEL_FRAMES + SKIP_FRAMES)) && (t < num_frames); ++t)
+            {
+                const int complete = (t >= last) && (t < (last + LABEL_FRAMES)) &&
+                                     ((last - first) < RADAR_AOA_TRAJECTORY_LEN);
+
+                labels[t] = complete ? (uint8_t)i : LABEL_SKIP;
+            }
+        }
+    }
+
+    fclose(f);
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: extract_recording
+ ********************************************************************************
+ * Summary:
+ *   Runs a recording through the preprocessing stages and collects the
+ *   features of its labelled frames
+ *
+ * Return:
+ *   0 on success, -1 otherwise
+ *******************************************************************************/
+static int extract_recording(job_s *job)
+{
+    const uint32_t samples = train.num_samples_per_chirp;
+    const uint32_t chirps = train.num_chirps_per_frame;
+    const uint32_t antennas = train.num_rx_antennas;
+    const uint32_t num_samples = samples * chirps * antennas;
+    const size_t frame_bytes = train.packed ? RADAR_SAMPLE12_BYTES(num_samples) : (num_samples * sizeof(uint16_t));
+    radar_clutter_map_s clutter_map = { .requested_mode = RADAR_CLUTTER_MAP_MODE_LEARN };
+    radar_range_fft_s range_fft;
+    radar_aoa_s aoa;
+    int8_t features[IN];
+    uint8_t *raw = malloc(frame_bytes);
+    float32_t *frame = malloc(num_samples * sizeof(float32_t));
+    uint8_t *labels = NULL;
+    FILE *f = fopen(job->path, "rb");
+    uint64_t num_frames = 0;
+    int result = -1;
+
+    if ((f != NULL) && (fseek(f, 0, SEEK_END) == 0))
+    {
+        num_frames = (uint64_t)ftell(f) / frame_bytes;
+        rewind(f);
+        labels = malloc((size_t)num_frames + 1U);
+    }
+
+    /* the stages keep their buffers for the lifetime of the tool */
+    if ((raw == NULL) || (frame == NULL) || (labels == NULL) ||
+        (load_labels(job->path, labels, num_frames) != 0) ||
+        (radar_clutter_map_init(&clutter_map, samples, chirps, antennas, malloc) != 0) ||
+        (radar_range_fft_init(&range_fft, samples, chirps, antennas, malloc) != 0) ||
+        (radar_aoa_init(&aoa, chirps, range_fft.num_range_bins, malloc) != 0))
+    {
+        goto done;
+    }
+
+    for (uint64_t t = 0; (t < num_frames) && (fread(raw, frame_bytes, 1, f) == 1U); ++t)
+    {
+        if (train.packed)
+        {
+            radar_sample12_deinterleave(raw, frame, num_samples, antennas);
+        }
+        else
+        {
+            const uint16_t *raw16 = (const uint16_t*)raw;
+
+            for (uint32_t i = 0; i < num_samples; ++i)
+            {
+                frame[((i % antennas) * (num_samples / antennas)) + (i / antennas)] = (float32_t)raw16[i];
+            }
+        }
+
+        radar_clutter_map_run(&clutter_map, frame);
+        radar_range_fft_run(&range_fft, frame);
+        radar_aoa_run(&aoa, &range_fft);
+
+        if (labels[t] != LABEL_SKIP)
+        {
+            radar_nn_features(&aoa, features);
+            if (dataset_add(&job->data, features, labels[t]) != 0)
+            {
+                goto done;
+            }
+        }
+    }
+    result = 0;
+
+done:
+    if (f != NULL)
+    {
+        fclose(f);
+    }
+    free(labels);
+    free(frame);
+    free(raw);
+
+    return result;
+}
+
+/*******************************************************************************
+ * Function Name: extract_worker
+ ********************************************************************************
+ * Summary:
+ *   Extracts recordings until none is left
+ *******************************************************************************/
+static void *extract_worker(void *arg)
+{
+    (void)arg;
+
+    for (;;)
+    {
+        uint32_t index;
+
+        pthread_mutex_lock(&train.lock);
+        index = train.next_job++;
+        pthread_mutex_unlock(&train.lock);
+
+        if (index >= train.num_jobs)
+        {
+            return NULL;
+        }
+
+        train.jobs[index].ok = (extract_recording(&train.jobs[index]) == 0);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: forward
+ ********************************************************************************
+ * Summary:
+ *   Float model of radar_nn_infer_f32() on one feature vector
+ *
+ * Parameters:
+ *   p: parameters
+ *   features: int8 features
+ *   x: receives the features as float
+ *   h: receives the hidden layer
+ *   probs: receives the class probabilities
+ *
+ * Return:
+ *   largest output before the softmax
+ *******************************************************************************/
+static float forward(const params_s *p, const int8_t *features, float *x, float *h, float *probs)
+{
+    float max;
+    float sum = 0.0f;
+
+    for (uint32_t i = 0; i < IN; ++i)
+    {
+        x[i] = (float)features[i] * RADAR_NN_INPUT_SCALE;
+    }
+
+    for (uint32_t o = 0; o < HID; ++o)
+    {
+        float acc = p->b1[o];
+
+        for (uint32_t i = 0; i < IN; ++i)
+        {
+            acc += x[i] * p->w1[o][i];
+        }
+        h[o] = (acc > 0.0f) ? acc : 0.0f;
+    }
+
+    for (uint32_t o = 0; o < OUT; ++o)
+    {
+        float acc = p->b2[o];
+
+        for (uint32_t i = 0; i < HID; ++i)
+        {
+            acc += h[i] * p->w2[o][i];
+        }
+        probs[o] = acc;
+    }
+
+    max = probs[0];
+    for (uint32_t o = 1; o < OUT; ++o)
+    {
+        max = (probs[o] > max) ? probs[o] : max;
+    }
+    for (uint32_t o = 0; o < OUT; ++o)
+    {
+        const float logit = probs[o];
+
+        probs[o] = expf(logit - max);
+        sum += probs[o];
+    }
+    for (uint32_t o = 0; o < OUT; ++o)
+    {
+        probs[o] /= sum;
+    }
+
+    return max;
+}
+
+/*******************************************************************************
+ * Function Name: train_model
+ ********************************************************************************
+ * Summary:
+ *   Trains the float model with Adam on the class weighted cross entropy
+ *******************************************************************************/
+static void train_model(params_s *p, const dataset_s *data, uint32_t epochs)
+{
+    static params_s grad;
+    static params_s m;
+    static params_s v;
+    float *pp = (float*)p;
+    float *pg = (float*)&grad;
+    float *pm = (float*)&m;
+    float *pv = (float*)&v;
+    const size_t num_params = sizeof(params_s) / sizeof(float);
+    size_t *order = malloc(data->count * sizeof(size_t));
+    float class_weight[OUT];
+    size_t class_count[OUT] = { 0 };
+    uint64_t step = 0;
+
+    if (order == NULL)
+    {
+        return;
+    }
+
+    /* He initialization, the biases start at zero */
+    memset(p, 0, sizeof(params_s));
+    for (uint32_t o = 0; o < HID; ++o)
+    {
+        for (uint32_t i = 0; i < IN; ++i)
+        {
+            p->w1[o][i] = (rng_uniform() - 0.5f) * 2.0f * sqrtf(6.0f / (float)IN);
+        }
+    }
+    for (uint32_t o = 0; o < OUT; ++o)
+    {
+        for (uint32_t i = 0; i < HID; ++i)
+        {
+            p->w2[o][i] = (rng_uniform() - 0.5f) * 2.0f * sqrtf(6.0f / (float)HID);
+        }
+    }
+    memset(&m, 0, sizeof(m));
+    memset(&v, 0, sizeof(v));
+
+    /* every class weighs as much as the background, classes without frames do not matter */
+    for (size_t n = 0; n < data->count; ++n)
+    {
+        class_count[data->labels[n]]++;
+        order[n] = n;
+    }
+    for (uint32_t c = 0; c < OUT; ++c)
+    {
+        class_weight[c] = (class_count[c] > 0U) ? ((float)class_count[0] / (float)class_count[c]) : 0.0f;
+        class_weight[c] = (class_weight[c] > 20.0f) ? 20.0f : class_weight[c];
+    }
+
+    for (uint32_t epoch = 0; epoch < epochs; ++epoch)
+    {
+        double loss = 0.0;
+        double weight_sum = 0.0;
+
+        for (size_t n = data->count; n > 1U; --n)
+        {
+            const size_t k = (size_t)(rng_uniform() * (float)n);
+            const size_t tmp = order[n - 1U];
+
+            order[n - 1U] = order[(k < n) ? k : (n - 1U)];
+            order[(k < n) ? k : (n - 1U)] = tmp;
+        }
+
+        for (size_t start = 0; start < data->count; start += BATCH)
+        {
+            const size_t end = ((start + BATCH) < data->count) ? (start + BATCH) : data->count;
+            const float lr = LEARNING_RATE * sqrtf(1.0f - powf(ADAM_BETA2, (float)(step + 1U))) /
+                             (1.0f - powf(ADAM_BETA1, (float)(step + 1U)));
+
+            memset(&grad, 0, sizeof(grad));
+
+            for (size_t b = start; b < end; ++b)
+            {
+                const size_t n = order[b];
+                const uint8_t label = data->labels[n];
+                const float w = class_weight[label];
+                float x[IN];
+                float h[HID];
+                float probs[OUT];
+                float dz[OUT];
+                float dh[HID];
+
+                (void)forward(p, &data->features[n * IN], x, h, probs);
+                loss -= w * logf(probs[label] + 1e-12f);
+                weight_sum += w;
+
+                for (uint32_t o = 0; o < OUT; ++o)
+                {
+                    dz[o] = w * (probs[o] - ((o == label) ? 1.0f : 0.0f));
+                    grad.b2[o] += dz[o];
+                }
+                for (uint32_t i = 0; i < HID; ++i)
+                {
+                    dh[i] = 0.0f;
+                    for (uint32_t o = 0; o < OUT; ++o)
+                    {
+                        grad.w2[o][i] += dz[o] * h[i];
+                        dh[i] += dz[o] * p->w2[o][i];
+                    }
+                    dh[i] = (h[i] > 0.0f) ? dh[i] : 0.0f;
+                }
+                for (uint32_t o = 0; o < HID; ++o)
+                {
+                    if (dh[o] == 0.0f)
+                    {
+                        continue;
+                    }
+                    grad.b1[o] += dh[o];
+                    for (uint32_t i = 0; i < IN; ++i)
+                    {
+                        grad.w1[o][i] += dh[o] * x[i];
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < num_params; ++i)
+            {
+                const float g = (pg[i] / (float)(end - start)) + (WEIGHT_DECAY * pp[i]);
+
+                pm[i] = (ADAM_BETA1 * pm[i]) + ((1.0f - ADAM_BETA1) * g);
+                pv[i] = (ADAM_BETA2 * pv[i]) + ((1.0f - ADAM_BETA2) * g * g);
+                pp[i] -= lr * pm[i] / (sqrtf(pv[i]) + ADAM_EPSILON);
+            }
+            step++;
+        }
+
+        printf("epoch %3u: loss %.4f\n", epoch + 1U, (weight_sum > 0.0) ? (loss / weight_sum) : 0.0);
+    }
+
+    free(order);
+}
+
+/*******************************************************************************
+ * Function Name: quantize_multiplier
+ ********************************************************************************
+ * Summary:
+ *   Splits a scale into the Q31 multiplier and shift of CMSIS-NN
+ *******************************************************************************/
+static void quantize_multiplier(double scale, int32_t *multiplier, int32_t *shift)
+{
+    int exponent;
+    const double fraction = frexp(scale, &exponent);
+    int64_t q = llround(fraction * (double)(1LL << 31));
+
+    if (q == (1LL << 31))
+    {
+        q /= 2;
+        exponent++;
+    }
+
+    *multiplier = (int32_t)q;
+    *shift = exponent;
+}
+
+/*******************************************************************************
+ * Function Name: quantize_s8
+ ********************************************************************************
+ * Summary:
+ *   Rounds and saturates to int8
+ *******************************************************************************/
+static int8_t quantize_s8(float value)
+{
+    const long q = lroundf(value);
+
+    return (int8_t)((q < -127) ? -127 : ((q > 127) ? 127 : q));
+}
+
+/*******************************************************************************
+ * Function Name: calibrate
+ ********************************************************************************
+ * Summary:
+ *   Quantizes the float model, the activation ranges are taken from the
+ *   frames of the dataset
+ *******************************************************************************/
+static void calibrate(const params_s *p, const dataset_s *data, radar_nn_model_s *model)
+{
+    float w1_max = 0.0f;
+    float w2_max = 0.0f;
+    float hidden_max = 0.0f;
+    float output_max = 0.0f;
+    float s_w1;
+    float s_w2;
+    float s_hidden;
+    float s_output;
+
+    for (size_t n = 0; n < data->count; ++n)
+    {
+        float x[IN];
+        float h[HID];
+        float probs[OUT];
+
+        (void)forward(p, &data->features[n * IN], x, h, probs);
+        for (uint32_t o = 0; o < HID; ++o)
+        {
+            hidden_max = (h[o] > hidden_max) ? h[o] : hidden_max;
+        }
+        for (uint32_t o = 0; o < OUT; ++o)
+        {
+            float acc = p->b2[o];
+
+            for (uint32_t i = 0; i < HID; ++i)
+            {
+                acc += h[i] * p->w2[o][i];
+            }
+            output_max = (fabsf(acc) > output_max) ? fabsf(acc) : output_max;
+        }
+    }
+
+    for (uint32_t o = 0; o < HID; ++o)
+    {
+        for (uint32_t i = 0; i < IN; ++i)
+        {
+            w1_max = (fabsf(p->w1[o][i]) > w1_max) ? fabsf(p->w1[o][i]) : w1_max;
+        }
+    }
+    for (uint32_t o = 0; o < OUT; ++o)
+    {
+        for (uint32_t i = 0; i < HID; ++i)
+        {
+            w2_max = (fabsf(p->w2[o][i]) > w2_max) ? fabsf(p->w2[o][i]) : w2_max;
+        }
+    }
+
+    s_w1 = w1_max / 127.0f;
+    s_w2 = w2_max / 127.0f;
+    s_hidden = hidden_max / 255.0f;     /* ReLU output 0 .. max on -128 .. 127 */
+    s_output = output_max / 127.0f;
+
+    memset(model, 0, sizeof(*model));
+    for (uint32_t o = 0; o < HID; ++o)
+    {
+        for (uint32_t i = 0; i < IN; ++i)
+        {
+            model->hidden_weights[o][i] = quantize_s8(p->w1[o][i] / s_w1);
+        }
+        model->hidden_bias[o] = (int32_t)lroundf(p->b1[o] / (RADAR_NN_INPUT_SCALE * s_w1));
+    }
+    quantize_multiplier((double)RADAR_NN_INPUT_SCALE * s_w1 / s_hidden, &model->hidden_multiplier, &model->hidden_shift);
+    model->hidden_offset = -128;
+
+    for (uint32_t o = 0; o < OUT; ++o)
+    {
+        for (uint32_t i = 0; i < HID; ++i)
+        {
+            model->output_weights[o][i] = quantize_s8(p->w2[o][i] / s_w2);
+        }
+        model->output_bias[o] = (int32_t)lroundf(p->b2[o] / (s_hidden * s_w2));
+    }
+    quantize_multiplier((double)s_hidden * s_w2 / s_output, &model->output_multiplier, &model->output_shift);
+    model->output_scale = s_output;
+
+    /* the float model folds the input scale into the accumulation, see radar_nn_infer_f32() */
+    memcpy(model->hidden_weights_f32, p->w1, sizeof(p->w1));
+    memcpy(model->hidden_bias_f32, p->b1, sizeof(p->b1));
+    memcpy(model->output_weights_f32, p->w2, sizeof(p->w2));
+    memcpy(model->output_bias_f32, p->b2, sizeof(p->b2));
+
+    printf("\ncalibration on %zu frames: hidden 0 .. %.3f, output +-%.3f, weights +-%.3f, +-%.3f\n",
+           data->count, hidden_max, output_max, w1_max, w2_max);
+}
+
+/*******************************************************************************
+ * Function Name: report
+ ********************************************************************************
+ * Summary:
+ *   Prints frame accuracy, agreement and time per frame of both models
+ *******************************************************************************/
+static void report(const radar_nn_model_s *model, const dataset_s *data, const char *name)
+{
+    radar_nn_s nn;
+    size_t correct[2] = { 0, 0 };
+    size_t gestures = 0;
+    size_t gestures_correct[2] = { 0, 0 };
+    size_t agree = 0;
+    double prob_delta = 0.0;
+    double seconds[2] = { 0.0, 0.0 };
+
+    if (radar_nn_init(&nn, model, malloc) != 0)
+    {
+        return;
+    }
+
+    for (size_t n = 0; n < data->count; ++n)
+    {
+        const int8_t *features = &data->features[n * IN];
+        float32_t probs[2][OUT];
+        uint32_t idx[2] = { 0, 0 };
+
+        for (uint32_t q = 0; q < 2U; ++q)
+        {
+            struct timespec start;
+            struct timespec end;
+
+            clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
+            if (q == 0U)
+            {
+                radar_nn_infer_f32(&nn, features, probs[q]);
+            }
+            else
+            {
+                radar_nn_infer_s8(&nn, features, probs[q]);
+            }
+            clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
+            seconds[q] += (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) * 1e-9);
+
+            for (uint32_t o = 1; o < OUT; ++o)
+            {
+                idx[q] = (probs[q][o] > probs[q][idx[q]]) ? o : idx[q];
+            }
+            correct[q] += (idx[q] == data->labels[n]) ? 1U : 0U;
+            gestures_correct[q] += ((data->labels[n] != 0U) && (idx[q] == data->labels[n])) ? 1U : 0U;
+        }
+
+        gestures += (data->labels[n] != 0U) ? 1U : 0U;
+        agree += (idx[0] == idx[1]) ? 1U : 0U;
+        prob_delta += fabsf(probs[0][idx[0]] - probs[1][idx[0]]);
+    }
+
+    printf("\n%s: %zu frames, %zu of them gestures\n", name, data->count, gestures);
+    printf("%8s %10s %10s %12s\n", "model", "frames %", "gestures %", "us/frame");
+    for (uint32_t q = 0; q < 2U; ++q)
+    {
+        printf("%8s %10.2f %10.2f %12.2f\n", (q == 0U) ? "float" : "int8",
+               100.0 * (double)correct[q] / (double)data->count,
+               (gestures > 0U) ? (100.0 * (double)gestures_correct[q] / (double)gestures) : 0.0,
+               1e6 * seconds[q] / (double)data->count);
+    }
+    printf("int8 agrees with float on %.2f %% of the frames, probability delta %.4f mean\n",
+           100.0 * (double)agree / (double)data->count, prob_delta / (double)data->count);
+    printf("parameters: int8 %zu bytes, float %zu bytes; arena %u bytes; %u MACs per frame\n",
+           (size_t)offsetof(radar_nn_model_s, hidden_weights_f32),
+           sizeof(radar_nn_model_s) - offsetof(radar_nn_model_s, hidden_weights_f32),
+           (unsigned)RADAR_NN_MEM_SIZE, (unsigned)((IN * HID) + (HID * OUT)));
+
+    free(nn.features);
+    free(nn.hidden);
+    free(nn.output);
+    free(nn.hidden_f32);
+    free(nn.output_f32);
+}
+
+/*******************************************************************************
+ * Function Name: write_array_s8
+ ********************************************************************************
+ * Summary:
+ *   Writes an int8 array initializer, 16 values per line
+ *******************************************************************************/
+static void write_array_s8(FILE *f, const int8_t *values, size_t count, const char *indent)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        fprintf(f, "%s%d%s", ((i % 16U) == 0U) ? indent : " ", values[i],
+                (i + 1U < count) ? (((i % 16U) == 15U) ? ",\n" : ",") : "\n");
+    }
+}
+
+/*******************************************************************************
+ * Function Name: write_array_f32
+ ********************************************************************************
+ * Summary:
+ *   Writes a float array initializer, 8 values per line
+ *******************************************************************************/
+static void write_array_f32(FILE *f, const float *values, size_t count, const char *indent)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        fprintf(f, "%s%.9gf%s", ((i % 8U) == 0U) ? indent : " ", (double)values[i],
+                (i + 1U < count) ? (((i % 8U) == 7U) ? ",\n" : ",") : "\n");
+    }
+}
+
+/*******************************************************************************
+ * Function Name: write_array_s32
+ ********************************************************************************
+ * Summary:
+ *   Writes an int32 array initializer, 8 values per line
+ *******************************************************************************/
+static void write_array_s32(FILE *f, const int32_t *values, size_t count, const char *indent)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        fprintf(f, "%s%ld%s", ((i % 8U) == 0U) ? indent : " ", (long)values[i],
+                (i + 1U < count) ? (((i % 8U) == 7U) ? ",\n" : ",") : "\n");
+    }
+}
+
+/*******************************************************************************
+ * Function Name: write_model
+ ********************************************************************************
+ * Summary:
+ *   Writes the model parameters as C source
+ *
+ * Return:
+ *   0 on success, -1 if the file cannot be written
+ *******************************************************************************/
+static int write_model(const radar_nn_model_s *model, const char *path, const char *summary)
+{
+    FILE *f = fopen(path, "w");
+
+    if (f == NULL)
+    {
+        return -1;
+    }
+
+    fprintf(f,
+        "/*****************************************************************************\n"
+        " * File name: radar_nn_model.c\n"
+        " *\n"
+        " * Description: This file contains the parameters of the gesture classifier\n"
+        " * of radar_nn.h. It is generated by tools/radar_nn_train.c, do not edit.\n"
+        " *\n"
+        " * %s\n"
+        " *\n"
+        " * ===========================================================================\n"
+        " * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.\n"
+        " * ===========================================================================\n"
+        " *\n"
+        " * ===========================================================================\n"
+        " * Infineon Technologies AG (INFINEON) is supplying this file for use\n"
+        " * exclusively with Infineon's sensor products. This file can be freely\n"
+        " * distributed within development tools and software supporting such\n"
+        " * products.\n"
+        " *\n"
+        " * THIS SOFTWARE IS PROVIDED \"AS IS\".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED\n"
+        " * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF\n"
+        " * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.\n"
+        " * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,\n"
+        " * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON\n"
+        " * WHATSOEVER.\n"
+        " * ===========================================================================\n"
+        " */\n\n"
+        "#include \"radar_nn.h\"\n\n"
+        "const radar_nn_model_s radar_nn_model =\n{\n", summary);
+
+    fprintf(f, "    .hidden_weights = {\n");
+    for (uint32_t o = 0; o < HID; ++o)
+    {
+        fprintf(f, "        {\n");
+        write_array_s8(f, model->hidden_weights[o], IN, "            ");
+        fprintf(f, "        }%s\n", (o + 1U < HID) ? "," : "");
+    }
+    fprintf(f, "    },\n    .hidden_bias = {\n");
+    write_array_s32(f, model->hidden_bias, HID, "        ");
+    fprintf(f, "    },\n    .hidden_multiplier = %ld,\n    .hidden_shift = %ld,\n    .hidden_offset = %ld,\n\n",
+            (long)model->hidden_multiplier, (long)model->hidden_shift, (long)model->hidden_offset);
+
+    fprintf(f, "    .output_weights = {\n");
+    for (uint32_t o = 0; o < OUT; ++o)
+    {
+        fprintf(f, "        {\n");
+        write_array_s8(f, model->output_weights[o], HID, "            ");
+        fprintf(f, "        }%s\n", (o + 1U < OUT) ? "," : "");
+    }
+    fprintf(f, "    },\n    .output_bias = {\n");
+    write_array_s32(f, model->output_bias, OUT, "        ");
+    fprintf(f, "    },\n    .output_multiplier = %ld,\n    .output_shift = %ld,\n    .output_scale = %.9gf,\n\n",
+            (long)model->output_multiplier, (long)model->output_shift, (double)model->output_scale);
+
+    fprintf(f, "    .hidden_weights_f32 = {\n");
+    for (uint32_t o = 0; o < HID; ++o)
+    {
+        fprintf(f, "        {\n");
+        write_array_f32(f, model->hidden_weights_f32[o], IN, "            ");
+        fprintf(f, "        }%s\n", (o + 1U < HID) ? "," : "");
+    }
+    fprintf(f, "    },\n    .hidden_bias_f32 = {\n");
+    write_array_f32(f, model->hidden_bias_f32, HID, "        ");
+    fprintf(f, "    },\n    .output_weights_f32 = {\n");
+    for (uint32_t o = 0; o < OUT; ++o)
+    {
+        fprintf(f, "        {\n");
+        write_array_f32(f, model->output_weights_f32[o], HID, "            ");
+        fprintf(f, "        }%s\n", (o + 1U < OUT) ? "," : "");
+    }
+    fprintf(f, "    },\n    .output_bias_f32 = {\n");
+    write_array_f32(f, model->output_bias_f32, OUT, "        ");
+    fprintf(f, "    }\n};\n");
+
+    return (fclose(f) == 0) ? 0 : -1;
+}
+
+/*******************************************************************************
+ * Function Name: extract_all
+ ********************************************************************************
+ * Summary:
+ *   Extracts the features of recordings on the worker threads and merges
+ *   them in the order of the recordings
+ *
+ * Return:
+ *   0 on success, -1 otherwise
+ *******************************************************************************/
+static int extract_all(char **paths, uint32_t count, uint32_t num_threads, dataset_s *data)
+{
+    pthread_t threads[THREADS_UB];
+    int result = 0;
+
+    train.jobs = calloc(count, sizeof(job_s));
+    if (train.jobs == NULL)
+    {
+        return -1;
+    }
+    train.num_jobs = count;
+    train.next_job = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        train.jobs[i].path = paths[i];
+    }
+
+    num_threads = (num_threads < count) ? num_threads : count;
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        pthread_create(&threads[t], NULL, extract_worker, NULL);
+    }
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        job_s *job = &train.jobs[i];
+
+        if (!job->ok)
+        {
+            fprintf(stderr, "cannot read %s or its labels\n", job->path);
+            result = -1;
+        }
+        for (size_t n = 0; (result == 0) && (n < job->data.count); ++n)
+        {
+            result = dataset_add(data, &job->data.features[n * IN], job->data.labels[n]);
+        }
+        free(job->data.features);
+        free(job->data.labels);
+    }
+    free(train.jobs);
+
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    static params_s params;
+    static radar_nn_model_s model;
+    static char *validation[RECORDINGS_UB];
+    dataset_s train_data = { 0 };
+    dataset_s validation_data = { 0 };
+    uint32_t num_validation = 0;
+    uint32_t num_threads = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t epochs = 40;
+    const char *out_path = "source/radar_nn_model.c";
+    char summary[256];
+    int opt;
+
+    train.packed = 1;
+    train.num_samples_per_chirp = XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP;
+    train.num_chirps_per_frame = XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME;
+    train.num_rx_antennas = XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS;
+
+    while ((opt = getopt(argc, argv, "t:f:g:e:v:o:")) != -1)
+    {
+        switch (opt)
+        {
+            case 't':
+                num_threads = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                train.packed = (strcmp(optarg, "u16") == 0) ? 0 : ((strcmp(optarg, "packed") == 0) ? 1 : -1);
+                break;
+            case 'g':
+                if (sscanf(optarg, "%u,%u,%u", &train.num_samples_per_chirp, &train.num_chirps_per_frame,
+                           &train.num_rx_antennas) != 3)
+                {
+                    train.packed = -1;
+                }
+                break;
+            case 'e':
+                epochs = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'v':
+                if (num_validation < RECORDINGS_UB)
+                {
+                    validation[num_validation++] = optarg;
+                }
+                break;
+            case 'o':
+                out_path = optarg;
+                break;
+            default:
+                train.packed = -1;
+                break;
+        }
+    }
+
+    if ((optind >= argc) || (train.packed < 0) || (num_threads == 0U) || (num_threads > THREADS_UB) ||
+        (epochs == 0U) || (train.num_rx_antennas != 3U))
+    {
+        fprintf(stderr, "usage: %s [-t threads] [-f packed|u16] [-g samples,chirps,3] [-e epochs] "
+                "[-v validation.raw]... [-o radar_nn_model.c] <recording.raw>...\n", argv[0]);
+        return 2;
+    }
+
+    if ((extract_all(&argv[optind], (uint32_t)(argc - optind), num_threads, &train_data) != 0) ||
+        (extract_all(validation, num_validation, num_threads, &validation_data) != 0) ||
+        (train_data.count == 0U))
+    {
+        return 1;
+    }
+
+    train_model(&params, &train_data, epochs);
+    calibrate(&params, &train_data, &model);
+
+    report(&model, &train_data, "training");
+    if (validation_data.count > 0U)
+    {
+        report(&model, &validation_data, "validation");
+    }
+
+    snprintf(summary, sizeof(summary), "Trained on %zu frames of %d recordings in %u epochs.",
+             train_data.count, argc - optind, epochs);
+    if (write_model(&model, out_path, summary) != 0)
+    {
+        fprintf(stderr, "cannot write %s\n", out_path);
+        return 1;
+    }
+    printf("\nmodel written to %s\n", out_path);
+
+    return 0;
+}
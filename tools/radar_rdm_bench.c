@@ -0,0 +1,720 @@
+/*****************************************************************************
+ * File name: radar_rdm_bench.c
+ *
+ * Description: Host benchmark of the radar data manager. Builds
+ * xensiv_radar_data_management.c unchanged against the FreeRTOS stand-ins
+ * of tools/rdm_host and runs the cycle of the application: the FIFO
+ * interrupt calls run(), every subscriber reads and acknowledges the data
+ * it was notified of. Frame sizes of the radar profiles, buffer multiples,
+ * fill levels and 1 to 4 subscribers are swept. Reported per configuration
+ * are the nanoseconds per run(), split into the frame read and the manager
+ * itself, the bytes copied, moved and cleared per frame, the frames per
+ * second the manager could take at the median run() and the frames it
+ * drops. With -o every configuration is appended as a CSV line tagged
+ * with -t, so results of different revisions of the buffering scheme can
+ * be compared. Before the measurement, every frame is tagged with its
+ * number and random sequences of reads, acknowledges, discards and
+ * flushes check that the frames leave the buffer in order, that the
+ * coalescing discard keeps the newest frame and counts the others, and
+ * that a flush leaves the buffer empty and readable again.
+ *
+ * Build: gcc -O2 -DCY_RTOS_AWARE -Isource -Itools/rdm_host
+ *            tools/radar_rdm_bench.c source/xensiv_radar_data_management.c
+ *            -o radar_rdm_bench
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "xensiv_radar_data_management.h"
+
+/* the stand-ins count the copies of the manager, not the ones of the benchmark */
+#undef memcpy
+#undef memset
+#undef memmove
+
+/* packed 12-bit samples, 3 bytes per 2 samples like RADAR_SAMPLE12_BYTES */
+#define FRAME_BYTES(samples)        ((((samples) + 1U) / 2U) * 3U)
+
+/* run() calls before the measurement, the buffer reaches its steady state */
+#define WARMUP_RUNS                 (64U)
+
+/* random steps of the check of every buffer size */
+#define CHECK_STEPS                 (20000U)
+
+#define NUMBER_OF_PROFILES          (sizeof(profiles) / sizeof(profiles[0]))
+#define NUMBER_OF_MULTIPLES         (sizeof(multiples) / sizeof(multiples[0]))
+#define NUMBER_OF_FILL_LEVELS       (sizeof(fill_levels) / sizeof(fill_levels[0]))
+
+/*
+ * @typedef typedef struct  bench_profile_s
+ * Frame geometry of a radar profile of radar_profiles.c
+ */
+typedef struct {
+    const char *name;
+    uint32_t num_samples_per_chirp;
+    uint32_t num_chirps_per_frame;
+    uint32_t num_rx_antennas;
+} bench_profile_s;
+
+/*
+ * @typedef typedef struct  bench_result_s
+ * Measurement of one configuration
+ */
+typedef struct {
+    uint32_t run_ns;                /*<< median of run() */
+    uint32_t manager_ns;            /*<< median of run() without the frame read */
+    uint32_t frames;                /*<< frames of the FIFO, one per run() */
+    uint32_t accepted;              /*<< frames the manager took */
+    uint64_t read_bytes;            /*<< copied from the FIFO into the buffer */
+    uint64_t moved_bytes;           /*<< moved to the front of the buffer */
+    uint64_t cleared_bytes;         /*<< cleared by the manager */
+    uint32_t wakeups;               /*<< notifications of all subscribers */
+} bench_result_s;
+
+/* Subscriber task, the handle of the stand-in notifications */
+struct tskTaskControlBlock {
+    int32_t subscription_id;
+    uint32_t pending;               /*<< notifications not taken yet */
+};
+
+/* Geometries of the profile table, first one is the default */
+static const bench_profile_s profiles[] =
+{
+    { "gestures", 64U, 32U, 3U },
+    { "balanced", 64U, 16U, 3U },
+    { "coarse",   32U, 16U, 3U },
+    { "single",   64U, 32U, 1U },
+    { "presence", 64U, 16U, 1U }
+};
+
+/* RDM buffer in frames, the application uses RADAR_PROFILE_RDM_FRAMES (6) */
+static const uint32_t multiples[] = { 1U, 2U, 3U, 4U, 6U, 8U };
+
+/* fill level in frames, the application uses 1 */
+static const uint32_t fill_levels[] = { 1U, 2U, 3U };
+
+static radar_data_manager_s mgr;
+
+/* frame the FIFO delivers and bookkeeping of the running configuration */
+static uint8_t *fifo_frame;
+static uint32_t fifo_frame_bytes;
+static bench_result_s *result;
+static uint64_t read_ns;
+
+/* number of the next frame of the FIFO, written to the front of every frame */
+static uint32_t fifo_seq;
+
+static uint64_t copied_bytes;
+static uint64_t cleared_bytes;
+
+/* timer overhead subtracted from every measurement */
+static uint64_t timer_ns;
+
+/* keeps the reads of the subscribers */
+static volatile uint8_t sink;
+
+/*******************************************************************************
+ * Function Name: now_ns
+ ********************************************************************************
+ * Summary:
+ *   Monotonic time in nanoseconds
+ *******************************************************************************/
+static uint64_t now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+/*******************************************************************************
+ * Function Name: rdm_host_memcpy
+ ********************************************************************************
+ * Summary:
+ *   memcpy of the manager, counts the bytes
+ *******************************************************************************/
+void* rdm_host_memcpy(void *dst, const void *src, size_t n)
+{
+    copied_bytes += n;
+
+    return memcpy(dst, src, n);
+}
+
+/*******************************************************************************
+ * Function Name: rdm_host_memset
+ ********************************************************************************
+ * Summary:
+ *   memset of the manager, counts the bytes
+ *******************************************************************************/
+void* rdm_host_memset(void *dst, int value, size_t n)
+{
+    cleared_bytes += n;
+
+    return memset(dst, value, n);
+}
+
+/*******************************************************************************
+ * Function Name: rdm_host_memmove
+ ********************************************************************************
+ * Summary:
+ *   memmove of the manager, counts the bytes
+ *******************************************************************************/
+void* rdm_host_memmove(void *dst, const void *src, size_t n)
+{
+    copied_bytes += n;
+
+    return memmove(dst, src, n);
+}
+
+/*******************************************************************************
+ * Function Name: vTaskNotifyGiveFromISR
+ ********************************************************************************
+ * Summary:
+ *   Notification of a subscriber from the interrupt
+ *******************************************************************************/
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_task_woken)
+{
+    task->pending++;
+    *higher_priority_task_woken = pdTRUE;
+}
+
+/*******************************************************************************
+ * Function Name: xTaskNotifyGive
+ ********************************************************************************
+ * Summary:
+ *   Notification of a subscriber from a task
+ *******************************************************************************/
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    task->pending++;
+
+    return pdTRUE;
+}
+
+/*******************************************************************************
+ * Function Name: fifo_read
+ ********************************************************************************
+ * Summary:
+ *   Read function of the manager. Like read_radar_data of main.c it takes a
+ *   whole frame or, without room for it, drops the frame in the FIFO.
+ *******************************************************************************/
+static int32_t fifo_read(uint16_t *data, uint32_t *num_samples, uint32_t samples_ub)
+{
+    const uint64_t start = now_ns();
+
+    if (samples_ub < fifo_frame_bytes)
+    {
+        return -2;
+    }
+
+    memcpy(data, fifo_frame, fifo_frame_bytes);
+    memcpy(data, &fifo_seq, sizeof(fifo_seq));
+    fifo_seq++;
+    *num_samples = fifo_frame_bytes;
+
+    result->accepted++;
+    result->read_bytes += fifo_frame_bytes;
+
+    read_ns += now_ns() - start;
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: compare_u32
+ ********************************************************************************
+ * Summary:
+ *   qsort comparison
+ *******************************************************************************/
+static int compare_u32(const void *a, const void *b)
+{
+    const uint32_t x = *(const uint32_t*)a;
+    const uint32_t y = *(const uint32_t*)b;
+
+    return (x > y) - (x < y);
+}
+
+/*******************************************************************************
+ * Function Name: subscribers_consume
+ ********************************************************************************
+ * Summary:
+ *   Every notified subscriber takes its notifications at once, then reads and
+ *   acknowledges the data until nothing is buffered, like the main task. The
+ *   data is consumed with the acknowledge of the last subscriber.
+ *******************************************************************************/
+static void subscribers_consume(struct tskTaskControlBlock *tasks, uint32_t num_subscribers, uint32_t *wakeups)
+{
+    bool notified = false;
+
+    for (uint32_t i = 0; i < num_subscribers; ++i)
+    {
+        if (tasks[i].pending != 0U)
+        {
+            tasks[i].pending = 0;
+            (*wakeups)++;
+            notified = true;
+        }
+    }
+
+    while (notified && (mgr.get_buffered() > 0U))
+    {
+        for (uint32_t i = 0; i < num_subscribers; ++i)
+        {
+            uint16_t *data;
+            uint32_t size;
+
+            if (mgr.read_from_buffer(tasks[i].subscription_id, &data, &size) == 0)
+            {
+                sink ^= ((const uint8_t*)data)[0] ^ ((const uint8_t*)data)[size - 1U];
+                mgr.ack_data_read(tasks[i].subscription_id);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: frame_seq
+ ********************************************************************************
+ * Summary:
+ *   Number of the frame at the head of the buffer, UINT32_MAX if no frame
+ *   can be read by the subscriber
+ *******************************************************************************/
+static uint32_t frame_seq(int32_t subscription_id)
+{
+    uint16_t *data;
+    uint32_t size;
+    uint32_t seq;
+
+    if (mgr.read_from_buffer(subscription_id, &data, &size) != 0)
+    {
+        return UINT32_MAX;
+    }
+    memcpy(&seq, data, sizeof(seq));
+
+    return seq;
+}
+
+/*******************************************************************************
+ * Function Name: check_config
+ ********************************************************************************
+ * Summary:
+ *   Random sequence of frames, reads and acknowledges of two subscribers,
+ *   coalescing discards and flushes on a buffer of the given frames. The
+ *   frames are tracked by their numbers, the oldest buffered one is next.
+ *
+ * Return:
+ *   number of failed checks
+ *******************************************************************************/
+static uint32_t check_config(uint32_t frame_bytes, uint32_t multiple)
+{
+    struct tskTaskControlBlock tasks[2];
+    bench_result_s dummy;
+    uint32_t oldest = 0;
+    uint32_t failed = 0;
+
+    if (radar_data_manager_init(&mgr, frame_bytes * multiple, frame_bytes) != RDM_SUCCESS)
+    {
+        return 1;
+    }
+    mgr.in_read_radar_data = fifo_read;
+    for (uint32_t i = 0; i < 2U; ++i)
+    {
+        tasks[i].pending = 0;
+        tasks[i].subscription_id = mgr.subscribe(&tasks[i]);
+    }
+
+    result = &dummy;
+    fifo_frame_bytes = frame_bytes;
+    fifo_seq = 0;
+
+    for (uint32_t step = 0; step < CHECK_STEPS; ++step)
+    {
+        const uint32_t buffered = fifo_seq - oldest;
+        const uint32_t action = (uint32_t)rand() % 16U;
+
+        if (action < 7U)
+        {
+            /* a frame arrives, a full buffer drops it in the FIFO */
+            const uint32_t seq = fifo_seq;
+
+            mgr.run(true);
+            if ((buffered == multiple) != (fifo_seq == seq))
+            {
+                printf("error: buffer %u frames, frame %u %s\n", multiple, seq,
+                       (fifo_seq == seq) ? "dropped with room left" : "taken into a full buffer");
+                failed++;
+            }
+        }
+        else if (action < 13U)
+        {
+            /* both subscribers read the oldest frame, the second acknowledge consumes it */
+            const uint32_t first = frame_seq(tasks[0].subscription_id);
+            const uint32_t expected = (buffered > 0U) ? oldest : UINT32_MAX;
+
+            if (first != expected)
+            {
+                printf("error: buffer %u frames, read frame %d, expected %d\n", multiple,
+                       (int)first, (int)expected);
+                failed++;
+            }
+            if (buffered == 0U)
+            {
+                continue;
+            }
+            mgr.ack_data_read(tasks[0].subscription_id);
+            if ((frame_seq(tasks[0].subscription_id) != UINT32_MAX) ||
+                (frame_seq(tasks[1].subscription_id) != oldest) || (mgr.get_buffered() != buffered))
+            {
+                printf("error: buffer %u frames, frame %u consumed before the last acknowledge\n",
+                       multiple, oldest);
+                failed++;
+            }
+            mgr.ack_data_read(tasks[1].subscription_id);
+            oldest++;
+        }
+        else if (action < 15U)
+        {
+            /* coalescing: only the newest frame is left, after a read of the oldest */
+            const uint32_t discarded = ((void)frame_seq(tasks[0].subscription_id), mgr.discard(1U));
+            const uint32_t expected = (buffered > 1U) ? (buffered - 1U) : 0U;
+
+            oldest += expected;
+            if ((discarded != expected) ||
+                ((buffered > 0U) && (frame_seq(tasks[0].subscription_id) != (fifo_seq - 1U))))
+            {
+                printf("error: buffer %u frames, coalesced %u of %u frames, %u expected, newest %s\n",
+                       multiple, discarded, buffered, expected,
+                       (frame_seq(tasks[0].subscription_id) == (fifo_seq - 1U)) ? "kept" : "lost");
+                failed++;
+            }
+        }
+        else
+        {
+            /* flush after a read that was not acknowledged, the next frame is readable */
+            (void)frame_seq(tasks[1].subscription_id);
+            if ((mgr.discard(0U) != buffered) || (mgr.get_buffered() != 0U))
+            {
+                printf("error: buffer %u frames, flush of %u frames\n", multiple, buffered);
+                failed++;
+            }
+            oldest = fifo_seq;
+            mgr.run(true);
+            if ((frame_seq(tasks[0].subscription_id) != oldest) || (frame_seq(tasks[1].subscription_id) != oldest))
+            {
+                printf("error: buffer %u frames, frame %u not readable after a flush\n", multiple, oldest);
+                failed++;
+            }
+        }
+
+        if (mgr.get_buffered() != (fifo_seq - oldest))
+        {
+            printf("error: buffer %u frames, %u buffered, %u expected\n", multiple, mgr.get_buffered(),
+                   fifo_seq - oldest);
+            failed++;
+            oldest = fifo_seq - mgr.get_buffered();
+        }
+    }
+
+    for (uint32_t i = 0; i < 2U; ++i)
+    {
+        mgr.unsubscribe(tasks[i].subscription_id);
+    }
+
+    return failed + ((radar_data_manager_deinit() == 0) ? 0U : 1U);
+}
+
+/*******************************************************************************
+ * Function Name: bench_config
+ ********************************************************************************
+ * Summary:
+ *   Runs one configuration for the given number of frames
+ *
+ * Return:
+ *   zero (0) on success
+ *******************************************************************************/
+static int bench_config(uint32_t frame_bytes, uint32_t multiple, uint32_t fill_frames,
+                        uint32_t num_subscribers, uint32_t frames, uint32_t *run_ns,
+                        uint32_t *manager_ns, bench_result_s *out)
+{
+    struct tskTaskControlBlock tasks[ACTIVE_SUBSCRIPTION_UB];
+    uint32_t wakeups = 0;
+
+    if (radar_data_manager_init(&mgr, frame_bytes * multiple, frame_bytes * fill_frames) != RDM_SUCCESS)
+    {
+        return -1;
+    }
+    mgr.in_read_radar_data = fifo_read;
+
+    for (uint32_t i = 0; i < num_subscribers; ++i)
+    {
+        tasks[i].pending = 0;
+        tasks[i].subscription_id = mgr.subscribe(&tasks[i]);
+        if (tasks[i].subscription_id <= 0)
+        {
+            return -1;
+        }
+    }
+
+    (void)memset(out, 0, sizeof(*out));
+    result = out;
+    fifo_frame_bytes = frame_bytes;
+
+    for (uint32_t i = 0; i < WARMUP_RUNS; ++i)
+    {
+        mgr.run(true);
+        subscribers_consume(tasks, num_subscribers, &wakeups);
+    }
+
+    (void)memset(out, 0, sizeof(*out));
+    copied_bytes = 0;
+    cleared_bytes = 0;
+    wakeups = 0;
+
+    for (uint32_t i = 0; i < frames; ++i)
+    {
+        uint64_t start;
+        uint64_t ns;
+
+        read_ns = 0;
+        start = now_ns();
+        mgr.run(true);
+        ns = now_ns() - start;
+
+        ns = (ns > timer_ns) ? (ns - timer_ns) : 0U;
+        read_ns = (read_ns > timer_ns) ? (read_ns - timer_ns) : 0U;
+        run_ns[i] = (uint32_t)ns;
+        manager_ns[i] = (uint32_t)((ns > read_ns) ? (ns - read_ns) : 0U);
+
+        subscribers_consume(tasks, num_subscribers, &wakeups);
+    }
+
+    out->frames = frames;
+    out->moved_bytes = copied_bytes;
+    out->cleared_bytes = cleared_bytes;
+    out->wakeups = wakeups;
+
+    qsort(run_ns, frames, sizeof(run_ns[0]), compare_u32);
+    qsort(manager_ns, frames, sizeof(manager_ns[0]), compare_u32);
+    out->run_ns = run_ns[frames / 2U];
+    out->manager_ns = manager_ns[frames / 2U];
+
+    for (uint32_t i = 0; i < num_subscribers; ++i)
+    {
+        mgr.unsubscribe(tasks[i].subscription_id);
+    }
+
+    return (radar_data_manager_deinit() == 0) ? 0 : -1;
+}
+
+/*******************************************************************************
+ * Function Name: measure_timer
+ ********************************************************************************
+ * Summary:
+ *   Smallest time between two readings of the clock
+ *******************************************************************************/
+static uint64_t measure_timer(void)
+{
+    uint64_t best = UINT64_MAX;
+
+    for (uint32_t i = 0; i < 1000U; ++i)
+    {
+        const uint64_t start = now_ns();
+        const uint64_t ns = now_ns() - start;
+
+        if (ns < best)
+        {
+            best = ns;
+        }
+    }
+
+    return best;
+}
+
+int main(int argc, char **argv)
+{
+    const char *csv_path = NULL;
+    const char *tag = "-";
+    const char *profile_name = NULL;
+    uint32_t frames = 4000U;
+    uint32_t *run_ns;
+    uint32_t *manager_ns;
+    FILE *csv = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:o:t:p:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                frames = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'o':
+                csv_path = optarg;
+                break;
+            case 't':
+                tag = optarg;
+                break;
+            case 'p':
+                profile_name = optarg;
+                break;
+            default:
+                frames = 0;
+                break;
+        }
+    }
+
+    if ((frames == 0U) || (optind != argc))
+    {
+        fprintf(stderr, "usage: %s [-n frames] [-p profile] [-o results.csv] [-t tag]\n", argv[0]);
+        return 2;
+    }
+
+    run_ns = malloc(frames * sizeof(uint32_t));
+    manager_ns = malloc(frames * sizeof(uint32_t));
+    fifo_frame = malloc(FRAME_BYTES(64U * 32U * 3U));
+    if ((run_ns == NULL) || (manager_ns == NULL) || (fifo_frame == NULL))
+    {
+        return 1;
+    }
+    for (uint32_t i = 0; i < FRAME_BYTES(64U * 32U * 3U); ++i)
+    {
+        fifo_frame[i] = (uint8_t)(i * 7U);
+    }
+
+    if (csv_path != NULL)
+    {
+        csv = fopen(csv_path, "a");
+        if (csv == NULL)
+        {
+            fprintf(stderr, "cannot open %s\n", csv_path);
+            return 1;
+        }
+        /* header only for a new file */
+        if (ftell(csv) == 0)
+        {
+            fprintf(csv, "tag,profile,frame_bytes,multiple,fill_frames,subscribers,"
+                         "run_ns,manager_ns,bytes_per_frame,frames_per_s,dropped_pct,wakeups_per_frame\n");
+        }
+    }
+
+    for (uint32_t p = 0; p < NUMBER_OF_PROFILES; ++p)
+    {
+        const uint32_t frame_bytes = FRAME_BYTES(profiles[p].num_samples_per_chirp *
+                                                 profiles[p].num_chirps_per_frame *
+                                                 profiles[p].num_rx_antennas);
+        uint32_t failed = 0;
+
+        if ((profile_name != NULL) && (strcmp(profile_name, profiles[p].name) != 0))
+        {
+            continue;
+        }
+
+        for (uint32_t m = 0; m < NUMBER_OF_MULTIPLES; ++m)
+        {
+            failed += check_config(frame_bytes, multiples[m]);
+        }
+
+        if (failed != 0U)
+        {
+            fprintf(stderr, "%s: %u failed checks of the radar data manager\n", profiles[p].name, failed);
+            return 1;
+        }
+    }
+    printf("frame order, coalescing and flush of the radar data manager checked\n");
+
+    timer_ns = measure_timer();
+
+    printf("%u frames per configuration, timer overhead %llu ns subtracted\n\n",
+           frames, (unsigned long long)timer_ns);
+    printf("%-9s %6s %4s %4s %4s %8s %8s %10s %10s %6s %7s\n",
+           "profile", "bytes", "buf", "fill", "subs", "run ns", "mgr ns", "bytes/fr", "frames/s", "drop%", "wake/fr");
+
+    for (uint32_t p = 0; p < NUMBER_OF_PROFILES; ++p)
+    {
+        const uint32_t frame_bytes = FRAME_BYTES(profiles[p].num_samples_per_chirp *
+                                                 profiles[p].num_chirps_per_frame *
+                                                 profiles[p].num_rx_antennas);
+
+        if ((profile_name != NULL) && (strcmp(profile_name, profiles[p].name) != 0))
+        {
+            continue;
+        }
+
+        for (uint32_t m = 0; m < NUMBER_OF_MULTIPLES; ++m)
+        {
+            for (uint32_t f = 0; f < NUMBER_OF_FILL_LEVELS; ++f)
+            {
+                if (fill_levels[f] > multiples[m])
+                {
+                    continue;
+                }
+
+                for (uint32_t subscribers = 1; subscribers <= ACTIVE_SUBSCRIPTION_UB; ++subscribers)
+                {
+                    bench_result_s r;
+                    double bytes_per_frame;
+                    double frames_per_s;
+                    double dropped_pct;
+                    double wakeups_per_frame;
+
+                    if (bench_config(frame_bytes, multiples[m], fill_levels[f], subscribers, frames,
+                                     run_ns, manager_ns, &r) != 0)
+                    {
+                        fprintf(stderr, "radar data manager failed for %s buffer %u fill %u subscribers %u\n",
+                                profiles[p].name, multiples[m], fill_levels[f], subscribers);
+                        return 1;
+                    }
+
+                    bytes_per_frame = (double)(r.read_bytes + r.moved_bytes + r.cleared_bytes) / r.frames;
+                    frames_per_s = (r.run_ns > 0U) ? ((1e9 / r.run_ns) * r.accepted / r.frames) : 0.0;
+                    dropped_pct = 100.0 * (double)(r.frames - r.accepted) / r.frames;
+                    wakeups_per_frame = (double)r.wakeups / r.frames;
+
+                    printf("%-9s %6u %4u %4u %4u %8u %8u %10.0f %10.0f %6.1f %7.2f\n",
+                           profiles[p].name, frame_bytes, multiples[m], fill_levels[f], subscribers,
+                           r.run_ns, r.manager_ns, bytes_per_frame, frames_per_s, dropped_pct, wakeups_per_frame);
+
+                    if (csv != NULL)
+                    {
+                        fprintf(csv, "%s,%s,%u,%u,%u,%u,%u,%u,%.0f,%.0f,%.1f,%.2f\n",
+                                tag, profiles[p].name, frame_bytes, multiples[m], fill_levels[f], subscribers,
+                                r.run_ns, r.manager_ns, bytes_per_frame, frames_per_s, dropped_pct,
+                                wakeups_per_frame);
+                    }
+                }
+            }
+        }
+    }
+
+    if (csv != NULL)
+    {
+        fclose(csv);
+    }
+    free(run_ns);
+    free(manager_ns);
+    free(fifo_frame);
+
+    return 0;
+}
@@ -0,0 +1,287 @@
+/*****************************************************************************
+ * File name: radar_rice_tool.c
+ *
+ * Description: Host tool for the raw frame stream. Decodes the records of a
+ * UART capture into 16-bit samples, or encodes a 16-bit recording to report
+ * the compression ratio and encode time of the codec used on the target.
+ *
+ * Build: gcc -O2 -DRADAR_DSP_REFERENCE -Isource tools/radar_rice_tool.c
+ *            source/radar_rice.c source/radar_sample12.c -o radar_rice_tool
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "radar_rice.h"
+
+/*******************************************************************************
+ * Function Name: load_file
+ ********************************************************************************
+ * Summary:
+ *   Reads a whole file into memory
+ *
+ * Parameters:
+ *   path: file to read
+ *   len: receives the number of bytes read
+ *
+ * Return:
+ *   allocated content, NULL if the file cannot be read
+ *******************************************************************************/
+static uint8_t *load_file(const char *path, uint32_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *data = NULL;
+    long size;
+
+    if (f == NULL)
+    {
+        return NULL;
+    }
+
+    if ((fseek(f, 0, SEEK_END) == 0) && ((size = ftell(f)) > 0) && (fseek(f, 0, SEEK_SET) == 0))
+    {
+        data = malloc((size_t)size);
+        if ((data != NULL) && (fread(data, 1, (size_t)size, f) != (size_t)size))
+        {
+            free(data);
+            data = NULL;
+        }
+        *len = (uint32_t)size;
+    }
+
+    fclose(f);
+    return data;
+}
+
+/*******************************************************************************
+ * Function Name: decode_capture
+ ********************************************************************************
+ * Summary:
+ *   Scans a capture for records, decodes them and writes the samples as
+ *   little endian 16-bit values. Console text between the records is skipped.
+ *
+ * Parameters:
+ *   in_path: UART capture
+ *   out_path: decoded samples
+ *
+ * Return:
+ *   process exit code
+ *******************************************************************************/
+static int decode_capture(const char *in_path, const char *out_path)
+{
+    uint32_t len = 0;
+    uint8_t *capture = load_file(in_path, &len);
+    FILE *out;
+    uint32_t pos = 0;
+    uint32_t records = 0;
+    uint32_t corrupt = 0;
+    uint32_t missing = 0;
+    uint64_t raw_bytes = 0;
+    uint64_t coded_bytes = 0;
+    int32_t last_seq = -1;
+
+    if (capture == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", in_path);
+        return 1;
+    }
+
+    out = fopen(out_path, "wb");
+    if (out == NULL)
+    {
+        fprintf(stderr, "cannot write %s\n", out_path);
+        free(capture);
+        return 1;
+    }
+
+    while (pos < len)
+    {
+        radar_rice_header_s header;
+        uint16_t *samples;
+        uint32_t num_samples;
+
+        if ((radar_rice_parse_header(&capture[pos], len - pos, &header) != 0) ||
+            (header.payload_len > (len - pos - RADAR_RICE_HEADER_SIZE)))
+        {
+            ++pos;
+            continue;
+        }
+
+        num_samples = (uint32_t)header.num_samples_per_chirp * header.num_chirps_per_frame * header.num_rx_antennas;
+        samples = malloc(num_samples * sizeof(uint16_t));
+        if (samples == NULL)
+        {
+            break;
+        }
+
+        if (radar_rice_decode(&header, &capture[pos + RADAR_RICE_HEADER_SIZE], samples) != 0)
+        {
+            /* a false match of the magic or a damaged record, resync on the next byte */
+            ++corrupt;
+            ++pos;
+            free(samples);
+            continue;
+        }
+
+        for (uint32_t i = 0; i < num_samples; ++i)
+        {
+            fputc(samples[i] & 0xFF, out);
+            fputc(samples[i] >> 8, out);
+        }
+        free(samples);
+
+        if (last_seq >= 0)
+        {
+            missing += (uint16_t)(header.seq - (uint16_t)last_seq - 1U);
+        }
+        last_seq = header.seq;
+
+        ++records;
+        raw_bytes += num_samples * sizeof(uint16_t);
+        coded_bytes += RADAR_RICE_HEADER_SIZE + header.payload_len;
+        pos += RADAR_RICE_HEADER_SIZE + header.payload_len;
+    }
+
+    fclose(out);
+    free(capture);
+
+    printf("records %u corrupt %u missing %u ratio %.2f\n", records, corrupt, missing,
+           (coded_bytes != 0U) ? (double)raw_bytes / (double)coded_bytes : 0.0);
+
+    return (records != 0U) ? 0 : 1;
+}
+
+/*******************************************************************************
+ * Function Name: measure_ratio
+ ********************************************************************************
+ * Summary:
+ *   Encodes a recording of 16-bit samples frame by frame, checks the round
+ *   trip and reports the compression ratio and the host encode time
+ *
+ * Parameters:
+ *   in_path: little endian 16-bit samples in FIFO order
+ *   samples_per_chirp, chirps_per_frame, rx_antennas: frame geometry
+ *
+ * Return:
+ *   process exit code
+ *******************************************************************************/
+static int measure_ratio(const char *in_path, uint32_t samples_per_chirp,
+                         uint32_t chirps_per_frame, uint32_t rx_antennas)
+{
+    uint32_t len = 0;
+    uint8_t *recording = load_file(in_path, &len);
+    uint32_t num_samples = samples_per_chirp * chirps_per_frame * rx_antennas;
+    uint32_t frame_bytes = num_samples * sizeof(uint16_t);
+    uint16_t *samples;
+    uint16_t *decoded;
+    uint8_t *packed;
+    uint8_t *record;
+    uint32_t frames = 0;
+    uint32_t errors = 0;
+    uint64_t coded_bytes = 0;
+    double encode_s = 0.0;
+
+    if (recording == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", in_path);
+        return 1;
+    }
+
+    if ((num_samples == 0U) || (len < frame_bytes))
+    {
+        fprintf(stderr, "invalid geometry\n");
+        free(recording);
+        return 1;
+    }
+
+    samples = malloc(frame_bytes);
+    decoded = malloc(frame_bytes);
+    packed = malloc(RADAR_SAMPLE12_BYTES(num_samples));
+    record = malloc(RADAR_RICE_RECORD_SIZE(num_samples));
+
+    for (uint32_t offset = 0; (offset + frame_bytes) <= len; offset += frame_bytes)
+    {
+        radar_rice_header_s header = {
+            .seq = (uint16_t)frames,
+            .num_samples_per_chirp = (uint16_t)samples_per_chirp,
+            .num_chirps_per_frame = (uint16_t)chirps_per_frame,
+            .num_rx_antennas = (uint8_t)rx_antennas
+        };
+        radar_rice_header_s parsed;
+        uint32_t record_len;
+        clock_t start;
+
+        for (uint32_t i = 0; i < num_samples; ++i)
+        {
+            samples[i] = (uint16_t)((recording[offset + (2U * i)] | (recording[offset + (2U * i) + 1U] << 8)) &
+                                    RADAR_SAMPLE12_MAX);
+        }
+        radar_sample12_pack(samples, packed, num_samples);
+
+        start = clock();
+        record_len = radar_rice_encode(packed, &header, record);
+        encode_s += (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        if ((radar_rice_parse_header(record, record_len, &parsed) != 0) ||
+            (radar_rice_decode(&parsed, &record[RADAR_RICE_HEADER_SIZE], decoded) != 0) ||
+            (memcmp(samples, decoded, frame_bytes) != 0))
+        {
+            ++errors;
+        }
+
+        coded_bytes += record_len;
+        ++frames;
+    }
+
+    printf("frames %u errors %u ratio %.2f (packed %.2f) encode %.1f us/frame\n", frames, errors,
+           (double)frames * frame_bytes / (double)coded_bytes,
+           (double)frames * RADAR_SAMPLE12_BYTES(num_samples) / (double)coded_bytes,
+           encode_s * 1e6 / frames);
+
+    free(record);
+    free(packed);
+    free(decoded);
+    free(samples);
+    free(recording);
+
+    return (errors == 0U) ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc == 4) && (strcmp(argv[1], "decode") == 0))
+    {
+        return decode_capture(argv[2], argv[3]);
+    }
+
+    if ((argc == 6) && (strcmp(argv[1], "ratio") == 0))
+    {
+        return measure_ratio(argv[2], (uint32_t)strtoul(argv[3], NULL, 0),
+                             (uint32_t)strtoul(argv[4], NULL, 0), (uint32_t)strtoul(argv[5], NULL, 0));
+    }
+
+    fprintf(stderr, "usage: %s decode <capture> <samples.raw>\n"
+                    "       %s ratio <samples.raw> <samples_per_chirp> <chirps_per_frame> <rx_antennas>\n",
+            argv[0], argv[0]);
+    return 2;
+}
@@ -0,0 +1,220 @@
+/*****************************************************************************
+ * File name: radar_sample12_check.c
+ *
+ * Description: Host round trip of random 12-bit data through the packed FIFO
+ * format. Every frame is packed with radar_sample12_pack and compared with a
+ * bit stream of the samples, most significant bit first. It is then unpacked
+ * with radar_sample12_unpack and de-interleaved with
+ * radar_sample12_deinterleave. The results are compared with the samples
+ * and with the 16-bit de-interleaving of main.c, for even and odd sample
+ * counts and one to three antennas. Bytes past the end of every output
+ * must stay untouched.
+ *
+ * Build: gcc -O2 -DRADAR_DSP_REFERENCE -Isource tools/radar_sample12_check.c
+ *            source/radar_sample12.c -o radar_sample12_check
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "radar_sample12.h"
+
+/* samples per antenna of the largest frame checked, 64 samples x 32 chirps */
+#define MAX_SAMPLES_PER_ANTENNA     (2048U)
+#define MAX_ANTENNAS                (3U)
+#define MAX_SAMPLES                 (MAX_SAMPLES_PER_ANTENNA * MAX_ANTENNAS)
+
+/* bytes behind every output that must not be written */
+#define GUARD_BYTES                 (16U)
+#define GUARD                       (0xA5U)
+
+/*******************************************************************************
+ * Function Name: reference_pack
+ ********************************************************************************
+ * Summary:
+ *   Writes the samples as a 12-bit stream, most significant bit first,
+ *   padded with zeros to whole three byte groups
+ *******************************************************************************/
+static void reference_pack(const uint16_t *src, uint8_t *dst, uint32_t num_samples)
+{
+    memset(dst, 0, RADAR_SAMPLE12_BYTES(num_samples));
+
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        for (uint32_t bit = 0; bit < 12U; ++bit)
+        {
+            const uint32_t pos = (i * 12U) + bit;
+
+            if (((src[i] >> (11U - bit)) & 1U) != 0U)
+            {
+                dst[pos / 8U] |= (uint8_t)(0x80U >> (pos % 8U));
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: reference_deinterleave
+ ********************************************************************************
+ * Summary:
+ *   De-interleaving of 16-bit samples as deinterleave_antennas() of main.c
+ *   does it, with the frame geometry passed in
+ *******************************************************************************/
+static void reference_deinterleave(const uint16_t *buffer_ptr, float32_t *frame,
+                                   uint32_t num_samples, uint32_t num_rx_antennas)
+{
+    const uint32_t samples_per_antenna = num_samples / num_rx_antennas;
+    uint8_t antenna = 0;
+    int32_t index = 0;
+
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        frame[index + antenna * samples_per_antenna] = buffer_ptr[i];
+        antenna++;
+        if (antenna == num_rx_antennas)
+        {
+            antenna = 0;
+            index++;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: guard_intact
+ ********************************************************************************
+ * Summary:
+ *   Checks the guard bytes behind an output
+ *******************************************************************************/
+static int guard_intact(const void *end)
+{
+    const uint8_t *guard = (const uint8_t*)end;
+
+    for (uint32_t i = 0; i < GUARD_BYTES; ++i)
+    {
+        if (guard[i] != GUARD)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*******************************************************************************
+ * Function Name: check_frame
+ ********************************************************************************
+ * Summary:
+ *   Round trip of one frame of random samples
+ *
+ * Return:
+ *   number of failed checks
+ *******************************************************************************/
+static uint32_t check_frame(uint32_t num_samples, uint32_t num_rx_antennas)
+{
+    static uint16_t samples[MAX_SAMPLES];
+    static uint16_t masked[MAX_SAMPLES];
+    static uint16_t unpacked[MAX_SAMPLES + (GUARD_BYTES / 2U)];
+    static uint8_t packed[RADAR_SAMPLE12_BYTES(MAX_SAMPLES) + GUARD_BYTES];
+    static uint8_t expected[RADAR_SAMPLE12_BYTES(MAX_SAMPLES)];
+    static float32_t frame[MAX_SAMPLES + (GUARD_BYTES / 4U)];
+    static float32_t reference[MAX_SAMPLES];
+    const uint32_t packed_bytes = RADAR_SAMPLE12_BYTES(num_samples);
+    uint32_t failed = 0;
+
+    /* full 16-bit values, the pack keeps the lower twelve bits */
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        samples[i] = (uint16_t)rand();
+        masked[i] = samples[i] & RADAR_SAMPLE12_MAX;
+    }
+
+    memset(packed, GUARD, sizeof(packed));
+    radar_sample12_pack(samples, packed, num_samples);
+    reference_pack(masked, expected, num_samples);
+    if ((memcmp(packed, expected, packed_bytes) != 0) || !guard_intact(&packed[packed_bytes]))
+    {
+        printf("error: pack of %u samples\n", num_samples);
+        failed++;
+    }
+
+    memset(unpacked, GUARD, sizeof(unpacked));
+    radar_sample12_unpack(packed, unpacked, num_samples);
+    if ((memcmp(unpacked, masked, num_samples * sizeof(uint16_t)) != 0) || !guard_intact(&unpacked[num_samples]))
+    {
+        printf("error: unpack of %u samples\n", num_samples);
+        failed++;
+    }
+
+    memset(frame, GUARD, sizeof(frame));
+    radar_sample12_deinterleave(packed, frame, num_samples, num_rx_antennas);
+    reference_deinterleave(masked, reference, num_samples, num_rx_antennas);
+    if ((memcmp(frame, reference, num_samples * sizeof(float32_t)) != 0) || !guard_intact(&frame[num_samples]))
+    {
+        printf("error: de-interleave of %u samples on %u antennas\n", num_samples, num_rx_antennas);
+        failed++;
+    }
+
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 10000U;
+    const uint32_t seed = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1U;
+    uint32_t frames = 0;
+    uint32_t odd_frames = 0;
+    uint32_t failed = 0;
+
+    if ((iterations == 0U) || (argc > 3))
+    {
+        fprintf(stderr, "usage: %s [iterations] [seed]\n", argv[0]);
+        return 2;
+    }
+    srand(seed);
+
+    /* every small size, where the tail of an odd count is most of the frame */
+    for (uint32_t antennas = 1; antennas <= MAX_ANTENNAS; ++antennas)
+    {
+        for (uint32_t per_antenna = 1; per_antenna <= 64U; ++per_antenna)
+        {
+            failed += check_frame(per_antenna * antennas, antennas);
+            odd_frames += (per_antenna * antennas) & 1U;
+            frames++;
+        }
+    }
+
+    /* random sizes up to the largest frame */
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        const uint32_t antennas = 1U + ((uint32_t)rand() % MAX_ANTENNAS);
+        const uint32_t per_antenna = 1U + ((uint32_t)rand() % MAX_SAMPLES_PER_ANTENNA);
+
+        failed += check_frame(per_antenna * antennas, antennas);
+        odd_frames += (per_antenna * antennas) & 1U;
+        frames++;
+    }
+
+    printf("%u frames, %u with an odd sample count, 1 to %u antennas: %s\n", frames, odd_frames, MAX_ANTENNAS,
+           (failed == 0U) ? "pack, unpack and de-interleave match the reference" : "MISMATCH");
+
+    return (failed == 0U) ? 0 : 1;
+}
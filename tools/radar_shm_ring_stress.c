@@ -0,0 +1,293 @@
+/*****************************************************************************
+ * File name: radar_shm_ring_stress.c
+ *
+ * Description: Host stress test of the shared-memory frame ring between the
+ * CM0+ and the CM4. A producer thread publishes frames of varying length
+ * with a payload derived from the frame number. On a full ring it mostly
+ * waits, and sometimes discards the frame like the acquisition on the CM0+
+ * does. A consumer thread peeks and releases the frames like the main task.
+ * Both threads stall at random so the ring runs empty and full. The
+ * consumer checks that the frame numbers increase, that every gap is a
+ * counted drop and that every payload arrives intact.
+ *
+ * Build: gcc -O2 -pthread -DRADAR_DSP_REFERENCE -Isource tools/radar_shm_ring_stress.c
+ *            source/radar_shm_ring.c -o radar_shm_ring_stress
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "radar_shm_ring.h"
+
+/* payload bytes of a slot, small so millions of frames pass in seconds */
+#define SLOT_SIZE                   (256U)
+
+/* one step in STALL_ONE_IN stalls for up to STALL_SPINS spins */
+#define STALL_ONE_IN                (64U)
+#define STALL_SPINS                 (2000U)
+
+/* the producer discards a frame on one full ring in DROP_ONE_IN, else it waits */
+#define DROP_ONE_IN                 (16U)
+
+/*
+ * @typedef typedef struct  stress_s
+ * State shared by the threads
+ */
+typedef struct {
+    radar_shm_ring_s ring;
+    uint32_t frames;                /*<< frames the producer offers */
+    volatile bool done;             /*<< the producer offered all frames */
+
+    uint32_t published;             /*<< producer */
+    uint32_t discarded;             /*<< producer, frames not published on a full ring */
+
+    uint32_t received;              /*<< consumer */
+    uint32_t gaps;                  /*<< consumer, frames missing between two received ones */
+    uint32_t last_seq;              /*<< consumer */
+    uint32_t seq_errors;            /*<< consumer, frame numbers not increasing */
+    uint32_t length_errors;         /*<< consumer */
+    uint32_t payload_errors;        /*<< consumer */
+    uint32_t level_max;             /*<< consumer, most frames waiting */
+} stress_s;
+
+/*******************************************************************************
+ * Function Name: next_random
+ ********************************************************************************
+ * Summary:
+ *   xorshift32 step
+ *******************************************************************************/
+static uint32_t next_random(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
+
+/*******************************************************************************
+ * Function Name: stall
+ ********************************************************************************
+ * Summary:
+ *   Spins for a random time once in STALL_ONE_IN calls
+ *******************************************************************************/
+static void stall(uint32_t *state)
+{
+    if ((next_random(state) % STALL_ONE_IN) == 0U)
+    {
+        const uint32_t spins = next_random(state) % STALL_SPINS;
+
+        for (volatile uint32_t i = 0; i < spins; ++i)
+        {
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: frame_length
+ ********************************************************************************
+ * Summary:
+ *   Payload bytes of a frame, 1 to SLOT_SIZE
+ *******************************************************************************/
+static uint32_t frame_length(uint32_t seq)
+{
+    return ((seq * 2654435761U) % SLOT_SIZE) + 1U;
+}
+
+/*******************************************************************************
+ * Function Name: frame_byte
+ ********************************************************************************
+ * Summary:
+ *   Payload byte of a frame
+ *******************************************************************************/
+static uint8_t frame_byte(uint32_t seq, uint32_t i)
+{
+    return (uint8_t)((seq >> ((i & 3U) * 8U)) ^ (i * 31U));
+}
+
+/*******************************************************************************
+ * Function Name: producer
+ ********************************************************************************
+ * Summary:
+ *   Acquisition side: publishes the frames or counts them as dropped
+ *******************************************************************************/
+static void* producer(void *arg)
+{
+    stress_s *stress = (stress_s*)arg;
+    uint32_t random = 0x12345678U;
+
+    for (uint32_t seq = 0; seq < stress->frames; ++seq)
+    {
+        uint8_t *payload = radar_shm_ring_claim(&stress->ring);
+
+        /* mostly wait for the consumer, so millions of frames pass the ring */
+        while ((payload == NULL) && ((next_random(&random) % DROP_ONE_IN) != 0U))
+        {
+            sched_yield();
+            payload = radar_shm_ring_claim(&stress->ring);
+        }
+
+        if (payload == NULL)
+        {
+            radar_shm_ring_drop(&stress->ring);
+            stress->discarded++;
+        }
+        else
+        {
+            const uint32_t length = frame_length(seq);
+
+            for (uint32_t i = 0; i < length; ++i)
+            {
+                payload[i] = frame_byte(seq, i);
+            }
+            radar_shm_ring_publish(&stress->ring, length);
+            stress->published++;
+        }
+
+        stall(&random);
+    }
+
+    __atomic_store_n(&stress->done, true, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/*******************************************************************************
+ * Function Name: consumer
+ ********************************************************************************
+ * Summary:
+ *   Processing side: checks and releases the frames until the producer is
+ *   done and the ring is empty
+ *******************************************************************************/
+static void* consumer(void *arg)
+{
+    stress_s *stress = (stress_s*)arg;
+    uint32_t random = 0x9E3779B9U;
+
+    for (;;)
+    {
+        const uint8_t *payload;
+        uint32_t length;
+        uint32_t seq;
+        const bool done = __atomic_load_n(&stress->done, __ATOMIC_ACQUIRE);
+        const uint32_t level = radar_shm_ring_count(&stress->ring);
+
+        if (level > stress->level_max)
+        {
+            stress->level_max = level;
+        }
+
+        payload = radar_shm_ring_peek(&stress->ring, &length, &seq);
+        if (payload == NULL)
+        {
+            if (done)
+            {
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+
+        if ((stress->received > 0U) && (seq <= stress->last_seq))
+        {
+            stress->seq_errors++;
+        }
+        else
+        {
+            stress->gaps += (stress->received > 0U) ? (seq - stress->last_seq - 1U) : seq;
+        }
+
+        if (length != frame_length(seq))
+        {
+            stress->length_errors++;
+        }
+        else
+        {
+            for (uint32_t i = 0; i < length; ++i)
+            {
+                if (payload[i] != frame_byte(seq, i))
+                {
+                    stress->payload_errors++;
+                    break;
+                }
+            }
+        }
+
+        stress->last_seq = seq;
+        stress->received++;
+
+        stall(&random);
+        radar_shm_ring_release(&stress->ring);
+    }
+
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    static stress_s stress;
+    pthread_t producer_thread;
+    pthread_t consumer_thread;
+    const uint32_t num_slots = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 4U;
+    uint32_t tail_drops;
+    int result;
+
+    stress.frames = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 10000000U;
+    if ((stress.frames == 0U) || (argc > 3) || (radar_shm_ring_init(&stress.ring, num_slots, SLOT_SIZE, malloc) != 0))
+    {
+        fprintf(stderr, "usage: %s [frames] [slots, a power of two]\n", argv[0]);
+        return 2;
+    }
+
+    if ((pthread_create(&consumer_thread, NULL, consumer, &stress) != 0) ||
+        (pthread_create(&producer_thread, NULL, producer, &stress) != 0))
+    {
+        return 1;
+    }
+    pthread_join(producer_thread, NULL);
+    pthread_join(consumer_thread, NULL);
+
+    /* drops after the last received frame leave no gap */
+    tail_drops = (stress.received > 0U) ? (stress.frames - 1U - stress.last_seq) : stress.frames;
+
+    result = ((stress.received == stress.published) &&
+              (stress.published + stress.discarded == stress.frames) &&
+              (stress.ring.dropped == stress.discarded) &&
+              (stress.gaps + tail_drops == stress.discarded) &&
+              (stress.seq_errors == 0U) && (stress.length_errors == 0U) && (stress.payload_errors == 0U) &&
+              (radar_shm_ring_count(&stress.ring) == 0U)) ? 0 : 1;
+
+    printf("frames %u slots %u: %s\n", stress.frames, num_slots,
+           (result == 0) ? "every frame received intact or counted as dropped" : "MISMATCH");
+    printf("received %u dropped %u (gaps %u, after the last %u), level max %u\n",
+           stress.received, stress.ring.dropped, stress.gaps, tail_drops, stress.level_max);
+    printf("errors: sequence %u length %u payload %u\n",
+           stress.seq_errors, stress.length_errors, stress.payload_errors);
+
+    return result;
+}
@@ -0,0 +1,332 @@
+/*****************************************************************************
+ * File name: radar_telemetry_decoder.c
+ *
+ * Description: This file implements the host decoder of the binary telemetry
+ * protocol.
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "radar_telemetry_decoder.h"
+
+/* records above this size are treated as corrupt */
+#define RECORD_UB                   (1UL << 20)
+
+/*******************************************************************************
+ * Function Name: cobs_decode
+ ********************************************************************************
+ * Summary:
+ *   Decodes the COBS bytes of a message, without the delimiter
+ *
+ * Parameters:
+ *   src: encoded bytes
+ *   len: number of encoded bytes
+ *   dst: decoded message, at most len bytes
+ *
+ * Return:
+ *   bytes of the message, -1 if the encoding is invalid
+ *******************************************************************************/
+static int32_t cobs_decode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+    uint32_t i = 0;
+    uint32_t out = 0;
+
+    while (i < len)
+    {
+        const uint8_t code = src[i++];
+
+        if (code == 0U)
+        {
+            return -1;
+        }
+
+        for (uint8_t j = 1; j < code; ++j)
+        {
+            if (i >= len)
+            {
+                return -1;
+            }
+            dst[out++] = src[i++];
+        }
+
+        /* the zero implied by the last code is the delimiter */
+        if ((code < 0xFFU) && (i < len))
+        {
+            dst[out++] = 0U;
+        }
+    }
+
+    return (int32_t)out;
+}
+
+/*******************************************************************************
+ * Function Name: close_record
+ ********************************************************************************
+ * Summary:
+ *   Abandons the frame record being reassembled
+ *
+ * Parameters:
+ *   decoder: decoder state
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void close_record(radar_telemetry_decoder_s *decoder)
+{
+    if (decoder->record_number >= 0)
+    {
+        decoder->lost_records++;
+        decoder->record_number = -1;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: handle_frame_chunk
+ ********************************************************************************
+ * Summary:
+ *   Appends a chunk to its frame record, passes the record on when complete.
+ *   A record with a missing chunk is dropped.
+ *
+ * Parameters:
+ *   decoder: decoder state
+ *   payload: chunk header and data
+ *   len: bytes of the payload
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void handle_frame_chunk(radar_telemetry_decoder_s *decoder, const uint8_t *payload, uint32_t len)
+{
+    const uint16_t number = (uint16_t)(payload[0] | (payload[1] << 8));
+    const uint32_t offset = radar_telemetry_get_u32(&payload[2]);
+    const uint32_t record_len = radar_telemetry_get_u32(&payload[6]);
+    const uint32_t chunk = len - RADAR_TELEMETRY_CHUNK_HEADER_SIZE;
+
+    if (decoder->record_number != (int32_t)number)
+    {
+        close_record(decoder);
+
+        if ((offset != 0U) || (record_len == 0U) || (record_len > RECORD_UB))
+        {
+            /* joined in the middle of a record */
+            return;
+        }
+
+        if (record_len > decoder->record_size)
+        {
+            uint8_t *record = realloc(decoder->record, record_len);
+            if (record == NULL)
+            {
+                return;
+            }
+            decoder->record = record;
+            decoder->record_size = record_len;
+        }
+
+        decoder->record_len = record_len;
+        decoder->record_received = 0;
+        decoder->record_number = number;
+    }
+
+    if ((offset != decoder->record_received) || (record_len != decoder->record_len) ||
+        (chunk > (record_len - offset)))
+    {
+        close_record(decoder);
+        return;
+    }
+
+    memcpy(&decoder->record[offset], &payload[RADAR_TELEMETRY_CHUNK_HEADER_SIZE], chunk);
+    decoder->record_received += chunk;
+
+    if (decoder->record_received == decoder->record_len)
+    {
+        decoder->records++;
+        decoder->record_number = -1;
+
+        if (decoder->handlers.frame != NULL)
+        {
+            decoder->handlers.frame(decoder->handlers.ctx, decoder->record, decoder->record_len);
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: handle_message
+ ********************************************************************************
+ * Summary:
+ *   Checks a decoded message and passes its content to the handlers
+ *
+ * Parameters:
+ *   decoder: decoder state
+ *   message: type, sequence number, payload and CRC
+ *   len: bytes of the message
+ *
+ * Return:
+ *   none
+ *******************************************************************************/
+static void handle_message(radar_telemetry_decoder_s *decoder, const uint8_t *message, uint32_t len)
+{
+    const radar_telemetry_handlers_s *handlers = &decoder->handlers;
+    const uint8_t *payload = &message[2];
+    uint32_t payload_len;
+
+    if ((len < 4U) || (radar_telemetry_crc16(message, len - 2U) !=
+                       (uint16_t)(message[len - 2U] | (message[len - 1U] << 8))))
+    {
+        decoder->bad_messages++;
+        return;
+    }
+
+    payload_len = len - 4U;
+
+    if (decoder->last_seq >= 0)
+    {
+        decoder->lost_messages += (uint8_t)(message[1] - (uint8_t)decoder->last_seq - 1U);
+    }
+    decoder->last_seq = message[1];
+    decoder->messages++;
+
+    switch (message[0])
+    {
+        case RADAR_TELEMETRY_MSG_GESTURE:
+            if ((payload_len == 9U) && (handlers->gesture != NULL))
+            {
+                radar_telemetry_gesture_s gesture;
+                uint32_t score_bits = radar_telemetry_get_u32(&payload[1]);
+
+                gesture.gesture = payload[0];
+                memcpy(&gesture.score, &score_bits, sizeof(gesture.score));
+                gesture.timestamp_ms = radar_telemetry_get_u32(&payload[5]);
+                handlers->gesture(handlers->ctx, &gesture);
+            }
+            break;
+
+        case RADAR_TELEMETRY_MSG_METRICS:
+            if ((payload_len == 25U) && (handlers->metrics != NULL))
+            {
+                radar_telemetry_metrics_s metrics;
+
+                metrics.timestamp_ms = radar_telemetry_get_u32(&payload[0]);
+                metrics.frames = radar_telemetry_get_u32(&payload[4]);
+                metrics.deadline_misses = radar_telemetry_get_u32(&payload[8]);
+                metrics.latency_mean = radar_telemetry_get_u32(&payload[12]);
+                metrics.latency_max = radar_telemetry_get_u32(&payload[16]);
+                metrics.dropped = radar_telemetry_get_u32(&payload[20]);
+                metrics.shed_level = payload[24];
+                handlers->metrics(handlers->ctx, &metrics);
+            }
+            break;
+
+        case RADAR_TELEMETRY_MSG_TRACE:
+            if ((payload_len == 10U) && (handlers->trace != NULL))
+            {
+                radar_telemetry_trace_s trace;
+
+                trace.event = (uint16_t)(payload[0] | (payload[1] << 8));
+                trace.arg = radar_telemetry_get_u32(&payload[2]);
+                trace.cycles = radar_telemetry_get_u32(&payload[6]);
+                handlers->trace(handlers->ctx, &trace);
+            }
+            break;
+
+        case RADAR_TELEMETRY_MSG_FRAME:
+            if (payload_len > RADAR_TELEMETRY_CHUNK_HEADER_SIZE)
+            {
+                handle_frame_chunk(decoder, payload, payload_len);
+            }
+            break;
+
+        default:
+            /* types of newer firmware are skipped */
+            break;
+    }
+}
+
+/*
+ * Initialize the decoder
+ */
+void radar_telemetry_decoder_init(radar_telemetry_decoder_s *decoder, const radar_telemetry_handlers_s *handlers)
+{
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->handlers = *handlers;
+    decoder->last_seq = -1;
+    decoder->record_number = -1;
+}
+
+/*
+ * Feed received bytes
+ */
+void radar_telemetry_decoder_feed(radar_telemetry_decoder_s *decoder, const uint8_t *data, uint32_t len)
+{
+    uint8_t message[RADAR_TELEMETRY_WIRE_UB];
+
+    decoder->bytes += len;
+
+    for (uint32_t i = 0; i < len; ++i)
+    {
+        if (data[i] != 0U)
+        {
+            if (decoder->wire_len < sizeof(decoder->wire))
+            {
+                decoder->wire[decoder->wire_len++] = data[i];
+            }
+            else
+            {
+                decoder->overflow = true;
+            }
+            continue;
+        }
+
+        /* delimiter, empty messages are back to back delimiters */
+        if (decoder->overflow)
+        {
+            decoder->bad_messages++;
+        }
+        else if (decoder->wire_len > 0U)
+        {
+            const int32_t message_len = cobs_decode(decoder->wire, decoder->wire_len, message);
+
+            if (message_len < 0)
+            {
+                decoder->bad_messages++;
+            }
+            else
+            {
+                handle_message(decoder, message, (uint32_t)message_len);
+            }
+        }
+
+        decoder->wire_len = 0;
+        decoder->overflow = false;
+    }
+}
+
+/*
+ * Release the reassembly buffer
+ */
+void radar_telemetry_decoder_free(radar_telemetry_decoder_s *decoder)
+{
+    free(decoder->record);
+    decoder->record = NULL;
+    decoder->record_size = 0;
+    decoder->record_number = -1;
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+** File name: radar_telemetry_decoder.h
+**
+** Description: This file contains the host decoder of the binary telemetry
+**   protocol. Bytes are fed as they arrive from the UART, complete messages
+**   with a valid CRC are passed to a callback, frame records are reassembled
+**   from their chunks.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef RADAR_TELEMETRY_DECODER_H_
+#define RADAR_TELEMETRY_DECODER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "radar_telemetry.h"
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/*
+ * @typedef typedef struct  radar_telemetry_handlers_s
+ * Callbacks of the decoded messages, any of them can be NULL
+ */
+typedef struct {
+    void (*gesture)(void *ctx, const radar_telemetry_gesture_s *gesture);
+    void (*metrics)(void *ctx, const radar_telemetry_metrics_s *metrics);
+    void (*trace)(void *ctx, const radar_telemetry_trace_s *trace);
+    void (*frame)(void *ctx, const uint8_t *record, uint32_t len); /*<< complete frame record */
+    void *ctx;
+} radar_telemetry_handlers_s;
+
+/*
+ * @typedef typedef struct  radar_telemetry_decoder_s
+ * Decoder state and counters
+ */
+typedef struct {
+    radar_telemetry_handlers_s handlers;
+    uint8_t wire[RADAR_TELEMETRY_WIRE_UB];
+    uint32_t wire_len;
+    bool overflow;                  /*<< the current message exceeds the buffer */
+    int32_t last_seq;               /*<< -1 before the first message */
+
+    uint8_t *record;                /*<< frame record being reassembled */
+    uint32_t record_size;           /*<< bytes allocated for the record */
+    uint32_t record_len;
+    uint32_t record_received;
+    int32_t record_number;          /*<< -1 if no record is open */
+
+    uint32_t messages;              /*<< valid messages */
+    uint32_t bad_messages;          /*<< CRC, COBS or length errors, includes text between messages */
+    uint32_t lost_messages;         /*<< gaps of the sequence number */
+    uint32_t records;               /*<< complete frame records */
+    uint32_t lost_records;          /*<< frame records with missing chunks */
+    uint64_t bytes;                 /*<< bytes fed */
+} radar_telemetry_decoder_s;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Initialize the decoder
+ *
+ * @param[out] decoder decoder state
+ * @param[in] handlers callbacks of the decoded messages
+ */
+void radar_telemetry_decoder_init(radar_telemetry_decoder_s *decoder, const radar_telemetry_handlers_s *handlers);
+
+/** @brief Feed received bytes
+ *
+ * @param[in,out] decoder decoder state
+ * @param[in] data bytes in the order received
+ * @param[in] len number of bytes
+ */
+void radar_telemetry_decoder_feed(radar_telemetry_decoder_s *decoder, const uint8_t *data, uint32_t len);
+
+/** @brief Release the reassembly buffer
+ *
+ * @param[in,out] decoder decoder state
+ */
+void radar_telemetry_decoder_free(radar_telemetry_decoder_s *decoder);
+
+#endif /* RADAR_TELEMETRY_DECODER_H_ */
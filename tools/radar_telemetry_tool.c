@@ -0,0 +1,283 @@
+/*****************************************************************************
+ * File name: radar_telemetry_tool.c
+ *
+ * Description: Host tool for the binary telemetry. Prints the messages of a
+ * UART capture, writes the frame records for radar_rice_tool, and measures
+ * the encode and decode throughput of the protocol.
+ *
+ * Build: gcc -O2 -DRADAR_DSP_REFERENCE -Isource -Itools tools/radar_telemetry_tool.c
+ *            tools/radar_telemetry_decoder.c source/radar_telemetry.c -o radar_telemetry_tool
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "radar_telemetry_decoder.h"
+
+/* bytes of the benchmark stream */
+#define BENCH_BYTES                 (64UL << 20)
+
+/* bytes of a frame record in the benchmark, the packed frame of the gestures profile */
+#define BENCH_RECORD_SIZE           (9216U)
+
+static const char *const gesture_names[] =
+{
+    "BACKGROUND", "PUSH", "SWIPE_LEFT", "SWIPE_RIGHT", "UNKNOWN_1", "UNKNOWN_2", "SWIPE_UP", "SWIPE_DOWN"
+};
+
+static FILE *records_file;
+static uint8_t *bench_buffer;
+static size_t bench_len;
+
+/*******************************************************************************
+ * Function Name: print_gesture
+ ********************************************************************************
+ * Summary:
+ *   Prints a gesture event
+ *******************************************************************************/
+static void print_gesture(void *ctx, const radar_telemetry_gesture_s *gesture)
+{
+    (void)ctx;
+    printf("%10u gesture %s %f\n", gesture->timestamp_ms,
+           (gesture->gesture < 8U) ? gesture_names[gesture->gesture] : "?", (double)gesture->score);
+}
+
+/*******************************************************************************
+ * Function Name: print_metrics
+ ********************************************************************************
+ * Summary:
+ *   Prints the pipeline metrics
+ *******************************************************************************/
+static void print_metrics(void *ctx, const radar_telemetry_metrics_s *metrics)
+{
+    (void)ctx;
+    printf("%10u metrics frames %u misses %u latency mean %u max %u dropped %u shed %u\n",
+           metrics->timestamp_ms, metrics->frames, metrics->deadline_misses, metrics->latency_mean,
+           metrics->latency_max, metrics->dropped, metrics->shed_level);
+}
+
+/*******************************************************************************
+ * Function Name: print_trace
+ ********************************************************************************
+ * Summary:
+ *   Prints a trace event
+ *******************************************************************************/
+static void print_trace(void *ctx, const radar_telemetry_trace_s *trace)
+{
+    static const char *const events[] = { "?", "run_state", "shed_level" };
+
+    (void)ctx;
+    printf("%10s trace %s %u at %u\n", "", (trace->event < 3U) ? events[trace->event] : "?",
+           trace->arg, trace->cycles);
+}
+
+/*******************************************************************************
+ * Function Name: write_frame
+ ********************************************************************************
+ * Summary:
+ *   Appends a frame record to the records file
+ *******************************************************************************/
+static void write_frame(void *ctx, const uint8_t *record, uint32_t len)
+{
+    (void)ctx;
+    if (records_file != NULL)
+    {
+        (void)fwrite(record, 1, len, records_file);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: decode_capture
+ ********************************************************************************
+ * Summary:
+ *   Feeds a capture to the decoder in blocks like a serial port would
+ *
+ * Parameters:
+ *   in_path: UART capture
+ *   records_path: frame records output, NULL to skip them
+ *
+ * Return:
+ *   process exit code
+ *******************************************************************************/
+static int decode_capture(const char *in_path, const char *records_path)
+{
+    const radar_telemetry_handlers_s handlers = {
+        .gesture = print_gesture,
+        .metrics = print_metrics,
+        .trace = print_trace,
+        .frame = write_frame,
+        .ctx = NULL
+    };
+    static radar_telemetry_decoder_s decoder;
+    uint8_t block[4096];
+    size_t len;
+    FILE *in = fopen(in_path, "rb");
+
+    if (in == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", in_path);
+        return 1;
+    }
+
+    if (records_path != NULL)
+    {
+        records_file = fopen(records_path, "wb");
+        if (records_file == NULL)
+        {
+            fprintf(stderr, "cannot write %s\n", records_path);
+            fclose(in);
+            return 1;
+        }
+    }
+
+    radar_telemetry_decoder_init(&decoder, &handlers);
+
+    while ((len = fread(block, 1, sizeof(block), in)) > 0U)
+    {
+        radar_telemetry_decoder_feed(&decoder, block, (uint32_t)len);
+    }
+
+    fclose(in);
+    if (records_file != NULL)
+    {
+        fclose(records_file);
+    }
+
+    printf("messages %u bad %u lost %u records %u lost records %u\n", decoder.messages,
+           decoder.bad_messages, decoder.lost_messages, decoder.records, decoder.lost_records);
+    radar_telemetry_decoder_free(&decoder);
+
+    return (decoder.messages != 0U) ? 0 : 1;
+}
+
+/*******************************************************************************
+ * Function Name: bench_sink
+ ********************************************************************************
+ * Summary:
+ *   Sink of the benchmark, appends the encoded messages to memory
+ *******************************************************************************/
+static void bench_sink(const uint8_t *data, uint32_t len)
+{
+    memcpy(&bench_buffer[bench_len], data, len);
+    bench_len += len;
+}
+
+/*******************************************************************************
+ * Function Name: count_frame
+ ********************************************************************************
+ * Summary:
+ *   Counts the bytes of the decoded frame records
+ *******************************************************************************/
+static void count_frame(void *ctx, const uint8_t *record, uint32_t len)
+{
+    (void)record;
+    *(uint64_t*)ctx += len;
+}
+
+/*******************************************************************************
+ * Function Name: bench
+ ********************************************************************************
+ * Summary:
+ *   Encodes a mix of frame records, gestures, metrics and traces into
+ *   memory, decodes it again and reports the throughput of both directions
+ *   and the overhead on the wire
+ *
+ * Parameters:
+ *   none
+ *
+ * Return:
+ *   process exit code
+ *******************************************************************************/
+static int bench(void)
+{
+    static radar_telemetry_s telemetry;
+    static radar_telemetry_decoder_s decoder;
+    uint64_t decoded_bytes = 0;
+    const radar_telemetry_handlers_s handlers = { .frame = count_frame, .ctx = &decoded_bytes };
+    const radar_telemetry_metrics_s metrics = { .frames = 1000, .latency_mean = 2000000 };
+    uint8_t *record = malloc(BENCH_RECORD_SIZE);
+    uint64_t record_bytes = 0;
+    uint32_t records = 0;
+    clock_t start;
+    double encode_s;
+    double decode_s;
+
+    bench_buffer = malloc(BENCH_BYTES + (2U * BENCH_RECORD_SIZE));
+    if ((record == NULL) || (bench_buffer == NULL) || (radar_telemetry_init(&telemetry, bench_sink) != 0))
+    {
+        return 1;
+    }
+
+    /* compressed frames are close to random, zeros are as frequent as any byte */
+    srand(1);
+    for (uint32_t i = 0; i < BENCH_RECORD_SIZE; ++i)
+    {
+        record[i] = (uint8_t)rand();
+    }
+
+    start = clock();
+    while (bench_len < BENCH_BYTES)
+    {
+        (void)radar_telemetry_send_frame(&telemetry, record, BENCH_RECORD_SIZE);
+        (void)radar_telemetry_send_gesture(&telemetry, 1U, 0.9f, records);
+        (void)radar_telemetry_send_metrics(&telemetry, &metrics);
+        (void)radar_telemetry_send_trace(&telemetry, RADAR_TELEMETRY_TRACE_SHED_LEVEL, 0U, records);
+        record_bytes += BENCH_RECORD_SIZE;
+        ++records;
+    }
+    encode_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    radar_telemetry_decoder_init(&decoder, &handlers);
+    start = clock();
+    radar_telemetry_decoder_feed(&decoder, bench_buffer, (uint32_t)bench_len);
+    decode_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("records %u messages %u bad %u lost %u\n", decoder.records, decoder.messages,
+           decoder.bad_messages, decoder.lost_messages);
+    printf("encode %.1f MB/s decode %.1f MB/s overhead %.2f %%\n",
+           (double)bench_len / encode_s / 1e6, (double)bench_len / decode_s / 1e6,
+           100.0 * (double)(telemetry.wire_bytes - telemetry.payload_bytes) / (double)telemetry.payload_bytes);
+
+    radar_telemetry_decoder_free(&decoder);
+    free(bench_buffer);
+    free(record);
+
+    return ((decoder.records == records) && (decoded_bytes == record_bytes) && (decoder.bad_messages == 0U)) ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    if (((argc == 3) || (argc == 4)) && (strcmp(argv[1], "decode") == 0))
+    {
+        return decode_capture(argv[2], (argc == 4) ? argv[3] : NULL);
+    }
+
+    if ((argc == 2) && (strcmp(argv[1], "bench") == 0))
+    {
+        return bench();
+    }
+
+    fprintf(stderr, "usage: %s decode <capture> [records.bin]\n"
+                    "       %s bench\n", argv[0], argv[0]);
+    return 2;
+}
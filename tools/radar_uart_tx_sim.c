@@ -0,0 +1,209 @@
+/*****************************************************************************
+ * File name: radar_uart_tx_sim.c
+ *
+ * Description: Host simulation of the UART transmit ring against a UART of
+ * configurable baud rate. Replays the console and telemetry load of the
+ * application, checks that the bytes on the wire are exactly the bytes the
+ * ring took, in order, and reports drops, fill level and how long a
+ * blocking write would have held the writers.
+ *
+ * Build: gcc -O2 -DRADAR_DSP_REFERENCE -Isource tools/radar_uart_tx_sim.c
+ *            source/radar_uart_tx.c -o radar_uart_tx_sim
+ *
+ * ===========================================================================
+ * Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+ * ===========================================================================
+ *
+ * ===========================================================================
+ * Infineon Technologies AG (INFINEON) is supplying this file for use
+ * exclusively with Infineon's sensor products. This file can be freely
+ * distributed within development tools and software supporting such
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+ * WHATSOEVER.
+ * ===========================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "radar_uart_tx.h"
+
+/* simulated time step and frame period of the application in microseconds */
+#define STEP_US                     (10U)
+#define FRAME_US                    (33000U)
+
+/* bits per byte on the wire, 8N1 */
+#define BITS_PER_BYTE               (10U)
+
+/*
+ * @typedef typedef struct  sim_uart_s
+ * Simulated UART and the record of what it sent
+ */
+typedef struct {
+    uint32_t baud;
+    uint64_t now_us;
+    uint64_t done_at_us;            /*<< completion of the running transfer */
+    const uint8_t *data;            /*<< ring bytes of the running transfer */
+    uint32_t len;
+
+    uint8_t *wire;                  /*<< bytes sent */
+    uint32_t wire_len;
+    uint8_t *expected;              /*<< bytes the ring took, in order */
+    uint32_t expected_len;
+    uint32_t capacity;
+} sim_uart_s;
+
+static radar_uart_tx_s tx;
+
+/*******************************************************************************
+ * Function Name: sim_start
+ ********************************************************************************
+ * Summary:
+ *   Start function of the ring, the transfer completes after the time the
+ *   bytes take on the wire
+ *******************************************************************************/
+static int32_t sim_start(void *ctx, const uint8_t *data, uint32_t len)
+{
+    sim_uart_s *uart = (sim_uart_s*)ctx;
+
+    uart->data = data;
+    uart->len = len;
+    uart->done_at_us = uart->now_us + (((uint64_t)len * BITS_PER_BYTE * 1000000U) / uart->baud) + 1U;
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: sim_advance
+ ********************************************************************************
+ * Summary:
+ *   Advances the simulated time. A completed transfer copies its bytes from
+ *   the ring only now, so bytes overwritten while in flight show up as a
+ *   mismatch.
+ *******************************************************************************/
+static void sim_advance(sim_uart_s *uart, uint64_t us)
+{
+    const uint64_t end = uart->now_us + us;
+
+    while (uart->now_us < end)
+    {
+        uart->now_us += STEP_US;
+
+        if ((uart->len != 0U) && (uart->now_us >= uart->done_at_us))
+        {
+            memcpy(&uart->wire[uart->wire_len], uart->data, uart->len);
+            uart->wire_len += uart->len;
+            uart->len = 0;
+            radar_uart_tx_done(&tx);
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: sim_write
+ ********************************************************************************
+ * Summary:
+ *   Writes a message of counting bytes and records what the ring took
+ *******************************************************************************/
+static void sim_write(sim_uart_s *uart, uint32_t len, radar_uart_tx_policy_e policy, uint64_t *blocking_us)
+{
+    static uint8_t counter;
+    uint8_t message[2048];
+    uint32_t taken;
+
+    for (uint32_t i = 0; i < len; ++i)
+    {
+        message[i] = counter++;
+    }
+
+    taken = radar_uart_tx_write(&tx, message, len, policy, 0);
+    if ((policy == RADAR_UART_TX_ATOMIC) && (taken != 0U) && (taken != len))
+    {
+        printf("error: atomic write split\n");
+    }
+
+    memcpy(&uart->expected[uart->expected_len], message, taken);
+    uart->expected_len += taken;
+
+    *blocking_us += ((uint64_t)len * BITS_PER_BYTE * 1000000U) / uart->baud;
+}
+
+int main(int argc, char **argv)
+{
+    static sim_uart_s uart;
+    const uint32_t seconds = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 10U;
+    const uint32_t frames = (seconds * 1000000U) / FRAME_US;
+    uint64_t stage_blocking_us = 0;
+    uint64_t stage_blocking_max_us = 0;
+    uint64_t console_blocking_us = 0;
+    int result;
+
+    uart.baud = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 115200U;
+    if ((uart.baud == 0U) || (argc > 3))
+    {
+        fprintf(stderr, "usage: %s [baud] [seconds]\n", argv[0]);
+        return 2;
+    }
+
+    uart.capacity = (uint32_t)(((uint64_t)uart.baud * seconds) / BITS_PER_BYTE) + (1U << 20);
+    uart.wire = malloc(uart.capacity);
+    uart.expected = malloc(uart.capacity);
+    if ((uart.wire == NULL) || (uart.expected == NULL) || (radar_uart_tx_init(&tx, sim_start, &uart) != 0))
+    {
+        return 1;
+    }
+
+    for (uint32_t frame = 0; frame < frames; ++frame)
+    {
+        uint64_t frame_blocking_us = 0;
+
+        /* decision stage: a gesture line every 10th frame, a telemetry message every frame */
+        if ((frame % 10U) == 0U)
+        {
+            sim_write(&uart, 48U, RADAR_UART_TX_TRUNCATE, &frame_blocking_us);
+        }
+        sim_write(&uart, 40U, RADAR_UART_TX_ATOMIC, &frame_blocking_us);
+
+        stage_blocking_us += frame_blocking_us;
+        if (frame_blocking_us > stage_blocking_max_us)
+        {
+            stage_blocking_max_us = frame_blocking_us;
+        }
+
+        /* console: a help listing every 3 s, written in lines */
+        if ((frame % 90U) == 45U)
+        {
+            for (uint32_t line = 0; line < 24U; ++line)
+            {
+                sim_write(&uart, 80U, RADAR_UART_TX_TRUNCATE, &console_blocking_us);
+            }
+        }
+
+        sim_advance(&uart, FRAME_US);
+    }
+
+    /* drain the ring */
+    sim_advance(&uart, ((uint64_t)RADAR_UART_TX_RING_SIZE * BITS_PER_BYTE * 1000000U) / uart.baud + FRAME_US);
+
+    result = ((uart.wire_len == uart.expected_len) &&
+              (memcmp(uart.wire, uart.expected, uart.wire_len) == 0) &&
+              (radar_uart_tx_level(&tx) == 0U)) ? 0 : 1;
+
+    printf("baud %u frames %u: %s\n", uart.baud, frames, (result == 0) ? "wire matches" : "wire MISMATCH");
+    printf("written %u dropped %u bytes in %u writes, transfers %u, level max %u of %u\n",
+           tx.written, tx.dropped, tx.dropped_writes, tx.transfers, tx.level_max, RADAR_UART_TX_RING_SIZE);
+    printf("blocking writes would hold the stages %.1f us per frame (max %.1f us), the console %.1f ms in total\n",
+           (double)stage_blocking_us / frames, (double)stage_blocking_max_us, (double)console_blocking_us / 1000.0);
+
+    free(uart.wire);
+    free(uart.expected);
+
+    return result;
+}
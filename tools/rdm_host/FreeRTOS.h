@@ -0,0 +1,75 @@
+/******************************************************************************
+** File name: FreeRTOS.h
+**
+** Description: Host stand-in of the FreeRTOS types and port macros the
+**   radar data manager uses, so xensiv_radar_data_management.c builds
+**   unchanged for tools/radar_rdm_bench.c. The copies, moves and clears of
+**   the manager buffer are routed to counters of the benchmark.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+#define pdFALSE                         ((BaseType_t)0)
+#define pdTRUE                          ((BaseType_t)1)
+
+/* the benchmark runs single threaded, there is no context to switch to */
+#define portYIELD_FROM_ISR(woken)       ((void)(woken))
+
+/* copies and clears of the manager, counted by the benchmark */
+#define memcpy(dst, src, n)             rdm_host_memcpy((dst), (src), (n))
+#define memset(dst, value, n)           rdm_host_memset((dst), (value), (n))
+#define memmove(dst, src, n)            rdm_host_memmove((dst), (src), (n))
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief memcpy counting the bytes copied
+ */
+void* rdm_host_memcpy(void *dst, const void *src, size_t n);
+
+/** @brief memset counting the bytes cleared
+ */
+void* rdm_host_memset(void *dst, int value, size_t n);
+
+/** @brief memmove counting the bytes moved
+ */
+void* rdm_host_memmove(void *dst, const void *src, size_t n);
+
+#endif /* INC_FREERTOS_H */
@@ -0,0 +1,60 @@
+/******************************************************************************
+** File name: task.h
+**
+** Description: Host stand-in of the FreeRTOS task notifications the radar
+**   data manager uses. A task is a subscriber of tools/radar_rdm_bench.c,
+**   a notification increments its pending count.
+**
+** ===========================================================================
+** Copyright (C) 2023 Infineon Technologies AG. All rights reserved.
+** ===========================================================================
+**
+** ===========================================================================
+** Infineon Technologies AG (INFINEON) is supplying this file for use
+** exclusively with Infineon's sensor products. This file can be freely
+** distributed within development tools and software supporting such
+** products.
+**
+** THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+** OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+** MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+** INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES, FOR ANY REASON
+** WHATSOEVER.
+** ===========================================================================
+*/
+
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "FreeRTOS.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+
+/* the benchmark calls run() and the subscribers in turn, nothing interrupts them */
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+/*******************************************************************************
+ * Types
+ *******************************************************************************/
+
+/* defined by the benchmark */
+struct tskTaskControlBlock;
+typedef struct tskTaskControlBlock* TaskHandle_t;
+
+/*******************************************************************************
+ * Functions
+ *******************************************************************************/
+
+/** @brief Notify a task from an interrupt
+ */
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_task_woken);
+
+/** @brief Notify a task
+ */
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+
+#endif /* INC_TASK_H */